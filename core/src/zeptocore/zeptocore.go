@@ -229,31 +229,10 @@ func (f File) Regenerate() {
 			return
 		}
 
-		log.Tracef("slices: %+v", f.SliceStart)
-		fname1 := path.Join(folder, fmt.Sprintf("%s.1.wav", filenameWithouExt))
-		err = createTimeStretched(f.PathToAudio, fname1, 0.125, f.Channels, f.Oversampling)
-		if err != nil {
-			log.Error(err)
-		}
-		log.Trace("-------------------------")
+		// the time stretch runs on the device, so only the original is
+		// written
 		log.Tracef("slices: %+v", f.SliceStart)
 		log.Tracef("slice types: %+v", f.SliceType)
-		log.Trace("-------------------------")
-		err = f.updateInfo(fname1)
-		if err != nil {
-			log.Error(err)
-		}
-
-		// fname2 := path.Join(folder, fmt.Sprintf("%s.2.wav", filenameWithouExt))
-		// err = createTimeStretched(f.PathToAudio, fname2, 0.125, f.Channels, f.Oversampling)
-		// if err != nil {
-		// 	log.Error(err)
-		// }
-		// err = f.updateInfo(fname2)
-		// if err != nil {
-		// 	log.Error(err)
-		// }
-
 	}
 	f.debounceRegen(fu)
 }
@@ -362,23 +341,6 @@ func (f *File) SetTempoMatch(TempoMatch bool) {
 	}()
 }
 
-// createTimeStretched will create timestretched file from input
-// and process it to format it for zeptocore
-func createTimeStretched(fnameIn string, fnameOut string, ratio float64, channels int, oversampling int) (err error) {
-	log.Tracef("creating timestretched %s", fnameOut)
-	_, _, err = utils.Run("sox", fnameIn, "1.wav", "tempo", "-m", fmt.Sprintf("%2.8f", ratio))
-	if err != nil {
-		log.Error(err)
-		return
-	}
-	err = processSound("1.wav", fnameOut, channels, oversampling)
-	if err != nil {
-		log.Error(err)
-		return
-	}
-	return
-}
-
 // processSound takes a sound file and processes it to be ready for the zeptocore
 // by padding the beginning with the end and the end with the beginning
 // as well as converting it to the right format and bit rate
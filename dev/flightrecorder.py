@@ -0,0 +1,104 @@
+# decode a flight recorder dump written by lib/flightrecorder.h
+# python3 dev/flightrecorder.py /media/sdcard/flight00.bin
+
+import struct
+import sys
+
+HEADER = struct.Struct("<IHHHHI")
+RECORD = struct.Struct("<IiIHHHHHHBBBBBBH10H")
+MAGIC = 0x31544C46
+
+FLAGS = [
+    (0x0001, "muted"),
+    (0x0002, "stereo"),
+    (0x0004, "reverse"),
+    (0x0008, "crossfade"),
+    (0x0010, "fade_in"),
+    (0x0020, "fade_out"),
+    (0x0040, "open_file"),
+    (0x0080, "file_open"),
+    (0x0100, "quadratic"),
+    (0x0200, "sd_busy"),
+    (0x0400, "reduce_cpu"),
+    (0x0800, "sd_retry"),
+    (0x8000, "OVERRUN"),
+]
+
+STAGES = [
+    "take",
+    "seek",
+    "read",
+    "fx",
+    "resample",
+    "filter",
+    "lfo",
+    "delay",
+    "give",
+    "other",
+]
+
+
+def decode(fname):
+    with open(fname, "rb") as f:
+        data = f.read()
+    magic, record_size, records, trigger, us_per_block, dumps = HEADER.unpack_from(
+        data, 0
+    )
+    if magic != MAGIC:
+        raise ValueError("not a flight recorder dump")
+    if record_size != RECORD.size:
+        raise ValueError(
+            "record size {} does not match decoder {}".format(record_size, RECORD.size)
+        )
+    print(
+        "{}: dump {}, {} us per block, overrun at record {}".format(
+            fname, dumps, us_per_block, trigger
+        )
+    )
+    for i in range(records):
+        r = RECORD.unpack_from(data, HEADER.size + i * RECORD.size)
+        (block, phase, fx_active, total_us, sd_us, take_us, give_us) = r[:7]
+        (values_to_read, flags, bank, sample, variation, retrig_pitch) = r[7:13]
+        (pitch_val_index, envelope_pitch, bpm) = r[13:16]
+        stage_us = r[16:]
+        if total_us == 0 and flags == 0:
+            # never written, the ring had not wrapped yet
+            continue
+        names = [name for bit, name in FLAGS if flags & bit]
+        fx = [str(j) for j in range(32) if fx_active & (1 << j)]
+        print(
+            "{}{:8d} {:5d}us sd {:5d} take {:4d} give {:4d} read {:5d} "
+            "phase {:9d} b{}s{}v{} bpm {} pitch {}/{}/{:.2f} fx [{}] {}".format(
+                ">" if i == trigger else " ",
+                block,
+                total_us,
+                sd_us,
+                take_us,
+                give_us,
+                values_to_read,
+                phase,
+                bank,
+                sample,
+                variation,
+                bpm,
+                pitch_val_index,
+                retrig_pitch,
+                envelope_pitch / 100.0,
+                ",".join(fx),
+                " ".join(names),
+            )
+        )
+        if any(stage_us):
+            print(
+                "          "
+                + " ".join(
+                    "{} {}".format(STAGES[j], stage_us[j])
+                    for j in range(len(STAGES))
+                    if stage_us[j] > 0
+                )
+            )
+
+
+if __name__ == "__main__":
+    for fname in sys.argv[1:]:
+        decode(fname)
@@ -0,0 +1,67 @@
+# check the functions placed in sram (RAM_FUNC in lib/ramfunc.h and the sdk's
+# own __not_in_flash_func) against a size budget, from the linker map
+# python3 dev/ramfunc_budget.py build/_core.elf.map
+
+import re
+import sys
+
+# bytes allowed per function, anything not listed gets DEFAULT
+DEFAULT = 2048
+BUDGET = {
+    "i2s_callback_func": 8192,
+    "q16_16_multiply": 64,
+    "q16_16_fp_to_int16": 64,
+}
+# all of them together, out of the 264 kB of sram
+TOTAL = 24 * 1024
+
+SECTION = re.compile(r"^ \.time_critical\.(\S+)\s*(?:(0x[0-9a-f]+)\s+(0x[0-9a-f]+))?")
+ADDRESS = re.compile(r"^\s+(0x[0-9a-f]+)\s+(0x[0-9a-f]+)")
+
+
+def parse(path):
+    sizes = {}
+    name = None
+    with open(path) as f:
+        for line in f:
+            m = SECTION.match(line)
+            if m:
+                name = m.group(1)
+                if m.group(3):
+                    sizes[name] = sizes.get(name, 0) + int(m.group(3), 16)
+                    name = None
+                continue
+            if name is not None:
+                m = ADDRESS.match(line)
+                if m:
+                    sizes[name] = sizes.get(name, 0) + int(m.group(2), 16)
+                name = None
+    return sizes
+
+
+def run():
+    if len(sys.argv) < 2:
+        print("usage: python3 dev/ramfunc_budget.py build/_core.elf.map")
+        sys.exit(2)
+    sizes = parse(sys.argv[1])
+    over = 0
+    total = 0
+    print(f"{'function':<44} {'bytes':>6} {'budget':>6}")
+    for name, size in sorted(sizes.items(), key=lambda x: -x[1]):
+        budget = BUDGET.get(name, DEFAULT)
+        total += size
+        flag = ""
+        if size > budget:
+            flag = " OVER"
+            over += 1
+        print(f"{name:<44} {size:>6} {budget:>6}{flag}")
+    flag = ""
+    if total > TOTAL:
+        flag = " OVER"
+        over += 1
+    print(f"{'total':<44} {total:>6} {TOTAL:>6}{flag}")
+    sys.exit(1 if over > 0 else 0)
+
+
+if __name__ == "__main__":
+    run()
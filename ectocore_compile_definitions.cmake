@@ -21,12 +21,36 @@ target_compile_definitions(${PROJECT_NAME} PRIVATE
     # PRINT_AUDIO_CPU_USAGE=1
     # PRINT_MEMORY_USAGE=1
     # PRINT_SDCARD_TIMING=1
+    # PRINT_PROFILER=1
+
+    # per-stage cycle profiler for the audio callback
+    INCLUDE_PROFILER=1
+
+    # keep the blocks around an audio overrun and write them to the sd card.
+    # ectocore has no stop to wait for, so the write mutes the audio right
+    # after the overrun; only turn it on to debug
+    # INCLUDE_FLIGHTRECORDER=1
+
+    # audio block size in samples, one of 64, 128, 256 or 441, and how many
+    # blocks are queued
+    SAMPLES_PER_BUFFER=441
+    AUDIO_BUFFER_COUNT=3
+
+    # pick the system clock from the audio load, slowing down when silent
+    INCLUDE_CLOCK_GOVERNOR=1
+
+    # run the audio hot path from sram instead of flash
+    INCLUDE_RAM_HOT_PATH=1
+
+    # flush the flash cache before every profiled block, to time the
+    # callback from a cold cache
+    # PROFILER_COLD_CACHE=1
 
     # turn off gpio for leds
     LEDS_NO_GPIO=1
 
     # file variations
-    FILE_VARIATIONS=2
+    FILE_VARIATIONS=1
 
     # basics 
     # INCLUDE_KEYBOARD=1
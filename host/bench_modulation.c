@@ -0,0 +1,144 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// _core_bench_modulation holds the modulation to its cycle budget, relative
+// to the delay like _core_bench_reverb:
+//
+//   _core_bench_modulation [blocks]
+//
+// every source is routed to every destination, the most the control points
+// and the ramps can cost. it fails above MODULATION_BUDGET delays.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "delay.h"
+#include "modulation.h"
+#include "pcg_basic.h"
+
+#define MODULATION_BUDGET 0.75
+#define BENCH_SAMPLES 441
+#define BENCH_RUNS 9
+
+static int32_t input[BENCH_SAMPLES * 2];
+static int32_t block[BENCH_SAMPLES * 2];
+
+static double now_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// ns per block over blocks
+static double bench(void (*process)(void *, int32_t *, uint16_t), void *fx,
+                    int blocks) {
+  double total = 0;
+  for (int i = 0; i < blocks; i++) {
+    memcpy(block, input, sizeof(block));
+    double t0 = now_ns();
+    process(fx, block, BENCH_SAMPLES);
+    total += now_ns() - t0;
+  }
+  return total / blocks;
+}
+
+static void delay_process(void *fx, int32_t *samples, uint16_t n) {
+  Delay_process((Delay *)fx, samples, n);
+}
+
+static void modulation_process(void *fx, int32_t *samples, uint16_t n) {
+  Modulation *mod = (Modulation *)fx;
+  Modulation_beginBlock(mod, n, 120);
+  Modulation_process(mod, samples, n);
+  // what the audio callback reads at the control points
+  volatile uint8_t fc = 0;
+  for (uint8_t k = 1; k < mod->points; k++) {
+    fc = Modulation_cutoff(mod, k, 40, 80);
+  }
+  volatile float pitch = Modulation_pitch(mod);
+  (void)fc;
+  (void)pitch;
+}
+
+int main(int argc, char **argv) {
+  int blocks = argc > 1 ? atoi(argv[1]) : 500;
+  pcg32_random_t rng;
+  pcg32_srandom_r(&rng, 42, 54);
+  for (int i = 0; i < BENCH_SAMPLES * 2; i++) {
+    input[i] = (int32_t)pcg32_random_r(&rng) >> 2;
+  }
+
+  FxPool *pool = FxPool_malloc(FXPOOL_SIZE);
+  Delay *delay = Delay_malloc(pool);
+  Delay_setDuration(delay, 8018);
+  Delay_setActive(delay, true);
+  Modulation *mod = Modulation_malloc(42);
+  Modulation_setLfo(mod, MOD_LFO1, 96, MOD_SINE);
+  Modulation_setLfo(mod, MOD_LFO2, 480, MOD_TRIANGLE);
+  Modulation_setLfo(mod, MOD_NOISE, 24, MOD_SINE);
+  for (uint8_t s = 0; s < MOD_SOURCES; s++) {
+    for (uint8_t d = 0; d < MOD_DESTINATIONS; d++) {
+      Modulation_route(mod, s, d, MOD_DEPTH_FULL / MOD_SOURCES);
+    }
+  }
+
+  // the fastest of interleaved runs, so a change in clock speed or load
+  // hits both alike
+  double delay_ns = 0;
+  double mod_ns = 0;
+  for (int run = 0; run < BENCH_RUNS; run++) {
+    double d = bench(delay_process, delay, blocks);
+    Modulation_setEnvelope(mod, run & 1 ? 32767 : -32767);
+    double m = bench(modulation_process, mod, blocks);
+    if (run == 0 || d < delay_ns) {
+      delay_ns = d;
+    }
+    if (run == 0 || m < mod_ns) {
+      mod_ns = m;
+    }
+  }
+
+  double ratio = mod_ns / delay_ns;
+  printf("delay       %8.0f ns per block\n", delay_ns);
+  printf("modulation  %8.0f ns per block, %.2f delays (budget %.2f)\n",
+         mod_ns, ratio, MODULATION_BUDGET);
+
+  Modulation_free(mod);
+  Delay_free(delay);
+  FxPool_free(pool);
+#ifdef __SANITIZE_ADDRESS__
+  // instrumented loads skew the ratio, only report
+  printf("sanitized build, budget not checked\n");
+  return 0;
+#endif
+  if (ratio > MODULATION_BUDGET) {
+    printf("over budget\n");
+    return 1;
+  }
+  printf("within budget\n");
+  return 0;
+}
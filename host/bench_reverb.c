@@ -0,0 +1,142 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// _core_bench_reverb holds the reverb to its cycle budget. host cycles do
+// not map to the rp2040's, so the budget is relative to the delay, which
+// does similar work per sample and is known to fit in the block:
+//
+//   _core_bench_reverb [blocks]
+//
+// it fails when the full rate reverb costs more than REVERB_BUDGET delays,
+// or the half rate one more than REVERB_BUDGET_HALF.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "delay.h"
+#include "pcg_basic.h"
+#include "reverb.h"
+
+#define REVERB_BUDGET 4.0
+#define REVERB_BUDGET_HALF 2.25
+#define BENCH_SAMPLES 441
+#define BENCH_RUNS 9
+
+static int32_t input[BENCH_SAMPLES * 2];
+static int32_t block[BENCH_SAMPLES * 2];
+
+static double now_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// ns per block over blocks
+static double bench(void (*process)(void *, int32_t *, uint16_t), void *fx,
+                    int blocks) {
+  double total = 0;
+  for (int i = 0; i < blocks; i++) {
+    memcpy(block, input, sizeof(block));
+    double t0 = now_ns();
+    process(fx, block, BENCH_SAMPLES);
+    total += now_ns() - t0;
+  }
+  return total / blocks;
+}
+
+static void delay_process(void *fx, int32_t *samples, uint16_t n) {
+  Delay_process((Delay *)fx, samples, n);
+}
+
+static void reverb_process(void *fx, int32_t *samples, uint16_t n) {
+  Reverb_process((Reverb *)fx, samples, n);
+}
+
+int main(int argc, char **argv) {
+  int blocks = argc > 1 ? atoi(argv[1]) : 500;
+  pcg32_random_t rng;
+  pcg32_srandom_r(&rng, 42, 54);
+  for (int i = 0; i < BENCH_SAMPLES * 2; i++) {
+    input[i] = (int32_t)pcg32_random_r(&rng) >> 2;
+  }
+
+  FxPool *pool = FxPool_malloc(FXPOOL_SIZE);
+  Delay *delay = Delay_malloc(pool);
+  Delay_setDuration(delay, 8018);
+  Delay_setActive(delay, true);
+  Reverb *reverb = Reverb_malloc(pool);
+  Reverb_set(reverb, 255, 255, 128);
+  Reverb_setActive(reverb, true);
+  Reverb *reverb_half = Reverb_malloc(pool);
+  Reverb_setHalfRate(reverb_half, true);
+  Reverb_set(reverb_half, 255, 255, 128);
+  Reverb_setActive(reverb_half, true);
+
+  // the fastest of interleaved runs, so a change in clock speed or load
+  // hits all three alike
+  double delay_ns = 0;
+  double full_ns = 0;
+  double half_ns = 0;
+  for (int run = 0; run < BENCH_RUNS; run++) {
+    double d = bench(delay_process, delay, blocks);
+    double f = bench(reverb_process, reverb, blocks);
+    double h = bench(reverb_process, reverb_half, blocks);
+    if (run == 0 || d < delay_ns) {
+      delay_ns = d;
+    }
+    if (run == 0 || f < full_ns) {
+      full_ns = f;
+    }
+    if (run == 0 || h < half_ns) {
+      half_ns = h;
+    }
+  }
+
+  double full = full_ns / delay_ns;
+  double half = half_ns / delay_ns;
+  printf("delay       %8.0f ns per block\n", delay_ns);
+  printf("reverb      %8.0f ns per block, %.2f delays (budget %.2f)\n",
+         full_ns, full, REVERB_BUDGET);
+  printf("reverb half %8.0f ns per block, %.2f delays (budget %.2f)\n",
+         half_ns, half, REVERB_BUDGET_HALF);
+
+  Reverb_free(reverb_half);
+  Reverb_free(reverb);
+  Delay_free(delay);
+  FxPool_free(pool);
+#ifdef __SANITIZE_ADDRESS__
+  // instrumented loads skew the ratio, only report
+  printf("sanitized build, budget not checked\n");
+  return 0;
+#endif
+  if (full > REVERB_BUDGET || half > REVERB_BUDGET_HALF) {
+    printf("over budget\n");
+    return 1;
+  }
+  printf("within budget\n");
+  return 0;
+}
@@ -0,0 +1,171 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// _core_bench_timestretch holds the time stretch to its cycle budget,
+// relative to the delay like _core_bench_reverb:
+//
+//   _core_bench_timestretch [blocks]
+//
+// the search stops early on a poor match, so the cost depends on the
+// input. it walks a stereo file of noise and one of tones at the slowest
+// ratio and at the original tempo, and fails when the dearest costs more
+// than TIMESTRETCH_BUDGET delays.
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "delay.h"
+#include "pcg_basic.h"
+#include "timestretch.h"
+
+#define TIMESTRETCH_BUDGET 2.0
+#define BENCH_SAMPLES 441
+#define BENCH_RUNS 9
+#define FILE_FRAMES (44100 * 4)
+
+static int16_t noise[FILE_FRAMES * 2];
+static int16_t tones[FILE_FRAMES * 2];
+static int16_t values[(BENCH_SAMPLES + TIMESTRETCH_EXTRA) * 2];
+static int16_t grain[BENCH_SAMPLES * 2];
+static int32_t input[BENCH_SAMPLES * 2];
+static int32_t block[BENCH_SAMPLES * 2];
+
+static double now_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// ns per block of the delay
+static double bench_delay(Delay *delay, int blocks) {
+  double total = 0;
+  for (int i = 0; i < blocks; i++) {
+    memcpy(block, input, sizeof(block));
+    double t0 = now_ns();
+    Delay_process(delay, block, BENCH_SAMPLES);
+    total += now_ns() - t0;
+  }
+  return total / blocks;
+}
+
+// ns per block of the stretch walking through file, copying the grain out
+// as it does from the window. the reads are not counted
+static double bench_stretch(TimeStretch *ts, const int16_t *file,
+                            uint8_t ratio, int blocks) {
+  TimeStretch_reset(ts);
+  TimeStretch_setRatio(ts, ratio);
+  int32_t pos = TIMESTRETCH_BEFORE(false);
+  double total = 0;
+  for (int i = 0; i < blocks; i++) {
+    if (pos + BENCH_SAMPLES + TIMESTRETCH_EXTRA > FILE_FRAMES) {
+      pos = TIMESTRETCH_BEFORE(false);
+    }
+    memcpy(values, file + (pos - TIMESTRETCH_BEFORE(false)) * 2,
+           sizeof(values));
+    double t0 = now_ns();
+    TimeStretch_process(ts, values, grain, BENCH_SAMPLES, true, false,
+                        TIMESTRETCH_SEARCH);
+    pos += TimeStretch_advance(ts, BENCH_SAMPLES);
+    total += now_ns() - t0;
+  }
+  return total / blocks;
+}
+
+int main(int argc, char **argv) {
+  int blocks = argc > 1 ? atoi(argv[1]) : 500;
+  pcg32_random_t rng;
+  pcg32_srandom_r(&rng, 42, 54);
+  for (int i = 0; i < BENCH_SAMPLES * 2; i++) {
+    input[i] = (int32_t)pcg32_random_r(&rng) >> 2;
+  }
+  for (int i = 0; i < FILE_FRAMES; i++) {
+    int16_t v = (int16_t)(pcg32_random_r(&rng) >> 17);
+    noise[i * 2] = v;
+    noise[i * 2 + 1] = v;
+    // a chord that changes every quarter second
+    double f = 110 * (1 + (i / 11025) % 4);
+    v = (int16_t)(8000 * sin(2 * M_PI * f * i / 44100) +
+                  4000 * sin(2 * M_PI * f * 1.5 * i / 44100));
+    tones[i * 2] = v;
+    tones[i * 2 + 1] = v;
+  }
+
+  FxPool *pool = FxPool_malloc(FXPOOL_SIZE);
+  Delay *delay = Delay_malloc(pool);
+  Delay_setDuration(delay, 8018);
+  Delay_setActive(delay, true);
+  TimeStretch *ts = TimeStretch_malloc(pool);
+
+  const char *names[4] = {"noise 1/8", "noise 1/1", "tones 1/8",
+                          "tones 1/1"};
+  const int16_t *files[4] = {noise, noise, tones, tones};
+  const uint8_t ratios[4] = {0, 255, 0, 255};
+
+  // the fastest of interleaved runs, so a change in clock speed or load
+  // hits all alike
+  double delay_ns = 0;
+  double stretch_ns[4] = {0};
+  for (int run = 0; run < BENCH_RUNS; run++) {
+    double d = bench_delay(delay, blocks);
+    if (run == 0 || d < delay_ns) {
+      delay_ns = d;
+    }
+    for (int c = 0; c < 4; c++) {
+      double s = bench_stretch(ts, files[c], ratios[c], blocks);
+      if (run == 0 || s < stretch_ns[c]) {
+        stretch_ns[c] = s;
+      }
+    }
+  }
+
+  printf("delay       %8.0f ns per block\n", delay_ns);
+  double worst = 0;
+  for (int c = 0; c < 4; c++) {
+    double ratio = stretch_ns[c] / delay_ns;
+    printf("%-11s %8.0f ns per block, %.2f delays (budget %.2f)\n", names[c],
+           stretch_ns[c], ratio, TIMESTRETCH_BUDGET);
+    if (ratio > worst) {
+      worst = ratio;
+    }
+  }
+
+  TimeStretch_free(ts);
+  Delay_free(delay);
+  FxPool_free(pool);
+#ifdef __SANITIZE_ADDRESS__
+  // instrumented loads skew the ratio, only report
+  printf("sanitized build, budget not checked\n");
+  return 0;
+#endif
+  if (worst > TIMESTRETCH_BUDGET) {
+    printf("over budget\n");
+    return 1;
+  }
+  printf("within budget\n");
+  return 0;
+}
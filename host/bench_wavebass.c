@@ -0,0 +1,151 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// _core_bench_wavebass holds the block bass against the per-sample one it
+// replaced, both playing a held note with all three partials in:
+//
+//   _core_bench_wavebass [blocks]
+//
+// it fails when the block bass costs more than WAVEBASS_BUDGET of the
+// per-sample one.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "wavetablebass.h"
+#include "wavetablesyn.h"
+
+#define WAVEBASS_BUDGET 0.5
+#define BENCH_SAMPLES 441
+#define BENCH_RUNS 9
+
+static int32_t block[BENCH_SAMPLES * 2];
+
+// the per-sample bass, a WaveSyn for each partial started on its sample
+typedef struct OldBass {
+  WaveSyn *osc[WAVEBASS_PARTIALS];
+  uint8_t note;
+  uint16_t change_count;
+} OldBass;
+
+static int32_t OldBass_next(OldBass *self) {
+  int64_t val = 0;
+  for (uint8_t i = 0; i < WAVEBASS_PARTIALS; i++) {
+    val += WaveSyn_next(self->osc[i]);
+  }
+  if (self->change_count < 2000) {
+    for (uint8_t p = 0; p < WAVEBASS_PARTIALS; p++) {
+      if (self->change_count == wavebass_partial_offset[p]) {
+        WaveSyn_new(self->osc[p], self->note + wavetablebass_harmonics[p],
+                    wavebass_partial_quiet[p], wavebass_partial_attack[p],
+                    wavebass_partial_decay[p]);
+      }
+    }
+    self->change_count++;
+  }
+  return val / WAVEBASS_PARTIALS;
+}
+
+static double now_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// ns per block over blocks
+static double bench(void (*process)(void *, int32_t *, uint16_t), void *bass,
+                    int blocks) {
+  double total = 0;
+  for (int i = 0; i < blocks; i++) {
+    memset(block, 0, sizeof(block));
+    double t0 = now_ns();
+    process(bass, block, BENCH_SAMPLES);
+    total += now_ns() - t0;
+  }
+  return total / blocks;
+}
+
+static void old_process(void *bass, int32_t *samples, uint16_t n) {
+  for (uint16_t i = 0; i < n; i++) {
+    int32_t v = OldBass_next((OldBass *)bass);
+    samples[i * 2 + 0] += v;
+    samples[i * 2 + 1] += v;
+  }
+}
+
+static void block_process(void *bass, int32_t *samples, uint16_t n) {
+  WaveBass_render((WaveBass *)bass, samples, n);
+}
+
+int main(int argc, char **argv) {
+  int blocks = argc > 1 ? atoi(argv[1]) : 500;
+
+  OldBass old;
+  for (uint8_t p = 0; p < WAVEBASS_PARTIALS; p++) {
+    old.osc[p] = WaveSyn_malloc();
+  }
+  old.note = 5;
+  old.change_count = 0;
+  WaveBass *bass = WaveBass_malloc();
+  WaveBass_note_on(bass, 5);
+
+  // the fastest of interleaved runs, the first one also brings both past
+  // their attacks
+  double old_ns = 0;
+  double block_ns = 0;
+  for (int run = 0; run < BENCH_RUNS; run++) {
+    double o = bench(old_process, &old, blocks);
+    double b = bench(block_process, bass, blocks);
+    if (run == 0 || o < old_ns) {
+      old_ns = o;
+    }
+    if (run == 0 || b < block_ns) {
+      block_ns = b;
+    }
+  }
+
+  double ratio = block_ns / old_ns;
+  printf("per sample %8.0f ns per block\n", old_ns);
+  printf("block      %8.0f ns per block, %.2f of per sample (budget %.2f)\n",
+         block_ns, ratio, WAVEBASS_BUDGET);
+
+  WaveBass_free(bass);
+  for (uint8_t p = 0; p < WAVEBASS_PARTIALS; p++) {
+    WaveSyn_free(old.osc[p]);
+  }
+#ifdef __SANITIZE_ADDRESS__
+  // instrumented loads skew the ratio, only report
+  printf("sanitized build, budget not checked\n");
+  return 0;
+#endif
+  if (ratio > WAVEBASS_BUDGET) {
+    printf("over budget\n");
+    return 1;
+  }
+  printf("within budget\n");
+  return 0;
+}
@@ -0,0 +1,355 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// FatFs on top of a local directory laid out like the sd card, so the
+// firmware's file code runs unchanged on the host:
+//
+//   card/bank0/0.0.wav
+//   card/bank0/0.0.wav.info
+//   card/bank0/0.1.wav
+//   ...
+//
+// open files keep their descriptor in obj.sclust, the firmware only ever
+// looks at fptr and objsize through f_tell and f_size.
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <fnmatch.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// FatFs and posix both call their directory DIR
+#define DIR FF_DIR
+#include "ff.h"
+#include "hw_config.h"
+#include "sd_card.h"
+#undef DIR
+#include "sdmodel.h"
+
+#define HOST_DIRS_MAX 8
+
+static const char *host_card_root = ".";
+static sd_card_t host_sd_card = {.pcName = "0:"};
+static DIR *host_dirs[HOST_DIRS_MAX];
+// when set, reads take the time the card profile says, see sdmodel.h
+static SdModel *host_sd_model = NULL;
+
+void host_card_set(const char *root) { host_card_root = root; }
+
+bool host_card_profile(const char *fname) {
+  host_sd_model = SdModel_load(fname);
+  return host_sd_model != NULL;
+}
+
+size_t sd_get_num() { return 1; }
+
+sd_card_t *sd_get_by_num(size_t num) {
+  return num == 0 ? &host_sd_card : NULL;
+}
+
+bool sd_init_driver() { return true; }
+
+static void host_path(char *out, size_t len, const TCHAR *path) {
+  // drop the drive prefix, "0:" or "0:/"
+  const char *colon = strchr(path, ':');
+  if (colon != NULL) {
+    path = colon + 1;
+  }
+  while (*path == '/') {
+    path++;
+  }
+  snprintf(out, len, "%s/%s", host_card_root, path);
+}
+
+static FRESULT host_result(int err) {
+  switch (err) {
+    case 0:
+      return FR_OK;
+    case ENOENT:
+      return FR_NO_FILE;
+    case ENOTDIR:
+      return FR_NO_PATH;
+    case EEXIST:
+      return FR_EXIST;
+    case EACCES:
+    case EPERM:
+    case EISDIR:
+      return FR_DENIED;
+    case EMFILE:
+    case ENFILE:
+      return FR_TOO_MANY_OPEN_FILES;
+    default:
+      return FR_DISK_ERR;
+  }
+}
+
+static void host_fileinfo(FILINFO *fno, const char *name,
+                          const struct stat *st) {
+  memset(fno, 0, sizeof(FILINFO));
+  fno->fsize = st->st_size;
+  fno->fattrib = S_ISDIR(st->st_mode) ? AM_DIR : 0;
+  snprintf(fno->fname, sizeof(fno->fname), "%s", name);
+}
+
+FRESULT f_mount(FATFS *fs, const TCHAR *path, BYTE opt) {
+  (void)path;
+  (void)opt;
+  if (fs == NULL) {
+    return FR_OK;
+  }
+  struct stat st;
+  if (stat(host_card_root, &st) != 0 || !S_ISDIR(st.st_mode)) {
+    return FR_NOT_READY;
+  }
+  fs->fs_type = FS_EXFAT;
+  return FR_OK;
+}
+
+FRESULT f_open(FIL *fp, const TCHAR *path, BYTE mode) {
+  char fname[512];
+  host_path(fname, sizeof(fname), path);
+  memset(fp, 0, sizeof(FIL));
+
+  int flags = (mode & FA_WRITE) ? ((mode & FA_READ) ? O_RDWR : O_WRONLY)
+                                : O_RDONLY;
+  if (mode & FA_CREATE_NEW) {
+    flags |= O_CREAT | O_EXCL;
+  } else if (mode & FA_CREATE_ALWAYS) {
+    flags |= O_CREAT | O_TRUNC;
+  } else if (mode & FA_OPEN_ALWAYS) {
+    flags |= O_CREAT;
+  }
+  int fd = open(fname, flags, 0644);
+  if (fd < 0) {
+    return host_result(errno);
+  }
+  struct stat st;
+  fstat(fd, &st);
+  if (S_ISDIR(st.st_mode)) {
+    close(fd);
+    return FR_NO_FILE;
+  }
+  fp->obj.fs = &host_sd_card.fatfs;
+  fp->obj.sclust = fd;
+  fp->obj.objsize = st.st_size;
+  fp->flag = mode;
+  if ((mode & FA_OPEN_APPEND) == FA_OPEN_APPEND) {
+    fp->fptr = lseek(fd, 0, SEEK_END);
+  }
+  return FR_OK;
+}
+
+FRESULT f_close(FIL *fp) {
+  if (fp->obj.fs == NULL) {
+    return FR_INVALID_OBJECT;
+  }
+  close(fp->obj.sclust);
+  fp->obj.fs = NULL;
+  return FR_OK;
+}
+
+FRESULT f_read(FIL *fp, void *buff, UINT btr, UINT *br) {
+  *br = 0;
+  if (fp->obj.fs == NULL) {
+    return FR_INVALID_OBJECT;
+  }
+  ssize_t n = pread(fp->obj.sclust, buff, btr, fp->fptr);
+  if (n < 0) {
+    return FR_DISK_ERR;
+  }
+  if (host_sd_model != NULL) {
+    host_advance_us(SdModel_readUs(host_sd_model, btr));
+  }
+  fp->fptr += n;
+  *br = n;
+  return FR_OK;
+}
+
+FRESULT f_write(FIL *fp, const void *buff, UINT btw, UINT *bw) {
+  *bw = 0;
+  if (fp->obj.fs == NULL) {
+    return FR_INVALID_OBJECT;
+  }
+  ssize_t n = pwrite(fp->obj.sclust, buff, btw, fp->fptr);
+  if (n < 0) {
+    return FR_DISK_ERR;
+  }
+  fp->fptr += n;
+  if (fp->fptr > fp->obj.objsize) {
+    fp->obj.objsize = fp->fptr;
+  }
+  *bw = n;
+  return FR_OK;
+}
+
+FRESULT f_lseek(FIL *fp, FSIZE_t ofs) {
+  if (fp->obj.fs == NULL) {
+    return FR_INVALID_OBJECT;
+  }
+  // like FatFs, seeking past the end of a read-only file stops at the end
+  if (ofs > fp->obj.objsize && !(fp->flag & FA_WRITE)) {
+    ofs = fp->obj.objsize;
+  }
+  fp->fptr = ofs;
+  return FR_OK;
+}
+
+FRESULT f_truncate(FIL *fp) {
+  if (fp->obj.fs == NULL) {
+    return FR_INVALID_OBJECT;
+  }
+  if (ftruncate(fp->obj.sclust, fp->fptr) != 0) {
+    return FR_DISK_ERR;
+  }
+  fp->obj.objsize = fp->fptr;
+  return FR_OK;
+}
+
+FRESULT f_sync(FIL *fp) {
+  if (fp->obj.fs == NULL) {
+    return FR_INVALID_OBJECT;
+  }
+  return fsync(fp->obj.sclust) == 0 ? FR_OK : FR_DISK_ERR;
+}
+
+FRESULT f_stat(const TCHAR *path, FILINFO *fno) {
+  char fname[512];
+  host_path(fname, sizeof(fname), path);
+  struct stat st;
+  if (stat(fname, &st) != 0) {
+    return host_result(errno);
+  }
+  if (fno != NULL) {
+    const char *base = strrchr(fname, '/');
+    host_fileinfo(fno, base != NULL ? base + 1 : fname, &st);
+  }
+  return FR_OK;
+}
+
+FRESULT f_unlink(const TCHAR *path) {
+  char fname[512];
+  host_path(fname, sizeof(fname), path);
+  if (unlink(fname) == 0 || (errno == EISDIR && rmdir(fname) == 0)) {
+    return FR_OK;
+  }
+  return host_result(errno);
+}
+
+FRESULT f_rename(const TCHAR *path_old, const TCHAR *path_new) {
+  char fname_old[512];
+  char fname_new[512];
+  host_path(fname_old, sizeof(fname_old), path_old);
+  host_path(fname_new, sizeof(fname_new), path_new);
+  return rename(fname_old, fname_new) == 0 ? FR_OK : host_result(errno);
+}
+
+FRESULT f_mkdir(const TCHAR *path) {
+  char fname[512];
+  host_path(fname, sizeof(fname), path);
+  return mkdir(fname, 0755) == 0 ? FR_OK : host_result(errno);
+}
+
+// directories keep their slot in host_dirs in obj.sclust and the path in
+// dir, so readdir can stat the entries
+FRESULT f_opendir(FF_DIR *dp, const TCHAR *path) {
+  memset(dp, 0, sizeof(FF_DIR));
+  uint8_t slot = 0;
+  while (slot < HOST_DIRS_MAX && host_dirs[slot] != NULL) {
+    slot++;
+  }
+  if (slot == HOST_DIRS_MAX) {
+    return FR_TOO_MANY_OPEN_FILES;
+  }
+  char *dname = malloc(512);
+  host_path(dname, 512, path);
+  host_dirs[slot] = opendir(dname);
+  if (host_dirs[slot] == NULL) {
+    free(dname);
+    return host_result(errno);
+  }
+  dp->obj.fs = &host_sd_card.fatfs;
+  dp->obj.sclust = slot;
+  dp->dir = (BYTE *)dname;
+  return FR_OK;
+}
+
+FRESULT f_closedir(FF_DIR *dp) {
+  if (dp->obj.fs == NULL) {
+    return FR_INVALID_OBJECT;
+  }
+  closedir(host_dirs[dp->obj.sclust]);
+  host_dirs[dp->obj.sclust] = NULL;
+  free(dp->dir);
+  dp->obj.fs = NULL;
+  return FR_OK;
+}
+
+FRESULT f_readdir(FF_DIR *dp, FILINFO *fno) {
+  if (dp->obj.fs == NULL) {
+    return FR_INVALID_OBJECT;
+  }
+  if (fno == NULL) {
+    rewinddir(host_dirs[dp->obj.sclust]);
+    return FR_OK;
+  }
+  struct dirent *entry;
+  while ((entry = readdir(host_dirs[dp->obj.sclust])) != NULL) {
+    if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+      continue;
+    }
+    char fname[1024];
+    snprintf(fname, sizeof(fname), "%s/%s", (char *)dp->dir, entry->d_name);
+    struct stat st;
+    if (stat(fname, &st) != 0) {
+      continue;
+    }
+    host_fileinfo(fno, entry->d_name, &st);
+    return FR_OK;
+  }
+  // end of the directory is an empty name
+  memset(fno, 0, sizeof(FILINFO));
+  return FR_OK;
+}
+
+FRESULT f_findnext(FF_DIR *dp, FILINFO *fno) {
+  FRESULT fr;
+  for (;;) {
+    fr = f_readdir(dp, fno);
+    if (fr != FR_OK || fno->fname[0] == 0 ||
+        fnmatch(dp->pat, fno->fname, 0) == 0) {
+      return fr;
+    }
+  }
+}
+
+FRESULT f_findfirst(FF_DIR *dp, FILINFO *fno, const TCHAR *path,
+                    const TCHAR *pattern) {
+  FRESULT fr = f_opendir(dp, path);
+  if (fr != FR_OK) {
+    return fr;
+  }
+  dp->pat = pattern;
+  return f_findnext(dp, fno);
+}
@@ -0,0 +1,415 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// the pico sdk calls the firmware makes, implemented for the host simulator.
+// time is virtual: it only moves when the firmware sleeps or the simulator
+// renders a block, so a run is the same every time and as fast as the host
+// can go. audio handed to the i2s pool is written to a wav file instead.
+
+#include <time.h>
+
+#include "pico.h"
+#include "pico/audio_i2s.h"
+
+static uint64_t host_now_us = 0;
+static uint32_t host_sys_khz = 125000;
+// 0 while clk_peri follows clk_sys
+static uint32_t host_peri_hz = 0;
+
+i2c_inst_t host_i2c[2] = {{0}, {1}};
+spi_inst_t host_spi[2] = {{0}, {1}};
+uart_inst_t host_uart[2] = {{0}, {1}};
+pio_hw_t host_pio[2] = {{0}, {1}};
+xip_ctrl_hw_t host_xip_ctrl;
+
+// time
+
+void host_advance_us(uint64_t us) { host_now_us += us; }
+
+uint64_t time_us_64(void) { return host_now_us; }
+
+uint32_t time_us_32(void) { return (uint32_t)host_now_us; }
+
+absolute_time_t get_absolute_time(void) { return host_now_us; }
+
+void sleep_ms(uint32_t ms) { host_now_us += (uint64_t)ms * 1000; }
+
+void sleep_us(uint64_t us) { host_now_us += us; }
+
+// clocks
+
+uint32_t clock_get_hz(enum clock_index clk_index) {
+  if (clk_index == clk_peri && host_peri_hz > 0) {
+    return host_peri_hz;
+  }
+  if (clk_index == clk_sys || clk_index == clk_peri) {
+    return host_sys_khz * 1000;
+  }
+  return 48 * MHZ;
+}
+
+bool clock_configure(enum clock_index clk_index, uint32_t src,
+                     uint32_t auxsrc, uint32_t src_freq, uint32_t freq) {
+  (void)src;
+  (void)auxsrc;
+  (void)src_freq;
+  if (clk_index == clk_sys) {
+    host_sys_khz = freq / 1000;
+  } else if (clk_index == clk_peri) {
+    host_peri_hz =
+        auxsrc == CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLK_SYS ? 0 : freq;
+  }
+  return true;
+}
+
+void pll_init(void *pll, uint ref_div, uint vco_freq, uint post_div1,
+              uint post_div2) {
+  (void)pll;
+  (void)ref_div;
+  (void)vco_freq;
+  (void)post_div1;
+  (void)post_div2;
+}
+
+bool set_sys_clock_khz(uint32_t freq_khz, bool required) {
+  (void)required;
+  host_sys_khz = freq_khz;
+  // like the sdk, clk_peri goes back to following clk_sys
+  host_peri_hz = 0;
+  return true;
+}
+
+bool stdio_init_all(void) { return true; }
+
+int getchar_timeout_us(uint32_t timeout_us) {
+  host_now_us += timeout_us;
+  return PICO_ERROR_TIMEOUT;
+}
+
+// the sd driver's assert, see lib/sdio/source/my_debug.c
+void my_assert_func(const char *file, int line, const char *func,
+                    const char *pred) {
+  fprintf(stderr, "assertion \"%s\" failed: file \"%s\", line %d, function: %s\n",
+          pred, file, line, func);
+  abort();
+}
+
+// the systick counts down at clk_sys, here it is driven by the host's own
+// clock so the profiler measures what the host spends in each stage
+static systick_hw_t host_systick_hw;
+
+systick_hw_t *host_systick(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  uint64_t ns = (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+  uint64_t cycles = ns * host_sys_khz / 1000000ull;
+  host_systick_hw.cvr = (uint32_t)(~cycles) & 0xFFFFFF;
+  return &host_systick_hw;
+}
+
+// gpio, inputs read back their pull
+
+static bool host_gpio_state[32];
+
+void gpio_init(uint gpio) { host_gpio_state[gpio & 31] = false; }
+
+void gpio_set_dir(uint gpio, bool out) {
+  (void)gpio;
+  (void)out;
+}
+
+void gpio_put(uint gpio, bool value) { host_gpio_state[gpio & 31] = value; }
+
+bool gpio_get(uint gpio) { return host_gpio_state[gpio & 31]; }
+
+void gpio_pull_up(uint gpio) { host_gpio_state[gpio & 31] = true; }
+
+void gpio_pull_down(uint gpio) { host_gpio_state[gpio & 31] = false; }
+
+void gpio_set_function(uint gpio, enum gpio_function fn) {
+  (void)gpio;
+  (void)fn;
+}
+
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t events,
+                                        bool enabled,
+                                        gpio_irq_callback_t callback) {
+  (void)gpio;
+  (void)events;
+  (void)enabled;
+  (void)callback;
+}
+
+// adc, the knobs rest at zero
+
+void adc_init(void) {}
+
+void adc_gpio_init(uint gpio) { (void)gpio; }
+
+void adc_select_input(uint input) { (void)input; }
+
+uint16_t adc_read(void) { return 0; }
+
+// i2c, spi and uart
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate) {
+  (void)i2c;
+  return baudrate;
+}
+
+uint i2c_set_baudrate(i2c_inst_t *i2c, uint baudrate) {
+  (void)i2c;
+  return baudrate;
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src,
+                       size_t len, bool nostop) {
+  (void)i2c;
+  (void)addr;
+  (void)src;
+  (void)nostop;
+  return (int)len;
+}
+
+int i2c_read_blocking(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len,
+                      bool nostop) {
+  (void)i2c;
+  (void)addr;
+  (void)nostop;
+  memset(dst, 0, len);
+  return (int)len;
+}
+
+uint spi_init(spi_inst_t *spi, uint baudrate) {
+  (void)spi;
+  return baudrate;
+}
+
+int spi_write_read_blocking(spi_inst_t *spi, const uint8_t *src, uint8_t *dst,
+                            size_t len) {
+  (void)spi;
+  (void)src;
+  memset(dst, 0, len);
+  return (int)len;
+}
+
+uint uart_set_baudrate(uart_inst_t *uart, uint baudrate) {
+  (void)uart;
+  return baudrate;
+}
+
+// pio
+
+uint pio_add_program(PIO pio, const pio_program_t *program) {
+  (void)pio;
+  (void)program;
+  return 0;
+}
+
+void pio_gpio_init(PIO pio, uint pin) {
+  (void)pio;
+  (void)pin;
+}
+
+int pio_sm_init(PIO pio, uint sm, uint initial_pc,
+                const pio_sm_config *config) {
+  (void)pio;
+  (void)sm;
+  (void)initial_pc;
+  (void)config;
+  return 0;
+}
+
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled) {
+  (void)pio;
+  (void)sm;
+  (void)enabled;
+}
+
+void pio_sm_set_consecutive_pindirs(PIO pio, uint sm, uint pin_base,
+                                    uint pin_count, bool is_out) {
+  (void)pio;
+  (void)sm;
+  (void)pin_base;
+  (void)pin_count;
+  (void)is_out;
+}
+
+void pio_sm_set_clkdiv(PIO pio, uint sm, float div) {
+  (void)pio;
+  (void)sm;
+  (void)div;
+}
+
+void pio_sm_clear_fifos(PIO pio, uint sm) {
+  (void)pio;
+  (void)sm;
+}
+
+bool pio_sm_is_rx_fifo_empty(PIO pio, uint sm) {
+  (void)pio;
+  (void)sm;
+  return true;
+}
+
+uint32_t pio_sm_get(PIO pio, uint sm) {
+  (void)pio;
+  (void)sm;
+  return 0;
+}
+
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data) {
+  (void)pio;
+  (void)sm;
+  (void)data;
+}
+
+// multicore
+
+void multicore_launch_core1(void (*entry)(void)) { (void)entry; }
+
+void multicore_reset_core1(void) {}
+
+// sd card
+
+void rp2040_sdio_set_clock_divider(int clock_divider) { (void)clock_divider; }
+
+// audio, every buffer given to the pool is played straight into the wav file
+
+static FILE *host_wav = NULL;
+static uint32_t host_wav_bytes = 0;
+static const audio_format_t *host_wav_format = NULL;
+static int32_t host_wav_peak = 0;
+
+static void host_wav_header(FILE *f, const audio_format_t *format,
+                            uint32_t data_bytes) {
+  uint16_t bits = format->pcm_format == AUDIO_PCM_FORMAT_S32 ? 32 : 16;
+  uint16_t channels = format->channel_count;
+  uint16_t block_align = channels * bits / 8;
+  uint32_t byte_rate = format->sample_freq * block_align;
+  uint32_t riff_bytes = 36 + data_bytes;
+  uint32_t fmt_bytes = 16;
+  uint16_t pcm = 1;
+  fwrite("RIFF", 1, 4, f);
+  fwrite(&riff_bytes, 4, 1, f);
+  fwrite("WAVEfmt ", 1, 8, f);
+  fwrite(&fmt_bytes, 4, 1, f);
+  fwrite(&pcm, 2, 1, f);
+  fwrite(&channels, 2, 1, f);
+  fwrite(&format->sample_freq, 4, 1, f);
+  fwrite(&byte_rate, 4, 1, f);
+  fwrite(&block_align, 2, 1, f);
+  fwrite(&bits, 2, 1, f);
+  fwrite("data", 1, 4, f);
+  fwrite(&data_bytes, 4, 1, f);
+}
+
+bool host_audio_record(const char *fname) {
+  host_wav = fopen(fname, "wb");
+  host_wav_bytes = 0;
+  return host_wav != NULL;
+}
+
+int32_t host_audio_peak(void) { return host_wav_peak; }
+
+void host_audio_close(void) {
+  if (host_wav == NULL) {
+    return;
+  }
+  if (host_wav_format != NULL) {
+    fseek(host_wav, 0, SEEK_SET);
+    host_wav_header(host_wav, host_wav_format, host_wav_bytes);
+  }
+  fclose(host_wav);
+  host_wav = NULL;
+}
+
+audio_buffer_pool_t *audio_new_producer_pool(audio_buffer_format_t *format,
+                                             int buffer_count,
+                                             int buffer_sample_count) {
+  audio_buffer_pool_t *pool = calloc(1, sizeof(audio_buffer_pool_t));
+  pool->type = ac_producer;
+  pool->format = format->format;
+  for (int i = 0; i < buffer_count; i++) {
+    audio_buffer_t *buffer = calloc(1, sizeof(audio_buffer_t));
+    buffer->buffer = calloc(1, sizeof(mem_buffer_t));
+    buffer->buffer->size = buffer_sample_count * format->sample_stride;
+    buffer->buffer->bytes = calloc(1, buffer->buffer->size);
+    buffer->format = format;
+    buffer->max_sample_count = buffer_sample_count;
+    buffer->next = pool->free_list;
+    pool->free_list = buffer;
+  }
+  return pool;
+}
+
+audio_buffer_t *take_audio_buffer(audio_buffer_pool_t *ac, bool block) {
+  (void)block;
+  audio_buffer_t *buffer = ac->free_list;
+  if (buffer != NULL) {
+    ac->free_list = buffer->next;
+    buffer->next = NULL;
+  }
+  return buffer;
+}
+
+void give_audio_buffer(audio_buffer_pool_t *ac, audio_buffer_t *buffer) {
+  if (host_wav != NULL) {
+    if (host_wav_format == NULL) {
+      host_wav_format = buffer->format->format;
+      host_wav_header(host_wav, host_wav_format, 0);
+    }
+    size_t bytes = buffer->sample_count * buffer->format->sample_stride;
+    fwrite(buffer->buffer->bytes, 1, bytes, host_wav);
+    host_wav_bytes += bytes;
+    bool s32 = host_wav_format->pcm_format == AUDIO_PCM_FORMAT_S32;
+    for (size_t i = 0; i < bytes / (s32 ? 4 : 2); i++) {
+      int32_t v = s32 ? ((int32_t *)buffer->buffer->bytes)[i]
+                      : ((int16_t *)buffer->buffer->bytes)[i];
+      if (abs(v) > host_wav_peak) {
+        host_wav_peak = abs(v);
+      }
+    }
+  }
+  buffer->next = ac->free_list;
+  ac->free_list = buffer;
+}
+
+const audio_format_t *audio_i2s_setup(
+    const audio_format_t *i2s_input_audio_format,
+    const audio_format_t *i2s_output_audio_format,
+    const audio_i2s_config_t *config) {
+  (void)i2s_input_audio_format;
+  (void)config;
+  return i2s_output_audio_format;
+}
+
+bool audio_i2s_connect(audio_buffer_pool_t *producer) {
+  (void)producer;
+  return true;
+}
+
+void audio_i2s_set_enabled(bool enabled) { (void)enabled; }
+
+void audio_i2s_update_clock() {}
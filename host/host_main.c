@@ -0,0 +1,200 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// _core_host runs the firmware against a directory laid out like the sd card
+// and renders its audio to a wav file, as fast as the host allows:
+//
+//   _core_host [-d seconds] [-b bank] [-n sample] [-t bpm] [-x fx]...
+//              [-m source,destination,depth]... [-c profile] card out.wav
+//
+// -m routes a modulation source to a destination at a depth (q15), see
+// lib/modulation.h.
+//
+// -c takes a card profile from dev/sdcards and makes every read take as long
+// as that card would, see host/sdmodel.h. blocks that then run over are
+// counted as deadline misses, and as underruns once the queued buffers are
+// used up too.
+//
+// main.c is built unchanged apart from returning before the blocking input
+// loop. the simulator then does what the two cores would: core0's
+// housekeeping between blocks, and one i2s_callback_func per block.
+
+#include <getopt.h>
+#include <time.h>
+
+#define main core_main
+#include "../main.c"
+#undef main
+
+void host_card_set(const char *root);
+bool host_card_profile(const char *fname);
+bool host_audio_record(const char *fname);
+void host_audio_close(void);
+int32_t host_audio_peak(void);
+
+// the parts of core0's input loop that do not need hardware
+static void host_core0_tick() {
+  LogRing_print(logring);
+#ifdef INCLUDE_CLOCK_GOVERNOR
+  // the audio core runs between these calls, so core0 is parked whenever a
+  // change is pending
+  clockgovernor->parked = clockgovernor->pending;
+#endif
+  audio_fx_sync();
+  ShaperChain_update(shaperchain, sf->fx_active, sf->fx_param);
+#ifdef INCLUDE_PROFILER
+  Profiler_poll(profiler);
+#endif
+#ifdef INCLUDE_FLIGHTRECORDER
+  if (flightrecorder->frozen && playback_stopped) {
+    FlightRecorder_write(flightrecorder, &sync_using_sdcard);
+  }
+#endif
+}
+
+static void host_usage() {
+  fprintf(stderr,
+          "usage: _core_host [-d seconds] [-b bank] [-n sample] [-t bpm] "
+          "[-x fx]... [-m source,destination,depth]... [-c profile] card "
+          "out.wav\n");
+}
+
+int main(int argc, char **argv) {
+  float seconds = 10;
+  int bank = -1;
+  int sample = 0;
+  int bpm = -1;
+  uint8_t fx[16];
+  uint8_t fx_num = 0;
+  int routes[8][3];
+  uint8_t routes_num = 0;
+  const char *profile = NULL;
+  int opt;
+  while ((opt = getopt(argc, argv, "d:b:n:t:x:m:c:")) != -1) {
+    switch (opt) {
+      case 'd':
+        seconds = atof(optarg);
+        break;
+      case 'b':
+        bank = atoi(optarg);
+        break;
+      case 'n':
+        sample = atoi(optarg);
+        break;
+      case 't':
+        bpm = atoi(optarg);
+        break;
+      case 'x':
+        if (fx_num < sizeof(fx)) {
+          fx[fx_num++] = atoi(optarg);
+        }
+        break;
+      case 'm':
+        if (routes_num < 8 &&
+            sscanf(optarg, "%d,%d,%d", &routes[routes_num][0],
+                   &routes[routes_num][1], &routes[routes_num][2]) == 3) {
+          routes_num++;
+        }
+        break;
+      case 'c':
+        profile = optarg;
+        break;
+      default:
+        host_usage();
+        return 1;
+    }
+  }
+  if (argc - optind != 2) {
+    host_usage();
+    return 1;
+  }
+
+  host_card_set(argv[optind]);
+  core_main();
+  // the profile only applies to playback, startup reads stay instant
+  if (profile != NULL && !host_card_profile(profile)) {
+    fprintf(stderr, "no sd timings in %s\n", profile);
+    return 1;
+  }
+  if (banks_with_samples_num == 0) {
+    fprintf(stderr, "no samples found in %s\n", argv[optind]);
+    return 1;
+  }
+  if (!host_audio_record(argv[optind + 1])) {
+    fprintf(stderr, "could not write %s\n", argv[optind + 1]);
+    return 1;
+  }
+
+  // the controls go through the command queue, like a key press would
+  if (bank >= 0) {
+    CommandQueue_send(commandqueue, COMMAND_SAMPLE, bank, sample, 0);
+  }
+  if (bpm > 0) {
+    sf->bpm_tempo = bpm;
+  }
+  for (uint8_t i = 0; i < fx_num; i++) {
+    CommandQueue_send(commandqueue, COMMAND_FX_TOGGLE, fx[i], 0, 0);
+  }
+  for (uint8_t i = 0; i < routes_num; i++) {
+    CommandQueue_send(commandqueue, COMMAND_MOD_ROUTE, routes[i][0],
+                      routes[i][1], routes[i][2]);
+  }
+
+  uint32_t blocks = seconds * SAMPLE_RATE / SAMPLES_PER_BUFFER;
+  uint32_t misses = 0;
+  uint32_t underruns = 0;
+  uint64_t start_us = time_us_64();
+  struct timespec t0, t1;
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (uint32_t i = 0; i < blocks; i++) {
+    // the i2s asks for a block every period, or right away if the last one
+    // ran over
+    uint64_t due = start_us + (uint64_t)i * US_PER_BLOCK;
+    if (time_us_64() < due) {
+      host_advance_us(due - time_us_64());
+    }
+    host_core0_tick();
+    uint64_t t_block = time_us_64();
+    i2s_callback_func();
+    if (time_us_64() - t_block > US_PER_BLOCK) {
+      misses++;
+    }
+    // the other queued buffers cover for a late block, until they run out
+    if (time_us_64() > due + (AUDIO_BUFFER_COUNT - 1) * US_PER_BLOCK) {
+      underruns++;
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  host_core0_tick();
+  host_audio_close();
+
+  float elapsed =
+      (t1.tv_sec - t0.tv_sec) + (float)(t1.tv_nsec - t0.tv_nsec) / 1e9f;
+  float rendered = (float)blocks * SAMPLES_PER_BUFFER / SAMPLE_RATE;
+  printf("[host] rendered %u blocks (%2.1f s) in %2.3f s, %2.0fx real time\n",
+         blocks, rendered, elapsed, rendered / elapsed);
+  printf("[host] %u deadline misses, %u underruns\n", misses, underruns);
+  printf("[host] peak %d\n", host_audio_peak());
+  return 0;
+}
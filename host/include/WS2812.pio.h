@@ -0,0 +1,19 @@
+#pragma once
+#include "pico.h"
+
+// host stand-in for the header pioasm generates from lib/WS2812.pio
+
+#define ws2812_T1 2
+#define ws2812_T2 5
+#define ws2812_T3 3
+
+static const pio_program_t ws2812_program = {0};
+
+static inline void ws2812_program_init(PIO pio, uint sm, uint offset, uint pin,
+                                       float freq, uint bits) {
+  (void)offset;
+  (void)freq;
+  (void)bits;
+  pio_gpio_init(pio, pin);
+  pio_sm_set_enabled(pio, sm, true);
+}
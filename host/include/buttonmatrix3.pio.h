@@ -0,0 +1,12 @@
+#pragma once
+#include "pico.h"
+
+// host stand-in for the header pioasm generates from lib/buttonmatrix3.pio
+
+static const pio_program_t button_matrix_program = {0};
+
+static inline pio_sm_config button_matrix_program_get_default_config(
+    uint offset) {
+  (void)offset;
+  return pio_get_default_sm_config();
+}
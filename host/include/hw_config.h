@@ -0,0 +1,6 @@
+#pragma once
+#include "ff.h"
+#include "sd_card.h"
+
+size_t sd_get_num();
+sd_card_t *sd_get_by_num(size_t num);
@@ -0,0 +1,5 @@
+#pragma once
+// glibc deprecates mallinfo for mallinfo2, which has the same fields as
+// size_t, see lib/memusage.h
+#include_next <malloc.h>
+#define mallinfo mallinfo2
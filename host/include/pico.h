@@ -0,0 +1,307 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// host stand-in for the pico sdk. every hardware/ and pico/ header the
+// firmware includes lands here, so the firmware sources compile unchanged
+// on linux. the functions are implemented in host/hal.c.
+
+#ifndef HOST_PICO_H_
+#define HOST_PICO_H_
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef unsigned int uint;
+
+// sections and attributes
+#define __not_in_flash(group)
+#define __not_in_flash_func(func_name) func_name
+#define __time_critical_func(func_name) func_name
+#define __scratch_x(group)
+#define __scratch_y(group)
+#define __in_flash(group)
+#define __isr
+#define __force_inline inline
+#define __packed __attribute__((packed))
+#ifndef __unused
+#define __unused __attribute__((unused))
+#endif
+
+#define panic(...)                \
+  do {                            \
+    fprintf(stderr, __VA_ARGS__); \
+    abort();                      \
+  } while (0)
+#define hard_assert assert
+
+#define MHZ 1000000
+#define KHZ 1000
+#define PICO_DEFAULT_LED_PIN 25
+
+// time, a virtual clock that advances with sleeps and rendered blocks
+typedef uint64_t absolute_time_t;
+uint64_t time_us_64(void);
+uint32_t time_us_32(void);
+absolute_time_t get_absolute_time(void);
+static inline uint32_t to_ms_since_boot(absolute_time_t t) {
+  return (uint32_t)(t / 1000);
+}
+static inline uint64_t to_us_since_boot(absolute_time_t t) { return t; }
+static inline int64_t absolute_time_diff_us(absolute_time_t from,
+                                            absolute_time_t to) {
+  return (int64_t)(to - from);
+}
+void sleep_ms(uint32_t ms);
+void sleep_us(uint64_t us);
+static inline void tight_loop_contents(void) {}
+
+// cores and interrupts, the host runs everything on one thread
+static inline uint get_core_num(void) { return 0; }
+static inline uint32_t save_and_disable_interrupts(void) { return 0; }
+static inline void restore_interrupts(uint32_t status) { (void)status; }
+static inline void __dmb(void) {}
+static inline void __wfe(void) {}
+static inline void __sev(void) {}
+typedef volatile uint32_t spin_lock_t;
+typedef struct {
+  int owner;
+} mutex_t;
+static inline void mutex_init(mutex_t *m) { m->owner = -1; }
+static inline bool mutex_try_enter(mutex_t *m, uint32_t *owner) {
+  (void)m;
+  (void)owner;
+  return true;
+}
+static inline void mutex_enter_blocking(mutex_t *m) { (void)m; }
+static inline void mutex_exit(mutex_t *m) { (void)m; }
+
+// clocks
+enum clock_index { clk_gpout0 = 0, clk_ref = 4, clk_sys, clk_peri, clk_usb };
+#define pll_sys ((void *)0)
+#define pll_usb ((void *)1)
+#define CLOCKS_CLK_USB_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB 0
+#define CLOCKS_CLK_SYS_CTRL_SRC_VALUE_CLKSRC_CLK_SYS_AUX 1
+#define CLOCKS_CLK_SYS_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB 1
+#define CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLK_SYS 0
+#define CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB 2
+uint32_t clock_get_hz(enum clock_index clk_index);
+bool clock_configure(enum clock_index clk_index, uint32_t src,
+                     uint32_t auxsrc, uint32_t src_freq, uint32_t freq);
+void pll_init(void *pll, uint ref_div, uint vco_freq, uint post_div1,
+              uint post_div2);
+bool set_sys_clock_khz(uint32_t freq_khz, bool required);
+bool stdio_init_all(void);
+#define PICO_ERROR_TIMEOUT -1
+int getchar_timeout_us(uint32_t timeout_us);
+
+// systick, counts down at clk_sys from the host clock
+typedef struct {
+  volatile uint32_t csr;
+  volatile uint32_t rvr;
+  volatile uint32_t cvr;
+  volatile uint32_t calib;
+} systick_hw_t;
+systick_hw_t *host_systick(void);
+#define systick_hw (host_systick())
+
+// flash cache
+typedef struct {
+  volatile uint32_t ctrl;
+  volatile uint32_t flush;
+  volatile uint32_t stat;
+} xip_ctrl_hw_t;
+extern xip_ctrl_hw_t host_xip_ctrl;
+#define xip_ctrl_hw (&host_xip_ctrl)
+
+// gpio
+enum gpio_function {
+  GPIO_FUNC_SPI = 1,
+  GPIO_FUNC_UART = 2,
+  GPIO_FUNC_I2C = 3,
+  GPIO_FUNC_SIO = 5,
+  GPIO_FUNC_PIO0 = 6,
+  GPIO_FUNC_PIO1 = 7,
+};
+#define GPIO_OUT 1
+#define GPIO_IN 0
+#define GPIO_IRQ_EDGE_FALL 0x4u
+#define GPIO_IRQ_EDGE_RISE 0x8u
+typedef void (*gpio_irq_callback_t)(uint gpio, uint32_t event_mask);
+void gpio_init(uint gpio);
+void gpio_set_dir(uint gpio, bool out);
+void gpio_put(uint gpio, bool value);
+bool gpio_get(uint gpio);
+void gpio_pull_up(uint gpio);
+void gpio_pull_down(uint gpio);
+void gpio_set_function(uint gpio, enum gpio_function fn);
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t events,
+                                        bool enabled,
+                                        gpio_irq_callback_t callback);
+
+// adc
+void adc_init(void);
+void adc_gpio_init(uint gpio);
+void adc_select_input(uint input);
+uint16_t adc_read(void);
+
+// i2c, spi and uart read back zeros
+// tagged like the sdk's, the drivers name struct i2c_inst
+typedef struct i2c_inst {
+  int index;
+} i2c_inst_t;
+typedef struct spi_inst {
+  int index;
+} spi_inst_t;
+typedef struct uart_inst {
+  int index;
+} uart_inst_t;
+extern i2c_inst_t host_i2c[2];
+extern spi_inst_t host_spi[2];
+extern uart_inst_t host_uart[2];
+#define i2c0 (&host_i2c[0])
+#define i2c1 (&host_i2c[1])
+#define i2c_default i2c0
+#define spi0 (&host_spi[0])
+#define spi1 (&host_spi[1])
+#define uart0 (&host_uart[0])
+#define uart1 (&host_uart[1])
+#define uart_default uart0
+uint i2c_init(i2c_inst_t *i2c, uint baudrate);
+uint i2c_set_baudrate(i2c_inst_t *i2c, uint baudrate);
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src,
+                       size_t len, bool nostop);
+int i2c_read_blocking(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len,
+                      bool nostop);
+uint spi_init(spi_inst_t *spi, uint baudrate);
+int spi_write_read_blocking(spi_inst_t *spi, const uint8_t *src, uint8_t *dst,
+                            size_t len);
+uint uart_set_baudrate(uart_inst_t *uart, uint baudrate);
+
+// pio, programs load and state machines swallow their fifo
+typedef struct {
+  int index;
+} pio_hw_t;
+typedef pio_hw_t *PIO;
+extern pio_hw_t host_pio[2];
+#define pio0 (&host_pio[0])
+#define pio1 (&host_pio[1])
+typedef struct pio_program {
+  const uint16_t *instructions;
+  uint8_t length;
+  int8_t origin;
+} pio_program_t;
+typedef struct {
+  uint32_t clkdiv;
+  uint32_t execctrl;
+  uint32_t shiftctrl;
+  uint32_t pinctrl;
+} pio_sm_config;
+static inline pio_sm_config pio_get_default_sm_config(void) {
+  pio_sm_config c = {0};
+  return c;
+}
+static inline void sm_config_set_in_pins(pio_sm_config *c, uint in_base) {
+  (void)c;
+  (void)in_base;
+}
+static inline void sm_config_set_set_pins(pio_sm_config *c, uint set_base,
+                                          uint set_count) {
+  (void)c;
+  (void)set_base;
+  (void)set_count;
+}
+static inline void sm_config_set_out_pins(pio_sm_config *c, uint out_base,
+                                          uint out_count) {
+  (void)c;
+  (void)out_base;
+  (void)out_count;
+}
+static inline void sm_config_set_sideset_pins(pio_sm_config *c,
+                                              uint sideset_base) {
+  (void)c;
+  (void)sideset_base;
+}
+static inline void sm_config_set_in_shift(pio_sm_config *c, bool shift_right,
+                                          bool autopush, uint push_threshold) {
+  (void)c;
+  (void)shift_right;
+  (void)autopush;
+  (void)push_threshold;
+}
+static inline void sm_config_set_out_shift(pio_sm_config *c, bool shift_right,
+                                           bool autopull,
+                                           uint pull_threshold) {
+  (void)c;
+  (void)shift_right;
+  (void)autopull;
+  (void)pull_threshold;
+}
+static inline void sm_config_set_clkdiv(pio_sm_config *c, float div) {
+  (void)c;
+  (void)div;
+}
+#define PIO_FIFO_JOIN_TX 1
+static inline void sm_config_set_fifo_join(pio_sm_config *c, int join) {
+  (void)c;
+  (void)join;
+}
+uint pio_add_program(PIO pio, const pio_program_t *program);
+void pio_gpio_init(PIO pio, uint pin);
+int pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config *config);
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled);
+void pio_sm_set_consecutive_pindirs(PIO pio, uint sm, uint pin_base,
+                                    uint pin_count, bool is_out);
+void pio_sm_set_clkdiv(PIO pio, uint sm, float div);
+void pio_sm_clear_fifos(PIO pio, uint sm);
+bool pio_sm_is_rx_fifo_empty(PIO pio, uint sm);
+uint32_t pio_sm_get(PIO pio, uint sm);
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data);
+
+// rtc
+typedef struct {
+  int16_t year;
+  int8_t month;
+  int8_t day;
+  int8_t dotw;
+  int8_t hour;
+  int8_t min;
+  int8_t sec;
+} datetime_t;
+
+// multicore, core1 is never launched on the host
+void multicore_launch_core1(void (*entry)(void));
+void multicore_reset_core1(void);
+
+// sd card over sdio
+void rp2040_sdio_set_clock_divider(int clock_divider);
+
+// host simulator controls
+void host_advance_us(uint64_t us);
+
+#endif
@@ -0,0 +1,8 @@
+#pragma once
+#include "pico.h"
+
+typedef struct mem_buffer {
+  size_t size;
+  uint8_t *bytes;
+  uint8_t flags;
+} mem_buffer_t;
@@ -0,0 +1,14 @@
+#pragma once
+#include "ff.h"
+#include "pico.h"
+
+// host stand-in for lib/sdio/sd_driver/sd_card.h, one card backed by a
+// directory, see host/ff_posix.c
+
+typedef struct sd_card_t {
+  const char *pcName;
+  FATFS fatfs;
+  bool mounted;
+} sd_card_t;
+
+bool sd_init_driver();
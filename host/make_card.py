@@ -0,0 +1,66 @@
+# write a small card for the host simulator: one bank with one sample, a
+# two bar loop of decaying tones at 120 bpm cut into 16 slices, laid out the
+# way the zeptocore tool writes it
+# python3 host/make_card.py card
+
+import math
+import os
+import struct
+import sys
+
+SAMPLE_RATE = 44100
+BPM = 120
+SLICES = 16
+FILE_VARIATIONS = 1
+# the tool pads the audio with half a second on both ends
+PADDING = SAMPLE_RATE // 2
+
+
+def loop():
+    beat = SAMPLE_RATE * 60 // BPM
+    samples = []
+    for i in range(beat * 8):
+        n = i % (beat // 2)
+        freq = 110 * (1 + (i // (beat // 2)) % 4)
+        env = math.exp(-n / (beat / 8))
+        samples.append(int(12000 * env * math.sin(2 * math.pi * freq * n / SAMPLE_RATE)))
+    return samples
+
+
+def write_wav(fname, samples):
+    padded = samples[-PADDING:] + samples + samples[:PADDING]
+    data = struct.pack("<%dh" % len(padded), *padded)
+    with open(fname, "wb") as f:
+        f.write(b"RIFF" + struct.pack("<I", 36 + len(data)) + b"WAVEfmt ")
+        f.write(struct.pack("<IHHIIHH", 16, 1, 1, SAMPLE_RATE, SAMPLE_RATE * 2, 2, 16))
+        f.write(b"data" + struct.pack("<I", len(data)))
+        f.write(data)
+
+
+def write_info(fname, samples):
+    size = len(samples) * 2
+    # bpm:9 slice_num:7 slice_current:7 play_mode:3 splice_trigger:3
+    # tempo_match:1 oversampling:1 num_channels:1
+    bits = BPM | SLICES << 9 | 1 << 26 | 1 << 29
+    starts = [size * i // SLICES // 4 * 4 for i in range(SLICES)]
+    stops = [size * (i + 1) // SLICES // 4 * 4 for i in range(SLICES)]
+    with open(fname, "wb") as f:
+        # the header is 16 bytes, the last 8 are left over from the writer
+        f.write(struct.pack("<II8x", size, bits))
+        f.write(struct.pack("<%di" % SLICES, *starts))
+        f.write(struct.pack("<%di" % SLICES, *stops))
+        f.write(bytes(SLICES))
+
+
+def run():
+    card = sys.argv[1]
+    os.makedirs(os.path.join(card, "bank0"), exist_ok=True)
+    samples = loop()
+    for variation in range(FILE_VARIATIONS):
+        fname = os.path.join(card, "bank0", "0.%d.wav" % variation)
+        write_wav(fname, samples)
+        write_info(fname + ".info", samples)
+
+
+if __name__ == "__main__":
+    run()
@@ -0,0 +1,198 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef HOST_SDMODEL_H_
+#define HOST_SDMODEL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pcg_basic.h"
+
+// SdModel draws sd card read times from a card profile, the serial logs in
+// dev/sdcards and dev/sdcards2 printed with PRINT_SDCARD_TIMING:
+//
+//   sdcard16.5 440 846 ...
+//
+// utilization, sd microseconds for the block (seeks, reads and opens) and
+// the bytes read. the firmware prints every 64th block, and also every block
+// over 9 ms and every block that opens a file, so the slow tail and the opens
+// are over-represented in the log. samples are weighted back to per-block
+// rates: the periodic lines count 64 times, the slow and open lines once.
+// lines with an integer utilization are the overload print of a block already
+// counted and are skipped.
+//
+// newer firmware ends an open line with "open". older logs do not, but an
+// early print restarts the 64 block utilization sum, so an open shows up as a
+// line whose utilization is under half of the periodic line before it.
+//
+// the fit is the weighted empirical distribution of time per byte, so a read
+// costs its size times a draw from it. the logs cannot separate seeks from
+// reads, their cost is folded into every read. draws are independent, bursts
+// of slow blocks are not modelled.
+
+#define SDMODEL_PERIOD 64
+// an unmarked line under this fraction of the last periodic utilization is
+// an open
+#define SDMODEL_OPEN_FRACTION 0.5f
+#define SDMODEL_SLOW_US 9000
+// shorter lines were cut off on the serial port
+#define SDMODEL_MIN_BYTES 256
+// the logs were taken with 441 sample blocks
+#define SDMODEL_LOG_US_PER_BLOCK 10000
+
+typedef struct SdModel {
+  char name[64];
+  uint32_t num;
+  // sorted ns per byte, with the cumulative weight up to each
+  float *ns_per_byte;
+  float *cdf;
+  // median of the block time not spent on the card, in microseconds
+  uint32_t cpu_us;
+  pcg32_random_t rng;
+} SdModel;
+
+static int SdModel_compare(const void *a, const void *b) {
+  float fa = ((const float *)a)[0];
+  float fb = ((const float *)b)[0];
+  return (fa > fb) - (fa < fb);
+}
+
+SdModel *SdModel_load(const char *fname) {
+  FILE *f = fopen(fname, "r");
+  if (f == NULL) {
+    return NULL;
+  }
+  uint32_t cap = 1024;
+  uint32_t num = 0;
+  // ns per byte and weight, interleaved for sorting
+  float *samples = malloc(sizeof(float) * 2 * cap);
+  float *cpu = malloc(sizeof(float) * cap);
+  uint32_t cpu_num = 0;
+  // utilization of the last periodic line
+  float level = 0;
+  char line[512];
+  while (fgets(line, sizeof(line), f) != NULL) {
+    char *p = line;
+    while ((p = strstr(p, "sdcard")) != NULL) {
+      p += 6;
+      char token[16];
+      char tag[8] = "";
+      unsigned int us;
+      unsigned int bytes;
+      if (sscanf(p, "%15s %u %u %*u %*u %7s", token, &us, &bytes, tag) < 3 ||
+          bytes < SDMODEL_MIN_BYTES || strchr(token, '.') == NULL) {
+        continue;
+      }
+      float utilization = atof(token);
+      bool slow = us > SDMODEL_SLOW_US;
+      bool open = strcmp(tag, "open") == 0 ||
+                  (!slow && utilization < level * SDMODEL_OPEN_FRACTION);
+      if (!slow && !open) {
+        level = utilization;
+      }
+      if (num == cap) {
+        cap *= 2;
+        samples = realloc(samples, sizeof(float) * 2 * cap);
+        cpu = realloc(cpu, sizeof(float) * cap);
+      }
+      samples[num * 2 + 0] = (float)us * 1000.0f / (float)bytes;
+      samples[num * 2 + 1] = slow || open ? 1 : SDMODEL_PERIOD;
+      num++;
+      if (!slow && !open) {
+        float busy = utilization * SDMODEL_LOG_US_PER_BLOCK / 100.0f - us;
+        cpu[cpu_num++] = busy > 0 ? busy : 0;
+      }
+    }
+  }
+  fclose(f);
+  if (num == 0) {
+    free(samples);
+    free(cpu);
+    return NULL;
+  }
+
+  SdModel *self = (SdModel *)malloc(sizeof(SdModel));
+  const char *base = strrchr(fname, '/');
+  snprintf(self->name, sizeof(self->name), "%s", base ? base + 1 : fname);
+  char *ext = strrchr(self->name, '.');
+  if (ext != NULL) {
+    *ext = 0;
+  }
+  self->num = num;
+  self->ns_per_byte = malloc(sizeof(float) * num);
+  self->cdf = malloc(sizeof(float) * num);
+  qsort(samples, num, sizeof(float) * 2, SdModel_compare);
+  float total = 0;
+  for (uint32_t i = 0; i < num; i++) {
+    total += samples[i * 2 + 1];
+  }
+  float sum = 0;
+  for (uint32_t i = 0; i < num; i++) {
+    sum += samples[i * 2 + 1];
+    self->ns_per_byte[i] = samples[i * 2 + 0];
+    self->cdf[i] = sum / total;
+  }
+  self->cpu_us = 0;
+  if (cpu_num > 0) {
+    qsort(cpu, cpu_num, sizeof(float), SdModel_compare);
+    self->cpu_us = cpu[cpu_num / 2];
+  }
+  pcg32_srandom_r(&self->rng, 42, 54);
+  free(samples);
+  free(cpu);
+  return self;
+}
+
+void SdModel_free(SdModel *self) {
+  free(self->ns_per_byte);
+  free(self->cdf);
+  free(self);
+}
+
+// ns per byte at quantile q of the per-block distribution
+float SdModel_quantile(SdModel *self, float q) {
+  uint32_t lo = 0;
+  uint32_t hi = self->num - 1;
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    if (self->cdf[mid] < q) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return self->ns_per_byte[lo];
+}
+
+// microseconds for a read of bytes
+uint32_t SdModel_readUs(SdModel *self, uint32_t bytes) {
+  float q = (float)pcg32_random_r(&self->rng) / 4294967296.0f;
+  return SdModel_quantile(self, q) * bytes / 1000.0f;
+}
+
+#endif
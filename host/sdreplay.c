@@ -0,0 +1,138 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// _core_sdreplay drives the card profiles with the audio callback's read
+// pattern, without the firmware, and reports per card how often a block would
+// be late:
+//
+//   _core_sdreplay [-s seconds] [-n samples] [-b buffers] [-u cpu_us]
+//                  [-j jump_every] profile...
+//
+// every block reads its samples as 16-bit mono. a slice jump every jump_every
+// blocks on average reads the block twice, the outgoing voice and the
+// incoming one for the crossfade. the rest of the block takes cpu_us, or the
+// median the profile was logged with. the i2s asks for a block every period;
+// a block that takes longer is a deadline miss, and an underrun once the
+// buffers queued behind it have played out too.
+
+#include <getopt.h>
+
+#include "sdmodel.h"
+
+#define SAMPLE_RATE 44100
+
+static int compare_u32(const void *a, const void *b) {
+  uint32_t ua = *(const uint32_t *)a;
+  uint32_t ub = *(const uint32_t *)b;
+  return (ua > ub) - (ua < ub);
+}
+
+int main(int argc, char **argv) {
+  uint32_t seconds = 600;
+  uint32_t samples = 441;
+  uint32_t buffers = 3;
+  int32_t cpu_us = -1;
+  uint32_t jump_every = 8;
+  int opt;
+  while ((opt = getopt(argc, argv, "s:n:b:u:j:")) != -1) {
+    switch (opt) {
+      case 's':
+        seconds = atoi(optarg);
+        break;
+      case 'n':
+        samples = atoi(optarg);
+        break;
+      case 'b':
+        buffers = atoi(optarg);
+        break;
+      case 'u':
+        cpu_us = atoi(optarg);
+        break;
+      case 'j':
+        jump_every = atoi(optarg);
+        break;
+      default:
+        fprintf(stderr,
+                "usage: %s [-s seconds] [-n samples] [-b buffers] [-u cpu_us] "
+                "[-j jump_every] profile...\n",
+                argv[0]);
+        return 1;
+    }
+  }
+  if (optind >= argc || samples == 0 || buffers == 0 || jump_every == 0) {
+    fprintf(stderr, "need at least one profile\n");
+    return 1;
+  }
+
+  uint64_t period_us = (uint64_t)samples * 1000000 / SAMPLE_RATE;
+  uint32_t blocks = (uint64_t)seconds * SAMPLE_RATE / samples;
+  uint32_t *read_us = malloc(sizeof(uint32_t) * blocks);
+  printf("%d blocks of %d samples, %d us each, %d buffers\n", blocks, samples,
+         (int)period_us, buffers);
+  printf("%-32s %6s %6s %6s %6s %8s %9s\n", "card", "cpu", "p50", "p99", "max",
+         "misses", "underruns");
+
+  int ret = 0;
+  for (int i = optind; i < argc; i++) {
+    SdModel *model = SdModel_load(argv[i]);
+    if (model == NULL) {
+      fprintf(stderr, "no sd timings in %s\n", argv[i]);
+      ret = 1;
+      continue;
+    }
+    uint32_t cpu = cpu_us < 0 ? model->cpu_us : (uint32_t)cpu_us;
+    uint32_t misses = 0;
+    uint32_t underruns = 0;
+    uint64_t now = 0;
+    for (uint32_t k = 0; k < blocks; k++) {
+      uint64_t due = (uint64_t)k * period_us;
+      if (now < due) {
+        now = due;
+      }
+      uint32_t reads = 1;
+      if (pcg32_boundedrand_r(&model->rng, jump_every) == 0) {
+        reads = 2;
+      }
+      read_us[k] = 0;
+      for (uint32_t r = 0; r < reads; r++) {
+        read_us[k] += SdModel_readUs(model, samples * 2);
+      }
+      uint64_t took = cpu + read_us[k];
+      if (took > period_us) {
+        misses++;
+      }
+      now += took;
+      if (now > due + (buffers - 1) * period_us) {
+        underruns++;
+      }
+    }
+    qsort(read_us, blocks, sizeof(uint32_t), compare_u32);
+    printf("%-32s %6d %6d %6d %6d %8d %9d\n", model->name, cpu,
+           read_us[blocks / 2], read_us[(uint64_t)blocks * 99 / 100],
+           read_us[blocks - 1], misses, underruns);
+    SdModel_free(model);
+  }
+  free(read_us);
+  return ret;
+}
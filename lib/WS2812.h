@@ -52,6 +52,13 @@ WS2812 *WS2812_new(uint pin, PIO pio, uint sm) {
   return ws;
 }
 
+// re-derives the pio clock divider after clk_sys changed
+void WS2812_updateClock(WS2812 *ws) {
+  int cycles_per_bit = ws2812_T1 + ws2812_T2 + ws2812_T3;
+  pio_sm_set_clkdiv(ws->pio, ws->sm,
+                    clock_get_hz(clk_sys) / (800000.0f * cycles_per_bit));
+}
+
 void WS2812_fill(WS2812 *ws, uint8_t red, uint8_t green, uint8_t blue) {
   uint32_t rgbw =
       (uint32_t)(blue) << 16 | (uint32_t)(green) << 8 | (uint32_t)(red);
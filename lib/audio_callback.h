@@ -33,16 +33,265 @@ const uint8_t cpu_usage_flag_limit = 3;
 const uint8_t cpu_usage_limit_threshold = 150;
 
 bool audio_was_muted = false;
+// sample offset of the pending jump in the block, from its command
+uint16_t phase_new_offset = 0;
+// the shortest crossfade a mid-block jump gets, later jumps are moved earlier
+#define SPLIT_FADE_MIN 64
+int32_t split_fade[SAMPLES_PER_BUFFER];
+uint16_t clock_out_remaining = 0;
 bool do_open_file_ready = false;
 
-void update_filter_from_envelope(int32_t val) {
-  for (uint8_t channel = 0; channel < 2; channel++) {
-    ResonantFilter_setFilterType(resFilter[channel], 0);
-    ResonantFilter_setFc(resFilter[channel], val);
+// the fx state as the audio core has it. only the audio core writes it, core0
+// gets a copy in sf->fx_active through audio_fx_state, see audio_fx_sync.
+bool audio_fx_active[FX_NUM];
+// audio_fx_active as a bitmask, published in one word after every toggle
+volatile uint32_t audio_fx_state = 0;
+
+// flips an fx and applies what comes with it, on the audio core
+void audio_fx_toggle_apply(uint8_t fx_num) {
+  audio_fx_active[fx_num] = !audio_fx_active[fx_num];
+  switch (fx_num) {
+    case FX_REVERSE:
+      phase_forward = !audio_fx_active[fx_num];
+      break;
+    case FX_BEATREPEAT:
+      if (!BeatRepeat_setActive(beatrepeat, audio_fx_active[fx_num])) {
+        LogRing_printf(logring, "[fxpool] no room for beat repeat\n");
+        audio_fx_active[fx_num] = false;
+      } else if (audio_fx_active[fx_num]) {
+        if (beatrepeat->ringbuffer_size < BEATREPEAT_RINGBUFFER_SIZE) {
+          LogRing_printf(logring, "[fxpool] beat repeat at %d frames\n",
+                         beatrepeat->ringbuffer_size);
+        }
+        BeatRepeat_repeat(beatrepeat,
+                          BeatRepeat_length(sf->fx_param[FX_BEATREPEAT][0],
+                                            sf->bpm_tempo));
+      }
+      break;
+    case FX_DELAY:
+      if (!Delay_setActive(delay, audio_fx_active[fx_num] &&
+                                      governor->level < GOVERNOR_NO_DELAY)) {
+        LogRing_printf(logring, "[fxpool] no room for delay\n");
+        audio_fx_active[fx_num] = false;
+      } else if (delay->delay_ringbuffer != NULL &&
+                 delay->line_size < DELAY_LINE_SIZE) {
+        LogRing_printf(logring, "[fxpool] delay at %d samples\n",
+                       delay->line_size);
+      }
+      break;
+    case FX_REVERB:
+      if (!Reverb_setActive(reverb, audio_fx_active[fx_num] &&
+                                        governor->level < GOVERNOR_NO_DELAY)) {
+        LogRing_printf(logring, "[fxpool] no room for reverb\n");
+        audio_fx_active[fx_num] = false;
+      } else if (reverb->degraded) {
+        LogRing_printf(logring, "[fxpool] reverb at half rate\n");
+      }
+      break;
+    case FX_TIGHTEN:
+      LogRing_printf(logring, "FX_TIGHTEN\n");
+      if (audio_fx_active[fx_num]) {
+        Gate_set_amount(audio_gate, sf->fx_param[FX_TIGHTEN][0]);
+      } else {
+        Gate_set_amount(audio_gate, 255);
+      }
+      break;
+    case FX_SLOWDOWN:
+      if (audio_fx_active[fx_num]) {
+        EnvelopeTable_goto(envelope_pitch, 0.5, 1, ENVELOPE_COSINE);
+      } else {
+        EnvelopeTable_goto(envelope_pitch, 1.0, 1, ENVELOPE_COSINE);
+      }
+      break;
+    case FX_SPEEDUP:
+      if (audio_fx_active[fx_num]) {
+        EnvelopeTable_goto(envelope_pitch, 2.0, 1, ENVELOPE_COSINE);
+      } else {
+        EnvelopeTable_goto(envelope_pitch, 1.0, 1, ENVELOPE_COSINE);
+      }
+      break;
+    case FX_TAPE_STOP:
+      if (audio_fx_active[FX_TAPE_STOP]) {
+        EnvelopeTable_goto(envelope_pitch, ENVELOPE_PITCH_THRESHOLD / 2, 2.7,
+                           ENVELOPE_COSINE);
+      } else {
+        EnvelopeTable_goto(envelope_pitch, 1.0, 1.9, ENVELOPE_COSINE);
+      }
+      break;
+    case FX_FUZZ:
+      if (audio_fx_active[FX_FUZZ]) {
+        LogRing_printf(logring, "fuzz activated!\n");
+      }
+    case FX_FILTER:
+      if (audio_fx_active[FX_FILTER]) {
+        EnvelopeTable_goto(envelope_filter, 5, 1.618, ENVELOPE_LINEAR);
+      } else {
+        EnvelopeTable_goto(envelope_filter, global_filter_index, 1.618,
+                           ENVELOPE_LINEAR);
+      }
+      break;
+    case FX_VOLUME_RAMP:
+      if (audio_fx_active[FX_VOLUME_RAMP]) {
+        EnvelopeTable_goto(envelope_volume, 0, 1.618 / 2, ENVELOPE_COSINE);
+      } else {
+        EnvelopeTable_goto(envelope_volume, 1, 1.618 / 2, ENVELOPE_COSINE);
+      }
+      break;
+    case FX_TIMESTRETCH:
+      TimeStretch_setActive(timestretch, audio_fx_active[fx_num]);
+      if (audio_fx_active[fx_num] && timestretch->window == NULL) {
+        LogRing_printf(logring, "[fxpool] no room for time stretch window\n");
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+// toggles an fx, runs on the audio core from COMMAND_FX_TOGGLE
+void audio_fx_toggle(uint8_t fx_num) {
+  audio_fx_toggle_apply(fx_num);
+  uint32_t state = 0;
+  for (uint8_t i = 0; i < FX_NUM; i++) {
+    state |= (uint32_t)audio_fx_active[i] << i;
+  }
+  audio_fx_state = state;
+}
+
+// called from core0, copies the fx state the audio core published into the
+// save file, an fx the audio core had no room for shows up off again
+void audio_fx_sync() {
+  uint32_t state = audio_fx_state;
+  for (uint8_t i = 0; i < FX_NUM; i++) {
+    sf->fx_active[i] = (state >> i) & 1;
+  }
+}
+
+void audio_command_apply(Command *c) {
+  switch (c->type) {
+    case COMMAND_JUMP:
+      phase_new = c->value;
+      phase_new_offset = c->offset;
+      phase_change = true;
+      gate_counter = 0;
+      audio_mute = false;
+      Gate_reset(audio_gate);
+      break;
+    case COMMAND_SAMPLE:
+      sel_bank_next = c->a;
+      sel_sample_next = c->b;
+      fil_current_change = true;
+      break;
+    case COMMAND_FX_TOGGLE:
+      audio_fx_toggle(c->a);
+      break;
+    case COMMAND_RETRIG:
+      audio_retrig_pitch = c->a;
+      audio_retrig_vol = (float)c->value / 65536.0f;
+      break;
+    case COMMAND_BEATREPEAT:
+      if (audio_fx_active[FX_BEATREPEAT]) {
+        BeatRepeat_repeat(beatrepeat, BeatRepeat_length(c->a, sf->bpm_tempo));
+      }
+      break;
+    case COMMAND_MOD_ROUTE:
+      Modulation_route(modulation, c->a, c->b, c->value);
+      break;
+    case COMMAND_KEY_JUMP:
+      if (c->value >= 0) {
+        debounce_quantize = c->value;
+      }
+      // the jump it sends lands where the key was pressed
+      CommandQueue_direct(commandqueue, c->offset);
+      key_do_jump(c->a);
+      CommandQueue_endDirect(commandqueue);
+      break;
+    case COMMAND_RETRIG_START:
+      retrig_start(c->a, c->b);
+      break;
+    case COMMAND_SEQUENCER:
+      sequencer_apply(c->a, c->b, c->value);
+      break;
+    case COMMAND_BEAT:
+      beat_current = c->value;
+      break;
+#ifdef INCLUDE_SINEBASS
+    case COMMAND_BASS_NOTE:
+      WaveBass_note_on(wavebass, c->a);
+      break;
+    case COMMAND_BASS_RELEASE:
+      WaveBass_release(wavebass);
+      break;
+#endif
+    default:
+      break;
+  }
+}
+
+// applies the side effects of moving the governor between levels
+void audio_governor_changed(uint8_t level_last) {
+  LogRing_printf(logring, "[governor] %s -> %s\n",
+                 governor_names[level_last], Governor_name(governor));
+  if (level_last < GOVERNOR_NO_DELAY && governor->level >= GOVERNOR_NO_DELAY) {
+    Delay_setActive(delay, false);
+    Reverb_setActive(reverb, false);
+  } else if (level_last >= GOVERNOR_NO_DELAY &&
+             governor->level < GOVERNOR_NO_DELAY) {
+    if (!Delay_setActive(delay, audio_fx_active[FX_DELAY])) {
+      LogRing_printf(logring, "[fxpool] no room for delay\n");
+    }
+    if (!Reverb_setActive(reverb, audio_fx_active[FX_REVERB])) {
+      LogRing_printf(logring, "[fxpool] no room for reverb\n");
+    }
+  }
+}
+
+// clk_peri runs from pll_usb (96 MHz, set up in main) rather than clk_sys, so
+// the uart and the adc's spi keep their rates when the clock governor moves
+// clk_sys. set_sys_clock_khz points clk_peri back at clk_sys, so this follows
+// every call to it.
+void clock_peri_pin() {
+  clock_configure(clk_peri, 0, CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB,
+                  96 * MHZ, 96 * MHZ);
+}
+
+#ifdef INCLUDE_CLOCK_GOVERNOR
+// moves the system clock when the governor asks, at the end of a block once
+// core0 is parked (see ClockGovernor_park). everything divided from clk_sys
+// is re-derived: i2s, sdio and the ws2812 pio, and the leds' i2c, which runs
+// from clk_sys on the rp2040.
+void audio_clock_update(uint32_t busy_us, bool idle) {
+  if (ClockGovernor_update(clockgovernor, busy_us, idle)) {
+    clockgovernor->pending = true;
+  }
+  if (!clockgovernor->pending || !clockgovernor->parked) {
+    return;
   }
+  if (clockgovernor->step != clockgovernor->step_last) {
+    uint32_t khz = ClockGovernor_khz(clockgovernor);
+    set_sys_clock_khz(khz, true);
+    clock_peri_pin();
+    audio_i2s_update_clock();
+    rp2040_sdio_set_clock_divider(ClockGovernor_sdioDivider(clockgovernor));
+#ifdef INCLUDE_RGBLED
+    WS2812_updateClock(ws2812);
+#endif
+#ifdef INCLUDE_ZEPTOCORE
+    i2c_set_baudrate(i2c_default, 40 * 1000);
+#endif
+    clockgovernor->step_last = clockgovernor->step;
+    LogRing_printf(logring, "[clock] %d khz\n", khz);
+  }
+  clockgovernor->parked = false;
+  clockgovernor->pending = false;
 }
+#endif
+
+// the cutoff index the filter envelope last set, and the knob's last seen
+int32_t envelope_filter_fc = -1;
+uint16_t filter_index_last = resonantfilter_fc_max;
 
-void i2s_callback_func() {
+void RAM_FUNC(i2s_callback_func)() {
   uint32_t values_to_read;
   uint32_t t0, t1;
   uint32_t sd_card_total_time = 0;
@@ -53,17 +302,65 @@ void i2s_callback_func() {
   bool do_crossfade = false;
   bool do_fade_out = false;
   bool do_fade_in = false;
+  bool sd_read_retry = false;
+  PROFILER_BLOCK_START();
   clock_t startTime = time_us_64();
   audio_buffer_t *buffer = take_audio_buffer(ap, false);
   take_audio_buffer_time = (time_us_64() - startTime);
+  PROFILER_MARK(PROFILER_TAKE_BUFFER);
   if (buffer == NULL) {
     return;
   }
 
-  EnvelopeLinearInteger_update(envelope_filter, update_filter_from_envelope);
+  // apply everything core0 asked for since the last block
+  CommandQueue_beginBlock(commandqueue, time_us_32());
+  Command command;
+  while (CommandQueue_pop(commandqueue, &command, US_PER_BLOCK,
+                          buffer->max_sample_count)) {
+    audio_command_apply(&command);
+  }
+  // run the beat clock over this block
+  Transport_setTempo(transport, sf->bpm_tempo);
+  Transport_process(transport, buffer->max_sample_count);
+
+  // the cutoff goes where the filter envelope or the knob, whichever moved
+  // last, puts it and glides there
+  int32_t fc = EnvelopeTable_advance(envelope_filter, buffer->max_sample_count);
+  if ((fc >> 16) != envelope_filter_fc) {
+    envelope_filter_fc = fc >> 16;
+    Smooth_set(&filter_cutoff, fc);
+  }
+  if (global_filter_index != filter_index_last) {
+    filter_index_last = global_filter_index;
+    Smooth_set(&filter_cutoff, (int32_t)global_filter_index << 16);
+  }
+  Smooth_beginBlock(&filter_cutoff, buffer->max_sample_count);
+
+  // the tremolo and pan keys own the routes from the two lfos to the volume
+  // and the pan, with the rate on the first knob and the shape on the second
+  Modulation_setLfo(modulation, MOD_LFO1,
+                    12 + (255 - sf->fx_param[FX_TREMELO][0]) * 2,
+                    sf->fx_param[FX_TREMELO][1] >> 6);
+  Modulation_setLfo(modulation, MOD_LFO2,
+                    12 + (255 - sf->fx_param[FX_PAN][0]) * 2,
+                    sf->fx_param[FX_PAN][1] >> 6);
+  Modulation_route(modulation, MOD_LFO1, MOD_VOLUME,
+                   audio_fx_active[FX_TREMELO] ? MOD_DEPTH_FULL : 0);
+  Modulation_route(modulation, MOD_LFO2, MOD_PAN,
+                   audio_fx_active[FX_PAN] ? MOD_DEPTH_FULL : 0);
+#ifdef INCLUDE_FILTER
+  Modulation_setEnvelope(
+      modulation,
+      envelope_filter_fc * 65534 / resonantfilter_fc_max - 32767);
+#endif
+  Modulation_beginBlock(modulation, buffer->max_sample_count, sf->bpm_tempo);
+  const bool modulate = governor->level < GOVERNOR_NO_LFO;
 
-  float envelope_volume_val = Envelope2_update(envelope_volume);
-  float envelope_pitch_val_new = Envelope2_update(envelope_pitch);
+  // the volume envelope steps with the samples once they are rendered
+  float envelope_volume_val =
+      q16_16_fp_to_float(EnvelopeTable_value(envelope_volume));
+  float envelope_pitch_val_new = q16_16_fp_to_float(
+      EnvelopeTable_advance(envelope_pitch, buffer->max_sample_count));
 
   int32_t *samples = (int32_t *)buffer->buffer->bytes;
 
@@ -73,6 +370,7 @@ void i2s_callback_func() {
       (envelope_pitch_val < ENVELOPE_PITCH_THRESHOLD) ||
       envelope_volume_val < 0.001 || Gate_is_up(audio_gate)) {
     envelope_pitch_val = envelope_pitch_val_new;
+    EnvelopeTable_advance(envelope_volume, buffer->max_sample_count);
 
     // continue to update the gate
     Gate_update(audio_gate, sf->bpm_tempo);
@@ -85,51 +383,53 @@ void i2s_callback_func() {
         audio_mute = false;
       }
     }
-    int16_t values[buffer->max_sample_count];
-    for (uint16_t i = 0; i < buffer->max_sample_count; i++) {
-      values[i] = 0;
-    }
+    // nothing to shape, but acknowledge any new curve so core0 can continue
+    ShaperChain_beginBlock(shaperchain);
+    ShaperChain_endBlock(shaperchain);
 
-    // saturate before resampling?
-    if (sf->fx_active[FX_SATURATE]) {
-      Saturation_process(saturation, values, buffer->max_sample_count);
-    }
-
-    // // fuzz
-    // if (sf->fx_active[FX_FUZZ]) {
-    //   Fuzz_process(values, buffer->max_sample_count);
-    // }
-
-    // // bitcrush
-    // if (sf->fx_active[FX_BITCRUSH]) {
-    //   Bitcrush_process(values, buffer->max_sample_count);
-    // }
-
-    uint vol_main = (uint)round(volume_vals[sf->vol] * retrig_vol *
-                                envelope_volume_val / VOLUME_DIVISOR_0_200);
-    for (uint16_t i = 0; i < buffer->max_sample_count; i++) {
-      samples[i * 2 + 0] = values[i];
-      samples[i * 2 + 0] = (vol_main * samples[i * 2 + 0]) << 8u;
-      samples[i * 2 + 0] += (samples[i * 2 + 0] >> 16u);
-      samples[i * 2 + 1] = samples[i * 2 + 0];  // R = L
-    }
+    memset(samples, 0, buffer->max_sample_count * 2 * sizeof(int32_t));
     buffer->sample_count = buffer->max_sample_count;
 
+    // idle when only silence goes out, then the delay and reverb can be
+    // skipped too
+    bool idle = Delay_isSilent(delay) && Reverb_isSilent(reverb);
 #ifdef INCLUDE_SINEBASS
     if (fil_is_open) {
+      idle = false;
       // apply bass
-      for (uint16_t i = 0; i < buffer->max_sample_count; i++) {
-        int32_t v = WaveBass_next(wavebass);
-        samples[i * 2 + 0] += v;
-        samples[i * 2 + 1] += v;
-      }
+      WaveBass_render(wavebass, samples, buffer->max_sample_count);
     }
 #endif
 
     // apply delay
-    Delay_process(delay, samples, buffer->max_sample_count, 0);
+    PROFILER_MARK(PROFILER_OTHER);
+    if (!idle) {
+      Delay_process(delay, samples, buffer->max_sample_count);
+      Reverb_process(reverb, samples, buffer->max_sample_count);
+    }
+    PROFILER_MARK(PROFILER_DELAY);
 
     give_audio_buffer(ap, buffer);
+    PROFILER_MARK(PROFILER_GIVE_BUFFER);
+    PROFILER_BLOCK_END();
+#ifdef INCLUDE_FLIGHTRECORDER
+    FlightRecord *flight = FlightRecorder_next(flightrecorder);
+    if (flight != NULL) {
+      memset(flight, 0, sizeof(FlightRecord));
+      flight->block = flightrecorder->block;
+      flight->total_us = time_us_64() - startTime;
+      flight->take_us = take_audio_buffer_time;
+      flight->flags = FLIGHTRECORD_MUTED |
+                      (sync_using_sdcard ? FLIGHTRECORD_SD_BUSY : 0) |
+                      (fil_is_open ? FLIGHTRECORD_FILE_OPEN : 0) |
+                      (reduce_cpu_usage > 0 ? FLIGHTRECORD_REDUCE_CPU : 0);
+      flight->bpm = sf->bpm_tempo;
+#ifdef INCLUDE_PROFILER
+      FlightRecorder_stages(flight, profiler);
+#endif
+      FlightRecorder_commit(flightrecorder, US_PER_BLOCK);
+    }
+#endif
     // if (!gate_active && fil_is_open && !audio_mute) {
     //   printf("[i2s_callback_func] sync_using_sdcard being used\n");
     // }
@@ -137,6 +437,9 @@ void i2s_callback_func() {
     // audio muted flag to ensure a fade in occurs when
     // unmuted
     audio_was_muted = true;
+#ifdef INCLUDE_CLOCK_GOVERNOR
+    audio_clock_update(time_us_64() - startTime, idle);
+#endif
     return;
   }
 
@@ -202,13 +505,15 @@ void i2s_callback_func() {
   // check if tempo matching is activated, if not then don't change
   // based on bpm
   uint32_t samples_to_read;
+  const float mod_pitch = modulate ? Modulation_pitch(modulation) : 1.0f;
   if (banks[sel_bank_cur]
           ->sample[sel_sample_cur]
           .snd[sel_variation]
           ->tempo_match) {
     samples_to_read =
         round(buffer->max_sample_count * sf->bpm_tempo * envelope_pitch_val *
-              pitch_vals[pitch_val_index] * pitch_vals[retrig_pitch]) *
+              pitch_vals[pitch_val_index] * pitch_vals[audio_retrig_pitch] *
+              mod_pitch) *
         (banks[sel_bank_cur]
              ->sample[sel_sample_cur]
              .snd[sel_variation]
@@ -218,7 +523,8 @@ void i2s_callback_func() {
   } else {
     samples_to_read =
         round((float)buffer->max_sample_count * envelope_pitch_val *
-              pitch_vals[pitch_val_index] * pitch_vals[retrig_pitch]) *
+              pitch_vals[pitch_val_index] * pitch_vals[audio_retrig_pitch] *
+              mod_pitch) *
         (banks[sel_bank_cur]
              ->sample[sel_sample_cur]
              .snd[sel_variation]
@@ -232,9 +538,20 @@ void i2s_callback_func() {
                                                ->num_channels +
                                            1);
   values_to_read = values_len * 2;  // 16-bit = 2 x 1 byte reads
-  int16_t values[values_len];
-  uint vol_main = (uint)round(volume_vals[sf->vol] * retrig_vol *
-                              envelope_volume_val / VOLUME_DIVISOR_0_200);
+  // the time stretch also reads around the grain, rounded up to a seek
+  const bool stretch = audio_fx_active[FX_TIMESTRETCH];
+  const uint32_t stretch_len =
+      stretch ? TIMESTRETCH_EXTRA *
+                        (banks[sel_bank_cur]
+                             ->sample[sel_sample_cur]
+                             .snd[sel_variation]
+                             ->num_channels +
+                         1) +
+                    PHASE_DIVISOR / 2
+              : 0;
+  int16_t values[values_len + stretch_len];
+  uint vol_main = (uint)round(volume_vals[sf->vol] * audio_retrig_vol /
+                              VOLUME_DIVISOR_0_200);
 
   if (!phase_change) {
     const int32_t next_phase =
@@ -314,19 +631,89 @@ void i2s_callback_func() {
     // if fading in then do not crossfade
     do_crossfade = false;
   }
-  // cpu_usage_flag is written when cpu usage is consistently high
-  // in which case it will fade out audio and keep it muted for a little
-  // bit to reduce cpu usage
+  // cpu_usage_flag is written when cpu usage is consistently high and the
+  // governor has nothing left to shed, in which case it will fade out audio
+  // and keep it muted for a little bit to reduce cpu usage
   if (cpu_usage_flag == cpu_usage_flag_limit) {
     do_fade_out = true;
   }
+  if (do_crossfade && governor->level >= GOVERNOR_NO_CROSSFADE) {
+    do_crossfade = false;
+    do_fade_in = true;
+  }
+
+  // a jump from a command lands at its offset: the old head plays on until
+  // then and fades out after it, the new head starts there and fades in
+  uint16_t split = 0;
+  if (do_crossfade && !do_fade_in && !do_fade_out) {
+    split = phase_new_offset;
+    if (split > buffer->max_sample_count - SPLIT_FADE_MIN) {
+      split = buffer->max_sample_count - SPLIT_FADE_MIN;
+    }
+  }
+  phase_new_offset = 0;
 
-  bool first_loop = true;
+  if (stretch) {
+    TimeStretch_setRatio(timestretch, sf->fx_param[FX_TIMESTRETCH][0]);
+  }
+
+  ShaperChain_beginBlock(shaperchain);
+  for (uint16_t i = 0; i < buffer->max_sample_count * 2; i++) {
+    samples[i] = 0;
+  }
+  PROFILER_MARK(PROFILER_OTHER);
   for (int8_t head = 1; head >= 0; head--) {
     if (head == 1 && (!do_crossfade || do_fade_in)) {
       continue;
     }
 
+    // the new head only covers the output after the split
+    uint16_t out_start = head == 0 ? split : 0;
+    uint32_t head_samples_to_read = samples_to_read;
+    if (out_start > 0) {
+      head_samples_to_read = samples_to_read *
+                             (buffer->max_sample_count - out_start) /
+                             buffer->max_sample_count;
+      if (head_samples_to_read < 2) {
+        head_samples_to_read = 2;
+      }
+    }
+    uint32_t head_values_len =
+        head_samples_to_read *
+        (banks[sel_bank_cur]->sample[sel_sample_cur].snd[sel_variation]
+             ->num_channels +
+         1);
+    uint32_t head_values_to_read = head_values_len * 2;
+    // the old head carries on from the last grain, the new head after a
+    // jump or a new file starts a fresh one. a new file may have other
+    // channels than the buffer was sized for, its first block fades in
+    // unstretched
+    const bool head_stretch = stretch && !(head == 0 && do_open_file);
+    if (stretch && head == 0 && (do_crossfade || do_fade_in || do_open_file)) {
+      TimeStretch_reset(timestretch);
+    }
+    const uint8_t frame_bytes =
+        (banks[sel_bank_cur]->sample[sel_sample_cur].snd[sel_variation]
+             ->num_channels +
+         1) *
+        2;
+    int32_t read_phase = phases[head];
+    uint32_t head_bytes_to_read = head_values_to_read;
+    int16_t *read_to = values;
+    int16_t *stretch_values = values;
+    if (head_stretch) {
+      // the window may already hold some of it
+      int32_t from =
+          ((phases[head] - TIMESTRETCH_BEFORE(!phase_forward) * frame_bytes) /
+           PHASE_DIVISOR) *
+          PHASE_DIVISOR;
+      uint32_t len = head_values_to_read + TIMESTRETCH_EXTRA * frame_bytes;
+      len = (len + PHASE_DIVISOR - 1) / PHASE_DIVISOR * PHASE_DIVISOR;
+      stretch_values =
+          TimeStretch_window(timestretch, values, from, len, &read_phase,
+                             &head_bytes_to_read, &read_to);
+    }
+
     if (head == 0 && do_open_file) {
       // setup the next
       sel_sample_cur = sel_sample_next;
@@ -347,9 +734,9 @@ void i2s_callback_func() {
       sd_card_total_time += (t1 - t0);
 #ifdef PRINT_SDCARD_TIMING
       if (do_open_file) {
-        MessageSync_printf(messagesync,
-                           "[audio_callback] do_open_file f_close+f_open: %d\n",
-                           (t1 - t0));
+        LogRing_printf(logring,
+                       "[audio_callback] do_open_file f_close+f_open: %d\n",
+                       (t1 - t0));
       }
 #endif
       if (fr != FR_OK) {
@@ -359,7 +746,7 @@ void i2s_callback_func() {
 
     // optimization here, only seek if the current position is not at the
     // phases[head]
-    if (phases[head] != last_seeked || do_open_file) {
+    if (read_phase != last_seeked || do_open_file) {
       t0 = time_us_32();
       if (f_lseek(&fil_current,
                   WAV_HEADER +
@@ -374,8 +761,8 @@ void i2s_callback_func() {
                             ->oversampling +
                         1) *
                        44100) +
-                      (phases[head] / PHASE_DIVISOR) * PHASE_DIVISOR)) {
-        printf("problem seeking to phase (%d)\n", phases[head]);
+                      (read_phase / PHASE_DIVISOR) * PHASE_DIVISOR)) {
+        LogRing_printf(logring, "problem seeking to phase (%d)\n", read_phase);
         for (uint16_t i = 0; i < buffer->max_sample_count; i++) {
           int32_t value0 = 0;
           samples[i * 2 + 0] = value0 + (value0 >> 16u);  // L
@@ -390,17 +777,21 @@ void i2s_callback_func() {
       t1 = time_us_32();
 #ifdef PRINT_SDCARD_TIMING
       if (do_open_file) {
-        MessageSync_printf(messagesync,
-                           "[audio_callback] do_open_file f_lseek: %d\n",
-                           (t1 - t0));
+        LogRing_printf(logring,
+                       "[audio_callback] do_open_file f_lseek: %d\n",
+                       (t1 - t0));
       }
 #endif
       sd_card_total_time += (t1 - t0);
     }
 
+    // opening and seeking both count as seek time
+    PROFILER_MARK(PROFILER_SD_SEEK);
     t0 = time_us_32();
-    if (f_read(&fil_current, values, values_to_read, &fil_bytes_read)) {
-      printf("ERROR READING!\n");
+    if (f_read(&fil_current, read_to, head_bytes_to_read, &fil_bytes_read)) {
+      LogRing_printf(logring, "ERROR READING!\n");
+      sd_read_retry = true;
+      TimeStretch_reset(timestretch);
       f_close(&fil_current);  // close and re-open trick
       char fname[100];
       sprintf(fname, "bank%d/%d.%d.wav", sel_bank_cur, sel_sample_cur,
@@ -418,267 +809,207 @@ void i2s_callback_func() {
                                       ->oversampling +
                                   1) *
                                  44100) +
-                                (phases[head] / PHASE_DIVISOR) * PHASE_DIVISOR);
+                                (read_phase / PHASE_DIVISOR) * PHASE_DIVISOR);
     }
     t1 = time_us_32();
     sd_card_total_time += (t1 - t0);
 #ifdef PRINT_SDCARD_TIMING
     if (do_open_file) {
-      MessageSync_printf(
-          messagesync, "[audio_callback] do_open_file f_read: %d\n", (t1 - t0));
+      LogRing_printf(logring, "[audio_callback] do_open_file f_read: %d\n",
+                     (t1 - t0));
     }
 #endif
-    last_seeked = phases[head] + fil_bytes_read;
-
-    if (fil_bytes_read < values_to_read) {
-      MessageSync_printf(messagesync,
-                         "%d %d: asked for %d bytes, read %d bytes\n",
-                         phases[head],
-                         WAV_HEADER +
-                             ((banks[sel_bank_cur]
-                                   ->sample[sel_sample_cur]
-                                   .snd[sel_variation]
-                                   ->num_channels +
-                               1) *
-                              (banks[sel_bank_cur]
-                                   ->sample[sel_sample_cur]
-                                   .snd[sel_variation]
-                                   ->oversampling +
-                               1) *
-                              44100) +
-                             phases[head],
-                         values_to_read, fil_bytes_read);
-    }
+    last_seeked = read_phase + fil_bytes_read;
+    PROFILER_MARK(PROFILER_SD_READ);
 
-    if (!phase_forward) {
-      // reverse audio
-      for (int i = 0; i < values_len / 2; i++) {
-        int16_t temp = values[i];
-        values[i] = values[values_len - i - 1];
-        values[values_len - i - 1] = temp;
-      }
-    }
-
-    // beat repeat
-    BeatRepeat_process(beatrepeat, values, values_len);
-
-    // saturate before resampling?
-    if (sf->fx_active[FX_SATURATE]) {
-      for (uint16_t i = 0; i < values_len; i++) {
-        values[i] = values[i] * sf->fx_param[FX_SATURATE][0] / 128;
-      }
-      Saturation_process(saturation, values, values_len);
+    if (fil_bytes_read < head_bytes_to_read) {
+      LogRing_printf(logring,
+                     "%d %d: asked for %d bytes, read %d bytes\n",
+                     read_phase,
+                     WAV_HEADER +
+                         ((banks[sel_bank_cur]
+                               ->sample[sel_sample_cur]
+                               .snd[sel_variation]
+                               ->num_channels +
+                           1) *
+                          (banks[sel_bank_cur]
+                               ->sample[sel_sample_cur]
+                               .snd[sel_variation]
+                               ->oversampling +
+                           1) *
+                          44100) +
+                         read_phase,
+                     head_bytes_to_read, fil_bytes_read);
     }
 
-    // shaper
-    if (sf->fx_active[FX_SHAPER]) {
-      if (sf->fx_param[FX_SHAPER][0] > 128) {
-        Shaper_expandUnder_compressOver_process(
-            values, values_len, sf->fx_param[FX_SHAPER][1] << 7);
-      } else {
-        Shaper_expandOver_compressUnder_process(
-            values, values_len, sf->fx_param[FX_SHAPER][1] << 7);
-      }
+    // pick the grain for the stretch, or play what was read
+    int16_t *grain = values;
+    if (head_stretch) {
+      grain = TimeStretch_process(
+          timestretch, stretch_values, values, head_samples_to_read,
+          banks[sel_bank_cur]->sample[sel_sample_cur].snd[sel_variation]
+                  ->num_channels == 1,
+          !phase_forward,
+          governor->level > GOVERNOR_FULL ? TIMESTRETCH_SEARCH / 2
+                                          : TIMESTRETCH_SEARCH);
     }
 
-    if (sf->fx_active[FX_FUZZ]) {
-      Fuzz_process(values, values_len, sf->fx_param[FX_FUZZ][0],
-                   sf->fx_param[FX_FUZZ][1]);
-    }
+    // saturate, shaper, fuzz and bitcrush (before resampling)
+    ShaperChain_process(shaperchain, grain, head_values_len,
+                        audio_fx_active[FX_BITCRUSH],
+                        sf->fx_param[FX_BITCRUSH][0],
+                        sf->fx_param[FX_BITCRUSH][1]);
 
-    // bitcrush
-    if (sf->fx_active[FX_BITCRUSH]) {
-      Bitcrush_process(values, values_len, sf->fx_param[FX_BITCRUSH][0],
-                       sf->fx_param[FX_BITCRUSH][1]);
-    }
+    PROFILER_MARK(PROFILER_FX);
 
-    if (banks[sel_bank_cur]
-            ->sample[sel_sample_cur]
-            .snd[sel_variation]
-            ->num_channels == 0) {
-      // mono
-      int16_t *newArray;
-      // TODO: use a function pointer that will change the function
-      if (quadratic_resampling) {
-        newArray = array_resample_quadratic_fp(values, samples_to_read,
-                                               buffer->max_sample_count);
-      } else {
-        newArray = array_resample_linear(values, samples_to_read,
-                                         buffer->max_sample_count);
+    // pick the fade for this head
+    const int32_t *fade = NULL;
+    if (split > 0) {
+      Render_fade(split_fade, buffer->max_sample_count - out_start,
+                  head == 1 ? split : 0,
+                  head == 1 ? block_fade_out : block_fade_in,
+                  buffer->max_sample_count);
+      fade = split_fade;
+    } else if (do_crossfade) {
+      if (head == 0 && !do_fade_out) {
+        fade = block_fade_in;
+      } else if (!do_fade_in) {
+        fade = block_fade_out;
       }
+    } else if (do_fade_out) {
+      fade = block_fade_out;
+    } else if (do_fade_in) {
+      fade = block_fade_in;
+    }
 
-      for (uint16_t i = 0; i < buffer->max_sample_count; i++) {
-        if (do_crossfade && !do_fade_in) {
-          if (head == 0) {
-            newArray[i] = crossfade3_in(newArray[i], i, CROSSFADE3_COS);
-          } else {
-            newArray[i] = crossfade3_out(newArray[i], i, CROSSFADE3_COS);
-          }
-        } else if (do_fade_out) {
-          // if (i == 0) {
-          //   printf("[audio_callback] do_fade_out head: %d\n", head);
-          // }
-          newArray[i] = crossfade3_out(newArray[i], i, CROSSFADE3_COS);
-        } else if (do_fade_in) {
-          // if (i == 0) {
-          //   printf("[audio_callback] do_fade_in head: %d\n", head);
-          // }
-          newArray[i] = crossfade3_in(newArray[i], i, CROSSFADE3_COS);
-        }
-
-        if (first_loop) {
-          samples[i * 2 + 0] = newArray[i];
-          if (head == 0) {
-            samples[i * 2 + 0] = (vol_main * samples[i * 2 + 0]) << 8u;
-            samples[i * 2 + 0] += (samples[i * 2 + 0] >> 16u);
-            samples[i * 2 + 1] = samples[i * 2 + 0];  // R = L
-          }
-        } else {
-          samples[i * 2 + 0] += newArray[i];
-          samples[i * 2 + 0] = (vol_main * samples[i * 2 + 0]) << 8u;
-          samples[i * 2 + 0] += (samples[i * 2 + 0] >> 16u);
-          samples[i * 2 + 1] = samples[i * 2 + 0];  // R = L
-        }
-        // int32_t value0 = (vol * newArray[i]) << 8u;
-        // samples[i * 2 + 0] =
-        //     samples[i * 2 + 0] + value0 + (value0 >> 16u);  // L
-      }
-      if (first_loop) {
-        first_loop = false;
-      }
-      free(newArray);
-    } else if (banks[sel_bank_cur]
-                   ->sample[sel_sample_cur]
-                   .snd[sel_variation]
-                   ->num_channels == 1) {
-      // stereo
-      for (uint8_t channel = 0; channel < 2; channel++) {
-        int16_t valuesC[samples_to_read];  // max limit
-        for (uint16_t i = 0; i < values_len; i++) {
-          if (i % 2 == channel) {
-            valuesC[i / 2] = values[i];
-          }
-        }
-
-        int16_t *newArray;
-        if (quadratic_resampling) {
-          newArray = array_resample_quadratic_fp(valuesC, samples_to_read,
-                                                 buffer->max_sample_count);
-        } else {
-          newArray = array_resample_linear(valuesC, samples_to_read,
-                                           buffer->max_sample_count);
-        }
-
-        // TODO: function pointer for audio block here?
-        for (uint16_t i = 0; i < buffer->max_sample_count; i++) {
-          if (first_loop) {
-            samples[i * 2 + channel] = 0;
-          }
-
-          if (do_crossfade) {
-            if (head == 0 && !do_fade_out) {
-              newArray[i] = crossfade3_in(newArray[i], i, CROSSFADE3_COS);
-            } else if (!do_fade_in) {
-              newArray[i] = crossfade3_out(newArray[i], i, CROSSFADE3_COS);
-            }
-          } else if (do_fade_out) {
-            newArray[i] = crossfade3_out(newArray[i], i, CROSSFADE3_COS);
-          } else if (do_fade_in) {
-            newArray[i] = crossfade3_in(newArray[i], i, CROSSFADE3_COS);
-          }
+    // resample, fade and mix into the output
+    Render_select(banks[sel_bank_cur]
+                          ->sample[sel_sample_cur]
+                          .snd[sel_variation]
+                          ->num_channels == 1,
+                  quadratic_resampling && governor->level < GOVERNOR_LINEAR,
+                  !phase_forward, fade != NULL)(
+        samples + out_start * 2, grain, head_samples_to_read,
+        buffer->max_sample_count - out_start, fade, vol_main);
+    PROFILER_MARK(PROFILER_RESAMPLE);
 
-          int32_t value0 = (vol_main * newArray[i]) << 8u;
-          samples[i * 2 + channel] += value0 + (value0 >> 16u);
-        }
-        free(newArray);
-      }
-      first_loop = false;
+    if (head_stretch) {
+      phases[head] +=
+          TimeStretch_advance(timestretch, head_samples_to_read) *
+          frame_bytes * (phase_forward * 2 - 1);
+    } else {
+      phases[head] += (head_values_to_read * (phase_forward * 2 - 1));
     }
-
-    phases[head] += (values_to_read * (phase_forward * 2 - 1));
   }
+  ShaperChain_endBlock(shaperchain);
+  EnvelopeTable_process(envelope_volume, samples, buffer->max_sample_count);
+  PROFILER_MARK(PROFILER_OTHER);
 
 // apply filter
 #ifdef INCLUDE_FILTER
-  for (uint16_t i = 0; i < buffer->max_sample_count; i++) {
-    for (uint8_t channel = 0; channel < 2; channel++) {
-      samples[i * 2 + channel] =
-          ResonantFilter_update(resFilter[channel], samples[i * 2 + channel]);
-      if (banks[sel_bank_cur]
-              ->sample[sel_sample_cur]
-              .snd[sel_variation]
-              ->num_channels == 2) {
-        samples[i * 2 + 1] = samples[i * 2 + 0];
-        break;
-      }
+  // a gliding or modulated cutoff moves once per control point, as the
+  // coefficients come from a table, and stays put for the block otherwise
+  const bool mod_cutoff = modulate && Modulation_active(modulation, MOD_CUTOFF);
+  const bool cutoff_moves = mod_cutoff || Smooth_moving(&filter_cutoff);
+  uint16_t filter_from = 0;
+  for (uint8_t k = 1; filter_from < buffer->max_sample_count; k++) {
+    uint16_t filter_to = buffer->max_sample_count;
+    if (cutoff_moves && filter_from + MOD_CONTROL_SAMPLES < filter_to) {
+      filter_to = filter_from + MOD_CONTROL_SAMPLES;
     }
-  }
-#endif
-
-  // apply other fx
-  // TODO: fade in/out these fx using the crossfade?
-  // TODO: LFO's move to main thread?
-  if (sf->fx_active[FX_TREMELO] || sf->fx_active[FX_PAN]) {
-    int32_t u;
-    int32_t v;
-    int32_t w;
-    if (sf->fx_active[FX_TREMELO]) {
-      u = q16_16_sin01(lfo_tremelo_val);
+    int32_t cutoff = Smooth_at(&filter_cutoff, filter_to) >> 16;
+    if (mod_cutoff) {
+      cutoff = Modulation_cutoff(modulation, k, cutoff, resonantfilter_fc_max);
     }
-    if (sf->fx_active[FX_PAN]) {
-      v = q16_16_sin01(lfo_pan_val);
-      w = Q16_16_1 - v;
+    for (uint8_t channel = 0; channel < 2; channel++) {
+      ResonantFilter_setFc(resFilter[channel], cutoff);
     }
-    for (uint16_t i = 0; i < buffer->max_sample_count; i++) {
-      for (uint8_t channel = 0; channel < 2; channel++) {
-        if (sf->fx_active[FX_TREMELO]) {
-          samples[i * 2 + channel] =
-              q16_16_multiply(samples[i * 2 + channel], u);
-        }
-        if (sf->fx_active[FX_PAN]) {
-          if (channel == 0) {
-            samples[i * 2 + channel] =
-                q16_16_multiply(samples[i * 2 + channel], v);
-          } else {
-            samples[i * 2 + channel] =
-                q16_16_multiply(samples[i * 2 + channel], w);
+    if (governor->level >= GOVERNOR_FILTER_MONO) {
+      // one filter on the mid signal for both channels
+      for (uint16_t i = filter_from; i < filter_to; i++) {
+        int32_t mid = (samples[i * 2 + 0] >> 1) + (samples[i * 2 + 1] >> 1);
+        samples[i * 2 + 0] = ResonantFilter_update(resFilter[0], mid);
+        samples[i * 2 + 1] = samples[i * 2 + 0];
+      }
+    } else {
+      for (uint16_t i = filter_from; i < filter_to; i++) {
+        for (uint8_t channel = 0; channel < 2; channel++) {
+          samples[i * 2 + channel] = ResonantFilter_update(
+              resFilter[channel], samples[i * 2 + channel]);
+          if (banks[sel_bank_cur]
+                  ->sample[sel_sample_cur]
+                  .snd[sel_variation]
+                  ->num_channels == 2) {
+            samples[i * 2 + 1] = samples[i * 2 + 0];
+            break;
           }
         }
       }
     }
+    filter_from = filter_to;
   }
+#endif
+
+  PROFILER_MARK(PROFILER_FILTER);
+
+  // beat repeat on the output, so its lengths do not change with the pitch
+  BeatRepeat_setDecay(beatrepeat, sf->fx_param[FX_BEATREPEAT][1]);
+  BeatRepeat_process(beatrepeat, samples, buffer->max_sample_count);
+  PROFILER_MARK(PROFILER_FX);
+
+  // tremolo, pan and any other routes to the volume and the pan
+  if (modulate) {
+    Modulation_process(modulation, samples, buffer->max_sample_count);
+  }
+
+  PROFILER_MARK(PROFILER_LFO);
 
   // apply delay
-  Delay_setFeedback(delay, 8 - linlin(sf->fx_param[FX_DELAY][0], 0, 240, 2, 8));
-  Delay_setLength(delay, sf->fx_param[FX_DELAY][1]);
-  Delay_process(delay, samples, buffer->max_sample_count, 0);
+  if (Delay_setFeedback(delay,
+                        8 - linlin(sf->fx_param[FX_DELAY][0], 0, 240, 2, 8))) {
+    LogRing_printf(logring, "[delay] feedback %d\n", delay->feedback);
+  }
+  if (Delay_setLength(delay, sf->fx_param[FX_DELAY][1], sf->bpm_tempo)) {
+    LogRing_printf(logring, "[delay] duration %d\n", delay->duration);
+  }
+  Delay_process(delay, samples, buffer->max_sample_count);
+
+  // apply reverb, at half rate as soon as the governor sheds anything
+  Reverb_setHalfRate(reverb, governor->level > GOVERNOR_FULL);
+  Reverb_set(reverb, sf->fx_param[FX_REVERB][0], sf->fx_param[FX_REVERB][1],
+             sf->fx_param[FX_REVERB][2]);
+  Reverb_process(reverb, samples, buffer->max_sample_count);
+  PROFILER_MARK(PROFILER_DELAY);
 
 #ifdef INCLUDE_SINEBASS
   // apply bass
-  for (uint16_t i = 0; i < buffer->max_sample_count; i++) {
-    int32_t v = WaveBass_next(wavebass);
-    samples[i * 2 + 0] += v;
-    samples[i * 2 + 1] += v;
-  }
+  WaveBass_render(wavebass, samples, buffer->max_sample_count);
 #endif
 
   if (clock_out_do) {
+    // a one block long pulse starting on the sample of the tick
+    uint16_t clock_out_start = 0;
     if (clock_out_ready) {
       clock_out_ready = false;
-      for (uint16_t i = 0; i < buffer->max_sample_count; i++) {
+      clock_out_start = clock_out_offset;
+      clock_out_remaining = buffer->max_sample_count;
+    }
+    for (uint16_t i = 0; i < buffer->max_sample_count; i++) {
+      if (i >= clock_out_start && clock_out_remaining > 0) {
         samples[i * 2 + 0] = 2147483645;
-      }
-    } else {
-      for (uint16_t i = 0; i < buffer->max_sample_count; i++) {
+        clock_out_remaining--;
+      } else {
         samples[i * 2 + 0] = 0;
       }
     }
   }
 
   buffer->sample_count = buffer->max_sample_count;
+  PROFILER_MARK(PROFILER_OTHER);
   t0 = time_us_32();
   give_audio_buffer(ap, buffer);
   give_audio_buffer_time = (time_us_32() - t0);
+  PROFILER_MARK(PROFILER_GIVE_BUFFER);
 
   if (do_fade_out) {
     if (!do_open_file_ready) {
@@ -696,6 +1027,10 @@ void i2s_callback_func() {
   clock_t endTime = time_us_64();
   cpu_utilizations[cpu_utilizations_i] =
       100 * (endTime - startTime) / (US_PER_BLOCK);
+  uint8_t governor_level = governor->level;
+  if (Governor_update(governor, cpu_utilizations[cpu_utilizations_i])) {
+    audio_governor_changed(governor_level);
+  }
   cpu_utilizations_i++;
 
   if (cpu_utilizations_i == 64 || sd_card_total_time > 9000 || do_open_file) {
@@ -704,23 +1039,25 @@ void i2s_callback_func() {
       cpu_utilization = cpu_utilization + cpu_utilizations[i];
     }
 #ifdef PRINT_AUDIO_CPU_USAGE
-    MessageSync_printf(messagesync, "average cpu utilization: %2.1f\n",
-                       ((float)cpu_utilization) / (float)cpu_utilizations_i);
+    LogRing_printf(logring, "average cpu utilization: %2.1f\n",
+                   ((float)cpu_utilization) / (float)cpu_utilizations_i);
 
 #endif
 #ifdef PRINT_MEMORY_USAGE
     uint32_t total_heap = getTotalHeap();
     uint32_t used_heap = total_heap - getFreeHeap();
-    MessageSync_printf(messagesync, "memory usage: %2.1f%% (%ld/%ld)\n",
-                       (float)(used_heap) / (float)(total_heap)*100.0,
-                       used_heap, total_heap);
+    LogRing_printf(logring, "memory usage: %2.1f%% (%ld/%ld)\n",
+                   (float)(used_heap) / (float)(total_heap)*100.0,
+                   used_heap, total_heap);
 #endif
     cpu_utilizations_i = 0;
 #ifdef PRINT_SDCARD_TIMING
-    MessageSync_printf(messagesync, "sdcard%2.1f %ld %d %d %ld\n",
-                       ((float)cpu_utilization) / 64.0, sd_card_total_time,
-                       values_to_read, give_audio_buffer_time,
-                       take_audio_buffer_time);
+    // host/sdmodel.h weights the lines of blocks that opened a file by the
+    // trailing open
+    LogRing_printf(logring, "sdcard%2.1f %ld %d %d %ld%s\n",
+                   ((float)cpu_utilization) / 64.0, sd_card_total_time,
+                   values_to_read, give_audio_buffer_time,
+                   take_audio_buffer_time, do_open_file ? " open" : "");
 #endif
   }
   if (cpu_usage_flag == cpu_usage_flag_limit) {
@@ -729,26 +1066,34 @@ void i2s_callback_func() {
   } else {
     if (cpu_utilizations[cpu_utilizations_i] > cpu_usage_limit_threshold) {
 #ifdef PRINT_SDCARD_TIMING
-      MessageSync_printf(messagesync, "sdcard%d %ld %d %d %ld\n",
-                         cpu_utilizations[cpu_utilizations_i],
-                         sd_card_total_time, values_to_read,
-                         give_audio_buffer_time, take_audio_buffer_time);
+      LogRing_printf(logring, "sdcard%d %ld %d %d %ld\n",
+                     cpu_utilizations[cpu_utilizations_i],
+                     sd_card_total_time, values_to_read,
+                     give_audio_buffer_time, take_audio_buffer_time);
 #endif
       cpu_usage_flag++;
       cpu_usage_flag_total++;
 #ifdef PRINT_AUDIO_OVERLOADS
       if (cpu_usage_flag_total > 0) {
         clock_t currentTime = time_us_64();
-        MessageSync_printf(messagesync, "cpu overloads every: %d ms\n",
-                           (currentTime - time_of_initialization) / 1000 /
-                               cpu_usage_flag_total);
+        LogRing_printf(logring, "cpu overloads every: %d ms\n",
+                       (currentTime - time_of_initialization) / 1000 /
+                           cpu_usage_flag_total);
       }
 #endif
       if (cpu_flag_counter == 0) {
         cpu_flag_counter = BLOCKS_PER_SECOND;
       }
-      MessageSync_printf(messagesync, "cpu utilization: %d, flag: %d\n",
-                         cpu_utilizations[cpu_utilizations_i], cpu_usage_flag);
+      LogRing_printf(logring, "cpu utilization: %d, flag: %d\n",
+                     cpu_utilizations[cpu_utilizations_i], cpu_usage_flag);
+      // step the quality down before resorting to muting
+      if (cpu_usage_flag == cpu_usage_flag_limit) {
+        governor_level = governor->level;
+        if (Governor_shed(governor)) {
+          audio_governor_changed(governor_level);
+          cpu_usage_flag = 0;
+        }
+      }
     } else {
       if (cpu_flag_counter > 0) {
         cpu_flag_counter--;
@@ -758,6 +1103,49 @@ void i2s_callback_func() {
     }
   }
 
-  MessageSync_lockIfNotEmpty(messagesync);
+  PROFILER_BLOCK_END();
+#ifdef INCLUDE_FLIGHTRECORDER
+  FlightRecord *flight = FlightRecorder_next(flightrecorder);
+  if (flight != NULL) {
+    flight->phase = phases[0];
+    flight->fx_active = audio_fx_state;
+    flight->total_us = endTime - startTime;
+    flight->sd_us = sd_card_total_time > 0xFFFF ? 0xFFFF : sd_card_total_time;
+    flight->take_us = take_audio_buffer_time;
+    flight->give_us = give_audio_buffer_time;
+    flight->values_to_read = values_to_read;
+    flight->flags =
+        (banks[sel_bank_cur]->sample[sel_sample_cur].snd[sel_variation]
+                 ->num_channels == 1
+             ? FLIGHTRECORD_STEREO
+             : 0) |
+        (phase_forward ? 0 : FLIGHTRECORD_REVERSE) |
+        (do_crossfade ? FLIGHTRECORD_CROSSFADE : 0) |
+        (do_fade_in ? FLIGHTRECORD_FADE_IN : 0) |
+        (do_fade_out ? FLIGHTRECORD_FADE_OUT : 0) |
+        (do_open_file ? FLIGHTRECORD_OPEN_FILE : 0) |
+        (fil_is_open ? FLIGHTRECORD_FILE_OPEN : 0) |
+        (quadratic_resampling && governor->level < GOVERNOR_LINEAR
+             ? FLIGHTRECORD_QUADRATIC
+             : 0) |
+        (sd_read_retry ? FLIGHTRECORD_SD_RETRY : 0);
+    flight->bank = sel_bank_cur;
+    flight->sample = sel_sample_cur;
+    flight->variation = sel_variation;
+    flight->retrig_pitch = audio_retrig_pitch;
+    flight->pitch_val_index = pitch_val_index;
+    flight->envelope_pitch = envelope_pitch_val * 100;
+    flight->bpm = sf->bpm_tempo;
+#ifdef INCLUDE_PROFILER
+    FlightRecorder_stages(flight, profiler);
+#else
+    memset(flight->stage_us, 0, sizeof(flight->stage_us));
+#endif
+    FlightRecorder_commit(flightrecorder, US_PER_BLOCK);
+  }
+#endif
+#ifdef INCLUDE_CLOCK_GOVERNOR
+  audio_clock_update(endTime - startTime, false);
+#endif
   return;
 }
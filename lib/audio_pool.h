@@ -31,11 +31,44 @@
 // sd-card reading of 330 samples (~7.5 ms) takes ~3.1 ms
 // SO ~3-4 ms is spent every block on reading
 // which means whatever is left is all that is left for processing
+//
+// the block size and buffer count are set in the compile definitions.
+// latency is the queued buffers plus the one being filled, sd read is
+// interpolated from the timings above (the profiler gives the real split):
+//
+// samples  buffers  block    latency  sd read  left for processing
+//      64        3   1.5 ms    5.8 ms  ~2.9 ms  none, sd read overruns
+//     128        3   2.9 ms   11.6 ms  ~2.9 ms  none, sd read overruns
+//     256        3   5.8 ms   23.2 ms  ~3.0 ms  ~2.8 ms (48%)
+//     441        3  10.0 ms   40.0 ms  ~3.4 ms  ~6.6 ms (66%)
+//     256        2   5.8 ms   17.4 ms  ~3.0 ms  ~2.8 ms, no slack for
+//                                               a slow sd read
+//
+// so 64 and 128 only work for sources that do not stream from the card
+#ifndef SAMPLES_PER_BUFFER
 #define SAMPLES_PER_BUFFER 441  // Samples / channel
+#endif
+#if SAMPLES_PER_BUFFER != 64 && SAMPLES_PER_BUFFER != 128 && \
+    SAMPLES_PER_BUFFER != 256 && SAMPLES_PER_BUFFER != 441
+#error "SAMPLES_PER_BUFFER must be 64, 128, 256 or 441"
+#endif
+#ifndef AUDIO_BUFFER_COUNT
+#define AUDIO_BUFFER_COUNT 3
+#endif
 
 #define US_PER_BLOCK 1000000 * SAMPLES_PER_BUFFER / SAMPLE_RATE
 
+// crossfades across a whole block, stretched from the crossfade3 tables at
+// boot so they fit any block size
+int32_t block_fade_in[SAMPLES_PER_BUFFER];
+int32_t block_fade_out[SAMPLES_PER_BUFFER];
+
 audio_buffer_pool_t *init_audio() {
+  Render_fade(block_fade_in, SAMPLES_PER_BUFFER, 0, crossfade3_cos_in,
+              CROSSFADE3_LIMIT);
+  Render_fade(block_fade_out, SAMPLES_PER_BUFFER, 0, crossfade3_cos_out,
+              CROSSFADE3_LIMIT);
+
   static audio_format_t audio_format = {.pcm_format = AUDIO_PCM_FORMAT_S32,
                                         .sample_freq = SAMPLE_RATE,
                                         .channel_count = 2};
@@ -44,8 +77,8 @@ audio_buffer_pool_t *init_audio() {
                                                   .sample_stride = 8};
 
   audio_buffer_pool_t *producer_pool =
-      audio_new_producer_pool(&producer_format, 3,
-                              SAMPLES_PER_BUFFER);  // todo correct size
+      audio_new_producer_pool(&producer_format, AUDIO_BUFFER_COUNT,
+                              SAMPLES_PER_BUFFER);
   bool __unused ok;
   const audio_format_t *output_format;
   audio_i2s_config_t config = {.data_pin = PICO_AUDIO_I2S_DATA_PIN,
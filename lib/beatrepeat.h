@@ -24,144 +24,322 @@
 
 #ifndef BEATREPEAT_LIB
 #define BEATREPEAT_LIB 1
-#define BEATREPEAT_RINGBUFFER_SIZE 22050
-#define BEATREPEAT_ZEROCROSSING_SIZE 1000
+// stereo frames captured, a quarter second. the capture comes from the fx
+// pool, which may give less, down to the min.
+#define BEATREPEAT_RINGBUFFER_SIZE 11025
+#define BEATREPEAT_RINGBUFFER_MIN 2048
+// one zero crossing is kept for every 64 frames of the ring
+#define BEATREPEAT_BUCKET_SHIFT 6
+#define BEATREPEAT_BUCKET_MASK ((1 << BEATREPEAT_BUCKET_SHIFT) - 1)
+#define BEATREPEAT_BUCKETS \
+  ((BEATREPEAT_RINGBUFFER_SIZE >> BEATREPEAT_BUCKET_SHIFT) + 1)
+// a repeat ends on the last zero crossing if there was one this recently
+#define BEATREPEAT_END_MAX 512
+#define BEATREPEAT_DIVISIONS 5
+// the pitch decays to at most two octaves down
+#define BEATREPEAT_STEP_MIN (Q16_16_1 / 4)
 #include "fixedpoint.h"
+#include "fxpool.h"
+#include "ramfunc.h"
 //
 #include "crossfade3.h"
 #include "stdbool.h"
 
+// note lengths in 16ths of a beat, 1/64 to 1/4
+const uint8_t beatrepeat_divisions[BEATREPEAT_DIVISIONS] = {1, 2, 4, 8, 16};
+
+// BeatRepeat captures the output stream, after resampling, and loops a
+// piece of it. it only captures while switched on, so a repeat waits until
+// its length has been captured, and the capture is paused while repeating.
+// every repeat can play a little slower than the one before, for a falling
+// pitch.
 typedef struct BeatRepeat {
-  // buffer for holding original samples
-  int16_t ringbuffer[BEATREPEAT_RINGBUFFER_SIZE];
-  int16_t ringbuffer_index;
+  FxPool *pool;
+  // captured frames, interleaved and as the top 16 bits of the samples,
+  // NULL while switched off
+  int16_t *ringbuffer;
+  uint16_t ringbuffer_size;
+  uint16_t ringbuffer_index;
+  bool on;
+  // the latest upward zero crossing of the mid signal in each 64 frames of
+  // the ring, -1 when there is none
+  int16_t zerocrossings[BEATREPEAT_BUCKETS];
+  int16_t last_zerocrossing;
+  int32_t last;
+  // frames captured, up to the ring size, and a repeat waiting for enough
+  uint16_t captured;
+  uint16_t pending;
   // repeat state
-  int16_t repeat_start;
-  int16_t repeat_end;
-  int16_t repeat_index;
+  bool repeating;
+  uint16_t repeat_start;
+  uint16_t repeat_length;
+  // q16.16 frames into the repeat, and frames per output sample
+  uint32_t repeat_phase;
+  uint32_t repeat_step;
+  // q16.16 factor on the step after each repeat
+  int32_t decay;
   // crossfading repeats
   int16_t crossfade_in;
   int16_t crossfade_out;
-  // zerocrossings for selecting best repeat
-  int16_t zerocrossings[BEATREPEAT_ZEROCROSSING_SIZE];
-  int16_t zerocrossings_index;
-  int16_t last;
 } BeatRepeat;
 
-BeatRepeat *BeatRepeat_malloc() {
+BeatRepeat *BeatRepeat_malloc(FxPool *pool) {
   BeatRepeat *self = (BeatRepeat *)malloc(sizeof(BeatRepeat));
+  self->pool = pool;
+  self->ringbuffer = NULL;
+  self->ringbuffer_size = 0;
   self->ringbuffer_index = 0;
-  for (int i = 0; i < BEATREPEAT_RINGBUFFER_SIZE; i++) {
-    self->ringbuffer[i] = 0;
-  }
-  self->repeat_start = -1;
-  self->repeat_end = -1;
-  self->repeat_index = 0;
+  self->on = false;
+  self->last_zerocrossing = -1;
+  self->last = 0;
+  self->captured = 0;
+  self->pending = 0;
+  self->repeating = false;
+  self->repeat_start = 0;
+  self->repeat_length = 0;
+  self->repeat_phase = 0;
+  self->repeat_step = Q16_16_1;
+  self->decay = Q16_16_1;
   self->crossfade_in = CROSSFADE3_LIMIT;
   self->crossfade_out = CROSSFADE3_LIMIT;
+  FxPool_register(pool, "beatrepeat",
+                  BEATREPEAT_RINGBUFFER_SIZE * 2 * sizeof(int16_t),
+                  BEATREPEAT_RINGBUFFER_MIN * 2 * sizeof(int16_t));
+  return self;
+}
 
-  self->zerocrossings_index = 0;
-  for (int i = 0; i < BEATREPEAT_ZEROCROSSING_SIZE; i++) {
-    self->zerocrossings[i] = -1;
+// samples in a note division at bpm, length 0-255 goes from 1/64 to 1/4.
+// the knob is spread over the divisions that fit the ring at this tempo, so
+// every position it stops at is a different length. below the tempo where
+// even 1/64 fits, 1/64 is halved until it does.
+uint16_t BeatRepeat_length(uint8_t length, uint16_t bpm) {
+  if (bpm == 0) {
+    return 0;
   }
-  return self;
+  // 44100 * 60 / 16 samples in a 16th of a beat at 1 bpm
+  uint8_t fit = 0;
+  while (fit < BEATREPEAT_DIVISIONS &&
+         beatrepeat_divisions[fit] * 165375 / bpm <
+             BEATREPEAT_RINGBUFFER_SIZE - BEATREPEAT_END_MAX) {
+    fit++;
+  }
+  if (fit == 0) {
+    uint32_t num_samples = beatrepeat_divisions[0] * 165375 / bpm;
+    while (num_samples >= BEATREPEAT_RINGBUFFER_SIZE - BEATREPEAT_END_MAX) {
+      num_samples >>= 1;
+    }
+    return num_samples;
+  }
+  return beatrepeat_divisions[(length * fit) >> 8] * 165375 / bpm;
 }
 
-void BeatRepeat_process(BeatRepeat *self, int16_t *samples,
-                        int16_t num_samples) {
-  for (int ii = 0; ii < num_samples; ii++) {
-    int16_t sample = samples[ii];
-    // do beat repeat
-    if (self->repeat_start > -1 && self->repeat_end > -1) {
-      int16_t sample2 = self->ringbuffer[self->repeat_index];
-      if (self->crossfade_in < CROSSFADE3_LIMIT) {
-        sample = q16_16_fp_to_int16(
-            q16_16_multiply(crossfade3_line[self->crossfade_in],
-                            q16_16_int16_to_fp(sample)) +
-            q16_16_multiply(Q16_16_1 - crossfade3_line[self->crossfade_in],
-                            q16_16_int16_to_fp(sample2)));
-        self->crossfade_in++;
-      } else if (self->crossfade_out < CROSSFADE3_LIMIT) {
-        sample = q16_16_fp_to_int16(
-            q16_16_multiply(Q16_16_1 - crossfade3_line[self->crossfade_out],
-                            q16_16_int16_to_fp(sample)) +
-            q16_16_multiply(crossfade3_line[self->crossfade_out],
-                            q16_16_int16_to_fp(sample2)));
-        self->crossfade_out++;
-        if (self->crossfade_out == CROSSFADE3_LIMIT) {
-          self->repeat_start = -1;
-          self->repeat_end = -1;
-          self->crossfade_in = CROSSFADE3_LIMIT;
-          self->crossfade_out = CROSSFADE3_LIMIT;
-        }
-      } else {
-        sample = sample2;
+// decay 0-255 slows each repeat by up to a quarter
+void BeatRepeat_setDecay(BeatRepeat *self, uint8_t decay) {
+  self->decay = Q16_16_1 - (decay << 6);
+}
+
+static inline void BeatRepeat_capture(BeatRepeat *self, int32_t *frame) {
+  uint16_t i = self->ringbuffer_index;
+  // the bucket is about to be overwritten
+  if ((i & BEATREPEAT_BUCKET_MASK) == 0) {
+    self->zerocrossings[i >> BEATREPEAT_BUCKET_SHIFT] = -1;
+  }
+  int16_t l = frame[0] >> 16;
+  int16_t r = frame[1] >> 16;
+  int32_t mid = l + r;
+  if (self->last < 0 && mid >= 0) {
+    self->zerocrossings[i >> BEATREPEAT_BUCKET_SHIFT] = i;
+    self->last_zerocrossing = i;
+  }
+  self->last = mid;
+  self->ringbuffer[i * 2 + 0] = l;
+  self->ringbuffer[i * 2 + 1] = r;
+  i++;
+  if (i == self->ringbuffer_size) {
+    i = 0;
+  }
+  self->ringbuffer_index = i;
+  if (self->captured < self->ringbuffer_size) {
+    self->captured++;
+  }
+}
+
+// the repeat at its phase, interpolated when the pitch has decayed
+static inline void BeatRepeat_read(BeatRepeat *self, int32_t *out) {
+  uint32_t p0 = self->repeat_start + (self->repeat_phase >> 16);
+  if (p0 >= self->ringbuffer_size) {
+    p0 -= self->ringbuffer_size;
+  }
+  uint32_t p1 = p0 + 1;
+  if (p1 == self->ringbuffer_size) {
+    p1 = 0;
+  }
+  int32_t frac = (self->repeat_phase & 0xFFFF) >> 1;
+  for (uint8_t c = 0; c < 2; c++) {
+    int32_t a = self->ringbuffer[p0 * 2 + c];
+    int32_t b = self->ringbuffer[p1 * 2 + c];
+    out[c] = (a + (((b - a) * frac) >> 15)) << 16;
+  }
+  self->repeat_phase += self->repeat_step;
+  if (self->repeat_phase >= ((uint32_t)self->repeat_length << 16)) {
+    self->repeat_phase -= (uint32_t)self->repeat_length << 16;
+    self->repeat_step = q16_16_multiply(self->repeat_step, self->decay);
+    if (self->repeat_step < BEATREPEAT_STEP_MIN) {
+      self->repeat_step = BEATREPEAT_STEP_MIN;
+    }
+  }
+}
+
+void BeatRepeat_repeat(BeatRepeat *self, uint16_t num_samples);
+
+// gives the capture back to the pool
+void BeatRepeat_release(BeatRepeat *self) {
+  if (self->ringbuffer != NULL) {
+    FxPool_release(self->pool, self->ringbuffer);
+    self->ringbuffer = NULL;
+  }
+}
+
+// samples are the interleaved stereo output block
+void RAM_FUNC(BeatRepeat_process)(BeatRepeat *self, int32_t *samples,
+                                  uint16_t num_samples) {
+  if (self->ringbuffer == NULL) {
+    return;
+  }
+  for (uint16_t ii = 0; ii < num_samples; ii++) {
+    int32_t *frame = samples + ii * 2;
+    if (!self->repeating) {
+      BeatRepeat_capture(self, frame);
+      if (self->pending > 0 &&
+          self->captured >= self->pending + BEATREPEAT_END_MAX) {
+        BeatRepeat_repeat(self, self->pending);
       }
-      self->repeat_index++;
-      if (self->repeat_index == self->repeat_end) {
-        self->repeat_index = self->repeat_start;
-      } else if (self->repeat_index > BEATREPEAT_RINGBUFFER_SIZE) {
-        self->repeat_index = 0;
+      continue;
+    }
+    int32_t repeat[2];
+    BeatRepeat_read(self, repeat);
+    if (self->crossfade_in < CROSSFADE3_LIMIT) {
+      int32_t fade = crossfade3_line[self->crossfade_in];
+      for (uint8_t c = 0; c < 2; c++) {
+        frame[c] = q16_16_multiply(fade, frame[c]) +
+                   q16_16_multiply(Q16_16_1 - fade, repeat[c]);
       }
-      samples[ii] = sample;
-    } else {
-      // do zerocrossing detection
-      if (self->last < 0 && sample >= 0) {
-        self->zerocrossings[self->zerocrossings_index] = self->ringbuffer_index;
-        self->zerocrossings_index++;
-        if (self->zerocrossings_index >= BEATREPEAT_ZEROCROSSING_SIZE) {
-          self->zerocrossings_index = 0;
-        }
+      self->crossfade_in++;
+    } else if (self->crossfade_out < CROSSFADE3_LIMIT) {
+      int32_t fade = crossfade3_line[self->crossfade_out];
+      for (uint8_t c = 0; c < 2; c++) {
+        frame[c] = q16_16_multiply(Q16_16_1 - fade, frame[c]) +
+                   q16_16_multiply(fade, repeat[c]);
       }
-      self->ringbuffer[self->ringbuffer_index] = sample;
-      self->ringbuffer_index++;
-      if (self->ringbuffer_index >= BEATREPEAT_RINGBUFFER_SIZE) {
-        self->ringbuffer_index = 0;
+      self->crossfade_out++;
+      if (self->crossfade_out == CROSSFADE3_LIMIT) {
+        self->repeating = false;
+        // faded out
+        if (!self->on) {
+          BeatRepeat_release(self);
+          return;
+        }
       }
-      self->last = sample;
+    } else {
+      frame[0] = repeat[0];
+      frame[1] = repeat[1];
     }
   }
 }
 
-void BeatRepeat_repeat(BeatRepeat *self, int16_t num_samples) {
-  fprintf(stderr, "repeat %d\n", num_samples);
+// repeats the last num_samples, or fades back to the input when 0. the
+// repeat runs between zero crossings near the requested length, looked up
+// from the bucket the start falls in. until that much has been captured the
+// repeat waits.
+void BeatRepeat_repeat(BeatRepeat *self, uint16_t num_samples) {
+  self->pending = 0;
   if (num_samples == 0) {
-    if (self->repeat_start > -1 && self->repeat_end > -1) {
+    if (self->repeating) {
       self->crossfade_in = CROSSFADE3_LIMIT;
       self->crossfade_out = 0;
     }
     return;
   }
-  if (self->zerocrossings_index < 2) {
+  if (self->ringbuffer == NULL) {
+    return;
+  }
+  while (num_samples >= self->ringbuffer_size - BEATREPEAT_END_MAX) {
+    num_samples >>= 1;
+  }
+  if (self->captured < num_samples + BEATREPEAT_END_MAX) {
+    self->pending = num_samples;
     return;
   }
+  int32_t end = self->ringbuffer_index;
+  if (self->last_zerocrossing > -1) {
+    int32_t age = end - self->last_zerocrossing;
+    if (age < 0) {
+      age += self->ringbuffer_size;
+    }
+    if (age < BEATREPEAT_END_MAX) {
+      end = self->last_zerocrossing;
+    }
+  }
+  int32_t start = end - num_samples;
+  if (start < 0) {
+    start += self->ringbuffer_size;
+  }
+  int16_t zerocrossing = self->zerocrossings[start >> BEATREPEAT_BUCKET_SHIFT];
+  if (zerocrossing > -1) {
+    start = zerocrossing;
+  }
+  int32_t length = end - start;
+  if (length <= 0) {
+    length += self->ringbuffer_size;
+  }
+  self->repeat_start = start;
+  self->repeat_length = length;
+  self->repeat_phase = 0;
+  self->repeat_step = Q16_16_1;
+  self->repeating = true;
   self->crossfade_in = 0;
   self->crossfade_out = CROSSFADE3_LIMIT;
+}
 
-  self->repeat_end = self->zerocrossings[self->zerocrossings_index - 1];
-  // find the first repeat_start that exceeds the requested num_samples
-  for (int j = 0; j < BEATREPEAT_ZEROCROSSING_SIZE; j++) {
-    int i = self->zerocrossings_index - j - 1;
-    if (i < 0) {
-      i += BEATREPEAT_ZEROCROSSING_SIZE;
-    }
-    if (self->zerocrossings[i] > -1) {
-      self->repeat_start = self->zerocrossings[i];
-      int16_t diff = self->repeat_end - self->repeat_start;
-      if (diff < 0) {
-        diff += BEATREPEAT_RINGBUFFER_SIZE;
-      }
-      if (diff > num_samples) {
-        break;
-      }
+// switching on takes a capture from the pool and returns false when not
+// even the smallest fits. switching off fades out a running repeat, the
+// capture goes back to the pool after.
+bool BeatRepeat_setActive(BeatRepeat *self, bool on) {
+  self->on = on;
+  if (!on) {
+    BeatRepeat_repeat(self, 0);
+    if (!self->repeating) {
+      BeatRepeat_release(self);
     }
+    return true;
   }
-  self->repeat_index = self->repeat_start;
-  fprintf(stderr, "repeating %d->%d (%d samples used, asked for %d)\n",
-          self->repeat_start, self->repeat_end,
-          self->repeat_end - self->repeat_start, num_samples);
+  if (self->ringbuffer != NULL) {
+    return true;
+  }
+  uint32_t granted;
+  self->ringbuffer = (int16_t *)FxPool_alloc(
+      self->pool, BEATREPEAT_RINGBUFFER_SIZE * 2 * sizeof(int16_t),
+      BEATREPEAT_RINGBUFFER_MIN * 2 * sizeof(int16_t), &granted);
+  if (self->ringbuffer == NULL) {
+    self->on = false;
+    return false;
+  }
+  self->ringbuffer_size = granted / (2 * sizeof(int16_t));
+  self->ringbuffer_index = 0;
+  for (int i = 0; i < BEATREPEAT_BUCKETS; i++) {
+    self->zerocrossings[i] = -1;
+  }
+  self->last_zerocrossing = -1;
+  self->last = 0;
+  self->captured = 0;
+  self->pending = 0;
+  self->repeating = false;
+  return true;
 }
 
-void BeatRepeat_free(BeatRepeat *self) { free(self); }
+void BeatRepeat_free(BeatRepeat *self) {
+  BeatRepeat_release(self);
+  free(self);
+}
 
 #endif /* BEATREPEAT_LIB */
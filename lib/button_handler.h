@@ -63,55 +63,49 @@ int8_t single_step_pressed() {
 }
 
 void go_retrigger_3key(uint8_t key1, uint8_t key2, uint8_t key3) {
-  debounce_quantize = 0;
-  retrig_first = true;
-  retrig_beat_num = key2 + 4;
-  retrig_timer_reset = 96 / key3;
-  float total_time = (float)(retrig_beat_num * retrig_timer_reset * 60) /
-                     (float)(96 * sf->bpm_tempo);
-  retrig_vol_step = 1.0 / ((float)retrig_beat_num);
+  uint8_t beat_num = key2 + 4;
+  uint16_t timer_reset = 96 / key3;
+  float total_time =
+      (float)(beat_num * timer_reset * 60) / (float)(96 * sf->bpm_tempo);
   printf("retrig_beat_num=%d,retrig_timer_reset=%d,total_time=%2.3fs\n",
-         retrig_beat_num, retrig_timer_reset, total_time);
-  retrig_ready = true;
+         beat_num, timer_reset, total_time);
+  retrig_send_start(beat_num, timer_reset);
 }
 
 void go_retrigger_2key(uint8_t key1, uint8_t key2) {
-  debounce_quantize = 0;
-  retrig_first = true;
-  retrig_beat_num = random_integer_in_range(8, 24);
-  retrig_timer_reset =
+  uint8_t beat_num = random_integer_in_range(8, 24);
+  uint16_t timer_reset =
       96 * random_integer_in_range(1, 6) / random_integer_in_range(2, 12);
-  float total_time = (float)(retrig_beat_num * retrig_timer_reset * 60) /
+  float total_time = (float)(beat_num * timer_reset * 60) /
                      (float)(96 * sf->bpm_tempo);
   if (total_time > 5.0f) {
     total_time = total_time / 2;
-    retrig_timer_reset = retrig_timer_reset / 2;
+    timer_reset = timer_reset / 2;
   }
   if (total_time > 5.0f) {
     total_time = total_time / 2;
-    retrig_beat_num = retrig_beat_num / 2;
-    if (retrig_beat_num == 0) {
-      retrig_beat_num = 1;
+    beat_num = beat_num / 2;
+    if (beat_num == 0) {
+      beat_num = 1;
     }
   }
   if (total_time < 0.5f) {
     total_time = total_time * 2;
-    retrig_beat_num = retrig_beat_num * 2;
-    if (retrig_beat_num == 0) {
-      retrig_beat_num = 1;
+    beat_num = beat_num * 2;
+    if (beat_num == 0) {
+      beat_num = 1;
     }
   }
   if (total_time < 0.5f) {
     total_time = total_time * 2;
-    retrig_beat_num = retrig_beat_num * 2;
-    if (retrig_beat_num == 0) {
-      retrig_beat_num = 1;
+    beat_num = beat_num * 2;
+    if (beat_num == 0) {
+      beat_num = 1;
     }
   }
-  retrig_vol_step = 1.0 / ((float)retrig_beat_num);
   // printf("retrig_beat_num=%d,retrig_timer_reset=%d,total_time=%2.3fs\n",
-  //        retrig_beat_num, retrig_timer_reset, total_time);
-  retrig_ready = true;
+  //        beat_num, timer_reset, total_time);
+  retrig_send_start(beat_num, timer_reset);
 }
 
 void go_update_top() {
@@ -131,99 +125,9 @@ void go_update_top() {
   }
 }
 
-// toggle the fx
+// toggle the fx, the audio core applies it at its next block
 void toggle_fx(uint8_t fx_num) {
-  sf->fx_active[fx_num] = !sf->fx_active[fx_num];
-  switch (fx_num) {
-    case FX_REVERSE:
-      phase_forward = !sf->fx_active[fx_num];
-      break;
-    case FX_SATURATE:
-      Saturation_setActive(saturation, sf->fx_active[fx_num]);
-      break;
-    case FX_BEATREPEAT:
-      if (sf->fx_active[fx_num]) {
-        BeatRepeat_repeat(beatrepeat,
-                          sf->fx_param[FX_BEATREPEAT][0] * 19000 / 255 + 100);
-      } else {
-        BeatRepeat_repeat(beatrepeat, 0);
-      }
-      break;
-    case FX_DELAY:
-      Delay_setActive(delay, sf->fx_active[fx_num]);
-      break;
-    case FX_TIGHTEN:
-      printf("FX_TIGHTEN\n");
-      if (sf->fx_active[fx_num]) {
-        Gate_set_amount(audio_gate, sf->fx_param[FX_TIGHTEN][0]);
-      } else {
-        Gate_set_amount(audio_gate, 255);
-      }
-      break;
-    case FX_SLOWDOWN:
-      if (sf->fx_active[fx_num]) {
-        Envelope2_reset(envelope_pitch, BLOCKS_PER_SECOND,
-                        Envelope2_update(envelope_pitch), 0.5, 1);
-      } else {
-        Envelope2_reset(envelope_pitch, BLOCKS_PER_SECOND,
-                        Envelope2_update(envelope_pitch), 1.0, 1);
-      }
-      break;
-    case FX_SPEEDUP:
-      if (sf->fx_active[fx_num]) {
-        Envelope2_reset(envelope_pitch, BLOCKS_PER_SECOND,
-                        Envelope2_update(envelope_pitch), 2.0, 1);
-      } else {
-        Envelope2_reset(envelope_pitch, BLOCKS_PER_SECOND,
-                        Envelope2_update(envelope_pitch), 1.0, 1);
-      }
-      break;
-    case FX_TAPE_STOP:
-      if (sf->fx_active[FX_TAPE_STOP]) {
-        Envelope2_reset(envelope_pitch, BLOCKS_PER_SECOND,
-                        Envelope2_update(envelope_pitch),
-                        ENVELOPE_PITCH_THRESHOLD / 2, 2.7);
-      } else {
-        Envelope2_reset(envelope_pitch, BLOCKS_PER_SECOND,
-                        Envelope2_update(envelope_pitch), 1.0, 1.9);
-      }
-      break;
-    case FX_FUZZ:
-      if (sf->fx_active[FX_FUZZ]) {
-        printf("fuzz activated!\n");
-      }
-    case FX_FILTER:
-      if (sf->fx_active[FX_FILTER]) {
-        EnvelopeLinearInteger_reset(
-            envelope_filter, BLOCKS_PER_SECOND,
-            EnvelopeLinearInteger_update(envelope_filter, NULL), 5, 1.618);
-      } else {
-        EnvelopeLinearInteger_reset(
-            envelope_filter, BLOCKS_PER_SECOND,
-            EnvelopeLinearInteger_update(envelope_filter, NULL),
-            global_filter_index, 1.618);
-      }
-      break;
-    case FX_VOLUME_RAMP:
-      if (sf->fx_active[FX_VOLUME_RAMP]) {
-        Envelope2_reset(envelope_volume, BLOCKS_PER_SECOND,
-                        Envelope2_update(envelope_volume), 0, 1.618 / 2);
-      } else {
-        Envelope2_reset(envelope_volume, BLOCKS_PER_SECOND,
-                        Envelope2_update(envelope_volume), 1, 1.618 / 2);
-      }
-      break;
-    case FX_TIMESTRETCH:
-      if (sf->fx_active[FX_TIMESTRETCH]) {
-        sel_variation_next = 1;
-      } else {
-        sel_variation_next = 0;
-      }
-      fil_current_change = true;
-      break;
-    default:
-      break;
-  }
+  CommandQueue_send(commandqueue, COMMAND_FX_TOGGLE, fx_num, 0, 0);
 }
 
 void button_key_off_held(uint8_t key) { printf("off held %d\n", key); }
@@ -240,7 +144,7 @@ void button_key_off_any(uint8_t key) {
 #ifdef INCLUDE_SINEBASS
       if (mode_buttons16 == MODE_BASS) {
         // turn off sinosc
-        WaveBass_release(wavebass);
+        CommandQueue_send(commandqueue, COMMAND_BASS_RELEASE, 0, 0, 0);
       }
 #endif
     } else {
@@ -249,7 +153,8 @@ void button_key_off_any(uint8_t key) {
         // find which key is on
         for (uint8_t i = 4; i < BUTTONMATRIX_BUTTONS_MAX; i++) {
           if (key_on_buttons[i] > 0) {
-            WaveBass_note_on(wavebass, i - 4 + 1);
+            CommandQueue_send(commandqueue, COMMAND_BASS_NOTE, i - 4 + 1, 0,
+                              0);
             break;
           }
         }
@@ -267,8 +172,7 @@ void button_key_on_single(uint8_t key) {
     if (mode_buttons16 == MODE_JUMP) {
       // 1-16 (jump mode)
       // do jump
-      debounce_quantize = 2;
-      key_do_jump(key - 4);
+      key_send_jump(key - 4, 2);
       dub_step_break = 0;
       dub_step_divider = 0;
       dub_step_beat = beat_current;
@@ -307,7 +211,7 @@ void button_key_on_double(uint8_t key1, uint8_t key2) {
       } else if (mode_buttons16 == MODE_MASH) {
         // S+H (mash mode)
         // does jump
-        key_do_jump(key2 - 4);
+        key_send_jump(key2 - 4, -1);
       }
     }
   } else if (key1 > 3 && key2 > 3) {
@@ -356,11 +260,11 @@ void button_key_on_double(uint8_t key1, uint8_t key2) {
         KEY_C_sample_select = true;
         printf("sel_bank_select: %d\n", sel_bank_select);
       } else {
-        sel_bank_next = sel_bank_select;
-        sel_sample_next = ((key2 - 4) % (banks[sel_bank_next]->num_samples));
-        printf("sel_bank_next: %d\n", sel_bank_next);
-        printf("sel_sample_next: %d\n", sel_sample_next);
-        fil_current_change = true;
+        uint8_t sample = (key2 - 4) % (banks[sel_bank_select]->num_samples);
+        printf("sel_bank_next: %d\n", sel_bank_select);
+        printf("sel_sample_next: %d\n", sample);
+        CommandQueue_send(commandqueue, COMMAND_SAMPLE, sel_bank_select, sample,
+                          0);
         KEY_C_sample_select = false;
       }
     }
@@ -369,46 +273,27 @@ void button_key_on_double(uint8_t key1, uint8_t key2) {
     if (key2 == KEY_B) {
       // B + A
       // toggle play sequence
-      if (sequencerhandler[mode_buttons16].recording) {
-        sequencerhandler[mode_buttons16].recording = false;
-      }
-      sequencerhandler[mode_buttons16].playing =
-          !sequencerhandler[mode_buttons16].playing;
-
-      if (sequencerhandler[mode_buttons16].playing) {
-        printf("[button_handler] sequence %d playing on\n", mode_buttons16);
-        if (Sequencer_has_data(sf->sequencers[mode_buttons16][0])) {
-          Sequencer_play(sf->sequencers[mode_buttons16][0], true);
-        } else {
-          printf("[button_handler] sequence %d has no data\n", mode_buttons16);
-          sequencerhandler[mode_buttons16].playing = false;
-        }
-      } else {
-        printf("[button_handler] sequence %d playing off\n", mode_buttons16);
-        Sequencer_stop(sf->sequencers[mode_buttons16][0]);
-      }
+      CommandQueue_send(commandqueue, COMMAND_SEQUENCER, mode_buttons16,
+                        SEQUENCER_TOGGLE_PLAY, 0);
     } else if (key2 == KEY_D) {
       // B + C
 
       // toggle record sequence
-      if (sequencerhandler[mode_buttons16].playing) {
-        sequencerhandler[mode_buttons16].playing = false;
-      }
-      sequencerhandler[mode_buttons16].recording =
-          !sequencerhandler[mode_buttons16].recording;
-      if (sequencerhandler[mode_buttons16].recording) {
-        // todo [0] should be which sequencer is currently on
-        Sequencer_clear(sf->sequencers[mode_buttons16][0]);
-        printf("[button_handler] sequence %d recording on\n", mode_buttons16);
-      } else {
-        printf("[button_handler] sequence %d recording off\n", mode_buttons16);
-      }
+      CommandQueue_send(commandqueue, COMMAND_SEQUENCER, mode_buttons16,
+                        SEQUENCER_TOGGLE_RECORD, 0);
 
     } else if (key2 > 3) {
       // B + H
       // update the current chain
       // Chain_set_current(chain, key2 - 4);
     }
+  } else if (key1 == KEY_D) {
+    // C
+    if (key2 == KEY_A) {
+      // C + S
+      // toggle reverb, it has no key of its own, C + knobs set it
+      toggle_fx(FX_REVERB);
+    }
   }
 }
 
@@ -583,7 +468,8 @@ void button_handler(ButtonMatrix *bm) {
 #ifdef INCLUDE_SINEBASS
     if (mode_buttons16 == MODE_BASS) {
       printf("updaing sinosc\n");
-      WaveBass_note_on(wavebass, bm->on[i] - 4 + 1);
+      CommandQueue_send(commandqueue, COMMAND_BASS_NOTE, bm->on[i] - 4 + 1, 0,
+                        0);
     }
 #endif
 
@@ -794,24 +680,7 @@ void button_handler(ButtonMatrix *bm) {
       LEDS_set(leds, 3, LED_BLINK);
     }
     if (mode_buttons16 == MODE_MASH || mode_buttons16 == MODE_JUMP) {
-      if (sel_variation == 0) {
-        LEDS_set(leds, beat_current % 16 + 4, LED_DIM);
-      } else {
-        LEDS_set(leds,
-                 linlin(phases[0], 0,
-                        banks[sel_bank_cur]
-                            ->sample[sel_sample_cur]
-                            .snd[sel_variation]
-                            ->size,
-                        0,
-                        banks[sel_bank_cur]
-                            ->sample[sel_sample_cur]
-                            .snd[sel_variation]
-                            ->slice_num) %
-                         16 +
-                     4,
-                 LED_DIM);
-      }
+      LEDS_set(leds, beat_current % 16 + 4, LED_DIM);
     }
     if (mode_buttons16 == MODE_MASH ||
         (mode_buttons16 == MODE_JUMP && key_on_buttons[KEY_A])) {
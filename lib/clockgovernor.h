@@ -0,0 +1,181 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_CLOCKGOVERNOR_H_
+#define LIB_CLOCKGOVERNOR_H_
+
+// ClockGovernor picks the system clock from a few stable frequencies using
+// the rolling load of the audio callback. the load is kept in cycles per
+// block so it can be predicted at any of the frequencies.
+//
+// all steps share the 1500 MHz pll vco and give the same i2s sample rate
+// with the integer pio divider (22, 33 and 44), so only the dividers that
+// follow clk_sys need to be re-derived after a change.
+//
+// changing the pll briefly runs clk_sys from the 12 MHz reference, so the
+// clock only drops on idle blocks (nothing but silence queued). it goes up
+// right away when playback starts or the load needs it. playback and idle
+// keep separate averages, so playback resumes at the clock it last needed.
+//
+// the audio core makes the change, but core0 may be in the middle of an i2c,
+// spi or sd transfer. so a change is only marked pending, core0 parks at the
+// top of its loop with ClockGovernor_park, and the audio core switches once
+// it sees core0 parked.
+
+#define CLOCKGOVERNOR_STEPS 3
+
+const uint32_t clockgovernor_khz[CLOCKGOVERNOR_STEPS] = {125000, 187500,
+                                                          250000};
+
+typedef struct ClockGovernor {
+  uint8_t step;
+  // the step the clock is actually at, for the caller to roll back a change
+  // it could not make
+  uint8_t step_last;
+  uint8_t step_max;
+  // percent of the block the callback should stay under
+  uint8_t target;
+  uint32_t block_us;
+  // rolling cycles per block * 8
+  uint32_t cycles_play;
+  uint32_t cycles_idle;
+  uint16_t calm;
+  uint16_t calm_blocks;
+  bool idle_last;
+  // set by the audio core when step differs from step_last, cleared once it
+  // switched
+  volatile bool pending;
+  // set by core0 while it waits for a pending switch
+  volatile bool parked;
+} ClockGovernor;
+
+// starts at the fastest step up to khz_max, which is where boot left it
+ClockGovernor *ClockGovernor_malloc(uint32_t block_us, uint8_t target,
+                                    uint16_t calm_blocks, uint32_t khz_max) {
+  ClockGovernor *self = (ClockGovernor *)malloc(sizeof(ClockGovernor));
+  self->step_max = 0;
+  while (self->step_max < CLOCKGOVERNOR_STEPS - 1 &&
+         clockgovernor_khz[self->step_max + 1] <= khz_max) {
+    self->step_max++;
+  }
+  self->step = self->step_max;
+  self->step_last = self->step;
+  self->target = target;
+  self->block_us = block_us;
+  self->cycles_play = 0;
+  self->cycles_idle = 0;
+  self->calm = 0;
+  self->calm_blocks = calm_blocks;
+  self->idle_last = false;
+  self->pending = false;
+  self->parked = false;
+  return self;
+}
+
+void ClockGovernor_free(ClockGovernor *self) { free(self); }
+
+uint32_t ClockGovernor_khz(ClockGovernor *self) {
+  return clockgovernor_khz[self->step];
+}
+
+// sdio runs clk_sys / divider, above 200 MHz it needs a divider of 2
+uint8_t ClockGovernor_sdioDivider(ClockGovernor *self) {
+  return clockgovernor_khz[self->step] > 200000 ? 2 : 1;
+}
+
+// lowest step that runs the given cycles (* 8) under the target
+uint8_t ClockGovernor_want(ClockGovernor *self, uint32_t cycles8) {
+  for (uint8_t step = 0; step < self->step_max; step++) {
+    uint64_t us = (uint64_t)cycles8 * 1000 / 8 / clockgovernor_khz[step];
+    if (us * 100 <= (uint64_t)self->block_us * self->target) {
+      return step;
+    }
+  }
+  return self->step_max;
+}
+
+// called after every block with the time the callback took and whether the
+// block was idle. returns true when the clock should change to
+// ClockGovernor_khz.
+bool ClockGovernor_update(ClockGovernor *self, uint32_t busy_us, bool idle) {
+  // the block ran at the clock actually set, which lags step while a change
+  // is pending
+  uint32_t cycles8 =
+      (uint64_t)busy_us * clockgovernor_khz[self->step_last] * 8 / 1000;
+  bool wake = !idle && self->idle_last;
+  self->idle_last = idle;
+  uint32_t *cycles = idle ? &self->cycles_idle : &self->cycles_play;
+  if (*cycles == 0) {
+    *cycles = cycles8;
+  } else {
+    *cycles = *cycles - *cycles / 8 + cycles8 / 8;
+  }
+
+  if (!idle) {
+    self->calm = 0;
+    uint8_t want = ClockGovernor_want(self, self->cycles_play);
+    if (busy_us > self->block_us && want <= self->step &&
+        self->step < self->step_max) {
+      // overran, whatever the average says
+      want = self->step + 1;
+    }
+    if (want > self->step || (wake && want != self->step)) {
+      self->step = want;
+      return true;
+    }
+    return false;
+  }
+
+  uint8_t want = ClockGovernor_want(self, self->cycles_idle);
+  if (want > self->step) {
+    self->calm = 0;
+    self->step = want;
+    return true;
+  }
+  if (want == self->step) {
+    self->calm = 0;
+    return false;
+  }
+  self->calm++;
+  if (self->calm < self->calm_blocks) {
+    return false;
+  }
+  self->calm = 0;
+  self->step = want;
+  return true;
+}
+
+// called from core0 where it is not using any peripheral, waits out a
+// pending clock change
+void ClockGovernor_park(ClockGovernor *self) {
+  if (!self->pending) {
+    return;
+  }
+  self->parked = true;
+  while (self->pending) {
+  }
+  self->parked = false;
+}
+
+#endif
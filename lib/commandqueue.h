@@ -0,0 +1,229 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_COMMANDQUEUE_H_
+#define LIB_COMMANDQUEUE_H_
+
+#include "ramfunc.h"
+
+// CommandQueue carries control changes from core0 (main loop and the bpm
+// timer) to the audio core, which drains it at the start of every block, so
+// the audio core only ever sees a change as a whole and in the order it was
+// made. core0 is the only producer (interrupts are disabled while a command is
+// written, so the timer and the main loop can both push) and the audio core is
+// the only consumer.
+//
+// the beat clock also runs on the audio core, and code shared between the
+// cores sends with CommandQueue_send: on the audio core the command is applied
+// right away (inside CommandQueue_direct/CommandQueue_endDirect at the given
+// offset, elsewhere at the block start), on core0 it is pushed. the audio core
+// never pushes, that would make it a second producer.
+//
+// every command is stamped with time_us_32() when it is pushed. the audio core
+// turns that into a sample offset within the block it is drained in, one block
+// after it was pushed, so events keep their spacing instead of all snapping to
+// the block start, and keeps latency statistics.
+
+#define COMMANDQUEUE_SIZE 32  // power of two
+#define COMMANDQUEUE_MASK (COMMANDQUEUE_SIZE - 1)
+
+// jump to phase value
+#define COMMAND_JUMP 0
+// switch to bank a, sample b
+#define COMMAND_SAMPLE 1
+// toggle fx a
+#define COMMAND_FX_TOGGLE 2
+// set the retrig pitch to a and the retrig volume to value (Q16.16)
+#define COMMAND_RETRIG 3
+// set audio_mute to value
+#define COMMAND_MUTE 4
+// restart the beat repeat with length a, see BeatRepeat_length
+#define COMMAND_BEATREPEAT 5
+// route modulation source a to destination b at depth value (q15)
+#define COMMAND_MOD_ROUTE 6
+// jump to beat a of the current 16, value is the new debounce_quantize or -1
+#define COMMAND_KEY_JUMP 7
+// start a retrigger of a beats every b ticks
+#define COMMAND_RETRIG_START 8
+// change sequencer a, b is one of the SEQUENCER_* actions, value its argument
+#define COMMAND_SEQUENCER 9
+// set beat_current to value
+#define COMMAND_BEAT 10
+// play bass note a
+#define COMMAND_BASS_NOTE 11
+// release the bass note
+#define COMMAND_BASS_RELEASE 12
+
+typedef struct Command {
+  uint32_t time_us;
+  int32_t value;
+  uint16_t b;
+  uint8_t a;
+  uint8_t type;
+  // filled in by CommandQueue_pop
+  uint16_t offset;
+} Command;
+
+typedef struct CommandQueue {
+  Command commands[COMMANDQUEUE_SIZE];
+  // write is only changed by core0, read only by the audio core
+  volatile uint16_t write;
+  volatile uint16_t read;
+  volatile uint32_t dropped;
+  // latency statistics, kept by the audio core
+  uint32_t count;
+  uint32_t latency_max;
+  uint64_t latency_sum;
+  uint16_t depth_max;
+  uint32_t last_block_us;
+  // applies a command on the audio core
+  void (*apply)(Command *c);
+  // core that applies directly, -1 when none
+  volatile int8_t direct_core;
+  uint16_t direct_offset;
+} CommandQueue;
+
+CommandQueue *CommandQueue_malloc(void (*apply)(Command *c)) {
+  CommandQueue *self = (CommandQueue *)malloc(sizeof(CommandQueue));
+  self->write = 0;
+  self->read = 0;
+  self->dropped = 0;
+  self->count = 0;
+  self->latency_max = 0;
+  self->latency_sum = 0;
+  self->depth_max = 0;
+  self->last_block_us = 0;
+  self->apply = apply;
+  self->direct_core = -1;
+  self->direct_offset = 0;
+  return self;
+}
+
+void CommandQueue_free(CommandQueue *self) { free(self); }
+
+// called from core0, returns false (and counts it) when the queue is full
+bool CommandQueue_push(CommandQueue *self, uint8_t type, uint8_t a, uint16_t b,
+                       int32_t value) {
+  assert(get_core_num() == 0);
+  uint32_t irq = save_and_disable_interrupts();
+  uint16_t w = self->write;
+  if ((uint16_t)(w - self->read) >= COMMANDQUEUE_SIZE) {
+    self->dropped++;
+    restore_interrupts(irq);
+    return false;
+  }
+  Command *c = &self->commands[w & COMMANDQUEUE_MASK];
+  c->time_us = time_us_32();
+  c->type = type;
+  c->a = a;
+  c->b = b;
+  c->value = value;
+  __dmb();
+  self->write = w + 1;
+  restore_interrupts(irq);
+  return true;
+}
+
+// called by the audio core, commands it sends until CommandQueue_endDirect are
+// applied immediately at offset
+void CommandQueue_direct(CommandQueue *self, uint16_t offset) {
+  self->direct_offset = offset;
+  self->direct_core = get_core_num();
+}
+
+void CommandQueue_endDirect(CommandQueue *self) { self->direct_core = -1; }
+
+// pushes from core0, applies directly anywhere else
+bool CommandQueue_send(CommandQueue *self, uint8_t type, uint8_t a, uint16_t b,
+                       int32_t value) {
+  int8_t core = get_core_num();
+  if (core != 0 || self->direct_core == core) {
+    Command c = {.time_us = time_us_32(),
+                 .value = value,
+                 .b = b,
+                 .a = a,
+                 .type = type,
+                 .offset = self->direct_core == core ? self->direct_offset
+                                                     : 0};
+    self->apply(&c);
+    return true;
+  }
+  return CommandQueue_push(self, type, a, b, value);
+}
+
+// called by the audio core at the start of a block, before any pops
+void CommandQueue_beginBlock(CommandQueue *self, uint32_t now_us) {
+  uint16_t depth = self->write - self->read;
+  if (depth > self->depth_max) {
+    self->depth_max = depth;
+  }
+  self->last_block_us = now_us;
+}
+
+// called by the audio core, copies out the next command. the offset puts it
+// at the same place in this block as it was pushed in the previous one.
+bool RAM_FUNC(CommandQueue_pop)(CommandQueue *self, Command *out,
+                                uint32_t block_us, uint16_t block_samples) {
+  uint16_t r = self->read;
+  if (r == self->write) {
+    return false;
+  }
+  __dmb();
+  *out = self->commands[r & COMMANDQUEUE_MASK];
+  __dmb();
+  self->read = r + 1;
+
+  uint32_t latency = self->last_block_us - out->time_us;
+  self->count++;
+  self->latency_sum += latency;
+  if (latency > self->latency_max) {
+    self->latency_max = latency;
+  }
+  if (latency >= block_us) {
+    out->offset = 0;
+  } else {
+    out->offset = block_samples - 1 -
+                  (uint32_t)latency * (block_samples - 1) / block_us;
+  }
+  return true;
+}
+
+// called from core0, the numbers are updated by the audio core so a line can
+// mix two blocks
+void CommandQueue_printStats(CommandQueue *self) {
+  if (self->count == 0) {
+    printf("[commandqueue] no commands, %lu dropped\n",
+           (unsigned long)self->dropped);
+    return;
+  }
+  printf(
+      "[commandqueue] %lu commands, latency avg %lu us max %lu us, max depth "
+      "%d, %lu dropped\n",
+      (unsigned long)self->count,
+      (unsigned long)(self->latency_sum / self->count),
+      (unsigned long)self->latency_max, self->depth_max,
+      (unsigned long)self->dropped);
+}
+
+#endif
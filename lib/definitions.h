@@ -59,6 +59,9 @@ static const uint32_t PIN_DCDC_PSM_CTRL = 23;
 #define FX_SLOWDOWN 13
 #define FX_SPEEDUP 14
 #define FX_TAPE_STOP 15
+// not on the keys
+#define FX_REVERB 16
+#define FX_NUM 17
 
 #define LED_NONE 0
 #define LED_DIM 1
@@ -24,114 +24,285 @@
 
 #ifndef DELAY_LIB
 #define DELAY_LIB 1
-#define DELAY_RINGBUFFER_SIZE 11025
-#define DELAY_RINGBUFFER_SIZE_MINUS 10925
-#define DELAY_ZEROCROSSING_SIZE 10000
+// two 16-bit mono lines of one duration each, long enough for a 1/4 note
+// down to 120 bpm. they come from the fx pool as one buffer, which may give
+// shorter lines down to the min.
+#define DELAY_LINE_SIZE (44100 * 60 / 120 + 2)
+#define DELAY_LINE_MIN 2048
+// one sample for the interpolation, one for the write
+#define DELAY_DURATION_MAX(size) ((size) - 2)
+#define DELAY_DURATION_MIN 100
+// a length change closes 1/8 of the remaining distance each block, a
+// feedback change 1/4
+#define DELAY_GLIDE_SHIFT 3
+#define DELAY_FEEDBACK_SHIFT 2
+#define DELAY_DIVISIONS 8
 #include "fixedpoint.h"
+#include "fxpool.h"
+#include "ramfunc.h"
+#include "smooth.h"
 //
-#include "crossfade3.h"
 #include "stdbool.h"
 
+// note lengths in 24ths of a beat: 1/32, 1/16, 1/8 triplet, dotted 1/16,
+// 1/8, 1/4 triplet, dotted 1/8 and 1/4
+const uint8_t delay_divisions[DELAY_DIVISIONS] = {3, 6, 8, 9, 12, 16, 18, 24};
+
+// Delay is a ping-pong delay. both channels are summed into the first line
+// and the left repeat is read one duration back. the left repeat goes into
+// the second line, the right repeat is read one duration back from that, and
+// it feeds the first line again so the repeats keep bouncing between the
+// sides. each line only has to hold one duration.
 typedef struct Delay {
-  // buffer for holding original samples
-  int32_t delay_ringbuffer[DELAY_RINGBUFFER_SIZE];
+  FxPool *pool;
+  // the first line, input and feedback as the top 16 bits of the 32-bit
+  // samples, followed by the second, NULL while the delay is off
+  int16_t *delay_ringbuffer;
+  int16_t *right_line;
+  uint16_t line_size;
   uint16_t ringbuffer_index;
-  uint8_t feedback;  // (1-16)
+  uint8_t feedback;  // (1-16) attenuation of each repeat, as a shift
+  // spacing of the repeats in samples, and the spacing actually played
+  // (q16.16) which glides towards it
   uint16_t duration;
+  Smooth spacing;
+  // the note division and tempo the duration came from, bpm is 0 when the
+  // duration was set directly
+  uint8_t division;
+  uint16_t bpm;
+  // the attenuation as a gain (q16)
+  Smooth gain;
   bool on;
-
-  // crossfading repeats
-  int16_t crossfade_in;
-  int16_t crossfade_out;
+  // samples in a row written to the ring as zero
+  uint32_t silent;
+  // level of the repeats (q16), ramps over a block when switched on or off
+  Smooth wet;
 } Delay;
 
-Delay *Delay_malloc() {
+Delay *Delay_malloc(FxPool *pool) {
   Delay *self = (Delay *)malloc(sizeof(Delay));
+  self->pool = pool;
+  self->delay_ringbuffer = NULL;
+  self->right_line = NULL;
+  self->line_size = 0;
   self->ringbuffer_index = 0;
   self->feedback = 1;
-  self->duration = 11025;
+  Smooth_init(&self->gain, Q16_16_1 >> self->feedback, DELAY_FEEDBACK_SHIFT);
+  self->duration = DELAY_DURATION_MAX(DELAY_LINE_SIZE);
+  self->division = 0;
+  self->bpm = 0;
+  Smooth_init(&self->spacing, (int32_t)self->duration << 16,
+              DELAY_GLIDE_SHIFT);
   self->on = false;
-  self->crossfade_in = CROSSFADE3_LIMIT;
-  self->crossfade_out = CROSSFADE3_LIMIT;
-  for (int i = 0; i < DELAY_RINGBUFFER_SIZE; i++) {
-    self->delay_ringbuffer[i] = 0;
-  }
+  self->silent = 0;
+  Smooth_init(&self->wet, 0, 0);
+  FxPool_register(pool, "delay", DELAY_LINE_SIZE * 2 * sizeof(int16_t),
+                  DELAY_LINE_MIN * 2 * sizeof(int16_t));
   return self;
 }
 
-void Delay_setDuration(Delay *self, uint16_t num_samples) {
-  if (num_samples > DELAY_RINGBUFFER_SIZE) {
-    num_samples = DELAY_RINGBUFFER_SIZE;
+// true when both lines are all zero, so processing silence can be skipped
+// without changing what comes out later
+bool Delay_isSilent(Delay *self) {
+  return self->delay_ringbuffer == NULL || self->silent >= self->line_size;
+}
+
+// 44100 * 60 / 24 samples in a 24th of a beat at 1 bpm
+static inline uint32_t Delay_divisionSamples(uint8_t division, uint16_t bpm) {
+  return delay_divisions[division] * 110250 / bpm;
+}
+
+// the longest division up to the given one that fits max, or max when none
+// does, so a longer setting never plays shorter
+static inline uint32_t Delay_divisionFit(uint8_t division, uint16_t bpm,
+                                         uint32_t max) {
+  for (int8_t d = division; d >= 0; d--) {
+    uint32_t num_samples = Delay_divisionSamples(d, bpm);
+    if (num_samples <= max) {
+      return num_samples;
+    }
+  }
+  return max;
+}
+
+// the spacing the lines can hold, shorter lines from the pool keep to the
+// longest division that fits them
+static inline uint16_t Delay_fit(Delay *self, uint16_t duration) {
+  uint32_t size =
+      self->delay_ringbuffer == NULL ? DELAY_LINE_SIZE : self->line_size;
+  if (duration <= DELAY_DURATION_MAX(size)) {
+    return duration;
   }
-  if (num_samples != self->duration) {
-    printf("[delay] duration %d\n", num_samples);
-    self->duration = num_samples;
+  if (self->bpm == 0) {
+    return DELAY_DURATION_MAX(size);
   }
+  return Delay_divisionFit(self->division, self->bpm,
+                           DELAY_DURATION_MAX(size));
 }
 
-void Delay_setLength(Delay *self, uint8_t length) {
-  Delay_setDuration(self, 100 + ((DELAY_RINGBUFFER_SIZE_MINUS * length) >> 8));
+static bool Delay_changeDuration(Delay *self, uint16_t num_samples) {
+  if (num_samples > DELAY_DURATION_MAX(DELAY_LINE_SIZE)) {
+    num_samples = DELAY_DURATION_MAX(DELAY_LINE_SIZE);
+  } else if (num_samples < DELAY_DURATION_MIN) {
+    num_samples = DELAY_DURATION_MIN;
+  }
+  if (num_samples == self->duration) {
+    return false;
+  }
+  self->duration = num_samples;
+  // with nothing in the ring there is nothing to glide
+  if (Delay_isSilent(self)) {
+    Smooth_jump(&self->spacing, (int32_t)Delay_fit(self, num_samples) << 16);
+  }
+  return true;
 }
 
-void Delay_setFeedback(Delay *self, uint8_t feedback) {
-  if (feedback != self->feedback) {
-    printf("[delay] feedback %d\n", feedback);
-    self->feedback = feedback;
+// the setters return true when the value changed
+bool Delay_setDuration(Delay *self, uint16_t num_samples) {
+  self->bpm = 0;
+  return Delay_changeDuration(self, num_samples);
+}
+
+// length picks a note division. one too long for the lines at this tempo
+// plays the longest division that fits instead.
+bool Delay_setLength(Delay *self, uint8_t length, uint16_t bpm) {
+  if (bpm == 0) {
+    return false;
   }
+  self->division = (length * DELAY_DIVISIONS) >> 8;
+  self->bpm = bpm;
+  return Delay_changeDuration(
+      self, Delay_divisionFit(self->division, bpm,
+                              DELAY_DURATION_MAX(DELAY_LINE_SIZE)));
 }
 
-void Delay_process(Delay *self, int32_t *samples, uint16_t num_samples,
-                   uint8_t channel) {
+bool Delay_setFeedback(Delay *self, uint8_t feedback) {
+  // without any attenuation the repeats would build up forever
+  if (feedback < 1) {
+    feedback = 1;
+  }
+  if (feedback == self->feedback) {
+    return false;
+  }
+  self->feedback = feedback;
+  Smooth_set(&self->gain, Q16_16_1 >> feedback);
+  return true;
+}
+
+// steps an index on by one, back to 0 at size without a branch
+static inline uint32_t Delay_wrap(uint32_t i, uint32_t size) {
+  i++;
+  return i - (size & -(uint32_t)(i >= size));
+}
+
+// line value spacing (q16.16) before index, linearly interpolated
+static inline int32_t Delay_read(const int16_t *line, uint32_t size,
+                                 uint32_t index, int32_t spacing) {
+  int32_t pos = (int32_t)(index << 16) - spacing;
+  pos += (int32_t)(size << 16) & (pos >> 31);
+  uint32_t i = (uint32_t)pos >> 16;
+  int32_t a = line[i];
+  int32_t b = line[Delay_wrap(i, size)];
+  return a + (((b - a) * (int32_t)((pos & 0xFFFF) >> 1)) >> 15);
+}
+
+// gives the lines back to the pool
+void Delay_release(Delay *self) {
+  if (self->delay_ringbuffer != NULL) {
+    FxPool_release(self->pool, self->delay_ringbuffer);
+    self->delay_ringbuffer = NULL;
+    self->right_line = NULL;
+  }
+}
+
+void RAM_FUNC(Delay_process)(Delay *self, int32_t *samples,
+                             uint16_t num_samples) {
+  if (self->delay_ringbuffer == NULL) {
+    return;
+  }
+  // the level, spacing and attenuation are ramped over the block, so the
+  // loop below only adds
+  Smooth_set(&self->wet, self->on ? Q16_16_1 : 0);
+  Smooth_set(&self->spacing, (int32_t)Delay_fit(self, self->duration) << 16);
+  Smooth_beginBlock(&self->wet, num_samples);
+  Smooth_beginBlock(&self->spacing, num_samples);
+  Smooth_beginBlock(&self->gain, num_samples);
+  int32_t wet = self->wet.value;
+  int32_t wet_step = self->wet.step;
+  int32_t spacing = self->spacing.value;
+  int32_t spacing_step = self->spacing.step;
+  int32_t gain = self->gain.value;
+  int32_t gain_step = self->gain.step;
+  int16_t *line = self->delay_ringbuffer;
+  int16_t *right_line = self->right_line;
+  uint32_t index = self->ringbuffer_index;
+  uint32_t size = self->line_size;
   for (int ii = 0; ii < num_samples; ii++) {
-    while (self->ringbuffer_index > self->duration) {
-      self->ringbuffer_index -= self->duration;
-    }
-    self->delay_ringbuffer[self->ringbuffer_index] =
-        self->delay_ringbuffer[self->ringbuffer_index] >> self->feedback;
-    self->ringbuffer_index++;
-    if (self->ringbuffer_index == self->duration) {
-      self->ringbuffer_index = 0;
-    }
+    wet += wet_step;
+    spacing += spacing_step;
+    gain += gain_step;
+    int32_t l = Delay_read(line, size, index, spacing);
+    int32_t r = Delay_read(right_line, size, index, spacing);
+    right_line[index] = l;
+    int32_t left = l * wet;
+    int32_t right = ((r * wet) >> 16) * gain;
 
-    if (self->crossfade_in < CROSSFADE3_LIMIT) {
-      int32_t v =
-          q16_16_multiply(Q16_16_1 - crossfade3_line[self->crossfade_in],
-                          self->delay_ringbuffer[self->ringbuffer_index]);
-      samples[ii * 2 + 0] += v;
-      samples[ii * 2 + 1] += v;
-      self->crossfade_in++;
-      if (self->crossfade_in == CROSSFADE3_LIMIT) {
-        self->on = true;
-      }
-    } else if (self->crossfade_out < CROSSFADE3_LIMIT) {
-      int32_t v =
-          q16_16_multiply(crossfade3_line[self->crossfade_out],
-                          self->delay_ringbuffer[self->ringbuffer_index]);
-      samples[ii * 2 + 0] += v;
-      samples[ii * 2 + 1] += v;
-      self->crossfade_out++;
-      if (self->crossfade_out >= CROSSFADE3_LIMIT) {
-        self->on = false;
-      }
-    } else if (self->on) {
-      samples[ii * 2 + 0] += self->delay_ringbuffer[self->ringbuffer_index];
-      samples[ii * 2 + 1] += self->delay_ringbuffer[self->ringbuffer_index];
-    }
+    // the input in 16-bit steps with 8 more bits, attenuated and rounded
+    // when stored so a decaying repeat reaches zero instead of sticking at
+    // -1. the shifts keep the multiply in 32 bits
+    int32_t in = (samples[ii * 2 + 0] >> 9) + (samples[ii * 2 + 1] >> 9);
+    int32_t v =
+        ((((in + (right >> 8)) >> 6) * (gain >> 3)) + (1 << 14)) >> 15;
+    line[index] = v;
+    self->silent = (self->silent + 1) & -(uint32_t)((v | l) == 0);
 
-    self->delay_ringbuffer[self->ringbuffer_index] = samples[ii * 2 + channel];
+    samples[ii * 2 + 0] += left;
+    samples[ii * 2 + 1] += right;
+    index = Delay_wrap(index, size);
+  }
+  self->ringbuffer_index = index;
+  // faded out
+  if (!self->on) {
+    Delay_release(self);
   }
 }
 
-void Delay_setActive(Delay *self, bool on) {
-  if (on) {
-    self->crossfade_in = 0;
-    self->crossfade_out = CROSSFADE3_LIMIT;
-  } else if (self->on) {
-    self->crossfade_in = CROSSFADE3_LIMIT;
-    self->crossfade_out = 0;
+// switching on takes both lines from the pool, which may give less than the
+// full size, and returns false when not even the smallest fits. a short grant
+// is split into two equal lines and any odd bytes go back to the pool.
+bool Delay_setActive(Delay *self, bool on) {
+  if (on && self->delay_ringbuffer == NULL) {
+    uint32_t granted;
+    self->delay_ringbuffer = (int16_t *)FxPool_alloc(
+        self->pool, DELAY_LINE_SIZE * 2 * sizeof(int16_t),
+        DELAY_LINE_MIN * 2 * sizeof(int16_t), &granted);
+    if (self->delay_ringbuffer == NULL) {
+      self->on = false;
+      return false;
+    }
+    uint32_t size = granted / (2 * sizeof(int16_t));
+    FxPool_shrink(self->pool, self->delay_ringbuffer,
+                  size * 2 * sizeof(int16_t));
+    self->right_line = self->delay_ringbuffer + size;
+    self->line_size = size;
+    self->ringbuffer_index = 0;
+    self->silent = size;
+    Smooth_jump(&self->wet, 0);
+    Smooth_jump(&self->spacing, (int32_t)Delay_fit(self, self->duration)
+                                    << 16);
+    Smooth_jump(&self->gain, Q16_16_1 >> self->feedback);
   }
+  self->on = on;
+  // nothing to fade out
+  if (!on && Delay_isSilent(self)) {
+    Delay_release(self);
+  }
+  return true;
 }
 
-void Delay_free(Delay *self) { free(self); }
+void Delay_free(Delay *self) {
+  Delay_release(self);
+  free(self);
+}
 
 #endif /* DELAY_LIB */
@@ -32,42 +32,39 @@ Sample selects currently playing sample from the current bank
 #include "taptempo.h"
 
 void go_retrigger_2key(uint8_t key1, uint8_t key2) {
-  debounce_quantize = 0;
-  retrig_first = true;
-  retrig_beat_num = random_integer_in_range(8, 24);
-  retrig_timer_reset =
+  uint8_t beat_num = random_integer_in_range(8, 24);
+  uint16_t timer_reset =
       96 * random_integer_in_range(1, 6) / random_integer_in_range(2, 12);
-  float total_time = (float)(retrig_beat_num * retrig_timer_reset * 60) /
+  float total_time = (float)(beat_num * timer_reset * 60) /
                      (float)(96 * sf->bpm_tempo);
   if (total_time > 5.0f) {
     total_time = total_time / 2;
-    retrig_timer_reset = retrig_timer_reset / 2;
+    timer_reset = timer_reset / 2;
   }
   if (total_time > 5.0f) {
     total_time = total_time / 2;
-    retrig_beat_num = retrig_beat_num / 2;
-    if (retrig_beat_num == 0) {
-      retrig_beat_num = 1;
+    beat_num = beat_num / 2;
+    if (beat_num == 0) {
+      beat_num = 1;
     }
   }
   if (total_time < 0.5f) {
     total_time = total_time * 2;
-    retrig_beat_num = retrig_beat_num * 2;
-    if (retrig_beat_num == 0) {
-      retrig_beat_num = 1;
+    beat_num = beat_num * 2;
+    if (beat_num == 0) {
+      beat_num = 1;
     }
   }
   if (total_time < 0.5f) {
     total_time = total_time * 2;
-    retrig_beat_num = retrig_beat_num * 2;
-    if (retrig_beat_num == 0) {
-      retrig_beat_num = 1;
+    beat_num = beat_num * 2;
+    if (beat_num == 0) {
+      beat_num = 1;
     }
   }
-  retrig_vol_step = 1.0 / ((float)retrig_beat_num);
   // printf("retrig_beat_num=%d,retrig_timer_reset=%d,total_time=%2.3fs\n",
-  //        retrig_beat_num, retrig_timer_reset, total_time);
-  retrig_ready = true;
+  //        beat_num, timer_reset, total_time);
+  retrig_send_start(beat_num, timer_reset);
 }
 
 void input_handling() {
@@ -87,22 +84,49 @@ void input_handling() {
   MCP3208 *mcp3208 = MCP3208_malloc(spi1, 9, 10, 8, 11);
   TapTempo *taptempo = TapTempo_malloc();
   bool btn_taptempo_on = false;
+  uint16_t sample_requested = sel_sample_cur;
 
   sf->vol = 200;
 
   while (1) {
     uint16_t val;
 
-    if (MessageSync_hasMessage(messagesync)) {
-      MessageSync_print(messagesync);
-      MessageSync_clear(messagesync);
+    LogRing_print(logring);
+
+#ifdef INCLUDE_CLOCK_GOVERNOR
+    // nothing is mid-transfer here, wait out a clock change the audio core
+    // asked for
+    ClockGovernor_park(clockgovernor);
+#endif
+
+    // pick up the fx the audio core toggled, then rebuild the fx curve if
+    // the fx settings changed
+    audio_fx_sync();
+    ShaperChain_update(shaperchain, sf->fx_active, sf->fx_param);
+
+#ifdef INCLUDE_PROFILER
+#ifdef PRINT_PROFILER
+    // dump the profiler every ~10 seconds
+    if (time_us_32() - profiler_last_request > 10000000) {
+      profiler_last_request = time_us_32();
+      Profiler_request(profiler, false);
     }
+#endif
+    Profiler_poll(profiler);
+#endif
+#ifdef INCLUDE_FLIGHTRECORDER
+    // write out the blocks around an overrun. ectocore has no stop, so it
+    // writes as soon as it is frozen and the audio is muted meanwhile
+    if (flightrecorder->frozen) {
+      FlightRecorder_write(flightrecorder, &sync_using_sdcard);
+    }
+#endif
 
 #ifdef PRINT_SDCARD_TIMING
     // random stuff
     if (random_integer_in_range(1, 20000) < 10) {
       // printf("random retrig\n");
-      key_do_jump(random_integer_in_range(0, 15));
+      key_send_jump(random_integer_in_range(0, 15), -1);
     } else if (random_integer_in_range(1, 20000) < 5) {
       // printf("random retrigger\n");
       go_retrigger_2key(1, 1);
@@ -124,10 +148,13 @@ void input_handling() {
 
     val = MCP3208_read(mcp3208, KNOB_SAMPLE, false);
     val = (val * (banks[sel_bank_next]->num_samples)) / 1024;
-    if (val != sel_sample_cur) {
-      sel_sample_next = val;
-      fil_current_change = true;
-      printf("[ectocore] switch sample %d\n", val);
+    // only ask once per knob move, the switch takes a few blocks
+    if (val != sample_requested) {
+      sample_requested = val;
+      if (val != sel_sample_cur) {
+        CommandQueue_send(commandqueue, COMMAND_SAMPLE, sel_bank_next, val, 0);
+        printf("[ectocore] switch sample %d\n", val);
+      }
     }
     sleep_ms(1);
   }
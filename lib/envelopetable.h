@@ -0,0 +1,223 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_ENVELOPETABLE_H_
+#define LIB_ENVELOPETABLE_H_
+
+#include <math.h>
+
+#include "fixedpoint.h"
+#include "ramfunc.h"
+//
+#include "stdbool.h"
+
+// EnvelopeTable moves a q16.16 value through up to ENVELOPE_STAGES segments,
+// each linear, cosine (the curve of Envelope2) or exponential. a segment is
+// walked with a fixed-point phase and a precomputed increment, and its curve
+// read from a table with interpolation, so stepping needs no division and
+// no trigonometry; the increment is worked out once when a segment is added.
+//
+// EnvelopeTable_process steps once a sample and applies the value as a
+// gain to a stereo block. EnvelopeTable_advance moves many steps at once
+// for destinations read once a block, like the pitch. when an advance ends a
+// segment part way, the next segment starts at the following advance.
+
+#define ENVELOPE_LINEAR 0
+#define ENVELOPE_COSINE 1
+#define ENVELOPE_EXPONENTIAL 2
+#define ENVELOPE_STAGES 4
+#define ENVELOPE_TABLE_BITS 8
+#define ENVELOPE_TABLE_SIZE (1 << ENVELOPE_TABLE_BITS)
+// progress through a segment (q24)
+#define ENVELOPE_PHASE_BITS 24
+#define ENVELOPE_PHASE_ONE (1 << ENVELOPE_PHASE_BITS)
+// how quickly the exponential segment settles, its curve is 1 - e^(-5x)
+// scaled to land on the end
+#define ENVELOPE_EXPONENTIAL_RATE 5.0f
+
+// the cosine and exponential curves from 0 to 65535, with the last point
+// repeated for the interpolation
+uint16_t envelope_curve[2][ENVELOPE_TABLE_SIZE + 1];
+bool envelope_curve_ready = false;
+
+typedef struct EnvelopeStage {
+  int32_t stop;
+  uint32_t increment;
+  uint8_t shape;
+} EnvelopeStage;
+
+typedef struct EnvelopeTable {
+  float rate;
+  EnvelopeStage stage[ENVELOPE_STAGES];
+  uint8_t stages;
+  uint8_t current;
+  // where the current segment started
+  int32_t start;
+  int32_t curr;
+  uint32_t phase;
+} EnvelopeTable;
+
+static void EnvelopeTable_tables() {
+  if (envelope_curve_ready) {
+    return;
+  }
+  float exp_end = 1.0f - expf(-ENVELOPE_EXPONENTIAL_RATE);
+  for (uint16_t i = 0; i <= ENVELOPE_TABLE_SIZE; i++) {
+    float x = (float)i / ENVELOPE_TABLE_SIZE;
+    envelope_curve[ENVELOPE_COSINE - 1][i] =
+        (uint16_t)roundf(65535 * (0.5f - 0.5f * cosf(3.14159265f * x)));
+    envelope_curve[ENVELOPE_EXPONENTIAL - 1][i] = (uint16_t)roundf(
+        65535 * (1.0f - expf(-ENVELOPE_EXPONENTIAL_RATE * x)) / exp_end);
+  }
+  envelope_curve_ready = true;
+}
+
+// the phase increment for a segment of duration seconds, reaching the end
+// on the step Envelope2 would
+static uint32_t EnvelopeTable_increment(float rate, float duration) {
+  float steps = roundf(rate * duration);
+  if (steps < 1) {
+    return ENVELOPE_PHASE_ONE;
+  }
+  return (uint32_t)ceilf((float)ENVELOPE_PHASE_ONE / steps);
+}
+
+// queues a segment to stop after the ones already queued
+bool EnvelopeTable_add(EnvelopeTable *self, float stop, float duration,
+                       uint8_t shape) {
+  if (self->current == self->stages) {
+    self->current = 0;
+    self->stages = 0;
+    self->start = self->curr;
+    self->phase = 0;
+  }
+  if (self->stages == ENVELOPE_STAGES) {
+    return false;
+  }
+  EnvelopeStage *stage = &self->stage[self->stages++];
+  stage->stop = q16_16_float_to_fp(stop);
+  stage->increment = EnvelopeTable_increment(self->rate, duration);
+  stage->shape = shape;
+  return true;
+}
+
+// moves from where it is now to stop, dropping any queued segments
+void EnvelopeTable_goto(EnvelopeTable *self, float stop, float duration,
+                        uint8_t shape) {
+  self->stages = 0;
+  self->current = 0;
+  EnvelopeTable_add(self, stop, duration, shape);
+}
+
+// starts again from start, rate is the number of steps a second
+void EnvelopeTable_reset(EnvelopeTable *self, float rate, float start,
+                         float stop, float duration, uint8_t shape) {
+  self->rate = rate;
+  self->curr = q16_16_float_to_fp(start);
+  EnvelopeTable_goto(self, stop, duration, shape);
+}
+
+EnvelopeTable *EnvelopeTable_create(float rate, float start, float stop,
+                                    float duration, uint8_t shape) {
+  EnvelopeTable_tables();
+  EnvelopeTable *self = (EnvelopeTable *)malloc(sizeof(EnvelopeTable));
+  EnvelopeTable_reset(self, rate, start, stop, duration, shape);
+  return self;
+}
+
+void EnvelopeTable_destroy(EnvelopeTable *self) { free(self); }
+
+bool EnvelopeTable_done(EnvelopeTable *self) {
+  return self->current == self->stages;
+}
+
+int32_t EnvelopeTable_value(EnvelopeTable *self) { return self->curr; }
+
+// the curve of a segment at phase, from 0 to 65535
+static inline int32_t EnvelopeTable_curve(uint8_t shape, uint32_t phase) {
+  if (shape == ENVELOPE_LINEAR) {
+    return phase >> (ENVELOPE_PHASE_BITS - 16);
+  }
+  const uint16_t *curve = envelope_curve[shape - 1];
+  uint32_t i = phase >> (ENVELOPE_PHASE_BITS - ENVELOPE_TABLE_BITS);
+  int32_t frac =
+      (phase >> (ENVELOPE_PHASE_BITS - ENVELOPE_TABLE_BITS - 15)) & 0x7FFF;
+  return curve[i] + (((curve[i + 1] - curve[i]) * frac) >> 15);
+}
+
+// sets the value for the phase of the current segment, or moves on to the
+// next one when it is past the end
+static inline int32_t EnvelopeTable_set(EnvelopeTable *self, uint32_t phase) {
+  EnvelopeStage *stage = &self->stage[self->current];
+  if (phase >= ENVELOPE_PHASE_ONE) {
+    self->curr = stage->stop;
+    self->start = stage->stop;
+    self->phase = 0;
+    self->current++;
+    return self->curr;
+  }
+  self->phase = phase;
+  self->curr =
+      self->start +
+      (int32_t)(((int64_t)(stage->stop - self->start) *
+                 EnvelopeTable_curve(stage->shape, phase)) >>
+                16);
+  return self->curr;
+}
+
+// moves on by steps and returns the value (q16.16)
+int32_t RAM_FUNC(EnvelopeTable_advance)(EnvelopeTable *self, uint32_t steps) {
+  if (self->current == self->stages) {
+    return self->curr;
+  }
+  uint64_t phase =
+      (uint64_t)self->stage[self->current].increment * steps + self->phase;
+  return EnvelopeTable_set(
+      self, phase >= ENVELOPE_PHASE_ONE ? ENVELOPE_PHASE_ONE : phase);
+}
+
+// multiplies n stereo samples by the envelope, a step a sample. the value
+// is a gain of at most 1, and at 1 with nothing queued it costs nothing
+void RAM_FUNC(EnvelopeTable_process)(EnvelopeTable *self, int32_t *samples,
+                                     uint16_t n) {
+  for (uint16_t i = 0; i < n; i++) {
+    if (self->current == self->stages) {
+      if (self->curr == Q16_16_1) {
+        return;
+      }
+      // settled below full, the rest of the block at that gain
+      for (; i < n; i++) {
+        samples[i * 2 + 0] = (samples[i * 2 + 0] >> 16) * self->curr;
+        samples[i * 2 + 1] = (samples[i * 2 + 1] >> 16) * self->curr;
+      }
+      return;
+    }
+    int32_t gain = EnvelopeTable_set(
+        self, self->phase + self->stage[self->current].increment);
+    samples[i * 2 + 0] = (samples[i * 2 + 0] >> 16) * gain;
+    samples[i * 2 + 1] = (samples[i * 2 + 1] >> 16) * gain;
+  }
+}
+
+#endif
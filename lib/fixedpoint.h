@@ -24,6 +24,7 @@
 
 #ifndef FIXEDPOINT_LIB
 #define FIXEDPOINT_LIB 1
+#include "ramfunc.h"
 /* Defines the number of bits used in the Q16.16 fixed-point format. */
 #define Q16_16_Q_BITS 16
 
@@ -52,7 +53,7 @@
 #define Q16_16_FRACTIONAL_BITS (1 << Q16_16_Q_BITS)
 
 /* Converts a Q16.16 fixed-point value to an int16. */
-int16_t q16_16_fp_to_int16(int32_t fixedValue) {
+int16_t RAM_FUNC(q16_16_fp_to_int16)(int32_t fixedValue) {
   /* Shift the fixed-point value right by the number of Q-bits to obtain the
      integral part of the value. */
   return (int16_t)(fixedValue >> Q16_16_Q_BITS);
@@ -90,7 +91,7 @@ int32_t q16_16_int32_to_fp(int32_t value) {
 }
 
 /* Multiplies two Q16.16 fixed-point values. */
-int32_t q16_16_multiply(int32_t a, int32_t b) {
+int32_t RAM_FUNC(q16_16_multiply)(int32_t a, int32_t b) {
   /* Multiply the two fixed-point values and shift the result right by the
      number of Q-bits to obtain the product. */
   return (int32_t)(((int64_t)a * b) >> Q16_16_Q_BITS);
@@ -101,7 +102,7 @@ int32_t q16_16_divide(int32_t a, int32_t b) {
   return (int32_t)(((int64_t)a << Q16_16_Q_BITS) / b);
 }
 
-int32_t q16_16_sin(int32_t fixedValue) {
+int32_t RAM_FUNC(q16_16_sin)(int32_t fixedValue) {
   uint8_t negative = 0;
   while (fixedValue < Q16_16_0) {
     fixedValue += Q16_16_PI;
@@ -128,7 +129,7 @@ int32_t q16_16_sin(int32_t fixedValue) {
   return sin5;
 }
 
-int32_t q16_16_sin01(int32_t fixedValue) {
+int32_t RAM_FUNC(q16_16_sin01)(int32_t fixedValue) {
   int32_t sin5 = q16_16_sin(fixedValue);
   return q16_16_multiply(Q16_16_0_5, sin5) + Q16_16_0_5;
 }
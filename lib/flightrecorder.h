@@ -0,0 +1,215 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_FLIGHTRECORDER_H_
+#define LIB_FLIGHTRECORDER_H_
+
+// FlightRecorder keeps a ring of compact per-block snapshots from the audio
+// callback. when a block takes longer than US_PER_BLOCK it records
+// FLIGHTRECORDER_POST more blocks and then freezes, so the ring holds the
+// blocks leading up to and following the overrun. core0 writes the frozen
+// ring to /flightNN.bin and unfreezes it. decode the file with
+// dev/flightrecorder.py.
+
+#define FLIGHTRECORDER_RECORDS 64
+#define FLIGHTRECORDER_POST 8
+#define FLIGHTRECORDER_STAGES 10
+#define FLIGHTRECORDER_FILES 100
+#define FLIGHTRECORDER_MAGIC 0x31544C46  // "FLT1"
+
+#define FLIGHTRECORD_MUTED 0x0001
+#define FLIGHTRECORD_STEREO 0x0002
+#define FLIGHTRECORD_REVERSE 0x0004
+#define FLIGHTRECORD_CROSSFADE 0x0008
+#define FLIGHTRECORD_FADE_IN 0x0010
+#define FLIGHTRECORD_FADE_OUT 0x0020
+#define FLIGHTRECORD_OPEN_FILE 0x0040
+#define FLIGHTRECORD_FILE_OPEN 0x0080
+#define FLIGHTRECORD_QUADRATIC 0x0100
+#define FLIGHTRECORD_SD_BUSY 0x0200
+#define FLIGHTRECORD_REDUCE_CPU 0x0400
+#define FLIGHTRECORD_SD_RETRY 0x0800
+#define FLIGHTRECORD_OVERRUN 0x8000
+
+// 52 bytes, laid out so the file can be read without padding surprises
+typedef struct FlightRecord {
+  uint32_t block;
+  int32_t phase;
+  // bit n is set when fx n is active
+  uint32_t fx_active;
+  uint16_t total_us;
+  uint16_t sd_us;
+  uint16_t take_us;
+  uint16_t give_us;
+  uint16_t values_to_read;
+  uint16_t flags;
+  uint8_t bank;
+  uint8_t sample;
+  uint8_t variation;
+  uint8_t retrig_pitch;
+  uint8_t pitch_val_index;
+  // envelope_pitch_val * 100
+  uint8_t envelope_pitch;
+  uint16_t bpm;
+  // per-stage time in us, from the profiler when it is included
+  uint16_t stage_us[FLIGHTRECORDER_STAGES];
+} FlightRecord;
+
+typedef struct FlightRecorderHeader {
+  uint32_t magic;
+  uint16_t record_size;
+  uint16_t records;
+  uint16_t trigger;
+  uint16_t us_per_block;
+  uint32_t dumps;
+} FlightRecorderHeader;
+
+typedef struct FlightRecorder {
+  FlightRecord ring[FLIGHTRECORDER_RECORDS];
+  uint16_t head;
+  uint32_t block;
+  uint16_t post;
+  uint16_t trigger;
+  bool triggered;
+  // set by the audio core, cleared by core0 once the ring is written
+  volatile bool frozen;
+  uint32_t dumps;
+  uint8_t file_index;
+} FlightRecorder;
+
+FlightRecorder *FlightRecorder_malloc() {
+  FlightRecorder *self = (FlightRecorder *)malloc(sizeof(FlightRecorder));
+  memset(self->ring, 0, sizeof(self->ring));
+  self->head = 0;
+  self->block = 0;
+  self->post = 0;
+  self->trigger = 0;
+  self->triggered = false;
+  self->frozen = false;
+  self->dumps = 0;
+  self->file_index = 0;
+  return self;
+}
+
+void FlightRecorder_free(FlightRecorder *self) { free(self); }
+
+// returns the slot for this block, or NULL while the ring is frozen
+static inline FlightRecord *FlightRecorder_next(FlightRecorder *self) {
+  if (self->frozen) {
+    return NULL;
+  }
+  FlightRecord *r = &self->ring[self->head];
+  r->block = self->block;
+  return r;
+}
+
+// called by the audio core once the slot from FlightRecorder_next is filled
+void FlightRecorder_commit(FlightRecorder *self, uint32_t us_per_block) {
+  if (self->frozen) {
+    return;
+  }
+  FlightRecord *r = &self->ring[self->head];
+  if (r->total_us > us_per_block) {
+    r->flags |= FLIGHTRECORD_OVERRUN;
+    if (!self->triggered) {
+      self->triggered = true;
+      self->trigger = self->head;
+      self->post = FLIGHTRECORDER_POST;
+    }
+  }
+  self->head = (self->head + 1) % FLIGHTRECORDER_RECORDS;
+  self->block++;
+  if (self->triggered) {
+    if (self->post == 0) {
+      __dmb();
+      self->frozen = true;
+    } else {
+      self->post--;
+    }
+  }
+}
+
+#ifdef INCLUDE_PROFILER
+void FlightRecorder_stages(FlightRecord *r, Profiler *profiler) {
+  uint32_t mhz = clock_get_hz(clk_sys) / 1000000;
+  for (uint8_t i = 0; i < FLIGHTRECORDER_STAGES; i++) {
+    uint32_t us = profiler->block[i] / mhz;
+    r->stage_us[i] = us > 0xFFFF ? 0xFFFF : us;
+  }
+}
+#endif
+
+#ifndef NOSDCARD
+
+// called from core0, writes the ring oldest first. the card is shared with the
+// audio core, so this takes sync_sd_card like SaveFile_save and the audio
+// core stays muted until it is done.
+bool FlightRecorder_write(FlightRecorder *self, bool *sync_sd_card) {
+  if (!self->frozen) {
+    return false;
+  }
+  while (*sync_sd_card) {
+    sleep_us(100);
+  }
+  *sync_sd_card = true;
+  char fname[16];
+  sprintf(fname, "/flight%02d.bin", self->file_index);
+  FIL file;
+  FRESULT fr = f_open(&file, fname, FA_WRITE | FA_CREATE_ALWAYS);
+  if (FR_OK != fr) {
+    printf("[FlightRecorder] f_open error: %s (%d)\n", FRESULT_str(fr), fr);
+    *sync_sd_card = false;
+    return false;
+  }
+  FlightRecorderHeader header = {
+      .magic = FLIGHTRECORDER_MAGIC,
+      .record_size = sizeof(FlightRecord),
+      .records = FLIGHTRECORDER_RECORDS,
+      // position of the overrun in the written (oldest first) order
+      .trigger = (self->trigger + FLIGHTRECORDER_RECORDS - self->head) %
+                 FLIGHTRECORDER_RECORDS,
+      .us_per_block = US_PER_BLOCK,
+      .dumps = self->dumps,
+  };
+  unsigned int bw;
+  f_write(&file, &header, sizeof(header), &bw);
+  // head is the oldest record once the ring has wrapped
+  f_write(&file, &self->ring[self->head],
+          sizeof(FlightRecord) * (FLIGHTRECORDER_RECORDS - self->head), &bw);
+  f_write(&file, self->ring, sizeof(FlightRecord) * self->head, &bw);
+  f_close(&file);
+  *sync_sd_card = false;
+  printf("[FlightRecorder] wrote %s\n", fname);
+
+  self->file_index = (self->file_index + 1) % FLIGHTRECORDER_FILES;
+  self->dumps++;
+  self->triggered = false;
+  __dmb();
+  self->frozen = false;
+  return true;
+}
+
+#endif
+
+#endif
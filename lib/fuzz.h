@@ -2,2997 +2,80 @@
 #define LIB_FUZZ 1
 #include <stdint.h>
 
-const int16_t __in_flash() fuzz_samples[32768] = {
-    0,     5,     10,    16,    21,    27,    32,    37,    43,    48,    54,
-    59,    64,    70,    75,    80,    86,    91,    97,    102,   107,   113,
-    118,   124,   129,   134,   140,   145,   150,   156,   161,   166,   172,
-    177,   183,   188,   193,   199,   204,   209,   215,   220,   225,   231,
-    236,   241,   247,   252,   257,   263,   268,   273,   279,   284,   289,
-    295,   300,   305,   310,   316,   321,   326,   332,   337,   342,   348,
-    353,   358,   363,   369,   374,   379,   385,   390,   395,   400,   406,
-    411,   416,   422,   427,   432,   437,   443,   448,   453,   458,   464,
-    469,   474,   480,   485,   490,   495,   501,   506,   511,   516,   522,
-    527,   532,   537,   542,   548,   553,   558,   563,   569,   574,   579,
-    584,   590,   595,   600,   605,   610,   616,   621,   626,   631,   636,
-    642,   647,   652,   657,   662,   668,   673,   678,   683,   688,   694,
-    699,   704,   709,   714,   719,   725,   730,   735,   740,   745,   751,
-    756,   761,   766,   771,   776,   782,   787,   792,   797,   802,   807,
-    812,   818,   823,   828,   833,   838,   843,   848,   854,   859,   864,
-    869,   874,   879,   884,   889,   895,   900,   905,   910,   915,   920,
-    925,   930,   936,   941,   946,   951,   956,   961,   966,   971,   976,
-    981,   987,   992,   997,   1002,  1007,  1012,  1017,  1022,  1027,  1032,
-    1037,  1042,  1048,  1053,  1058,  1063,  1068,  1073,  1078,  1083,  1088,
-    1093,  1098,  1103,  1108,  1113,  1118,  1123,  1128,  1134,  1139,  1144,
-    1149,  1154,  1159,  1164,  1169,  1174,  1179,  1184,  1189,  1194,  1199,
-    1204,  1209,  1214,  1219,  1224,  1229,  1234,  1239,  1244,  1249,  1254,
-    1259,  1264,  1269,  1274,  1279,  1284,  1289,  1294,  1299,  1304,  1309,
-    1314,  1319,  1324,  1329,  1334,  1339,  1344,  1349,  1354,  1359,  1364,
-    1369,  1374,  1379,  1384,  1389,  1394,  1399,  1404,  1409,  1414,  1419,
-    1423,  1428,  1433,  1438,  1443,  1448,  1453,  1458,  1463,  1468,  1473,
-    1478,  1483,  1488,  1493,  1498,  1503,  1507,  1512,  1517,  1522,  1527,
-    1532,  1537,  1542,  1547,  1552,  1557,  1562,  1566,  1571,  1576,  1581,
-    1586,  1591,  1596,  1601,  1606,  1611,  1615,  1620,  1625,  1630,  1635,
-    1640,  1645,  1650,  1655,  1659,  1664,  1669,  1674,  1679,  1684,  1689,
-    1694,  1698,  1703,  1708,  1713,  1718,  1723,  1728,  1732,  1737,  1742,
-    1747,  1752,  1757,  1762,  1766,  1771,  1776,  1781,  1786,  1791,  1795,
-    1800,  1805,  1810,  1815,  1820,  1824,  1829,  1834,  1839,  1844,  1849,
-    1853,  1858,  1863,  1868,  1873,  1877,  1882,  1887,  1892,  1897,  1902,
-    1906,  1911,  1916,  1921,  1926,  1930,  1935,  1940,  1945,  1950,  1954,
-    1959,  1964,  1969,  1973,  1978,  1983,  1988,  1993,  1997,  2002,  2007,
-    2012,  2016,  2021,  2026,  2031,  2035,  2040,  2045,  2050,  2055,  2059,
-    2064,  2069,  2074,  2078,  2083,  2088,  2093,  2097,  2102,  2107,  2111,
-    2116,  2121,  2126,  2130,  2135,  2140,  2145,  2149,  2154,  2159,  2164,
-    2168,  2173,  2178,  2182,  2187,  2192,  2197,  2201,  2206,  2211,  2215,
-    2220,  2225,  2229,  2234,  2239,  2244,  2248,  2253,  2258,  2262,  2267,
-    2272,  2276,  2281,  2286,  2291,  2295,  2300,  2305,  2309,  2314,  2319,
-    2323,  2328,  2333,  2337,  2342,  2347,  2351,  2356,  2361,  2365,  2370,
-    2375,  2379,  2384,  2389,  2393,  2398,  2403,  2407,  2412,  2416,  2421,
-    2426,  2430,  2435,  2440,  2444,  2449,  2454,  2458,  2463,  2467,  2472,
-    2477,  2481,  2486,  2491,  2495,  2500,  2504,  2509,  2514,  2518,  2523,
-    2528,  2532,  2537,  2541,  2546,  2551,  2555,  2560,  2564,  2569,  2574,
-    2578,  2583,  2587,  2592,  2597,  2601,  2606,  2610,  2615,  2619,  2624,
-    2629,  2633,  2638,  2642,  2647,  2652,  2656,  2661,  2665,  2670,  2674,
-    2679,  2684,  2688,  2693,  2697,  2702,  2706,  2711,  2715,  2720,  2725,
-    2729,  2734,  2738,  2743,  2747,  2752,  2756,  2761,  2765,  2770,  2775,
-    2779,  2784,  2788,  2793,  2797,  2802,  2806,  2811,  2815,  2820,  2824,
-    2829,  2833,  2838,  2842,  2847,  2851,  2856,  2860,  2865,  2870,  2874,
-    2879,  2883,  2888,  2892,  2897,  2901,  2906,  2910,  2915,  2919,  2924,
-    2928,  2932,  2937,  2941,  2946,  2950,  2955,  2959,  2964,  2968,  2973,
-    2977,  2982,  2986,  2991,  2995,  3000,  3004,  3009,  3013,  3018,  3022,
-    3026,  3031,  3035,  3040,  3044,  3049,  3053,  3058,  3062,  3067,  3071,
-    3075,  3080,  3084,  3089,  3093,  3098,  3102,  3107,  3111,  3115,  3120,
-    3124,  3129,  3133,  3138,  3142,  3146,  3151,  3155,  3160,  3164,  3169,
-    3173,  3177,  3182,  3186,  3191,  3195,  3199,  3204,  3208,  3213,  3217,
-    3221,  3226,  3230,  3235,  3239,  3243,  3248,  3252,  3257,  3261,  3265,
-    3270,  3274,  3279,  3283,  3287,  3292,  3296,  3301,  3305,  3309,  3314,
-    3318,  3322,  3327,  3331,  3336,  3340,  3344,  3349,  3353,  3357,  3362,
-    3366,  3370,  3375,  3379,  3383,  3388,  3392,  3397,  3401,  3405,  3410,
-    3414,  3418,  3423,  3427,  3431,  3436,  3440,  3444,  3449,  3453,  3457,
-    3462,  3466,  3470,  3475,  3479,  3483,  3488,  3492,  3496,  3501,  3505,
-    3509,  3514,  3518,  3522,  3527,  3531,  3535,  3539,  3544,  3548,  3552,
-    3557,  3561,  3565,  3570,  3574,  3578,  3582,  3587,  3591,  3595,  3600,
-    3604,  3608,  3613,  3617,  3621,  3625,  3630,  3634,  3638,  3642,  3647,
-    3651,  3655,  3660,  3664,  3668,  3672,  3677,  3681,  3685,  3689,  3694,
-    3698,  3702,  3707,  3711,  3715,  3719,  3724,  3728,  3732,  3736,  3741,
-    3745,  3749,  3753,  3758,  3762,  3766,  3770,  3775,  3779,  3783,  3787,
-    3791,  3796,  3800,  3804,  3808,  3813,  3817,  3821,  3825,  3830,  3834,
-    3838,  3842,  3846,  3851,  3855,  3859,  3863,  3868,  3872,  3876,  3880,
-    3884,  3889,  3893,  3897,  3901,  3905,  3910,  3914,  3918,  3922,  3926,
-    3931,  3935,  3939,  3943,  3947,  3952,  3956,  3960,  3964,  3968,  3972,
-    3977,  3981,  3985,  3989,  3993,  3998,  4002,  4006,  4010,  4014,  4018,
-    4023,  4027,  4031,  4035,  4039,  4043,  4048,  4052,  4056,  4060,  4064,
-    4068,  4072,  4077,  4081,  4085,  4089,  4093,  4097,  4102,  4106,  4110,
-    4114,  4118,  4122,  4126,  4131,  4135,  4139,  4143,  4147,  4151,  4155,
-    4159,  4164,  4168,  4172,  4176,  4180,  4184,  4188,  4192,  4197,  4201,
-    4205,  4209,  4213,  4217,  4221,  4225,  4229,  4234,  4238,  4242,  4246,
-    4250,  4254,  4258,  4262,  4266,  4270,  4275,  4279,  4283,  4287,  4291,
-    4295,  4299,  4303,  4307,  4311,  4315,  4320,  4324,  4328,  4332,  4336,
-    4340,  4344,  4348,  4352,  4356,  4360,  4364,  4368,  4373,  4377,  4381,
-    4385,  4389,  4393,  4397,  4401,  4405,  4409,  4413,  4417,  4421,  4425,
-    4429,  4433,  4437,  4442,  4446,  4450,  4454,  4458,  4462,  4466,  4470,
-    4474,  4478,  4482,  4486,  4490,  4494,  4498,  4502,  4506,  4510,  4514,
-    4518,  4522,  4526,  4530,  4534,  4538,  4542,  4546,  4550,  4554,  4558,
-    4562,  4566,  4570,  4574,  4578,  4582,  4586,  4590,  4594,  4598,  4602,
-    4606,  4610,  4614,  4618,  4622,  4626,  4630,  4634,  4638,  4642,  4646,
-    4650,  4654,  4658,  4662,  4666,  4670,  4674,  4678,  4682,  4686,  4690,
-    4694,  4698,  4702,  4706,  4710,  4714,  4718,  4722,  4726,  4730,  4734,
-    4738,  4742,  4746,  4750,  4754,  4758,  4762,  4766,  4770,  4774,  4777,
-    4781,  4785,  4789,  4793,  4797,  4801,  4805,  4809,  4813,  4817,  4821,
-    4825,  4829,  4833,  4837,  4841,  4845,  4848,  4852,  4856,  4860,  4864,
-    4868,  4872,  4876,  4880,  4884,  4888,  4892,  4896,  4899,  4903,  4907,
-    4911,  4915,  4919,  4923,  4927,  4931,  4935,  4939,  4943,  4946,  4950,
-    4954,  4958,  4962,  4966,  4970,  4974,  4978,  4982,  4985,  4989,  4993,
-    4997,  5001,  5005,  5009,  5013,  5017,  5020,  5024,  5028,  5032,  5036,
-    5040,  5044,  5048,  5051,  5055,  5059,  5063,  5067,  5071,  5075,  5079,
-    5082,  5086,  5090,  5094,  5098,  5102,  5106,  5109,  5113,  5117,  5121,
-    5125,  5129,  5133,  5136,  5140,  5144,  5148,  5152,  5156,  5160,  5163,
-    5167,  5171,  5175,  5179,  5183,  5186,  5190,  5194,  5198,  5202,  5206,
-    5209,  5213,  5217,  5221,  5225,  5229,  5232,  5236,  5240,  5244,  5248,
-    5252,  5255,  5259,  5263,  5267,  5271,  5274,  5278,  5282,  5286,  5290,
-    5294,  5297,  5301,  5305,  5309,  5313,  5316,  5320,  5324,  5328,  5332,
-    5335,  5339,  5343,  5347,  5351,  5354,  5358,  5362,  5366,  5369,  5373,
-    5377,  5381,  5385,  5388,  5392,  5396,  5400,  5404,  5407,  5411,  5415,
-    5419,  5422,  5426,  5430,  5434,  5437,  5441,  5445,  5449,  5453,  5456,
-    5460,  5464,  5468,  5471,  5475,  5479,  5483,  5486,  5490,  5494,  5498,
-    5501,  5505,  5509,  5513,  5516,  5520,  5524,  5528,  5531,  5535,  5539,
-    5543,  5546,  5550,  5554,  5558,  5561,  5565,  5569,  5572,  5576,  5580,
-    5584,  5587,  5591,  5595,  5599,  5602,  5606,  5610,  5613,  5617,  5621,
-    5625,  5628,  5632,  5636,  5639,  5643,  5647,  5651,  5654,  5658,  5662,
-    5665,  5669,  5673,  5677,  5680,  5684,  5688,  5691,  5695,  5699,  5702,
-    5706,  5710,  5714,  5717,  5721,  5725,  5728,  5732,  5736,  5739,  5743,
-    5747,  5750,  5754,  5758,  5761,  5765,  5769,  5773,  5776,  5780,  5784,
-    5787,  5791,  5795,  5798,  5802,  5806,  5809,  5813,  5817,  5820,  5824,
-    5828,  5831,  5835,  5839,  5842,  5846,  5850,  5853,  5857,  5860,  5864,
-    5868,  5871,  5875,  5879,  5882,  5886,  5890,  5893,  5897,  5901,  5904,
-    5908,  5912,  5915,  5919,  5922,  5926,  5930,  5933,  5937,  5941,  5944,
-    5948,  5952,  5955,  5959,  5962,  5966,  5970,  5973,  5977,  5981,  5984,
-    5988,  5991,  5995,  5999,  6002,  6006,  6009,  6013,  6017,  6020,  6024,
-    6028,  6031,  6035,  6038,  6042,  6046,  6049,  6053,  6056,  6060,  6064,
-    6067,  6071,  6074,  6078,  6082,  6085,  6089,  6092,  6096,  6099,  6103,
-    6107,  6110,  6114,  6117,  6121,  6125,  6128,  6132,  6135,  6139,  6142,
-    6146,  6150,  6153,  6157,  6160,  6164,  6167,  6171,  6175,  6178,  6182,
-    6185,  6189,  6192,  6196,  6200,  6203,  6207,  6210,  6214,  6217,  6221,
-    6224,  6228,  6232,  6235,  6239,  6242,  6246,  6249,  6253,  6256,  6260,
-    6264,  6267,  6271,  6274,  6278,  6281,  6285,  6288,  6292,  6295,  6299,
-    6302,  6306,  6310,  6313,  6317,  6320,  6324,  6327,  6331,  6334,  6338,
-    6341,  6345,  6348,  6352,  6355,  6359,  6362,  6366,  6369,  6373,  6377,
-    6380,  6384,  6387,  6391,  6394,  6398,  6401,  6405,  6408,  6412,  6415,
-    6419,  6422,  6426,  6429,  6433,  6436,  6440,  6443,  6447,  6450,  6454,
-    6457,  6461,  6464,  6468,  6471,  6475,  6478,  6482,  6485,  6489,  6492,
-    6495,  6499,  6502,  6506,  6509,  6513,  6516,  6520,  6523,  6527,  6530,
-    6534,  6537,  6541,  6544,  6548,  6551,  6555,  6558,  6562,  6565,  6568,
-    6572,  6575,  6579,  6582,  6586,  6589,  6593,  6596,  6600,  6603,  6606,
-    6610,  6613,  6617,  6620,  6624,  6627,  6631,  6634,  6638,  6641,  6644,
-    6648,  6651,  6655,  6658,  6662,  6665,  6669,  6672,  6675,  6679,  6682,
-    6686,  6689,  6693,  6696,  6699,  6703,  6706,  6710,  6713,  6717,  6720,
-    6723,  6727,  6730,  6734,  6737,  6741,  6744,  6747,  6751,  6754,  6758,
-    6761,  6764,  6768,  6771,  6775,  6778,  6781,  6785,  6788,  6792,  6795,
-    6799,  6802,  6805,  6809,  6812,  6816,  6819,  6822,  6826,  6829,  6832,
-    6836,  6839,  6843,  6846,  6849,  6853,  6856,  6860,  6863,  6866,  6870,
-    6873,  6877,  6880,  6883,  6887,  6890,  6893,  6897,  6900,  6904,  6907,
-    6910,  6914,  6917,  6920,  6924,  6927,  6931,  6934,  6937,  6941,  6944,
-    6947,  6951,  6954,  6958,  6961,  6964,  6968,  6971,  6974,  6978,  6981,
-    6984,  6988,  6991,  6994,  6998,  7001,  7004,  7008,  7011,  7015,  7018,
-    7021,  7025,  7028,  7031,  7035,  7038,  7041,  7045,  7048,  7051,  7055,
-    7058,  7061,  7065,  7068,  7071,  7075,  7078,  7081,  7085,  7088,  7091,
-    7095,  7098,  7101,  7105,  7108,  7111,  7115,  7118,  7121,  7125,  7128,
-    7131,  7134,  7138,  7141,  7144,  7148,  7151,  7154,  7158,  7161,  7164,
-    7168,  7171,  7174,  7178,  7181,  7184,  7187,  7191,  7194,  7197,  7201,
-    7204,  7207,  7211,  7214,  7217,  7220,  7224,  7227,  7230,  7234,  7237,
-    7240,  7243,  7247,  7250,  7253,  7257,  7260,  7263,  7266,  7270,  7273,
-    7276,  7280,  7283,  7286,  7289,  7293,  7296,  7299,  7303,  7306,  7309,
-    7312,  7316,  7319,  7322,  7325,  7329,  7332,  7335,  7338,  7342,  7345,
-    7348,  7352,  7355,  7358,  7361,  7365,  7368,  7371,  7374,  7378,  7381,
-    7384,  7387,  7391,  7394,  7397,  7400,  7404,  7407,  7410,  7413,  7417,
-    7420,  7423,  7426,  7430,  7433,  7436,  7439,  7443,  7446,  7449,  7452,
-    7455,  7459,  7462,  7465,  7468,  7472,  7475,  7478,  7481,  7485,  7488,
-    7491,  7494,  7497,  7501,  7504,  7507,  7510,  7514,  7517,  7520,  7523,
-    7526,  7530,  7533,  7536,  7539,  7542,  7546,  7549,  7552,  7555,  7559,
-    7562,  7565,  7568,  7571,  7575,  7578,  7581,  7584,  7587,  7591,  7594,
-    7597,  7600,  7603,  7607,  7610,  7613,  7616,  7619,  7623,  7626,  7629,
-    7632,  7635,  7638,  7642,  7645,  7648,  7651,  7654,  7658,  7661,  7664,
-    7667,  7670,  7673,  7677,  7680,  7683,  7686,  7689,  7693,  7696,  7699,
-    7702,  7705,  7708,  7712,  7715,  7718,  7721,  7724,  7727,  7731,  7734,
-    7737,  7740,  7743,  7746,  7750,  7753,  7756,  7759,  7762,  7765,  7769,
-    7772,  7775,  7778,  7781,  7784,  7787,  7791,  7794,  7797,  7800,  7803,
-    7806,  7809,  7813,  7816,  7819,  7822,  7825,  7828,  7831,  7835,  7838,
-    7841,  7844,  7847,  7850,  7853,  7857,  7860,  7863,  7866,  7869,  7872,
-    7875,  7878,  7882,  7885,  7888,  7891,  7894,  7897,  7900,  7903,  7907,
-    7910,  7913,  7916,  7919,  7922,  7925,  7928,  7931,  7935,  7938,  7941,
-    7944,  7947,  7950,  7953,  7956,  7959,  7963,  7966,  7969,  7972,  7975,
-    7978,  7981,  7984,  7987,  7991,  7994,  7997,  8000,  8003,  8006,  8009,
-    8012,  8015,  8018,  8021,  8025,  8028,  8031,  8034,  8037,  8040,  8043,
-    8046,  8049,  8052,  8055,  8059,  8062,  8065,  8068,  8071,  8074,  8077,
-    8080,  8083,  8086,  8089,  8092,  8095,  8099,  8102,  8105,  8108,  8111,
-    8114,  8117,  8120,  8123,  8126,  8129,  8132,  8135,  8138,  8141,  8145,
-    8148,  8151,  8154,  8157,  8160,  8163,  8166,  8169,  8172,  8175,  8178,
-    8181,  8184,  8187,  8190,  8193,  8196,  8200,  8203,  8206,  8209,  8212,
-    8215,  8218,  8221,  8224,  8227,  8230,  8233,  8236,  8239,  8242,  8245,
-    8248,  8251,  8254,  8257,  8260,  8263,  8266,  8269,  8272,  8275,  8278,
-    8282,  8285,  8288,  8291,  8294,  8297,  8300,  8303,  8306,  8309,  8312,
-    8315,  8318,  8321,  8324,  8327,  8330,  8333,  8336,  8339,  8342,  8345,
-    8348,  8351,  8354,  8357,  8360,  8363,  8366,  8369,  8372,  8375,  8378,
-    8381,  8384,  8387,  8390,  8393,  8396,  8399,  8402,  8405,  8408,  8411,
-    8414,  8417,  8420,  8423,  8426,  8429,  8432,  8435,  8438,  8441,  8444,
-    8447,  8450,  8453,  8456,  8459,  8462,  8465,  8468,  8471,  8474,  8477,
-    8480,  8483,  8486,  8489,  8492,  8495,  8498,  8501,  8504,  8506,  8509,
-    8512,  8515,  8518,  8521,  8524,  8527,  8530,  8533,  8536,  8539,  8542,
-    8545,  8548,  8551,  8554,  8557,  8560,  8563,  8566,  8569,  8572,  8575,
-    8578,  8581,  8584,  8586,  8589,  8592,  8595,  8598,  8601,  8604,  8607,
-    8610,  8613,  8616,  8619,  8622,  8625,  8628,  8631,  8634,  8637,  8639,
-    8642,  8645,  8648,  8651,  8654,  8657,  8660,  8663,  8666,  8669,  8672,
-    8675,  8678,  8681,  8684,  8686,  8689,  8692,  8695,  8698,  8701,  8704,
-    8707,  8710,  8713,  8716,  8719,  8722,  8724,  8727,  8730,  8733,  8736,
-    8739,  8742,  8745,  8748,  8751,  8754,  8757,  8759,  8762,  8765,  8768,
-    8771,  8774,  8777,  8780,  8783,  8786,  8788,  8791,  8794,  8797,  8800,
-    8803,  8806,  8809,  8812,  8815,  8817,  8820,  8823,  8826,  8829,  8832,
-    8835,  8838,  8841,  8844,  8846,  8849,  8852,  8855,  8858,  8861,  8864,
-    8867,  8870,  8872,  8875,  8878,  8881,  8884,  8887,  8890,  8893,  8895,
-    8898,  8901,  8904,  8907,  8910,  8913,  8916,  8918,  8921,  8924,  8927,
-    8930,  8933,  8936,  8939,  8941,  8944,  8947,  8950,  8953,  8956,  8959,
-    8961,  8964,  8967,  8970,  8973,  8976,  8979,  8981,  8984,  8987,  8990,
-    8993,  8996,  8999,  9001,  9004,  9007,  9010,  9013,  9016,  9019,  9021,
-    9024,  9027,  9030,  9033,  9036,  9038,  9041,  9044,  9047,  9050,  9053,
-    9056,  9058,  9061,  9064,  9067,  9070,  9073,  9075,  9078,  9081,  9084,
-    9087,  9090,  9092,  9095,  9098,  9101,  9104,  9107,  9109,  9112,  9115,
-    9118,  9121,  9123,  9126,  9129,  9132,  9135,  9138,  9140,  9143,  9146,
-    9149,  9152,  9154,  9157,  9160,  9163,  9166,  9169,  9171,  9174,  9177,
-    9180,  9183,  9185,  9188,  9191,  9194,  9197,  9199,  9202,  9205,  9208,
-    9211,  9213,  9216,  9219,  9222,  9225,  9227,  9230,  9233,  9236,  9239,
-    9241,  9244,  9247,  9250,  9253,  9255,  9258,  9261,  9264,  9267,  9269,
-    9272,  9275,  9278,  9281,  9283,  9286,  9289,  9292,  9294,  9297,  9300,
-    9303,  9306,  9308,  9311,  9314,  9317,  9319,  9322,  9325,  9328,  9331,
-    9333,  9336,  9339,  9342,  9344,  9347,  9350,  9353,  9356,  9358,  9361,
-    9364,  9367,  9369,  9372,  9375,  9378,  9380,  9383,  9386,  9389,  9391,
-    9394,  9397,  9400,  9402,  9405,  9408,  9411,  9413,  9416,  9419,  9422,
-    9425,  9427,  9430,  9433,  9436,  9438,  9441,  9444,  9447,  9449,  9452,
-    9455,  9457,  9460,  9463,  9466,  9468,  9471,  9474,  9477,  9479,  9482,
-    9485,  9488,  9490,  9493,  9496,  9499,  9501,  9504,  9507,  9510,  9512,
-    9515,  9518,  9520,  9523,  9526,  9529,  9531,  9534,  9537,  9540,  9542,
-    9545,  9548,  9550,  9553,  9556,  9559,  9561,  9564,  9567,  9569,  9572,
-    9575,  9578,  9580,  9583,  9586,  9588,  9591,  9594,  9597,  9599,  9602,
-    9605,  9607,  9610,  9613,  9616,  9618,  9621,  9624,  9626,  9629,  9632,
-    9635,  9637,  9640,  9643,  9645,  9648,  9651,  9653,  9656,  9659,  9662,
-    9664,  9667,  9670,  9672,  9675,  9678,  9680,  9683,  9686,  9688,  9691,
-    9694,  9697,  9699,  9702,  9705,  9707,  9710,  9713,  9715,  9718,  9721,
-    9723,  9726,  9729,  9731,  9734,  9737,  9739,  9742,  9745,  9747,  9750,
-    9753,  9756,  9758,  9761,  9764,  9766,  9769,  9772,  9774,  9777,  9780,
-    9782,  9785,  9788,  9790,  9793,  9796,  9798,  9801,  9804,  9806,  9809,
-    9812,  9814,  9817,  9820,  9822,  9825,  9828,  9830,  9833,  9835,  9838,
-    9841,  9843,  9846,  9849,  9851,  9854,  9857,  9859,  9862,  9865,  9867,
-    9870,  9873,  9875,  9878,  9881,  9883,  9886,  9888,  9891,  9894,  9896,
-    9899,  9902,  9904,  9907,  9910,  9912,  9915,  9918,  9920,  9923,  9925,
-    9928,  9931,  9933,  9936,  9939,  9941,  9944,  9947,  9949,  9952,  9954,
-    9957,  9960,  9962,  9965,  9968,  9970,  9973,  9975,  9978,  9981,  9983,
-    9986,  9989,  9991,  9994,  9996,  9999,  10002, 10004, 10007, 10009, 10012,
-    10015, 10017, 10020, 10023, 10025, 10028, 10030, 10033, 10036, 10038, 10041,
-    10043, 10046, 10049, 10051, 10054, 10056, 10059, 10062, 10064, 10067, 10069,
-    10072, 10075, 10077, 10080, 10082, 10085, 10088, 10090, 10093, 10095, 10098,
-    10101, 10103, 10106, 10108, 10111, 10114, 10116, 10119, 10121, 10124, 10127,
-    10129, 10132, 10134, 10137, 10140, 10142, 10145, 10147, 10150, 10152, 10155,
-    10158, 10160, 10163, 10165, 10168, 10171, 10173, 10176, 10178, 10181, 10183,
-    10186, 10189, 10191, 10194, 10196, 10199, 10201, 10204, 10207, 10209, 10212,
-    10214, 10217, 10219, 10222, 10225, 10227, 10230, 10232, 10235, 10237, 10240,
-    10243, 10245, 10248, 10250, 10253, 10255, 10258, 10260, 10263, 10266, 10268,
-    10271, 10273, 10276, 10278, 10281, 10283, 10286, 10289, 10291, 10294, 10296,
-    10299, 10301, 10304, 10306, 10309, 10312, 10314, 10317, 10319, 10322, 10324,
-    10327, 10329, 10332, 10334, 10337, 10340, 10342, 10345, 10347, 10350, 10352,
-    10355, 10357, 10360, 10362, 10365, 10367, 10370, 10373, 10375, 10378, 10380,
-    10383, 10385, 10388, 10390, 10393, 10395, 10398, 10400, 10403, 10405, 10408,
-    10410, 10413, 10415, 10418, 10421, 10423, 10426, 10428, 10431, 10433, 10436,
-    10438, 10441, 10443, 10446, 10448, 10451, 10453, 10456, 10458, 10461, 10463,
-    10466, 10468, 10471, 10473, 10476, 10478, 10481, 10483, 10486, 10488, 10491,
-    10493, 10496, 10498, 10501, 10503, 10506, 10508, 10511, 10514, 10516, 10519,
-    10521, 10524, 10526, 10529, 10531, 10534, 10536, 10538, 10541, 10543, 10546,
-    10548, 10551, 10553, 10556, 10558, 10561, 10563, 10566, 10568, 10571, 10573,
-    10576, 10578, 10581, 10583, 10586, 10588, 10591, 10593, 10596, 10598, 10601,
-    10603, 10606, 10608, 10611, 10613, 10616, 10618, 10621, 10623, 10626, 10628,
-    10630, 10633, 10635, 10638, 10640, 10643, 10645, 10648, 10650, 10653, 10655,
-    10658, 10660, 10663, 10665, 10668, 10670, 10672, 10675, 10677, 10680, 10682,
-    10685, 10687, 10690, 10692, 10695, 10697, 10700, 10702, 10705, 10707, 10709,
-    10712, 10714, 10717, 10719, 10722, 10724, 10727, 10729, 10732, 10734, 10736,
-    10739, 10741, 10744, 10746, 10749, 10751, 10754, 10756, 10758, 10761, 10763,
-    10766, 10768, 10771, 10773, 10776, 10778, 10780, 10783, 10785, 10788, 10790,
-    10793, 10795, 10798, 10800, 10802, 10805, 10807, 10810, 10812, 10815, 10817,
-    10820, 10822, 10824, 10827, 10829, 10832, 10834, 10837, 10839, 10841, 10844,
-    10846, 10849, 10851, 10854, 10856, 10858, 10861, 10863, 10866, 10868, 10871,
-    10873, 10875, 10878, 10880, 10883, 10885, 10887, 10890, 10892, 10895, 10897,
-    10900, 10902, 10904, 10907, 10909, 10912, 10914, 10916, 10919, 10921, 10924,
-    10926, 10928, 10931, 10933, 10936, 10938, 10941, 10943, 10945, 10948, 10950,
-    10953, 10955, 10957, 10960, 10962, 10965, 10967, 10969, 10972, 10974, 10977,
-    10979, 10981, 10984, 10986, 10989, 10991, 10993, 10996, 10998, 11001, 11003,
-    11005, 11008, 11010, 11013, 11015, 11017, 11020, 11022, 11024, 11027, 11029,
-    11032, 11034, 11036, 11039, 11041, 11044, 11046, 11048, 11051, 11053, 11055,
-    11058, 11060, 11063, 11065, 11067, 11070, 11072, 11075, 11077, 11079, 11082,
-    11084, 11086, 11089, 11091, 11094, 11096, 11098, 11101, 11103, 11105, 11108,
-    11110, 11113, 11115, 11117, 11120, 11122, 11124, 11127, 11129, 11131, 11134,
-    11136, 11139, 11141, 11143, 11146, 11148, 11150, 11153, 11155, 11157, 11160,
-    11162, 11165, 11167, 11169, 11172, 11174, 11176, 11179, 11181, 11183, 11186,
-    11188, 11190, 11193, 11195, 11197, 11200, 11202, 11205, 11207, 11209, 11212,
-    11214, 11216, 11219, 11221, 11223, 11226, 11228, 11230, 11233, 11235, 11237,
-    11240, 11242, 11244, 11247, 11249, 11251, 11254, 11256, 11258, 11261, 11263,
-    11265, 11268, 11270, 11272, 11275, 11277, 11279, 11282, 11284, 11286, 11289,
-    11291, 11293, 11296, 11298, 11300, 11303, 11305, 11307, 11310, 11312, 11314,
-    11317, 11319, 11321, 11324, 11326, 11328, 11331, 11333, 11335, 11338, 11340,
-    11342, 11345, 11347, 11349, 11352, 11354, 11356, 11358, 11361, 11363, 11365,
-    11368, 11370, 11372, 11375, 11377, 11379, 11382, 11384, 11386, 11389, 11391,
-    11393, 11395, 11398, 11400, 11402, 11405, 11407, 11409, 11412, 11414, 11416,
-    11419, 11421, 11423, 11425, 11428, 11430, 11432, 11435, 11437, 11439, 11442,
-    11444, 11446, 11448, 11451, 11453, 11455, 11458, 11460, 11462, 11465, 11467,
-    11469, 11471, 11474, 11476, 11478, 11481, 11483, 11485, 11487, 11490, 11492,
-    11494, 11497, 11499, 11501, 11503, 11506, 11508, 11510, 11513, 11515, 11517,
-    11519, 11522, 11524, 11526, 11529, 11531, 11533, 11535, 11538, 11540, 11542,
-    11544, 11547, 11549, 11551, 11554, 11556, 11558, 11560, 11563, 11565, 11567,
-    11570, 11572, 11574, 11576, 11579, 11581, 11583, 11585, 11588, 11590, 11592,
-    11594, 11597, 11599, 11601, 11604, 11606, 11608, 11610, 11613, 11615, 11617,
-    11619, 11622, 11624, 11626, 11628, 11631, 11633, 11635, 11637, 11640, 11642,
-    11644, 11646, 11649, 11651, 11653, 11655, 11658, 11660, 11662, 11664, 11667,
-    11669, 11671, 11673, 11676, 11678, 11680, 11682, 11685, 11687, 11689, 11691,
-    11694, 11696, 11698, 11700, 11703, 11705, 11707, 11709, 11712, 11714, 11716,
-    11718, 11721, 11723, 11725, 11727, 11730, 11732, 11734, 11736, 11738, 11741,
-    11743, 11745, 11747, 11750, 11752, 11754, 11756, 11759, 11761, 11763, 11765,
-    11767, 11770, 11772, 11774, 11776, 11779, 11781, 11783, 11785, 11788, 11790,
-    11792, 11794, 11796, 11799, 11801, 11803, 11805, 11808, 11810, 11812, 11814,
-    11816, 11819, 11821, 11823, 11825, 11828, 11830, 11832, 11834, 11836, 11839,
-    11841, 11843, 11845, 11847, 11850, 11852, 11854, 11856, 11858, 11861, 11863,
-    11865, 11867, 11870, 11872, 11874, 11876, 11878, 11881, 11883, 11885, 11887,
-    11889, 11892, 11894, 11896, 11898, 11900, 11903, 11905, 11907, 11909, 11911,
-    11914, 11916, 11918, 11920, 11922, 11925, 11927, 11929, 11931, 11933, 11936,
-    11938, 11940, 11942, 11944, 11947, 11949, 11951, 11953, 11955, 11957, 11960,
-    11962, 11964, 11966, 11968, 11971, 11973, 11975, 11977, 11979, 11982, 11984,
-    11986, 11988, 11990, 11992, 11995, 11997, 11999, 12001, 12003, 12006, 12008,
-    12010, 12012, 12014, 12016, 12019, 12021, 12023, 12025, 12027, 12029, 12032,
-    12034, 12036, 12038, 12040, 12042, 12045, 12047, 12049, 12051, 12053, 12055,
-    12058, 12060, 12062, 12064, 12066, 12068, 12071, 12073, 12075, 12077, 12079,
-    12081, 12084, 12086, 12088, 12090, 12092, 12094, 12097, 12099, 12101, 12103,
-    12105, 12107, 12110, 12112, 12114, 12116, 12118, 12120, 12123, 12125, 12127,
-    12129, 12131, 12133, 12135, 12138, 12140, 12142, 12144, 12146, 12148, 12150,
-    12153, 12155, 12157, 12159, 12161, 12163, 12166, 12168, 12170, 12172, 12174,
-    12176, 12178, 12181, 12183, 12185, 12187, 12189, 12191, 12193, 12195, 12198,
-    12200, 12202, 12204, 12206, 12208, 12210, 12213, 12215, 12217, 12219, 12221,
-    12223, 12225, 12228, 12230, 12232, 12234, 12236, 12238, 12240, 12242, 12245,
-    12247, 12249, 12251, 12253, 12255, 12257, 12259, 12262, 12264, 12266, 12268,
-    12270, 12272, 12274, 12276, 12279, 12281, 12283, 12285, 12287, 12289, 12291,
-    12293, 12296, 12298, 12300, 12302, 12304, 12306, 12308, 12310, 12312, 12315,
-    12317, 12319, 12321, 12323, 12325, 12327, 12329, 12332, 12334, 12336, 12338,
-    12340, 12342, 12344, 12346, 12348, 12350, 12353, 12355, 12357, 12359, 12361,
-    12363, 12365, 12367, 12369, 12372, 12374, 12376, 12378, 12380, 12382, 12384,
-    12386, 12388, 12390, 12393, 12395, 12397, 12399, 12401, 12403, 12405, 12407,
-    12409, 12411, 12414, 12416, 12418, 12420, 12422, 12424, 12426, 12428, 12430,
-    12432, 12434, 12437, 12439, 12441, 12443, 12445, 12447, 12449, 12451, 12453,
-    12455, 12457, 12459, 12462, 12464, 12466, 12468, 12470, 12472, 12474, 12476,
-    12478, 12480, 12482, 12484, 12487, 12489, 12491, 12493, 12495, 12497, 12499,
-    12501, 12503, 12505, 12507, 12509, 12511, 12514, 12516, 12518, 12520, 12522,
-    12524, 12526, 12528, 12530, 12532, 12534, 12536, 12538, 12540, 12543, 12545,
-    12547, 12549, 12551, 12553, 12555, 12557, 12559, 12561, 12563, 12565, 12567,
-    12569, 12571, 12574, 12576, 12578, 12580, 12582, 12584, 12586, 12588, 12590,
-    12592, 12594, 12596, 12598, 12600, 12602, 12604, 12606, 12609, 12611, 12613,
-    12615, 12617, 12619, 12621, 12623, 12625, 12627, 12629, 12631, 12633, 12635,
-    12637, 12639, 12641, 12643, 12645, 12647, 12650, 12652, 12654, 12656, 12658,
-    12660, 12662, 12664, 12666, 12668, 12670, 12672, 12674, 12676, 12678, 12680,
-    12682, 12684, 12686, 12688, 12690, 12692, 12694, 12696, 12699, 12701, 12703,
-    12705, 12707, 12709, 12711, 12713, 12715, 12717, 12719, 12721, 12723, 12725,
-    12727, 12729, 12731, 12733, 12735, 12737, 12739, 12741, 12743, 12745, 12747,
-    12749, 12751, 12753, 12755, 12757, 12759, 12761, 12763, 12765, 12768, 12770,
-    12772, 12774, 12776, 12778, 12780, 12782, 12784, 12786, 12788, 12790, 12792,
-    12794, 12796, 12798, 12800, 12802, 12804, 12806, 12808, 12810, 12812, 12814,
-    12816, 12818, 12820, 12822, 12824, 12826, 12828, 12830, 12832, 12834, 12836,
-    12838, 12840, 12842, 12844, 12846, 12848, 12850, 12852, 12854, 12856, 12858,
-    12860, 12862, 12864, 12866, 12868, 12870, 12872, 12874, 12876, 12878, 12880,
-    12882, 12884, 12886, 12888, 12890, 12892, 12894, 12896, 12898, 12900, 12902,
-    12904, 12906, 12908, 12910, 12912, 12914, 12916, 12918, 12920, 12922, 12924,
-    12926, 12928, 12930, 12932, 12934, 12936, 12938, 12940, 12942, 12944, 12946,
-    12948, 12950, 12952, 12954, 12956, 12958, 12960, 12962, 12964, 12966, 12968,
-    12970, 12972, 12974, 12976, 12978, 12980, 12982, 12984, 12986, 12988, 12990,
-    12992, 12993, 12995, 12997, 12999, 13001, 13003, 13005, 13007, 13009, 13011,
-    13013, 13015, 13017, 13019, 13021, 13023, 13025, 13027, 13029, 13031, 13033,
-    13035, 13037, 13039, 13041, 13043, 13045, 13047, 13049, 13051, 13053, 13055,
-    13057, 13059, 13060, 13062, 13064, 13066, 13068, 13070, 13072, 13074, 13076,
-    13078, 13080, 13082, 13084, 13086, 13088, 13090, 13092, 13094, 13096, 13098,
-    13100, 13102, 13104, 13106, 13108, 13109, 13111, 13113, 13115, 13117, 13119,
-    13121, 13123, 13125, 13127, 13129, 13131, 13133, 13135, 13137, 13139, 13141,
-    13143, 13145, 13147, 13148, 13150, 13152, 13154, 13156, 13158, 13160, 13162,
-    13164, 13166, 13168, 13170, 13172, 13174, 13176, 13178, 13180, 13181, 13183,
-    13185, 13187, 13189, 13191, 13193, 13195, 13197, 13199, 13201, 13203, 13205,
-    13207, 13209, 13211, 13212, 13214, 13216, 13218, 13220, 13222, 13224, 13226,
-    13228, 13230, 13232, 13234, 13236, 13238, 13240, 13241, 13243, 13245, 13247,
-    13249, 13251, 13253, 13255, 13257, 13259, 13261, 13263, 13265, 13266, 13268,
-    13270, 13272, 13274, 13276, 13278, 13280, 13282, 13284, 13286, 13288, 13290,
-    13291, 13293, 13295, 13297, 13299, 13301, 13303, 13305, 13307, 13309, 13311,
-    13313, 13314, 13316, 13318, 13320, 13322, 13324, 13326, 13328, 13330, 13332,
-    13334, 13335, 13337, 13339, 13341, 13343, 13345, 13347, 13349, 13351, 13353,
-    13355, 13356, 13358, 13360, 13362, 13364, 13366, 13368, 13370, 13372, 13374,
-    13375, 13377, 13379, 13381, 13383, 13385, 13387, 13389, 13391, 13393, 13394,
-    13396, 13398, 13400, 13402, 13404, 13406, 13408, 13410, 13412, 13413, 13415,
-    13417, 13419, 13421, 13423, 13425, 13427, 13429, 13430, 13432, 13434, 13436,
-    13438, 13440, 13442, 13444, 13446, 13448, 13449, 13451, 13453, 13455, 13457,
-    13459, 13461, 13463, 13464, 13466, 13468, 13470, 13472, 13474, 13476, 13478,
-    13480, 13481, 13483, 13485, 13487, 13489, 13491, 13493, 13495, 13496, 13498,
-    13500, 13502, 13504, 13506, 13508, 13510, 13511, 13513, 13515, 13517, 13519,
-    13521, 13523, 13525, 13526, 13528, 13530, 13532, 13534, 13536, 13538, 13540,
-    13541, 13543, 13545, 13547, 13549, 13551, 13553, 13555, 13556, 13558, 13560,
-    13562, 13564, 13566, 13568, 13569, 13571, 13573, 13575, 13577, 13579, 13581,
-    13582, 13584, 13586, 13588, 13590, 13592, 13594, 13595, 13597, 13599, 13601,
-    13603, 13605, 13607, 13609, 13610, 13612, 13614, 13616, 13618, 13620, 13621,
-    13623, 13625, 13627, 13629, 13631, 13633, 13634, 13636, 13638, 13640, 13642,
-    13644, 13646, 13647, 13649, 13651, 13653, 13655, 13657, 13659, 13660, 13662,
-    13664, 13666, 13668, 13670, 13671, 13673, 13675, 13677, 13679, 13681, 13682,
-    13684, 13686, 13688, 13690, 13692, 13694, 13695, 13697, 13699, 13701, 13703,
-    13705, 13706, 13708, 13710, 13712, 13714, 13716, 13717, 13719, 13721, 13723,
-    13725, 13727, 13728, 13730, 13732, 13734, 13736, 13738, 13739, 13741, 13743,
-    13745, 13747, 13749, 13750, 13752, 13754, 13756, 13758, 13760, 13761, 13763,
-    13765, 13767, 13769, 13771, 13772, 13774, 13776, 13778, 13780, 13781, 13783,
-    13785, 13787, 13789, 13791, 13792, 13794, 13796, 13798, 13800, 13801, 13803,
-    13805, 13807, 13809, 13811, 13812, 13814, 13816, 13818, 13820, 13821, 13823,
-    13825, 13827, 13829, 13831, 13832, 13834, 13836, 13838, 13840, 13841, 13843,
-    13845, 13847, 13849, 13850, 13852, 13854, 13856, 13858, 13860, 13861, 13863,
-    13865, 13867, 13869, 13870, 13872, 13874, 13876, 13878, 13879, 13881, 13883,
-    13885, 13887, 13888, 13890, 13892, 13894, 13896, 13897, 13899, 13901, 13903,
-    13905, 13906, 13908, 13910, 13912, 13914, 13915, 13917, 13919, 13921, 13923,
-    13924, 13926, 13928, 13930, 13932, 13933, 13935, 13937, 13939, 13941, 13942,
-    13944, 13946, 13948, 13950, 13951, 13953, 13955, 13957, 13958, 13960, 13962,
-    13964, 13966, 13967, 13969, 13971, 13973, 13975, 13976, 13978, 13980, 13982,
-    13984, 13985, 13987, 13989, 13991, 13992, 13994, 13996, 13998, 14000, 14001,
-    14003, 14005, 14007, 14008, 14010, 14012, 14014, 14016, 14017, 14019, 14021,
-    14023, 14024, 14026, 14028, 14030, 14032, 14033, 14035, 14037, 14039, 14040,
-    14042, 14044, 14046, 14048, 14049, 14051, 14053, 14055, 14056, 14058, 14060,
-    14062, 14063, 14065, 14067, 14069, 14071, 14072, 14074, 14076, 14078, 14079,
-    14081, 14083, 14085, 14086, 14088, 14090, 14092, 14094, 14095, 14097, 14099,
-    14101, 14102, 14104, 14106, 14108, 14109, 14111, 14113, 14115, 14116, 14118,
-    14120, 14122, 14123, 14125, 14127, 14129, 14130, 14132, 14134, 14136, 14138,
-    14139, 14141, 14143, 14145, 14146, 14148, 14150, 14152, 14153, 14155, 14157,
-    14159, 14160, 14162, 14164, 14166, 14167, 14169, 14171, 14173, 14174, 14176,
-    14178, 14180, 14181, 14183, 14185, 14187, 14188, 14190, 14192, 14194, 14195,
-    14197, 14199, 14201, 14202, 14204, 14206, 14207, 14209, 14211, 14213, 14214,
-    14216, 14218, 14220, 14221, 14223, 14225, 14227, 14228, 14230, 14232, 14234,
-    14235, 14237, 14239, 14241, 14242, 14244, 14246, 14247, 14249, 14251, 14253,
-    14254, 14256, 14258, 14260, 14261, 14263, 14265, 14267, 14268, 14270, 14272,
-    14273, 14275, 14277, 14279, 14280, 14282, 14284, 14286, 14287, 14289, 14291,
-    14292, 14294, 14296, 14298, 14299, 14301, 14303, 14305, 14306, 14308, 14310,
-    14311, 14313, 14315, 14317, 14318, 14320, 14322, 14324, 14325, 14327, 14329,
-    14330, 14332, 14334, 14336, 14337, 14339, 14341, 14342, 14344, 14346, 14348,
-    14349, 14351, 14353, 14354, 14356, 14358, 14360, 14361, 14363, 14365, 14366,
-    14368, 14370, 14372, 14373, 14375, 14377, 14378, 14380, 14382, 14384, 14385,
-    14387, 14389, 14390, 14392, 14394, 14396, 14397, 14399, 14401, 14402, 14404,
-    14406, 14407, 14409, 14411, 14413, 14414, 14416, 14418, 14419, 14421, 14423,
-    14425, 14426, 14428, 14430, 14431, 14433, 14435, 14436, 14438, 14440, 14442,
-    14443, 14445, 14447, 14448, 14450, 14452, 14453, 14455, 14457, 14459, 14460,
-    14462, 14464, 14465, 14467, 14469, 14470, 14472, 14474, 14475, 14477, 14479,
-    14481, 14482, 14484, 14486, 14487, 14489, 14491, 14492, 14494, 14496, 14497,
-    14499, 14501, 14503, 14504, 14506, 14508, 14509, 14511, 14513, 14514, 14516,
-    14518, 14519, 14521, 14523, 14524, 14526, 14528, 14529, 14531, 14533, 14535,
-    14536, 14538, 14540, 14541, 14543, 14545, 14546, 14548, 14550, 14551, 14553,
-    14555, 14556, 14558, 14560, 14561, 14563, 14565, 14566, 14568, 14570, 14571,
-    14573, 14575, 14576, 14578, 14580, 14581, 14583, 14585, 14587, 14588, 14590,
-    14592, 14593, 14595, 14597, 14598, 14600, 14602, 14603, 14605, 14607, 14608,
-    14610, 14612, 14613, 14615, 14617, 14618, 14620, 14622, 14623, 14625, 14627,
-    14628, 14630, 14632, 14633, 14635, 14637, 14638, 14640, 14642, 14643, 14645,
-    14647, 14648, 14650, 14652, 14653, 14655, 14656, 14658, 14660, 14661, 14663,
-    14665, 14666, 14668, 14670, 14671, 14673, 14675, 14676, 14678, 14680, 14681,
-    14683, 14685, 14686, 14688, 14690, 14691, 14693, 14695, 14696, 14698, 14700,
-    14701, 14703, 14705, 14706, 14708, 14709, 14711, 14713, 14714, 14716, 14718,
-    14719, 14721, 14723, 14724, 14726, 14728, 14729, 14731, 14733, 14734, 14736,
-    14737, 14739, 14741, 14742, 14744, 14746, 14747, 14749, 14751, 14752, 14754,
-    14756, 14757, 14759, 14760, 14762, 14764, 14765, 14767, 14769, 14770, 14772,
-    14774, 14775, 14777, 14778, 14780, 14782, 14783, 14785, 14787, 14788, 14790,
-    14792, 14793, 14795, 14796, 14798, 14800, 14801, 14803, 14805, 14806, 14808,
-    14810, 14811, 14813, 14814, 14816, 14818, 14819, 14821, 14823, 14824, 14826,
-    14827, 14829, 14831, 14832, 14834, 14836, 14837, 14839, 14841, 14842, 14844,
-    14845, 14847, 14849, 14850, 14852, 14854, 14855, 14857, 14858, 14860, 14862,
-    14863, 14865, 14866, 14868, 14870, 14871, 14873, 14875, 14876, 14878, 14879,
-    14881, 14883, 14884, 14886, 14888, 14889, 14891, 14892, 14894, 14896, 14897,
-    14899, 14900, 14902, 14904, 14905, 14907, 14909, 14910, 14912, 14913, 14915,
-    14917, 14918, 14920, 14921, 14923, 14925, 14926, 14928, 14930, 14931, 14933,
-    14934, 14936, 14938, 14939, 14941, 14942, 14944, 14946, 14947, 14949, 14950,
-    14952, 14954, 14955, 14957, 14958, 14960, 14962, 14963, 14965, 14966, 14968,
-    14970, 14971, 14973, 14974, 14976, 14978, 14979, 14981, 14983, 14984, 14986,
-    14987, 14989, 14991, 14992, 14994, 14995, 14997, 14999, 15000, 15002, 15003,
-    15005, 15006, 15008, 15010, 15011, 15013, 15014, 15016, 15018, 15019, 15021,
-    15022, 15024, 15026, 15027, 15029, 15030, 15032, 15034, 15035, 15037, 15038,
-    15040, 15042, 15043, 15045, 15046, 15048, 15049, 15051, 15053, 15054, 15056,
-    15057, 15059, 15061, 15062, 15064, 15065, 15067, 15069, 15070, 15072, 15073,
-    15075, 15076, 15078, 15080, 15081, 15083, 15084, 15086, 15088, 15089, 15091,
-    15092, 15094, 15095, 15097, 15099, 15100, 15102, 15103, 15105, 15107, 15108,
-    15110, 15111, 15113, 15114, 15116, 15118, 15119, 15121, 15122, 15124, 15125,
-    15127, 15129, 15130, 15132, 15133, 15135, 15136, 15138, 15140, 15141, 15143,
-    15144, 15146, 15147, 15149, 15151, 15152, 15154, 15155, 15157, 15158, 15160,
-    15162, 15163, 15165, 15166, 15168, 15169, 15171, 15173, 15174, 15176, 15177,
-    15179, 15180, 15182, 15184, 15185, 15187, 15188, 15190, 15191, 15193, 15194,
-    15196, 15198, 15199, 15201, 15202, 15204, 15205, 15207, 15209, 15210, 15212,
-    15213, 15215, 15216, 15218, 15219, 15221, 15223, 15224, 15226, 15227, 15229,
-    15230, 15232, 15233, 15235, 15237, 15238, 15240, 15241, 15243, 15244, 15246,
-    15247, 15249, 15251, 15252, 15254, 15255, 15257, 15258, 15260, 15261, 15263,
-    15265, 15266, 15268, 15269, 15271, 15272, 15274, 15275, 15277, 15278, 15280,
-    15282, 15283, 15285, 15286, 15288, 15289, 15291, 15292, 15294, 15295, 15297,
-    15299, 15300, 15302, 15303, 15305, 15306, 15308, 15309, 15311, 15312, 15314,
-    15316, 15317, 15319, 15320, 15322, 15323, 15325, 15326, 15328, 15329, 15331,
-    15332, 15334, 15336, 15337, 15339, 15340, 15342, 15343, 15345, 15346, 15348,
-    15349, 15351, 15352, 15354, 15356, 15357, 15359, 15360, 15362, 15363, 15365,
-    15366, 15368, 15369, 15371, 15372, 15374, 15375, 15377, 15379, 15380, 15382,
-    15383, 15385, 15386, 15388, 15389, 15391, 15392, 15394, 15395, 15397, 15398,
-    15400, 15401, 15403, 15405, 15406, 15408, 15409, 15411, 15412, 15414, 15415,
-    15417, 15418, 15420, 15421, 15423, 15424, 15426, 15427, 15429, 15430, 15432,
-    15433, 15435, 15437, 15438, 15440, 15441, 15443, 15444, 15446, 15447, 15449,
-    15450, 15452, 15453, 15455, 15456, 15458, 15459, 15461, 15462, 15464, 15465,
-    15467, 15468, 15470, 15471, 15473, 15474, 15476, 15477, 15479, 15480, 15482,
-    15484, 15485, 15487, 15488, 15490, 15491, 15493, 15494, 15496, 15497, 15499,
-    15500, 15502, 15503, 15505, 15506, 15508, 15509, 15511, 15512, 15514, 15515,
-    15517, 15518, 15520, 15521, 15523, 15524, 15526, 15527, 15529, 15530, 15532,
-    15533, 15535, 15536, 15538, 15539, 15541, 15542, 15544, 15545, 15547, 15548,
-    15550, 15551, 15553, 15554, 15556, 15557, 15559, 15560, 15562, 15563, 15565,
-    15566, 15568, 15569, 15571, 15572, 15574, 15575, 15577, 15578, 15580, 15581,
-    15583, 15584, 15586, 15587, 15589, 15590, 15592, 15593, 15595, 15596, 15598,
-    15599, 15601, 15602, 15604, 15605, 15607, 15608, 15610, 15611, 15613, 15614,
-    15616, 15617, 15619, 15620, 15622, 15623, 15625, 15626, 15627, 15629, 15630,
-    15632, 15633, 15635, 15636, 15638, 15639, 15641, 15642, 15644, 15645, 15647,
-    15648, 15650, 15651, 15653, 15654, 15656, 15657, 15659, 15660, 15662, 15663,
-    15665, 15666, 15668, 15669, 15671, 15672, 15673, 15675, 15676, 15678, 15679,
-    15681, 15682, 15684, 15685, 15687, 15688, 15690, 15691, 15693, 15694, 15696,
-    15697, 15699, 15700, 15702, 15703, 15704, 15706, 15707, 15709, 15710, 15712,
-    15713, 15715, 15716, 15718, 15719, 15721, 15722, 15724, 15725, 15727, 15728,
-    15730, 15731, 15732, 15734, 15735, 15737, 15738, 15740, 15741, 15743, 15744,
-    15746, 15747, 15749, 15750, 15752, 15753, 15754, 15756, 15757, 15759, 15760,
-    15762, 15763, 15765, 15766, 15768, 15769, 15771, 15772, 15773, 15775, 15776,
-    15778, 15779, 15781, 15782, 15784, 15785, 15787, 15788, 15790, 15791, 15792,
-    15794, 15795, 15797, 15798, 15800, 15801, 15803, 15804, 15806, 15807, 15809,
-    15810, 15811, 15813, 15814, 15816, 15817, 15819, 15820, 15822, 15823, 15825,
-    15826, 15827, 15829, 15830, 15832, 15833, 15835, 15836, 15838, 15839, 15840,
-    15842, 15843, 15845, 15846, 15848, 15849, 15851, 15852, 15854, 15855, 15856,
-    15858, 15859, 15861, 15862, 15864, 15865, 15867, 15868, 15869, 15871, 15872,
-    15874, 15875, 15877, 15878, 15880, 15881, 15882, 15884, 15885, 15887, 15888,
-    15890, 15891, 15893, 15894, 15895, 15897, 15898, 15900, 15901, 15903, 15904,
-    15906, 15907, 15908, 15910, 15911, 15913, 15914, 15916, 15917, 15918, 15920,
-    15921, 15923, 15924, 15926, 15927, 15929, 15930, 15931, 15933, 15934, 15936,
-    15937, 15939, 15940, 15941, 15943, 15944, 15946, 15947, 15949, 15950, 15951,
-    15953, 15954, 15956, 15957, 15959, 15960, 15961, 15963, 15964, 15966, 15967,
-    15969, 15970, 15971, 15973, 15974, 15976, 15977, 15979, 15980, 15981, 15983,
-    15984, 15986, 15987, 15989, 15990, 15991, 15993, 15994, 15996, 15997, 15999,
-    16000, 16001, 16003, 16004, 16006, 16007, 16009, 16010, 16011, 16013, 16014,
-    16016, 16017, 16018, 16020, 16021, 16023, 16024, 16026, 16027, 16028, 16030,
-    16031, 16033, 16034, 16036, 16037, 16038, 16040, 16041, 16043, 16044, 16045,
-    16047, 16048, 16050, 16051, 16053, 16054, 16055, 16057, 16058, 16060, 16061,
-    16062, 16064, 16065, 16067, 16068, 16069, 16071, 16072, 16074, 16075, 16077,
-    16078, 16079, 16081, 16082, 16084, 16085, 16086, 16088, 16089, 16091, 16092,
-    16093, 16095, 16096, 16098, 16099, 16100, 16102, 16103, 16105, 16106, 16108,
-    16109, 16110, 16112, 16113, 16115, 16116, 16117, 16119, 16120, 16122, 16123,
-    16124, 16126, 16127, 16129, 16130, 16131, 16133, 16134, 16136, 16137, 16138,
-    16140, 16141, 16143, 16144, 16145, 16147, 16148, 16150, 16151, 16152, 16154,
-    16155, 16157, 16158, 16159, 16161, 16162, 16164, 16165, 16166, 16168, 16169,
-    16171, 16172, 16173, 16175, 16176, 16177, 16179, 16180, 16182, 16183, 16184,
-    16186, 16187, 16189, 16190, 16191, 16193, 16194, 16196, 16197, 16198, 16200,
-    16201, 16203, 16204, 16205, 16207, 16208, 16209, 16211, 16212, 16214, 16215,
-    16216, 16218, 16219, 16221, 16222, 16223, 16225, 16226, 16228, 16229, 16230,
-    16232, 16233, 16234, 16236, 16237, 16239, 16240, 16241, 16243, 16244, 16246,
-    16247, 16248, 16250, 16251, 16252, 16254, 16255, 16257, 16258, 16259, 16261,
-    16262, 16263, 16265, 16266, 16268, 16269, 16270, 16272, 16273, 16274, 16276,
-    16277, 16279, 16280, 16281, 16283, 16284, 16286, 16287, 16288, 16290, 16291,
-    16292, 16294, 16295, 16297, 16298, 16299, 16301, 16302, 16303, 16305, 16306,
-    16307, 16309, 16310, 16312, 16313, 16314, 16316, 16317, 16318, 16320, 16321,
-    16323, 16324, 16325, 16327, 16328, 16329, 16331, 16332, 16334, 16335, 16336,
-    16338, 16339, 16340, 16342, 16343, 16344, 16346, 16347, 16349, 16350, 16351,
-    16353, 16354, 16355, 16357, 16358, 16359, 16361, 16362, 16364, 16365, 16366,
-    16368, 16369, 16370, 16372, 16373, 16374, 16376, 16377, 16379, 16380, 16381,
-    16383, 16384, 16385, 16387, 16388, 16389, 16391, 16392, 16393, 16395, 16396,
-    16398, 16399, 16400, 16402, 16403, 16404, 16406, 16407, 16408, 16410, 16411,
-    16412, 16414, 16415, 16417, 16418, 16419, 16421, 16422, 16423, 16425, 16426,
-    16427, 16429, 16430, 16431, 16433, 16434, 16435, 16437, 16438, 16440, 16441,
-    16442, 16444, 16445, 16446, 16448, 16449, 16450, 16452, 16453, 16454, 16456,
-    16457, 16458, 16460, 16461, 16462, 16464, 16465, 16466, 16468, 16469, 16471,
-    16472, 16473, 16475, 16476, 16477, 16479, 16480, 16481, 16483, 16484, 16485,
-    16487, 16488, 16489, 16491, 16492, 16493, 16495, 16496, 16497, 16499, 16500,
-    16501, 16503, 16504, 16505, 16507, 16508, 16509, 16511, 16512, 16513, 16515,
-    16516, 16517, 16519, 16520, 16521, 16523, 16524, 16525, 16527, 16528, 16530,
-    16531, 16532, 16534, 16535, 16536, 16538, 16539, 16540, 16542, 16543, 16544,
-    16546, 16547, 16548, 16550, 16551, 16552, 16554, 16555, 16556, 16557, 16559,
-    16560, 16561, 16563, 16564, 16565, 16567, 16568, 16569, 16571, 16572, 16573,
-    16575, 16576, 16577, 16579, 16580, 16581, 16583, 16584, 16585, 16587, 16588,
-    16589, 16591, 16592, 16593, 16595, 16596, 16597, 16599, 16600, 16601, 16603,
-    16604, 16605, 16607, 16608, 16609, 16611, 16612, 16613, 16615, 16616, 16617,
-    16618, 16620, 16621, 16622, 16624, 16625, 16626, 16628, 16629, 16630, 16632,
-    16633, 16634, 16636, 16637, 16638, 16640, 16641, 16642, 16644, 16645, 16646,
-    16648, 16649, 16650, 16651, 16653, 16654, 16655, 16657, 16658, 16659, 16661,
-    16662, 16663, 16665, 16666, 16667, 16669, 16670, 16671, 16672, 16674, 16675,
-    16676, 16678, 16679, 16680, 16682, 16683, 16684, 16686, 16687, 16688, 16690,
-    16691, 16692, 16693, 16695, 16696, 16697, 16699, 16700, 16701, 16703, 16704,
-    16705, 16707, 16708, 16709, 16710, 16712, 16713, 16714, 16716, 16717, 16718,
-    16720, 16721, 16722, 16723, 16725, 16726, 16727, 16729, 16730, 16731, 16733,
-    16734, 16735, 16737, 16738, 16739, 16740, 16742, 16743, 16744, 16746, 16747,
-    16748, 16750, 16751, 16752, 16753, 16755, 16756, 16757, 16759, 16760, 16761,
-    16763, 16764, 16765, 16766, 16768, 16769, 16770, 16772, 16773, 16774, 16775,
-    16777, 16778, 16779, 16781, 16782, 16783, 16785, 16786, 16787, 16788, 16790,
-    16791, 16792, 16794, 16795, 16796, 16797, 16799, 16800, 16801, 16803, 16804,
-    16805, 16807, 16808, 16809, 16810, 16812, 16813, 16814, 16816, 16817, 16818,
-    16819, 16821, 16822, 16823, 16825, 16826, 16827, 16828, 16830, 16831, 16832,
-    16834, 16835, 16836, 16837, 16839, 16840, 16841, 16843, 16844, 16845, 16846,
-    16848, 16849, 16850, 16852, 16853, 16854, 16855, 16857, 16858, 16859, 16861,
-    16862, 16863, 16864, 16866, 16867, 16868, 16870, 16871, 16872, 16873, 16875,
-    16876, 16877, 16878, 16880, 16881, 16882, 16884, 16885, 16886, 16887, 16889,
-    16890, 16891, 16893, 16894, 16895, 16896, 16898, 16899, 16900, 16901, 16903,
-    16904, 16905, 16907, 16908, 16909, 16910, 16912, 16913, 16914, 16915, 16917,
-    16918, 16919, 16921, 16922, 16923, 16924, 16926, 16927, 16928, 16929, 16931,
-    16932, 16933, 16935, 16936, 16937, 16938, 16940, 16941, 16942, 16943, 16945,
-    16946, 16947, 16949, 16950, 16951, 16952, 16954, 16955, 16956, 16957, 16959,
-    16960, 16961, 16962, 16964, 16965, 16966, 16967, 16969, 16970, 16971, 16973,
-    16974, 16975, 16976, 16978, 16979, 16980, 16981, 16983, 16984, 16985, 16986,
-    16988, 16989, 16990, 16991, 16993, 16994, 16995, 16997, 16998, 16999, 17000,
-    17002, 17003, 17004, 17005, 17007, 17008, 17009, 17010, 17012, 17013, 17014,
-    17015, 17017, 17018, 17019, 17020, 17022, 17023, 17024, 17025, 17027, 17028,
-    17029, 17030, 17032, 17033, 17034, 17036, 17037, 17038, 17039, 17041, 17042,
-    17043, 17044, 17046, 17047, 17048, 17049, 17051, 17052, 17053, 17054, 17056,
-    17057, 17058, 17059, 17061, 17062, 17063, 17064, 17066, 17067, 17068, 17069,
-    17071, 17072, 17073, 17074, 17076, 17077, 17078, 17079, 17081, 17082, 17083,
-    17084, 17086, 17087, 17088, 17089, 17090, 17092, 17093, 17094, 17095, 17097,
-    17098, 17099, 17100, 17102, 17103, 17104, 17105, 17107, 17108, 17109, 17110,
-    17112, 17113, 17114, 17115, 17117, 17118, 17119, 17120, 17122, 17123, 17124,
-    17125, 17127, 17128, 17129, 17130, 17131, 17133, 17134, 17135, 17136, 17138,
-    17139, 17140, 17141, 17143, 17144, 17145, 17146, 17148, 17149, 17150, 17151,
-    17153, 17154, 17155, 17156, 17157, 17159, 17160, 17161, 17162, 17164, 17165,
-    17166, 17167, 17169, 17170, 17171, 17172, 17173, 17175, 17176, 17177, 17178,
-    17180, 17181, 17182, 17183, 17185, 17186, 17187, 17188, 17189, 17191, 17192,
-    17193, 17194, 17196, 17197, 17198, 17199, 17201, 17202, 17203, 17204, 17205,
-    17207, 17208, 17209, 17210, 17212, 17213, 17214, 17215, 17216, 17218, 17219,
-    17220, 17221, 17223, 17224, 17225, 17226, 17228, 17229, 17230, 17231, 17232,
-    17234, 17235, 17236, 17237, 17239, 17240, 17241, 17242, 17243, 17245, 17246,
-    17247, 17248, 17250, 17251, 17252, 17253, 17254, 17256, 17257, 17258, 17259,
-    17260, 17262, 17263, 17264, 17265, 17267, 17268, 17269, 17270, 17271, 17273,
-    17274, 17275, 17276, 17278, 17279, 17280, 17281, 17282, 17284, 17285, 17286,
-    17287, 17288, 17290, 17291, 17292, 17293, 17295, 17296, 17297, 17298, 17299,
-    17301, 17302, 17303, 17304, 17305, 17307, 17308, 17309, 17310, 17311, 17313,
-    17314, 17315, 17316, 17318, 17319, 17320, 17321, 17322, 17324, 17325, 17326,
-    17327, 17328, 17330, 17331, 17332, 17333, 17334, 17336, 17337, 17338, 17339,
-    17340, 17342, 17343, 17344, 17345, 17347, 17348, 17349, 17350, 17351, 17353,
-    17354, 17355, 17356, 17357, 17359, 17360, 17361, 17362, 17363, 17365, 17366,
-    17367, 17368, 17369, 17371, 17372, 17373, 17374, 17375, 17377, 17378, 17379,
-    17380, 17381, 17383, 17384, 17385, 17386, 17387, 17389, 17390, 17391, 17392,
-    17393, 17395, 17396, 17397, 17398, 17399, 17401, 17402, 17403, 17404, 17405,
-    17407, 17408, 17409, 17410, 17411, 17413, 17414, 17415, 17416, 17417, 17418,
-    17420, 17421, 17422, 17423, 17424, 17426, 17427, 17428, 17429, 17430, 17432,
-    17433, 17434, 17435, 17436, 17438, 17439, 17440, 17441, 17442, 17444, 17445,
-    17446, 17447, 17448, 17449, 17451, 17452, 17453, 17454, 17455, 17457, 17458,
-    17459, 17460, 17461, 17463, 17464, 17465, 17466, 17467, 17468, 17470, 17471,
-    17472, 17473, 17474, 17476, 17477, 17478, 17479, 17480, 17482, 17483, 17484,
-    17485, 17486, 17487, 17489, 17490, 17491, 17492, 17493, 17495, 17496, 17497,
-    17498, 17499, 17500, 17502, 17503, 17504, 17505, 17506, 17508, 17509, 17510,
-    17511, 17512, 17513, 17515, 17516, 17517, 17518, 17519, 17521, 17522, 17523,
-    17524, 17525, 17526, 17528, 17529, 17530, 17531, 17532, 17533, 17535, 17536,
-    17537, 17538, 17539, 17541, 17542, 17543, 17544, 17545, 17546, 17548, 17549,
-    17550, 17551, 17552, 17553, 17555, 17556, 17557, 17558, 17559, 17560, 17562,
-    17563, 17564, 17565, 17566, 17567, 17569, 17570, 17571, 17572, 17573, 17575,
-    17576, 17577, 17578, 17579, 17580, 17582, 17583, 17584, 17585, 17586, 17587,
-    17589, 17590, 17591, 17592, 17593, 17594, 17596, 17597, 17598, 17599, 17600,
-    17601, 17603, 17604, 17605, 17606, 17607, 17608, 17610, 17611, 17612, 17613,
-    17614, 17615, 17617, 17618, 17619, 17620, 17621, 17622, 17623, 17625, 17626,
-    17627, 17628, 17629, 17630, 17632, 17633, 17634, 17635, 17636, 17637, 17639,
-    17640, 17641, 17642, 17643, 17644, 17646, 17647, 17648, 17649, 17650, 17651,
-    17652, 17654, 17655, 17656, 17657, 17658, 17659, 17661, 17662, 17663, 17664,
-    17665, 17666, 17668, 17669, 17670, 17671, 17672, 17673, 17674, 17676, 17677,
-    17678, 17679, 17680, 17681, 17683, 17684, 17685, 17686, 17687, 17688, 17689,
-    17691, 17692, 17693, 17694, 17695, 17696, 17698, 17699, 17700, 17701, 17702,
-    17703, 17704, 17706, 17707, 17708, 17709, 17710, 17711, 17712, 17714, 17715,
-    17716, 17717, 17718, 17719, 17721, 17722, 17723, 17724, 17725, 17726, 17727,
-    17729, 17730, 17731, 17732, 17733, 17734, 17735, 17737, 17738, 17739, 17740,
-    17741, 17742, 17743, 17745, 17746, 17747, 17748, 17749, 17750, 17751, 17753,
-    17754, 17755, 17756, 17757, 17758, 17759, 17761, 17762, 17763, 17764, 17765,
-    17766, 17767, 17769, 17770, 17771, 17772, 17773, 17774, 17775, 17777, 17778,
-    17779, 17780, 17781, 17782, 17783, 17785, 17786, 17787, 17788, 17789, 17790,
-    17791, 17792, 17794, 17795, 17796, 17797, 17798, 17799, 17800, 17802, 17803,
-    17804, 17805, 17806, 17807, 17808, 17810, 17811, 17812, 17813, 17814, 17815,
-    17816, 17817, 17819, 17820, 17821, 17822, 17823, 17824, 17825, 17826, 17828,
-    17829, 17830, 17831, 17832, 17833, 17834, 17836, 17837, 17838, 17839, 17840,
-    17841, 17842, 17843, 17845, 17846, 17847, 17848, 17849, 17850, 17851, 17852,
-    17854, 17855, 17856, 17857, 17858, 17859, 17860, 17861, 17863, 17864, 17865,
-    17866, 17867, 17868, 17869, 17871, 17872, 17873, 17874, 17875, 17876, 17877,
-    17878, 17879, 17881, 17882, 17883, 17884, 17885, 17886, 17887, 17888, 17890,
-    17891, 17892, 17893, 17894, 17895, 17896, 17897, 17899, 17900, 17901, 17902,
-    17903, 17904, 17905, 17906, 17908, 17909, 17910, 17911, 17912, 17913, 17914,
-    17915, 17916, 17918, 17919, 17920, 17921, 17922, 17923, 17924, 17925, 17927,
-    17928, 17929, 17930, 17931, 17932, 17933, 17934, 17935, 17937, 17938, 17939,
-    17940, 17941, 17942, 17943, 17944, 17946, 17947, 17948, 17949, 17950, 17951,
-    17952, 17953, 17954, 17956, 17957, 17958, 17959, 17960, 17961, 17962, 17963,
-    17964, 17966, 17967, 17968, 17969, 17970, 17971, 17972, 17973, 17974, 17976,
-    17977, 17978, 17979, 17980, 17981, 17982, 17983, 17984, 17985, 17987, 17988,
-    17989, 17990, 17991, 17992, 17993, 17994, 17995, 17997, 17998, 17999, 18000,
-    18001, 18002, 18003, 18004, 18005, 18007, 18008, 18009, 18010, 18011, 18012,
-    18013, 18014, 18015, 18016, 18018, 18019, 18020, 18021, 18022, 18023, 18024,
-    18025, 18026, 18027, 18029, 18030, 18031, 18032, 18033, 18034, 18035, 18036,
-    18037, 18038, 18040, 18041, 18042, 18043, 18044, 18045, 18046, 18047, 18048,
-    18049, 18051, 18052, 18053, 18054, 18055, 18056, 18057, 18058, 18059, 18060,
-    18062, 18063, 18064, 18065, 18066, 18067, 18068, 18069, 18070, 18071, 18072,
-    18074, 18075, 18076, 18077, 18078, 18079, 18080, 18081, 18082, 18083, 18085,
-    18086, 18087, 18088, 18089, 18090, 18091, 18092, 18093, 18094, 18095, 18097,
-    18098, 18099, 18100, 18101, 18102, 18103, 18104, 18105, 18106, 18107, 18109,
-    18110, 18111, 18112, 18113, 18114, 18115, 18116, 18117, 18118, 18119, 18121,
-    18122, 18123, 18124, 18125, 18126, 18127, 18128, 18129, 18130, 18131, 18132,
-    18134, 18135, 18136, 18137, 18138, 18139, 18140, 18141, 18142, 18143, 18144,
-    18145, 18147, 18148, 18149, 18150, 18151, 18152, 18153, 18154, 18155, 18156,
-    18157, 18158, 18160, 18161, 18162, 18163, 18164, 18165, 18166, 18167, 18168,
-    18169, 18170, 18171, 18173, 18174, 18175, 18176, 18177, 18178, 18179, 18180,
-    18181, 18182, 18183, 18184, 18185, 18187, 18188, 18189, 18190, 18191, 18192,
-    18193, 18194, 18195, 18196, 18197, 18198, 18199, 18201, 18202, 18203, 18204,
-    18205, 18206, 18207, 18208, 18209, 18210, 18211, 18212, 18213, 18215, 18216,
-    18217, 18218, 18219, 18220, 18221, 18222, 18223, 18224, 18225, 18226, 18227,
-    18228, 18230, 18231, 18232, 18233, 18234, 18235, 18236, 18237, 18238, 18239,
-    18240, 18241, 18242, 18243, 18245, 18246, 18247, 18248, 18249, 18250, 18251,
-    18252, 18253, 18254, 18255, 18256, 18257, 18258, 18260, 18261, 18262, 18263,
-    18264, 18265, 18266, 18267, 18268, 18269, 18270, 18271, 18272, 18273, 18274,
-    18276, 18277, 18278, 18279, 18280, 18281, 18282, 18283, 18284, 18285, 18286,
-    18287, 18288, 18289, 18290, 18291, 18293, 18294, 18295, 18296, 18297, 18298,
-    18299, 18300, 18301, 18302, 18303, 18304, 18305, 18306, 18307, 18308, 18310,
-    18311, 18312, 18313, 18314, 18315, 18316, 18317, 18318, 18319, 18320, 18321,
-    18322, 18323, 18324, 18325, 18326, 18328, 18329, 18330, 18331, 18332, 18333,
-    18334, 18335, 18336, 18337, 18338, 18339, 18340, 18341, 18342, 18343, 18344,
-    18345, 18347, 18348, 18349, 18350, 18351, 18352, 18353, 18354, 18355, 18356,
-    18357, 18358, 18359, 18360, 18361, 18362, 18363, 18364, 18365, 18367, 18368,
-    18369, 18370, 18371, 18372, 18373, 18374, 18375, 18376, 18377, 18378, 18379,
-    18380, 18381, 18382, 18383, 18384, 18385, 18386, 18388, 18389, 18390, 18391,
-    18392, 18393, 18394, 18395, 18396, 18397, 18398, 18399, 18400, 18401, 18402,
-    18403, 18404, 18405, 18406, 18407, 18408, 18410, 18411, 18412, 18413, 18414,
-    18415, 18416, 18417, 18418, 18419, 18420, 18421, 18422, 18423, 18424, 18425,
-    18426, 18427, 18428, 18429, 18430, 18431, 18432, 18434, 18435, 18436, 18437,
-    18438, 18439, 18440, 18441, 18442, 18443, 18444, 18445, 18446, 18447, 18448,
-    18449, 18450, 18451, 18452, 18453, 18454, 18455, 18456, 18457, 18458, 18460,
-    18461, 18462, 18463, 18464, 18465, 18466, 18467, 18468, 18469, 18470, 18471,
-    18472, 18473, 18474, 18475, 18476, 18477, 18478, 18479, 18480, 18481, 18482,
-    18483, 18484, 18485, 18486, 18488, 18489, 18490, 18491, 18492, 18493, 18494,
-    18495, 18496, 18497, 18498, 18499, 18500, 18501, 18502, 18503, 18504, 18505,
-    18506, 18507, 18508, 18509, 18510, 18511, 18512, 18513, 18514, 18515, 18516,
-    18517, 18518, 18519, 18521, 18522, 18523, 18524, 18525, 18526, 18527, 18528,
-    18529, 18530, 18531, 18532, 18533, 18534, 18535, 18536, 18537, 18538, 18539,
-    18540, 18541, 18542, 18543, 18544, 18545, 18546, 18547, 18548, 18549, 18550,
-    18551, 18552, 18553, 18554, 18555, 18556, 18557, 18559, 18560, 18561, 18562,
-    18563, 18564, 18565, 18566, 18567, 18568, 18569, 18570, 18571, 18572, 18573,
-    18574, 18575, 18576, 18577, 18578, 18579, 18580, 18581, 18582, 18583, 18584,
-    18585, 18586, 18587, 18588, 18589, 18590, 18591, 18592, 18593, 18594, 18595,
-    18596, 18597, 18598, 18599, 18600, 18601, 18602, 18603, 18604, 18605, 18606,
-    18607, 18609, 18610, 18611, 18612, 18613, 18614, 18615, 18616, 18617, 18618,
-    18619, 18620, 18621, 18622, 18623, 18624, 18625, 18626, 18627, 18628, 18629,
-    18630, 18631, 18632, 18633, 18634, 18635, 18636, 18637, 18638, 18639, 18640,
-    18641, 18642, 18643, 18644, 18645, 18646, 18647, 18648, 18649, 18650, 18651,
-    18652, 18653, 18654, 18655, 18656, 18657, 18658, 18659, 18660, 18661, 18662,
-    18663, 18664, 18665, 18666, 18667, 18668, 18669, 18670, 18671, 18672, 18673,
-    18674, 18675, 18676, 18677, 18678, 18679, 18680, 18681, 18682, 18683, 18684,
-    18685, 18686, 18687, 18688, 18689, 18690, 18691, 18692, 18693, 18694, 18695,
-    18696, 18697, 18698, 18699, 18700, 18701, 18702, 18703, 18704, 18705, 18706,
-    18707, 18708, 18709, 18710, 18711, 18712, 18713, 18714, 18715, 18716, 18717,
-    18718, 18719, 18720, 18721, 18723, 18724, 18725, 18726, 18727, 18728, 18729,
-    18730, 18731, 18732, 18733, 18733, 18734, 18735, 18736, 18737, 18738, 18739,
-    18740, 18741, 18742, 18743, 18744, 18745, 18746, 18747, 18748, 18749, 18750,
-    18751, 18752, 18753, 18754, 18755, 18756, 18757, 18758, 18759, 18760, 18761,
-    18762, 18763, 18764, 18765, 18766, 18767, 18768, 18769, 18770, 18771, 18772,
-    18773, 18774, 18775, 18776, 18777, 18778, 18779, 18780, 18781, 18782, 18783,
-    18784, 18785, 18786, 18787, 18788, 18789, 18790, 18791, 18792, 18793, 18794,
-    18795, 18796, 18797, 18798, 18799, 18800, 18801, 18802, 18803, 18804, 18805,
-    18806, 18807, 18808, 18809, 18810, 18811, 18812, 18813, 18814, 18815, 18816,
-    18817, 18818, 18819, 18820, 18821, 18822, 18823, 18824, 18825, 18826, 18827,
-    18828, 18829, 18830, 18831, 18832, 18833, 18834, 18835, 18836, 18837, 18838,
-    18839, 18840, 18841, 18842, 18843, 18844, 18845, 18846, 18846, 18847, 18848,
-    18849, 18850, 18851, 18852, 18853, 18854, 18855, 18856, 18857, 18858, 18859,
-    18860, 18861, 18862, 18863, 18864, 18865, 18866, 18867, 18868, 18869, 18870,
-    18871, 18872, 18873, 18874, 18875, 18876, 18877, 18878, 18879, 18880, 18881,
-    18882, 18883, 18884, 18885, 18886, 18887, 18888, 18889, 18890, 18891, 18892,
-    18893, 18894, 18894, 18895, 18896, 18897, 18898, 18899, 18900, 18901, 18902,
-    18903, 18904, 18905, 18906, 18907, 18908, 18909, 18910, 18911, 18912, 18913,
-    18914, 18915, 18916, 18917, 18918, 18919, 18920, 18921, 18922, 18923, 18924,
-    18925, 18926, 18927, 18928, 18929, 18930, 18931, 18931, 18932, 18933, 18934,
-    18935, 18936, 18937, 18938, 18939, 18940, 18941, 18942, 18943, 18944, 18945,
-    18946, 18947, 18948, 18949, 18950, 18951, 18952, 18953, 18954, 18955, 18956,
-    18957, 18958, 18959, 18960, 18961, 18962, 18963, 18963, 18964, 18965, 18966,
-    18967, 18968, 18969, 18970, 18971, 18972, 18973, 18974, 18975, 18976, 18977,
-    18978, 18979, 18980, 18981, 18982, 18983, 18984, 18985, 18986, 18987, 18988,
-    18989, 18990, 18990, 18991, 18992, 18993, 18994, 18995, 18996, 18997, 18998,
-    18999, 19000, 19001, 19002, 19003, 19004, 19005, 19006, 19007, 19008, 19009,
-    19010, 19011, 19012, 19013, 19014, 19015, 19015, 19016, 19017, 19018, 19019,
-    19020, 19021, 19022, 19023, 19024, 19025, 19026, 19027, 19028, 19029, 19030,
-    19031, 19032, 19033, 19034, 19035, 19036, 19037, 19038, 19038, 19039, 19040,
-    19041, 19042, 19043, 19044, 19045, 19046, 19047, 19048, 19049, 19050, 19051,
-    19052, 19053, 19054, 19055, 19056, 19057, 19058, 19059, 19059, 19060, 19061,
-    19062, 19063, 19064, 19065, 19066, 19067, 19068, 19069, 19070, 19071, 19072,
-    19073, 19074, 19075, 19076, 19077, 19078, 19079, 19079, 19080, 19081, 19082,
-    19083, 19084, 19085, 19086, 19087, 19088, 19089, 19090, 19091, 19092, 19093,
-    19094, 19095, 19096, 19097, 19098, 19098, 19099, 19100, 19101, 19102, 19103,
-    19104, 19105, 19106, 19107, 19108, 19109, 19110, 19111, 19112, 19113, 19114,
-    19115, 19116, 19116, 19117, 19118, 19119, 19120, 19121, 19122, 19123, 19124,
-    19125, 19126, 19127, 19128, 19129, 19130, 19131, 19132, 19133, 19133, 19134,
-    19135, 19136, 19137, 19138, 19139, 19140, 19141, 19142, 19143, 19144, 19145,
-    19146, 19147, 19148, 19149, 19149, 19150, 19151, 19152, 19153, 19154, 19155,
-    19156, 19157, 19158, 19159, 19160, 19161, 19162, 19163, 19164, 19165, 19165,
-    19166, 19167, 19168, 19169, 19170, 19171, 19172, 19173, 19174, 19175, 19176,
-    19177, 19178, 19179, 19180, 19180, 19181, 19182, 19183, 19184, 19185, 19186,
-    19187, 19188, 19189, 19190, 19191, 19192, 19193, 19194, 19194, 19195, 19196,
-    19197, 19198, 19199, 19200, 19201, 19202, 19203, 19204, 19205, 19206, 19207,
-    19208, 19209, 19209, 19210, 19211, 19212, 19213, 19214, 19215, 19216, 19217,
-    19218, 19219, 19220, 19221, 19222, 19222, 19223, 19224, 19225, 19226, 19227,
-    19228, 19229, 19230, 19231, 19232, 19233, 19234, 19235, 19236, 19236, 19237,
-    19238, 19239, 19240, 19241, 19242, 19243, 19244, 19245, 19246, 19247, 19248,
-    19249, 19249, 19250, 19251, 19252, 19253, 19254, 19255, 19256, 19257, 19258,
-    19259, 19260, 19261, 19261, 19262, 19263, 19264, 19265, 19266, 19267, 19268,
-    19269, 19270, 19271, 19272, 19273, 19274, 19274, 19275, 19276, 19277, 19278,
-    19279, 19280, 19281, 19282, 19283, 19284, 19285, 19286, 19286, 19287, 19288,
-    19289, 19290, 19291, 19292, 19293, 19294, 19295, 19296, 19297, 19297, 19298,
-    19299, 19300, 19301, 19302, 19303, 19304, 19305, 19306, 19307, 19308, 19309,
-    19309, 19310, 19311, 19312, 19313, 19314, 19315, 19316, 19317, 19318, 19319,
-    19320, 19320, 19321, 19322, 19323, 19324, 19325, 19326, 19327, 19328, 19329,
-    19330, 19331, 19331, 19332, 19333, 19334, 19335, 19336, 19337, 19338, 19339,
-    19340, 19341, 19342, 19342, 19343, 19344, 19345, 19346, 19347, 19348, 19349,
-    19350, 19351, 19352, 19353, 19353, 19354, 19355, 19356, 19357, 19358, 19359,
-    19360, 19361, 19362, 19363, 19363, 19364, 19365, 19366, 19367, 19368, 19369,
-    19370, 19371, 19372, 19373, 19373, 19374, 19375, 19376, 19377, 19378, 19379,
-    19380, 19381, 19382, 19383, 19383, 19384, 19385, 19386, 19387, 19388, 19389,
-    19390, 19391, 19392, 19393, 19393, 19394, 19395, 19396, 19397, 19398, 19399,
-    19400, 19401, 19402, 19403, 19403, 19404, 19405, 19406, 19407, 19408, 19409,
-    19410, 19411, 19412, 19413, 19413, 19414, 19415, 19416, 19417, 19418, 19419,
-    19420, 19421, 19422, 19422, 19423, 19424, 19425, 19426, 19427, 19428, 19429,
-    19430, 19431, 19432, 19432, 19433, 19434, 19435, 19436, 19437, 19438, 19439,
-    19440, 19441, 19441, 19442, 19443, 19444, 19445, 19446, 19447, 19448, 19449,
-    19450, 19450, 19451, 19452, 19453, 19454, 19455, 19456, 19457, 19458, 19459,
-    19459, 19460, 19461, 19462, 19463, 19464, 19465, 19466, 19467, 19468, 19468,
-    19469, 19470, 19471, 19472, 19473, 19474, 19475, 19476, 19476, 19477, 19478,
-    19479, 19480, 19481, 19482, 19483, 19484, 19485, 19485, 19486, 19487, 19488,
-    19489, 19490, 19491, 19492, 19493, 19494, 19494, 19495, 19496, 19497, 19498,
-    19499, 19500, 19501, 19502, 19502, 19503, 19504, 19505, 19506, 19507, 19508,
-    19509, 19510, 19510, 19511, 19512, 19513, 19514, 19515, 19516, 19517, 19518,
-    19519, 19519, 19520, 19521, 19522, 19523, 19524, 19525, 19526, 19527, 19527,
-    19528, 19529, 19530, 19531, 19532, 19533, 19534, 19535, 19535, 19536, 19537,
-    19538, 19539, 19540, 19541, 19542, 19543, 19543, 19544, 19545, 19546, 19547,
-    19548, 19549, 19550, 19551, 19551, 19552, 19553, 19554, 19555, 19556, 19557,
-    19558, 19558, 19559, 19560, 19561, 19562, 19563, 19564, 19565, 19566, 19566,
-    19567, 19568, 19569, 19570, 19571, 19572, 19573, 19574, 19574, 19575, 19576,
-    19577, 19578, 19579, 19580, 19581, 19581, 19582, 19583, 19584, 19585, 19586,
-    19587, 19588, 19589, 19589, 19590, 19591, 19592, 19593, 19594, 19595, 19596,
-    19596, 19597, 19598, 19599, 19600, 19601, 19602, 19603, 19603, 19604, 19605,
-    19606, 19607, 19608, 19609, 19610, 19611, 19611, 19612, 19613, 19614, 19615,
-    19616, 19617, 19618, 19618, 19619, 19620, 19621, 19622, 19623, 19624, 19625,
-    19625, 19626, 19627, 19628, 19629, 19630, 19631, 19632, 19632, 19633, 19634,
-    19635, 19636, 19637, 19638, 19639, 19639, 19640, 19641, 19642, 19643, 19644,
-    19645, 19646, 19646, 19647, 19648, 19649, 19650, 19651, 19652, 19653, 19653,
-    19654, 19655, 19656, 19657, 19658, 19659, 19660, 19660, 19661, 19662, 19663,
-    19664, 19665, 19666, 19667, 19667, 19668, 19669, 19670, 19671, 19672, 19673,
-    19673, 19674, 19675, 19676, 19677, 19678, 19679, 19680, 19680, 19681, 19682,
-    19683, 19684, 19685, 19686, 19687, 19687, 19688, 19689, 19690, 19691, 19692,
-    19693, 19693, 19694, 19695, 19696, 19697, 19698, 19699, 19700, 19700, 19701,
-    19702, 19703, 19704, 19705, 19706, 19706, 19707, 19708, 19709, 19710, 19711,
-    19712, 19713, 19713, 19714, 19715, 19716, 19717, 19718, 19719, 19719, 19720,
-    19721, 19722, 19723, 19724, 19725, 19726, 19726, 19727, 19728, 19729, 19730,
-    19731, 19732, 19732, 19733, 19734, 19735, 19736, 19737, 19738, 19738, 19739,
-    19740, 19741, 19742, 19743, 19744, 19744, 19745, 19746, 19747, 19748, 19749,
-    19750, 19751, 19751, 19752, 19753, 19754, 19755, 19756, 19757, 19757, 19758,
-    19759, 19760, 19761, 19762, 19763, 19763, 19764, 19765, 19766, 19767, 19768,
-    19769, 19769, 19770, 19771, 19772, 19773, 19774, 19775, 19775, 19776, 19777,
-    19778, 19779, 19780, 19781, 19781, 19782, 19783, 19784, 19785, 19786, 19787,
-    19787, 19788, 19789, 19790, 19791, 19792, 19793, 19793, 19794, 19795, 19796,
-    19797, 19798, 19799, 19799, 19800, 19801, 19802, 19803, 19804, 19804, 19805,
-    19806, 19807, 19808, 19809, 19810, 19810, 19811, 19812, 19813, 19814, 19815,
-    19816, 19816, 19817, 19818, 19819, 19820, 19821, 19822, 19822, 19823, 19824,
-    19825, 19826, 19827, 19827, 19828, 19829, 19830, 19831, 19832, 19833, 19833,
-    19834, 19835, 19836, 19837, 19838, 19839, 19839, 19840, 19841, 19842, 19843,
-    19844, 19844, 19845, 19846, 19847, 19848, 19849, 19850, 19850, 19851, 19852,
-    19853, 19854, 19855, 19855, 19856, 19857, 19858, 19859, 19860, 19861, 19861,
-    19862, 19863, 19864, 19865, 19866, 19866, 19867, 19868, 19869, 19870, 19871,
-    19872, 19872, 19873, 19874, 19875, 19876, 19877, 19877, 19878, 19879, 19880,
-    19881, 19882, 19883, 19883, 19884, 19885, 19886, 19887, 19888, 19888, 19889,
-    19890, 19891, 19892, 19893, 19893, 19894, 19895, 19896, 19897, 19898, 19899,
-    19899, 19900, 19901, 19902, 19903, 19904, 19904, 19905, 19906, 19907, 19908,
-    19909, 19909, 19910, 19911, 19912, 19913, 19914, 19914, 19915, 19916, 19917,
-    19918, 19919, 19919, 19920, 19921, 19922, 19923, 19924, 19925, 19925, 19926,
-    19927, 19928, 19929, 19930, 19930, 19931, 19932, 19933, 19934, 19935, 19935,
-    19936, 19937, 19938, 19939, 19940, 19940, 19941, 19942, 19943, 19944, 19945,
-    19945, 19946, 19947, 19948, 19949, 19950, 19950, 19951, 19952, 19953, 19954,
-    19955, 19955, 19956, 19957, 19958, 19959, 19960, 19960, 19961, 19962, 19963,
-    19964, 19965, 19965, 19966, 19967, 19968, 19969, 19970, 19970, 19971, 19972,
-    19973, 19974, 19975, 19975, 19976, 19977, 19978, 19979, 19980, 19980, 19981,
-    19982, 19983, 19984, 19985, 19985, 19986, 19987, 19988, 19989, 19990, 19990,
-    19991, 19992, 19993, 19994, 19994, 19995, 19996, 19997, 19998, 19999, 19999,
-    20000, 20001, 20002, 20003, 20004, 20004, 20005, 20006, 20007, 20008, 20009,
-    20009, 20010, 20011, 20012, 20013, 20014, 20014, 20015, 20016, 20017, 20018,
-    20018, 20019, 20020, 20021, 20022, 20023, 20023, 20024, 20025, 20026, 20027,
-    20028, 20028, 20029, 20030, 20031, 20032, 20032, 20033, 20034, 20035, 20036,
-    20037, 20037, 20038, 20039, 20040, 20041, 20042, 20042, 20043, 20044, 20045,
-    20046, 20046, 20047, 20048, 20049, 20050, 20051, 20051, 20052, 20053, 20054,
-    20055, 20056, 20056, 20057, 20058, 20059, 20060, 20060, 20061, 20062, 20063,
-    20064, 20065, 20065, 20066, 20067, 20068, 20069, 20069, 20070, 20071, 20072,
-    20073, 20074, 20074, 20075, 20076, 20077, 20078, 20078, 20079, 20080, 20081,
-    20082, 20083, 20083, 20084, 20085, 20086, 20087, 20087, 20088, 20089, 20090,
-    20091, 20092, 20092, 20093, 20094, 20095, 20096, 20096, 20097, 20098, 20099,
-    20100, 20100, 20101, 20102, 20103, 20104, 20105, 20105, 20106, 20107, 20108,
-    20109, 20109, 20110, 20111, 20112, 20113, 20114, 20114, 20115, 20116, 20117,
-    20118, 20118, 20119, 20120, 20121, 20122, 20122, 20123, 20124, 20125, 20126,
-    20127, 20127, 20128, 20129, 20130, 20131, 20131, 20132, 20133, 20134, 20135,
-    20135, 20136, 20137, 20138, 20139, 20139, 20140, 20141, 20142, 20143, 20144,
-    20144, 20145, 20146, 20147, 20148, 20148, 20149, 20150, 20151, 20152, 20152,
-    20153, 20154, 20155, 20156, 20156, 20157, 20158, 20159, 20160, 20161, 20161,
-    20162, 20163, 20164, 20165, 20165, 20166, 20167, 20168, 20169, 20169, 20170,
-    20171, 20172, 20173, 20173, 20174, 20175, 20176, 20177, 20177, 20178, 20179,
-    20180, 20181, 20181, 20182, 20183, 20184, 20185, 20185, 20186, 20187, 20188,
-    20189, 20190, 20190, 20191, 20192, 20193, 20194, 20194, 20195, 20196, 20197,
-    20198, 20198, 20199, 20200, 20201, 20202, 20202, 20203, 20204, 20205, 20206,
-    20206, 20207, 20208, 20209, 20210, 20210, 20211, 20212, 20213, 20214, 20214,
-    20215, 20216, 20217, 20218, 20218, 20219, 20220, 20221, 20222, 20222, 20223,
-    20224, 20225, 20226, 20226, 20227, 20228, 20229, 20230, 20230, 20231, 20232,
-    20233, 20234, 20234, 20235, 20236, 20237, 20238, 20238, 20239, 20240, 20241,
-    20242, 20242, 20243, 20244, 20245, 20246, 20246, 20247, 20248, 20249, 20249,
-    20250, 20251, 20252, 20253, 20253, 20254, 20255, 20256, 20257, 20257, 20258,
-    20259, 20260, 20261, 20261, 20262, 20263, 20264, 20265, 20265, 20266, 20267,
-    20268, 20269, 20269, 20270, 20271, 20272, 20273, 20273, 20274, 20275, 20276,
-    20276, 20277, 20278, 20279, 20280, 20280, 20281, 20282, 20283, 20284, 20284,
-    20285, 20286, 20287, 20288, 20288, 20289, 20290, 20291, 20292, 20292, 20293,
-    20294, 20295, 20295, 20296, 20297, 20298, 20299, 20299, 20300, 20301, 20302,
-    20303, 20303, 20304, 20305, 20306, 20307, 20307, 20308, 20309, 20310, 20310,
-    20311, 20312, 20313, 20314, 20314, 20315, 20316, 20317, 20318, 20318, 20319,
-    20320, 20321, 20322, 20322, 20323, 20324, 20325, 20325, 20326, 20327, 20328,
-    20329, 20329, 20330, 20331, 20332, 20333, 20333, 20334, 20335, 20336, 20336,
-    20337, 20338, 20339, 20340, 20340, 20341, 20342, 20343, 20343, 20344, 20345,
-    20346, 20347, 20347, 20348, 20349, 20350, 20351, 20351, 20352, 20353, 20354,
-    20354, 20355, 20356, 20357, 20358, 20358, 20359, 20360, 20361, 20362, 20362,
-    20363, 20364, 20365, 20365, 20366, 20367, 20368, 20369, 20369, 20370, 20371,
-    20372, 20372, 20373, 20374, 20375, 20376, 20376, 20377, 20378, 20379, 20379,
-    20380, 20381, 20382, 20383, 20383, 20384, 20385, 20386, 20386, 20387, 20388,
-    20389, 20390, 20390, 20391, 20392, 20393, 20393, 20394, 20395, 20396, 20397,
-    20397, 20398, 20399, 20400, 20400, 20401, 20402, 20403, 20404, 20404, 20405,
-    20406, 20407, 20407, 20408, 20409, 20410, 20411, 20411, 20412, 20413, 20414,
-    20414, 20415, 20416, 20417, 20418, 20418, 20419, 20420, 20421, 20421, 20422,
-    20423, 20424, 20425, 20425, 20426, 20427, 20428, 20428, 20429, 20430, 20431,
-    20431, 20432, 20433, 20434, 20435, 20435, 20436, 20437, 20438, 20438, 20439,
-    20440, 20441, 20442, 20442, 20443, 20444, 20445, 20445, 20446, 20447, 20448,
-    20448, 20449, 20450, 20451, 20452, 20452, 20453, 20454, 20455, 20455, 20456,
-    20457, 20458, 20458, 20459, 20460, 20461, 20462, 20462, 20463, 20464, 20465,
-    20465, 20466, 20467, 20468, 20468, 20469, 20470, 20471, 20472, 20472, 20473,
-    20474, 20475, 20475, 20476, 20477, 20478, 20478, 20479, 20480, 20481, 20482,
-    20482, 20483, 20484, 20485, 20485, 20486, 20487, 20488, 20488, 20489, 20490,
-    20491, 20491, 20492, 20493, 20494, 20495, 20495, 20496, 20497, 20498, 20498,
-    20499, 20500, 20501, 20501, 20502, 20503, 20504, 20504, 20505, 20506, 20507,
-    20508, 20508, 20509, 20510, 20511, 20511, 20512, 20513, 20514, 20514, 20515,
-    20516, 20517, 20517, 20518, 20519, 20520, 20521, 20521, 20522, 20523, 20524,
-    20524, 20525, 20526, 20527, 20527, 20528, 20529, 20530, 20530, 20531, 20532,
-    20533, 20533, 20534, 20535, 20536, 20537, 20537, 20538, 20539, 20540, 20540,
-    20541, 20542, 20543, 20543, 20544, 20545, 20546, 20546, 20547, 20548, 20549,
-    20549, 20550, 20551, 20552, 20552, 20553, 20554, 20555, 20555, 20556, 20557,
-    20558, 20559, 20559, 20560, 20561, 20562, 20562, 20563, 20564, 20565, 20565,
-    20566, 20567, 20568, 20568, 20569, 20570, 20571, 20571, 20572, 20573, 20574,
-    20574, 20575, 20576, 20577, 20577, 20578, 20579, 20580, 20580, 20581, 20582,
-    20583, 20583, 20584, 20585, 20586, 20586, 20587, 20588, 20589, 20589, 20590,
-    20591, 20592, 20592, 20593, 20594, 20595, 20596, 20596, 20597, 20598, 20599,
-    20599, 20600, 20601, 20602, 20602, 20603, 20604, 20605, 20605, 20606, 20607,
-    20608, 20608, 20609, 20610, 20611, 20611, 20612, 20613, 20614, 20614, 20615,
-    20616, 20617, 20617, 20618, 20619, 20620, 20620, 20621, 20622, 20623, 20623,
-    20624, 20625, 20626, 20626, 20627, 20628, 20629, 20629, 20630, 20631, 20632,
-    20632, 20633, 20634, 20635, 20635, 20636, 20637, 20638, 20638, 20639, 20640,
-    20641, 20641, 20642, 20643, 20643, 20644, 20645, 20646, 20646, 20647, 20648,
-    20649, 20649, 20650, 20651, 20652, 20652, 20653, 20654, 20655, 20655, 20656,
-    20657, 20658, 20658, 20659, 20660, 20661, 20661, 20662, 20663, 20664, 20664,
-    20665, 20666, 20667, 20667, 20668, 20669, 20670, 20670, 20671, 20672, 20673,
-    20673, 20674, 20675, 20676, 20676, 20677, 20678, 20679, 20679, 20680, 20681,
-    20681, 20682, 20683, 20684, 20684, 20685, 20686, 20687, 20687, 20688, 20689,
-    20690, 20690, 20691, 20692, 20693, 20693, 20694, 20695, 20696, 20696, 20697,
-    20698, 20699, 20699, 20700, 20701, 20701, 20702, 20703, 20704, 20704, 20705,
-    20706, 20707, 20707, 20708, 20709, 20710, 20710, 20711, 20712, 20713, 20713,
-    20714, 20715, 20716, 20716, 20717, 20718, 20718, 20719, 20720, 20721, 20721,
-    20722, 20723, 20724, 20724, 20725, 20726, 20727, 20727, 20728, 20729, 20730,
-    20730, 20731, 20732, 20732, 20733, 20734, 20735, 20735, 20736, 20737, 20738,
-    20738, 20739, 20740, 20741, 20741, 20742, 20743, 20744, 20744, 20745, 20746,
-    20746, 20747, 20748, 20749, 20749, 20750, 20751, 20752, 20752, 20753, 20754,
-    20755, 20755, 20756, 20757, 20757, 20758, 20759, 20760, 20760, 20761, 20762,
-    20763, 20763, 20764, 20765, 20766, 20766, 20767, 20768, 20768, 20769, 20770,
-    20771, 20771, 20772, 20773, 20774, 20774, 20775, 20776, 20776, 20777, 20778,
-    20779, 20779, 20780, 20781, 20782, 20782, 20783, 20784, 20785, 20785, 20786,
-    20787, 20787, 20788, 20789, 20790, 20790, 20791, 20792, 20793, 20793, 20794,
-    20795, 20795, 20796, 20797, 20798, 20798, 20799, 20800, 20801, 20801, 20802,
-    20803, 20803, 20804, 20805, 20806, 20806, 20807, 20808, 20809, 20809, 20810,
-    20811, 20811, 20812, 20813, 20814, 20814, 20815, 20816, 20817, 20817, 20818,
-    20819, 20819, 20820, 20821, 20822, 20822, 20823, 20824, 20825, 20825, 20826,
-    20827, 20827, 20828, 20829, 20830, 20830, 20831, 20832, 20832, 20833, 20834,
-    20835, 20835, 20836, 20837, 20838, 20838, 20839, 20840, 20840, 20841, 20842,
-    20843, 20843, 20844, 20845, 20846, 20846, 20847, 20848, 20848, 20849, 20850,
-    20851, 20851, 20852, 20853, 20853, 20854, 20855, 20856, 20856, 20857, 20858,
-    20858, 20859, 20860, 20861, 20861, 20862, 20863, 20864, 20864, 20865, 20866,
-    20866, 20867, 20868, 20869, 20869, 20870, 20871, 20871, 20872, 20873, 20874,
-    20874, 20875, 20876, 20876, 20877, 20878, 20879, 20879, 20880, 20881, 20882,
-    20882, 20883, 20884, 20884, 20885, 20886, 20887, 20887, 20888, 20889, 20889,
-    20890, 20891, 20892, 20892, 20893, 20894, 20894, 20895, 20896, 20897, 20897,
-    20898, 20899, 20899, 20900, 20901, 20902, 20902, 20903, 20904, 20904, 20905,
-    20906, 20907, 20907, 20908, 20909, 20909, 20910, 20911, 20912, 20912, 20913,
-    20914, 20914, 20915, 20916, 20917, 20917, 20918, 20919, 20919, 20920, 20921,
-    20922, 20922, 20923, 20924, 20924, 20925, 20926, 20927, 20927, 20928, 20929,
-    20929, 20930, 20931, 20932, 20932, 20933, 20934, 20934, 20935, 20936, 20937,
-    20937, 20938, 20939, 20939, 20940, 20941, 20942, 20942, 20943, 20944, 20944,
-    20945, 20946, 20947, 20947, 20948, 20949, 20949, 20950, 20951, 20951, 20952,
-    20953, 20954, 20954, 20955, 20956, 20956, 20957, 20958, 20959, 20959, 20960,
-    20961, 20961, 20962, 20963, 20964, 20964, 20965, 20966, 20966, 20967, 20968,
-    20968, 20969, 20970, 20971, 20971, 20972, 20973, 20973, 20974, 20975, 20976,
-    20976, 20977, 20978, 20978, 20979, 20980, 20981, 20981, 20982, 20983, 20983,
-    20984, 20985, 20985, 20986, 20987, 20988, 20988, 20989, 20990, 20990, 20991,
-    20992, 20992, 20993, 20994, 20995, 20995, 20996, 20997, 20997, 20998, 20999,
-    21000, 21000, 21001, 21002, 21002, 21003, 21004, 21004, 21005, 21006, 21007,
-    21007, 21008, 21009, 21009, 21010, 21011, 21011, 21012, 21013, 21014, 21014,
-    21015, 21016, 21016, 21017, 21018, 21019, 21019, 21020, 21021, 21021, 21022,
-    21023, 21023, 21024, 21025, 21026, 21026, 21027, 21028, 21028, 21029, 21030,
-    21030, 21031, 21032, 21033, 21033, 21034, 21035, 21035, 21036, 21037, 21037,
-    21038, 21039, 21040, 21040, 21041, 21042, 21042, 21043, 21044, 21044, 21045,
-    21046, 21047, 21047, 21048, 21049, 21049, 21050, 21051, 21051, 21052, 21053,
-    21054, 21054, 21055, 21056, 21056, 21057, 21058, 21058, 21059, 21060, 21060,
-    21061, 21062, 21063, 21063, 21064, 21065, 21065, 21066, 21067, 21067, 21068,
-    21069, 21070, 21070, 21071, 21072, 21072, 21073, 21074, 21074, 21075, 21076,
-    21076, 21077, 21078, 21079, 21079, 21080, 21081, 21081, 21082, 21083, 21083,
-    21084, 21085, 21086, 21086, 21087, 21088, 21088, 21089, 21090, 21090, 21091,
-    21092, 21092, 21093, 21094, 21095, 21095, 21096, 21097, 21097, 21098, 21099,
-    21099, 21100, 21101, 21101, 21102, 21103, 21104, 21104, 21105, 21106, 21106,
-    21107, 21108, 21108, 21109, 21110, 21110, 21111, 21112, 21112, 21113, 21114,
-    21115, 21115, 21116, 21117, 21117, 21118, 21119, 21119, 21120, 21121, 21121,
-    21122, 21123, 21124, 21124, 21125, 21126, 21126, 21127, 21128, 21128, 21129,
-    21130, 21130, 21131, 21132, 21132, 21133, 21134, 21135, 21135, 21136, 21137,
-    21137, 21138, 21139, 21139, 21140, 21141, 21141, 21142, 21143, 21143, 21144,
-    21145, 21146, 21146, 21147, 21148, 21148, 21149, 21150, 21150, 21151, 21152,
-    21152, 21153, 21154, 21154, 21155, 21156, 21157, 21157, 21158, 21159, 21159,
-    21160, 21161, 21161, 21162, 21163, 21163, 21164, 21165, 21165, 21166, 21167,
-    21167, 21168, 21169, 21170, 21170, 21171, 21172, 21172, 21173, 21174, 21174,
-    21175, 21176, 21176, 21177, 21178, 21178, 21179, 21180, 21180, 21181, 21182,
-    21183, 21183, 21184, 21185, 21185, 21186, 21187, 21187, 21188, 21189, 21189,
-    21190, 21191, 21191, 21192, 21193, 21193, 21194, 21195, 21195, 21196, 21197,
-    21198, 21198, 21199, 21200, 21200, 21201, 21202, 21202, 21203, 21204, 21204,
-    21205, 21206, 21206, 21207, 21208, 21208, 21209, 21210, 21210, 21211, 21212,
-    21212, 21213, 21214, 21215, 21215, 21216, 21217, 21217, 21218, 21219, 21219,
-    21220, 21221, 21221, 21222, 21223, 21223, 21224, 21225, 21225, 21226, 21227,
-    21227, 21228, 21229, 21229, 21230, 21231, 21231, 21232, 21233, 21233, 21234,
-    21235, 21236, 21236, 21237, 21238, 21238, 21239, 21240, 21240, 21241, 21242,
-    21242, 21243, 21244, 21244, 21245, 21246, 21246, 21247, 21248, 21248, 21249,
-    21250, 21250, 21251, 21252, 21252, 21253, 21254, 21254, 21255, 21256, 21256,
-    21257, 21258, 21258, 21259, 21260, 21260, 21261, 21262, 21262, 21263, 21264,
-    21265, 21265, 21266, 21267, 21267, 21268, 21269, 21269, 21270, 21271, 21271,
-    21272, 21273, 21273, 21274, 21275, 21275, 21276, 21277, 21277, 21278, 21279,
-    21279, 21280, 21281, 21281, 21282, 21283, 21283, 21284, 21285, 21285, 21286,
-    21287, 21287, 21288, 21289, 21289, 21290, 21291, 21291, 21292, 21293, 21293,
-    21294, 21295, 21295, 21296, 21297, 21297, 21298, 21299, 21299, 21300, 21301,
-    21301, 21302, 21303, 21303, 21304, 21305, 21305, 21306, 21307, 21307, 21308,
-    21309, 21309, 21310, 21311, 21311, 21312, 21313, 21313, 21314, 21315, 21315,
-    21316, 21317, 21317, 21318, 21319, 21319, 21320, 21321, 21321, 21322, 21323,
-    21323, 21324, 21325, 21325, 21326, 21327, 21327, 21328, 21329, 21329, 21330,
-    21331, 21331, 21332, 21333, 21333, 21334, 21335, 21335, 21336, 21337, 21337,
-    21338, 21339, 21339, 21340, 21341, 21341, 21342, 21343, 21343, 21344, 21345,
-    21345, 21346, 21347, 21347, 21348, 21349, 21349, 21350, 21351, 21351, 21352,
-    21353, 21353, 21354, 21355, 21355, 21356, 21357, 21357, 21358, 21359, 21359,
-    21360, 21361, 21361, 21362, 21363, 21363, 21364, 21365, 21365, 21366, 21367,
-    21367, 21368, 21369, 21369, 21370, 21371, 21371, 21372, 21372, 21373, 21374,
-    21374, 21375, 21376, 21376, 21377, 21378, 21378, 21379, 21380, 21380, 21381,
-    21382, 21382, 21383, 21384, 21384, 21385, 21386, 21386, 21387, 21388, 21388,
-    21389, 21390, 21390, 21391, 21392, 21392, 21393, 21394, 21394, 21395, 21396,
-    21396, 21397, 21398, 21398, 21399, 21400, 21400, 21401, 21401, 21402, 21403,
-    21403, 21404, 21405, 21405, 21406, 21407, 21407, 21408, 21409, 21409, 21410,
-    21411, 21411, 21412, 21413, 21413, 21414, 21415, 21415, 21416, 21417, 21417,
-    21418, 21419, 21419, 21420, 21420, 21421, 21422, 21422, 21423, 21424, 21424,
-    21425, 21426, 21426, 21427, 21428, 21428, 21429, 21430, 21430, 21431, 21432,
-    21432, 21433, 21434, 21434, 21435, 21436, 21436, 21437, 21437, 21438, 21439,
-    21439, 21440, 21441, 21441, 21442, 21443, 21443, 21444, 21445, 21445, 21446,
-    21447, 21447, 21448, 21449, 21449, 21450, 21451, 21451, 21452, 21452, 21453,
-    21454, 21454, 21455, 21456, 21456, 21457, 21458, 21458, 21459, 21460, 21460,
-    21461, 21462, 21462, 21463, 21464, 21464, 21465, 21466, 21466, 21467, 21467,
-    21468, 21469, 21469, 21470, 21471, 21471, 21472, 21473, 21473, 21474, 21475,
-    21475, 21476, 21477, 21477, 21478, 21478, 21479, 21480, 21480, 21481, 21482,
-    21482, 21483, 21484, 21484, 21485, 21486, 21486, 21487, 21488, 21488, 21489,
-    21489, 21490, 21491, 21491, 21492, 21493, 21493, 21494, 21495, 21495, 21496,
-    21497, 21497, 21498, 21499, 21499, 21500, 21500, 21501, 21502, 21502, 21503,
-    21504, 21504, 21505, 21506, 21506, 21507, 21508, 21508, 21509, 21510, 21510,
-    21511, 21511, 21512, 21513, 21513, 21514, 21515, 21515, 21516, 21517, 21517,
-    21518, 21519, 21519, 21520, 21520, 21521, 21522, 21522, 21523, 21524, 21524,
-    21525, 21526, 21526, 21527, 21528, 21528, 21529, 21529, 21530, 21531, 21531,
-    21532, 21533, 21533, 21534, 21535, 21535, 21536, 21537, 21537, 21538, 21538,
-    21539, 21540, 21540, 21541, 21542, 21542, 21543, 21544, 21544, 21545, 21545,
-    21546, 21547, 21547, 21548, 21549, 21549, 21550, 21551, 21551, 21552, 21553,
-    21553, 21554, 21554, 21555, 21556, 21556, 21557, 21558, 21558, 21559, 21560,
-    21560, 21561, 21561, 21562, 21563, 21563, 21564, 21565, 21565, 21566, 21567,
-    21567, 21568, 21569, 21569, 21570, 21570, 21571, 21572, 21572, 21573, 21574,
-    21574, 21575, 21576, 21576, 21577, 21577, 21578, 21579, 21579, 21580, 21581,
-    21581, 21582, 21583, 21583, 21584, 21584, 21585, 21586, 21586, 21587, 21588,
-    21588, 21589, 21590, 21590, 21591, 21591, 21592, 21593, 21593, 21594, 21595,
-    21595, 21596, 21597, 21597, 21598, 21598, 21599, 21600, 21600, 21601, 21602,
-    21602, 21603, 21603, 21604, 21605, 21605, 21606, 21607, 21607, 21608, 21609,
-    21609, 21610, 21610, 21611, 21612, 21612, 21613, 21614, 21614, 21615, 21616,
-    21616, 21617, 21617, 21618, 21619, 21619, 21620, 21621, 21621, 21622, 21622,
-    21623, 21624, 21624, 21625, 21626, 21626, 21627, 21628, 21628, 21629, 21629,
-    21630, 21631, 21631, 21632, 21633, 21633, 21634, 21634, 21635, 21636, 21636,
-    21637, 21638, 21638, 21639, 21640, 21640, 21641, 21641, 21642, 21643, 21643,
-    21644, 21645, 21645, 21646, 21646, 21647, 21648, 21648, 21649, 21650, 21650,
-    21651, 21651, 21652, 21653, 21653, 21654, 21655, 21655, 21656, 21656, 21657,
-    21658, 21658, 21659, 21660, 21660, 21661, 21662, 21662, 21663, 21663, 21664,
-    21665, 21665, 21666, 21667, 21667, 21668, 21668, 21669, 21670, 21670, 21671,
-    21672, 21672, 21673, 21673, 21674, 21675, 21675, 21676, 21677, 21677, 21678,
-    21678, 21679, 21680, 21680, 21681, 21682, 21682, 21683, 21683, 21684, 21685,
-    21685, 21686, 21687, 21687, 21688, 21688, 21689, 21690, 21690, 21691, 21692,
-    21692, 21693, 21693, 21694, 21695, 21695, 21696, 21697, 21697, 21698, 21698,
-    21699, 21700, 21700, 21701, 21702, 21702, 21703, 21703, 21704, 21705, 21705,
-    21706, 21707, 21707, 21708, 21708, 21709, 21710, 21710, 21711, 21711, 21712,
-    21713, 21713, 21714, 21715, 21715, 21716, 21716, 21717, 21718, 21718, 21719,
-    21720, 21720, 21721, 21721, 21722, 21723, 21723, 21724, 21725, 21725, 21726,
-    21726, 21727, 21728, 21728, 21729, 21730, 21730, 21731, 21731, 21732, 21733,
-    21733, 21734, 21734, 21735, 21736, 21736, 21737, 21738, 21738, 21739, 21739,
-    21740, 21741, 21741, 21742, 21743, 21743, 21744, 21744, 21745, 21746, 21746,
-    21747, 21747, 21748, 21749, 21749, 21750, 21751, 21751, 21752, 21752, 21753,
-    21754, 21754, 21755, 21755, 21756, 21757, 21757, 21758, 21759, 21759, 21760,
-    21760, 21761, 21762, 21762, 21763, 21763, 21764, 21765, 21765, 21766, 21767,
-    21767, 21768, 21768, 21769, 21770, 21770, 21771, 21771, 21772, 21773, 21773,
-    21774, 21775, 21775, 21776, 21776, 21777, 21778, 21778, 21779, 21779, 21780,
-    21781, 21781, 21782, 21783, 21783, 21784, 21784, 21785, 21786, 21786, 21787,
-    21787, 21788, 21789, 21789, 21790, 21791, 21791, 21792, 21792, 21793, 21794,
-    21794, 21795, 21795, 21796, 21797, 21797, 21798, 21798, 21799, 21800, 21800,
-    21801, 21802, 21802, 21803, 21803, 21804, 21805, 21805, 21806, 21806, 21807,
-    21808, 21808, 21809, 21810, 21810, 21811, 21811, 21812, 21813, 21813, 21814,
-    21814, 21815, 21816, 21816, 21817, 21817, 21818, 21819, 21819, 21820, 21820,
-    21821, 21822, 21822, 21823, 21824, 21824, 21825, 21825, 21826, 21827, 21827,
-    21828, 21828, 21829, 21830, 21830, 21831, 21831, 21832, 21833, 21833, 21834,
-    21834, 21835, 21836, 21836, 21837, 21838, 21838, 21839, 21839, 21840, 21841,
-    21841, 21842, 21842, 21843, 21844, 21844, 21845, 21845, 21846, 21847, 21847,
-    21848, 21848, 21849, 21850, 21850, 21851, 21852, 21852, 21853, 21853, 21854,
-    21855, 21855, 21856, 21856, 21857, 21858, 21858, 21859, 21859, 21860, 21861,
-    21861, 21862, 21862, 21863, 21864, 21864, 21865, 21865, 21866, 21867, 21867,
-    21868, 21868, 21869, 21870, 21870, 21871, 21871, 21872, 21873, 21873, 21874,
-    21874, 21875, 21876, 21876, 21877, 21878, 21878, 21879, 21879, 21880, 21881,
-    21881, 21882, 21882, 21883, 21884, 21884, 21885, 21885, 21886, 21887, 21887,
-    21888, 21888, 21889, 21890, 21890, 21891, 21891, 21892, 21893, 21893, 21894,
-    21894, 21895, 21896, 21896, 21897, 21897, 21898, 21899, 21899, 21900, 21900,
-    21901, 21902, 21902, 21903, 21903, 21904, 21905, 21905, 21906, 21906, 21907,
-    21908, 21908, 21909, 21909, 21910, 21911, 21911, 21912, 21912, 21913, 21914,
-    21914, 21915, 21915, 21916, 21917, 21917, 21918, 21918, 21919, 21920, 21920,
-    21921, 21921, 21922, 21923, 21923, 21924, 21924, 21925, 21926, 21926, 21927,
-    21927, 21928, 21929, 21929, 21930, 21930, 21931, 21932, 21932, 21933, 21933,
-    21934, 21935, 21935, 21936, 21936, 21937, 21938, 21938, 21939, 21939, 21940,
-    21941, 21941, 21942, 21942, 21943, 21944, 21944, 21945, 21945, 21946, 21946,
-    21947, 21948, 21948, 21949, 21949, 21950, 21951, 21951, 21952, 21952, 21953,
-    21954, 21954, 21955, 21955, 21956, 21957, 21957, 21958, 21958, 21959, 21960,
-    21960, 21961, 21961, 21962, 21963, 21963, 21964, 21964, 21965, 21966, 21966,
-    21967, 21967, 21968, 21968, 21969, 21970, 21970, 21971, 21971, 21972, 21973,
-    21973, 21974, 21974, 21975, 21976, 21976, 21977, 21977, 21978, 21979, 21979,
-    21980, 21980, 21981, 21982, 21982, 21983, 21983, 21984, 21984, 21985, 21986,
-    21986, 21987, 21987, 21988, 21989, 21989, 21990, 21990, 21991, 21992, 21992,
-    21993, 21993, 21994, 21995, 21995, 21996, 21996, 21997, 21997, 21998, 21999,
-    21999, 22000, 22000, 22001, 22002, 22002, 22003, 22003, 22004, 22005, 22005,
-    22006, 22006, 22007, 22008, 22008, 22009, 22009, 22010, 22010, 22011, 22012,
-    22012, 22013, 22013, 22014, 22015, 22015, 22016, 22016, 22017, 22018, 22018,
-    22019, 22019, 22020, 22020, 22021, 22022, 22022, 22023, 22023, 22024, 22025,
-    22025, 22026, 22026, 22027, 22028, 22028, 22029, 22029, 22030, 22030, 22031,
-    22032, 22032, 22033, 22033, 22034, 22035, 22035, 22036, 22036, 22037, 22037,
-    22038, 22039, 22039, 22040, 22040, 22041, 22042, 22042, 22043, 22043, 22044,
-    22045, 22045, 22046, 22046, 22047, 22047, 22048, 22049, 22049, 22050, 22050,
-    22051, 22052, 22052, 22053, 22053, 22054, 22054, 22055, 22056, 22056, 22057,
-    22057, 22058, 22059, 22059, 22060, 22060, 22061, 22061, 22062, 22063, 22063,
-    22064, 22064, 22065, 22066, 22066, 22067, 22067, 22068, 22068, 22069, 22070,
-    22070, 22071, 22071, 22072, 22073, 22073, 22074, 22074, 22075, 22075, 22076,
-    22077, 22077, 22078, 22078, 22079, 22080, 22080, 22081, 22081, 22082, 22082,
-    22083, 22084, 22084, 22085, 22085, 22086, 22086, 22087, 22088, 22088, 22089,
-    22089, 22090, 22091, 22091, 22092, 22092, 22093, 22093, 22094, 22095, 22095,
-    22096, 22096, 22097, 22098, 22098, 22099, 22099, 22100, 22100, 22101, 22102,
-    22102, 22103, 22103, 22104, 22104, 22105, 22106, 22106, 22107, 22107, 22108,
-    22109, 22109, 22110, 22110, 22111, 22111, 22112, 22113, 22113, 22114, 22114,
-    22115, 22115, 22116, 22117, 22117, 22118, 22118, 22119, 22119, 22120, 22121,
-    22121, 22122, 22122, 22123, 22124, 22124, 22125, 22125, 22126, 22126, 22127,
-    22128, 22128, 22129, 22129, 22130, 22130, 22131, 22132, 22132, 22133, 22133,
-    22134, 22134, 22135, 22136, 22136, 22137, 22137, 22138, 22138, 22139, 22140,
-    22140, 22141, 22141, 22142, 22143, 22143, 22144, 22144, 22145, 22145, 22146,
-    22147, 22147, 22148, 22148, 22149, 22149, 22150, 22151, 22151, 22152, 22152,
-    22153, 22153, 22154, 22155, 22155, 22156, 22156, 22157, 22157, 22158, 22159,
-    22159, 22160, 22160, 22161, 22161, 22162, 22163, 22163, 22164, 22164, 22165,
-    22165, 22166, 22167, 22167, 22168, 22168, 22169, 22169, 22170, 22171, 22171,
-    22172, 22172, 22173, 22173, 22174, 22175, 22175, 22176, 22176, 22177, 22177,
-    22178, 22179, 22179, 22180, 22180, 22181, 22181, 22182, 22183, 22183, 22184,
-    22184, 22185, 22185, 22186, 22187, 22187, 22188, 22188, 22189, 22189, 22190,
-    22191, 22191, 22192, 22192, 22193, 22193, 22194, 22195, 22195, 22196, 22196,
-    22197, 22197, 22198, 22199, 22199, 22200, 22200, 22201, 22201, 22202, 22203,
-    22203, 22204, 22204, 22205, 22205, 22206, 22207, 22207, 22208, 22208, 22209,
-    22209, 22210, 22210, 22211, 22212, 22212, 22213, 22213, 22214, 22214, 22215,
-    22216, 22216, 22217, 22217, 22218, 22218, 22219, 22220, 22220, 22221, 22221,
-    22222, 22222, 22223, 22224, 22224, 22225, 22225, 22226, 22226, 22227, 22227,
-    22228, 22229, 22229, 22230, 22230, 22231, 22231, 22232, 22233, 22233, 22234,
-    22234, 22235, 22235, 22236, 22237, 22237, 22238, 22238, 22239, 22239, 22240,
-    22240, 22241, 22242, 22242, 22243, 22243, 22244, 22244, 22245, 22246, 22246,
-    22247, 22247, 22248, 22248, 22249, 22249, 22250, 22251, 22251, 22252, 22252,
-    22253, 22253, 22254, 22255, 22255, 22256, 22256, 22257, 22257, 22258, 22258,
-    22259, 22260, 22260, 22261, 22261, 22262, 22262, 22263, 22264, 22264, 22265,
-    22265, 22266, 22266, 22267, 22267, 22268, 22269, 22269, 22270, 22270, 22271,
-    22271, 22272, 22273, 22273, 22274, 22274, 22275, 22275, 22276, 22276, 22277,
-    22278, 22278, 22279, 22279, 22280, 22280, 22281, 22281, 22282, 22283, 22283,
-    22284, 22284, 22285, 22285, 22286, 22287, 22287, 22288, 22288, 22289, 22289,
-    22290, 22290, 22291, 22292, 22292, 22293, 22293, 22294, 22294, 22295, 22295,
-    22296, 22297, 22297, 22298, 22298, 22299, 22299, 22300, 22300, 22301, 22302,
-    22302, 22303, 22303, 22304, 22304, 22305, 22306, 22306, 22307, 22307, 22308,
-    22308, 22309, 22309, 22310, 22311, 22311, 22312, 22312, 22313, 22313, 22314,
-    22314, 22315, 22316, 22316, 22317, 22317, 22318, 22318, 22319, 22319, 22320,
-    22321, 22321, 22322, 22322, 22323, 22323, 22324, 22324, 22325, 22326, 22326,
-    22327, 22327, 22328, 22328, 22329, 22329, 22330, 22331, 22331, 22332, 22332,
-    22333, 22333, 22334, 22334, 22335, 22336, 22336, 22337, 22337, 22338, 22338,
-    22339, 22339, 22340, 22341, 22341, 22342, 22342, 22343, 22343, 22344, 22344,
-    22345, 22345, 22346, 22347, 22347, 22348, 22348, 22349, 22349, 22350, 22350,
-    22351, 22352, 22352, 22353, 22353, 22354, 22354, 22355, 22355, 22356, 22357,
-    22357, 22358, 22358, 22359, 22359, 22360, 22360, 22361, 22361, 22362, 22363,
-    22363, 22364, 22364, 22365, 22365, 22366, 22366, 22367, 22368, 22368, 22369,
-    22369, 22370, 22370, 22371, 22371, 22372, 22373, 22373, 22374, 22374, 22375,
-    22375, 22376, 22376, 22377, 22377, 22378, 22379, 22379, 22380, 22380, 22381,
-    22381, 22382, 22382, 22383, 22384, 22384, 22385, 22385, 22386, 22386, 22387,
-    22387, 22388, 22388, 22389, 22390, 22390, 22391, 22391, 22392, 22392, 22393,
-    22393, 22394, 22394, 22395, 22396, 22396, 22397, 22397, 22398, 22398, 22399,
-    22399, 22400, 22401, 22401, 22402, 22402, 22403, 22403, 22404, 22404, 22405,
-    22405, 22406, 22407, 22407, 22408, 22408, 22409, 22409, 22410, 22410, 22411,
-    22411, 22412, 22413, 22413, 22414, 22414, 22415, 22415, 22416, 22416, 22417,
-    22417, 22418, 22419, 22419, 22420, 22420, 22421, 22421, 22422, 22422, 22423,
-    22423, 22424, 22425, 22425, 22426, 22426, 22427, 22427, 22428, 22428, 22429,
-    22429, 22430, 22431, 22431, 22432, 22432, 22433, 22433, 22434, 22434, 22435,
-    22435, 22436, 22437, 22437, 22438, 22438, 22439, 22439, 22440, 22440, 22441,
-    22441, 22442, 22442, 22443, 22444, 22444, 22445, 22445, 22446, 22446, 22447,
-    22447, 22448, 22448, 22449, 22450, 22450, 22451, 22451, 22452, 22452, 22453,
-    22453, 22454, 22454, 22455, 22455, 22456, 22457, 22457, 22458, 22458, 22459,
-    22459, 22460, 22460, 22461, 22461, 22462, 22463, 22463, 22464, 22464, 22465,
-    22465, 22466, 22466, 22467, 22467, 22468, 22468, 22469, 22470, 22470, 22471,
-    22471, 22472, 22472, 22473, 22473, 22474, 22474, 22475, 22475, 22476, 22477,
-    22477, 22478, 22478, 22479, 22479, 22480, 22480, 22481, 22481, 22482, 22482,
-    22483, 22484, 22484, 22485, 22485, 22486, 22486, 22487, 22487, 22488, 22488,
-    22489, 22489, 22490, 22491, 22491, 22492, 22492, 22493, 22493, 22494, 22494,
-    22495, 22495, 22496, 22496, 22497, 22498, 22498, 22499, 22499, 22500, 22500,
-    22501, 22501, 22502, 22502, 22503, 22503, 22504, 22505, 22505, 22506, 22506,
-    22507, 22507, 22508, 22508, 22509, 22509, 22510, 22510, 22511, 22512, 22512,
-    22513, 22513, 22514, 22514, 22515, 22515, 22516, 22516, 22517, 22517, 22518,
-    22518, 22519, 22520, 22520, 22521, 22521, 22522, 22522, 22523, 22523, 22524,
-    22524, 22525, 22525, 22526, 22526, 22527, 22528, 22528, 22529, 22529, 22530,
-    22530, 22531, 22531, 22532, 22532, 22533, 22533, 22534, 22534, 22535, 22536,
-    22536, 22537, 22537, 22538, 22538, 22539, 22539, 22540, 22540, 22541, 22541,
-    22542, 22542, 22543, 22544, 22544, 22545, 22545, 22546, 22546, 22547, 22547,
-    22548, 22548, 22549, 22549, 22550, 22550, 22551, 22552, 22552, 22553, 22553,
-    22554, 22554, 22555, 22555, 22556, 22556, 22557, 22557, 22558, 22558, 22559,
-    22559, 22560, 22561, 22561, 22562, 22562, 22563, 22563, 22564, 22564, 22565,
-    22565, 22566, 22566, 22567, 22567, 22568, 22569, 22569, 22570, 22570, 22571,
-    22571, 22572, 22572, 22573, 22573, 22574, 22574, 22575, 22575, 22576, 22576,
-    22577, 22578, 22578, 22579, 22579, 22580, 22580, 22581, 22581, 22582, 22582,
-    22583, 22583, 22584, 22584, 22585, 22585, 22586, 22586, 22587, 22588, 22588,
-    22589, 22589, 22590, 22590, 22591, 22591, 22592, 22592, 22593, 22593, 22594,
-    22594, 22595, 22595, 22596, 22597, 22597, 22598, 22598, 22599, 22599, 22600,
-    22600, 22601, 22601, 22602, 22602, 22603, 22603, 22604, 22604, 22605, 22605,
-    22606, 22607, 22607, 22608, 22608, 22609, 22609, 22610, 22610, 22611, 22611,
-    22612, 22612, 22613, 22613, 22614, 22614, 22615, 22615, 22616, 22617, 22617,
-    22618, 22618, 22619, 22619, 22620, 22620, 22621, 22621, 22622, 22622, 22623,
-    22623, 22624, 22624, 22625, 22625, 22626, 22626, 22627, 22628, 22628, 22629,
-    22629, 22630, 22630, 22631, 22631, 22632, 22632, 22633, 22633, 22634, 22634,
-    22635, 22635, 22636, 22636, 22637, 22637, 22638, 22639, 22639, 22640, 22640,
-    22641, 22641, 22642, 22642, 22643, 22643, 22644, 22644, 22645, 22645, 22646,
-    22646, 22647, 22647, 22648, 22648, 22649, 22649, 22650, 22651, 22651, 22652,
-    22652, 22653, 22653, 22654, 22654, 22655, 22655, 22656, 22656, 22657, 22657,
-    22658, 22658, 22659, 22659, 22660, 22660, 22661, 22661, 22662, 22662, 22663,
-    22664, 22664, 22665, 22665, 22666, 22666, 22667, 22667, 22668, 22668, 22669,
-    22669, 22670, 22670, 22671, 22671, 22672, 22672, 22673, 22673, 22674, 22674,
-    22675, 22675, 22676, 22677, 22677, 22678, 22678, 22679, 22679, 22680, 22680,
-    22681, 22681, 22682, 22682, 22683, 22683, 22684, 22684, 22685, 22685, 22686,
-    22686, 22687, 22687, 22688, 22688, 22689, 22689, 22690, 22691, 22691, 22692,
-    22692, 22693, 22693, 22694, 22694, 22695, 22695, 22696, 22696, 22697, 22697,
-    22698, 22698, 22699, 22699, 22700, 22700, 22701, 22701, 22702, 22702, 22703,
-    22703, 22704, 22704, 22705, 22705, 22706, 22707, 22707, 22708, 22708, 22709,
-    22709, 22710, 22710, 22711, 22711, 22712, 22712, 22713, 22713, 22714, 22714,
-    22715, 22715, 22716, 22716, 22717, 22717, 22718, 22718, 22719, 22719, 22720,
-    22720, 22721, 22721, 22722, 22722, 22723, 22724, 22724, 22725, 22725, 22726,
-    22726, 22727, 22727, 22728, 22728, 22729, 22729, 22730, 22730, 22731, 22731,
-    22732, 22732, 22733, 22733, 22734, 22734, 22735, 22735, 22736, 22736, 22737,
-    22737, 22738, 22738, 22739, 22739, 22740, 22740, 22741, 22741, 22742, 22742,
-    22743, 22744, 22744, 22745, 22745, 22746, 22746, 22747, 22747, 22748, 22748,
-    22749, 22749, 22750, 22750, 22751, 22751, 22752, 22752, 22753, 22753, 22754,
-    22754, 22755, 22755, 22756, 22756, 22757, 22757, 22758, 22758, 22759, 22759,
-    22760, 22760, 22761, 22761, 22762, 22762, 22763, 22763, 22764, 22764, 22765,
-    22765, 22766, 22766, 22767, 22768, 22768, 22769, 22769, 22770, 22770, 22771,
-    22771, 22772, 22772, 22773, 22773, 22774, 22774, 22775, 22775, 22776, 22776,
-    22777, 22777, 22778, 22778, 22779, 22779, 22780, 22780, 22781, 22781, 22782,
-    22782, 22783, 22783, 22784, 22784, 22785, 22785, 22786, 22786, 22787, 22787,
-    22788, 22788, 22789, 22789, 22790, 22790, 22791, 22791, 22792, 22792, 22793,
-    22793, 22794, 22794, 22795, 22795, 22796, 22796, 22797, 22797, 22798, 22798,
-    22799, 22800, 22800, 22801, 22801, 22802, 22802, 22803, 22803, 22804, 22804,
-    22805, 22805, 22806, 22806, 22807, 22807, 22808, 22808, 22809, 22809, 22810,
-    22810, 22811, 22811, 22812, 22812, 22813, 22813, 22814, 22814, 22815, 22815,
-    22816, 22816, 22817, 22817, 22818, 22818, 22819, 22819, 22820, 22820, 22821,
-    22821, 22822, 22822, 22823, 22823, 22824, 22824, 22825, 22825, 22826, 22826,
-    22827, 22827, 22828, 22828, 22829, 22829, 22830, 22830, 22831, 22831, 22832,
-    22832, 22833, 22833, 22834, 22834, 22835, 22835, 22836, 22836, 22837, 22837,
-    22838, 22838, 22839, 22839, 22840, 22840, 22841, 22841, 22842, 22842, 22843,
-    22843, 22844, 22844, 22845, 22845, 22846, 22846, 22847, 22847, 22848, 22848,
-    22849, 22849, 22850, 22850, 22851, 22851, 22852, 22852, 22853, 22853, 22854,
-    22854, 22855, 22855, 22856, 22856, 22857, 22857, 22858, 22858, 22859, 22859,
-    22860, 22860, 22861, 22861, 22862, 22862, 22863, 22863, 22864, 22864, 22865,
-    22865, 22866, 22866, 22867, 22867, 22868, 22868, 22869, 22869, 22870, 22870,
-    22871, 22871, 22872, 22872, 22873, 22873, 22874, 22874, 22875, 22875, 22876,
-    22876, 22877, 22877, 22878, 22878, 22879, 22879, 22880, 22880, 22881, 22881,
-    22882, 22882, 22883, 22883, 22884, 22884, 22885, 22885, 22886, 22886, 22887,
-    22887, 22888, 22888, 22889, 22889, 22890, 22890, 22891, 22891, 22892, 22892,
-    22893, 22893, 22894, 22894, 22895, 22895, 22896, 22896, 22897, 22897, 22898,
-    22898, 22899, 22899, 22900, 22900, 22901, 22901, 22902, 22902, 22903, 22903,
-    22904, 22904, 22905, 22905, 22906, 22906, 22907, 22907, 22908, 22908, 22909,
-    22909, 22910, 22910, 22911, 22911, 22912, 22912, 22913, 22913, 22914, 22914,
-    22915, 22915, 22916, 22916, 22917, 22917, 22918, 22918, 22919, 22919, 22920,
-    22920, 22921, 22921, 22922, 22922, 22923, 22923, 22924, 22924, 22925, 22925,
-    22925, 22926, 22926, 22927, 22927, 22928, 22928, 22929, 22929, 22930, 22930,
-    22931, 22931, 22932, 22932, 22933, 22933, 22934, 22934, 22935, 22935, 22936,
-    22936, 22937, 22937, 22938, 22938, 22939, 22939, 22940, 22940, 22941, 22941,
-    22942, 22942, 22943, 22943, 22944, 22944, 22945, 22945, 22946, 22946, 22947,
-    22947, 22948, 22948, 22949, 22949, 22950, 22950, 22951, 22951, 22952, 22952,
-    22953, 22953, 22954, 22954, 22955, 22955, 22956, 22956, 22956, 22957, 22957,
-    22958, 22958, 22959, 22959, 22960, 22960, 22961, 22961, 22962, 22962, 22963,
-    22963, 22964, 22964, 22965, 22965, 22966, 22966, 22967, 22967, 22968, 22968,
-    22969, 22969, 22970, 22970, 22971, 22971, 22972, 22972, 22973, 22973, 22974,
-    22974, 22975, 22975, 22976, 22976, 22977, 22977, 22978, 22978, 22979, 22979,
-    22980, 22980, 22980, 22981, 22981, 22982, 22982, 22983, 22983, 22984, 22984,
-    22985, 22985, 22986, 22986, 22987, 22987, 22988, 22988, 22989, 22989, 22990,
-    22990, 22991, 22991, 22992, 22992, 22993, 22993, 22994, 22994, 22995, 22995,
-    22996, 22996, 22997, 22997, 22998, 22998, 22999, 22999, 22999, 23000, 23000,
-    23001, 23001, 23002, 23002, 23003, 23003, 23004, 23004, 23005, 23005, 23006,
-    23006, 23007, 23007, 23008, 23008, 23009, 23009, 23010, 23010, 23011, 23011,
-    23012, 23012, 23013, 23013, 23014, 23014, 23015, 23015, 23016, 23016, 23016,
-    23017, 23017, 23018, 23018, 23019, 23019, 23020, 23020, 23021, 23021, 23022,
-    23022, 23023, 23023, 23024, 23024, 23025, 23025, 23026, 23026, 23027, 23027,
-    23028, 23028, 23029, 23029, 23030, 23030, 23031, 23031, 23031, 23032, 23032,
-    23033, 23033, 23034, 23034, 23035, 23035, 23036, 23036, 23037, 23037, 23038,
-    23038, 23039, 23039, 23040, 23040, 23041, 23041, 23042, 23042, 23043, 23043,
-    23044, 23044, 23045, 23045, 23045, 23046, 23046, 23047, 23047, 23048, 23048,
-    23049, 23049, 23050, 23050, 23051, 23051, 23052, 23052, 23053, 23053, 23054,
-    23054, 23055, 23055, 23056, 23056, 23057, 23057, 23057, 23058, 23058, 23059,
-    23059, 23060, 23060, 23061, 23061, 23062, 23062, 23063, 23063, 23064, 23064,
-    23065, 23065, 23066, 23066, 23067, 23067, 23068, 23068, 23069, 23069, 23069,
-    23070, 23070, 23071, 23071, 23072, 23072, 23073, 23073, 23074, 23074, 23075,
-    23075, 23076, 23076, 23077, 23077, 23078, 23078, 23079, 23079, 23080, 23080,
-    23081, 23081, 23081, 23082, 23082, 23083, 23083, 23084, 23084, 23085, 23085,
-    23086, 23086, 23087, 23087, 23088, 23088, 23089, 23089, 23090, 23090, 23091,
-    23091, 23092, 23092, 23092, 23093, 23093, 23094, 23094, 23095, 23095, 23096,
-    23096, 23097, 23097, 23098, 23098, 23099, 23099, 23100, 23100, 23101, 23101,
-    23102, 23102, 23102, 23103, 23103, 23104, 23104, 23105, 23105, 23106, 23106,
-    23107, 23107, 23108, 23108, 23109, 23109, 23110, 23110, 23111, 23111, 23112,
-    23112, 23112, 23113, 23113, 23114, 23114, 23115, 23115, 23116, 23116, 23117,
-    23117, 23118, 23118, 23119, 23119, 23120, 23120, 23121, 23121, 23121, 23122,
-    23122, 23123, 23123, 23124, 23124, 23125, 23125, 23126, 23126, 23127, 23127,
-    23128, 23128, 23129, 23129, 23130, 23130, 23130, 23131, 23131, 23132, 23132,
-    23133, 23133, 23134, 23134, 23135, 23135, 23136, 23136, 23137, 23137, 23138,
-    23138, 23139, 23139, 23139, 23140, 23140, 23141, 23141, 23142, 23142, 23143,
-    23143, 23144, 23144, 23145, 23145, 23146, 23146, 23147, 23147, 23147, 23148,
-    23148, 23149, 23149, 23150, 23150, 23151, 23151, 23152, 23152, 23153, 23153,
-    23154, 23154, 23155, 23155, 23156, 23156, 23156, 23157, 23157, 23158, 23158,
-    23159, 23159, 23160, 23160, 23161, 23161, 23162, 23162, 23163, 23163, 23164,
-    23164, 23164, 23165, 23165, 23166, 23166, 23167, 23167, 23168, 23168, 23169,
-    23169, 23170, 23170, 23171, 23171, 23172, 23172, 23172, 23173, 23173, 23174,
-    23174, 23175, 23175, 23176, 23176, 23177, 23177, 23178, 23178, 23179, 23179,
-    23179, 23180, 23180, 23181, 23181, 23182, 23182, 23183, 23183, 23184, 23184,
-    23185, 23185, 23186, 23186, 23187, 23187, 23187, 23188, 23188, 23189, 23189,
-    23190, 23190, 23191, 23191, 23192, 23192, 23193, 23193, 23194, 23194, 23194,
-    23195, 23195, 23196, 23196, 23197, 23197, 23198, 23198, 23199, 23199, 23200,
-    23200, 23201, 23201, 23201, 23202, 23202, 23203, 23203, 23204, 23204, 23205,
-    23205, 23206, 23206, 23207, 23207, 23208, 23208, 23208, 23209, 23209, 23210,
-    23210, 23211, 23211, 23212, 23212, 23213, 23213, 23214, 23214, 23215, 23215,
-    23215, 23216, 23216, 23217, 23217, 23218, 23218, 23219, 23219, 23220, 23220,
-    23221, 23221, 23221, 23222, 23222, 23223, 23223, 23224, 23224, 23225, 23225,
-    23226, 23226, 23227, 23227, 23228, 23228, 23228, 23229, 23229, 23230, 23230,
-    23231, 23231, 23232, 23232, 23233, 23233, 23234, 23234, 23234, 23235, 23235,
-    23236, 23236, 23237, 23237, 23238, 23238, 23239, 23239, 23240, 23240, 23240,
-    23241, 23241, 23242, 23242, 23243, 23243, 23244, 23244, 23245, 23245, 23246,
-    23246, 23247, 23247, 23247, 23248, 23248, 23249, 23249, 23250, 23250, 23251,
-    23251, 23252, 23252, 23253, 23253, 23253, 23254, 23254, 23255, 23255, 23256,
-    23256, 23257, 23257, 23258, 23258, 23259, 23259, 23259, 23260, 23260, 23261,
-    23261, 23262, 23262, 23263, 23263, 23264, 23264, 23264, 23265, 23265, 23266,
-    23266, 23267, 23267, 23268, 23268, 23269, 23269, 23270, 23270, 23270, 23271,
-    23271, 23272, 23272, 23273, 23273, 23274, 23274, 23275, 23275, 23276, 23276,
-    23276, 23277, 23277, 23278, 23278, 23279, 23279, 23280, 23280, 23281, 23281,
-    23282, 23282, 23282, 23283, 23283, 23284, 23284, 23285, 23285, 23286, 23286,
-    23287, 23287, 23287, 23288, 23288, 23289, 23289, 23290, 23290, 23291, 23291,
-    23292, 23292, 23293, 23293, 23293, 23294, 23294, 23295, 23295, 23296, 23296,
-    23297, 23297, 23298, 23298, 23298, 23299, 23299, 23300, 23300, 23301, 23301,
-    23302, 23302, 23303, 23303, 23303, 23304, 23304, 23305, 23305, 23306, 23306,
-    23307, 23307, 23308, 23308, 23309, 23309, 23309, 23310, 23310, 23311, 23311,
-    23312, 23312, 23313, 23313, 23314, 23314, 23314, 23315, 23315, 23316, 23316,
-    23317, 23317, 23318, 23318, 23319, 23319, 23319, 23320, 23320, 23321, 23321,
-    23322, 23322, 23323, 23323, 23324, 23324, 23324, 23325, 23325, 23326, 23326,
-    23327, 23327, 23328, 23328, 23329, 23329, 23329, 23330, 23330, 23331, 23331,
-    23332, 23332, 23333, 23333, 23334, 23334, 23334, 23335, 23335, 23336, 23336,
-    23337, 23337, 23338, 23338, 23339, 23339, 23339, 23340, 23340, 23341, 23341,
-    23342, 23342, 23343, 23343, 23344, 23344, 23344, 23345, 23345, 23346, 23346,
-    23347, 23347, 23348, 23348, 23348, 23349, 23349, 23350, 23350, 23351, 23351,
-    23352, 23352, 23353, 23353, 23353, 23354, 23354, 23355, 23355, 23356, 23356,
-    23357, 23357, 23358, 23358, 23358, 23359, 23359, 23360, 23360, 23361, 23361,
-    23362, 23362, 23362, 23363, 23363, 23364, 23364, 23365, 23365, 23366, 23366,
-    23367, 23367, 23367, 23368, 23368, 23369, 23369, 23370, 23370, 23371, 23371,
-    23372, 23372, 23372, 23373, 23373, 23374, 23374, 23375, 23375, 23376, 23376,
-    23376, 23377, 23377, 23378, 23378, 23379, 23379, 23380, 23380, 23381, 23381,
-    23381, 23382, 23382, 23383, 23383, 23384, 23384, 23385, 23385, 23385, 23386,
-    23386, 23387, 23387, 23388, 23388, 23389, 23389, 23389, 23390, 23390, 23391,
-    23391, 23392, 23392, 23393, 23393, 23394, 23394, 23394, 23395, 23395, 23396,
-    23396, 23397, 23397, 23398, 23398, 23398, 23399, 23399, 23400, 23400, 23401,
-    23401, 23402, 23402, 23402, 23403, 23403, 23404, 23404, 23405, 23405, 23406,
-    23406, 23406, 23407, 23407, 23408, 23408, 23409, 23409, 23410, 23410, 23411,
-    23411, 23411, 23412, 23412, 23413, 23413, 23414, 23414, 23415, 23415, 23415,
-    23416, 23416, 23417, 23417, 23418, 23418, 23419, 23419, 23419, 23420, 23420,
-    23421, 23421, 23422, 23422, 23423, 23423, 23423, 23424, 23424, 23425, 23425,
-    23426, 23426, 23427, 23427, 23427, 23428, 23428, 23429, 23429, 23430, 23430,
-    23431, 23431, 23431, 23432, 23432, 23433, 23433, 23434, 23434, 23435, 23435,
-    23435, 23436, 23436, 23437, 23437, 23438, 23438, 23439, 23439, 23439, 23440,
-    23440, 23441, 23441, 23442, 23442, 23443, 23443, 23443, 23444, 23444, 23445,
-    23445, 23446, 23446, 23447, 23447, 23447, 23448, 23448, 23449, 23449, 23450,
-    23450, 23451, 23451, 23451, 23452, 23452, 23453, 23453, 23454, 23454, 23455,
-    23455, 23455, 23456, 23456, 23457, 23457, 23458, 23458, 23459, 23459, 23459,
-    23460, 23460, 23461, 23461, 23462, 23462, 23462, 23463, 23463, 23464, 23464,
-    23465, 23465, 23466, 23466, 23466, 23467, 23467, 23468, 23468, 23469, 23469,
-    23470, 23470, 23470, 23471, 23471, 23472, 23472, 23473, 23473, 23474, 23474,
-    23474, 23475, 23475, 23476, 23476, 23477, 23477, 23477, 23478, 23478, 23479,
-    23479, 23480, 23480, 23481, 23481, 23481, 23482, 23482, 23483, 23483, 23484,
-    23484, 23485, 23485, 23485, 23486, 23486, 23487, 23487, 23488, 23488, 23488,
-    23489, 23489, 23490, 23490, 23491, 23491, 23492, 23492, 23492, 23493, 23493,
-    23494, 23494, 23495, 23495, 23495, 23496, 23496, 23497, 23497, 23498, 23498,
-    23499, 23499, 23499, 23500, 23500, 23501, 23501, 23502, 23502, 23502, 23503,
-    23503, 23504, 23504, 23505, 23505, 23506, 23506, 23506, 23507, 23507, 23508,
-    23508, 23509, 23509, 23509, 23510, 23510, 23511, 23511, 23512, 23512, 23513,
-    23513, 23513, 23514, 23514, 23515, 23515, 23516, 23516, 23516, 23517, 23517,
-    23518, 23518, 23519, 23519, 23520, 23520, 23520, 23521, 23521, 23522, 23522,
-    23523, 23523, 23523, 23524, 23524, 23525, 23525, 23526, 23526, 23527, 23527,
-    23527, 23528, 23528, 23529, 23529, 23530, 23530, 23530, 23531, 23531, 23532,
-    23532, 23533, 23533, 23533, 23534, 23534, 23535, 23535, 23536, 23536, 23537,
-    23537, 23537, 23538, 23538, 23539, 23539, 23540, 23540, 23540, 23541, 23541,
-    23542, 23542, 23543, 23543, 23543, 23544, 23544, 23545, 23545, 23546, 23546,
-    23547, 23547, 23547, 23548, 23548, 23549, 23549, 23550, 23550, 23550, 23551,
-    23551, 23552, 23552, 23553, 23553, 23553, 23554, 23554, 23555, 23555, 23556,
-    23556, 23556, 23557, 23557, 23558, 23558, 23559, 23559, 23560, 23560, 23560,
-    23561, 23561, 23562, 23562, 23563, 23563, 23563, 23564, 23564, 23565, 23565,
-    23566, 23566, 23566, 23567, 23567, 23568, 23568, 23569, 23569, 23569, 23570,
-    23570, 23571, 23571, 23572, 23572, 23572, 23573, 23573, 23574, 23574, 23575,
-    23575, 23575, 23576, 23576, 23577, 23577, 23578, 23578, 23579, 23579, 23579,
-    23580, 23580, 23581, 23581, 23582, 23582, 23582, 23583, 23583, 23584, 23584,
-    23585, 23585, 23585, 23586, 23586, 23587, 23587, 23588, 23588, 23588, 23589,
-    23589, 23590, 23590, 23591, 23591, 23591, 23592, 23592, 23593, 23593, 23594,
-    23594, 23594, 23595, 23595, 23596, 23596, 23597, 23597, 23597, 23598, 23598,
-    23599, 23599, 23600, 23600, 23600, 23601, 23601, 23602, 23602, 23603, 23603,
-    23603, 23604, 23604, 23605, 23605, 23606, 23606, 23606, 23607, 23607, 23608,
-    23608, 23609, 23609, 23609, 23610, 23610, 23611, 23611, 23612, 23612, 23612,
-    23613, 23613, 23614, 23614, 23615, 23615, 23615, 23616, 23616, 23617, 23617,
-    23618, 23618, 23618, 23619, 23619, 23620, 23620, 23621, 23621, 23621, 23622,
-    23622, 23623, 23623, 23624, 23624, 23624, 23625, 23625, 23626, 23626, 23627,
-    23627, 23627, 23628, 23628, 23629, 23629, 23629, 23630, 23630, 23631, 23631,
-    23632, 23632, 23632, 23633, 23633, 23634, 23634, 23635, 23635, 23635, 23636,
-    23636, 23637, 23637, 23638, 23638, 23638, 23639, 23639, 23640, 23640, 23641,
-    23641, 23641, 23642, 23642, 23643, 23643, 23644, 23644, 23644, 23645, 23645,
-    23646, 23646, 23647, 23647, 23647, 23648, 23648, 23649, 23649, 23649, 23650,
-    23650, 23651, 23651, 23652, 23652, 23652, 23653, 23653, 23654, 23654, 23655,
-    23655, 23655, 23656, 23656, 23657, 23657, 23658, 23658, 23658, 23659, 23659,
-    23660, 23660, 23660, 23661, 23661, 23662, 23662, 23663, 23663, 23663, 23664,
-    23664, 23665, 23665, 23666, 23666, 23666, 23667, 23667, 23668, 23668, 23669,
-    23669, 23669, 23670, 23670, 23671, 23671, 23671, 23672, 23672, 23673, 23673,
-    23674, 23674, 23674, 23675, 23675, 23676, 23676, 23677, 23677, 23677, 23678,
-    23678, 23679, 23679, 23679, 23680, 23680, 23681, 23681, 23682, 23682, 23682,
-    23683, 23683, 23684, 23684, 23685, 23685, 23685, 23686, 23686, 23687, 23687,
-    23687, 23688, 23688, 23689, 23689, 23690, 23690, 23690, 23691, 23691, 23692,
-    23692, 23693, 23693, 23693, 23694, 23694, 23695, 23695, 23695, 23696, 23696,
-    23697, 23697, 23698, 23698, 23698, 23699, 23699, 23700, 23700, 23701, 23701,
-    23701, 23702, 23702, 23703, 23703, 23703, 23704, 23704, 23705, 23705, 23706,
-    23706, 23706, 23707, 23707, 23708, 23708, 23708, 23709, 23709, 23710, 23710,
-    23711, 23711, 23711, 23712, 23712, 23713, 23713, 23714, 23714, 23714, 23715,
-    23715, 23716, 23716, 23716, 23717, 23717, 23718, 23718, 23719, 23719, 23719,
-    23720, 23720, 23721, 23721, 23721, 23722, 23722, 23723, 23723, 23724, 23724,
-    23724, 23725, 23725, 23726, 23726, 23726, 23727, 23727, 23728, 23728, 23729,
-    23729, 23729, 23730, 23730, 23731, 23731, 23731, 23732, 23732, 23733, 23733,
-    23734, 23734, 23734, 23735, 23735, 23736, 23736, 23736, 23737, 23737, 23738,
-    23738, 23739, 23739, 23739, 23740, 23740, 23741, 23741, 23741, 23742, 23742,
-    23743, 23743, 23744, 23744, 23744, 23745, 23745, 23746, 23746, 23746, 23747,
-    23747, 23748, 23748, 23749, 23749, 23749, 23750, 23750, 23751, 23751, 23751,
-    23752, 23752, 23753, 23753, 23753, 23754, 23754, 23755, 23755, 23756, 23756,
-    23756, 23757, 23757, 23758, 23758, 23758, 23759, 23759, 23760, 23760, 23761,
-    23761, 23761, 23762, 23762, 23763, 23763, 23763, 23764, 23764, 23765, 23765,
-    23766, 23766, 23766, 23767, 23767, 23768, 23768, 23768, 23769, 23769, 23770,
-    23770, 23770, 23771, 23771, 23772, 23772, 23773, 23773, 23773, 23774, 23774,
-    23775, 23775, 23775, 23776, 23776, 23777, 23777, 23777, 23778, 23778, 23779,
-    23779, 23780, 23780, 23780, 23781, 23781, 23782, 23782, 23782, 23783, 23783,
-    23784, 23784, 23784, 23785, 23785, 23786, 23786, 23787, 23787, 23787, 23788,
-    23788, 23789, 23789, 23789, 23790, 23790, 23791, 23791, 23791, 23792, 23792,
-    23793, 23793, 23794, 23794, 23794, 23795, 23795, 23796, 23796, 23796, 23797,
-    23797, 23798, 23798, 23798, 23799, 23799, 23800, 23800, 23801, 23801, 23801,
-    23802, 23802, 23803, 23803, 23803, 23804, 23804, 23805, 23805, 23805, 23806,
-    23806, 23807, 23807, 23807, 23808, 23808, 23809, 23809, 23810, 23810, 23810,
-    23811, 23811, 23812, 23812, 23812, 23813, 23813, 23814, 23814, 23814, 23815,
-    23815, 23816, 23816, 23817, 23817, 23817, 23818, 23818, 23819, 23819, 23819,
-    23820, 23820, 23821, 23821, 23821, 23822, 23822, 23823, 23823, 23823, 23824,
-    23824, 23825, 23825, 23825, 23826, 23826, 23827, 23827, 23828, 23828, 23828,
-    23829, 23829, 23830, 23830, 23830, 23831, 23831, 23832, 23832, 23832, 23833,
-    23833, 23834, 23834, 23834, 23835, 23835, 23836, 23836, 23836, 23837, 23837,
-    23838, 23838, 23839, 23839, 23839, 23840, 23840, 23841, 23841, 23841, 23842,
-    23842, 23843, 23843, 23843, 23844, 23844, 23845, 23845, 23845, 23846, 23846,
-    23847, 23847, 23847, 23848, 23848, 23849, 23849, 23850, 23850, 23850, 23851,
-    23851, 23852, 23852, 23852, 23853, 23853, 23854, 23854, 23854, 23855, 23855,
-    23856, 23856, 23856, 23857, 23857, 23858, 23858, 23858, 23859, 23859, 23860,
-    23860, 23860, 23861, 23861, 23862, 23862, 23862, 23863, 23863, 23864, 23864,
-    23865, 23865, 23865, 23866, 23866, 23867, 23867, 23867, 23868, 23868, 23869,
-    23869, 23869, 23870, 23870, 23871, 23871, 23871, 23872, 23872, 23873, 23873,
-    23873, 23874, 23874, 23875, 23875, 23875, 23876, 23876, 23877, 23877, 23877,
-    23878, 23878, 23879, 23879, 23879, 23880, 23880, 23881, 23881, 23881, 23882,
-    23882, 23883, 23883, 23883, 23884, 23884, 23885, 23885, 23885, 23886, 23886,
-    23887, 23887, 23888, 23888, 23888, 23889, 23889, 23890, 23890, 23890, 23891,
-    23891, 23892, 23892, 23892, 23893, 23893, 23894, 23894, 23894, 23895, 23895,
-    23896, 23896, 23896, 23897, 23897, 23898, 23898, 23898, 23899, 23899, 23900,
-    23900, 23900, 23901, 23901, 23902, 23902, 23902, 23903, 23903, 23904, 23904,
-    23904, 23905, 23905, 23906, 23906, 23906, 23907, 23907, 23908, 23908, 23908,
-    23909, 23909, 23910, 23910, 23910, 23911, 23911, 23912, 23912, 23912, 23913,
-    23913, 23914, 23914, 23914, 23915, 23915, 23916, 23916, 23916, 23917, 23917,
-    23918, 23918, 23918, 23919, 23919, 23920, 23920, 23920, 23921, 23921, 23922,
-    23922, 23922, 23923, 23923, 23924, 23924, 23924, 23925, 23925, 23926, 23926,
-    23926, 23927, 23927, 23928, 23928, 23928, 23929, 23929, 23930, 23930, 23930,
-    23931, 23931, 23932, 23932, 23932, 23933, 23933, 23934, 23934, 23934, 23935,
-    23935, 23936, 23936, 23936, 23937, 23937, 23938, 23938, 23938, 23939, 23939,
-    23940, 23940, 23940, 23941, 23941, 23942, 23942, 23942, 23943, 23943, 23944,
-    23944, 23944, 23945, 23945, 23945, 23946, 23946, 23947, 23947, 23947, 23948,
-    23948, 23949, 23949, 23949, 23950, 23950, 23951, 23951, 23951, 23952, 23952,
-    23953, 23953, 23953, 23954, 23954, 23955, 23955, 23955, 23956, 23956, 23957,
-    23957, 23957, 23958, 23958, 23959, 23959, 23959, 23960, 23960, 23961, 23961,
-    23961, 23962, 23962, 23963, 23963, 23963, 23964, 23964, 23965, 23965, 23965,
-    23966, 23966, 23967, 23967, 23967, 23968, 23968, 23968, 23969, 23969, 23970,
-    23970, 23970, 23971, 23971, 23972, 23972, 23972, 23973, 23973, 23974, 23974,
-    23974, 23975, 23975, 23976, 23976, 23976, 23977, 23977, 23978, 23978, 23978,
-    23979, 23979, 23980, 23980, 23980, 23981, 23981, 23982, 23982, 23982, 23983,
-    23983, 23983, 23984, 23984, 23985, 23985, 23985, 23986, 23986, 23987, 23987,
-    23987, 23988, 23988, 23989, 23989, 23989, 23990, 23990, 23991, 23991, 23991,
-    23992, 23992, 23993, 23993, 23993, 23994, 23994, 23995, 23995, 23995, 23996,
-    23996, 23996, 23997, 23997, 23998, 23998, 23998, 23999, 23999, 24000, 24000,
-    24000, 24001, 24001, 24002, 24002, 24002, 24003, 24003, 24004, 24004, 24004,
-    24005, 24005, 24005, 24006, 24006, 24007, 24007, 24007, 24008, 24008, 24009,
-    24009, 24009, 24010, 24010, 24011, 24011, 24011, 24012, 24012, 24013, 24013,
-    24013, 24014, 24014, 24014, 24015, 24015, 24016, 24016, 24016, 24017, 24017,
-    24018, 24018, 24018, 24019, 24019, 24020, 24020, 24020, 24021, 24021, 24022,
-    24022, 24022, 24023, 24023, 24023, 24024, 24024, 24025, 24025, 24025, 24026,
-    24026, 24027, 24027, 24027, 24028, 24028, 24029, 24029, 24029, 24030, 24030,
-    24031, 24031, 24031, 24032, 24032, 24032, 24033, 24033, 24034, 24034, 24034,
-    24035, 24035, 24036, 24036, 24036, 24037, 24037, 24038, 24038, 24038, 24039,
-    24039, 24039, 24040, 24040, 24041, 24041, 24041, 24042, 24042, 24043, 24043,
-    24043, 24044, 24044, 24045, 24045, 24045, 24046, 24046, 24046, 24047, 24047,
-    24048, 24048, 24048, 24049, 24049, 24050, 24050, 24050, 24051, 24051, 24052,
-    24052, 24052, 24053, 24053, 24053, 24054, 24054, 24055, 24055, 24055, 24056,
-    24056, 24057, 24057, 24057, 24058, 24058, 24058, 24059, 24059, 24060, 24060,
-    24060, 24061, 24061, 24062, 24062, 24062, 24063, 24063, 24064, 24064, 24064,
-    24065, 24065, 24065, 24066, 24066, 24067, 24067, 24067, 24068, 24068, 24069,
-    24069, 24069, 24070, 24070, 24070, 24071, 24071, 24072, 24072, 24072, 24073,
-    24073, 24074, 24074, 24074, 24075, 24075, 24075, 24076, 24076, 24077, 24077,
-    24077, 24078, 24078, 24079, 24079, 24079, 24080, 24080, 24081, 24081, 24081,
-    24082, 24082, 24082, 24083, 24083, 24084, 24084, 24084, 24085, 24085, 24086,
-    24086, 24086, 24087, 24087, 24087, 24088, 24088, 24089, 24089, 24089, 24090,
-    24090, 24091, 24091, 24091, 24092, 24092, 24092, 24093, 24093, 24094, 24094,
-    24094, 24095, 24095, 24096, 24096, 24096, 24097, 24097, 24097, 24098, 24098,
-    24099, 24099, 24099, 24100, 24100, 24101, 24101, 24101, 24102, 24102, 24102,
-    24103, 24103, 24104, 24104, 24104, 24105, 24105, 24105, 24106, 24106, 24107,
-    24107, 24107, 24108, 24108, 24109, 24109, 24109, 24110, 24110, 24110, 24111,
-    24111, 24112, 24112, 24112, 24113, 24113, 24114, 24114, 24114, 24115, 24115,
-    24115, 24116, 24116, 24117, 24117, 24117, 24118, 24118, 24118, 24119, 24119,
-    24120, 24120, 24120, 24121, 24121, 24122, 24122, 24122, 24123, 24123, 24123,
-    24124, 24124, 24125, 24125, 24125, 24126, 24126, 24127, 24127, 24127, 24128,
-    24128, 24128, 24129, 24129, 24130, 24130, 24130, 24131, 24131, 24131, 24132,
-    24132, 24133, 24133, 24133, 24134, 24134, 24135, 24135, 24135, 24136, 24136,
-    24136, 24137, 24137, 24138, 24138, 24138, 24139, 24139, 24139, 24140, 24140,
-    24141, 24141, 24141, 24142, 24142, 24143, 24143, 24143, 24144, 24144, 24144,
-    24145, 24145, 24146, 24146, 24146, 24147, 24147, 24147, 24148, 24148, 24149,
-    24149, 24149, 24150, 24150, 24150, 24151, 24151, 24152, 24152, 24152, 24153,
-    24153, 24154, 24154, 24154, 24155, 24155, 24155, 24156, 24156, 24157, 24157,
-    24157, 24158, 24158, 24158, 24159, 24159, 24160, 24160, 24160, 24161, 24161,
-    24161, 24162, 24162, 24163, 24163, 24163, 24164, 24164, 24164, 24165, 24165,
-    24166, 24166, 24166, 24167, 24167, 24168, 24168, 24168, 24169, 24169, 24169,
-    24170, 24170, 24171, 24171, 24171, 24172, 24172, 24172, 24173, 24173, 24174,
-    24174, 24174, 24175, 24175, 24175, 24176, 24176, 24177, 24177, 24177, 24178,
-    24178, 24178, 24179, 24179, 24180, 24180, 24180, 24181, 24181, 24181, 24182,
-    24182, 24183, 24183, 24183, 24184, 24184, 24184, 24185, 24185, 24186, 24186,
-    24186, 24187, 24187, 24187, 24188, 24188, 24189, 24189, 24189, 24190, 24190,
-    24190, 24191, 24191, 24192, 24192, 24192, 24193, 24193, 24193, 24194, 24194,
-    24195, 24195, 24195, 24196, 24196, 24196, 24197, 24197, 24198, 24198, 24198,
-    24199, 24199, 24199, 24200, 24200, 24201, 24201, 24201, 24202, 24202, 24202,
-    24203, 24203, 24204, 24204, 24204, 24205, 24205, 24205, 24206, 24206, 24207,
-    24207, 24207, 24208, 24208, 24208, 24209, 24209, 24210, 24210, 24210, 24211,
-    24211, 24211, 24212, 24212, 24213, 24213, 24213, 24214, 24214, 24214, 24215,
-    24215, 24216, 24216, 24216, 24217, 24217, 24217, 24218, 24218, 24219, 24219,
-    24219, 24220, 24220, 24220, 24221, 24221, 24222, 24222, 24222, 24223, 24223,
-    24223, 24224, 24224, 24225, 24225, 24225, 24226, 24226, 24226, 24227, 24227,
-    24228, 24228, 24228, 24229, 24229, 24229, 24230, 24230, 24231, 24231, 24231,
-    24232, 24232, 24232, 24233, 24233, 24233, 24234, 24234, 24235, 24235, 24235,
-    24236, 24236, 24236, 24237, 24237, 24238, 24238, 24238, 24239, 24239, 24239,
-    24240, 24240, 24241, 24241, 24241, 24242, 24242, 24242, 24243, 24243, 24244,
-    24244, 24244, 24245, 24245, 24245, 24246, 24246, 24246, 24247, 24247, 24248,
-    24248, 24248, 24249, 24249, 24249, 24250, 24250, 24251, 24251, 24251, 24252,
-    24252, 24252, 24253, 24253, 24254, 24254, 24254, 24255, 24255, 24255, 24256,
-    24256, 24256, 24257, 24257, 24258, 24258, 24258, 24259, 24259, 24259, 24260,
-    24260, 24261, 24261, 24261, 24262, 24262, 24262, 24263, 24263, 24264, 24264,
-    24264, 24265, 24265, 24265, 24266, 24266, 24266, 24267, 24267, 24268, 24268,
-    24268, 24269, 24269, 24269, 24270, 24270, 24271, 24271, 24271, 24272, 24272,
-    24272, 24273, 24273, 24273, 24274, 24274, 24275, 24275, 24275, 24276, 24276,
-    24276, 24277, 24277, 24278, 24278, 24278, 24279, 24279, 24279, 24280, 24280,
-    24280, 24281, 24281, 24282, 24282, 24282, 24283, 24283, 24283, 24284, 24284,
-    24285, 24285, 24285, 24286, 24286, 24286, 24287, 24287, 24287, 24288, 24288,
-    24289, 24289, 24289, 24290, 24290, 24290, 24291, 24291, 24292, 24292, 24292,
-    24293, 24293, 24293, 24294, 24294, 24294, 24295, 24295, 24296, 24296, 24296,
-    24297, 24297, 24297, 24298, 24298, 24298, 24299, 24299, 24300, 24300, 24300,
-    24301, 24301, 24301, 24302, 24302, 24303, 24303, 24303, 24304, 24304, 24304,
-    24305, 24305, 24305, 24306, 24306, 24307, 24307, 24307, 24308, 24308, 24308,
-    24309, 24309, 24309, 24310, 24310, 24311, 24311, 24311, 24312, 24312, 24312,
-    24313, 24313, 24313, 24314, 24314, 24315, 24315, 24315, 24316, 24316, 24316,
-    24317, 24317, 24317, 24318, 24318, 24319, 24319, 24319, 24320, 24320, 24320,
-    24321, 24321, 24322, 24322, 24322, 24323, 24323, 24323, 24324, 24324, 24324,
-    24325, 24325, 24326, 24326, 24326, 24327, 24327, 24327, 24328, 24328, 24328,
-    24329, 24329, 24330, 24330, 24330, 24331, 24331, 24331, 24332, 24332, 24332,
-    24333, 24333, 24334, 24334, 24334, 24335, 24335, 24335, 24336, 24336, 24336,
-    24337, 24337, 24338, 24338, 24338, 24339, 24339, 24339, 24340, 24340, 24340,
-    24341, 24341, 24342, 24342, 24342, 24343, 24343, 24343, 24344, 24344, 24344,
-    24345, 24345, 24345, 24346, 24346, 24347, 24347, 24347, 24348, 24348, 24348,
-    24349, 24349, 24349, 24350, 24350, 24351, 24351, 24351, 24352, 24352, 24352,
-    24353, 24353, 24353, 24354, 24354, 24355, 24355, 24355, 24356, 24356, 24356,
-    24357, 24357, 24357, 24358, 24358, 24359, 24359, 24359, 24360, 24360, 24360,
-    24361, 24361, 24361, 24362, 24362, 24362, 24363, 24363, 24364, 24364, 24364,
-    24365, 24365, 24365, 24366, 24366, 24366, 24367, 24367, 24368, 24368, 24368,
-    24369, 24369, 24369, 24370, 24370, 24370, 24371, 24371, 24372, 24372, 24372,
-    24373, 24373, 24373, 24374, 24374, 24374, 24375, 24375, 24375, 24376, 24376,
-    24377, 24377, 24377, 24378, 24378, 24378, 24379, 24379, 24379, 24380, 24380,
-    24381, 24381, 24381, 24382, 24382, 24382, 24383, 24383, 24383, 24384, 24384,
-    24384, 24385, 24385, 24386, 24386, 24386, 24387, 24387, 24387, 24388, 24388,
-    24388, 24389, 24389, 24389, 24390, 24390, 24391, 24391, 24391, 24392, 24392,
-    24392, 24393, 24393, 24393, 24394, 24394, 24394, 24395, 24395, 24396, 24396,
-    24396, 24397, 24397, 24397, 24398, 24398, 24398, 24399, 24399, 24400, 24400,
-    24400, 24401, 24401, 24401, 24402, 24402, 24402, 24403, 24403, 24403, 24404,
-    24404, 24405, 24405, 24405, 24406, 24406, 24406, 24407, 24407, 24407, 24408,
-    24408, 24408, 24409, 24409, 24410, 24410, 24410, 24411, 24411, 24411, 24412,
-    24412, 24412, 24413, 24413, 24413, 24414, 24414, 24415, 24415, 24415, 24416,
-    24416, 24416, 24417, 24417, 24417, 24418, 24418, 24418, 24419, 24419, 24420,
-    24420, 24420, 24421, 24421, 24421, 24422, 24422, 24422, 24423, 24423, 24423,
-    24424, 24424, 24424, 24425, 24425, 24426, 24426, 24426, 24427, 24427, 24427,
-    24428, 24428, 24428, 24429, 24429, 24429, 24430, 24430, 24431, 24431, 24431,
-    24432, 24432, 24432, 24433, 24433, 24433, 24434, 24434, 24434, 24435, 24435,
-    24436, 24436, 24436, 24437, 24437, 24437, 24438, 24438, 24438, 24439, 24439,
-    24439, 24440, 24440, 24440, 24441, 24441, 24442, 24442, 24442, 24443, 24443,
-    24443, 24444, 24444, 24444, 24445, 24445, 24445, 24446, 24446, 24446, 24447,
-    24447, 24448, 24448, 24448, 24449, 24449, 24449, 24450, 24450, 24450, 24451,
-    24451, 24451, 24452, 24452, 24452, 24453, 24453, 24454, 24454, 24454, 24455,
-    24455, 24455, 24456, 24456, 24456, 24457, 24457, 24457, 24458, 24458, 24458,
-    24459, 24459, 24460, 24460, 24460, 24461, 24461, 24461, 24462, 24462, 24462,
-    24463, 24463, 24463, 24464, 24464, 24464, 24465, 24465, 24466, 24466, 24466,
-    24467, 24467, 24467, 24468, 24468, 24468, 24469, 24469, 24469, 24470, 24470,
-    24470, 24471, 24471, 24472, 24472, 24472, 24473, 24473, 24473, 24474, 24474,
-    24474, 24475, 24475, 24475, 24476, 24476, 24476, 24477, 24477, 24478, 24478,
-    24478, 24479, 24479, 24479, 24480, 24480, 24480, 24481, 24481, 24481, 24482,
-    24482, 24482, 24483, 24483, 24483, 24484, 24484, 24485, 24485, 24485, 24486,
-    24486, 24486, 24487, 24487, 24487, 24488, 24488, 24488, 24489, 24489, 24489,
-    24490, 24490, 24490, 24491, 24491, 24492, 24492, 24492, 24493, 24493, 24493,
-    24494, 24494, 24494, 24495, 24495, 24495, 24496, 24496, 24496, 24497, 24497,
-    24497, 24498, 24498, 24499, 24499, 24499, 24500, 24500, 24500, 24501, 24501,
-    24501, 24502, 24502, 24502, 24503, 24503, 24503, 24504, 24504, 24504, 24505,
-    24505, 24506, 24506, 24506, 24507, 24507, 24507, 24508, 24508, 24508, 24509,
-    24509, 24509, 24510, 24510, 24510, 24511, 24511, 24511, 24512, 24512, 24512,
-    24513, 24513, 24514, 24514, 24514, 24515, 24515, 24515, 24516, 24516, 24516,
-    24517, 24517, 24517, 24518, 24518, 24518, 24519, 24519, 24519, 24520, 24520,
-    24520, 24521, 24521, 24522, 24522, 24522, 24523, 24523, 24523, 24524, 24524,
-    24524, 24525, 24525, 24525, 24526, 24526, 24526, 24527, 24527, 24527, 24528,
-    24528, 24528, 24529, 24529, 24530, 24530, 24530, 24531, 24531, 24531, 24532,
-    24532, 24532, 24533, 24533, 24533, 24534, 24534, 24534, 24535, 24535, 24535,
-    24536, 24536, 24536, 24537, 24537, 24537, 24538, 24538, 24539, 24539, 24539,
-    24540, 24540, 24540, 24541, 24541, 24541, 24542, 24542, 24542, 24543, 24543,
-    24543, 24544, 24544, 24544, 24545, 24545, 24545, 24546, 24546, 24546, 24547,
-    24547, 24548, 24548, 24548, 24549, 24549, 24549, 24550, 24550, 24550, 24551,
-    24551, 24551, 24552, 24552, 24552, 24553, 24553, 24553, 24554, 24554, 24554,
-    24555, 24555, 24555, 24556, 24556, 24556, 24557, 24557, 24558, 24558, 24558,
-    24559, 24559, 24559, 24560, 24560, 24560, 24561, 24561, 24561, 24562, 24562,
-    24562, 24563, 24563, 24563, 24564, 24564, 24564, 24565, 24565, 24565, 24566,
-    24566, 24566, 24567, 24567, 24568, 24568, 24568, 24569, 24569, 24569, 24570,
-    24570, 24570, 24571, 24571, 24571, 24572, 24572, 24572, 24573, 24573, 24573,
-    24574, 24574, 24574, 24575, 24575, 24575, 24576, 24576, 24576, 24577, 24577,
-    24577, 24578, 24578, 24578, 24579, 24579, 24580, 24580, 24580, 24581, 24581,
-    24581, 24582, 24582, 24582, 24583, 24583, 24583, 24584, 24584, 24584, 24585,
-    24585, 24585, 24586, 24586, 24586, 24587, 24587, 24587, 24588, 24588, 24588,
-    24589, 24589, 24589, 24590, 24590, 24590, 24591, 24591, 24592, 24592, 24592,
-    24593, 24593, 24593, 24594, 24594, 24594, 24595, 24595, 24595, 24596, 24596,
-    24596, 24597, 24597, 24597, 24598, 24598, 24598, 24599, 24599, 24599, 24600,
-    24600, 24600, 24601, 24601, 24601, 24602, 24602, 24602, 24603, 24603, 24603,
-    24604, 24604, 24604, 24605, 24605, 24605, 24606, 24606, 24607, 24607, 24607,
-    24608, 24608, 24608, 24609, 24609, 24609, 24610, 24610, 24610, 24611, 24611,
-    24611, 24612, 24612, 24612, 24613, 24613, 24613, 24614, 24614, 24614, 24615,
-    24615, 24615, 24616, 24616, 24616, 24617, 24617, 24617, 24618, 24618, 24618,
-    24619, 24619, 24619, 24620, 24620, 24620, 24621, 24621, 24621, 24622, 24622,
-    24622, 24623, 24623, 24624, 24624, 24624, 24625, 24625, 24625, 24626, 24626,
-    24626, 24627, 24627, 24627, 24628, 24628, 24628, 24629, 24629, 24629, 24630,
-    24630, 24630, 24631, 24631, 24631, 24632, 24632, 24632, 24633, 24633, 24633,
-    24634, 24634, 24634, 24635, 24635, 24635, 24636, 24636, 24636, 24637, 24637,
-    24637, 24638, 24638, 24638, 24639, 24639, 24639, 24640, 24640, 24640, 24641,
-    24641, 24641, 24642, 24642, 24642, 24643, 24643, 24643, 24644, 24644, 24644,
-    24645, 24645, 24645, 24646, 24646, 24647, 24647, 24647, 24648, 24648, 24648,
-    24649, 24649, 24649, 24650, 24650, 24650, 24651, 24651, 24651, 24652, 24652,
-    24652, 24653, 24653, 24653, 24654, 24654, 24654, 24655, 24655, 24655, 24656,
-    24656, 24656, 24657, 24657, 24657, 24658, 24658, 24658, 24659, 24659, 24659,
-    24660, 24660, 24660, 24661, 24661, 24661, 24662, 24662, 24662, 24663, 24663,
-    24663, 24664, 24664, 24664, 24665, 24665, 24665, 24666, 24666, 24666, 24667,
-    24667, 24667, 24668, 24668, 24668, 24669, 24669, 24669, 24670, 24670, 24670,
-    24671, 24671, 24671, 24672, 24672, 24672, 24673, 24673, 24673, 24674, 24674,
-    24674, 24675, 24675, 24675, 24676, 24676, 24676, 24677, 24677, 24677, 24678,
-    24678, 24678, 24679, 24679, 24679, 24680, 24680, 24680, 24681, 24681, 24681,
-    24682, 24682, 24682, 24683, 24683, 24683, 24684, 24684, 24684, 24685, 24685,
-    24685, 24686, 24686, 24686, 24687, 24687, 24687, 24688, 24688, 24688, 24689,
-    24689, 24689, 24690, 24690, 24690, 24691, 24691, 24691, 24692, 24692, 24692,
-    24693, 24693, 24693, 24694, 24694, 24694, 24695, 24695, 24695, 24696, 24696,
-    24696, 24697, 24697, 24697, 24698, 24698, 24698, 24699, 24699, 24699, 24700,
-    24700, 24700, 24701, 24701, 24701, 24702, 24702, 24702, 24703, 24703, 24703,
-    24704, 24704, 24704, 24705, 24705, 24705, 24706, 24706, 24706, 24707, 24707,
-    24707, 24708, 24708, 24708, 24709, 24709, 24709, 24710, 24710, 24710, 24711,
-    24711, 24711, 24712, 24712, 24712, 24713, 24713, 24713, 24714, 24714, 24714,
-    24715, 24715, 24715, 24716, 24716, 24716, 24717, 24717, 24717, 24718, 24718,
-    24718, 24719, 24719, 24719, 24720, 24720, 24720, 24721, 24721, 24721, 24722,
-    24722, 24722, 24723, 24723, 24723, 24724, 24724, 24724, 24725, 24725, 24725,
-    24726, 24726, 24726, 24727, 24727, 24727, 24728, 24728, 24728, 24729, 24729,
-    24729, 24730, 24730, 24730, 24731, 24731, 24731, 24732, 24732, 24732, 24733,
-    24733, 24733, 24734, 24734, 24734, 24735, 24735, 24735, 24736, 24736, 24736,
-    24737, 24737, 24737, 24738, 24738, 24738, 24739, 24739, 24739, 24740, 24740,
-    24740, 24741, 24741, 24741, 24741, 24742, 24742, 24742, 24743, 24743, 24743,
-    24744, 24744, 24744, 24745, 24745, 24745, 24746, 24746, 24746, 24747, 24747,
-    24747, 24748, 24748, 24748, 24749, 24749, 24749, 24750, 24750, 24750, 24751,
-    24751, 24751, 24752, 24752, 24752, 24753, 24753, 24753, 24754, 24754, 24754,
-    24755, 24755, 24755, 24756, 24756, 24756, 24757, 24757, 24757, 24758, 24758,
-    24758, 24759, 24759, 24759, 24760, 24760, 24760, 24761, 24761, 24761, 24762,
-    24762, 24762, 24763, 24763, 24763, 24764, 24764, 24764, 24764, 24765, 24765,
-    24765, 24766, 24766, 24766, 24767, 24767, 24767, 24768, 24768, 24768, 24769,
-    24769, 24769, 24770, 24770, 24770, 24771, 24771, 24771, 24772, 24772, 24772,
-    24773, 24773, 24773, 24774, 24774, 24774, 24775, 24775, 24775, 24776, 24776,
-    24776, 24777, 24777, 24777, 24778, 24778, 24778, 24779, 24779, 24779, 24780,
-    24780, 24780, 24781, 24781, 24781, 24781, 24782, 24782, 24782, 24783, 24783,
-    24783, 24784, 24784, 24784, 24785, 24785, 24785, 24786, 24786, 24786, 24787,
-    24787, 24787, 24788, 24788, 24788, 24789, 24789, 24789, 24790, 24790, 24790,
-    24791, 24791, 24791, 24792, 24792, 24792, 24793, 24793, 24793, 24794, 24794,
-    24794, 24795, 24795, 24795, 24795, 24796, 24796, 24796, 24797, 24797, 24797,
-    24798, 24798, 24798, 24799, 24799, 24799, 24800, 24800, 24800, 24801, 24801,
-    24801, 24802, 24802, 24802, 24803, 24803, 24803, 24804, 24804, 24804, 24805,
-    24805, 24805, 24806, 24806, 24806, 24807, 24807, 24807, 24808, 24808, 24808,
-    24808, 24809, 24809, 24809, 24810, 24810, 24810, 24811, 24811, 24811, 24812,
-    24812, 24812, 24813, 24813, 24813, 24814, 24814, 24814, 24815, 24815, 24815,
-    24816, 24816, 24816, 24817, 24817, 24817, 24818, 24818, 24818, 24819, 24819,
-    24819, 24819, 24820, 24820, 24820, 24821, 24821, 24821, 24822, 24822, 24822,
-    24823, 24823, 24823, 24824, 24824, 24824, 24825, 24825, 24825, 24826, 24826,
-    24826, 24827, 24827, 24827, 24828, 24828, 24828, 24829, 24829, 24829, 24829,
-    24830, 24830, 24830, 24831, 24831, 24831, 24832, 24832, 24832, 24833, 24833,
-    24833, 24834, 24834, 24834, 24835, 24835, 24835, 24836, 24836, 24836, 24837,
-    24837, 24837, 24838, 24838, 24838, 24838, 24839, 24839, 24839, 24840, 24840,
-    24840, 24841, 24841, 24841, 24842, 24842, 24842, 24843, 24843, 24843, 24844,
-    24844, 24844, 24845, 24845, 24845, 24846, 24846, 24846, 24847, 24847, 24847,
-    24847, 24848, 24848, 24848, 24849, 24849, 24849, 24850, 24850, 24850, 24851,
-    24851, 24851, 24852, 24852, 24852, 24853, 24853, 24853, 24854, 24854, 24854,
-    24855, 24855, 24855, 24856, 24856, 24856, 24856, 24857, 24857, 24857, 24858,
-    24858, 24858, 24859, 24859, 24859, 24860, 24860, 24860, 24861, 24861, 24861,
-    24862, 24862, 24862, 24863, 24863, 24863, 24864, 24864, 24864, 24864, 24865,
-    24865, 24865, 24866, 24866, 24866, 24867, 24867, 24867, 24868, 24868, 24868,
-    24869, 24869, 24869, 24870, 24870, 24870, 24871, 24871, 24871, 24871, 24872,
-    24872, 24872, 24873, 24873, 24873, 24874, 24874, 24874, 24875, 24875, 24875,
-    24876, 24876, 24876, 24877, 24877, 24877, 24878, 24878, 24878, 24878, 24879,
-    24879, 24879, 24880, 24880, 24880, 24881, 24881, 24881, 24882, 24882, 24882,
-    24883, 24883, 24883, 24884, 24884, 24884, 24885, 24885, 24885, 24885, 24886,
-    24886, 24886, 24887, 24887, 24887, 24888, 24888, 24888, 24889, 24889, 24889,
-    24890, 24890, 24890, 24891, 24891, 24891, 24892, 24892, 24892, 24892, 24893,
-    24893, 24893, 24894, 24894, 24894, 24895, 24895, 24895, 24896, 24896, 24896,
-    24897, 24897, 24897, 24898, 24898, 24898, 24899, 24899, 24899, 24899, 24900,
-    24900, 24900, 24901, 24901, 24901, 24902, 24902, 24902, 24903, 24903, 24903,
-    24904, 24904, 24904, 24905, 24905, 24905, 24905, 24906, 24906, 24906, 24907,
-    24907, 24907, 24908, 24908, 24908, 24909, 24909, 24909, 24910, 24910, 24910,
-    24911, 24911, 24911, 24911, 24912, 24912, 24912, 24913, 24913, 24913, 24914,
-    24914, 24914, 24915, 24915, 24915, 24916, 24916, 24916, 24917, 24917, 24917,
-    24917, 24918, 24918, 24918, 24919, 24919, 24919, 24920, 24920, 24920, 24921,
-    24921, 24921, 24922, 24922, 24922, 24923, 24923, 24923, 24923, 24924, 24924,
-    24924, 24925, 24925, 24925, 24926, 24926, 24926, 24927, 24927, 24927, 24928,
-    24928, 24928, 24928, 24929, 24929, 24929, 24930, 24930, 24930, 24931, 24931,
-    24931, 24932, 24932, 24932, 24933, 24933, 24933, 24934, 24934, 24934, 24934,
-    24935, 24935, 24935, 24936, 24936, 24936, 24937, 24937, 24937, 24938, 24938,
-    24938, 24939, 24939, 24939, 24939, 24940, 24940, 24940, 24941, 24941, 24941,
-    24942, 24942, 24942, 24943, 24943, 24943, 24944, 24944, 24944, 24944, 24945,
-    24945, 24945, 24946, 24946, 24946, 24947, 24947, 24947, 24948, 24948, 24948,
-    24949, 24949, 24949, 24950, 24950, 24950, 24950, 24951, 24951, 24951, 24952,
-    24952, 24952, 24953, 24953, 24953, 24954, 24954, 24954, 24955, 24955, 24955,
-    24955, 24956, 24956, 24956, 24957, 24957, 24957, 24958, 24958, 24958, 24959,
-    24959, 24959, 24959, 24960, 24960, 24960, 24961, 24961, 24961, 24962, 24962,
-    24962, 24963, 24963, 24963, 24964, 24964, 24964, 24964, 24965, 24965, 24965,
-    24966, 24966, 24966, 24967, 24967, 24967, 24968, 24968, 24968, 24969, 24969,
-    24969, 24969, 24970, 24970, 24970, 24971, 24971, 24971, 24972, 24972, 24972,
-    24973, 24973, 24973, 24974, 24974, 24974, 24974, 24975, 24975, 24975, 24976,
-    24976, 24976, 24977, 24977, 24977, 24978, 24978, 24978, 24978, 24979, 24979,
-    24979, 24980, 24980, 24980, 24981, 24981, 24981, 24982, 24982, 24982, 24983,
-    24983, 24983, 24983, 24984, 24984, 24984, 24985, 24985, 24985, 24986, 24986,
-    24986, 24987, 24987, 24987, 24987, 24988, 24988, 24988, 24989, 24989, 24989,
-    24990, 24990, 24990, 24991, 24991, 24991, 24992, 24992, 24992, 24992, 24993,
-    24993, 24993, 24994, 24994, 24994, 24995, 24995, 24995, 24996, 24996, 24996,
-    24996, 24997, 24997, 24997, 24998, 24998, 24998, 24999, 24999, 24999, 25000,
-    25000, 25000, 25000, 25001, 25001, 25001, 25002, 25002, 25002, 25003, 25003,
-    25003, 25004, 25004, 25004, 25004, 25005, 25005, 25005, 25006, 25006, 25006,
-    25007, 25007, 25007, 25008, 25008, 25008, 25008, 25009, 25009, 25009, 25010,
-    25010, 25010, 25011, 25011, 25011, 25012, 25012, 25012, 25012, 25013, 25013,
-    25013, 25014, 25014, 25014, 25015, 25015, 25015, 25016, 25016, 25016, 25016,
-    25017, 25017, 25017, 25018, 25018, 25018, 25019, 25019, 25019, 25020, 25020,
-    25020, 25020, 25021, 25021, 25021, 25022, 25022, 25022, 25023, 25023, 25023,
-    25024, 25024, 25024, 25024, 25025, 25025, 25025, 25026, 25026, 25026, 25027,
-    25027, 25027, 25028, 25028, 25028, 25028, 25029, 25029, 25029, 25030, 25030,
-    25030, 25031, 25031, 25031, 25032, 25032, 25032, 25032, 25033, 25033, 25033,
-    25034, 25034, 25034, 25035, 25035, 25035, 25036, 25036, 25036, 25036, 25037,
-    25037, 25037, 25038, 25038, 25038, 25039, 25039, 25039, 25039, 25040, 25040,
-    25040, 25041, 25041, 25041, 25042, 25042, 25042, 25043, 25043, 25043, 25043,
-    25044, 25044, 25044, 25045, 25045, 25045, 25046, 25046, 25046, 25047, 25047,
-    25047, 25047, 25048, 25048, 25048, 25049, 25049, 25049, 25050, 25050, 25050,
-    25050, 25051, 25051, 25051, 25052, 25052, 25052, 25053, 25053, 25053, 25054,
-    25054, 25054, 25054, 25055, 25055, 25055, 25056, 25056, 25056, 25057, 25057,
-    25057, 25057, 25058, 25058, 25058, 25059, 25059, 25059, 25060, 25060, 25060,
-    25061, 25061, 25061, 25061, 25062, 25062, 25062, 25063, 25063, 25063, 25064,
-    25064, 25064, 25064, 25065, 25065, 25065, 25066, 25066, 25066, 25067, 25067,
-    25067, 25067, 25068, 25068, 25068, 25069, 25069, 25069, 25070, 25070, 25070,
-    25071, 25071, 25071, 25071, 25072, 25072, 25072, 25073, 25073, 25073, 25074,
-    25074, 25074, 25074, 25075, 25075, 25075, 25076, 25076, 25076, 25077, 25077,
-    25077, 25078, 25078, 25078, 25078, 25079, 25079, 25079, 25080, 25080, 25080,
-    25081, 25081, 25081, 25081, 25082, 25082, 25082, 25083, 25083, 25083, 25084,
-    25084, 25084, 25084, 25085, 25085, 25085, 25086, 25086, 25086, 25087, 25087,
-    25087, 25087, 25088, 25088, 25088, 25089, 25089, 25089, 25090, 25090, 25090,
-    25090, 25091, 25091, 25091, 25092, 25092, 25092, 25093, 25093, 25093, 25094,
-    25094, 25094, 25094, 25095, 25095, 25095, 25096, 25096, 25096, 25097, 25097,
-    25097, 25097, 25098, 25098, 25098, 25099, 25099, 25099, 25100, 25100, 25100,
-    25100, 25101, 25101, 25101, 25102, 25102, 25102, 25103, 25103, 25103, 25103,
-    25104, 25104, 25104, 25105, 25105, 25105, 25106, 25106, 25106, 25106, 25107,
-    25107, 25107, 25108, 25108, 25108, 25109, 25109, 25109, 25109, 25110, 25110,
-    25110, 25111, 25111, 25111, 25112, 25112, 25112, 25112, 25113, 25113, 25113,
-    25114, 25114, 25114, 25115, 25115, 25115, 25115, 25116, 25116, 25116, 25117,
-    25117, 25117, 25118, 25118, 25118, 25118, 25119, 25119, 25119, 25120, 25120,
-    25120, 25121, 25121, 25121, 25121, 25122, 25122, 25122, 25123, 25123, 25123,
-    25124, 25124, 25124, 25124, 25125, 25125, 25125, 25126, 25126, 25126, 25127,
-    25127, 25127, 25127, 25128, 25128, 25128, 25129, 25129, 25129, 25130, 25130,
-    25130, 25130, 25131, 25131, 25131, 25132, 25132, 25132, 25133, 25133, 25133,
-    25133, 25134, 25134, 25134, 25135, 25135, 25135, 25135, 25136, 25136, 25136,
-    25137, 25137, 25137, 25138, 25138, 25138, 25138, 25139, 25139, 25139, 25140,
-    25140, 25140, 25141, 25141, 25141, 25141, 25142, 25142, 25142, 25143, 25143,
-    25143, 25144, 25144, 25144, 25144, 25145, 25145, 25145, 25146, 25146, 25146,
-    25147, 25147, 25147, 25147, 25148, 25148, 25148, 25149, 25149, 25149, 25149,
-    25150, 25150, 25150, 25151, 25151, 25151, 25152, 25152, 25152, 25152, 25153,
-    25153, 25153, 25154, 25154, 25154, 25155, 25155, 25155, 25155, 25156, 25156,
-    25156, 25157, 25157, 25157, 25157, 25158, 25158, 25158, 25159, 25159, 25159,
-    25160, 25160, 25160, 25160, 25161, 25161, 25161, 25162, 25162, 25162, 25163,
-    25163, 25163, 25163, 25164, 25164, 25164, 25165, 25165, 25165, 25165, 25166,
-    25166, 25166, 25167, 25167, 25167, 25168, 25168, 25168, 25168, 25169, 25169,
-    25169, 25170, 25170, 25170, 25171, 25171, 25171, 25171, 25172, 25172, 25172,
-    25173, 25173, 25173, 25173, 25174, 25174, 25174, 25175, 25175, 25175, 25176,
-    25176, 25176, 25176, 25177, 25177, 25177, 25178, 25178, 25178, 25178, 25179,
-    25179, 25179, 25180, 25180, 25180, 25181, 25181, 25181, 25181, 25182, 25182,
-    25182, 25183, 25183, 25183, 25183, 25184, 25184, 25184, 25185, 25185, 25185,
-    25186, 25186, 25186, 25186, 25187, 25187, 25187, 25188, 25188, 25188, 25188,
-    25189, 25189, 25189, 25190, 25190, 25190, 25191, 25191, 25191, 25191, 25192,
-    25192, 25192, 25193, 25193, 25193, 25193, 25194, 25194, 25194, 25195, 25195,
-    25195, 25196, 25196, 25196, 25196, 25197, 25197, 25197, 25198, 25198, 25198,
-    25198, 25199, 25199, 25199, 25200, 25200, 25200, 25201, 25201, 25201, 25201,
-    25202, 25202, 25202, 25203, 25203, 25203, 25203, 25204, 25204, 25204, 25205,
-    25205, 25205, 25206, 25206, 25206, 25206, 25207, 25207, 25207, 25208, 25208,
-    25208, 25208, 25209, 25209, 25209, 25210, 25210, 25210, 25210, 25211, 25211,
-    25211, 25212, 25212, 25212, 25213, 25213, 25213, 25213, 25214, 25214, 25214,
-    25215, 25215, 25215, 25215, 25216, 25216, 25216, 25217, 25217, 25217, 25218,
-    25218, 25218, 25218, 25219, 25219, 25219, 25220, 25220, 25220, 25220, 25221,
-    25221, 25221, 25222, 25222, 25222, 25222, 25223, 25223, 25223, 25224, 25224,
-    25224, 25225, 25225, 25225, 25225, 25226, 25226, 25226, 25227, 25227, 25227,
-    25227, 25228, 25228, 25228, 25229, 25229, 25229, 25229, 25230, 25230, 25230,
-    25231, 25231, 25231, 25231, 25232, 25232, 25232, 25233, 25233, 25233, 25234,
-    25234, 25234, 25234, 25235, 25235, 25235, 25236, 25236, 25236, 25236, 25237,
-    25237, 25237, 25238, 25238, 25238, 25238, 25239, 25239, 25239, 25240, 25240,
-    25240, 25240, 25241, 25241, 25241, 25242, 25242, 25242, 25243, 25243, 25243,
-    25243, 25244, 25244, 25244, 25245, 25245, 25245, 25245, 25246, 25246, 25246,
-    25247, 25247, 25247, 25247, 25248, 25248, 25248, 25249, 25249, 25249, 25249,
-    25250, 25250, 25250, 25251, 25251, 25251, 25252, 25252, 25252, 25252, 25253,
-    25253, 25253, 25254, 25254, 25254, 25254, 25255, 25255, 25255, 25256, 25256,
-    25256, 25256, 25257, 25257, 25257, 25258, 25258, 25258, 25258, 25259, 25259,
-    25259, 25260, 25260, 25260, 25260, 25261, 25261, 25261, 25262, 25262, 25262,
-    25262, 25263, 25263, 25263, 25264, 25264, 25264, 25264, 25265, 25265, 25265,
-    25266, 25266, 25266, 25267, 25267, 25267, 25267, 25268, 25268, 25268, 25269,
-    25269, 25269, 25269, 25270, 25270, 25270, 25271, 25271, 25271, 25271, 25272,
-    25272, 25272, 25273, 25273, 25273, 25273, 25274, 25274, 25274, 25275, 25275,
-    25275, 25275, 25276, 25276, 25276, 25277, 25277, 25277, 25277, 25278, 25278,
-    25278, 25279, 25279, 25279, 25279, 25280, 25280, 25280, 25281, 25281, 25281,
-    25281, 25282, 25282, 25282, 25283, 25283, 25283, 25283, 25284, 25284, 25284,
-    25285, 25285, 25285, 25285, 25286, 25286, 25286, 25287, 25287, 25287, 25287,
-    25288, 25288, 25288, 25289, 25289, 25289, 25289, 25290, 25290, 25290, 25291,
-    25291, 25291, 25292, 25292, 25292, 25292, 25293, 25293, 25293, 25294, 25294,
-    25294, 25294, 25295, 25295, 25295, 25296, 25296, 25296, 25296, 25297, 25297,
-    25297, 25298, 25298, 25298, 25298, 25299, 25299, 25299, 25300, 25300, 25300,
-    25300, 25301, 25301, 25301, 25302, 25302, 25302, 25302, 25303, 25303, 25303,
-    25304, 25304, 25304, 25304, 25305, 25305, 25305, 25306, 25306, 25306, 25306,
-    25307, 25307, 25307, 25307, 25308, 25308, 25308, 25309, 25309, 25309, 25309,
-    25310, 25310, 25310, 25311, 25311, 25311, 25311, 25312, 25312, 25312, 25313,
-    25313, 25313, 25313, 25314, 25314, 25314, 25315, 25315, 25315, 25315, 25316,
-    25316, 25316, 25317, 25317, 25317, 25317, 25318, 25318, 25318, 25319, 25319,
-    25319, 25319, 25320, 25320, 25320, 25321, 25321, 25321, 25321, 25322, 25322,
-    25322, 25323, 25323, 25323, 25323, 25324, 25324, 25324, 25325, 25325, 25325,
-    25325, 25326, 25326, 25326, 25327, 25327, 25327, 25327, 25328, 25328, 25328,
-    25329, 25329, 25329, 25329, 25330, 25330, 25330, 25331, 25331, 25331, 25331,
-    25332, 25332, 25332, 25332, 25333, 25333, 25333, 25334, 25334, 25334, 25334,
-    25335, 25335, 25335, 25336, 25336, 25336, 25336, 25337, 25337, 25337, 25338,
-    25338, 25338, 25338, 25339, 25339, 25339, 25340, 25340, 25340, 25340, 25341,
-    25341, 25341, 25342, 25342, 25342, 25342, 25343, 25343, 25343, 25344, 25344,
-    25344, 25344, 25345, 25345, 25345, 25345, 25346, 25346, 25346, 25347, 25347,
-    25347, 25347, 25348, 25348, 25348, 25349, 25349, 25349, 25349, 25350, 25350,
-    25350, 25351, 25351, 25351, 25351, 25352, 25352, 25352, 25353, 25353, 25353,
-    25353, 25354, 25354, 25354, 25355, 25355, 25355, 25355, 25356, 25356, 25356,
-    25356, 25357, 25357, 25357, 25358, 25358, 25358, 25358, 25359, 25359, 25359,
-    25360, 25360, 25360, 25360, 25361, 25361, 25361, 25362, 25362, 25362, 25362,
-    25363, 25363, 25363, 25364, 25364, 25364, 25364, 25365, 25365, 25365, 25365,
-    25366, 25366, 25366, 25367, 25367, 25367, 25367, 25368, 25368, 25368, 25369,
-    25369, 25369, 25369, 25370, 25370, 25370, 25371, 25371, 25371, 25371, 25372,
-    25372, 25372, 25372, 25373, 25373, 25373, 25374, 25374, 25374, 25374, 25375,
-    25375, 25375, 25376, 25376, 25376, 25376, 25377, 25377, 25377, 25378, 25378,
-    25378, 25378, 25379, 25379, 25379, 25379, 25380, 25380, 25380, 25381, 25381,
-    25381, 25381, 25382, 25382, 25382, 25383, 25383, 25383, 25383, 25384, 25384,
-    25384, 25385, 25385, 25385, 25385, 25386, 25386, 25386, 25386, 25387, 25387,
-    25387, 25388, 25388, 25388, 25388, 25389, 25389, 25389, 25390, 25390, 25390,
-    25390, 25391, 25391, 25391, 25391, 25392, 25392, 25392, 25393, 25393, 25393,
-    25393, 25394, 25394, 25394, 25395, 25395, 25395, 25395, 25396, 25396, 25396,
-    25397, 25397, 25397, 25397, 25398, 25398, 25398, 25398, 25399, 25399, 25399,
-    25400, 25400, 25400, 25400, 25401, 25401, 25401, 25402, 25402, 25402, 25402,
-    25403, 25403, 25403, 25403, 25404, 25404, 25404, 25405, 25405, 25405, 25405,
-    25406, 25406, 25406, 25407, 25407, 25407, 25407, 25408, 25408, 25408, 25408,
-    25409, 25409, 25409, 25410, 25410, 25410, 25410, 25411, 25411, 25411, 25412,
-    25412, 25412, 25412, 25413, 25413, 25413, 25413, 25414, 25414, 25414, 25415,
-    25415, 25415, 25415, 25416, 25416, 25416, 25416, 25417, 25417, 25417, 25418,
-    25418, 25418, 25418, 25419, 25419, 25419, 25420, 25420, 25420, 25420, 25421,
-    25421, 25421, 25421, 25422, 25422, 25422, 25423, 25423, 25423, 25423, 25424,
-    25424, 25424, 25425, 25425, 25425, 25425, 25426, 25426, 25426, 25426, 25427,
-    25427, 25427, 25428, 25428, 25428, 25428, 25429, 25429, 25429, 25429, 25430,
-    25430, 25430, 25431, 25431, 25431, 25431, 25432, 25432, 25432, 25433, 25433,
-    25433, 25433, 25434, 25434, 25434, 25434, 25435, 25435, 25435, 25436, 25436,
-    25436, 25436, 25437, 25437, 25437, 25437, 25438, 25438, 25438, 25439, 25439,
-    25439, 25439, 25440, 25440, 25440, 25441, 25441, 25441, 25441, 25442, 25442,
-    25442, 25442, 25443, 25443, 25443, 25444, 25444, 25444, 25444, 25445, 25445,
-    25445, 25445, 25446, 25446, 25446, 25447, 25447, 25447, 25447, 25448, 25448,
-    25448, 25448, 25449, 25449, 25449, 25450, 25450, 25450, 25450, 25451, 25451,
-    25451, 25451, 25452, 25452, 25452, 25453, 25453, 25453, 25453, 25454, 25454,
-    25454, 25455, 25455, 25455, 25455, 25456, 25456, 25456, 25456, 25457, 25457,
-    25457, 25458, 25458, 25458, 25458, 25459, 25459, 25459, 25459, 25460, 25460,
-    25460, 25461, 25461, 25461, 25461, 25462, 25462, 25462, 25462, 25463, 25463,
-    25463, 25464, 25464, 25464, 25464, 25465, 25465, 25465, 25465, 25466, 25466,
-    25466, 25467, 25467, 25467, 25467, 25468, 25468, 25468, 25468, 25469, 25469,
-    25469, 25470, 25470, 25470, 25470, 25471, 25471, 25471, 25471, 25472, 25472,
-    25472, 25473, 25473, 25473, 25473, 25474, 25474, 25474, 25474, 25475, 25475,
-    25475, 25476, 25476, 25476, 25476, 25477, 25477, 25477, 25477, 25478, 25478,
-    25478, 25479, 25479, 25479, 25479, 25480, 25480, 25480, 25480, 25481, 25481,
-    25481, 25482, 25482, 25482, 25482, 25483, 25483, 25483, 25483, 25484, 25484,
-    25484, 25485, 25485, 25485, 25485, 25486, 25486, 25486, 25486, 25487, 25487,
-    25487, 25488, 25488, 25488, 25488, 25489, 25489, 25489, 25489, 25490, 25490,
-    25490, 25490, 25491, 25491, 25491, 25492, 25492, 25492, 25492, 25493, 25493,
-    25493, 25493, 25494, 25494, 25494, 25495, 25495, 25495, 25495, 25496, 25496,
-    25496, 25496, 25497, 25497, 25497, 25498, 25498, 25498, 25498, 25499, 25499,
-    25499, 25499, 25500, 25500, 25500, 25501, 25501, 25501, 25501, 25502, 25502,
-    25502, 25502, 25503, 25503, 25503, 25504, 25504, 25504, 25504, 25505, 25505,
-    25505, 25505, 25506, 25506, 25506, 25506, 25507, 25507, 25507, 25508, 25508,
-    25508, 25508, 25509, 25509, 25509, 25509, 25510, 25510, 25510, 25511, 25511,
-    25511, 25511, 25512, 25512, 25512, 25512, 25513, 25513, 25513, 25513, 25514,
-    25514, 25514, 25515, 25515, 25515, 25515, 25516, 25516, 25516, 25516, 25517,
-    25517, 25517, 25518, 25518, 25518, 25518, 25519, 25519, 25519, 25519, 25520,
-    25520, 25520, 25520, 25521, 25521, 25521, 25522, 25522, 25522, 25522, 25523,
-    25523, 25523, 25523, 25524, 25524, 25524, 25525, 25525, 25525, 25525, 25526,
-    25526, 25526, 25526, 25527, 25527, 25527, 25527, 25528, 25528, 25528, 25529,
-    25529, 25529, 25529, 25530, 25530, 25530, 25530, 25531, 25531, 25531, 25532,
-    25532, 25532, 25532, 25533, 25533, 25533, 25533, 25534, 25534, 25534, 25534,
-    25535, 25535, 25535, 25536, 25536, 25536, 25536, 25537, 25537, 25537, 25537,
-    25538, 25538, 25538, 25538, 25539, 25539, 25539, 25540, 25540, 25540, 25540,
-    25541, 25541, 25541, 25541, 25542, 25542, 25542, 25543, 25543, 25543, 25543,
-    25544, 25544, 25544, 25544, 25545, 25545, 25545, 25545, 25546, 25546, 25546,
-    25547, 25547, 25547, 25547, 25548, 25548, 25548, 25548, 25549, 25549, 25549,
-    25549, 25550, 25550, 25550, 25551, 25551, 25551, 25551, 25552, 25552, 25552,
-    25552, 25553, 25553, 25553, 25553, 25554, 25554, 25554, 25555, 25555, 25555,
-    25555, 25556, 25556, 25556, 25556, 25557, 25557, 25557, 25557, 25558, 25558,
-    25558, 25559, 25559, 25559, 25559, 25560, 25560, 25560, 25560, 25561, 25561,
-    25561, 25561, 25562, 25562, 25562, 25563, 25563, 25563, 25563, 25564, 25564,
-    25564, 25564, 25565, 25565, 25565, 25565, 25566, 25566, 25566, 25567, 25567,
-    25567, 25567, 25568, 25568, 25568, 25568, 25569, 25569, 25569, 25569, 25570,
-    25570, 25570, 25570, 25571, 25571, 25571, 25572, 25572, 25572, 25572, 25573,
-    25573, 25573, 25573, 25574, 25574, 25574, 25574, 25575, 25575, 25575, 25576,
-    25576, 25576, 25576, 25577, 25577, 25577, 25577, 25578, 25578, 25578, 25578,
-    25579, 25579, 25579, 25580, 25580, 25580, 25580, 25581, 25581, 25581, 25581,
-    25582, 25582, 25582, 25582, 25583, 25583, 25583, 25583, 25584, 25584, 25584,
-    25585, 25585, 25585, 25585, 25586, 25586, 25586, 25586, 25587, 25587, 25587,
-    25587, 25588, 25588, 25588, 25588, 25589, 25589, 25589, 25590, 25590, 25590,
-    25590, 25591, 25591, 25591, 25591, 25592, 25592, 25592, 25592, 25593, 25593,
-    25593, 25594, 25594, 25594, 25594, 25595, 25595, 25595, 25595, 25596, 25596,
-    25596, 25596, 25597, 25597, 25597, 25597, 25598, 25598, 25598, 25599, 25599,
-    25599, 25599, 25600, 25600, 25600, 25600, 25601, 25601, 25601, 25601, 25602,
-    25602, 25602, 25602, 25603, 25603, 25603, 25604, 25604, 25604, 25604, 25605,
-    25605, 25605, 25605, 25606, 25606, 25606, 25606, 25607, 25607, 25607, 25607,
-    25608, 25608, 25608, 25609, 25609, 25609, 25609, 25610, 25610, 25610, 25610,
-    25611, 25611, 25611, 25611, 25612, 25612, 25612, 25612, 25613, 25613, 25613,
-    25614, 25614, 25614, 25614, 25615, 25615, 25615, 25615, 25616, 25616, 25616,
-    25616, 25617, 25617, 25617, 25617, 25618, 25618, 25618, 25618, 25619, 25619,
-    25619, 25620, 25620, 25620, 25620, 25621, 25621, 25621, 25621, 25622, 25622,
-    25622, 25622, 25623, 25623, 25623, 25623, 25624, 25624, 25624, 25625, 25625,
-    25625, 25625, 25626, 25626, 25626, 25626, 25627, 25627, 25627, 25627, 25628,
-    25628, 25628, 25628, 25629, 25629, 25629, 25629, 25630, 25630, 25630, 25631,
-    25631, 25631, 25631, 25632, 25632, 25632, 25632, 25633, 25633, 25633, 25633,
-    25634, 25634, 25634, 25634, 25635, 25635, 25635, 25635, 25636, 25636, 25636,
-    25637, 25637, 25637, 25637, 25638, 25638, 25638, 25638, 25639, 25639, 25639,
-    25639, 25640, 25640, 25640, 25640, 25641, 25641, 25641, 25641, 25642, 25642,
-    25642, 25643, 25643, 25643, 25643, 25644, 25644, 25644, 25644, 25645, 25645,
-    25645, 25645, 25646, 25646, 25646, 25646, 25647, 25647, 25647, 25647, 25648,
-    25648, 25648, 25648, 25649, 25649, 25649, 25650, 25650, 25650, 25650, 25651,
-    25651, 25651, 25651, 25652, 25652, 25652, 25652, 25653, 25653, 25653, 25653,
-    25654, 25654, 25654, 25654, 25655, 25655, 25655, 25655, 25656, 25656, 25656,
-    25657, 25657, 25657, 25657, 25658, 25658, 25658, 25658, 25659, 25659, 25659,
-    25659, 25660, 25660, 25660, 25660, 25661, 25661, 25661, 25661, 25662, 25662,
-    25662, 25662, 25663, 25663, 25663, 25664, 25664, 25664, 25664, 25665, 25665,
-    25665, 25665, 25666, 25666, 25666, 25666, 25667, 25667, 25667, 25667, 25668,
-    25668, 25668, 25668, 25669, 25669, 25669, 25669, 25670, 25670, 25670, 25671,
-    25671, 25671, 25671, 25672, 25672, 25672, 25672, 25673, 25673, 25673, 25673,
-    25674, 25674, 25674, 25674, 25675, 25675, 25675, 25675, 25676, 25676, 25676,
-    25676, 25677, 25677, 25677, 25677, 25678, 25678, 25678, 25679, 25679, 25679,
-    25679, 25680, 25680, 25680, 25680, 25681, 25681, 25681, 25681, 25682, 25682,
-    25682, 25682, 25683, 25683, 25683, 25683, 25684, 25684, 25684, 25684, 25685,
-    25685, 25685, 25685, 25686, 25686, 25686, 25686, 25687, 25687, 25687, 25688,
-    25688, 25688, 25688, 25689, 25689, 25689, 25689, 25690, 25690, 25690, 25690,
-    25691, 25691, 25691, 25691, 25692, 25692, 25692, 25692, 25693, 25693, 25693,
-    25693, 25694, 25694, 25694, 25694, 25695, 25695, 25695, 25695, 25696, 25696,
-    25696, 25696, 25697, 25697, 25697, 25698, 25698, 25698, 25698, 25699, 25699,
-    25699, 25699, 25700, 25700, 25700, 25700, 25701, 25701, 25701, 25701, 25702,
-    25702, 25702, 25702, 25703, 25703, 25703, 25703, 25704, 25704, 25704, 25704,
-    25705, 25705, 25705, 25705, 25706, 25706, 25706, 25706, 25707, 25707, 25707,
-    25708, 25708, 25708, 25708, 25709, 25709, 25709, 25709, 25710, 25710, 25710,
-    25710, 25711, 25711, 25711, 25711, 25712, 25712, 25712, 25712, 25713, 25713,
-    25713, 25713, 25714, 25714, 25714, 25714, 25715, 25715, 25715, 25715, 25716,
-    25716, 25716, 25716, 25717, 25717, 25717, 25717, 25718, 25718, 25718, 25718,
-    25719, 25719, 25719, 25719, 25720, 25720, 25720, 25721, 25721, 25721, 25721,
-    25722, 25722, 25722, 25722, 25723, 25723, 25723, 25723, 25724, 25724, 25724,
-    25724, 25725, 25725, 25725, 25725, 25726, 25726, 25726, 25726, 25727, 25727,
-    25727, 25727, 25728, 25728, 25728, 25728, 25729, 25729, 25729, 25729, 25730,
-    25730, 25730, 25730, 25731, 25731, 25731, 25731, 25732, 25732, 25732, 25732,
-    25733, 25733, 25733, 25733, 25734, 25734, 25734, 25734, 25735, 25735, 25735,
-    25736, 25736, 25736, 25736, 25737, 25737, 25737, 25737, 25738, 25738, 25738,
-    25738, 25739, 25739, 25739, 25739, 25740, 25740, 25740, 25740, 25741, 25741,
-    25741, 25741, 25742, 25742, 25742, 25742, 25743, 25743, 25743, 25743, 25744,
-    25744, 25744, 25744, 25745, 25745, 25745, 25745, 25746, 25746, 25746, 25746,
-    25747, 25747, 25747, 25747, 25748, 25748, 25748, 25748, 25749, 25749, 25749,
-    25749, 25750, 25750, 25750, 25750, 25751, 25751, 25751, 25751, 25752, 25752,
-    25752, 25752, 25753, 25753, 25753, 25753, 25754, 25754, 25754, 25754, 25755,
-    25755, 25755, 25755, 25756, 25756, 25756, 25756, 25757, 25757, 25757, 25758,
-    25758, 25758, 25758, 25759, 25759, 25759, 25759, 25760, 25760, 25760, 25760,
-    25761, 25761, 25761, 25761, 25762, 25762, 25762, 25762, 25763, 25763, 25763,
-    25763, 25764, 25764, 25764, 25764, 25765, 25765, 25765, 25765, 25766, 25766,
-    25766, 25766, 25767, 25767, 25767, 25767, 25768, 25768, 25768, 25768, 25769,
-    25769, 25769, 25769, 25770, 25770, 25770, 25770, 25771, 25771, 25771, 25771,
-    25772, 25772, 25772, 25772, 25773, 25773, 25773, 25773, 25774, 25774, 25774,
-    25774, 25775, 25775, 25775, 25775, 25776, 25776, 25776, 25776, 25777, 25777,
-    25777, 25777, 25778, 25778, 25778, 25778, 25779, 25779, 25779, 25779, 25780,
-    25780, 25780, 25780, 25781, 25781, 25781, 25781, 25782, 25782, 25782, 25782,
-    25783, 25783, 25783, 25783, 25784, 25784, 25784, 25784, 25785, 25785, 25785,
-    25785, 25786, 25786, 25786, 25786, 25787, 25787, 25787, 25787, 25788, 25788,
-    25788, 25788, 25789, 25789, 25789, 25789, 25790, 25790, 25790, 25790, 25791,
-    25791, 25791, 25791, 25792, 25792, 25792, 25792, 25793, 25793, 25793, 25793,
-    25794, 25794, 25794, 25794, 25795, 25795, 25795, 25795, 25796, 25796, 25796,
-    25796, 25797, 25797, 25797, 25797, 25798, 25798, 25798, 25798, 25799, 25799,
-    25799, 25799, 25800, 25800, 25800, 25800, 25801, 25801, 25801, 25801, 25802,
-    25802, 25802, 25802, 25803, 25803, 25803, 25803, 25804, 25804, 25804, 25804,
-    25805, 25805, 25805, 25805, 25806, 25806, 25806, 25806, 25807, 25807, 25807,
-    25807, 25808, 25808, 25808, 25808, 25809, 25809, 25809, 25809, 25810, 25810,
-    25810, 25810, 25811, 25811, 25811, 25811, 25812, 25812, 25812, 25812, 25813,
-    25813, 25813, 25813, 25814, 25814, 25814, 25814, 25815, 25815, 25815, 25815,
-    25815, 25816, 25816, 25816, 25816, 25817, 25817, 25817, 25817, 25818, 25818,
-    25818, 25818, 25819, 25819, 25819, 25819, 25820, 25820, 25820, 25820, 25821,
-    25821, 25821, 25821, 25822, 25822, 25822, 25822, 25823, 25823, 25823, 25823,
-    25824, 25824, 25824, 25824, 25825, 25825, 25825, 25825, 25826, 25826, 25826,
-    25826, 25827, 25827, 25827, 25827, 25828, 25828, 25828, 25828, 25829, 25829,
-    25829, 25829, 25830, 25830, 25830, 25830, 25831, 25831, 25831, 25831, 25832,
-    25832, 25832, 25832, 25833, 25833, 25833, 25833, 25834, 25834, 25834, 25834,
-    25835, 25835, 25835, 25835, 25836, 25836, 25836, 25836, 25837, 25837, 25837,
-    25837, 25837, 25838, 25838, 25838, 25838, 25839, 25839, 25839, 25839, 25840,
-    25840, 25840, 25840, 25841, 25841, 25841, 25841, 25842, 25842, 25842, 25842,
-    25843, 25843, 25843, 25843, 25844, 25844, 25844, 25844, 25845, 25845, 25845,
-    25845, 25846, 25846, 25846, 25846, 25847, 25847, 25847, 25847, 25848, 25848,
-    25848, 25848, 25849, 25849, 25849, 25849, 25850, 25850, 25850, 25850, 25851,
-    25851, 25851, 25851, 25852, 25852, 25852, 25852, 25852, 25853, 25853, 25853,
-    25853, 25854, 25854, 25854, 25854, 25855, 25855, 25855, 25855, 25856, 25856,
-    25856, 25856, 25857, 25857, 25857, 25857, 25858, 25858, 25858, 25858, 25859,
-    25859, 25859, 25859, 25860, 25860, 25860, 25860, 25861, 25861, 25861, 25861,
-    25862, 25862, 25862, 25862, 25863, 25863, 25863, 25863, 25864, 25864, 25864,
-    25864, 25864, 25865, 25865, 25865, 25865, 25866, 25866, 25866, 25866, 25867,
-    25867, 25867, 25867, 25868, 25868, 25868, 25868, 25869, 25869, 25869, 25869,
-    25870, 25870, 25870, 25870, 25871, 25871, 25871, 25871, 25872, 25872, 25872,
-    25872, 25873, 25873, 25873, 25873, 25874, 25874, 25874, 25874, 25874, 25875,
-    25875, 25875, 25875, 25876, 25876, 25876, 25876, 25877, 25877, 25877, 25877,
-    25878, 25878, 25878, 25878, 25879, 25879, 25879, 25879, 25880, 25880, 25880,
-    25880, 25881, 25881, 25881, 25881, 25882, 25882, 25882, 25882, 25883, 25883,
-    25883, 25883, 25883, 25884, 25884, 25884, 25884, 25885, 25885, 25885, 25885,
-    25886, 25886, 25886, 25886, 25887, 25887, 25887, 25887, 25888, 25888, 25888,
-    25888, 25889, 25889, 25889, 25889, 25890, 25890, 25890, 25890, 25891, 25891,
-    25891, 25891, 25892, 25892, 25892, 25892, 25892, 25893, 25893, 25893, 25893,
-    25894, 25894, 25894, 25894, 25895, 25895, 25895, 25895, 25896, 25896, 25896,
-    25896, 25897, 25897, 25897, 25897, 25898, 25898, 25898, 25898, 25899, 25899,
-    25899, 25899, 25900, 25900, 25900, 25900, 25900, 25901, 25901, 25901, 25901,
-    25902, 25902, 25902, 25902, 25903, 25903, 25903, 25903, 25904, 25904, 25904,
-    25904, 25905, 25905, 25905, 25905, 25906, 25906, 25906, 25906, 25907, 25907,
-    25907, 25907, 25907, 25908, 25908, 25908, 25908, 25909, 25909, 25909, 25909,
-    25910, 25910, 25910, 25910, 25911, 25911, 25911, 25911, 25912, 25912, 25912,
-    25912, 25913, 25913, 25913, 25913, 25914, 25914, 25914, 25914, 25914, 25915,
-    25915, 25915, 25915, 25916, 25916, 25916, 25916, 25917, 25917, 25917, 25917,
-    25918, 25918, 25918, 25918, 25919, 25919, 25919, 25919, 25920, 25920, 25920,
-    25920, 25921, 25921, 25921, 25921, 25921, 25922, 25922, 25922, 25922, 25923,
-    25923, 25923, 25923, 25924, 25924, 25924, 25924, 25925, 25925, 25925, 25925,
-    25926, 25926, 25926, 25926, 25927, 25927, 25927, 25927, 25927, 25928, 25928,
-    25928, 25928, 25929, 25929, 25929, 25929, 25930, 25930, 25930, 25930, 25931,
-    25931, 25931, 25931, 25932, 25932, 25932, 25932, 25933, 25933, 25933, 25933,
-    25933, 25934, 25934, 25934, 25934, 25935, 25935, 25935, 25935, 25936, 25936,
-    25936, 25936, 25937, 25937, 25937, 25937, 25938, 25938, 25938, 25938, 25938,
-    25939, 25939, 25939, 25939, 25940, 25940, 25940, 25940, 25941, 25941, 25941,
-    25941, 25942, 25942, 25942, 25942, 25943, 25943, 25943, 25943, 25944, 25944,
-    25944, 25944, 25944, 25945, 25945, 25945, 25945, 25946, 25946, 25946, 25946,
-    25947, 25947, 25947, 25947, 25948, 25948, 25948, 25948, 25949, 25949, 25949,
-    25949, 25949, 25950, 25950, 25950, 25950, 25951, 25951, 25951, 25951, 25952,
-    25952, 25952, 25952, 25953, 25953, 25953, 25953, 25954, 25954, 25954, 25954,
-    25954, 25955, 25955, 25955, 25955, 25956, 25956, 25956, 25956, 25957, 25957,
-    25957, 25957, 25958, 25958, 25958, 25958, 25959, 25959, 25959, 25959, 25959,
-    25960, 25960, 25960, 25960, 25961, 25961, 25961, 25961, 25962, 25962, 25962,
-    25962, 25963, 25963, 25963, 25963, 25964, 25964, 25964, 25964, 25964, 25965,
-    25965, 25965, 25965, 25966, 25966, 25966, 25966, 25967, 25967, 25967, 25967,
-    25968, 25968, 25968, 25968, 25969, 25969, 25969, 25969, 25969, 25970, 25970,
-    25970, 25970, 25971, 25971, 25971, 25971, 25972, 25972, 25972, 25972, 25973,
-    25973, 25973, 25973, 25973, 25974, 25974, 25974, 25974, 25975, 25975, 25975,
-    25975, 25976, 25976, 25976, 25976, 25977, 25977, 25977, 25977, 25978, 25978,
-    25978, 25978, 25978, 25979, 25979, 25979, 25979, 25980, 25980, 25980, 25980,
-    25981, 25981, 25981, 25981, 25982, 25982, 25982, 25982, 25982, 25983, 25983,
-    25983, 25983, 25984, 25984, 25984, 25984, 25985, 25985, 25985, 25985, 25986,
-    25986, 25986, 25986, 25987, 25987, 25987, 25987, 25987, 25988, 25988, 25988,
-    25988, 25989, 25989, 25989, 25989, 25990, 25990, 25990, 25990, 25991, 25991,
-    25991, 25991, 25991, 25992, 25992, 25992, 25992, 25993, 25993, 25993, 25993,
-    25994, 25994, 25994, 25994, 25995, 25995, 25995, 25995, 25995, 25996, 25996,
-    25996, 25996, 25997, 25997, 25997, 25997, 25998, 25998, 25998, 25998, 25999,
-    25999, 25999, 25999, 25999, 26000, 26000, 26000, 26000, 26001, 26001, 26001,
-    26001, 26002, 26002, 26002, 26002, 26003, 26003, 26003, 26003, 26003, 26004,
-    26004, 26004, 26004, 26005, 26005, 26005, 26005, 26006, 26006, 26006, 26006,
-    26007, 26007, 26007, 26007, 26007, 26008, 26008, 26008, 26008, 26009, 26009,
-    26009, 26009, 26010, 26010, 26010, 26010, 26010, 26011, 26011, 26011, 26011,
-    26012, 26012, 26012, 26012, 26013, 26013, 26013, 26013, 26014, 26014, 26014,
-    26014, 26014, 26015, 26015, 26015, 26015, 26016, 26016, 26016, 26016, 26017,
-    26017, 26017, 26017, 26018, 26018, 26018, 26018, 26018, 26019, 26019, 26019,
-    26019, 26020, 26020, 26020, 26020, 26021, 26021, 26021, 26021, 26021, 26022,
-    26022, 26022, 26022, 26023, 26023, 26023, 26023, 26024, 26024, 26024, 26024,
-    26025, 26025, 26025, 26025, 26025, 26026, 26026, 26026, 26026, 26027, 26027,
-    26027, 26027, 26028, 26028, 26028, 26028, 26028, 26029, 26029, 26029, 26029,
-    26030, 26030, 26030, 26030, 26031, 26031, 26031, 26031, 26032, 26032, 26032,
-    26032, 26032, 26033, 26033, 26033, 26033, 26034, 26034, 26034, 26034, 26035,
-    26035, 26035, 26035, 26035, 26036, 26036, 26036, 26036, 26037, 26037, 26037,
-    26037, 26038, 26038, 26038, 26038, 26038, 26039, 26039, 26039, 26039, 26040,
-    26040, 26040, 26040, 26041, 26041, 26041, 26041, 26042, 26042, 26042, 26042,
-    26042, 26043, 26043, 26043, 26043, 26044, 26044, 26044, 26044, 26045, 26045,
-    26045, 26045, 26045, 26046, 26046, 26046, 26046, 26047, 26047, 26047, 26047,
-    26048, 26048, 26048, 26048, 26048, 26049, 26049, 26049, 26049, 26050, 26050,
-    26050, 26050, 26051, 26051, 26051, 26051, 26051, 26052, 26052, 26052, 26052,
-    26053, 26053, 26053, 26053, 26054, 26054, 26054, 26054, 26054, 26055, 26055,
-    26055, 26055, 26056, 26056, 26056, 26056, 26057, 26057, 26057, 26057, 26058,
-    26058, 26058, 26058, 26058, 26059, 26059, 26059, 26059, 26060, 26060, 26060,
-    26060, 26061, 26061, 26061, 26061, 26061, 26062, 26062, 26062, 26062, 26063,
-    26063, 26063, 26063, 26064, 26064, 26064, 26064, 26064, 26065, 26065, 26065,
-    26065, 26066, 26066, 26066, 26066, 26067, 26067, 26067, 26067, 26067, 26068,
-    26068, 26068, 26068, 26069, 26069, 26069, 26069, 26069, 26070, 26070, 26070,
-    26070, 26071, 26071, 26071, 26071, 26072, 26072, 26072, 26072, 26072, 26073,
-    26073, 26073, 26073, 26074, 26074, 26074, 26074, 26075, 26075, 26075, 26075,
-    26075, 26076, 26076, 26076, 26076, 26077, 26077, 26077, 26077, 26078, 26078,
-    26078, 26078, 26078, 26079, 26079, 26079, 26079, 26080, 26080, 26080, 26080,
-    26081, 26081, 26081, 26081, 26081, 26082, 26082, 26082, 26082, 26083, 26083,
-    26083, 26083, 26084, 26084, 26084, 26084, 26084, 26085, 26085, 26085, 26085,
-    26086, 26086, 26086, 26086, 26087, 26087, 26087, 26087, 26087, 26088, 26088,
-    26088, 26088, 26089, 26089, 26089, 26089, 26089, 26090, 26090, 26090, 26090,
-    26091, 26091, 26091, 26091, 26092, 26092, 26092, 26092, 26092, 26093, 26093,
-    26093, 26093, 26094, 26094, 26094, 26094, 26095, 26095, 26095, 26095, 26095,
-    26096, 26096, 26096, 26096, 26097, 26097, 26097, 26097, 26097, 26098, 26098,
-    26098, 26098, 26099, 26099, 26099, 26099, 26100, 26100, 26100, 26100, 26100,
-    26101, 26101, 26101, 26101, 26102, 26102, 26102, 26102, 26103, 26103, 26103,
-    26103, 26103, 26104, 26104, 26104, 26104, 26105, 26105, 26105, 26105, 26105,
-    26106, 26106, 26106, 26106, 26107, 26107, 26107, 26107, 26108, 26108, 26108,
-    26108, 26108, 26109, 26109, 26109, 26109, 26110, 26110, 26110, 26110, 26110,
-    26111, 26111, 26111, 26111, 26112, 26112, 26112, 26112, 26113, 26113, 26113,
-    26113, 26113, 26114, 26114, 26114, 26114, 26115, 26115, 26115, 26115, 26115,
-    26116, 26116, 26116, 26116, 26117, 26117, 26117, 26117, 26118, 26118, 26118,
-    26118, 26118, 26119, 26119, 26119, 26119, 26120, 26120, 26120, 26120, 26120,
-    26121, 26121, 26121, 26121, 26122, 26122, 26122, 26122, 26123, 26123, 26123,
-    26123, 26123, 26124, 26124, 26124, 26124, 26125, 26125, 26125, 26125, 26125,
-    26126, 26126, 26126, 26126, 26127, 26127, 26127, 26127, 26127, 26128, 26128,
-    26128, 26128, 26129, 26129, 26129, 26129, 26130, 26130, 26130, 26130, 26130,
-    26131, 26131, 26131, 26131, 26132, 26132, 26132, 26132, 26132, 26133, 26133,
-    26133, 26133, 26134, 26134, 26134, 26134, 26135, 26135, 26135, 26135, 26135,
-    26136, 26136, 26136, 26136, 26137, 26137, 26137, 26137, 26137, 26138, 26138,
-    26138, 26138, 26139, 26139, 26139, 26139, 26139, 26140, 26140, 26140, 26140,
-    26141, 26141, 26141, 26141, 26142, 26142, 26142, 26142, 26142, 26143, 26143,
-    26143, 26143, 26144, 26144, 26144, 26144, 26144, 26145, 26145, 26145, 26145,
-    26146, 26146, 26146, 26146, 26146, 26147, 26147, 26147, 26147, 26148, 26148,
-    26148, 26148, 26148, 26149, 26149, 26149, 26149, 26150, 26150, 26150, 26150,
-    26151, 26151, 26151, 26151, 26151, 26152, 26152, 26152, 26152, 26153, 26153,
-    26153, 26153, 26153, 26154, 26154, 26154, 26154, 26155, 26155, 26155, 26155,
-    26155, 26156, 26156, 26156, 26156, 26157, 26157, 26157, 26157, 26157, 26158,
-    26158, 26158, 26158, 26159, 26159, 26159, 26159, 26159, 26160, 26160, 26160,
-    26160, 26161, 26161, 26161, 26161, 26162, 26162, 26162, 26162, 26162, 26163,
-    26163, 26163, 26163, 26164, 26164, 26164, 26164, 26164, 26165, 26165, 26165,
-    26165, 26166, 26166, 26166, 26166, 26166, 26167, 26167, 26167, 26167, 26168,
-    26168, 26168, 26168, 26168, 26169, 26169, 26169, 26169, 26170, 26170, 26170,
-    26170, 26170, 26171, 26171, 26171, 26171, 26172, 26172, 26172, 26172, 26172,
-    26173, 26173, 26173, 26173, 26174, 26174, 26174, 26174, 26174, 26175, 26175,
-    26175, 26175, 26176, 26176, 26176, 26176, 26176, 26177, 26177, 26177, 26177,
-    26178, 26178, 26178, 26178, 26179, 26179, 26179, 26179, 26179, 26180, 26180,
-    26180, 26180, 26181, 26181, 26181, 26181, 26181, 26182, 26182, 26182, 26182,
-    26183, 26183, 26183, 26183, 26183, 26184, 26184, 26184, 26184, 26185, 26185,
-    26185, 26185, 26185, 26186, 26186, 26186, 26186, 26187, 26187, 26187, 26187,
-    26187, 26188, 26188, 26188, 26188, 26189, 26189, 26189, 26189, 26189, 26190,
-    26190, 26190, 26190, 26191, 26191, 26191, 26191, 26191, 26192, 26192, 26192,
-    26192, 26193, 26193, 26193, 26193, 26193, 26194, 26194, 26194, 26194, 26195,
-    26195, 26195, 26195, 26195, 26196, 26196, 26196, 26196, 26197, 26197, 26197,
-    26197, 26197, 26198, 26198, 26198, 26198, 26199, 26199, 26199, 26199, 26199,
-    26200, 26200, 26200, 26200, 26201, 26201, 26201, 26201, 26201, 26202, 26202,
-    26202, 26202, 26202, 26203, 26203, 26203, 26203, 26204, 26204, 26204, 26204,
-    26204, 26205, 26205, 26205, 26205, 26206, 26206, 26206, 26206, 26206, 26207,
-    26207, 26207, 26207, 26208, 26208, 26208, 26208, 26208, 26209, 26209, 26209,
-    26209, 26210, 26210, 26210, 26210, 26210, 26211, 26211, 26211, 26211, 26212,
-    26212, 26212, 26212, 26212, 26213, 26213, 26213, 26213, 26214, 26214, 26214,
-    26214, 26214, 26215, 26215, 26215, 26215, 26216, 26216, 26216, 26216, 26216,
-    26217, 26217, 26217, 26217, 26218, 26218, 26218, 26218, 26218, 26219, 26219,
-    26219, 26219, 26219, 26220, 26220, 26220, 26220, 26221, 26221, 26221, 26221,
-    26221, 26222, 26222, 26222, 26222, 26223, 26223, 26223, 26223, 26223, 26224,
-    26224, 26224, 26224, 26225, 26225, 26225, 26225, 26225, 26226, 26226, 26226,
-    26226, 26227, 26227, 26227, 26227, 26227, 26228, 26228, 26228, 26228, 26229,
-    26229, 26229, 26229, 26229, 26230, 26230, 26230, 26230, 26230, 26231, 26231,
-    26231, 26231, 26232, 26232, 26232, 26232, 26232, 26233, 26233, 26233, 26233,
-    26234, 26234, 26234, 26234, 26234, 26235, 26235, 26235, 26235, 26236, 26236,
-    26236, 26236, 26236, 26237, 26237, 26237, 26237, 26238, 26238, 26238, 26238,
-    26238, 26239, 26239, 26239, 26239, 26239, 26240, 26240, 26240, 26240, 26241,
-    26241, 26241, 26241, 26241, 26242, 26242, 26242, 26242, 26243, 26243, 26243,
-    26243, 26243, 26244, 26244, 26244, 26244, 26245, 26245, 26245, 26245, 26245,
-    26246, 26246, 26246, 26246, 26246, 26247, 26247, 26247, 26247, 26248, 26248,
-    26248, 26248, 26248, 26249, 26249, 26249, 26249, 26250, 26250, 26250, 26250,
-    26250, 26251, 26251, 26251, 26251, 26251, 26252, 26252, 26252, 26252, 26253,
-    26253, 26253, 26253, 26253, 26254, 26254, 26254, 26254, 26255, 26255, 26255,
-    26255, 26255, 26256, 26256, 26256, 26256, 26257, 26257, 26257, 26257, 26257,
-    26258, 26258, 26258, 26258, 26258, 26259, 26259, 26259, 26259, 26260, 26260,
-    26260, 26260, 26260, 26261, 26261, 26261, 26261, 26262, 26262, 26262, 26262,
-    26262, 26263, 26263, 26263, 26263, 26263, 26264, 26264, 26264, 26264, 26265,
-    26265, 26265, 26265, 26265, 26266, 26266, 26266, 26266, 26267, 26267, 26267,
-    26267, 26267, 26268, 26268, 26268, 26268, 26268, 26269, 26269, 26269, 26269,
-    26270, 26270, 26270, 26270, 26270, 26271, 26271, 26271, 26271, 26271, 26272,
-    26272, 26272, 26272, 26273, 26273, 26273, 26273, 26273, 26274, 26274, 26274,
-    26274, 26275, 26275, 26275, 26275, 26275, 26276, 26276, 26276, 26276, 26276,
-    26277, 26277, 26277, 26277, 26278, 26278, 26278, 26278, 26278, 26279, 26279,
-    26279, 26279, 26280, 26280, 26280, 26280, 26280, 26281, 26281, 26281, 26281,
-    26281, 26282, 26282, 26282, 26282, 26283, 26283, 26283, 26283, 26283, 26284,
-    26284, 26284, 26284, 26284, 26285, 26285, 26285, 26285, 26286, 26286, 26286,
-    26286, 26286, 26287, 26287, 26287, 26287, 26288, 26288, 26288, 26288, 26288,
-    26289, 26289, 26289, 26289, 26289, 26290, 26290, 26290, 26290, 26291, 26291,
-    26291, 26291, 26291, 26292, 26292, 26292, 26292, 26292, 26293, 26293, 26293,
-    26293, 26294, 26294, 26294, 26294, 26294, 26295, 26295, 26295, 26295, 26295,
-    26296, 26296, 26296, 26296, 26297, 26297, 26297, 26297, 26297, 26298, 26298,
-    26298, 26298, 26298, 26299, 26299, 26299, 26299, 26300, 26300, 26300, 26300,
-    26300, 26301, 26301, 26301, 26301, 26301, 26302, 26302, 26302, 26302, 26303,
-    26303, 26303, 26303, 26303, 26304, 26304, 26304, 26304, 26305, 26305, 26305,
-    26305, 26305, 26306, 26306, 26306, 26306, 26306, 26307, 26307, 26307, 26307,
-    26308, 26308, 26308, 26308, 26308, 26309, 26309, 26309, 26309, 26309, 26310,
-    26310, 26310, 26310, 26311, 26311, 26311, 26311, 26311, 26312, 26312, 26312,
-    26312, 26312, 26313, 26313, 26313, 26313, 26314, 26314, 26314, 26314, 26314,
-    26315, 26315, 26315, 26315, 26315, 26316, 26316, 26316, 26316, 26316, 26317,
-    26317, 26317, 26317, 26318, 26318, 26318, 26318, 26318, 26319, 26319, 26319,
-    26319, 26319, 26320, 26320, 26320, 26320, 26321, 26321, 26321, 26321, 26321,
-    26322, 26322, 26322, 26322, 26322, 26323, 26323, 26323, 26323, 26324, 26324,
-    26324, 26324, 26324, 26325, 26325, 26325, 26325, 26325, 26326, 26326, 26326,
-    26326, 26327, 26327, 26327, 26327, 26327, 26328, 26328, 26328, 26328, 26328,
-    26329, 26329, 26329, 26329, 26330, 26330, 26330, 26330, 26330, 26331, 26331,
-    26331, 26331, 26331, 26332, 26332, 26332, 26332, 26332, 26333, 26333, 26333,
-    26333, 26334, 26334, 26334, 26334, 26334, 26335, 26335, 26335, 26335, 26335,
-    26336, 26336, 26336, 26336, 26337, 26337, 26337, 26337, 26337, 26338, 26338,
-    26338, 26338, 26338, 26339, 26339, 26339, 26339, 26340, 26340, 26340, 26340,
-    26340, 26341, 26341, 26341, 26341, 26341, 26342, 26342, 26342, 26342, 26342,
-    26343, 26343, 26343, 26343, 26344, 26344, 26344, 26344, 26344, 26345, 26345,
-    26345, 26345, 26345, 26346, 26346, 26346, 26346, 26347, 26347, 26347, 26347,
-    26347, 26348, 26348, 26348, 26348, 26348, 26349, 26349, 26349, 26349, 26349,
-    26350, 26350, 26350, 26350, 26351, 26351, 26351, 26351, 26351, 26352, 26352,
-    26352, 26352, 26352, 26353, 26353, 26353, 26353, 26353, 26354, 26354, 26354,
-    26354, 26355, 26355, 26355, 26355, 26355, 26356, 26356, 26356, 26356, 26356,
-    26357, 26357, 26357, 26357, 26358, 26358, 26358, 26358, 26358, 26359, 26359,
-    26359, 26359, 26359, 26360, 26360, 26360, 26360, 26360, 26361, 26361, 26361,
-    26361, 26362, 26362, 26362, 26362, 26362, 26363, 26363, 26363, 26363, 26363,
-    26364, 26364, 26364, 26364, 26364, 26365, 26365, 26365, 26365, 26366, 26366,
-    26366, 26366, 26366, 26367, 26367, 26367, 26367, 26367, 26368, 26368, 26368,
-    26368, 26368, 26369, 26369, 26369, 26369, 26370, 26370, 26370, 26370, 26370,
-    26371, 26371, 26371, 26371, 26371, 26372, 26372, 26372, 26372, 26372, 26373,
-    26373, 26373, 26373, 26374, 26374, 26374, 26374, 26374, 26375, 26375, 26375,
-    26375, 26375, 26376, 26376, 26376, 26376, 26376, 26377, 26377, 26377, 26377,
-    26378, 26378, 26378, 26378, 26378, 26379, 26379, 26379, 26379, 26379, 26380,
-    26380, 26380, 26380, 26380, 26381, 26381, 26381, 26381, 26381, 26382, 26382,
-    26382, 26382, 26383, 26383, 26383, 26383, 26383, 26384, 26384, 26384, 26384,
-    26384, 26385, 26385, 26385, 26385, 26385, 26386, 26386, 26386, 26386, 26387,
-    26387, 26387, 26387, 26387, 26388, 26388, 26388, 26388, 26388, 26389, 26389,
-    26389, 26389, 26389, 26390, 26390, 26390, 26390, 26390, 26391, 26391, 26391,
-    26391, 26392, 26392, 26392, 26392, 26392, 26393, 26393, 26393, 26393, 26393,
-    26394, 26394, 26394, 26394, 26394, 26395, 26395, 26395, 26395, 26396, 26396,
-    26396, 26396, 26396, 26397, 26397, 26397, 26397, 26397, 26398, 26398, 26398,
-    26398, 26398, 26399, 26399, 26399, 26399, 26399, 26400, 26400, 26400, 26400,
-    26401, 26401, 26401, 26401, 26401, 26402, 26402, 26402, 26402, 26402, 26403,
-    26403, 26403, 26403, 26403, 26404, 26404, 26404, 26404, 26404, 26405, 26405,
-    26405, 26405, 26406, 26406, 26406, 26406, 26406, 26407, 26407, 26407, 26407,
-    26407, 26408, 26408, 26408, 26408, 26408, 26409, 26409, 26409, 26409, 26409,
-    26410, 26410, 26410, 26410, 26410, 26411, 26411, 26411, 26411, 26412, 26412,
-    26412, 26412, 26412, 26413, 26413, 26413, 26413, 26413, 26414, 26414, 26414,
-    26414, 26414, 26415, 26415, 26415, 26415, 26415, 26416, 26416, 26416, 26416,
-    26417, 26417, 26417, 26417, 26417, 26418, 26418, 26418, 26418, 26418, 26419,
-    26419, 26419, 26419, 26419, 26420, 26420, 26420, 26420, 26420, 26421, 26421,
-    26421, 26421, 26421, 26422, 26422, 26422, 26422, 26423, 26423, 26423, 26423,
-    26423, 26424, 26424, 26424, 26424, 26424, 26425, 26425, 26425, 26425, 26425,
-    26426, 26426, 26426, 26426, 26426, 26427, 26427, 26427, 26427, 26427, 26428,
-    26428, 26428, 26428, 26429, 26429, 26429, 26429, 26429, 26430, 26430, 26430,
-    26430, 26430, 26431, 26431, 26431, 26431, 26431, 26432, 26432, 26432, 26432,
-    26432, 26433, 26433, 26433, 26433, 26433, 26434, 26434, 26434, 26434, 26434,
-    26435, 26435, 26435, 26435, 26436, 26436, 26436, 26436, 26436, 26437, 26437,
-    26437, 26437, 26437, 26438, 26438, 26438, 26438, 26438, 26439, 26439, 26439,
-    26439, 26439, 26440, 26440, 26440, 26440, 26440, 26441, 26441, 26441, 26441,
-    26442, 26442, 26442, 26442, 26442, 26443, 26443, 26443, 26443, 26443, 26444,
-    26444, 26444, 26444, 26444, 26445, 26445, 26445, 26445, 26445, 26446, 26446,
-    26446, 26446, 26446, 26447, 26447, 26447, 26447, 26447, 26448, 26448, 26448,
-    26448, 26448, 26449, 26449, 26449, 26449, 26450, 26450, 26450, 26450, 26450,
-    26451, 26451, 26451, 26451, 26451, 26452, 26452, 26452, 26452, 26452, 26453,
-    26453, 26453, 26453, 26453, 26454, 26454, 26454, 26454, 26454, 26455, 26455,
-    26455, 26455, 26455, 26456, 26456, 26456, 26456, 26456, 26457, 26457, 26457,
-    26457, 26458, 26458, 26458, 26458, 26458, 26459, 26459, 26459, 26459, 26459,
-    26460, 26460, 26460, 26460, 26460, 26461, 26461, 26461, 26461, 26461, 26462,
-    26462, 26462, 26462, 26462, 26463, 26463, 26463, 26463, 26463, 26464, 26464,
-    26464, 26464, 26464, 26465, 26465, 26465, 26465, 26465, 26466, 26466, 26466,
-    26466, 26467, 26467, 26467, 26467, 26467, 26468, 26468, 26468, 26468, 26468,
-    26469, 26469, 26469, 26469, 26469, 26470, 26470, 26470, 26470, 26470, 26471,
-    26471, 26471, 26471, 26471, 26472, 26472, 26472, 26472, 26472, 26473, 26473,
-    26473, 26473, 26473, 26474, 26474, 26474, 26474, 26474, 26475, 26475, 26475,
-    26475, 26475, 26476, 26476, 26476, 26476, 26476, 26477, 26477, 26477, 26477,
-    26478, 26478, 26478, 26478, 26478, 26479, 26479, 26479, 26479, 26479, 26480,
-    26480, 26480, 26480, 26480, 26481, 26481, 26481, 26481, 26481, 26482, 26482,
-    26482, 26482, 26482, 26483, 26483, 26483, 26483, 26483, 26484, 26484, 26484,
-    26484, 26484, 26485, 26485, 26485, 26485, 26485, 26486, 26486, 26486, 26486,
-    26486, 26487, 26487, 26487, 26487, 26487, 26488, 26488, 26488, 26488, 26488,
-    26489, 26489, 26489, 26489, 26489, 26490, 26490, 26490, 26490, 26490, 26491,
-    26491, 26491, 26491, 26492, 26492, 26492, 26492, 26492, 26493, 26493, 26493,
-    26493, 26493, 26494, 26494, 26494, 26494, 26494, 26495, 26495, 26495, 26495,
-    26495, 26496, 26496, 26496, 26496, 26496, 26497, 26497, 26497, 26497, 26497,
-    26498, 26498, 26498, 26498, 26498, 26499, 26499, 26499, 26499, 26499, 26500,
-    26500, 26500, 26500, 26500, 26501, 26501, 26501, 26501, 26501, 26502, 26502,
-    26502, 26502, 26502, 26503, 26503, 26503, 26503, 26503, 26504, 26504, 26504,
-    26504, 26504, 26505, 26505, 26505, 26505, 26505, 26506, 26506, 26506, 26506,
-    26506, 26507, 26507, 26507, 26507, 26507, 26508, 26508, 26508, 26508, 26508,
-    26509, 26509, 26509, 26509, 26509, 26510, 26510, 26510, 26510, 26510, 26511,
-    26511, 26511, 26511, 26511, 26512, 26512, 26512, 26512, 26513, 26513, 26513,
-    26513, 26513, 26514, 26514, 26514, 26514, 26514, 26515, 26515, 26515, 26515,
-    26515, 26516, 26516, 26516, 26516, 26516, 26517, 26517, 26517, 26517, 26517,
-    26518, 26518, 26518, 26518, 26518, 26519, 26519, 26519, 26519, 26519, 26520,
-    26520, 26520, 26520, 26520, 26521, 26521, 26521, 26521, 26521, 26522, 26522,
-    26522, 26522, 26522, 26523, 26523, 26523, 26523, 26523, 26524, 26524, 26524,
-    26524, 26524, 26525, 26525, 26525, 26525, 26525, 26526, 26526, 26526, 26526,
-    26526, 26527, 26527, 26527, 26527, 26527, 26528, 26528, 26528, 26528, 26528,
-    26529, 26529, 26529, 26529, 26529, 26530, 26530, 26530, 26530, 26530, 26531,
-    26531, 26531, 26531, 26531, 26532, 26532, 26532, 26532, 26532, 26533, 26533,
-    26533, 26533, 26533, 26534, 26534, 26534, 26534, 26534, 26535, 26535, 26535,
-    26535, 26535, 26536, 26536, 26536, 26536, 26536, 26537, 26537, 26537, 26537,
-    26537, 26538, 26538, 26538, 26538, 26538, 26539, 26539, 26539, 26539, 26539,
-    26540, 26540, 26540, 26540, 26540, 26541, 26541, 26541, 26541, 26541, 26542,
-    26542, 26542, 26542, 26542, 26543, 26543, 26543, 26543, 26543, 26544, 26544,
-    26544, 26544, 26544, 26545, 26545, 26545, 26545, 26545, 26546, 26546, 26546,
-    26546, 26546, 26547, 26547, 26547, 26547, 26547, 26548, 26548, 26548, 26548,
-    26548, 26549, 26549, 26549, 26549, 26549, 26550, 26550, 26550, 26550, 26550,
-    26550, 26551, 26551, 26551, 26551, 26551, 26552, 26552, 26552, 26552, 26552,
-    26553, 26553, 26553, 26553, 26553, 26554, 26554, 26554, 26554, 26554, 26555,
-    26555, 26555, 26555, 26555, 26556, 26556, 26556, 26556, 26556, 26557, 26557,
-    26557, 26557, 26557, 26558, 26558, 26558, 26558, 26558, 26559, 26559, 26559,
-    26559, 26559, 26560, 26560, 26560, 26560, 26560, 26561, 26561, 26561, 26561,
-    26561, 26562, 26562, 26562, 26562, 26562, 26563, 26563, 26563, 26563, 26563,
-    26564, 26564, 26564, 26564, 26564, 26565, 26565, 26565, 26565, 26565, 26566,
-    26566, 26566, 26566, 26566, 26567, 26567, 26567, 26567, 26567, 26568, 26568,
-    26568, 26568, 26568, 26569, 26569, 26569, 26569, 26569, 26570, 26570, 26570,
-    26570, 26570, 26571, 26571, 26571, 26571, 26571, 26571, 26572, 26572, 26572,
-    26572, 26572, 26573, 26573, 26573, 26573, 26573, 26574, 26574, 26574, 26574,
-    26574, 26575, 26575, 26575, 26575, 26575, 26576, 26576, 26576, 26576, 26576,
-    26577, 26577, 26577, 26577, 26577, 26578, 26578, 26578, 26578, 26578, 26579,
-    26579, 26579, 26579, 26579, 26580, 26580, 26580, 26580, 26580, 26581, 26581,
-    26581, 26581, 26581, 26582, 26582, 26582, 26582, 26582, 26583, 26583, 26583,
-    26583, 26583, 26584, 26584, 26584, 26584, 26584, 26585, 26585, 26585, 26585,
-    26585, 26585, 26586, 26586, 26586, 26586, 26586, 26587, 26587, 26587, 26587,
-    26587, 26588, 26588, 26588, 26588, 26588, 26589, 26589, 26589, 26589, 26589,
-    26590, 26590, 26590, 26590, 26590, 26591, 26591, 26591, 26591, 26591, 26592,
-    26592, 26592, 26592, 26592, 26593, 26593, 26593, 26593, 26593, 26594, 26594,
-    26594, 26594, 26594, 26595, 26595, 26595, 26595, 26595, 26595, 26596, 26596,
-    26596, 26596, 26596, 26597, 26597, 26597, 26597, 26597, 26598, 26598, 26598,
-    26598, 26598, 26599, 26599, 26599, 26599, 26599, 26600, 26600, 26600, 26600,
-    26600, 26601, 26601, 26601, 26601, 26601, 26602, 26602, 26602, 26602, 26602,
-    26603, 26603, 26603, 26603, 26603, 26604, 26604, 26604, 26604, 26604, 26604,
-    26605, 26605, 26605, 26605, 26605, 26606, 26606, 26606, 26606, 26606, 26607,
-    26607, 26607, 26607, 26607, 26608, 26608, 26608, 26608, 26608, 26609, 26609,
-    26609, 26609, 26609, 26610, 26610, 26610, 26610, 26610, 26611, 26611, 26611,
-    26611, 26611, 26612, 26612, 26612, 26612, 26612, 26612, 26613, 26613, 26613,
-    26613, 26613, 26614, 26614, 26614, 26614, 26614, 26615, 26615, 26615, 26615,
-    26615, 26616, 26616, 26616, 26616, 26616, 26617, 26617, 26617, 26617, 26617,
-    26618, 26618, 26618, 26618, 26618, 26619, 26619, 26619, 26619, 26619, 26620,
-    26620, 26620, 26620, 26620, 26620, 26621, 26621, 26621, 26621, 26621, 26622,
-    26622, 26622, 26622, 26622, 26623, 26623, 26623, 26623, 26623, 26624, 26624,
-    26624, 26624, 26624, 26625, 26625, 26625, 26625, 26625, 26626, 26626, 26626,
-    26626, 26626, 26626, 26627, 26627, 26627, 26627, 26627, 26628, 26628, 26628,
-    26628, 26628, 26629, 26629, 26629, 26629, 26629, 26630, 26630, 26630, 26630,
-    26630, 26631, 26631, 26631, 26631, 26631, 26632, 26632, 26632, 26632, 26632,
-    26633, 26633, 26633, 26633, 26633, 26633, 26634, 26634, 26634, 26634, 26634,
-    26635, 26635, 26635, 26635, 26635, 26636, 26636, 26636, 26636, 26636, 26637,
-    26637, 26637, 26637, 26637, 26638, 26638, 26638, 26638, 26638, 26639, 26639,
-    26639, 26639, 26639, 26639, 26640, 26640, 26640, 26640, 26640, 26641, 26641,
-    26641, 26641, 26641, 26642, 26642, 26642, 26642, 26642, 26643, 26643, 26643,
-    26643, 26643, 26644, 26644, 26644, 26644, 26644, 26644, 26645, 26645, 26645,
-    26645, 26645, 26646, 26646, 26646, 26646, 26646, 26647, 26647, 26647, 26647,
-    26647, 26648, 26648, 26648, 26648, 26648, 26649, 26649, 26649, 26649, 26649,
-    26649, 26650, 26650, 26650, 26650, 26650, 26651, 26651, 26651, 26651, 26651,
-    26652, 26652, 26652, 26652, 26652, 26653, 26653, 26653, 26653, 26653, 26654,
-    26654, 26654, 26654, 26654, 26654, 26655, 26655, 26655, 26655, 26655, 26656,
-    26656, 26656, 26656, 26656, 26657, 26657, 26657, 26657, 26657, 26658, 26658,
-    26658, 26658, 26658, 26659, 26659, 26659, 26659, 26659, 26659, 26660, 26660,
-    26660, 26660, 26660, 26661, 26661, 26661, 26661, 26661, 26662, 26662, 26662,
-    26662, 26662, 26663, 26663, 26663, 26663, 26663, 26664, 26664, 26664, 26664,
-    26664, 26664, 26665, 26665, 26665, 26665, 26665, 26666, 26666, 26666, 26666,
-    26666, 26667, 26667, 26667, 26667, 26667, 26668, 26668, 26668, 26668, 26668,
-    26669, 26669, 26669, 26669, 26669, 26669, 26670, 26670, 26670, 26670, 26670,
-    26671, 26671, 26671, 26671, 26671, 26672, 26672, 26672, 26672, 26672, 26673,
-    26673, 26673, 26673, 26673, 26673, 26674, 26674, 26674, 26674, 26674, 26675,
-    26675, 26675, 26675, 26675, 26676, 26676, 26676, 26676, 26676, 26677, 26677,
-    26677, 26677, 26677, 26677, 26678, 26678, 26678, 26678, 26678, 26679, 26679,
-    26679, 26679, 26679, 26680, 26680, 26680, 26680, 26680, 26681, 26681, 26681,
-    26681, 26681, 26681, 26682, 26682, 26682, 26682, 26682, 26683, 26683, 26683,
-    26683, 26683, 26684, 26684, 26684, 26684, 26684, 26685, 26685, 26685, 26685,
-    26685, 26685, 26686, 26686, 26686, 26686, 26686, 26687, 26687, 26687, 26687,
-    26687, 26688, 26688, 26688, 26688, 26688, 26689, 26689, 26689, 26689, 26689,
-    26689, 26690, 26690, 26690, 26690, 26690, 26691, 26691, 26691, 26691, 26691,
-    26692, 26692, 26692, 26692, 26692, 26693, 26693, 26693, 26693, 26693, 26693,
-    26694, 26694, 26694, 26694, 26694, 26695, 26695, 26695, 26695, 26695, 26696,
-    26696, 26696, 26696, 26696, 26697, 26697, 26697, 26697, 26697, 26697, 26698,
-    26698, 26698, 26698, 26698, 26699, 26699, 26699, 26699, 26699, 26700, 26700,
-    26700, 26700, 26700, 26700, 26701, 26701, 26701, 26701, 26701, 26702, 26702,
-    26702, 26702, 26702, 26703, 26703, 26703, 26703, 26703, 26704, 26704, 26704,
-    26704, 26704, 26704, 26705, 26705, 26705, 26705, 26705, 26706, 26706, 26706,
-    26706, 26706, 26707, 26707, 26707, 26707, 26707, 26707, 26708, 26708, 26708,
-    26708, 26708, 26709, 26709, 26709, 26709, 26709, 26710, 26710, 26710, 26710,
-    26710, 26711, 26711, 26711, 26711, 26711, 26711, 26712, 26712, 26712, 26712,
-    26712, 26713, 26713, 26713, 26713, 26713, 26714, 26714, 26714, 26714, 26714,
-    26714, 26715, 26715, 26715, 26715, 26715, 26716, 26716, 26716, 26716, 26716,
-    26717, 26717, 26717, 26717, 26717, 26717, 26718, 26718, 26718, 26718, 26718,
-    26719, 26719, 26719, 26719, 26719, 26720, 26720, 26720, 26720, 26720, 26721,
-    26721, 26721, 26721, 26721, 26721, 26722, 26722, 26722, 26722, 26722, 26723,
-    26723, 26723, 26723, 26723, 26724, 26724, 26724, 26724, 26724, 26724, 26725,
-    26725, 26725, 26725, 26725, 26726, 26726, 26726, 26726, 26726, 26727, 26727,
-    26727, 26727, 26727, 26727, 26728, 26728, 26728, 26728, 26728, 26729, 26729,
-    26729, 26729, 26729, 26730, 26730, 26730, 26730, 26730, 26730, 26731, 26731,
-    26731, 26731, 26731, 26732, 26732, 26732, 26732, 26732, 26733, 26733, 26733,
-    26733, 26733, 26733, 26734, 26734, 26734, 26734, 26734, 26735, 26735, 26735,
-    26735, 26735, 26736, 26736, 26736, 26736, 26736, 26736, 26737, 26737, 26737,
-    26737, 26737, 26738, 26738, 26738, 26738, 26738, 26739, 26739, 26739, 26739,
-    26739, 26739, 26740, 26740, 26740, 26740, 26740, 26741, 26741, 26741, 26741,
-    26741, 26742, 26742, 26742, 26742, 26742, 26742, 26743, 26743, 26743, 26743,
-    26743, 26744, 26744, 26744, 26744, 26744, 26744, 26745, 26745, 26745, 26745,
-    26745, 26746, 26746, 26746, 26746, 26746, 26747, 26747, 26747, 26747, 26747,
-    26747, 26748, 26748, 26748, 26748, 26748, 26749, 26749, 26749, 26749, 26749,
-    26750, 26750, 26750, 26750, 26750, 26750, 26751, 26751, 26751, 26751, 26751,
-    26752, 26752, 26752, 26752, 26752, 26753, 26753, 26753, 26753, 26753, 26753,
-    26754, 26754, 26754, 26754, 26754, 26755, 26755, 26755, 26755, 26755, 26755,
-    26756, 26756, 26756, 26756, 26756, 26757, 26757, 26757, 26757, 26757, 26758,
-    26758, 26758, 26758, 26758, 26758, 26759, 26759, 26759, 26759, 26759, 26760,
-    26760, 26760, 26760, 26760, 26761, 26761, 26761, 26761, 26761, 26761, 26762,
-    26762, 26762, 26762, 26762, 26763, 26763, 26763, 26763, 26763, 26763, 26764,
-    26764, 26764, 26764, 26764, 26765, 26765, 26765, 26765, 26765, 26766, 26766,
-    26766, 26766, 26766, 26766, 26767, 26767, 26767, 26767, 26767, 26768, 26768,
-    26768, 26768, 26768, 26768, 26769, 26769, 26769, 26769, 26769, 26770, 26770,
-    26770, 26770, 26770, 26771, 26771, 26771, 26771, 26771, 26771, 26772, 26772,
-    26772, 26772, 26772, 26773, 26773, 26773, 26773, 26773, 26773, 26774, 26774,
-    26774, 26774, 26774, 26775, 26775, 26775, 26775, 26775, 26776, 26776, 26776,
-    26776, 26776, 26776, 26777, 26777, 26777, 26777, 26777, 26778, 26778, 26778,
-    26778, 26778, 26778, 26779, 26779, 26779, 26779, 26779, 26780, 26780, 26780,
-    26780, 26780, 26781, 26781, 26781, 26781, 26781, 26781, 26782, 26782, 26782,
-    26782, 26782, 26783, 26783, 26783, 26783, 26783, 26783, 26784, 26784, 26784,
-    26784, 26784, 26785, 26785, 26785, 26785, 26785, 26785, 26786, 26786, 26786,
-    26786, 26786, 26787, 26787, 26787, 26787, 26787, 26788, 26788, 26788, 26788,
-    26788, 26788, 26789, 26789, 26789, 26789, 26789, 26790, 26790, 26790, 26790,
-    26790, 26790, 26791, 26791, 26791, 26791, 26791, 26792, 26792, 26792, 26792,
-    26792, 26792, 26793, 26793, 26793, 26793, 26793, 26794, 26794, 26794, 26794,
-    26794, 26794, 26795, 26795, 26795, 26795, 26795, 26796, 26796, 26796, 26796,
-    26796, 26797, 26797, 26797, 26797, 26797, 26797, 26798, 26798, 26798, 26798,
-    26798, 26799, 26799, 26799, 26799, 26799, 26799, 26800, 26800, 26800, 26800,
-    26800, 26801, 26801, 26801, 26801, 26801, 26801, 26802, 26802, 26802, 26802,
-    26802, 26803, 26803, 26803, 26803, 26803, 26803, 26804, 26804, 26804, 26804,
-    26804, 26805, 26805, 26805, 26805, 26805, 26805, 26806, 26806, 26806, 26806,
-    26806, 26807, 26807, 26807, 26807, 26807, 26808, 26808, 26808, 26808, 26808,
-    26808, 26809, 26809, 26809, 26809, 26809, 26810, 26810, 26810, 26810, 26810,
-    26810, 26811, 26811, 26811, 26811, 26811, 26812, 26812, 26812, 26812, 26812,
-    26812, 26813, 26813, 26813, 26813, 26813, 26814, 26814, 26814, 26814, 26814,
-    26814, 26815, 26815, 26815, 26815, 26815, 26816, 26816, 26816, 26816, 26816,
-    26816, 26817, 26817, 26817, 26817, 26817, 26818, 26818, 26818, 26818, 26818,
-    26818, 26819, 26819, 26819, 26819, 26819, 26820, 26820, 26820, 26820, 26820,
-    26820, 26821, 26821, 26821, 26821, 26821, 26822, 26822, 26822, 26822, 26822,
-    26822, 26823, 26823, 26823, 26823, 26823, 26824, 26824, 26824, 26824, 26824,
-    26824, 26825, 26825, 26825, 26825, 26825, 26826, 26826, 26826, 26826, 26826,
-    26826, 26827, 26827, 26827, 26827, 26827, 26828, 26828, 26828, 26828, 26828,
-    26828, 26829, 26829, 26829, 26829, 26829, 26830, 26830, 26830, 26830, 26830,
-    26830, 26831, 26831, 26831, 26831, 26831, 26832, 26832, 26832, 26832, 26832,
-    26832, 26833, 26833, 26833, 26833, 26833, 26834, 26834, 26834, 26834, 26834,
-    26834, 26835, 26835, 26835, 26835, 26835, 26836, 26836, 26836, 26836, 26836,
-    26836, 26837, 26837, 26837, 26837, 26837, 26838, 26838, 26838, 26838, 26838,
-    26838, 26839, 26839, 26839, 26839, 26839, 26840, 26840, 26840, 26840, 26840,
-    26840, 26841, 26841, 26841, 26841, 26841, 26842, 26842, 26842, 26842, 26842,
-    26842, 26843, 26843, 26843, 26843, 26843, 26844, 26844, 26844, 26844, 26844,
-    26844, 26845, 26845, 26845, 26845, 26845, 26845, 26846, 26846, 26846, 26846,
-    26846, 26847, 26847, 26847, 26847, 26847, 26847, 26848, 26848, 26848, 26848,
-    26848, 26849, 26849, 26849, 26849, 26849, 26849, 26850, 26850, 26850, 26850,
-    26850, 26851, 26851, 26851, 26851, 26851, 26851, 26852, 26852, 26852, 26852,
-    26852, 26853, 26853, 26853, 26853, 26853, 26853, 26854, 26854, 26854, 26854,
-    26854, 26855, 26855, 26855, 26855, 26855, 26855, 26856, 26856, 26856, 26856,
-    26856, 26856, 26857, 26857, 26857, 26857, 26857, 26858, 26858, 26858, 26858,
-    26858, 26858, 26859, 26859, 26859, 26859, 26859, 26860, 26860, 26860, 26860,
-    26860, 26860, 26861, 26861, 26861, 26861, 26861, 26862, 26862, 26862, 26862,
-    26862, 26862, 26863, 26863, 26863, 26863, 26863, 26863, 26864, 26864, 26864,
-    26864, 26864, 26865, 26865, 26865, 26865, 26865, 26865, 26866, 26866, 26866,
-    26866, 26866, 26867, 26867, 26867, 26867, 26867, 26867, 26868, 26868, 26868,
-    26868, 26868, 26869, 26869, 26869, 26869, 26869, 26869, 26870, 26870, 26870,
-    26870, 26870, 26870, 26871, 26871, 26871, 26871, 26871, 26872, 26872, 26872,
-    26872, 26872, 26872, 26873, 26873, 26873, 26873, 26873, 26874, 26874, 26874,
-    26874, 26874, 26874, 26875, 26875, 26875, 26875, 26875, 26875, 26876, 26876,
-    26876, 26876, 26876, 26877, 26877, 26877, 26877, 26877, 26877, 26878, 26878,
-    26878, 26878, 26878, 26879, 26879, 26879, 26879, 26879, 26879, 26880, 26880,
-    26880, 26880, 26880, 26880, 26881, 26881, 26881, 26881, 26881, 26882, 26882,
-    26882, 26882, 26882, 26882, 26883, 26883, 26883, 26883, 26883, 26884, 26884,
-    26884, 26884, 26884, 26884, 26885, 26885, 26885, 26885, 26885, 26885, 26886,
-    26886, 26886, 26886, 26886, 26887, 26887, 26887, 26887, 26887, 26887, 26888,
-    26888, 26888, 26888, 26888, 26889, 26889, 26889, 26889, 26889, 26889, 26890,
-    26890, 26890, 26890, 26890, 26890, 26891, 26891, 26891, 26891, 26891, 26892,
-    26892, 26892, 26892, 26892, 26892, 26893, 26893, 26893, 26893, 26893, 26893,
-    26894, 26894, 26894, 26894, 26894, 26895, 26895, 26895, 26895, 26895, 26895,
-    26896, 26896, 26896, 26896, 26896, 26897, 26897, 26897, 26897, 26897, 26897,
-    26898, 26898, 26898, 26898, 26898, 26898, 26899, 26899, 26899, 26899, 26899,
-    26900, 26900, 26900, 26900, 26900, 26900, 26901, 26901, 26901, 26901, 26901,
-    26901, 26902, 26902, 26902, 26902, 26902, 26903, 26903, 26903, 26903, 26903,
-    26903, 26904, 26904, 26904, 26904, 26904, 26904, 26905, 26905, 26905, 26905,
-    26905, 26906, 26906, 26906, 26906, 26906, 26906, 26907, 26907, 26907, 26907,
-    26907, 26908, 26908, 26908, 26908, 26908, 26908, 26909, 26909, 26909, 26909,
-    26909, 26909, 26910, 26910, 26910, 26910, 26910, 26911, 26911, 26911, 26911,
-    26911, 26911, 26912, 26912, 26912, 26912, 26912, 26912, 26913, 26913, 26913,
-    26913, 26913, 26914, 26914, 26914, 26914, 26914, 26914, 26915, 26915, 26915,
-    26915, 26915, 26915, 26916, 26916, 26916, 26916, 26916, 26917, 26917, 26917,
-    26917, 26917, 26917, 26918, 26918, 26918, 26918, 26918, 26918, 26919, 26919,
-    26919, 26919, 26919, 26920, 26920, 26920, 26920, 26920, 26920, 26921, 26921,
-    26921, 26921, 26921, 26921, 26922, 26922, 26922, 26922, 26922, 26922, 26923,
-    26923, 26923, 26923, 26923, 26924, 26924, 26924, 26924, 26924, 26924, 26925,
-    26925, 26925, 26925, 26925, 26925, 26926, 26926, 26926, 26926, 26926, 26927,
-    26927, 26927, 26927, 26927, 26927, 26928, 26928, 26928, 26928, 26928, 26928,
-    26929, 26929, 26929, 26929, 26929, 26930, 26930, 26930, 26930, 26930, 26930,
-    26931, 26931, 26931, 26931, 26931, 26931, 26932, 26932, 26932, 26932, 26932,
-    26933, 26933, 26933, 26933, 26933, 26933, 26934, 26934, 26934, 26934, 26934,
-    26934, 26935, 26935, 26935, 26935, 26935, 26935, 26936, 26936, 26936, 26936,
-    26936, 26937, 26937, 26937, 26937, 26937, 26937, 26938, 26938, 26938, 26938,
-    26938, 26938, 26939, 26939, 26939, 26939, 26939, 26940, 26940, 26940, 26940,
-    26940, 26940, 26941, 26941, 26941, 26941, 26941, 26941, 26942, 26942, 26942,
-    26942, 26942, 26942, 26943, 26943, 26943, 26943, 26943, 26944, 26944, 26944,
-    26944, 26944, 26944, 26945, 26945, 26945, 26945, 26945, 26945, 26946, 26946,
-    26946, 26946, 26946, 26947, 26947, 26947, 26947, 26947, 26947, 26948, 26948,
-    26948, 26948, 26948, 26948, 26949, 26949, 26949, 26949, 26949, 26949, 26950,
-    26950, 26950, 26950, 26950, 26951, 26951, 26951, 26951, 26951, 26951, 26952,
-    26952, 26952, 26952, 26952, 26952, 26953, 26953, 26953, 26953, 26953, 26953,
-    26954, 26954, 26954, 26954, 26954, 26955, 26955, 26955, 26955, 26955, 26955,
-    26956, 26956, 26956, 26956, 26956, 26956, 26957, 26957, 26957, 26957, 26957,
-    26957, 26958, 26958, 26958, 26958, 26958, 26959, 26959, 26959, 26959, 26959,
-    26959, 26960, 26960, 26960, 26960, 26960, 26960, 26961, 26961, 26961, 26961,
-    26961, 26961, 26962, 26962, 26962, 26962, 26962, 26963, 26963, 26963, 26963,
-    26963, 26963, 26964, 26964, 26964, 26964, 26964, 26964, 26965, 26965, 26965,
-    26965, 26965, 26965, 26966, 26966, 26966, 26966, 26966, 26967, 26967, 26967,
-    26967, 26967, 26967, 26968, 26968, 26968, 26968, 26968, 26968, 26969, 26969,
-    26969, 26969, 26969, 26969, 26970, 26970, 26970, 26970, 26970, 26970, 26971,
-    26971, 26971, 26971, 26971, 26972, 26972, 26972, 26972, 26972, 26972, 26973,
-    26973, 26973, 26973, 26973, 26973, 26974, 26974, 26974, 26974, 26974, 26974,
-    26975, 26975, 26975, 26975, 26975, 26976, 26976, 26976, 26976, 26976, 26976,
-    26977, 26977, 26977, 26977, 26977, 26977, 26978, 26978, 26978, 26978, 26978,
-    26978, 26979, 26979, 26979, 26979, 26979, 26979, 26980, 26980, 26980, 26980,
-    26980, 26981, 26981, 26981, 26981, 26981, 26981, 26982, 26982, 26982, 26982,
-    26982, 26982, 26983, 26983, 26983, 26983, 26983, 26983, 26984, 26984, 26984,
-    26984, 26984, 26984, 26985, 26985, 26985, 26985, 26985, 26986, 26986, 26986,
-    26986, 26986, 26986, 26987, 26987, 26987, 26987, 26987, 26987, 26988, 26988,
-    26988, 26988, 26988, 26988, 26989, 26989, 26989, 26989, 26989, 26989, 26990,
-    26990, 26990, 26990, 26990, 26991, 26991, 26991, 26991, 26991, 26991, 26992,
-    26992, 26992, 26992, 26992, 26992, 26993, 26993, 26993, 26993, 26993, 26993,
-    26994, 26994, 26994, 26994, 26994, 26994, 26995, 26995, 26995, 26995, 26995,
-    26995, 26996, 26996, 26996, 26996, 26996, 26997, 26997, 26997, 26997, 26997,
-    26997, 26998, 26998, 26998, 26998, 26998, 26998, 26999, 26999, 26999, 26999,
-    26999, 26999, 27000, 27000, 27000, 27000, 27000, 27000, 27001, 27001, 27001,
-    27001, 27001, 27001, 27002, 27002, 27002, 27002, 27002, 27003, 27003, 27003,
-    27003, 27003, 27003, 27004, 27004, 27004, 27004, 27004, 27004, 27005, 27005,
-    27005, 27005, 27005, 27005, 27006, 27006, 27006, 27006, 27006, 27006, 27007,
-    27007, 27007, 27007, 27007, 27007, 27008, 27008, 27008, 27008, 27008, 27009,
-    27009, 27009, 27009, 27009, 27009, 27010, 27010, 27010, 27010, 27010, 27010,
-    27011, 27011, 27011, 27011, 27011, 27011, 27012, 27012, 27012, 27012, 27012,
-    27012, 27013, 27013, 27013, 27013, 27013, 27013, 27014, 27014, 27014, 27014,
-    27014, 27014, 27015, 27015, 27015, 27015, 27015, 27016, 27016, 27016, 27016,
-    27016, 27016, 27017, 27017, 27017, 27017, 27017, 27017, 27018, 27018, 27018,
-    27018, 27018, 27018, 27019, 27019, 27019, 27019, 27019, 27019, 27020, 27020,
-    27020, 27020, 27020, 27020, 27021, 27021, 27021, 27021, 27021, 27021, 27022,
-    27022, 27022, 27022, 27022, 27022, 27023, 27023, 27023, 27023, 27023, 27024,
-    27024, 27024, 27024, 27024, 27024, 27025, 27025, 27025, 27025, 27025, 27025,
-    27026, 27026, 27026, 27026, 27026, 27026, 27027, 27027, 27027, 27027, 27027,
-    27027, 27028, 27028, 27028, 27028, 27028, 27028, 27029, 27029, 27029, 27029,
-    27029, 27029, 27030, 27030, 27030, 27030, 27030, 27030, 27031, 27031, 27031,
-    27031, 27031, 27031, 27032, 27032, 27032, 27032, 27032, 27033, 27033, 27033,
-    27033, 27033, 27033, 27034, 27034, 27034, 27034, 27034, 27034, 27035, 27035,
-    27035, 27035, 27035, 27035, 27036, 27036, 27036, 27036, 27036, 27036, 27037,
-    27037, 27037, 27037, 27037, 27037, 27038, 27038, 27038, 27038, 27038, 27038,
-    27039, 27039, 27039, 27039, 27039, 27039, 27040, 27040, 27040, 27040, 27040,
-    27040, 27041, 27041, 27041, 27041, 27041, 27041, 27042, 27042, 27042, 27042,
-    27042, 27042, 27043, 27043, 27043, 27043, 27043, 27044, 27044, 27044, 27044,
-    27044, 27044, 27045, 27045, 27045, 27045, 27045, 27045, 27046, 27046, 27046,
-    27046, 27046, 27046, 27047, 27047, 27047, 27047, 27047, 27047, 27048, 27048,
-    27048, 27048, 27048, 27048, 27049, 27049, 27049, 27049, 27049, 27049, 27050,
-    27050, 27050, 27050, 27050, 27050, 27051, 27051, 27051, 27051, 27051, 27051,
-    27052, 27052, 27052, 27052, 27052, 27052, 27053, 27053, 27053, 27053, 27053,
-    27053, 27054, 27054, 27054, 27054, 27054, 27054, 27055, 27055, 27055, 27055,
-    27055, 27055, 27056, 27056, 27056, 27056, 27056, 27056, 27057, 27057, 27057,
-    27057, 27057, 27057, 27058, 27058, 27058, 27058, 27058, 27058, 27059, 27059,
-    27059, 27059, 27059, 27060, 27060, 27060, 27060, 27060, 27060, 27061, 27061,
-    27061, 27061, 27061, 27061, 27062, 27062, 27062, 27062, 27062, 27062, 27063,
-    27063, 27063, 27063, 27063, 27063, 27064, 27064, 27064, 27064, 27064, 27064,
-    27065, 27065, 27065, 27065, 27065, 27065, 27066, 27066, 27066, 27066, 27066,
-    27066, 27067, 27067, 27067, 27067, 27067, 27067, 27068, 27068, 27068, 27068,
-    27068, 27068, 27069, 27069, 27069, 27069, 27069, 27069, 27070, 27070, 27070,
-    27070, 27070, 27070, 27071, 27071, 27071, 27071, 27071, 27071, 27072, 27072,
-    27072, 27072, 27072, 27072, 27073, 27073, 27073, 27073, 27073, 27073, 27074,
-    27074, 27074, 27074, 27074, 27074, 27075, 27075, 27075, 27075, 27075, 27075,
-    27076, 27076, 27076, 27076, 27076, 27076, 27077, 27077, 27077, 27077, 27077,
-    27077, 27078, 27078, 27078, 27078, 27078, 27078, 27079, 27079, 27079, 27079,
-    27079, 27079, 27080, 27080, 27080, 27080, 27080, 27080, 27081, 27081, 27081,
-    27081, 27081, 27081, 27082, 27082, 27082, 27082, 27082, 27082, 27083, 27083,
-    27083, 27083, 27083, 27083, 27084, 27084, 27084, 27084, 27084, 27084, 27085,
-    27085, 27085, 27085, 27085, 27085, 27086, 27086, 27086, 27086, 27086, 27086,
-    27087, 27087, 27087, 27087, 27087, 27087, 27088, 27088, 27088, 27088, 27088,
-    27088, 27089, 27089, 27089, 27089, 27089, 27089, 27090, 27090, 27090, 27090,
-    27090, 27090, 27091, 27091, 27091, 27091, 27091, 27091, 27092, 27092, 27092,
-    27092, 27092, 27092, 27093, 27093, 27093, 27093, 27093, 27093, 27094, 27094,
-    27094, 27094, 27094, 27094, 27095, 27095, 27095, 27095, 27095, 27095, 27096,
-    27096, 27096, 27096, 27096, 27096, 27097, 27097, 27097, 27097, 27097, 27097,
-    27098, 27098, 27098, 27098, 27098, 27098, 27099, 27099, 27099, 27099, 27099,
-    27099, 27100, 27100, 27100, 27100, 27100, 27100, 27101, 27101, 27101, 27101,
-    27101, 27101, 27102, 27102, 27102, 27102, 27102, 27102, 27103, 27103, 27103,
-    27103, 27103, 27103, 27104, 27104, 27104, 27104, 27104, 27104, 27104, 27105,
-    27105, 27105, 27105, 27105, 27105, 27106, 27106, 27106, 27106, 27106, 27106,
-    27107, 27107, 27107, 27107, 27107, 27107, 27108, 27108, 27108, 27108, 27108,
-    27108, 27109, 27109, 27109, 27109, 27109, 27109, 27110, 27110, 27110, 27110,
-    27110, 27110, 27111, 27111, 27111, 27111, 27111, 27111, 27112, 27112, 27112,
-    27112, 27112, 27112, 27113, 27113, 27113, 27113, 27113, 27113, 27114, 27114,
-    27114, 27114, 27114, 27114, 27115, 27115, 27115, 27115, 27115, 27115, 27116,
-    27116, 27116, 27116, 27116, 27116, 27117, 27117, 27117, 27117, 27117, 27117,
-    27118, 27118, 27118, 27118, 27118, 27118, 27119, 27119, 27119, 27119, 27119,
-    27119, 27119, 27120, 27120, 27120, 27120, 27120, 27120, 27121, 27121, 27121,
-    27121, 27121, 27121, 27122, 27122, 27122, 27122, 27122, 27122, 27123, 27123,
-    27123, 27123, 27123, 27123, 27124, 27124, 27124, 27124, 27124, 27124, 27125,
-    27125, 27125, 27125, 27125, 27125, 27126, 27126, 27126, 27126, 27126, 27126,
-    27127, 27127, 27127, 27127, 27127, 27127, 27128, 27128, 27128, 27128, 27128,
-    27128, 27129, 27129, 27129, 27129, 27129, 27129, 27130, 27130, 27130, 27130,
-    27130, 27130, 27130, 27131, 27131, 27131, 27131, 27131, 27131, 27132, 27132,
-    27132, 27132, 27132, 27132, 27133, 27133, 27133, 27133, 27133, 27133, 27134,
-    27134, 27134, 27134, 27134, 27134, 27135, 27135, 27135, 27135, 27135, 27135,
-    27136, 27136, 27136, 27136, 27136, 27136, 27137, 27137, 27137, 27137, 27137,
-    27137, 27138, 27138, 27138, 27138, 27138, 27138, 27139, 27139, 27139, 27139,
-    27139, 27139, 27139, 27140, 27140, 27140, 27140, 27140, 27140, 27141, 27141,
-    27141, 27141, 27141, 27141, 27142, 27142, 27142, 27142, 27142, 27142, 27143,
-    27143, 27143, 27143, 27143, 27143, 27144, 27144, 27144, 27144, 27144, 27144,
-    27145, 27145, 27145, 27145, 27145, 27145, 27146, 27146, 27146, 27146, 27146,
-    27146, 27147, 27147, 27147, 27147, 27147, 27147, 27147, 27148, 27148, 27148,
-    27148, 27148, 27148, 27149, 27149, 27149, 27149, 27149, 27149, 27150, 27150,
-    27150, 27150, 27150, 27150, 27151, 27151, 27151, 27151, 27151, 27151, 27152,
-    27152, 27152, 27152, 27152, 27152, 27153, 27153, 27153, 27153, 27153, 27153,
-    27154, 27154, 27154, 27154, 27154, 27154, 27154, 27155, 27155, 27155, 27155,
-    27155, 27155, 27156, 27156, 27156, 27156, 27156, 27156, 27157, 27157, 27157,
-    27157, 27157, 27157, 27158, 27158, 27158, 27158, 27158, 27158, 27159, 27159,
-    27159, 27159, 27159, 27159, 27160, 27160, 27160, 27160, 27160, 27160, 27160,
-    27161, 27161, 27161, 27161, 27161, 27161, 27162, 27162, 27162, 27162, 27162,
-    27162, 27163, 27163, 27163, 27163, 27163, 27163, 27164, 27164, 27164, 27164,
-    27164, 27164, 27165, 27165, 27165, 27165, 27165, 27165, 27166, 27166, 27166,
-    27166, 27166, 27166, 27166, 27167, 27167, 27167, 27167, 27167, 27167, 27168,
-    27168, 27168, 27168, 27168, 27168, 27169, 27169, 27169, 27169, 27169, 27169,
-    27170, 27170, 27170, 27170, 27170, 27170, 27171, 27171, 27171, 27171, 27171,
-    27171, 27171, 27172, 27172, 27172, 27172, 27172, 27172, 27173, 27173, 27173,
-    27173, 27173, 27173, 27174, 27174, 27174, 27174, 27174, 27174, 27175, 27175,
-    27175, 27175, 27175, 27175, 27176, 27176, 27176, 27176, 27176, 27176, 27176,
-    27177, 27177, 27177, 27177, 27177, 27177, 27178, 27178, 27178, 27178, 27178,
-    27178, 27179, 27179, 27179, 27179, 27179, 27179, 27180, 27180, 27180, 27180,
-    27180, 27180, 27181, 27181, 27181, 27181, 27181, 27181, 27181, 27182, 27182,
-    27182, 27182, 27182, 27182, 27183, 27183, 27183, 27183, 27183, 27183, 27184,
-    27184, 27184, 27184, 27184, 27184, 27185, 27185, 27185, 27185, 27185, 27185,
-    27186, 27186, 27186, 27186, 27186, 27186, 27186, 27187, 27187, 27187, 27187,
-    27187, 27187, 27188, 27188, 27188, 27188, 27188, 27188, 27189, 27189, 27189,
-    27189, 27189, 27189, 27190, 27190, 27190, 27190, 27190, 27190, 27190, 27191,
-    27191, 27191, 27191, 27191, 27191, 27192, 27192, 27192, 27192, 27192, 27192,
-    27193, 27193, 27193, 27193, 27193, 27193, 27194, 27194, 27194, 27194, 27194,
-    27194, 27194, 27195, 27195, 27195, 27195, 27195, 27195, 27196, 27196, 27196,
-    27196, 27196, 27196, 27197, 27197, 27197, 27197, 27197, 27197, 27198, 27198,
-    27198, 27198, 27198, 27198, 27198, 27199, 27199, 27199, 27199, 27199, 27199,
-    27200, 27200, 27200, 27200, 27200, 27200, 27201, 27201, 27201, 27201, 27201,
-    27201, 27202, 27202, 27202, 27202, 27202, 27202, 27202, 27203, 27203, 27203,
-    27203, 27203, 27203, 27204, 27204, 27204, 27204, 27204, 27204, 27205, 27205,
-    27205, 27205, 27205, 27205, 27206, 27206, 27206, 27206, 27206, 27206, 27206,
-    27207, 27207, 27207, 27207, 27207, 27207, 27208, 27208, 27208, 27208, 27208,
-    27208, 27209, 27209, 27209, 27209, 27209, 27209, 27210, 27210, 27210, 27210,
-    27210, 27210, 27210, 27211, 27211, 27211, 27211, 27211, 27211, 27212, 27212,
-    27212, 27212, 27212, 27212, 27213, 27213, 27213, 27213, 27213, 27213, 27213,
-    27214, 27214, 27214, 27214, 27214, 27214, 27215, 27215, 27215, 27215, 27215,
-    27215, 27216, 27216, 27216, 27216, 27216, 27216, 27217, 27217, 27217, 27217,
-    27217, 27217, 27217, 27218, 27218, 27218, 27218, 27218, 27218, 27219, 27219,
-    27219, 27219, 27219, 27219, 27220, 27220, 27220, 27220, 27220, 27220, 27220,
-    27221, 27221, 27221, 27221, 27221, 27221, 27222, 27222, 27222, 27222, 27222,
-    27222, 27223, 27223, 27223, 27223, 27223, 27223, 27223, 27224, 27224, 27224,
-    27224, 27224, 27224, 27225, 27225, 27225, 27225, 27225, 27225, 27226, 27226,
-    27226, 27226, 27226, 27226, 27227, 27227, 27227, 27227, 27227, 27227, 27227,
-    27228, 27228, 27228, 27228, 27228, 27228, 27229, 27229, 27229, 27229, 27229,
-    27229, 27230, 27230, 27230, 27230, 27230, 27230, 27230, 27231, 27231, 27231,
-    27231, 27231, 27231, 27232, 27232, 27232, 27232, 27232, 27232, 27233, 27233,
-    27233, 27233, 27233, 27233, 27233, 27234, 27234, 27234, 27234, 27234, 27234,
-    27235, 27235, 27235, 27235, 27235, 27235, 27236, 27236, 27236, 27236, 27236,
-    27236, 27236, 27237, 27237, 27237, 27237, 27237, 27237, 27238, 27238, 27238,
-    27238, 27238, 27238, 27239, 27239, 27239, 27239, 27239, 27239, 27239, 27240,
-    27240, 27240, 27240, 27240, 27240, 27241, 27241, 27241, 27241, 27241, 27241,
-    27242, 27242, 27242, 27242, 27242, 27242, 27242, 27243, 27243, 27243, 27243,
-    27243, 27243, 27244, 27244, 27244, 27244, 27244, 27244, 27244, 27245, 27245,
-    27245, 27245, 27245, 27245, 27246, 27246, 27246, 27246, 27246, 27246, 27247,
-    27247, 27247, 27247, 27247, 27247, 27247, 27248, 27248, 27248, 27248, 27248,
-    27248, 27249, 27249, 27249, 27249, 27249, 27249, 27250, 27250, 27250, 27250,
-    27250, 27250, 27250, 27251, 27251, 27251, 27251, 27251, 27251, 27252, 27252,
-    27252, 27252, 27252, 27252, 27253, 27253, 27253, 27253, 27253, 27253, 27253,
-    27254, 27254, 27254, 27254, 27254, 27254, 27255, 27255, 27255, 27255, 27255,
-    27255, 27255, 27256, 27256, 27256, 27256, 27256, 27256, 27257, 27257, 27257,
-    27257, 27257, 27257, 27258, 27258, 27258, 27258, 27258, 27258, 27258, 27259,
-    27259, 27259, 27259, 27259, 27259, 27260, 27260, 27260, 27260, 27260, 27260,
-    27261, 27261, 27261, 27261, 27261, 27261, 27261, 27262, 27262, 27262, 27262,
-    27262, 27262, 27263, 27263, 27263, 27263, 27263, 27263, 27263, 27264, 27264,
-    27264, 27264, 27264, 27264, 27265, 27265, 27265, 27265, 27265, 27265, 27266,
-    27266, 27266, 27266, 27266, 27266, 27266, 27267, 27267, 27267, 27267, 27267,
-    27267, 27268, 27268, 27268, 27268, 27268, 27268, 27268, 27269, 27269, 27269,
-    27269, 27269, 27269, 27270, 27270, 27270, 27270, 27270, 27270, 27270, 27271,
-    27271, 27271, 27271, 27271, 27271, 27272, 27272, 27272, 27272, 27272, 27272,
-    27273, 27273, 27273, 27273, 27273, 27273, 27273, 27274, 27274, 27274, 27274,
-    27274, 27274, 27275, 27275, 27275, 27275, 27275, 27275, 27275, 27276, 27276,
-    27276, 27276, 27276, 27276, 27277, 27277, 27277, 27277, 27277, 27277, 27278,
-    27278, 27278, 27278, 27278, 27278, 27278, 27279, 27279, 27279, 27279, 27279,
-    27279, 27280, 27280, 27280, 27280, 27280, 27280, 27280, 27281, 27281, 27281,
-    27281, 27281, 27281, 27282, 27282, 27282, 27282, 27282, 27282, 27282, 27283,
-    27283, 27283, 27283, 27283, 27283, 27284, 27284, 27284, 27284, 27284, 27284,
-    27284, 27285, 27285, 27285, 27285, 27285, 27285, 27286, 27286, 27286, 27286,
-    27286, 27286, 27287, 27287, 27287, 27287, 27287, 27287, 27287, 27288, 27288,
-    27288, 27288, 27288, 27288, 27289, 27289, 27289, 27289, 27289, 27289, 27289,
-    27290, 27290, 27290, 27290, 27290, 27290, 27291, 27291, 27291, 27291, 27291,
-    27291, 27291, 27292, 27292, 27292, 27292, 27292, 27292, 27293, 27293, 27293,
-    27293, 27293, 27293, 27293, 27294, 27294, 27294, 27294, 27294, 27294, 27295,
-    27295, 27295, 27295, 27295, 27295, 27295, 27296, 27296, 27296, 27296, 27296,
-    27296, 27297, 27297, 27297, 27297, 27297, 27297, 27297, 27298, 27298, 27298,
-    27298, 27298, 27298, 27299, 27299, 27299, 27299, 27299, 27299, 27300, 27300,
-    27300, 27300, 27300, 27300, 27300, 27301, 27301, 27301, 27301, 27301, 27301,
-    27302, 27302, 27302, 27302, 27302, 27302, 27302, 27303, 27303, 27303, 27303,
-    27303, 27303, 27304, 27304, 27304, 27304, 27304, 27304, 27304, 27305, 27305,
-    27305, 27305, 27305, 27305, 27306, 27306, 27306, 27306, 27306, 27306, 27306,
-    27307, 27307, 27307, 27307, 27307, 27307, 27308, 27308, 27308, 27308, 27308,
-    27308, 27308, 27309, 27309, 27309, 27309, 27309, 27309, 27310, 27310, 27310,
-    27310, 27310, 27310, 27310, 27311, 27311, 27311, 27311, 27311, 27311, 27312,
-    27312, 27312, 27312, 27312, 27312, 27312, 27313, 27313, 27313, 27313, 27313,
-    27313, 27314, 27314, 27314, 27314, 27314, 27314, 27314, 27315, 27315, 27315,
-    27315, 27315, 27315, 27315, 27316, 27316, 27316, 27316, 27316, 27316, 27317,
-    27317, 27317, 27317, 27317, 27317, 27317, 27318, 27318, 27318, 27318, 27318,
-    27318, 27319, 27319, 27319, 27319, 27319, 27319, 27319, 27320, 27320, 27320,
-    27320, 27320, 27320, 27321, 27321, 27321, 27321, 27321, 27321, 27321, 27322,
-    27322, 27322, 27322, 27322, 27322, 27323, 27323, 27323, 27323, 27323, 27323,
-    27323, 27324, 27324, 27324, 27324, 27324, 27324, 27325, 27325, 27325, 27325,
-    27325, 27325, 27325, 27326, 27326, 27326, 27326, 27326, 27326, 27327, 27327,
-    27327, 27327, 27327, 27327, 27327, 27328, 27328, 27328, 27328, 27328, 27328,
-    27329, 27329, 27329, 27329, 27329, 27329, 27329, 27330, 27330, 27330, 27330,
-    27330, 27330, 27330, 27331, 27331, 27331, 27331, 27331, 27331, 27332, 27332,
-    27332, 27332, 27332, 27332, 27332, 27333, 27333, 27333, 27333, 27333, 27333,
-    27334, 27334, 27334, 27334, 27334, 27334, 27334, 27335, 27335, 27335, 27335,
-    27335, 27335, 27336, 27336, 27336, 27336, 27336, 27336, 27336, 27337, 27337,
-    27337, 27337, 27337, 27337, 27338, 27338, 27338, 27338, 27338, 27338, 27338,
-    27339, 27339, 27339, 27339, 27339, 27339, 27339, 27340, 27340, 27340, 27340,
-    27340, 27340, 27341, 27341, 27341, 27341, 27341, 27341, 27341, 27342, 27342,
-    27342, 27342, 27342, 27342, 27343, 27343, 27343, 27343, 27343, 27343, 27343,
-    27344, 27344, 27344, 27344, 27344, 27344, 27344, 27345, 27345, 27345, 27345,
-    27345, 27345, 27346, 27346, 27346, 27346, 27346, 27346, 27346, 27347, 27347,
-    27347, 27347, 27347, 27347, 27348, 27348, 27348, 27348, 27348, 27348, 27348,
-    27349, 27349, 27349, 27349, 27349, 27349, 27349, 27350, 27350, 27350, 27350,
-    27350, 27350, 27351, 27351, 27351, 27351, 27351, 27351, 27351, 27352, 27352,
-    27352, 27352, 27352, 27352, 27353, 27353, 27353, 27353, 27353, 27353, 27353,
-    27354, 27354, 27354, 27354, 27354, 27354, 27354, 27355, 27355, 27355, 27355,
-    27355, 27355, 27356, 27356, 27356, 27356, 27356, 27356, 27356, 27357, 27357,
-    27357, 27357, 27357, 27357, 27358, 27358, 27358, 27358, 27358, 27358, 27358,
-    27359, 27359, 27359, 27359, 27359, 27359, 27359, 27360, 27360, 27360, 27360,
-    27360, 27360, 27361, 27361, 27361, 27361, 27361, 27361, 27361, 27362, 27362,
-    27362, 27362, 27362, 27362, 27362, 27363, 27363, 27363, 27363, 27363, 27363,
-    27364, 27364, 27364, 27364, 27364, 27364, 27364, 27365, 27365, 27365, 27365,
-    27365, 27365, 27366, 27366, 27366, 27366, 27366, 27366, 27366, 27367, 27367,
-    27367, 27367, 27367, 27367, 27367, 27368, 27368, 27368, 27368, 27368, 27368,
-    27369, 27369, 27369, 27369, 27369, 27369, 27369, 27370, 27370, 27370, 27370,
-    27370, 27370, 27370, 27371, 27371, 27371, 27371, 27371, 27371, 27372, 27372,
-    27372, 27372, 27372, 27372, 27372, 27373, 27373, 27373, 27373, 27373, 27373,
-    27373, 27374, 27374, 27374, 27374, 27374, 27374, 27375, 27375, 27375, 27375,
-    27375, 27375, 27375, 27376, 27376, 27376, 27376, 27376, 27376, 27376, 27377,
-    27377, 27377, 27377, 27377, 27377, 27378, 27378, 27378, 27378, 27378, 27378,
-    27378, 27379, 27379, 27379, 27379, 27379, 27379, 27379, 27380, 27380, 27380,
-    27380, 27380, 27380, 27381, 27381, 27381, 27381, 27381, 27381, 27381, 27382,
-    27382, 27382, 27382, 27382, 27382, 27382, 27383, 27383, 27383, 27383, 27383,
-    27383, 27384, 27384, 27384, 27384, 27384, 27384, 27384, 27385, 27385, 27385,
-    27385, 27385, 27385, 27385, 27386, 27386, 27386, 27386, 27386, 27386, 27387,
-    27387, 27387, 27387, 27387, 27387, 27387, 27388, 27388, 27388, 27388, 27388,
-    27388, 27388, 27389, 27389, 27389, 27389, 27389, 27389, 27390, 27390, 27390,
-    27390, 27390, 27390, 27390, 27391, 27391, 27391, 27391, 27391, 27391, 27391,
-    27392, 27392, 27392, 27392, 27392, 27392, 27392, 27393, 27393, 27393, 27393,
-    27393, 27393, 27394, 27394, 27394, 27394, 27394, 27394, 27394, 27395, 27395,
-    27395, 27395, 27395, 27395, 27395, 27396, 27396, 27396, 27396, 27396, 27396,
-    27397, 27397, 27397, 27397, 27397, 27397, 27397, 27398, 27398, 27398, 27398,
-    27398, 27398, 27398, 27399, 27399, 27399, 27399, 27399, 27399, 27399, 27400,
-    27400, 27400, 27400, 27400, 27400, 27401, 27401, 27401, 27401, 27401, 27401,
-    27401, 27402, 27402, 27402, 27402, 27402, 27402, 27402, 27403, 27403, 27403,
-    27403, 27403, 27403, 27404, 27404, 27404, 27404, 27404, 27404, 27404, 27405,
-    27405, 27405, 27405, 27405, 27405, 27405, 27406, 27406, 27406, 27406, 27406,
-    27406, 27406, 27407, 27407, 27407, 27407, 27407, 27407, 27408, 27408, 27408,
-    27408, 27408, 27408, 27408, 27409, 27409, 27409, 27409, 27409, 27409, 27409,
-    27410, 27410, 27410, 27410, 27410, 27410, 27410, 27411, 27411, 27411, 27411,
-    27411, 27411, 27412, 27412, 27412, 27412, 27412, 27412, 27412, 27413, 27413,
-    27413, 27413, 27413, 27413, 27413, 27414, 27414, 27414, 27414, 27414, 27414,
-    27414, 27415, 27415, 27415, 27415, 27415, 27415, 27416, 27416, 27416, 27416,
-    27416, 27416, 27416, 27417, 27417, 27417, 27417, 27417, 27417, 27417, 27418,
-    27418, 27418, 27418, 27418, 27418, 27418, 27419, 27419, 27419, 27419, 27419,
-    27419, 27420, 27420, 27420, 27420, 27420, 27420, 27420, 27421, 27421, 27421,
-    27421, 27421, 27421, 27421, 27422, 27422, 27422, 27422, 27422, 27422, 27422,
-    27423, 27423, 27423, 27423, 27423, 27423, 27423, 27424, 27424, 27424, 27424,
-    27424, 27424, 27425, 27425, 27425, 27425, 27425, 27425, 27425, 27426, 27426,
-    27426, 27426, 27426, 27426, 27426, 27427, 27427, 27427, 27427, 27427, 27427,
-    27427, 27428, 27428, 27428, 27428, 27428, 27428, 27428, 27429, 27429, 27429,
-    27429, 27429, 27429, 27430, 27430, 27430, 27430, 27430, 27430, 27430, 27431,
-    27431, 27431, 27431, 27431, 27431, 27431, 27432, 27432, 27432, 27432, 27432,
-    27432, 27432, 27433, 27433, 27433, 27433, 27433, 27433, 27433, 27434, 27434,
-    27434, 27434, 27434, 27434, 27435, 27435, 27435, 27435, 27435, 27435, 27435,
-    27436, 27436, 27436, 27436, 27436, 27436, 27436, 27437, 27437, 27437, 27437,
-    27437, 27437, 27437, 27438, 27438, 27438, 27438, 27438, 27438, 27438, 27439,
-    27439, 27439, 27439, 27439, 27439, 27440, 27440, 27440, 27440, 27440, 27440,
-    27440, 27441, 27441, 27441, 27441, 27441, 27441, 27441, 27442, 27442, 27442,
-    27442, 27442, 27442, 27442, 27443, 27443, 27443, 27443, 27443, 27443, 27443,
-    27444, 27444, 27444, 27444, 27444, 27444, 27444, 27445, 27445, 27445, 27445,
-    27445, 27445, 27446, 27446, 27446, 27446, 27446, 27446, 27446, 27447, 27447,
-    27447, 27447, 27447, 27447, 27447, 27448, 27448, 27448, 27448, 27448, 27448,
-    27448, 27449, 27449, 27449, 27449, 27449, 27449, 27449, 27450, 27450, 27450,
-    27450, 27450, 27450, 27450, 27451, 27451, 27451, 27451, 27451, 27451, 27452,
-    27452, 27452, 27452, 27452, 27452, 27452, 27453, 27453, 27453, 27453, 27453,
-    27453, 27453, 27454, 27454, 27454, 27454, 27454, 27454, 27454, 27455, 27455,
-    27455, 27455, 27455, 27455, 27455, 27456, 27456, 27456, 27456, 27456, 27456,
-    27456, 27457, 27457, 27457, 27457, 27457, 27457, 27457, 27458, 27458, 27458,
-    27458, 27458, 27458, 27459, 27459, 27459, 27459, 27459, 27459, 27459, 27460,
-    27460, 27460, 27460, 27460, 27460, 27460, 27461, 27461, 27461, 27461, 27461,
-    27461, 27461, 27462, 27462, 27462, 27462, 27462, 27462, 27462, 27463, 27463,
-    27463, 27463, 27463, 27463, 27463, 27464, 27464, 27464, 27464, 27464, 27464,
-    27464, 27465, 27465, 27465, 27465, 27465, 27465, 27465, 27466, 27466, 27466,
-    27466, 27466, 27466, 27466, 27467, 27467, 27467, 27467, 27467, 27467, 27468,
-    27468, 27468, 27468, 27468, 27468, 27468, 27469, 27469, 27469, 27469, 27469,
-    27469, 27469, 27470, 27470, 27470, 27470, 27470, 27470, 27470, 27471, 27471,
-    27471, 27471, 27471, 27471, 27471, 27472, 27472, 27472, 27472, 27472, 27472,
-    27472, 27473, 27473, 27473, 27473, 27473, 27473, 27473, 27474, 27474, 27474,
-    27474, 27474, 27474, 27474, 27475, 27475, 27475, 27475, 27475, 27475, 27475,
-    27476, 27476, 27476, 27476, 27476, 27476, 27476, 27477, 27477, 27477, 27477,
-    27477, 27477, 27478, 27478, 27478, 27478, 27478, 27478, 27478, 27479, 27479,
-    27479, 27479, 27479, 27479, 27479, 27480, 27480, 27480, 27480, 27480, 27480,
-    27480, 27481, 27481, 27481, 27481, 27481, 27481, 27481, 27482, 27482, 27482,
-    27482, 27482, 27482, 27482, 27483, 27483, 27483, 27483, 27483, 27483, 27483,
-    27484, 27484, 27484, 27484, 27484, 27484, 27484, 27485, 27485, 27485, 27485,
-    27485, 27485, 27485, 27486, 27486, 27486, 27486, 27486, 27486, 27486, 27487,
-    27487, 27487, 27487, 27487, 27487, 27487, 27488, 27488, 27488, 27488, 27488,
-    27488, 27488, 27489, 27489, 27489, 27489, 27489, 27489, 27489, 27490, 27490,
-    27490, 27490, 27490, 27490, 27490, 27491, 27491, 27491, 27491, 27491, 27491,
-    27491, 27492, 27492, 27492, 27492, 27492, 27492, 27492, 27493, 27493, 27493,
-    27493, 27493, 27493, 27493, 27494, 27494, 27494, 27494, 27494, 27494, 27495,
-    27495, 27495, 27495, 27495, 27495, 27495, 27496, 27496, 27496, 27496, 27496,
-    27496, 27496, 27497, 27497, 27497, 27497, 27497, 27497, 27497, 27498, 27498,
-    27498, 27498, 27498, 27498, 27498, 27499, 27499, 27499, 27499, 27499, 27499,
-    27499, 27500, 27500, 27500, 27500, 27500, 27500, 27500, 27501, 27501, 27501,
-    27501, 27501, 27501, 27501, 27502, 27502, 27502, 27502, 27502, 27502, 27502,
-    27503, 27503, 27503, 27503, 27503, 27503, 27503, 27504, 27504, 27504, 27504,
-    27504, 27504, 27504, 27505, 27505, 27505, 27505, 27505, 27505, 27505, 27506,
-    27506, 27506, 27506, 27506, 27506, 27506, 27507, 27507, 27507, 27507, 27507,
-    27507, 27507, 27508, 27508, 27508, 27508, 27508, 27508, 27508, 27509, 27509,
-    27509, 27509, 27509, 27509, 27509, 27510, 27510, 27510, 27510, 27510, 27510,
-    27510, 27511, 27511, 27511, 27511, 27511, 27511, 27511, 27512, 27512, 27512,
-    27512, 27512, 27512, 27512, 27513, 27513, 27513, 27513, 27513, 27513, 27513,
-    27514, 27514, 27514, 27514, 27514, 27514, 27514, 27515, 27515, 27515, 27515,
-    27515, 27515, 27515, 27516, 27516, 27516, 27516, 27516, 27516, 27516, 27517,
-    27517, 27517, 27517, 27517, 27517, 27517, 27518, 27518, 27518, 27518, 27518,
-    27518, 27518, 27519, 27519, 27519, 27519, 27519, 27519, 27519, 27520, 27520,
-    27520, 27520, 27520, 27520, 27520, 27521, 27521, 27521, 27521, 27521, 27521,
-    27521, 27522, 27522, 27522, 27522, 27522, 27522, 27522, 27523, 27523, 27523,
-    27523, 27523, 27523, 27523, 27524, 27524, 27524, 27524, 27524, 27524, 27524,
-    27524, 27525, 27525, 27525, 27525, 27525, 27525, 27525, 27526, 27526, 27526,
-    27526, 27526, 27526, 27526, 27527, 27527, 27527, 27527, 27527, 27527, 27527,
-    27528, 27528, 27528, 27528, 27528, 27528, 27528, 27529, 27529, 27529, 27529,
-    27529, 27529, 27529, 27530, 27530, 27530, 27530, 27530, 27530, 27530, 27531,
-    27531, 27531, 27531, 27531, 27531, 27531, 27532, 27532, 27532, 27532, 27532,
-    27532, 27532, 27533, 27533, 27533, 27533, 27533, 27533, 27533, 27534, 27534,
-    27534, 27534, 27534, 27534, 27534, 27535, 27535, 27535, 27535, 27535, 27535,
-    27535, 27536, 27536, 27536, 27536, 27536, 27536, 27536, 27537, 27537, 27537,
-    27537, 27537, 27537, 27537, 27538, 27538, 27538, 27538, 27538, 27538, 27538,
-    27539, 27539, 27539, 27539, 27539, 27539, 27539, 27540, 27540, 27540, 27540,
-    27540, 27540, 27540, 27540, 27541, 27541, 27541, 27541, 27541, 27541, 27541,
-    27542, 27542, 27542, 27542, 27542, 27542, 27542, 27543, 27543, 27543, 27543,
-    27543, 27543, 27543, 27544, 27544, 27544, 27544, 27544, 27544, 27544, 27545,
-    27545, 27545, 27545, 27545, 27545, 27545, 27546, 27546, 27546, 27546, 27546,
-    27546, 27546, 27547, 27547, 27547, 27547, 27547, 27547, 27547, 27548, 27548,
-    27548, 27548, 27548, 27548, 27548, 27549, 27549, 27549, 27549, 27549, 27549,
-    27549, 27550, 27550, 27550, 27550, 27550, 27550, 27550, 27551, 27551, 27551,
-    27551, 27551, 27551, 27551, 27551, 27552, 27552, 27552, 27552, 27552, 27552,
-    27552, 27553, 27553, 27553, 27553, 27553, 27553, 27553, 27554, 27554, 27554,
-    27554, 27554, 27554, 27554, 27555, 27555, 27555, 27555, 27555, 27555, 27555,
-    27556, 27556, 27556, 27556, 27556, 27556, 27556, 27557, 27557, 27557, 27557,
-    27557, 27557, 27557, 27558, 27558, 27558, 27558, 27558, 27558, 27558, 27559,
-    27559, 27559, 27559, 27559, 27559, 27559, 27559, 27560, 27560, 27560, 27560,
-    27560, 27560, 27560, 27561, 27561, 27561, 27561, 27561, 27561, 27561, 27562,
-    27562, 27562, 27562, 27562, 27562, 27562, 27563, 27563, 27563, 27563, 27563,
-    27563, 27563, 27564, 27564, 27564, 27564, 27564, 27564, 27564, 27565, 27565,
-    27565, 27565, 27565, 27565, 27565, 27566, 27566, 27566, 27566, 27566, 27566,
-    27566, 27566, 27567, 27567, 27567, 27567, 27567, 27567, 27567, 27568, 27568,
-    27568, 27568, 27568, 27568, 27568, 27569, 27569, 27569, 27569, 27569, 27569,
-    27569, 27570, 27570, 27570, 27570, 27570, 27570, 27570, 27571, 27571, 27571,
-    27571, 27571, 27571, 27571, 27572, 27572, 27572, 27572, 27572, 27572, 27572,
-    27572, 27573, 27573, 27573, 27573, 27573, 27573, 27573, 27574, 27574, 27574,
-    27574, 27574, 27574, 27574, 27575, 27575, 27575, 27575, 27575, 27575, 27575,
-    27576, 27576, 27576, 27576, 27576, 27576, 27576, 27577, 27577, 27577, 27577,
-    27577, 27577, 27577, 27578, 27578, 27578, 27578, 27578, 27578, 27578, 27578,
-    27579, 27579, 27579, 27579, 27579, 27579, 27579, 27580, 27580, 27580, 27580,
-    27580, 27580, 27580, 27581, 27581, 27581, 27581, 27581, 27581, 27581, 27582,
-    27582, 27582, 27582, 27582, 27582, 27582, 27583, 27583, 27583, 27583, 27583,
-    27583, 27583, 27583, 27584, 27584, 27584, 27584, 27584, 27584, 27584, 27585,
-    27585, 27585, 27585, 27585, 27585, 27585, 27586, 27586, 27586, 27586, 27586,
-    27586, 27586, 27587, 27587, 27587, 27587, 27587, 27587, 27587, 27588, 27588,
-    27588, 27588, 27588, 27588, 27588, 27588, 27589, 27589, 27589, 27589, 27589,
-    27589, 27589, 27590, 27590, 27590, 27590, 27590, 27590, 27590, 27591, 27591,
-    27591, 27591, 27591, 27591, 27591, 27592, 27592, 27592, 27592, 27592, 27592,
-    27592, 27592, 27593, 27593, 27593, 27593, 27593, 27593, 27593, 27594, 27594,
-    27594, 27594, 27594, 27594, 27594, 27595, 27595, 27595, 27595, 27595, 27595,
-    27595, 27596, 27596, 27596, 27596, 27596, 27596, 27596, 27597, 27597, 27597,
-    27597, 27597, 27597, 27597, 27597, 27598, 27598, 27598, 27598, 27598, 27598,
-    27598, 27599, 27599, 27599, 27599, 27599, 27599, 27599, 27600, 27600, 27600,
-    27600, 27600, 27600, 27600, 27601, 27601, 27601, 27601, 27601, 27601, 27601,
-    27601, 27602, 27602, 27602, 27602, 27602, 27602, 27602, 27603, 27603, 27603,
-    27603, 27603, 27603, 27603, 27604, 27604, 27604, 27604, 27604, 27604, 27604,
-    27605, 27605, 27605, 27605, 27605, 27605, 27605, 27605, 27606, 27606, 27606,
-    27606, 27606, 27606, 27606, 27607, 27607, 27607, 27607, 27607, 27607, 27607,
-    27608, 27608, 27608, 27608, 27608, 27608, 27608, 27609, 27609, 27609, 27609,
-    27609, 27609, 27609, 27609, 27610, 27610, 27610, 27610, 27610, 27610, 27610,
-    27611, 27611, 27611, 27611, 27611, 27611, 27611, 27612, 27612, 27612, 27612,
-    27612, 27612, 27612, 27612, 27613, 27613, 27613, 27613, 27613, 27613, 27613,
-    27614, 27614, 27614, 27614, 27614, 27614, 27614, 27615, 27615, 27615, 27615,
-    27615, 27615, 27615, 27616, 27616, 27616, 27616, 27616, 27616, 27616, 27616,
-    27617, 27617, 27617, 27617, 27617, 27617, 27617, 27618, 27618, 27618, 27618,
-    27618, 27618, 27618, 27619, 27619, 27619, 27619, 27619, 27619, 27619, 27619,
-    27620, 27620, 27620, 27620, 27620, 27620, 27620, 27621, 27621, 27621, 27621,
-    27621, 27621, 27621, 27622, 27622, 27622, 27622, 27622, 27622, 27622, 27622,
-    27623, 27623, 27623, 27623, 27623, 27623, 27623, 27624, 27624, 27624, 27624,
-    27624, 27624, 27624, 27625, 27625, 27625, 27625, 27625, 27625, 27625, 27626,
-    27626, 27626, 27626, 27626, 27626, 27626, 27626, 27627, 27627, 27627, 27627,
-    27627, 27627, 27627, 27628, 27628, 27628, 27628, 27628, 27628, 27628, 27629,
-    27629, 27629, 27629, 27629, 27629, 27629, 27629, 27630, 27630, 27630, 27630,
-    27630, 27630, 27630, 27631, 27631, 27631, 27631, 27631, 27631, 27631, 27632,
-    27632, 27632, 27632, 27632, 27632, 27632, 27632, 27633, 27633, 27633, 27633,
-    27633, 27633, 27633, 27634, 27634, 27634, 27634, 27634, 27634, 27634, 27635,
-    27635, 27635, 27635, 27635, 27635, 27635, 27635, 27636, 27636, 27636, 27636,
-    27636, 27636, 27636, 27637, 27637, 27637, 27637, 27637, 27637, 27637, 27638,
-    27638, 27638, 27638, 27638, 27638, 27638, 27638, 27639, 27639, 27639, 27639,
-    27639, 27639, 27639, 27640, 27640, 27640, 27640, 27640, 27640, 27640, 27640,
-    27641, 27641, 27641, 27641, 27641, 27641, 27641, 27642, 27642, 27642, 27642,
-    27642, 27642, 27642, 27643, 27643, 27643, 27643, 27643, 27643, 27643, 27643,
-    27644, 27644, 27644, 27644, 27644, 27644, 27644, 27645, 27645, 27645, 27645,
-    27645, 27645, 27645, 27646, 27646, 27646, 27646, 27646, 27646, 27646, 27646,
-    27647, 27647, 27647, 27647, 27647, 27647, 27647, 27648, 27648, 27648, 27648,
-    27648, 27648, 27648, 27649, 27649, 27649, 27649, 27649, 27649, 27649, 27649,
-    27650, 27650, 27650, 27650, 27650, 27650, 27650, 27651, 27651, 27651, 27651,
-    27651, 27651, 27651, 27651, 27652, 27652, 27652, 27652, 27652, 27652, 27652,
-    27653, 27653, 27653, 27653, 27653, 27653, 27653, 27654, 27654, 27654, 27654,
-    27654, 27654, 27654, 27654, 27655, 27655, 27655, 27655, 27655, 27655, 27655,
-    27656, 27656, 27656, 27656, 27656, 27656, 27656, 27656, 27657, 27657, 27657,
-    27657, 27657, 27657, 27657, 27658, 27658, 27658, 27658, 27658, 27658, 27658,
-    27659, 27659, 27659, 27659, 27659, 27659, 27659, 27659, 27660, 27660, 27660,
-    27660, 27660, 27660, 27660, 27661, 27661, 27661, 27661, 27661, 27661, 27661,
-    27661, 27662, 27662, 27662, 27662, 27662, 27662, 27662, 27663, 27663, 27663,
-    27663, 27663, 27663, 27663, 27663, 27664, 27664, 27664, 27664, 27664, 27664,
-    27664, 27665, 27665, 27665, 27665, 27665, 27665, 27665, 27666, 27666, 27666,
-    27666, 27666, 27666, 27666, 27666, 27667, 27667, 27667, 27667, 27667, 27667,
-    27667, 27668, 27668, 27668, 27668, 27668, 27668, 27668, 27668, 27669, 27669,
-    27669, 27669, 27669, 27669, 27669, 27670, 27670, 27670, 27670, 27670, 27670,
-    27670, 27670, 27671, 27671, 27671, 27671, 27671, 27671, 27671, 27672, 27672,
-    27672, 27672, 27672, 27672, 27672, 27673, 27673, 27673, 27673, 27673, 27673,
-    27673, 27673, 27674, 27674, 27674, 27674, 27674, 27674, 27674, 27675, 27675,
-    27675, 27675, 27675, 27675, 27675, 27675, 27676, 27676, 27676, 27676, 27676,
-    27676, 27676, 27677, 27677, 27677, 27677, 27677, 27677, 27677, 27677, 27678,
-    27678, 27678, 27678, 27678, 27678, 27678, 27679, 27679, 27679, 27679, 27679,
-    27679, 27679, 27679, 27680, 27680, 27680, 27680, 27680, 27680, 27680, 27681,
-    27681, 27681, 27681, 27681, 27681, 27681, 27681, 27682, 27682, 27682, 27682,
-    27682, 27682, 27682, 27683, 27683, 27683, 27683, 27683, 27683, 27683, 27683,
-    27684, 27684, 27684, 27684, 27684, 27684, 27684, 27685, 27685, 27685, 27685,
-    27685, 27685, 27685, 27685, 27686, 27686, 27686, 27686, 27686, 27686, 27686,
-    27687, 27687, 27687, 27687, 27687, 27687, 27687, 27687, 27688, 27688, 27688,
-    27688, 27688, 27688, 27688, 27689, 27689, 27689, 27689, 27689, 27689, 27689,
-    27689, 27690, 27690, 27690, 27690, 27690, 27690, 27690, 27691, 27691, 27691,
-    27691, 27691, 27691, 27691, 27691, 27692, 27692, 27692, 27692, 27692, 27692,
-    27692, 27693, 27693, 27693, 27693, 27693, 27693, 27693, 27693, 27694, 27694,
-    27694, 27694, 27694, 27694, 27694, 27695, 27695, 27695, 27695, 27695, 27695,
-    27695, 27695, 27696, 27696, 27696, 27696, 27696, 27696, 27696, 27697, 27697,
-    27697, 27697, 27697, 27697, 27697, 27697, 27698, 27698, 27698, 27698, 27698,
-    27698, 27698, 27699, 27699, 27699, 27699, 27699, 27699, 27699, 27699, 27700,
-    27700, 27700, 27700, 27700, 27700, 27700, 27701, 27701, 27701, 27701, 27701,
-    27701, 27701, 27701, 27702, 27702, 27702, 27702, 27702, 27702, 27702, 27703,
-    27703, 27703, 27703, 27703, 27703, 27703, 27703, 27704, 27704, 27704, 27704,
-    27704, 27704, 27704, 27705, 27705, 27705, 27705, 27705, 27705, 27705, 27705,
-    27706, 27706, 27706, 27706, 27706, 27706, 27706, 27707, 27707, 27707, 27707,
-    27707, 27707, 27707, 27707, 27708, 27708, 27708, 27708, 27708, 27708, 27708,
-    27708, 27709, 27709, 27709, 27709, 27709, 27709, 27709, 27710, 27710, 27710,
-    27710, 27710, 27710, 27710, 27710, 27711, 27711, 27711, 27711, 27711, 27711,
-    27711, 27712, 27712, 27712, 27712, 27712, 27712, 27712, 27712, 27713,
+#define FUZZ_TABLE_BITS 9
+#define FUZZ_TABLE_SHIFT 6
+int16_t fuzz_samples[513] = {
+    0,     342,   678,   1007,  1329,  1645,  1954,  2258,  2555,  2847,  3133,
+    3414,  3689,  3960,  4225,  4486,  4742,  4993,  5240,  5483,  5721,  5955,
+    6185,  6412,  6634,  6853,  7068,  7280,  7488,  7693,  7894,  8092,  8288,
+    8480,  8669,  8855,  9038,  9219,  9397,  9572,  9745,  9915,  10082, 10248,
+    10410, 10571, 10729, 10885, 11039, 11190, 11340, 11487, 11633, 11776, 11918,
+    12058, 12195, 12332, 12466, 12598, 12729, 12858, 12986, 13111, 13236, 13358,
+    13480, 13599, 13717, 13834, 13950, 14063, 14176, 14287, 14397, 14506, 14613,
+    14719, 14824, 14928, 15030, 15132, 15232, 15331, 15429, 15526, 15622, 15716,
+    15810, 15903, 15994, 16085, 16175, 16263, 16351, 16438, 16524, 16609, 16693,
+    16777, 16859, 16941, 17022, 17102, 17181, 17259, 17337, 17414, 17490, 17565,
+    17640, 17714, 17787, 17859, 17931, 18002, 18072, 18142, 18211, 18280, 18348,
+    18415, 18481, 18547, 18613, 18677, 18741, 18805, 18868, 18931, 18992, 19054,
+    19115, 19175, 19235, 19294, 19353, 19411, 19468, 19526, 19582, 19639, 19694,
+    19750, 19804, 19859, 19913, 19966, 20019, 20072, 20124, 20176, 20227, 20278,
+    20329, 20379, 20428, 20478, 20527, 20575, 20623, 20671, 20718, 20766, 20812,
+    20858, 20904, 20950, 20995, 21040, 21085, 21129, 21173, 21217, 21260, 21303,
+    21345, 21388, 21430, 21471, 21513, 21554, 21595, 21635, 21675, 21715, 21755,
+    21794, 21833, 21872, 21911, 21949, 21987, 22025, 22062, 22099, 22136, 22173,
+    22209, 22246, 22281, 22317, 22353, 22388, 22423, 22458, 22492, 22526, 22561,
+    22594, 22628, 22661, 22695, 22728, 22760, 22793, 22825, 22857, 22889, 22921,
+    22953, 22984, 23015, 23046, 23077, 23107, 23138, 23168, 23198, 23228, 23257,
+    23287, 23316, 23345, 23374, 23402, 23431, 23459, 23488, 23516, 23543, 23571,
+    23599, 23626, 23653, 23680, 23707, 23734, 23761, 23787, 23813, 23839, 23865,
+    23891, 23917, 23942, 23968, 23993, 24018, 24043, 24068, 24092, 24117, 24141,
+    24166, 24190, 24214, 24238, 24261, 24285, 24308, 24332, 24355, 24378, 24401,
+    24424, 24446, 24469, 24492, 24514, 24536, 24558, 24580, 24602, 24624, 24645,
+    24667, 24688, 24710, 24731, 24752, 24773, 24794, 24815, 24835, 24856, 24876,
+    24897, 24917, 24937, 24957, 24977, 24997, 25016, 25036, 25056, 25075, 25094,
+    25114, 25133, 25152, 25171, 25190, 25208, 25227, 25246, 25264, 25283, 25301,
+    25319, 25337, 25355, 25373, 25391, 25409, 25427, 25444, 25462, 25479, 25497,
+    25514, 25531, 25548, 25565, 25582, 25599, 25616, 25633, 25650, 25666, 25683,
+    25699, 25715, 25732, 25748, 25764, 25780, 25796, 25812, 25828, 25844, 25859,
+    25875, 25891, 25906, 25921, 25937, 25952, 25967, 25982, 25998, 26013, 26028,
+    26042, 26057, 26072, 26087, 26101, 26116, 26130, 26145, 26159, 26174, 26188,
+    26202, 26216, 26230, 26244, 26258, 26272, 26286, 26300, 26314, 26327, 26341,
+    26354, 26368, 26381, 26395, 26408, 26421, 26434, 26448, 26461, 26474, 26487,
+    26500, 26513, 26526, 26538, 26551, 26564, 26576, 26589, 26602, 26614, 26626,
+    26639, 26651, 26664, 26676, 26688, 26700, 26712, 26724, 26736, 26748, 26760,
+    26772, 26784, 26796, 26807, 26819, 26831, 26842, 26854, 26865, 26877, 26888,
+    26900, 26911, 26922, 26933, 26945, 26956, 26967, 26978, 26989, 27000, 27011,
+    27022, 27033, 27044, 27054, 27065, 27076, 27086, 27097, 27108, 27118, 27129,
+    27139, 27150, 27160, 27170, 27181, 27191, 27201, 27211, 27222, 27232, 27242,
+    27252, 27262, 27272, 27282, 27292, 27302, 27312, 27321, 27331, 27341, 27351,
+    27360, 27370, 27379, 27389, 27399, 27408, 27418, 27427, 27436, 27446, 27455,
+    27464, 27474, 27483, 27492, 27501, 27511, 27520, 27529, 27538, 27547, 27556,
+    27565, 27574, 27583, 27592, 27600, 27609, 27618, 27627, 27635, 27644, 27653,
+    27661, 27670, 27679, 27687, 27696, 27704, 27713,
 };
+
+// v must be in [0, 32767]
+int16_t fuzz_lookup(int16_t v) {
+  int16_t i = v >> FUZZ_TABLE_SHIFT;
+  int32_t f = v & ((1 << FUZZ_TABLE_SHIFT) - 1);
+  int32_t a = fuzz_samples[i];
+  return a + (((fuzz_samples[i + 1] - a) * f) >> FUZZ_TABLE_SHIFT);
+}
+
+int16_t Fuzz_sample(int16_t v, uint8_t pre_amp, uint8_t post_amp) {
+  v = util_clamp((v * pre_amp) / 16, -32767, 32767);
+  if (v >= 0) {
+    v = fuzz_lookup(v);
+  } else {
+    v = -1 * fuzz_lookup(-v);
+  }
+  return util_clamp((v * post_amp) / 256, -32767, 32767);
+}
+
 void Fuzz_process(int16_t *values, uint16_t num_values, uint8_t pre_amp,
                   uint8_t post_amp) {
   for (uint16_t i = 0; i < num_values; i++) {
-    values[i] = util_clamp((values[i] * pre_amp) / 16, -32767, 32767);
-    if (values[i] >= 0) {
-      values[i] = fuzz_samples[values[i]];
-    } else {
-      values[i] = -1 * fuzz_samples[-values[i]];
-    }
-    values[i] = util_clamp((values[i] * post_amp) / 256, -32767, 32767);
+    values[i] = Fuzz_sample(values[i], pre_amp, post_amp);
   }
 }
 #endif
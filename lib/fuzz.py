@@ -1,5 +1,10 @@
 import math
 
+# number of table segments, as a power of two. the table is small enough to
+# live in SRAM (it is not const, so it is copied out of flash at boot) and is
+# read with linear interpolation instead of a 64 KB lookup through the XIP cache
+table_bits = 9
+
 
 def dbamp(db):
     return math.pow(10, db / 20)
@@ -8,22 +13,23 @@ def dbamp(db):
 def fuzz(num_points, max_value):
     a = 5.4
     samples = []
-    for n in range(int(num_points)):
+    for n in range(int(num_points) + 1):
         x = n / num_points
         y = (a * x) / (1 + abs(a * x)) * max_value
         samples.append(y)
     return samples
 
 
-samples = fuzz(math.pow(2, 15), (math.pow(2, 16) - 1) * dbamp(-6))
+samples = fuzz(math.pow(2, table_bits), (math.pow(2, 16) - 1) * dbamp(-6))
 # plot samples
 from matplotlib import pyplot as plt
 
+step = int(math.pow(2, 15 - table_bits))
 samples_plot = []
 for i in range(len(samples) - 1, 0, -1):
     samples_plot.append(-1 * samples[i])
 samples_plot += samples
-plt.plot(range(-32768, 32767), samples_plot)
+plt.plot(range(-32768, 32768 + step, step), samples_plot)
 plt.xlabel("in (int16_t)")
 plt.ylabel("out (int16_t)")
 plt.show()
@@ -31,21 +37,36 @@ plt.show()
 print("#ifndef LIB_FUZZ")
 print("#define LIB_FUZZ 1")
 print("#include <stdint.h>\n")
-print(f"const int16_t __in_flash() fuzz_samples[{len(samples)}] = {{")
+print(f"#define FUZZ_TABLE_BITS {table_bits}")
+print(f"#define FUZZ_TABLE_SHIFT {15 - table_bits}")
+print(f"int16_t fuzz_samples[{len(samples)}] = {{")
 for sample in samples:
     print(f"\t{int(sample)},")
 print("};")
 print(
-    """void Fuzz_process(int16_t *values, uint16_t num_values, uint8_t pre_amp,
+    """
+// v must be in [0, 32767]
+int16_t fuzz_lookup(int16_t v) {
+  int16_t i = v >> FUZZ_TABLE_SHIFT;
+  int32_t f = v & ((1 << FUZZ_TABLE_SHIFT) - 1);
+  int32_t a = fuzz_samples[i];
+  return a + (((fuzz_samples[i + 1] - a) * f) >> FUZZ_TABLE_SHIFT);
+}
+
+int16_t Fuzz_sample(int16_t v, uint8_t pre_amp, uint8_t post_amp) {
+  v = util_clamp((v * pre_amp) / 16, -32767, 32767);
+  if (v >= 0) {
+    v = fuzz_lookup(v);
+  } else {
+    v = -1 * fuzz_lookup(-v);
+  }
+  return util_clamp((v * post_amp) / 256, -32767, 32767);
+}
+
+void Fuzz_process(int16_t *values, uint16_t num_values, uint8_t pre_amp,
                   uint8_t post_amp) {
   for (uint16_t i = 0; i < num_values; i++) {
-    values[i] = util_clamp((values[i] * pre_amp) / 16, -32767, 32767);
-    if (values[i] >= 0) {
-      values[i] = fuzz_samples[values[i]];
-    } else {
-      values[i] = -1 * fuzz_samples[-values[i]];
-    }
-    values[i] = util_clamp((values[i] * post_amp) / 256, -32767, 32767);
+    values[i] = Fuzz_sample(values[i], pre_amp, post_amp);
   }
 }"""
 )
@@ -0,0 +1,218 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_FXPOOL_H_
+#define LIB_FXPOOL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// FxPool hands out the large effect buffers (delay ring, beat repeat
+// capture) from one arena, when an effect is switched on, and takes them
+// back once it has faded out, so effects that are never used cost nothing.
+// an effect asks for the size it wants and the smallest it can work with:
+// the first gap that holds the full size is used, otherwise the largest gap
+// if it holds the smallest size (degraded), otherwise it is rejected.
+//
+// only the audio core allocates and frees, so there is no locking.
+
+// room for the delay (86 kB), reverb and time stretch at full size with the
+// beat repeat at its minimum or better, all on at once
+#ifndef FXPOOL_SIZE
+#define FXPOOL_SIZE (116 * 1024)
+#endif
+#define FXPOOL_BLOCKS 8
+#define FXPOOL_EFFECTS 8
+#define FXPOOL_ALIGN 4
+
+typedef struct FxPoolBlock {
+  uint32_t offset;
+  uint32_t size;
+} FxPoolBlock;
+
+// what an effect asks for, for the report
+typedef struct FxPoolEffect {
+  const char *name;
+  uint32_t want;
+  uint32_t min;
+} FxPoolEffect;
+
+typedef struct FxPool {
+  uint8_t *arena;
+  uint32_t size;
+  // allocated blocks, sorted by offset
+  FxPoolBlock blocks[FXPOOL_BLOCKS];
+  uint8_t num_blocks;
+  uint32_t used;
+  uint32_t used_max;
+  uint32_t degraded;
+  uint32_t rejected;
+  FxPoolEffect effects[FXPOOL_EFFECTS];
+  uint8_t num_effects;
+} FxPool;
+
+FxPool *FxPool_malloc(uint32_t size) {
+  FxPool *self = (FxPool *)malloc(sizeof(FxPool));
+  self->arena = (uint8_t *)malloc(size);
+  self->size = size;
+  self->num_blocks = 0;
+  self->used = 0;
+  self->used_max = 0;
+  self->degraded = 0;
+  self->rejected = 0;
+  self->num_effects = 0;
+  return self;
+}
+
+void FxPool_free(FxPool *self) {
+  free(self->arena);
+  free(self);
+}
+
+// records what an effect will ask for, for FxPool_report
+void FxPool_register(FxPool *self, const char *name, uint32_t want,
+                     uint32_t min) {
+  if (self->num_effects == FXPOOL_EFFECTS) {
+    return;
+  }
+  FxPoolEffect *e = &self->effects[self->num_effects++];
+  e->name = name;
+  e->want = want;
+  e->min = min;
+}
+
+// returns zeroed memory of between min and want bytes, and the size in
+// granted, or NULL when not even min fits
+void *FxPool_alloc(FxPool *self, uint32_t want, uint32_t min,
+                   uint32_t *granted) {
+  if (self->num_blocks == FXPOOL_BLOCKS) {
+    self->rejected++;
+    return NULL;
+  }
+  want = (want + FXPOOL_ALIGN - 1) & ~(FXPOOL_ALIGN - 1);
+  int8_t best = -1;
+  uint32_t best_offset = 0;
+  uint32_t best_gap = 0;
+  uint32_t offset = 0;
+  for (uint8_t i = 0; i <= self->num_blocks; i++) {
+    uint32_t end = i < self->num_blocks ? self->blocks[i].offset : self->size;
+    uint32_t gap = end - offset;
+    if (gap >= want) {
+      best = i;
+      best_offset = offset;
+      best_gap = want;
+      break;
+    }
+    if (gap > best_gap) {
+      best = i;
+      best_offset = offset;
+      best_gap = gap & ~(FXPOOL_ALIGN - 1);
+    }
+    if (i < self->num_blocks) {
+      offset = self->blocks[i].offset + self->blocks[i].size;
+    }
+  }
+  if (best < 0 || best_gap < min) {
+    self->rejected++;
+    return NULL;
+  }
+  if (best_gap < want) {
+    self->degraded++;
+  }
+  for (int8_t i = self->num_blocks; i > best; i--) {
+    self->blocks[i] = self->blocks[i - 1];
+  }
+  self->blocks[best].offset = best_offset;
+  self->blocks[best].size = best_gap;
+  self->num_blocks++;
+  self->used += best_gap;
+  if (self->used > self->used_max) {
+    self->used_max = self->used;
+  }
+  memset(self->arena + best_offset, 0, best_gap);
+  *granted = best_gap;
+  return self->arena + best_offset;
+}
+
+// gives back the end of a block, size is what is kept
+void FxPool_shrink(FxPool *self, void *ptr, uint32_t size) {
+  uint32_t offset = (uint8_t *)ptr - self->arena;
+  size = (size + FXPOOL_ALIGN - 1) & ~(FXPOOL_ALIGN - 1);
+  for (uint8_t i = 0; i < self->num_blocks; i++) {
+    if (self->blocks[i].offset == offset && self->blocks[i].size > size) {
+      self->used -= self->blocks[i].size - size;
+      self->blocks[i].size = size;
+      return;
+    }
+  }
+}
+
+void FxPool_release(FxPool *self, void *ptr) {
+  uint32_t offset = (uint8_t *)ptr - self->arena;
+  for (uint8_t i = 0; i < self->num_blocks; i++) {
+    if (self->blocks[i].offset == offset) {
+      self->used -= self->blocks[i].size;
+      self->num_blocks--;
+      for (uint8_t j = i; j < self->num_blocks; j++) {
+        self->blocks[j] = self->blocks[j + 1];
+      }
+      return;
+    }
+  }
+}
+
+// prints which combinations of the registered effects fit at once, at full
+// size or degraded. this adds up sizes, an arena split up by the order
+// effects came and went in can do worse.
+void FxPool_report(FxPool *self) {
+  printf("[fxpool] %d bytes\n", (int)self->size);
+  for (uint16_t set = 1; set < (1 << self->num_effects); set++) {
+    uint32_t want = 0;
+    uint32_t min = 0;
+    for (uint8_t i = 0; i < self->num_effects; i++) {
+      if (set & (1 << i)) {
+        want += self->effects[i].want;
+        min += self->effects[i].min;
+      }
+    }
+    const char *fits = "no";
+    if (want <= self->size) {
+      fits = "full";
+    } else if (min <= self->size) {
+      fits = "degraded";
+    }
+    printf("[fxpool]");
+    for (uint8_t i = 0; i < self->num_effects; i++) {
+      if (set & (1 << i)) {
+        printf(" %s", self->effects[i].name);
+      }
+    }
+    printf(": %s\n", fits);
+  }
+}
+
+#endif
@@ -42,7 +42,6 @@ bool phase_change;
 unsigned int fil_bytes_read;
 unsigned int fil_bytes_read2;
 // uint16_t sf->bpm_tempo = 185;
-uint16_t bpm_last = 185;
 uint8_t sel_sample_cur = 0;
 uint8_t sel_sample_next = 0;
 uint8_t sel_bank_cur = 0;
@@ -54,7 +53,6 @@ uint8_t banks_with_samples[16];
 uint8_t banks_with_samples_num = 0;
 
 FRESULT fil_result;
-struct repeating_timer timer;
 bool phase_forward = 1;
 bool sync_using_sdcard = false;
 
@@ -65,12 +63,15 @@ SequencerHandler sequencerhandler[3];
 // voice 2 is always an envelope DOWN
 // voice 1 is only voice that jumps
 // voice 2 takes place of old voice and continues
-Envelope2 *envelope_volume;
-Envelope2 *envelope_pitch;
-EnvelopeLinearInteger *envelope_filter;
-Noise *noise_wobble;
+EnvelopeTable *envelope_volume;
+EnvelopeTable *envelope_pitch;
+EnvelopeTable *envelope_filter;
+FxPool *fxpool;
 BeatRepeat *beatrepeat;
 Delay *delay;
+Reverb *reverb;
+TimeStretch *timestretch;
+Modulation *modulation;
 uint vols[2];
 
 float vol3 = 0;
@@ -88,6 +89,12 @@ float retrig_vol = 1.0;
 float retrig_vol_step = 0;
 uint8_t retrig_pitch = 48;
 int8_t retrig_pitch_change = 0;
+// the audio core's copy of the retrig volume and pitch, set by COMMAND_RETRIG
+float audio_retrig_vol = 1.0;
+uint8_t audio_retrig_pitch = 48;
+// what core0 last sent
+float retrig_vol_sent = 1.0;
+uint8_t retrig_pitch_sent = 48;
 
 // buttons
 // mode toggles
@@ -121,8 +128,11 @@ int8_t sel_variation_next = 0;
 bool quadratic_resampling = false;
 bool clock_out_do = false;
 bool clock_out_ready = false;
+uint16_t clock_out_offset = 0;
 bool clock_in_do = false;
 bool clock_in_ready = false;
+// the beat was reset for an idle clock input, until its next edge
+bool clock_in_idle = false;
 
 uint8_t do_update_beat_repeat = 0;
 
@@ -138,8 +148,12 @@ WaveBass *wavebass;
 #endif
 
 ResonantFilter *resFilter[2];
+// the cutoff index (q16) the filters glide along, a change closes 1/4 of the
+// distance each block
+#define FILTER_GLIDE_SHIFT 2
+Smooth filter_cutoff;
 Gate *audio_gate;
-Saturation *saturation;
+ShaperChain *shaperchain;
 
 #define DEBOUNCE_UINT8_LED_BAR 0
 #define DEBOUNCE_UINT8_LED_SPIRAL1 1
@@ -151,21 +165,28 @@ DebounceUint8 *debouncer_uint8[DEBOUNCE_UINT8_NUM];
 DebounceDigits *debouncer_digits;
 #endif
 
-MessageSync *messagesync;
+LogRing *logring;
+CommandQueue *commandqueue;
+Transport *transport;
+Governor *governor;
+#ifdef INCLUDE_CLOCK_GOVERNOR
+ClockGovernor *clockgovernor;
+#endif
+// sample offset of the transport tick being run
+uint16_t transport_tick_offset = 0;
+#ifdef INCLUDE_PROFILER
+Profiler *profiler;
+uint32_t profiler_last_request = 0;
+#endif
+#ifdef INCLUDE_FLIGHTRECORDER
+FlightRecorder *flightrecorder;
+#endif
 bool sdcard_startup_is_starting = false;
 bool audio_mute = false;
 bool trigger_audio_mute = false;
 bool button_mute = false;
 bool trigger_button_mute = false;
 
-// lfos
-int32_t lfo_pan_val = 0;
-// TODO: make the lfo pan step adjustable?
-int32_t lfo_pan_step = Q16_16_2PI / (96 * 5);
-int32_t lfo_tremelo_val = 0;
-// TODO: make the lfo tremelo step adjustable?
-int32_t lfo_tremelo_step = Q16_16_2PI / (96);
-
 #define ENVELOPE_PITCH_THRESHOLD 0.01
 bool fx_tape_stop_active = false;
 
@@ -275,6 +296,19 @@ WS2812 *ws2812;
 #endif
 
 bool repeating_timer_callback_taptempo = false;
+
+// sends the retrig volume and pitch to the audio core if they changed
+void retrig_send() {
+  if (retrig_vol == retrig_vol_sent && retrig_pitch == retrig_pitch_sent) {
+    return;
+  }
+  if (CommandQueue_send(commandqueue, COMMAND_RETRIG, retrig_pitch, 0,
+                        (int32_t)(retrig_vol * 65536.0f))) {
+    retrig_vol_sent = retrig_vol;
+    retrig_pitch_sent = retrig_pitch;
+  }
+}
+
 uint8_t key_jump_debounce = 0;
 void do_update_phase_from_beat_current() {
   // printf("[do_update_phase_from_beat_current] beat_current: %d\n",
@@ -297,10 +331,8 @@ void do_update_phase_from_beat_current() {
                     .snd[sel_variation]
                     ->slice_stop[slice];
   }
-  gate_counter = 0;
-  phase_change = true;
-  audio_mute = false;
-  Gate_reset(audio_gate);
+  retrig_send();
+  CommandQueue_send(commandqueue, COMMAND_JUMP, 0, 0, phase_new);
 #ifdef INCLUDE_ECTOCORE
   gpio_put(GPIO_TAPTEMPO_LED, repeating_timer_callback_taptempo);
   repeating_timer_callback_taptempo = !repeating_timer_callback_taptempo;
@@ -309,9 +341,11 @@ void do_update_phase_from_beat_current() {
   // printf("do_update_phase_from_beat_current: %d\n", phase_new);
 }
 
+// runs on the audio core, which owns the beat and retrig state and the
+// sequencers, core0 asks for a jump with key_send_jump
 void key_do_jump(uint8_t beat) {
   if (beat >= 0 && beat < 16) {
-    printf("key_do_jump %d\n", beat);
+    LogRing_printf(logring, "key_do_jump %d\n", beat);
     // TODO: [0] should be which sequencer it is on
     if (sequencerhandler[0].recording) {
       Sequencer_add(sf->sequencers[0][0], beat, bpm_timer_counter);
@@ -324,6 +358,72 @@ void key_do_jump(uint8_t beat) {
 }
 
 void step_sequencer_emit(uint8_t key) { key_do_jump(key); }
-void step_sequencer_stop() { printf("stop\n"); }
+void step_sequencer_stop() { LogRing_printf(logring, "stop\n"); }
+
+// called from core0, the audio core jumps at its next block. debounce sets
+// debounce_quantize with the jump, -1 leaves it.
+void key_send_jump(uint8_t beat, int32_t debounce) {
+  CommandQueue_send(commandqueue, COMMAND_KEY_JUMP, beat, 0, debounce);
+}
+
+// called from core0, the audio core retriggers beat_num times every
+// timer_reset ticks
+void retrig_send_start(uint8_t beat_num, uint16_t timer_reset) {
+  CommandQueue_send(commandqueue, COMMAND_RETRIG_START, beat_num, timer_reset,
+                    0);
+}
+
+// runs on the audio core from COMMAND_RETRIG_START
+void retrig_start(uint8_t beat_num, uint16_t timer_reset) {
+  debounce_quantize = 0;
+  retrig_first = true;
+  retrig_beat_num = beat_num;
+  retrig_timer_reset = timer_reset;
+  retrig_vol_step = 1.0 / ((float)retrig_beat_num);
+  retrig_ready = true;
+}
+
+#define SEQUENCER_TOGGLE_PLAY 0
+#define SEQUENCER_TOGGLE_RECORD 1
+#define SEQUENCER_QUANTIZE 2
+
+// runs on the audio core from COMMAND_SEQUENCER, core0 only reads
+// sequencerhandler for the leds
+void sequencer_apply(uint8_t i, uint16_t action, int32_t value) {
+  switch (action) {
+    case SEQUENCER_TOGGLE_PLAY:
+      sequencerhandler[i].recording = false;
+      sequencerhandler[i].playing = !sequencerhandler[i].playing;
+      if (sequencerhandler[i].playing) {
+        LogRing_printf(logring, "[sequencer] sequence %d playing on\n", i);
+        if (Sequencer_has_data(sf->sequencers[i][0])) {
+          Sequencer_play(sf->sequencers[i][0], true);
+        } else {
+          LogRing_printf(logring, "[sequencer] sequence %d has no data\n", i);
+          sequencerhandler[i].playing = false;
+        }
+      } else {
+        LogRing_printf(logring, "[sequencer] sequence %d playing off\n", i);
+        Sequencer_stop(sf->sequencers[i][0]);
+      }
+      break;
+    case SEQUENCER_TOGGLE_RECORD:
+      sequencerhandler[i].playing = false;
+      sequencerhandler[i].recording = !sequencerhandler[i].recording;
+      if (sequencerhandler[i].recording) {
+        // todo [0] should be which sequencer is currently on
+        Sequencer_clear(sf->sequencers[i][0]);
+        LogRing_printf(logring, "[sequencer] sequence %d recording on\n", i);
+      } else {
+        LogRing_printf(logring, "[sequencer] sequence %d recording off\n", i);
+      }
+      break;
+    case SEQUENCER_QUANTIZE:
+      Sequencer_quantize(sf->sequencers[i][0], value);
+      break;
+    default:
+      break;
+  }
+}
 
 #endif
@@ -0,0 +1,108 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_GOVERNOR_H_
+#define LIB_GOVERNOR_H_
+
+// Governor steps the audio quality down a ladder when the callback keeps
+// overrunning, instead of muting. each level keeps the savings of the ones
+// below it. a step is shed when the caller sees sustained overload, and
+// restored one at a time after calm_blocks blocks in a row with the average
+// utilization under the restore threshold, which is well below the overload
+// threshold so it does not flap between levels. the average (over about 16
+// blocks) keeps a lone slow sd read from restarting the count.
+
+#define GOVERNOR_FULL 0
+// linear instead of quadratic resampling
+#define GOVERNOR_LINEAR 1
+// one filter for both channels
+#define GOVERNOR_FILTER_MONO 2
+// drop tremelo and pan
+#define GOVERNOR_NO_LFO 3
+// fade out the delay and the reverb
+#define GOVERNOR_NO_DELAY 4
+// jumps only fade in the new head instead of crossfading two
+#define GOVERNOR_NO_CROSSFADE 5
+#define GOVERNOR_LEVELS 6
+
+const char *governor_names[GOVERNOR_LEVELS] = {
+    "full", "linear", "filter mono", "no lfo", "no delay", "no crossfade",
+};
+
+typedef struct Governor {
+  uint8_t level;
+  uint8_t restore_threshold;
+  // utilization * 16
+  int32_t average;
+  uint16_t calm;
+  uint16_t calm_blocks;
+} Governor;
+
+Governor *Governor_malloc(uint8_t restore_threshold, uint16_t calm_blocks) {
+  Governor *self = (Governor *)malloc(sizeof(Governor));
+  self->level = GOVERNOR_FULL;
+  self->restore_threshold = restore_threshold;
+  self->average = 0;
+  self->calm = 0;
+  self->calm_blocks = calm_blocks;
+  return self;
+}
+
+void Governor_free(Governor *self) { free(self); }
+
+// steps down one level, returns false when there is nothing left to shed
+bool Governor_shed(Governor *self) {
+  self->calm = 0;
+  if (self->level == GOVERNOR_LEVELS - 1) {
+    return false;
+  }
+  self->level++;
+  return true;
+}
+
+// called every block with its cpu utilization, returns true when a level
+// was restored
+bool Governor_update(Governor *self, uint8_t utilization) {
+  self->average += (utilization * 16 - self->average) / 16;
+  if (self->level == GOVERNOR_FULL) {
+    return false;
+  }
+  if (self->average >= self->restore_threshold * 16) {
+    self->calm = 0;
+    return false;
+  }
+  self->calm++;
+  if (self->calm < self->calm_blocks) {
+    return false;
+  }
+  self->calm = 0;
+  self->level--;
+  return true;
+}
+
+const char *Governor_name(Governor *self) {
+  return governor_names[self->level];
+}
+
+#endif
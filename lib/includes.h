@@ -37,6 +37,8 @@
 #include "hardware/pll.h"
 #include "hardware/rtc.h"
 #include "hardware/structs/clocks.h"
+#include "hardware/structs/systick.h"
+#include "hardware/structs/xip_ctrl.h"
 #include "pico/audio_i2s.h"
 #include "pico/multicore.h"
 #include "pico/stdlib.h"
@@ -52,11 +54,14 @@
 #include "hw_config.h"
 #include "my_debug.h"
 #include "sd_card.h"
+#include "SDIO/rp2040_sdio.h"
 //
 #include "pcg_basic.h"
 //
 #include "memusage.h"
 //
+#include "ramfunc.h"
+//
 #include "fixedpoint.h"
 #include "utils.h"
 #include "volume.h"
@@ -67,27 +72,38 @@
 #include "fuzz.h"
 #include "saturation.h"
 #include "shaper.h"
+#include "shaperchain.h"
 //
 #include "array_resample.h"
+#include "render.h"
 #include "audio_pool.h"
+#include "profiler.h"
 #ifdef INCLUDE_BASS
 #include "bass.h"
 #endif
 #ifdef INCLUDE_RGBLED
 #include "WS2812.h"
 #endif
+#include "fxpool.h"
+#include "smooth.h"
 #include "beatrepeat.h"
 #include "buttonmatrix3.h"
 #include "charlieplex.h"
 #include "clock_input.h"
 #include "debounce.h"
 #include "delay.h"
-#include "envelope2_fp.h"
-#include "envelope_linear_integer.h"
+#include "reverb.h"
+#include "timestretch.h"
+#include "modulation.h"
+#include "envelopetable.h"
 #include "file_list.h"
 #include "filterexp.h"
 #include "gate.h"
-#include "messagesync.h"
+#include "commandqueue.h"
+#include "transport.h"
+#include "governor.h"
+#include "clockgovernor.h"
+#include "logring.h"
 #include "sequencehandler.h"
 #ifdef INCLUDE_ZEPTOCORE
 #include "debounce_digits.h"
@@ -95,7 +111,7 @@
 #include "leds2.h"
 #include "ledtext.h"
 #endif
-#include "noise.h"
+#include "lfnoise.h"
 #include "random.h"
 #include "resonantfilter.h"
 #include "sdcard.h"
@@ -105,6 +121,7 @@
 #include "wav.h"
 //
 #include "savefile.h"
+#include "flightrecorder.h"
 //
 #include "globals.h"
 //
@@ -26,5 +26,18 @@ void run_keyboard() {
   int c = getchar_timeout_us(100);
   if (c >= 0) {
     printf("Got character %c\n", c);
+    if (c == 'q') {
+      // latency of the core0 -> audio core command queue
+      CommandQueue_printStats(commandqueue);
+    }
+#ifdef INCLUDE_PROFILER
+    if (c == 'p') {
+      // dump the audio profiler
+      Profiler_request(profiler, false);
+    } else if (c == 'P') {
+      // dump and reset the audio profiler
+      Profiler_request(profiler, true);
+    }
+#endif
   }
 }
\ No newline at end of file
@@ -0,0 +1,167 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_LFNOISE_H_
+#define LIB_LFNOISE_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "pcg_basic.h"
+#include "ramfunc.h"
+
+// LFNoise fills blocks with noise in q15 (-32768 to 32767) from a pcg32
+// generator, without floats. step noise holds each draw for a period (like
+// LFNoise0) and glide noise curves through the midpoints between draws (like
+// LFNoise2, which may overshoot a little). a generator is for one kind of
+// noise, as they share state.
+//
+// the same seed always gives the same noise, and a loop reseeds after a
+// number of draws so that a short pattern repeats.
+
+#define LFNOISE_STREAM 54u
+// the glide squares the period, this keeps that well inside 64 bits
+#define LFNOISE_PERIOD_MAX 1048576
+
+typedef struct LFNoise {
+  pcg32_random_t rng;
+  uint64_t seed;
+  // samples between draws, and left until the next one
+  uint32_t period;
+  uint32_t counter;
+  // draws before reseeding (0 never), and draws since the seed
+  uint16_t loop;
+  uint16_t draws;
+  // the step noise holds value. the glide keeps the last draw and moves
+  // level by slope, and slope by curve, to the midpoint of the last two
+  // draws (q15 << 32)
+  int32_t value;
+  int32_t next_value;
+  int64_t next_midpt;
+  int64_t level;
+  int64_t slope;
+  int64_t curve;
+} LFNoise;
+
+// restarts the noise from seed
+void LFNoise_seed(LFNoise *self, uint64_t seed) {
+  self->seed = seed;
+  pcg32_srandom_r(&self->rng, seed, LFNOISE_STREAM);
+  self->draws = 0;
+  self->counter = 0;
+  self->value = 0;
+  self->next_value = 0;
+  self->next_midpt = 0;
+  self->level = 0;
+  self->slope = 0;
+  self->curve = 0;
+}
+
+void LFNoise_setPeriod(LFNoise *self, uint32_t period) {
+  if (period < 1) {
+    period = 1;
+  } else if (period > LFNOISE_PERIOD_MAX) {
+    period = LFNOISE_PERIOD_MAX;
+  }
+  self->period = period;
+}
+
+void LFNoise_setLoop(LFNoise *self, uint16_t draws) { self->loop = draws; }
+
+// period in samples, the step and glide noise draw once a period
+LFNoise *LFNoise_malloc(uint64_t seed, uint32_t period) {
+  LFNoise *self = (LFNoise *)malloc(sizeof(LFNoise));
+  self->loop = 0;
+  LFNoise_setPeriod(self, period);
+  LFNoise_seed(self, seed);
+  return self;
+}
+
+void LFNoise_free(LFNoise *self) { free(self); }
+
+// the next 32 random bits
+static inline uint32_t LFNoise_next(LFNoise *self) {
+  if (self->loop > 0 && self->draws == self->loop) {
+    pcg32_srandom_r(&self->rng, self->seed, LFNOISE_STREAM);
+    self->draws = 0;
+  }
+  self->draws++;
+  return pcg32_random_r(&self->rng);
+}
+
+// one draw (q15)
+int32_t LFNoise_draw(LFNoise *self) {
+  return (int16_t)(LFNoise_next(self) >> 16);
+}
+
+// fills out with n samples of noise that holds each draw for the period
+void RAM_FUNC(LFNoise_step)(LFNoise *self, int32_t *out, uint16_t n) {
+  uint16_t i = 0;
+  while (i < n) {
+    if (self->counter == 0) {
+      self->counter = self->period;
+      self->value = LFNoise_draw(self);
+    }
+    uint32_t left = n - i;
+    uint32_t run = left < self->counter ? left : self->counter;
+    self->counter -= run;
+    for (uint32_t j = 0; j < run; j++) {
+      out[i++] = self->value;
+    }
+  }
+}
+
+// fills out with n samples of noise that glides from draw to draw
+void RAM_FUNC(LFNoise_glide)(LFNoise *self, int32_t *out, uint16_t n) {
+  uint16_t i = 0;
+  while (i < n) {
+    if (self->counter == 0) {
+      // a segment from the midpoint reached to the next one, the curve
+      // chosen so it arrives there over the period
+      int32_t value = self->next_value;
+      self->next_value = LFNoise_draw(self);
+      self->level = self->next_midpt;
+      self->next_midpt = (int64_t)(self->next_value + value) << 31;
+      self->counter = self->period;
+      int64_t len = self->period;
+      self->curve = 2 * (self->next_midpt - self->level - len * self->slope) /
+                    (len * len + len);
+    }
+    uint32_t left = n - i;
+    uint32_t run = left < self->counter ? left : self->counter;
+    self->counter -= run;
+    int64_t level = self->level;
+    int64_t slope = self->slope;
+    const int64_t curve = self->curve;
+    for (uint32_t j = 0; j < run; j++) {
+      slope += curve;
+      level += slope;
+      out[i++] = (int32_t)(level >> 32);
+    }
+    self->level = level;
+    self->slope = slope;
+  }
+}
+
+#endif
@@ -0,0 +1,212 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_LOGRING_H_
+#define LIB_LOGRING_H_
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// LogRing carries log messages from either core to core0 without formatting
+// them on the way in. LogRing_printf only stores the format string pointer and
+// the raw arguments in a fixed-size record, core0 does the printf when it
+// drains the ring with LogRing_print.
+//
+// there is one ring per core so the cores never share a write index, and
+// writers on the same core (main loop and interrupts) are kept apart by
+// disabling interrupts for the few instructions it takes to fill a record. a
+// full ring drops the record and counts it, and the count is printed by
+// LogRing_print.
+//
+// the format string must outlive the record (a literal), as must any %s
+// argument. at most LOGRING_ARGS arguments are kept; integers are stored as
+// 32 bits and floats as float, there is no 64-bit integer support.
+
+#define LOGRING_SIZE 32  // power of two
+#define LOGRING_MASK (LOGRING_SIZE - 1)
+#define LOGRING_ARGS 6
+#define LOGRING_CORES 2
+
+typedef struct LogRecord {
+  const char *fmt;
+  // pointer sized so %s works on the host too
+  uintptr_t args[LOGRING_ARGS];
+  uint8_t nargs;
+  // bit n is set when args[n] is a float
+  uint8_t floats;
+} LogRecord;
+
+typedef struct LogRingQueue {
+  LogRecord records[LOGRING_SIZE];
+  // write is only changed by the producing core, read only by core0
+  volatile uint16_t write;
+  volatile uint16_t read;
+  volatile uint32_t dropped;
+  uint32_t dropped_reported;
+} LogRingQueue;
+
+typedef struct LogRing {
+  LogRingQueue queues[LOGRING_CORES];
+} LogRing;
+
+LogRing *LogRing_malloc() {
+  LogRing *self = (LogRing *)malloc(sizeof(LogRing));
+  for (uint8_t i = 0; i < LOGRING_CORES; i++) {
+    self->queues[i].write = 0;
+    self->queues[i].read = 0;
+    self->queues[i].dropped = 0;
+    self->queues[i].dropped_reported = 0;
+  }
+  return self;
+}
+
+void LogRing_free(LogRing *self) { free(self); }
+
+static inline bool LogRing_isFloat(char c) {
+  return c == 'f' || c == 'F' || c == 'e' || c == 'E' || c == 'g' || c == 'G';
+}
+
+static inline bool LogRing_isConversion(char c) {
+  return LogRing_isFloat(c) || c == 'd' || c == 'i' || c == 'u' || c == 'x' ||
+         c == 'X' || c == 'o' || c == 'c' || c == 's' || c == 'p';
+}
+
+// safe to call from either core and from interrupts
+void LogRing_printf(LogRing *self, const char *fmt, ...) {
+  LogRingQueue *q = &self->queues[get_core_num()];
+  uint32_t irq = save_and_disable_interrupts();
+  uint16_t w = q->write;
+  if ((uint16_t)(w - q->read) >= LOGRING_SIZE) {
+    q->dropped++;
+    restore_interrupts(irq);
+    return;
+  }
+  LogRecord *r = &q->records[w & LOGRING_MASK];
+  r->fmt = fmt;
+  r->nargs = 0;
+  r->floats = 0;
+  // only the conversion letters are looked at, to know how to fetch each
+  // argument
+  va_list args;
+  va_start(args, fmt);
+  for (const char *c = fmt; *c != '\0' && r->nargs < LOGRING_ARGS; c++) {
+    if (*c != '%') {
+      continue;
+    }
+    c++;
+    while (*c != '\0' && *c != '%' && !LogRing_isConversion(*c)) {
+      c++;
+    }
+    if (*c == '\0') {
+      break;
+    }
+    if (*c == '%') {
+      continue;
+    }
+    if (LogRing_isFloat(*c)) {
+      float v = va_arg(args, double);
+      memcpy(&r->args[r->nargs], &v, sizeof(float));
+      r->floats |= 1 << r->nargs;
+    } else if (*c == 's' || *c == 'p') {
+      r->args[r->nargs] = (uintptr_t)va_arg(args, void *);
+    } else {
+      r->args[r->nargs] = va_arg(args, uint32_t);
+    }
+    r->nargs++;
+  }
+  va_end(args);
+  __dmb();
+  q->write = w + 1;
+  restore_interrupts(irq);
+}
+
+// prints one record, one conversion at a time. length modifiers are dropped
+// since every integer argument was stored as 32 bits.
+void LogRing_format(LogRecord *r) {
+  char spec[16];
+  uint8_t n = 0;
+  const char *c = r->fmt;
+  while (*c != '\0') {
+    if (*c != '%') {
+      putchar(*c++);
+      continue;
+    }
+    if (c[1] == '%') {
+      putchar('%');
+      c += 2;
+      continue;
+    }
+    uint8_t len = 0;
+    spec[len++] = *c++;
+    while (*c != '\0' && !LogRing_isConversion(*c)) {
+      if (*c != 'l' && *c != 'h' && *c != 'z' && *c != 'j' && *c != 't' &&
+          len < sizeof(spec) - 2) {
+        spec[len++] = *c;
+      }
+      c++;
+    }
+    if (*c == '\0') {
+      break;
+    }
+    spec[len++] = *c;
+    spec[len] = '\0';
+    if (n < r->nargs) {
+      if (r->floats & (1 << n)) {
+        float v;
+        memcpy(&v, &r->args[n], sizeof(float));
+        printf(spec, v);
+      } else if (*c == 's' || *c == 'p') {
+        printf(spec, (void *)(uintptr_t)r->args[n]);
+      } else {
+        printf(spec, (uint32_t)r->args[n]);
+      }
+    }
+    n++;
+    c++;
+  }
+}
+
+// called from core0, drains every core's ring
+void LogRing_print(LogRing *self) {
+  for (uint8_t i = 0; i < LOGRING_CORES; i++) {
+    LogRingQueue *q = &self->queues[i];
+    while (q->read != q->write) {
+      __dmb();
+      LogRing_format(&q->records[q->read & LOGRING_MASK]);
+      __dmb();
+      q->read++;
+    }
+    uint32_t dropped = q->dropped;
+    if (dropped != q->dropped_reported) {
+      printf("[logring] core%d dropped %lu messages\n", i,
+             (unsigned long)(dropped - q->dropped_reported));
+      q->dropped_reported = dropped;
+    }
+  }
+}
+
+#endif
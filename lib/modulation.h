@@ -0,0 +1,389 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_MODULATION_H_
+#define LIB_MODULATION_H_
+
+#include <math.h>
+
+#include "fixedpoint.h"
+#include "lfnoise.h"
+#include "ramfunc.h"
+#include "transport.h"
+//
+#include "stdbool.h"
+
+// Modulation runs the lfos, a random source and an envelope in the audio
+// domain and routes them to the cutoff, pitch, pan and volume. the sources
+// are read every MOD_CONTROL_SAMPLES samples and summed into each
+// destination by the route depths; volume and pan ramp linearly between
+// those control points on every sample, for an add and a multiply per
+// channel. the filter takes the cutoff once per control point, as its
+// coefficients come from a table, and the pitch once per block, as that is
+// how the samples are read.
+//
+// lfo periods are in transport ticks (TRANSPORT_TICKS a half beat), so they
+// follow the tempo. the lfos read a wavetable with interpolation, the sample
+// and hold and the noise run their own step and glide noise over the period.
+
+#define MOD_CONTROL_SAMPLES 32
+#define MOD_TABLE_BITS 8
+#define MOD_TABLE_SIZE (1 << MOD_TABLE_BITS)
+#ifndef SAMPLES_PER_BUFFER
+#define SAMPLES_PER_BUFFER 441
+#endif
+#define MOD_POINTS \
+  ((SAMPLES_PER_BUFFER + MOD_CONTROL_SAMPLES - 1) / MOD_CONTROL_SAMPLES + 1)
+#define MOD_PERIOD_MIN 1
+
+// sources
+#define MOD_LFO1 0
+#define MOD_LFO2 1
+// random, gliding between values drawn every period
+#define MOD_NOISE 2
+// set every block with Modulation_setEnvelope
+#define MOD_ENVELOPE 3
+#define MOD_SOURCES 4
+
+// destinations
+#define MOD_CUTOFF 0
+#define MOD_PITCH 1
+#define MOD_PAN 2
+#define MOD_VOLUME 3
+#define MOD_DESTINATIONS 4
+
+// lfo shapes
+#define MOD_SINE 0
+#define MOD_TRIANGLE 1
+#define MOD_SQUARE 2
+#define MOD_SAMPLE_HOLD 3
+#define MOD_SHAPES 4
+
+// full depth (q15), a route at this depth swings its destination over the
+// whole range: silence to full volume, hard left to hard right, an octave
+// either way or half the cutoff range either way
+#define MOD_DEPTH_FULL 32767
+
+// sine, triangle and square over one cycle (q15), with the first point
+// repeated at the end for the interpolation
+int16_t mod_wavetable[MOD_SAMPLE_HOLD][MOD_TABLE_SIZE + 1];
+bool mod_wavetable_ready = false;
+
+typedef struct ModSource {
+  uint32_t phase;
+  uint32_t step;
+  uint16_t period;
+  uint8_t shape;
+  // the random shapes, and where they were left
+  LFNoise *noise;
+  int32_t value;
+} ModSource;
+
+typedef struct Modulation {
+  ModSource source[MOD_ENVELOPE];
+  uint16_t bpm;
+  // the envelope at the end of this block and the last
+  int32_t envelope;
+  int32_t envelope_last;
+  // q15, by source and destination
+  int16_t depth[MOD_SOURCES][MOD_DESTINATIONS];
+  // a bit for each destination with a route
+  uint8_t active;
+  // the destinations at the control points of the block: volume as a gain
+  // (q16, 0 to 1), pan (q16, -1 left to 1 right), pitch and cutoff (q15).
+  // point 0 is the last point of the block before
+  int32_t point[MOD_DESTINATIONS][MOD_POINTS];
+  uint8_t points;
+} Modulation;
+
+static void Modulation_tables() {
+  if (mod_wavetable_ready) {
+    return;
+  }
+  for (uint16_t i = 0; i <= MOD_TABLE_SIZE; i++) {
+    uint16_t j = i % MOD_TABLE_SIZE;
+    mod_wavetable[MOD_SINE][i] =
+        (int16_t)roundf(32767 * sinf(2 * 3.14159265f * j / MOD_TABLE_SIZE));
+    // -1 at the start of the cycle, 1 half way
+    int32_t tri = j < MOD_TABLE_SIZE / 2
+                      ? -32767 + j * 65534 / (MOD_TABLE_SIZE / 2)
+                      : 32767 - (j - MOD_TABLE_SIZE / 2) * 65534 /
+                                    (MOD_TABLE_SIZE / 2);
+    mod_wavetable[MOD_TRIANGLE][i] = (int16_t)tri;
+    mod_wavetable[MOD_SQUARE][i] = j < MOD_TABLE_SIZE / 2 ? 32767 : -32767;
+  }
+  mod_wavetable_ready = true;
+}
+
+Modulation *Modulation_malloc(uint32_t seed) {
+  Modulation_tables();
+  Modulation *self = (Modulation *)malloc(sizeof(Modulation));
+  self->bpm = 0;
+  for (uint8_t s = 0; s < MOD_ENVELOPE; s++) {
+    self->source[s].phase = 0;
+    self->source[s].step = 0;
+    self->source[s].period = TRANSPORT_TICKS;
+    self->source[s].shape = MOD_SINE;
+    self->source[s].noise = LFNoise_malloc(seed + s, SAMPLES_PER_BUFFER);
+    self->source[s].value = 0;
+  }
+  self->envelope = 0;
+  self->envelope_last = 0;
+  for (uint8_t s = 0; s < MOD_SOURCES; s++) {
+    for (uint8_t d = 0; d < MOD_DESTINATIONS; d++) {
+      self->depth[s][d] = 0;
+    }
+  }
+  self->active = 0;
+  for (uint8_t d = 0; d < MOD_DESTINATIONS; d++) {
+    self->point[d][0] = d == MOD_VOLUME ? Q16_16_1 : 0;
+  }
+  self->points = 1;
+  return self;
+}
+
+void Modulation_free(Modulation *self) {
+  for (uint8_t s = 0; s < MOD_ENVELOPE; s++) {
+    LFNoise_free(self->source[s].noise);
+  }
+  free(self);
+}
+
+// period in transport ticks; lfos take any shape, the noise only glides
+void Modulation_setLfo(Modulation *self, uint8_t source, uint16_t period,
+                       uint8_t shape) {
+  if (source >= MOD_ENVELOPE) {
+    return;
+  }
+  if (period < MOD_PERIOD_MIN) {
+    period = MOD_PERIOD_MIN;
+  }
+  if (self->source[source].period != period) {
+    self->source[source].period = period;
+    // recomputed with the tempo
+    self->bpm = 0;
+  }
+  if (source != MOD_NOISE && shape < MOD_SHAPES) {
+    self->source[source].shape = shape;
+  }
+}
+
+// the envelope source (q15) reached by the end of the block
+void Modulation_setEnvelope(Modulation *self, int32_t value) {
+  self->envelope = value;
+}
+
+// routes source to destination at depth (q15, may be negative), 0 removes
+// the route
+void Modulation_route(Modulation *self, uint8_t source, uint8_t destination,
+                      int16_t depth) {
+  if (source >= MOD_SOURCES || destination >= MOD_DESTINATIONS) {
+    return;
+  }
+  self->depth[source][destination] = depth;
+  bool any = false;
+  for (uint8_t s = 0; s < MOD_SOURCES; s++) {
+    any = any || self->depth[s][destination] != 0;
+  }
+  if (any) {
+    self->active |= 1 << destination;
+  } else {
+    self->active &= ~(1 << destination);
+  }
+}
+
+bool Modulation_active(Modulation *self, uint8_t destination) {
+  return (self->active >> destination) & 1;
+}
+
+// moves a source on by samples (up to MOD_CONTROL_SAMPLES) and returns its
+// value (q15)
+static int32_t RAM_FUNC(Modulation_source)(Modulation *self, uint8_t source,
+                                           uint16_t samples) {
+  ModSource *s = &self->source[source];
+  if (source == MOD_NOISE || s->shape == MOD_SAMPLE_HOLD) {
+    if (samples > 0) {
+      int32_t block[MOD_CONTROL_SAMPLES];
+      if (source == MOD_NOISE) {
+        LFNoise_glide(s->noise, block, samples);
+      } else {
+        LFNoise_step(s->noise, block, samples);
+      }
+      s->value = block[samples - 1];
+    }
+    return s->value;
+  }
+  uint32_t phase = s->phase + s->step * samples;
+  s->phase = phase;
+  const int16_t *table = mod_wavetable[s->shape];
+  uint32_t i = phase >> (32 - MOD_TABLE_BITS);
+  int32_t frac = (phase >> (17 - MOD_TABLE_BITS)) & 0x7FFF;
+  return table[i] + (((table[i + 1] - table[i]) * frac) >> 15);
+}
+
+// runs the sources over a block of n samples and fills the control points
+void RAM_FUNC(Modulation_beginBlock)(Modulation *self, uint16_t n,
+                                     uint16_t bpm) {
+  if (bpm != self->bpm) {
+    // a period of p ticks lasts p * 30 * 44100 / (bpm * ticks) samples
+    self->bpm = bpm;
+    for (uint8_t s = 0; s < MOD_ENVELOPE; s++) {
+      uint64_t ticks = (uint64_t)self->source[s].period * 30 * 44100;
+      self->source[s].step =
+          (uint32_t)(((uint64_t)bpm * TRANSPORT_TICKS << 32) / ticks);
+      // and the random shapes draw once a period
+      uint64_t period = bpm > 0 ? ticks / ((uint32_t)bpm * TRANSPORT_TICKS)
+                                : LFNOISE_PERIOD_MAX;
+      LFNoise_setPeriod(self->source[s].noise,
+                        period < LFNOISE_PERIOD_MAX ? period
+                                                    : LFNOISE_PERIOD_MAX);
+    }
+  }
+  for (uint8_t d = 0; d < MOD_DESTINATIONS; d++) {
+    self->point[d][0] = self->point[d][self->points - 1];
+  }
+  self->points = 1;
+  int32_t value[MOD_SOURCES];
+  for (uint16_t done = 0; done < n;) {
+    uint16_t samples = n - done < MOD_CONTROL_SAMPLES ? n - done
+                                                       : MOD_CONTROL_SAMPLES;
+    done += samples;
+    for (uint8_t s = 0; s < MOD_ENVELOPE; s++) {
+      value[s] = Modulation_source(self, s, samples);
+    }
+    value[MOD_ENVELOPE] =
+        self->envelope_last +
+        (self->envelope - self->envelope_last) * done / n;
+    for (uint8_t d = 0; d < MOD_DESTINATIONS; d++) {
+      if (!Modulation_active(self, d)) {
+        self->point[d][self->points] = self->point[d][0];
+        continue;
+      }
+      int32_t sum = 0;
+      for (uint8_t s = 0; s < MOD_SOURCES; s++) {
+        if (d == MOD_VOLUME) {
+          // down from full volume, a full swing reaches silence
+          sum += (self->depth[s][d] * ((value[s] - 32767) >> 1)) >> 15;
+        } else {
+          sum += (self->depth[s][d] * value[s]) >> 15;
+        }
+      }
+      if (sum > 32767) {
+        sum = 32767;
+      } else if (sum < -32767) {
+        sum = -32767;
+      }
+      if (d == MOD_VOLUME) {
+        sum = sum < 0 ? Q16_16_1 + sum * 2 : Q16_16_1;
+      } else if (d == MOD_PAN) {
+        sum *= 2;
+      }
+      self->point[d][self->points] = sum;
+    }
+    self->points++;
+  }
+  self->envelope_last = self->envelope;
+  // without a route the destinations rest
+  if (!Modulation_active(self, MOD_VOLUME)) {
+    for (uint8_t k = 0; k < self->points; k++) {
+      self->point[MOD_VOLUME][k] = Q16_16_1;
+    }
+  }
+  if (!Modulation_active(self, MOD_PAN)) {
+    for (uint8_t k = 0; k < self->points; k++) {
+      self->point[MOD_PAN][k] = 0;
+    }
+  }
+}
+
+// the pitch for this block as a speed, an octave either way at full depth
+float Modulation_pitch(Modulation *self) {
+  if (!Modulation_active(self, MOD_PITCH)) {
+    return 1.0f;
+  }
+  return exp2f((float)self->point[MOD_PITCH][0] / 32768.0f);
+}
+
+// the cutoff index for control point k, moved from base by up to half of
+// max either way
+uint8_t Modulation_cutoff(Modulation *self, uint8_t k, int32_t base,
+                          int32_t max) {
+  int32_t fc = base + ((self->point[MOD_CUTOFF][k] * max) >> 16);
+  if (fc < 0) {
+    fc = 0;
+  } else if (fc > max) {
+    fc = max;
+  }
+  return fc;
+}
+
+// the left and right gains (q16) at control point k
+static inline void Modulation_gains(Modulation *self, uint8_t k, int32_t *left,
+                                    int32_t *right) {
+  int32_t volume = self->point[MOD_VOLUME][k];
+  if (!Modulation_active(self, MOD_PAN)) {
+    *left = volume;
+    *right = volume;
+    return;
+  }
+  int32_t pan = self->point[MOD_PAN][k];
+  *left = (int32_t)(((int64_t)volume * (Q16_16_1 - pan)) >> 17);
+  *right = (int32_t)(((int64_t)volume * (Q16_16_1 + pan)) >> 17);
+}
+
+// applies the volume and the pan to n stereo samples, ramping the gains
+// between the control points
+void RAM_FUNC(Modulation_process)(Modulation *self, int32_t *samples,
+                                  uint16_t n) {
+  if (!Modulation_active(self, MOD_VOLUME) &&
+      !Modulation_active(self, MOD_PAN)) {
+    return;
+  }
+  // the ramps run with 8 more bits, so the steps of a segment add up to
+  // where it ends
+  int32_t left, right, left_end, right_end;
+  Modulation_gains(self, 0, &left, &right);
+  left <<= 8;
+  right <<= 8;
+  uint16_t i = 0;
+  for (uint8_t k = 1; k < self->points && i < n; k++) {
+    uint16_t end = i + MOD_CONTROL_SAMPLES < n ? i + MOD_CONTROL_SAMPLES : n;
+    int32_t len = end - i;
+    Modulation_gains(self, k, &left_end, &right_end);
+    left_end <<= 8;
+    right_end <<= 8;
+    int32_t left_step = (left_end - left) / len;
+    int32_t right_step = (right_end - right) / len;
+    for (; i < end; i++) {
+      samples[i * 2 + 0] = (samples[i * 2 + 0] >> 16) * (left >> 8);
+      samples[i * 2 + 1] = (samples[i * 2 + 1] >> 16) * (right >> 8);
+      left += left_step;
+      right += right_step;
+    }
+    left = left_end;
+    right = right_end;
+  }
+}
+
+#endif
@@ -47,6 +47,8 @@ static const audio_format_t *_i2s_output_audio_format;
 struct {
   audio_buffer_t *playing_buffer;
   uint32_t freq;
+  uint8_t bits;
+  uint8_t channel_count;
   uint8_t pio_sm;
   uint8_t dma_channel;
 } shared_state;
@@ -284,6 +286,15 @@ static void update_pio_frequency(uint32_t sample_freq,
 #endif
 
   shared_state.freq = sample_freq;
+  shared_state.bits = bits;
+  shared_state.channel_count = channel_count;
+}
+
+void audio_i2s_update_clock() {
+  // same divider as update_pio_frequency, without the printing
+  uint32_t divider = clock_get_hz(clk_sys) * (32 / shared_state.bits) *
+                     shared_state.channel_count / shared_state.freq;
+  pio_sm_set_clkdiv(audio_pio, shared_state.pio_sm, divider >> 8u);
 }
 
 static audio_buffer_t *wrap_consumer_take(audio_connection_t *connection,
@@ -179,6 +179,11 @@ bool audio_i2s_connect_extra(audio_buffer_pool_t *producer, bool buffer_on_give,
  */
 void audio_i2s_set_enabled(bool enabled);
 
+/** \brief Re-derive the I2S PIO clock divider after clk_sys changed
+ * \ingroup pico_audio_i2s
+ */
+void audio_i2s_update_clock();
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,279 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_PROFILER_H_
+#define LIB_PROFILER_H_
+
+// Profiler times each stage of the audio callback with the SysTick counter of
+// the core running the callback (24-bit, counting down at clk_sys). every
+// PROFILER_MARK attributes the cycles since the previous mark to a stage, the
+// per-block totals are folded into min/avg/max and a log2 histogram at the end
+// of the block.
+//
+// core0 asks for a dump with Profiler_request, the audio core copies the stats
+// into a snapshot at the end of its next block and core0 prints that, so the
+// printout is never torn. the profiler times its own marks and bookkeeping
+// (PROFILER_SELF) to report its overhead.
+//
+// with PROFILER_COLD_CACHE every block starts from an empty flash cache,
+// which is the worst case for code and tables that live in flash.
+
+#define PROFILER_TAKE_BUFFER 0
+#define PROFILER_SD_SEEK 1
+#define PROFILER_SD_READ 2
+#define PROFILER_FX 3
+#define PROFILER_RESAMPLE 4
+#define PROFILER_FILTER 5
+#define PROFILER_LFO 6
+// delay and reverb
+#define PROFILER_DELAY 7
+#define PROFILER_GIVE_BUFFER 8
+#define PROFILER_OTHER 9
+#define PROFILER_TOTAL 10
+#define PROFILER_SELF 11
+#define PROFILER_STAGES 12
+#define PROFILER_HISTOGRAM_BINS 24
+#define PROFILER_SYSTICK_MASK 0xFFFFFF
+
+const char *profiler_stage_names[PROFILER_STAGES] = {
+    "take buffer", "sd seek",  "sd read", "fx",    "resample", "filter",
+    "lfo",         "delay",    "give",    "other", "total",    "self",
+};
+
+typedef struct ProfilerStage {
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint64_t sum;
+  // bin n counts blocks that took [2^n, 2^(n+1)) cycles
+  uint32_t histogram[PROFILER_HISTOGRAM_BINS];
+} ProfilerStage;
+
+typedef struct Profiler {
+  ProfilerStage stages[PROFILER_STAGES];
+  ProfilerStage snapshot[PROFILER_STAGES];
+  // cycles for the block in progress
+  uint32_t block[PROFILER_STAGES];
+  uint16_t block_hit;
+  uint16_t block_marks;
+  uint32_t block_start;
+  uint32_t last;
+  // cycles taken by one mark, measured at startup
+  uint32_t mark_cycles;
+  bool started;
+  // set by core0, cleared by the audio core once the snapshot is taken
+  volatile bool dump_requested;
+  volatile bool reset_requested;
+  volatile bool snapshot_ready;
+} Profiler;
+
+static inline uint32_t Profiler_now() { return systick_hw->cvr; }
+
+// SysTick counts down
+static inline uint32_t Profiler_elapsed(uint32_t from, uint32_t to) {
+  return (from - to) & PROFILER_SYSTICK_MASK;
+}
+
+void Profiler_resetStats(Profiler *self) {
+  for (uint8_t i = 0; i < PROFILER_STAGES; i++) {
+    ProfilerStage *s = &self->stages[i];
+    s->count = 0;
+    s->min = 0xFFFFFFFF;
+    s->max = 0;
+    s->sum = 0;
+    for (uint8_t j = 0; j < PROFILER_HISTOGRAM_BINS; j++) {
+      s->histogram[j] = 0;
+    }
+  }
+}
+
+Profiler *Profiler_malloc() {
+  Profiler *self = (Profiler *)malloc(sizeof(Profiler));
+  Profiler_resetStats(self);
+  self->block_hit = 0;
+  self->block_marks = 0;
+  self->block_start = 0;
+  self->last = 0;
+  self->mark_cycles = 0;
+  self->started = false;
+  self->dump_requested = false;
+  self->reset_requested = false;
+  self->snapshot_ready = false;
+  return self;
+}
+
+void Profiler_free(Profiler *self) { free(self); }
+
+static inline void Profiler_mark(Profiler *self, uint8_t stage) {
+  uint32_t now = Profiler_now();
+  self->block[stage] += Profiler_elapsed(self->last, now);
+  self->block_hit |= 1 << stage;
+  self->block_marks++;
+  self->last = now;
+}
+
+// SysTick is per core, so this has to run on the audio core
+void Profiler_start(Profiler *self) {
+  systick_hw->rvr = PROFILER_SYSTICK_MASK;
+  systick_hw->cvr = 0;
+  // enable, clocked from the processor clock, no interrupt
+  systick_hw->csr = 0x5;
+  // time a batch of marks to know what each one costs
+  for (uint8_t i = 0; i < PROFILER_STAGES; i++) {
+    self->block[i] = 0;
+  }
+  uint32_t t0 = Profiler_now();
+  self->last = t0;
+  for (uint8_t i = 0; i < 64; i++) {
+    Profiler_mark(self, PROFILER_SELF);
+  }
+  self->mark_cycles = Profiler_elapsed(t0, Profiler_now()) / 64;
+  self->started = true;
+}
+
+void Profiler_blockStart(Profiler *self) {
+  if (!self->started) {
+    Profiler_start(self);
+  }
+  for (uint8_t i = 0; i < PROFILER_STAGES; i++) {
+    self->block[i] = 0;
+  }
+  self->block_hit = 0;
+  self->block_marks = 0;
+#ifdef PROFILER_COLD_CACHE
+  // writing flush empties the xip cache, reading it back waits until done
+  xip_ctrl_hw->flush = 1;
+  (void)xip_ctrl_hw->flush;
+#endif
+  self->block_start = Profiler_now();
+  self->last = self->block_start;
+}
+
+static inline void Profiler_add(ProfilerStage *s, uint32_t cycles) {
+  s->count++;
+  s->sum += cycles;
+  if (cycles < s->min) {
+    s->min = cycles;
+  }
+  if (cycles > s->max) {
+    s->max = cycles;
+  }
+  uint8_t bin = cycles == 0 ? 0 : 31 - __builtin_clz(cycles);
+  if (bin >= PROFILER_HISTOGRAM_BINS) {
+    bin = PROFILER_HISTOGRAM_BINS - 1;
+  }
+  s->histogram[bin]++;
+}
+
+void Profiler_blockEnd(Profiler *self) {
+  uint32_t t0 = Profiler_now();
+  self->block[PROFILER_OTHER] += Profiler_elapsed(self->last, t0);
+  self->block_hit |= 1 << PROFILER_OTHER;
+  if (self->reset_requested) {
+    Profiler_resetStats(self);
+    self->reset_requested = false;
+  }
+  for (uint8_t i = 0; i < PROFILER_TOTAL; i++) {
+    if (self->block_hit & (1 << i)) {
+      Profiler_add(&self->stages[i], self->block[i]);
+    }
+  }
+  Profiler_add(&self->stages[PROFILER_TOTAL],
+               Profiler_elapsed(self->block_start, t0));
+  if (self->dump_requested) {
+    memcpy(self->snapshot, self->stages, sizeof(self->stages));
+    self->dump_requested = false;
+    self->snapshot_ready = true;
+  }
+  // the marks themselves plus this bookkeeping
+  Profiler_add(&self->stages[PROFILER_SELF],
+               self->block_marks * self->mark_cycles +
+                   Profiler_elapsed(t0, Profiler_now()));
+}
+
+// called from core0
+void Profiler_request(Profiler *self, bool reset) {
+  self->reset_requested = reset;
+  self->dump_requested = true;
+}
+
+void Profiler_print(Profiler *self) {
+  uint32_t mhz = clock_get_hz(clk_sys) / 1000000;
+  printf("[profiler] %lu cycles/mark, %lu MHz\n",
+         (unsigned long)self->mark_cycles, (unsigned long)mhz);
+  printf("%-12s %8s %9s %9s %9s %8s\n", "stage", "blocks", "min", "avg",
+         "max", "avg us");
+  for (uint8_t i = 0; i < PROFILER_STAGES; i++) {
+    ProfilerStage *s = &self->snapshot[i];
+    if (s->count == 0) {
+      continue;
+    }
+    uint32_t avg = s->sum / s->count;
+    printf("%-12s %8lu %9lu %9lu %9lu %8lu\n", profiler_stage_names[i],
+           (unsigned long)s->count, (unsigned long)s->min,
+           (unsigned long)avg, (unsigned long)s->max,
+           (unsigned long)(avg / mhz));
+  }
+  for (uint8_t i = 0; i < PROFILER_STAGES; i++) {
+    ProfilerStage *s = &self->snapshot[i];
+    if (s->count == 0) {
+      continue;
+    }
+    printf("%-12s", profiler_stage_names[i]);
+    for (uint8_t j = 0; j < PROFILER_HISTOGRAM_BINS; j++) {
+      if (s->histogram[j] > 0) {
+        printf(" 2^%d:%lu", j, (unsigned long)s->histogram[j]);
+      }
+    }
+    printf("\n");
+  }
+  ProfilerStage *total = &self->snapshot[PROFILER_TOTAL];
+  ProfilerStage *overhead = &self->snapshot[PROFILER_SELF];
+  if (total->sum > 0 && overhead->count > 0) {
+    printf("[profiler] overhead %2.3f%% of callback, %2.3f%% of block\n",
+           100.0 * (float)overhead->sum / (float)total->sum,
+           100.0 * (float)(overhead->sum / overhead->count) /
+               ((float)mhz * (US_PER_BLOCK)));
+  }
+}
+
+// called from core0, prints a snapshot once the audio core has taken it
+void Profiler_poll(Profiler *self) {
+  if (self->snapshot_ready) {
+    Profiler_print(self);
+    self->snapshot_ready = false;
+  }
+}
+
+#ifdef INCLUDE_PROFILER
+#define PROFILER_BLOCK_START() Profiler_blockStart(profiler)
+#define PROFILER_MARK(stage) Profiler_mark(profiler, stage)
+#define PROFILER_BLOCK_END() Profiler_blockEnd(profiler)
+#else
+#define PROFILER_BLOCK_START()
+#define PROFILER_MARK(stage)
+#define PROFILER_BLOCK_END()
+#endif
+
+#endif
@@ -21,21 +21,23 @@
 // THE SOFTWARE.
 //
 // See http://creativecommons.org/licenses/MIT/ for more information.
-#include "../../messagesync.h"
 
-int main() {
-  MessageSync *ms = MessageSync_malloc();
-  MessageSync_append(ms, "Hello, World!\n");
-  MessageSync_append(ms, "Hello, again!\n");
-  MessageSync_print(ms);
-  MessageSync_clear(ms);
-  MessageSync_print(ms);
-  MessageSync_printf(ms, "%d + %d = %d\n", 1, 1, 1 + 1);
-  MessageSync_printf(ms, "%d + %d = %d\n", 2, 1, 2 + 1);
-  MessageSync_printf(ms, "%d + %d = %d\n", 4, 1, 4 + 1);
-  MessageSync_printf(ms, "%d + %d = %d\n", 3, 1, 3 + 1);
-  MessageSync_print(ms);
-  MessageSync_free(ms);
+#ifndef LIB_RAMFUNC_H_
+#define LIB_RAMFUNC_H_
 
-  return 0;
-}
+// RAM_FUNC(name) marks a function on the audio hot path. with
+// INCLUDE_RAM_HOT_PATH it goes into the sdk's .time_critical sections,
+// which the linker copies to sram at boot, so the callback does not have to
+// share the 16 kB xip cache with the lookup tables. everywhere else (and in
+// the host tests) it is just the name.
+//
+// dev/ramfunc_budget.py checks the size of every function that ends up in
+// sram against a budget.
+
+#if defined(INCLUDE_RAM_HOT_PATH) && defined(__not_in_flash_func)
+#define RAM_FUNC(name) __not_in_flash_func(name)
+#else
+#define RAM_FUNC(name) name
+#endif
+
+#endif
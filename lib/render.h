@@ -0,0 +1,171 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_RENDER_H_
+#define LIB_RENDER_H_
+
+#include "ramfunc.h"
+
+// block renderer: resamples a block read from the sd card to the output
+// block size, applies the fade curve and volume, and mixes it into the
+// interleaved 32-bit output. one kernel is compiled per combination of
+// channels x interpolation x direction x fade, so nothing is tested per
+// sample. the reverse kernels read the block backwards (frame by frame, so
+// stereo channels stay put) instead of reversing it in place first.
+// oversampling only changes the number of input frames, which is absorbed
+// into the fixed-point step.
+
+typedef void (*render_fn)(int32_t *samples, const int16_t *values,
+                          uint16_t in_frames, uint16_t out_frames,
+                          const int32_t *fade, uint32_t vol);
+
+static inline __attribute__((always_inline)) void render_emit(
+    int32_t *samples, uint16_t i, uint8_t c, int32_t y, const int32_t *fade,
+    uint32_t vol, const uint8_t channels, const bool faded) {
+  if (faded) {
+    y = (y * fade[i]) >> 16;
+  }
+  // same scaling as the rest of the callback: unsigned multiply, then the
+  // int16 -> int32 scale-up
+  y = (vol * y) << 8u;
+  y += y >> 16u;
+  if (channels == 1) {
+    samples[i * 2 + 0] += y;
+    samples[i * 2 + 1] += y;
+  } else {
+    samples[i * 2 + c] += y;
+  }
+}
+
+static inline __attribute__((always_inline)) void render_kernel(
+    int32_t *samples, const int16_t *values, uint16_t in_frames,
+    uint16_t out_frames, const int32_t *fade, uint32_t vol,
+    const uint8_t channels, const bool quadratic, const bool reverse,
+    const bool faded) {
+  if (in_frames == 0 || out_frames < 2) {
+    return;
+  }
+  const int32_t last = in_frames - 1;
+  // position in Q16.16 input frames. every frame but the final one lands
+  // strictly before the last input frame, so k + 1 is in range, except
+  // with a single input frame where the neighbour is the frame itself
+  const uint32_t step = ((uint32_t)last << 16) / (out_frames - 1);
+  const int32_t next = last > 0 ? 1 : 0;
+  uint32_t pos = 0;
+  for (uint16_t i = 0; i < out_frames - 1; i++, pos += step) {
+    int32_t k = pos >> 16;
+    // Q14 fraction keeps the interpolation products in 32 bits
+    int32_t f = (pos & 0xFFFF) >> 2;
+    // input frame indices in playback order
+    int32_t k1 = reverse ? last - k : k;
+    int32_t k2 = reverse ? k1 - next : k1 + next;
+    for (uint8_t c = 0; c < channels; c++) {
+      int32_t x1 = values[k1 * channels + c];
+      int32_t x2 = values[k2 * channels + c];
+      int32_t y;
+      if (quadratic) {
+        int32_t k0 = k > 0 ? (reverse ? k1 + 1 : k1 - 1) : k1;
+        int32_t x0 = values[k0 * channels + c];
+        int32_t inner = ((x0 - 2 * x1 + x2) * f) >> 14;
+        y = x1 + ((((x2 - x0 + inner) >> 1) * f) >> 14);
+        y = util_clamp(y, -32768, 32767);
+      } else {
+        y = x1 + (((x2 - x1) * f) >> 14);
+      }
+      render_emit(samples, i, c, y, fade, vol, channels, faded);
+    }
+  }
+  // the final frame is the last input frame in playback order
+  for (uint8_t c = 0; c < channels; c++) {
+    render_emit(samples, out_frames - 1, c,
+                values[(reverse ? 0 : last) * channels + c], fade, vol,
+                channels, faded);
+  }
+}
+
+#define RENDER_VARIANT(name, channels, quadratic, reverse, faded)       \
+  void RAM_FUNC(name)(int32_t * samples, const int16_t *values,         \
+                      uint16_t in_frames, uint16_t out_frames,          \
+                      const int32_t *fade, uint32_t vol) {              \
+    render_kernel(samples, values, in_frames, out_frames, fade, vol,    \
+                  channels, quadratic, reverse, faded);                 \
+  }
+
+RENDER_VARIANT(render_mono_linear_forward, 1, false, false, false)
+RENDER_VARIANT(render_mono_linear_forward_fade, 1, false, false, true)
+RENDER_VARIANT(render_mono_linear_reverse, 1, false, true, false)
+RENDER_VARIANT(render_mono_linear_reverse_fade, 1, false, true, true)
+RENDER_VARIANT(render_mono_quadratic_forward, 1, true, false, false)
+RENDER_VARIANT(render_mono_quadratic_forward_fade, 1, true, false, true)
+RENDER_VARIANT(render_mono_quadratic_reverse, 1, true, true, false)
+RENDER_VARIANT(render_mono_quadratic_reverse_fade, 1, true, true, true)
+RENDER_VARIANT(render_stereo_linear_forward, 2, false, false, false)
+RENDER_VARIANT(render_stereo_linear_forward_fade, 2, false, false, true)
+RENDER_VARIANT(render_stereo_linear_reverse, 2, false, true, false)
+RENDER_VARIANT(render_stereo_linear_reverse_fade, 2, false, true, true)
+RENDER_VARIANT(render_stereo_quadratic_forward, 2, true, false, false)
+RENDER_VARIANT(render_stereo_quadratic_forward_fade, 2, true, false, true)
+RENDER_VARIANT(render_stereo_quadratic_reverse, 2, true, true, false)
+RENDER_VARIANT(render_stereo_quadratic_reverse_fade, 2, true, true, true)
+
+// indexed by [stereo][quadratic][reverse][faded]
+const render_fn render_table[2][2][2][2] = {
+    {{{render_mono_linear_forward, render_mono_linear_forward_fade},
+      {render_mono_linear_reverse, render_mono_linear_reverse_fade}},
+     {{render_mono_quadratic_forward, render_mono_quadratic_forward_fade},
+      {render_mono_quadratic_reverse, render_mono_quadratic_reverse_fade}}},
+    {{{render_stereo_linear_forward, render_stereo_linear_forward_fade},
+      {render_stereo_linear_reverse, render_stereo_linear_reverse_fade}},
+     {{render_stereo_quadratic_forward, render_stereo_quadratic_forward_fade},
+      {render_stereo_quadratic_reverse,
+       render_stereo_quadratic_reverse_fade}}},
+};
+
+render_fn Render_select(bool stereo, bool quadratic, bool reverse,
+                        bool faded) {
+  return render_table[stereo][quadratic][reverse][faded];
+}
+
+// fills fade[0, frames) with curve[0] up to start, then curve stretched over
+// the rest, so a fade can begin at an event inside the block
+void RAM_FUNC(Render_fade)(int32_t *fade, uint16_t frames, uint16_t start,
+                           const int32_t *curve, uint16_t curve_len) {
+  for (uint16_t i = 0; i < start; i++) {
+    fade[i] = curve[0];
+  }
+  uint16_t len = frames - start;
+  if (len < 2) {
+    fade[start] = curve[curve_len - 1];
+    return;
+  }
+  uint32_t step = ((uint32_t)(curve_len - 1) << 16) / (len - 1);
+  uint32_t pos = 0;
+  for (uint16_t i = start; i < frames; i++, pos += step) {
+    fade[i] = curve[pos >> 16];
+  }
+  // the truncated step can stop one entry short
+  fade[frames - 1] = curve[curve_len - 1];
+}
+
+#endif
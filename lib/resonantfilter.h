@@ -23,6 +23,7 @@
 // See http://creativecommons.org/licenses/MIT/ for more information.
 
 #include "fixedpoint.h"
+#include "ramfunc.h"
 #include "resonantfilter_data.h"
 
 #define FILTER_LOWPASS 0
@@ -58,15 +59,15 @@ void ResonantFilter_reset(ResonantFilter* rf) {
 }
 
 void ResonantFilter_setFc(ResonantFilter* rf, uint8_t fc) {
-  if (fc >= resonantfilter_fc_max) {
+  bool passthrough = fc >= resonantfilter_fc_max;
+  if (passthrough) {
     fc = resonantfilter_fc_max - 1;
-    rf->passthrough = true;
-  } else {
-    rf->passthrough = false;
   }
-  if (rf->fc == fc) {
+  // leaving passthrough at the top index still needs its coefficients
+  if (rf->fc == fc && rf->passthrough == passthrough) {
     return;
   }
+  rf->passthrough = passthrough;
   rf->fc = fc;
   ResonantFilter_reset(rf);
 }
@@ -142,7 +143,7 @@ ResonantFilter* ResonantFilter_create(uint8_t filter_type) {
   return rf;
 }
 
-int32_t ResonantFilter_update(ResonantFilter* rf, int32_t in) {
+int32_t RAM_FUNC(ResonantFilter_update)(ResonantFilter* rf, int32_t in) {
   if (rf->passthrough) {
     rf->passthrough_last = 0;
     return in;
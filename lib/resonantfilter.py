@@ -68,8 +68,10 @@ print(f"const uint8_t resonantfilter_q_max = {len(qs)};")
 print(f"const uint8_t resonantfilter_fc_max = {len(notes)};")
 print(f"const uint8_t resonantfilter_filter_max = {len(filter_types)};")
 
+# not const so the coefficients are copied into SRAM at boot instead of being
+# fetched through the XIP cache whenever the cutoff moves
 print(
-    f"const int32_t resonantfilter_data[{len(filter_types)}][{len(qs)}][{len(notes)}][5] = {{"
+    f"int32_t resonantfilter_data[{len(filter_types)}][{len(qs)}][{len(notes)}][5] = {{"
 )
 
 for filter_type in filter_types:
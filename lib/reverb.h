@@ -0,0 +1,350 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_REVERB_H_
+#define LIB_REVERB_H_
+
+#include "fixedpoint.h"
+#include "fxpool.h"
+#include "ramfunc.h"
+#include "smooth.h"
+//
+#include "stdbool.h"
+
+// Reverb is a four line feedback delay network. the lines are 16-bit and
+// come from the fx pool when the reverb is switched on. every step reads the
+// four lines, damps them with a one-pole lowpass, mixes them with a
+// hadamard matrix, scales by the decay and writes them back with the input
+// added. left and right take two lines each.
+//
+// apart from clamping, the work does not depend on the input, so the budget
+// checked by host/bench_reverb.c holds for any input. in half rate mode the network
+// runs every other sample on the first half of each line, for half the
+// cost and memory; the pool can also force it when it is short.
+//
+// switching off stops the input and lets the tail ring out, the lines go
+// back to the pool once they are silent, or after REVERB_TAIL_SAMPLES.
+
+#define REVERB_LINES 4
+// mutually prime, 32 to 47 ms
+#define REVERB_LENGTH_0 1433
+#define REVERB_LENGTH_1 1601
+#define REVERB_LENGTH_2 1867
+#define REVERB_LENGTH_3 2053
+#define REVERB_SAMPLES \
+  (REVERB_LENGTH_0 + REVERB_LENGTH_1 + REVERB_LENGTH_2 + REVERB_LENGTH_3)
+#define REVERB_TAIL_SAMPLES (44100 * 4)
+// a decay or tone change closes 1/4 of the remaining distance each block
+#define REVERB_GLIDE_SHIFT 2
+
+const uint16_t reverb_lengths[REVERB_LINES] = {REVERB_LENGTH_0, REVERB_LENGTH_1,
+                                               REVERB_LENGTH_2, REVERB_LENGTH_3};
+
+typedef struct Reverb {
+  FxPool *pool;
+  // the lines back to back, NULL while off
+  int16_t *buffer;
+  int16_t *line[REVERB_LINES];
+  uint16_t length[REVERB_LINES];
+  uint16_t index[REVERB_LINES];
+  int32_t lowpass[REVERB_LINES];
+  // decay (q2.14), lowpass coefficient (q1.15) and level (q1.15), the
+  // level played ramps to the mix over a block
+  Smooth feedback;
+  Smooth damping;
+  int32_t mix;
+  Smooth wet;
+  bool on;
+  bool half_rate;
+  // forced to half rate by a short pool
+  bool degraded;
+  // half rate state: summed input, the step on odd samples and the last
+  // two outputs of the network
+  int32_t in_sum;
+  uint8_t phase;
+  int32_t out_last[2];
+  int32_t out_prev[2];
+  // steps in a row that wrote only zeros, and samples since switched off
+  uint32_t silent;
+  uint32_t off_samples;
+} Reverb;
+
+Reverb *Reverb_malloc(FxPool *pool) {
+  Reverb *self = (Reverb *)malloc(sizeof(Reverb));
+  self->pool = pool;
+  self->buffer = NULL;
+  Smooth_init(&self->feedback, 12288, REVERB_GLIDE_SHIFT);
+  Smooth_init(&self->damping, 16384, REVERB_GLIDE_SHIFT);
+  self->mix = 8192;
+  Smooth_init(&self->wet, 0, 0);
+  self->on = false;
+  self->half_rate = false;
+  self->degraded = false;
+  self->silent = 0;
+  self->off_samples = 0;
+  FxPool_register(pool, "reverb", REVERB_SAMPLES * sizeof(int16_t),
+                  REVERB_SAMPLES / 2 * sizeof(int16_t));
+  return self;
+}
+
+// true when the lines are all zero, so processing silence can be skipped
+bool Reverb_isSilent(Reverb *self) {
+  return self->buffer == NULL || self->silent >= REVERB_LENGTH_3;
+}
+
+// empties the lines and lays them out for the rate
+static void Reverb_reset(Reverb *self) {
+  uint8_t shift = self->half_rate ? 1 : 0;
+  int16_t *p = self->buffer;
+  for (uint8_t c = 0; c < REVERB_LINES; c++) {
+    self->line[c] = p;
+    self->length[c] = reverb_lengths[c] >> shift;
+    self->index[c] = 0;
+    self->lowpass[c] = 0;
+    memset(p, 0, self->length[c] * sizeof(int16_t));
+    p += self->length[c];
+  }
+  self->in_sum = 0;
+  self->phase = 0;
+  for (uint8_t c = 0; c < 2; c++) {
+    self->out_last[c] = 0;
+    self->out_prev[c] = 0;
+  }
+  self->silent = REVERB_LENGTH_3;
+}
+
+void Reverb_release(Reverb *self) {
+  if (self->buffer != NULL) {
+    FxPool_release(self->pool, self->buffer);
+    self->buffer = NULL;
+  }
+}
+
+// switching on takes the lines from the pool and returns false when not
+// even the half rate lines fit
+bool Reverb_setActive(Reverb *self, bool on) {
+  self->on = on;
+  self->off_samples = 0;
+  if (!on) {
+    if (Reverb_isSilent(self)) {
+      Reverb_release(self);
+    }
+    return true;
+  }
+  if (self->buffer != NULL) {
+    return true;
+  }
+  uint32_t granted;
+  self->buffer = (int16_t *)FxPool_alloc(
+      self->pool, REVERB_SAMPLES * sizeof(int16_t),
+      REVERB_SAMPLES / 2 * sizeof(int16_t), &granted);
+  if (self->buffer == NULL) {
+    self->on = false;
+    return false;
+  }
+  self->degraded = granted < REVERB_SAMPLES * sizeof(int16_t);
+  self->half_rate = self->half_rate || self->degraded;
+  Smooth_jump(&self->wet, 0);
+  Reverb_reset(self);
+  return true;
+}
+
+// decay, mix and tone 0-255
+void Reverb_set(Reverb *self, uint8_t decay, uint8_t mix, uint8_t tone) {
+  // 0.5 to 0.97 per trip around the network
+  Smooth_set(&self->feedback, 8192 + decay * 30);
+  self->mix = mix << 7;
+  // bright to dark, the half rate step covers twice the time
+  int32_t damping = 32767 - tone * 112;
+  if (self->half_rate) {
+    damping = damping * 2 > 32767 ? 32767 : damping * 2;
+  }
+  Smooth_set(&self->damping, damping);
+}
+
+// changing the rate clears the tail, the lines are laid out differently
+void Reverb_setHalfRate(Reverb *self, bool half_rate) {
+  half_rate = half_rate || self->degraded;
+  if (half_rate == self->half_rate) {
+    return;
+  }
+  self->half_rate = half_rate;
+  if (self->buffer != NULL) {
+    Reverb_reset(self);
+  }
+}
+
+// the state a block of steps works on, copied out of the struct so it can
+// stay in registers
+typedef struct ReverbState {
+  int16_t *line[REVERB_LINES];
+  uint32_t length[REVERB_LINES];
+  uint32_t index[REVERB_LINES];
+  int32_t lowpass[REVERB_LINES];
+  int32_t feedback;
+  int32_t damping;
+  int32_t feedback_step;
+  int32_t damping_step;
+  uint32_t silent;
+} ReverbState;
+
+static inline int32_t Reverb_clamp(int32_t v) {
+  if (v > 32767) {
+    return 32767;
+  }
+  if (v < -32768) {
+    return -32768;
+  }
+  return v;
+}
+
+// rounded so it does not creep toward -1, and the last couple of steps
+// flushed to zero, which the rounded feedback would otherwise keep
+// circulating, so the lines reach silence
+static inline int32_t Reverb_lowpass(int32_t lp, int32_t x, int32_t damping) {
+  lp += ((x - lp) * damping + (1 << 14)) >> 15;
+  return lp & -(int32_t)((uint32_t)(lp + 2) > 4);
+}
+
+// one step of the network, in and out in 16-bit steps
+static inline void Reverb_step(ReverbState *st, int32_t in, int32_t *out) {
+  int32_t x0 = st->line[0][st->index[0]];
+  int32_t x1 = st->line[1][st->index[1]];
+  int32_t x2 = st->line[2][st->index[2]];
+  int32_t x3 = st->line[3][st->index[3]];
+  st->feedback += st->feedback_step;
+  st->damping += st->damping_step;
+  st->lowpass[0] = Reverb_lowpass(st->lowpass[0], x0, st->damping);
+  st->lowpass[1] = Reverb_lowpass(st->lowpass[1], x1, st->damping);
+  st->lowpass[2] = Reverb_lowpass(st->lowpass[2], x2, st->damping);
+  st->lowpass[3] = Reverb_lowpass(st->lowpass[3], x3, st->damping);
+  int32_t a = st->lowpass[0] + st->lowpass[1];
+  int32_t b = st->lowpass[0] - st->lowpass[1];
+  int32_t c = st->lowpass[2] + st->lowpass[3];
+  int32_t d = st->lowpass[2] - st->lowpass[3];
+  // the hadamard matrix needs a half to keep its energy, folded into the
+  // shift with the decay
+  int32_t h[REVERB_LINES] = {a + c, b + d, a - c, b - d};
+  int32_t zero = 0;
+  for (uint8_t i = 0; i < REVERB_LINES; i++) {
+    int32_t v =
+        Reverb_clamp(in + ((h[i] * st->feedback + (1 << 14)) >> 15));
+    st->line[i][st->index[i]] = v;
+    zero |= v;
+    st->index[i]++;
+    if (st->index[i] == st->length[i]) {
+      st->index[i] = 0;
+    }
+  }
+  st->silent = (st->silent + 1) & -(uint32_t)(zero == 0);
+  out[0] = x0 + x2;
+  out[1] = x1 + x3;
+}
+
+void RAM_FUNC(Reverb_process)(Reverb *self, int32_t *samples,
+                              uint16_t num_samples) {
+  if (self->buffer == NULL) {
+    return;
+  }
+  // the tail is done, fade out and give the lines back
+  bool ending = false;
+  if (!self->on) {
+    self->off_samples += num_samples;
+    ending = Reverb_isSilent(self) || self->off_samples >= REVERB_TAIL_SAMPLES;
+  }
+  Smooth_set(&self->wet, ending ? 0 : self->mix);
+  Smooth_beginBlock(&self->wet, num_samples);
+  int32_t wet = self->wet.value;
+  int32_t wet_step = self->wet.step;
+  // the network steps on every sample, or every other one at half rate
+  uint16_t steps =
+      self->half_rate ? (num_samples + self->phase) / 2 : num_samples;
+  Smooth_beginBlock(&self->feedback, steps);
+  Smooth_beginBlock(&self->damping, steps);
+  ReverbState st;
+  for (uint8_t c = 0; c < REVERB_LINES; c++) {
+    st.line[c] = self->line[c];
+    st.length[c] = self->length[c];
+    st.index[c] = self->index[c];
+    st.lowpass[c] = self->lowpass[c];
+  }
+  st.feedback = self->feedback.value;
+  st.damping = self->damping.value;
+  st.feedback_step = self->feedback.step;
+  st.damping_step = self->damping.step;
+  st.silent = self->silent;
+  // a quarter of the mid, for headroom in the lines
+  int32_t in_mask = self->on ? -1 : 0;
+  int32_t out[2];
+  if (!self->half_rate) {
+    for (uint16_t i = 0; i < num_samples; i++) {
+      int32_t in = ((samples[i * 2] >> 16) + (samples[i * 2 + 1] >> 16)) >> 2;
+      Reverb_step(&st, in & in_mask, out);
+      wet += wet_step;
+      samples[i * 2 + 0] += out[0] * wet;
+      samples[i * 2 + 1] += out[1] * wet;
+    }
+  } else {
+    int32_t in_sum = self->in_sum;
+    uint8_t phase = self->phase;
+    int32_t *last = self->out_last;
+    int32_t *prev = self->out_prev;
+    for (uint16_t i = 0; i < num_samples; i++) {
+      in_sum += ((samples[i * 2] >> 16) + (samples[i * 2 + 1] >> 16)) >> 2;
+      if (phase) {
+        prev[0] = last[0];
+        prev[1] = last[1];
+        Reverb_step(&st, (in_sum >> 1) & in_mask, last);
+        in_sum = 0;
+        out[0] = last[0];
+        out[1] = last[1];
+      } else {
+        // half way between the last two steps
+        out[0] = (prev[0] + last[0]) >> 1;
+        out[1] = (prev[1] + last[1]) >> 1;
+      }
+      phase ^= 1;
+      wet += wet_step;
+      samples[i * 2 + 0] += out[0] * wet;
+      samples[i * 2 + 1] += out[1] * wet;
+    }
+    self->in_sum = in_sum;
+    self->phase = phase;
+  }
+  for (uint8_t c = 0; c < REVERB_LINES; c++) {
+    self->index[c] = st.index[c];
+    self->lowpass[c] = st.lowpass[c];
+  }
+  self->silent = st.silent;
+  if (ending) {
+    Reverb_release(self);
+  }
+}
+
+void Reverb_free(Reverb *self) {
+  Reverb_release(self);
+  free(self);
+}
+
+#endif
@@ -29,6 +29,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+// bytes before the slice arrays in a .info file. the tool writes the struct
+// from a 64-bit build up to its last two pointers, so this is the two fields
+// plus the 8 bytes of the slice_start pointer.
+#define SAMPLEINFO_HEADER_SIZE 16
+
 typedef struct SampleInfo {
   uint32_t size;
   uint32_t bpm : 9;             // 0-511
@@ -33,10 +33,23 @@ typedef struct SaveFile {
   uint8_t bank : 8;
   uint8_t sample : 8;
   Sequencer *sequencers[3][16];
-  bool fx_active[16];
-  uint8_t fx_param[16][3];
+  bool fx_active[FX_NUM];
+  uint8_t fx_param[FX_NUM][3];
 } SaveFile;
 
+// the layout before FX_REVERB took the 17th fx slot, still loaded so an
+// update keeps the saved settings
+#define SAVEFILE_FX_NUM_16 16
+typedef struct SaveFile16 {
+  uint8_t vol;
+  uint16_t bpm_tempo;
+  uint8_t bank : 8;
+  uint8_t sample : 8;
+  Sequencer *sequencers[3][16];
+  bool fx_active[SAVEFILE_FX_NUM_16];
+  uint8_t fx_param[SAVEFILE_FX_NUM_16][3];
+} SaveFile16;
+
 #define SAVEFILE_PATHNAME "save.bin"
 void test_sequencer_emit(uint8_t key) { printf("key %d\n", key); }
 void test_sequencer_stop() { printf("stop\n"); }
@@ -53,7 +66,7 @@ SaveFile *SaveFile_malloc() {
     }
   }
 
-  for (uint8_t i = 0; i < 16; i++) {
+  for (uint8_t i = 0; i < FX_NUM; i++) {
     sf->fx_active[i] = false;
     sf->fx_param[i][0] = 0;
     sf->fx_param[i][1] = 0;
@@ -68,8 +81,14 @@ SaveFile *SaveFile_malloc() {
   sf->fx_param[FX_BITCRUSH][1] = 90;
   sf->fx_param[FX_DELAY][0] = 200;
   sf->fx_param[FX_DELAY][1] = 200;
-  sf->fx_param[FX_BEATREPEAT][0] = 45;
+  sf->fx_param[FX_BEATREPEAT][0] = 128;
   sf->fx_param[FX_TIGHTEN][0] = 215;
+  // lfo periods of half a beat and two and a half beats
+  sf->fx_param[FX_TREMELO][0] = 213;
+  sf->fx_param[FX_PAN][0] = 21;
+  sf->fx_param[FX_REVERB][0] = 160;
+  sf->fx_param[FX_REVERB][1] = 96;
+  sf->fx_param[FX_REVERB][2] = 128;
   return sf;
 }
 
@@ -108,6 +127,31 @@ bool SaveFile_load(SaveFile *sf, bool *sync_sd_card) {
   printf("[SaveFile] reading\n");
   if (f_open(&fil, SAVEFILE_PATHNAME, FA_READ)) {
     printf("[SaveFile] no save file, skipping ");
+  } else if (f_size(&fil) ==
+             sizeof(SaveFile16) + (sizeof(Sequencer) * 3 * 16)) {
+    // the slots after the first 16 keep their defaults
+    SaveFile16 sf16;
+    unsigned int bytes_read;
+    if (f_read(&fil, &sf16, sizeof(SaveFile16), &bytes_read) ||
+        bytes_read != sizeof(SaveFile16)) {
+      printf("[SaveFile] problem reading save file");
+    } else {
+      sf->vol = sf16.vol;
+      sf->bpm_tempo = sf16.bpm_tempo;
+      sf->bank = sf16.bank;
+      sf->sample = sf16.sample;
+      for (uint8_t i = 0; i < SAVEFILE_FX_NUM_16; i++) {
+        sf->fx_active[i] = sf16.fx_active[i];
+        sf->fx_param[i][0] = sf16.fx_param[i][0];
+        sf->fx_param[i][1] = sf16.fx_param[i][1];
+        sf->fx_param[i][2] = sf16.fx_param[i][2];
+      }
+      printf("[SaveFile] bpm_tempo = %d (16 fx)\n", sf->bpm_tempo);
+    }
+  } else if (f_size(&fil) !=
+             sizeof(SaveFile) + (sizeof(Sequencer) * 3 * 16)) {
+    // written by firmware with a different layout
+    printf("[SaveFile] save file is %d bytes, skipping\n", (int)f_size(&fil));
   } else {
     unsigned int bytes_read;
     if (f_read(&fil, sf, sizeof(SaveFile) + (sizeof(Sequencer) * 3 * 16),
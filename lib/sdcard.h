@@ -39,8 +39,7 @@ static FATFS *sd_get_fs_by_name(const char *name) {
 void sd_unmount() { f_unmount(sd_get_by_num(0)->pcName); }
 
 bool run_mount() {
-  const char *arg1 = strtok(NULL, " ");
-  arg1 = sd_get_by_num(0)->pcName;
+  const char *arg1 = sd_get_by_num(0)->pcName;
   FATFS *p_fs = sd_get_fs_by_name(arg1);
   if (!p_fs) {
     printf("Unknown logical drive number: \"%s\"\n", arg1);
@@ -40,11 +40,12 @@ void sdcard_startup() {
   while (!run_mount()) {
     sleep_ms(200);
   }
-  envelope_volume = Envelope2_create(BLOCKS_PER_SECOND, 0, 1, 2);
-  envelope_pitch = Envelope2_create(BLOCKS_PER_SECOND, 0.5, 1.0, 1.5);
-  envelope_filter = EnvelopeLinearInteger_create(BLOCKS_PER_SECOND, 1,
-                                                 resonantfilter_fc_max, 0.3);
-  noise_wobble = Noise_create(time_us_64(), BLOCKS_PER_SECOND);
+  envelope_volume =
+      EnvelopeTable_create(SAMPLE_RATE, 0, 1, 2, ENVELOPE_COSINE);
+  envelope_pitch =
+      EnvelopeTable_create(SAMPLE_RATE, 0.5, 1.0, 1.5, ENVELOPE_COSINE);
+  envelope_filter = EnvelopeTable_create(SAMPLE_RATE, 1, resonantfilter_fc_max,
+                                         0.3, ENVELOPE_LINEAR);
   audio_gate = Gate_create(BLOCKS_PER_SECOND, 165);
 #ifdef INCLUDE_BASS
   bass = Bass_create();
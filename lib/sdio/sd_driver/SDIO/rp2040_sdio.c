@@ -896,3 +896,11 @@ void rp2040_sdio_init(sd_card_t *sd_card_p, int clock_divider)
 
     irq_set_enabled(sd_card_p->sdio_if.DMA_IRQ_num, true);
 }
+
+void rp2040_sdio_set_clock_divider(int clock_divider)
+{
+    // the data state machines pick their config up at the next transfer
+    pio_sm_set_clkdiv_int_frac(SDIO_PIO, SDIO_CMD_SM, clock_divider, 0);
+    sm_config_set_clkdiv_int_frac(&g_sdio.pio_cfg_data_rx, clock_divider, 0);
+    sm_config_set_clkdiv_int_frac(&g_sdio.pio_cfg_data_tx, clock_divider, 0);
+}
@@ -58,6 +58,9 @@ sdio_status_t rp2040_sdio_stop();
 // (Re)initialize the SDIO interface
 void rp2040_sdio_init(sd_card_t *sd_card_p, int clock_divider /* = 1 */);
 
+// Change the clock divider without resetting, only while idle
+void rp2040_sdio_set_clock_divider(int clock_divider);
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,26 +2,52 @@
 #define LIB_SHAPER_LIB 1
 #include "shapers.h"
 
+// linear interpolation into one of the shaper curves, v in [0, 32768]
+int16_t shaper_lookup(const int16_t *curve, int32_t v) {
+  if (v > 32767) {
+    v = 32767;
+  }
+  int32_t i = v >> SHAPER_REDUCE;
+  int32_t f = v & ((1 << SHAPER_REDUCE) - 1);
+  int32_t a = curve[i];
+  return a + (((curve[i + 1] - a) * f) >> SHAPER_REDUCE);
+}
+
+int16_t Shaper_expandOver_compressUnder(int16_t v, int16_t threshold) {
+  if (abs(v) > threshold) {
+    // expand
+    if (v < 0) {
+      return -1 * shaper_lookup(expand_curve_data, abs(v));
+    }
+    return shaper_lookup(expand_curve_data, v);
+  }
+  // compress
+  if (v < 0) {
+    return -1 * shaper_lookup(compress_curve_data, abs(v));
+  }
+  return shaper_lookup(compress_curve_data, v);
+}
+
+int16_t Shaper_expandUnder_compressOver(int16_t v, int16_t threshold) {
+  if (abs(v) > threshold) {
+    // compress
+    if (v < 0) {
+      return -1 * shaper_lookup(compress_curve_data, abs(v));
+    }
+    return shaper_lookup(compress_curve_data, v);
+  }
+  // expand
+  if (v < 0) {
+    return -1 * shaper_lookup(expand_curve_data, abs(v));
+  }
+  return shaper_lookup(expand_curve_data, v);
+}
+
 void Shaper_expandOver_compressUnder_process(int16_t *values,
                                              uint16_t num_values,
                                              int16_t threshold) {
   for (uint16_t i = 0; i < num_values; i++) {
-    if (abs(values[i]) > threshold) {
-      if (values[i] < 0) {
-        // expand
-        values[i] = -1 * expand_curve_data[abs(values[i]) >> SHAPER_REDUCE];
-      } else {
-        // expand
-        values[i] = expand_curve_data[abs(values[i]) >> SHAPER_REDUCE];
-      }
-    } else {
-      // compress
-      if (values[i] < 0) {
-        values[i] = -1 * compress_curve_data[abs(values[i]) >> SHAPER_REDUCE];
-      } else {
-        values[i] = compress_curve_data[abs(values[i]) >> SHAPER_REDUCE];
-      }
-    }
+    values[i] = Shaper_expandOver_compressUnder(values[i], threshold);
   }
 }
 
@@ -29,22 +55,8 @@ void Shaper_expandUnder_compressOver_process(int16_t *values,
                                              uint16_t num_values,
                                              int16_t threshold) {
   for (uint16_t i = 0; i < num_values; i++) {
-    if (abs(values[i]) > threshold) {
-      // compress
-      if (values[i] < 0) {
-        values[i] = -1 * compress_curve_data[abs(values[i]) >> SHAPER_REDUCE];
-      } else {
-        values[i] = compress_curve_data[abs(values[i]) >> SHAPER_REDUCE];
-      }
-    } else {
-      // expand
-      if (values[i] < 0) {
-        values[i] = -1 * expand_curve_data[abs(values[i]) >> SHAPER_REDUCE];
-      } else {
-        values[i] = expand_curve_data[abs(values[i]) >> SHAPER_REDUCE];
-      }
-    }
+    values[i] = Shaper_expandUnder_compressOver(values[i], threshold);
   }
 }
 
-#endif
\ No newline at end of file
+#endif
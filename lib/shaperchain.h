@@ -0,0 +1,213 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_SHAPERCHAIN_H_
+#define LIB_SHAPERCHAIN_H_
+
+// ShaperChain folds the memoryless part of the fx chain (saturate -> shaper
+// -> fuzz) into one transfer curve sampled across the int16 range, so the
+// audio core does a single interpolated lookup per sample. bitcrush is applied
+// in the same loop since its quantization does not survive interpolation.
+//
+// core0 rebuilds the curve into the spare table whenever the fx settings
+// change and then swaps the table index. the audio core blends from the old
+// curve to the new one over the next block and acknowledges the swap, and
+// core0 does not touch the spare table until it has.
+
+#include "fuzz.h"
+#include "ramfunc.h"
+#include "shaper.h"
+#include "transfer_saturate2.h"
+
+#define SHAPERCHAIN_BITS 11
+#define SHAPERCHAIN_SHIFT (16 - SHAPERCHAIN_BITS)
+#define SHAPERCHAIN_POINTS ((1 << SHAPERCHAIN_BITS) + 1)
+#define SHAPERCHAIN_KEY_SIZE 8
+
+typedef struct ShaperChain {
+  int16_t table[2][SHAPERCHAIN_POINTS];
+  // whether the curve in each table does anything
+  bool table_active[2];
+  // table the audio core should use, written by core0
+  volatile uint8_t current;
+  // table the audio core finished its last block with, written by the audio
+  // core. core0 only rebuilds when this equals current
+  volatile uint8_t used;
+  // tables used for the block in progress
+  uint8_t block_from;
+  uint8_t block_to;
+  // fx settings the current table was built from
+  uint8_t key[SHAPERCHAIN_KEY_SIZE];
+} ShaperChain;
+
+void ShaperChain_free(ShaperChain *self) { free(self); }
+
+void ShaperChain_key(uint8_t *key, bool *fx_active, uint8_t fx_param[][3]) {
+  key[0] = fx_active[FX_SATURATE] | (fx_active[FX_SHAPER] << 1) |
+           (fx_active[FX_FUZZ] << 2);
+  key[1] = fx_active[FX_SATURATE] ? fx_param[FX_SATURATE][0] : 0;
+  key[2] = fx_active[FX_SHAPER] ? (fx_param[FX_SHAPER][0] > 128) : 0;
+  key[3] = fx_active[FX_SHAPER] ? fx_param[FX_SHAPER][1] : 0;
+  key[4] = fx_active[FX_FUZZ] ? fx_param[FX_FUZZ][0] : 0;
+  key[5] = fx_active[FX_FUZZ] ? fx_param[FX_FUZZ][1] : 0;
+  key[6] = 0;
+  key[7] = 0;
+}
+
+// the composite curve, evaluated the same way the separate passes did
+int16_t ShaperChain_evaluate(int16_t v, bool *fx_active,
+                             uint8_t fx_param[][3]) {
+  if (fx_active[FX_SATURATE]) {
+    v = v * fx_param[FX_SATURATE][0] / 128;
+    v = transfer_doublesine(v);
+  }
+  if (fx_active[FX_SHAPER]) {
+    if (fx_param[FX_SHAPER][0] > 128) {
+      v = Shaper_expandUnder_compressOver(v, fx_param[FX_SHAPER][1] << 7);
+    } else {
+      v = Shaper_expandOver_compressUnder(v, fx_param[FX_SHAPER][1] << 7);
+    }
+  }
+  if (fx_active[FX_FUZZ]) {
+    v = Fuzz_sample(v, fx_param[FX_FUZZ][0], fx_param[FX_FUZZ][1]);
+  }
+  return v;
+}
+
+void ShaperChain_build(ShaperChain *self, uint8_t t, bool *fx_active,
+                       uint8_t fx_param[][3]) {
+  for (int32_t i = 0; i < SHAPERCHAIN_POINTS; i++) {
+    int32_t x = (i << SHAPERCHAIN_SHIFT) - 32768;
+    if (x > 32767) {
+      x = 32767;
+    }
+    self->table[t][i] = ShaperChain_evaluate(x, fx_active, fx_param);
+  }
+  self->table_active[t] =
+      fx_active[FX_SATURATE] || fx_active[FX_SHAPER] || fx_active[FX_FUZZ];
+}
+
+// starts out with an identity curve, which matches the key for all fx off
+ShaperChain *ShaperChain_malloc() {
+  ShaperChain *self = (ShaperChain *)malloc(sizeof(ShaperChain));
+  for (int32_t i = 0; i < SHAPERCHAIN_POINTS; i++) {
+    self->table[0][i] = util_clamp((i << SHAPERCHAIN_SHIFT) - 32768, -32768,
+                                   32767);
+  }
+  self->table_active[0] = false;
+  self->table_active[1] = false;
+  memset(self->key, 0, SHAPERCHAIN_KEY_SIZE);
+  self->current = 0;
+  self->used = 0;
+  self->block_from = 0;
+  self->block_to = 0;
+  return self;
+}
+
+// called from core0. returns true if a new curve was published
+bool ShaperChain_update(ShaperChain *self, bool *fx_active,
+                        uint8_t fx_param[][3]) {
+  uint8_t key[SHAPERCHAIN_KEY_SIZE];
+  ShaperChain_key(key, fx_active, fx_param);
+  if (memcmp(key, self->key, SHAPERCHAIN_KEY_SIZE) == 0) {
+    return false;
+  }
+  if (self->used != self->current) {
+    // audio core is still blending into the last curve
+    return false;
+  }
+  uint8_t t = 1 - self->current;
+  ShaperChain_build(self, t, fx_active, fx_param);
+  memcpy(self->key, key, SHAPERCHAIN_KEY_SIZE);
+  // make sure the table is written before the audio core can see it
+  __dmb();
+  self->current = t;
+  return true;
+}
+
+// called from the audio core once per block, before processing
+void ShaperChain_beginBlock(ShaperChain *self) {
+  self->block_from = self->used;
+  self->block_to = self->current;
+  __dmb();
+}
+
+// called from the audio core once per block, after processing
+void ShaperChain_endBlock(ShaperChain *self) {
+  __dmb();
+  self->used = self->block_to;
+}
+
+static inline int32_t ShaperChain_lookup(const int16_t *table, int16_t v) {
+  int32_t u = v + 32768;
+  int32_t i = u >> SHAPERCHAIN_SHIFT;
+  int32_t f = u & ((1 << SHAPERCHAIN_SHIFT) - 1);
+  int32_t a = table[i];
+  return a + (((table[i + 1] - a) * f) >> SHAPERCHAIN_SHIFT);
+}
+
+// bitcrush parameters are the raw fx params, as in Bitcrush_process
+void RAM_FUNC(ShaperChain_process)(ShaperChain *self, int16_t *values,
+                                   uint16_t num_values, bool bitcrush,
+                                   uint8_t sample_rate, uint8_t bitrate) {
+  const int16_t *from = self->table[self->block_from];
+  const int16_t *to = self->table[self->block_to];
+  bool blend = self->block_from != self->block_to;
+  bool active = self->table_active[self->block_to] ||
+                (blend && self->table_active[self->block_from]);
+  if (!active && !bitcrush) {
+    return;
+  }
+
+  uint8_t hold = 1;
+  uint8_t bits = 0;
+  if (bitcrush) {
+    hold = linlin(sample_rate, 0, 255, 1, 8);
+    bits = linlin(bitrate, 0, 255, 0, 12);
+  }
+
+  // blend position in Q1.15, which keeps the multiply in 32 bits
+  int32_t pos = 0;
+  int32_t step = num_values > 0 ? 32768 / num_values : 0;
+  uint8_t held = 0;
+  for (uint16_t i = 0; i < num_values; i++, pos += step) {
+    if (held > 0) {
+      // sample and hold
+      values[i] = values[i - 1];
+      held--;
+      continue;
+    }
+    held = hold - 1;
+    int32_t v = values[i];
+    if (blend) {
+      int32_t a = ShaperChain_lookup(from, v);
+      v = a + (((ShaperChain_lookup(to, v) - a) * pos) >> 15);
+    } else if (active) {
+      v = ShaperChain_lookup(to, v);
+    }
+    values[i] = (v >> bits) << bits;
+  }
+}
+
+#endif
@@ -1,5967 +1,197 @@
 #ifndef LIB_SHAPER
 #define LIB_SHAPER 1
-#define SHAPER_RESOLUTION 15
-#define SHAPER_REDUCE 0
-const int16_t __in_flash() compress_curve_data[32768] = {
-    0,     81,    161,   239,   317,   393,   469,   543,   616,   688,   760,
-    830,   899,   968,   1035,  1102,  1168,  1233,  1297,  1361,  1423,  1485,
-    1547,  1607,  1667,  1726,  1785,  1843,  1900,  1957,  2013,  2068,  2123,
-    2177,  2231,  2284,  2337,  2389,  2441,  2492,  2543,  2593,  2642,  2692,
-    2740,  2789,  2837,  2884,  2931,  2978,  3024,  3070,  3115,  3160,  3205,
-    3249,  3293,  3336,  3379,  3422,  3465,  3507,  3549,  3590,  3631,  3672,
-    3712,  3753,  3793,  3832,  3871,  3910,  3949,  3987,  4026,  4064,  4101,
-    4138,  4176,  4212,  4249,  4285,  4321,  4357,  4393,  4428,  4463,  4498,
-    4532,  4567,  4601,  4635,  4669,  4702,  4736,  4769,  4802,  4834,  4867,
-    4899,  4931,  4963,  4995,  5026,  5057,  5089,  5120,  5150,  5181,  5211,
-    5242,  5272,  5302,  5331,  5361,  5390,  5419,  5449,  5477,  5506,  5535,
-    5563,  5592,  5620,  5648,  5675,  5703,  5731,  5758,  5785,  5812,  5839,
-    5866,  5893,  5920,  5946,  5972,  5998,  6025,  6050,  6076,  6102,  6127,
-    6153,  6178,  6203,  6228,  6253,  6278,  6303,  6327,  6352,  6376,  6400,
-    6425,  6449,  6472,  6496,  6520,  6544,  6567,  6590,  6614,  6637,  6660,
-    6683,  6706,  6729,  6751,  6774,  6796,  6819,  6841,  6863,  6885,  6907,
-    6929,  6951,  6973,  6994,  7016,  7037,  7059,  7080,  7101,  7122,  7143,
-    7164,  7185,  7206,  7227,  7247,  7268,  7288,  7309,  7329,  7349,  7369,
-    7390,  7410,  7429,  7449,  7469,  7489,  7508,  7528,  7547,  7567,  7586,
-    7605,  7625,  7644,  7663,  7682,  7701,  7720,  7738,  7757,  7776,  7794,
-    7813,  7831,  7850,  7868,  7886,  7904,  7923,  7941,  7959,  7977,  7994,
-    8012,  8030,  8048,  8065,  8083,  8101,  8118,  8135,  8153,  8170,  8187,
-    8204,  8222,  8239,  8256,  8273,  8290,  8306,  8323,  8340,  8357,  8373,
-    8390,  8406,  8423,  8439,  8456,  8472,  8488,  8505,  8521,  8537,  8553,
-    8569,  8585,  8601,  8617,  8633,  8648,  8664,  8680,  8695,  8711,  8727,
-    8742,  8758,  8773,  8788,  8804,  8819,  8834,  8849,  8865,  8880,  8895,
-    8910,  8925,  8940,  8955,  8969,  8984,  8999,  9014,  9028,  9043,  9058,
-    9072,  9087,  9101,  9116,  9130,  9145,  9159,  9173,  9187,  9202,  9216,
-    9230,  9244,  9258,  9272,  9286,  9300,  9314,  9328,  9342,  9355,  9369,
-    9383,  9397,  9410,  9424,  9437,  9451,  9465,  9478,  9491,  9505,  9518,
-    9532,  9545,  9558,  9571,  9585,  9598,  9611,  9624,  9637,  9650,  9663,
-    9676,  9689,  9702,  9715,  9728,  9741,  9753,  9766,  9779,  9792,  9804,
-    9817,  9829,  9842,  9855,  9867,  9880,  9892,  9905,  9917,  9929,  9942,
-    9954,  9966,  9978,  9991,  10003, 10015, 10027, 10039, 10051, 10063, 10075,
-    10087, 10099, 10111, 10123, 10135, 10147, 10159, 10171, 10183, 10194, 10206,
-    10218, 10229, 10241, 10253, 10264, 10276, 10287, 10299, 10310, 10322, 10333,
-    10345, 10356, 10368, 10379, 10390, 10402, 10413, 10424, 10435, 10447, 10458,
-    10469, 10480, 10491, 10502, 10513, 10524, 10535, 10546, 10557, 10568, 10579,
-    10590, 10601, 10612, 10623, 10634, 10644, 10655, 10666, 10677, 10687, 10698,
-    10709, 10719, 10730, 10741, 10751, 10762, 10772, 10783, 10793, 10804, 10814,
-    10825, 10835, 10845, 10856, 10866, 10876, 10887, 10897, 10907, 10918, 10928,
-    10938, 10948, 10958, 10968, 10979, 10989, 10999, 11009, 11019, 11029, 11039,
-    11049, 11059, 11069, 11079, 11089, 11099, 11109, 11118, 11128, 11138, 11148,
-    11158, 11167, 11177, 11187, 11197, 11206, 11216, 11226, 11235, 11245, 11255,
-    11264, 11274, 11283, 11293, 11302, 11312, 11321, 11331, 11340, 11350, 11359,
-    11368, 11378, 11387, 11397, 11406, 11415, 11425, 11434, 11443, 11452, 11462,
-    11471, 11480, 11489, 11498, 11508, 11517, 11526, 11535, 11544, 11553, 11562,
-    11571, 11580, 11589, 11598, 11607, 11616, 11625, 11634, 11643, 11652, 11661,
-    11670, 11679, 11687, 11696, 11705, 11714, 11723, 11731, 11740, 11749, 11758,
-    11766, 11775, 11784, 11792, 11801, 11810, 11818, 11827, 11836, 11844, 11853,
-    11861, 11870, 11878, 11887, 11895, 11904, 11912, 11921, 11929, 11938, 11946,
-    11955, 11963, 11971, 11980, 11988, 11996, 12005, 12013, 12021, 12030, 12038,
-    12046, 12055, 12063, 12071, 12079, 12087, 12096, 12104, 12112, 12120, 12128,
-    12136, 12144, 12153, 12161, 12169, 12177, 12185, 12193, 12201, 12209, 12217,
-    12225, 12233, 12241, 12249, 12257, 12265, 12273, 12280, 12288, 12296, 12304,
-    12312, 12320, 12328, 12335, 12343, 12351, 12359, 12367, 12374, 12382, 12390,
-    12398, 12405, 12413, 12421, 12428, 12436, 12444, 12451, 12459, 12467, 12474,
-    12482, 12489, 12497, 12505, 12512, 12520, 12527, 12535, 12542, 12550, 12557,
-    12565, 12572, 12580, 12587, 12595, 12602, 12610, 12617, 12624, 12632, 12639,
-    12646, 12654, 12661, 12669, 12676, 12683, 12691, 12698, 12705, 12712, 12720,
-    12727, 12734, 12741, 12749, 12756, 12763, 12770, 12777, 12785, 12792, 12799,
-    12806, 12813, 12820, 12828, 12835, 12842, 12849, 12856, 12863, 12870, 12877,
-    12884, 12891, 12898, 12905, 12912, 12919, 12926, 12933, 12940, 12947, 12954,
-    12961, 12968, 12975, 12982, 12989, 12996, 13002, 13009, 13016, 13023, 13030,
-    13037, 13044, 13050, 13057, 13064, 13071, 13078, 13084, 13091, 13098, 13105,
-    13111, 13118, 13125, 13132, 13138, 13145, 13152, 13158, 13165, 13172, 13178,
-    13185, 13192, 13198, 13205, 13212, 13218, 13225, 13231, 13238, 13245, 13251,
-    13258, 13264, 13271, 13277, 13284, 13290, 13297, 13303, 13310, 13316, 13323,
-    13329, 13336, 13342, 13349, 13355, 13362, 13368, 13375, 13381, 13387, 13394,
-    13400, 13406, 13413, 13419, 13426, 13432, 13438, 13445, 13451, 13457, 13464,
-    13470, 13476, 13482, 13489, 13495, 13501, 13507, 13514, 13520, 13526, 13532,
-    13539, 13545, 13551, 13557, 13563, 13570, 13576, 13582, 13588, 13594, 13600,
-    13607, 13613, 13619, 13625, 13631, 13637, 13643, 13649, 13655, 13662, 13668,
-    13674, 13680, 13686, 13692, 13698, 13704, 13710, 13716, 13722, 13728, 13734,
-    13740, 13746, 13752, 13758, 13764, 13770, 13776, 13782, 13788, 13793, 13799,
-    13805, 13811, 13817, 13823, 13829, 13835, 13841, 13846, 13852, 13858, 13864,
-    13870, 13876, 13882, 13887, 13893, 13899, 13905, 13911, 13916, 13922, 13928,
-    13934, 13939, 13945, 13951, 13957, 13962, 13968, 13974, 13980, 13985, 13991,
-    13997, 14002, 14008, 14014, 14019, 14025, 14031, 14036, 14042, 14048, 14053,
-    14059, 14065, 14070, 14076, 14082, 14087, 14093, 14098, 14104, 14109, 14115,
-    14121, 14126, 14132, 14137, 14143, 14148, 14154, 14159, 14165, 14170, 14176,
-    14181, 14187, 14192, 14198, 14203, 14209, 14214, 14220, 14225, 14231, 14236,
-    14242, 14247, 14252, 14258, 14263, 14269, 14274, 14280, 14285, 14290, 14296,
-    14301, 14306, 14312, 14317, 14323, 14328, 14333, 14339, 14344, 14349, 14355,
-    14360, 14365, 14371, 14376, 14381, 14386, 14392, 14397, 14402, 14408, 14413,
-    14418, 14423, 14429, 14434, 14439, 14444, 14450, 14455, 14460, 14465, 14470,
-    14476, 14481, 14486, 14491, 14496, 14502, 14507, 14512, 14517, 14522, 14527,
-    14532, 14538, 14543, 14548, 14553, 14558, 14563, 14568, 14573, 14579, 14584,
-    14589, 14594, 14599, 14604, 14609, 14614, 14619, 14624, 14629, 14634, 14639,
-    14644, 14650, 14655, 14660, 14665, 14670, 14675, 14680, 14685, 14690, 14695,
-    14700, 14705, 14710, 14715, 14719, 14724, 14729, 14734, 14739, 14744, 14749,
-    14754, 14759, 14764, 14769, 14774, 14779, 14784, 14789, 14793, 14798, 14803,
-    14808, 14813, 14818, 14823, 14828, 14832, 14837, 14842, 14847, 14852, 14857,
-    14862, 14866, 14871, 14876, 14881, 14886, 14890, 14895, 14900, 14905, 14910,
-    14914, 14919, 14924, 14929, 14934, 14938, 14943, 14948, 14953, 14957, 14962,
-    14967, 14972, 14976, 14981, 14986, 14990, 14995, 15000, 15005, 15009, 15014,
-    15019, 15023, 15028, 15033, 15037, 15042, 15047, 15051, 15056, 15061, 15065,
-    15070, 15075, 15079, 15084, 15089, 15093, 15098, 15102, 15107, 15112, 15116,
-    15121, 15125, 15130, 15135, 15139, 15144, 15148, 15153, 15157, 15162, 15167,
-    15171, 15176, 15180, 15185, 15189, 15194, 15198, 15203, 15207, 15212, 15217,
-    15221, 15226, 15230, 15235, 15239, 15244, 15248, 15253, 15257, 15262, 15266,
-    15270, 15275, 15279, 15284, 15288, 15293, 15297, 15302, 15306, 15311, 15315,
-    15319, 15324, 15328, 15333, 15337, 15342, 15346, 15350, 15355, 15359, 15364,
-    15368, 15372, 15377, 15381, 15385, 15390, 15394, 15399, 15403, 15407, 15412,
-    15416, 15420, 15425, 15429, 15433, 15438, 15442, 15446, 15451, 15455, 15459,
-    15464, 15468, 15472, 15476, 15481, 15485, 15489, 15494, 15498, 15502, 15506,
-    15511, 15515, 15519, 15524, 15528, 15532, 15536, 15541, 15545, 15549, 15553,
-    15558, 15562, 15566, 15570, 15574, 15579, 15583, 15587, 15591, 15595, 15600,
-    15604, 15608, 15612, 15616, 15621, 15625, 15629, 15633, 15637, 15642, 15646,
-    15650, 15654, 15658, 15662, 15666, 15671, 15675, 15679, 15683, 15687, 15691,
-    15695, 15700, 15704, 15708, 15712, 15716, 15720, 15724, 15728, 15732, 15736,
-    15741, 15745, 15749, 15753, 15757, 15761, 15765, 15769, 15773, 15777, 15781,
-    15785, 15789, 15793, 15797, 15802, 15806, 15810, 15814, 15818, 15822, 15826,
-    15830, 15834, 15838, 15842, 15846, 15850, 15854, 15858, 15862, 15866, 15870,
-    15874, 15878, 15882, 15886, 15890, 15894, 15898, 15902, 15906, 15910, 15913,
-    15917, 15921, 15925, 15929, 15933, 15937, 15941, 15945, 15949, 15953, 15957,
-    15961, 15965, 15969, 15972, 15976, 15980, 15984, 15988, 15992, 15996, 16000,
-    16004, 16008, 16011, 16015, 16019, 16023, 16027, 16031, 16035, 16039, 16042,
-    16046, 16050, 16054, 16058, 16062, 16066, 16069, 16073, 16077, 16081, 16085,
-    16089, 16092, 16096, 16100, 16104, 16108, 16111, 16115, 16119, 16123, 16127,
-    16130, 16134, 16138, 16142, 16146, 16149, 16153, 16157, 16161, 16164, 16168,
-    16172, 16176, 16180, 16183, 16187, 16191, 16195, 16198, 16202, 16206, 16210,
-    16213, 16217, 16221, 16224, 16228, 16232, 16236, 16239, 16243, 16247, 16251,
-    16254, 16258, 16262, 16265, 16269, 16273, 16276, 16280, 16284, 16287, 16291,
-    16295, 16299, 16302, 16306, 16310, 16313, 16317, 16321, 16324, 16328, 16332,
-    16335, 16339, 16342, 16346, 16350, 16353, 16357, 16361, 16364, 16368, 16372,
-    16375, 16379, 16382, 16386, 16390, 16393, 16397, 16400, 16404, 16408, 16411,
-    16415, 16418, 16422, 16426, 16429, 16433, 16436, 16440, 16444, 16447, 16451,
-    16454, 16458, 16461, 16465, 16469, 16472, 16476, 16479, 16483, 16486, 16490,
-    16493, 16497, 16500, 16504, 16508, 16511, 16515, 16518, 16522, 16525, 16529,
-    16532, 16536, 16539, 16543, 16546, 16550, 16553, 16557, 16560, 16564, 16567,
-    16571, 16574, 16578, 16581, 16585, 16588, 16592, 16595, 16599, 16602, 16606,
-    16609, 16612, 16616, 16619, 16623, 16626, 16630, 16633, 16637, 16640, 16644,
-    16647, 16650, 16654, 16657, 16661, 16664, 16668, 16671, 16674, 16678, 16681,
-    16685, 16688, 16692, 16695, 16698, 16702, 16705, 16709, 16712, 16715, 16719,
-    16722, 16726, 16729, 16732, 16736, 16739, 16742, 16746, 16749, 16753, 16756,
-    16759, 16763, 16766, 16769, 16773, 16776, 16779, 16783, 16786, 16790, 16793,
-    16796, 16800, 16803, 16806, 16810, 16813, 16816, 16820, 16823, 16826, 16830,
-    16833, 16836, 16840, 16843, 16846, 16849, 16853, 16856, 16859, 16863, 16866,
-    16869, 16873, 16876, 16879, 16882, 16886, 16889, 16892, 16896, 16899, 16902,
-    16905, 16909, 16912, 16915, 16919, 16922, 16925, 16928, 16932, 16935, 16938,
-    16941, 16945, 16948, 16951, 16954, 16958, 16961, 16964, 16967, 16971, 16974,
-    16977, 16980, 16983, 16987, 16990, 16993, 16996, 17000, 17003, 17006, 17009,
-    17012, 17016, 17019, 17022, 17025, 17028, 17032, 17035, 17038, 17041, 17044,
-    17048, 17051, 17054, 17057, 17060, 17064, 17067, 17070, 17073, 17076, 17079,
-    17083, 17086, 17089, 17092, 17095, 17098, 17102, 17105, 17108, 17111, 17114,
-    17117, 17120, 17124, 17127, 17130, 17133, 17136, 17139, 17142, 17145, 17149,
-    17152, 17155, 17158, 17161, 17164, 17167, 17170, 17174, 17177, 17180, 17183,
-    17186, 17189, 17192, 17195, 17198, 17202, 17205, 17208, 17211, 17214, 17217,
-    17220, 17223, 17226, 17229, 17232, 17235, 17239, 17242, 17245, 17248, 17251,
-    17254, 17257, 17260, 17263, 17266, 17269, 17272, 17275, 17278, 17281, 17284,
-    17287, 17291, 17294, 17297, 17300, 17303, 17306, 17309, 17312, 17315, 17318,
-    17321, 17324, 17327, 17330, 17333, 17336, 17339, 17342, 17345, 17348, 17351,
-    17354, 17357, 17360, 17363, 17366, 17369, 17372, 17375, 17378, 17381, 17384,
-    17387, 17390, 17393, 17396, 17399, 17402, 17405, 17408, 17411, 17414, 17417,
-    17420, 17423, 17426, 17429, 17432, 17435, 17438, 17441, 17444, 17446, 17449,
-    17452, 17455, 17458, 17461, 17464, 17467, 17470, 17473, 17476, 17479, 17482,
-    17485, 17488, 17491, 17494, 17496, 17499, 17502, 17505, 17508, 17511, 17514,
-    17517, 17520, 17523, 17526, 17529, 17531, 17534, 17537, 17540, 17543, 17546,
-    17549, 17552, 17555, 17558, 17560, 17563, 17566, 17569, 17572, 17575, 17578,
-    17581, 17584, 17586, 17589, 17592, 17595, 17598, 17601, 17604, 17607, 17609,
-    17612, 17615, 17618, 17621, 17624, 17627, 17629, 17632, 17635, 17638, 17641,
-    17644, 17646, 17649, 17652, 17655, 17658, 17661, 17664, 17666, 17669, 17672,
-    17675, 17678, 17681, 17683, 17686, 17689, 17692, 17695, 17697, 17700, 17703,
-    17706, 17709, 17711, 17714, 17717, 17720, 17723, 17726, 17728, 17731, 17734,
-    17737, 17740, 17742, 17745, 17748, 17751, 17753, 17756, 17759, 17762, 17765,
-    17767, 17770, 17773, 17776, 17778, 17781, 17784, 17787, 17790, 17792, 17795,
-    17798, 17801, 17803, 17806, 17809, 17812, 17814, 17817, 17820, 17823, 17825,
-    17828, 17831, 17834, 17836, 17839, 17842, 17845, 17847, 17850, 17853, 17856,
-    17858, 17861, 17864, 17867, 17869, 17872, 17875, 17877, 17880, 17883, 17886,
-    17888, 17891, 17894, 17896, 17899, 17902, 17905, 17907, 17910, 17913, 17915,
-    17918, 17921, 17923, 17926, 17929, 17932, 17934, 17937, 17940, 17942, 17945,
-    17948, 17950, 17953, 17956, 17958, 17961, 17964, 17966, 17969, 17972, 17975,
-    17977, 17980, 17983, 17985, 17988, 17991, 17993, 17996, 17998, 18001, 18004,
-    18006, 18009, 18012, 18014, 18017, 18020, 18022, 18025, 18028, 18030, 18033,
-    18036, 18038, 18041, 18044, 18046, 18049, 18051, 18054, 18057, 18059, 18062,
-    18065, 18067, 18070, 18072, 18075, 18078, 18080, 18083, 18086, 18088, 18091,
-    18093, 18096, 18099, 18101, 18104, 18106, 18109, 18112, 18114, 18117, 18119,
-    18122, 18125, 18127, 18130, 18132, 18135, 18138, 18140, 18143, 18145, 18148,
-    18151, 18153, 18156, 18158, 18161, 18163, 18166, 18169, 18171, 18174, 18176,
-    18179, 18181, 18184, 18187, 18189, 18192, 18194, 18197, 18199, 18202, 18205,
-    18207, 18210, 18212, 18215, 18217, 18220, 18222, 18225, 18228, 18230, 18233,
-    18235, 18238, 18240, 18243, 18245, 18248, 18250, 18253, 18255, 18258, 18261,
-    18263, 18266, 18268, 18271, 18273, 18276, 18278, 18281, 18283, 18286, 18288,
-    18291, 18293, 18296, 18298, 18301, 18303, 18306, 18308, 18311, 18313, 18316,
-    18318, 18321, 18323, 18326, 18328, 18331, 18333, 18336, 18338, 18341, 18343,
-    18346, 18348, 18351, 18353, 18356, 18358, 18361, 18363, 18366, 18368, 18371,
-    18373, 18376, 18378, 18381, 18383, 18386, 18388, 18390, 18393, 18395, 18398,
-    18400, 18403, 18405, 18408, 18410, 18413, 18415, 18418, 18420, 18422, 18425,
-    18427, 18430, 18432, 18435, 18437, 18440, 18442, 18445, 18447, 18449, 18452,
-    18454, 18457, 18459, 18462, 18464, 18466, 18469, 18471, 18474, 18476, 18479,
-    18481, 18483, 18486, 18488, 18491, 18493, 18496, 18498, 18500, 18503, 18505,
-    18508, 18510, 18512, 18515, 18517, 18520, 18522, 18525, 18527, 18529, 18532,
-    18534, 18537, 18539, 18541, 18544, 18546, 18549, 18551, 18553, 18556, 18558,
-    18561, 18563, 18565, 18568, 18570, 18572, 18575, 18577, 18580, 18582, 18584,
-    18587, 18589, 18591, 18594, 18596, 18599, 18601, 18603, 18606, 18608, 18610,
-    18613, 18615, 18618, 18620, 18622, 18625, 18627, 18629, 18632, 18634, 18636,
-    18639, 18641, 18644, 18646, 18648, 18651, 18653, 18655, 18658, 18660, 18662,
-    18665, 18667, 18669, 18672, 18674, 18676, 18679, 18681, 18683, 18686, 18688,
-    18690, 18693, 18695, 18697, 18700, 18702, 18704, 18707, 18709, 18711, 18714,
-    18716, 18718, 18721, 18723, 18725, 18728, 18730, 18732, 18734, 18737, 18739,
-    18741, 18744, 18746, 18748, 18751, 18753, 18755, 18758, 18760, 18762, 18764,
-    18767, 18769, 18771, 18774, 18776, 18778, 18781, 18783, 18785, 18787, 18790,
-    18792, 18794, 18797, 18799, 18801, 18803, 18806, 18808, 18810, 18813, 18815,
-    18817, 18819, 18822, 18824, 18826, 18828, 18831, 18833, 18835, 18838, 18840,
-    18842, 18844, 18847, 18849, 18851, 18853, 18856, 18858, 18860, 18862, 18865,
-    18867, 18869, 18871, 18874, 18876, 18878, 18880, 18883, 18885, 18887, 18889,
-    18892, 18894, 18896, 18898, 18901, 18903, 18905, 18907, 18910, 18912, 18914,
-    18916, 18919, 18921, 18923, 18925, 18927, 18930, 18932, 18934, 18936, 18939,
-    18941, 18943, 18945, 18947, 18950, 18952, 18954, 18956, 18959, 18961, 18963,
-    18965, 18967, 18970, 18972, 18974, 18976, 18978, 18981, 18983, 18985, 18987,
-    18989, 18992, 18994, 18996, 18998, 19000, 19003, 19005, 19007, 19009, 19011,
-    19014, 19016, 19018, 19020, 19022, 19025, 19027, 19029, 19031, 19033, 19036,
-    19038, 19040, 19042, 19044, 19046, 19049, 19051, 19053, 19055, 19057, 19060,
-    19062, 19064, 19066, 19068, 19070, 19073, 19075, 19077, 19079, 19081, 19083,
-    19086, 19088, 19090, 19092, 19094, 19096, 19098, 19101, 19103, 19105, 19107,
-    19109, 19111, 19114, 19116, 19118, 19120, 19122, 19124, 19126, 19129, 19131,
-    19133, 19135, 19137, 19139, 19141, 19144, 19146, 19148, 19150, 19152, 19154,
-    19156, 19159, 19161, 19163, 19165, 19167, 19169, 19171, 19173, 19176, 19178,
-    19180, 19182, 19184, 19186, 19188, 19190, 19193, 19195, 19197, 19199, 19201,
-    19203, 19205, 19207, 19209, 19212, 19214, 19216, 19218, 19220, 19222, 19224,
-    19226, 19228, 19231, 19233, 19235, 19237, 19239, 19241, 19243, 19245, 19247,
-    19249, 19252, 19254, 19256, 19258, 19260, 19262, 19264, 19266, 19268, 19270,
-    19272, 19275, 19277, 19279, 19281, 19283, 19285, 19287, 19289, 19291, 19293,
-    19295, 19297, 19300, 19302, 19304, 19306, 19308, 19310, 19312, 19314, 19316,
-    19318, 19320, 19322, 19324, 19326, 19329, 19331, 19333, 19335, 19337, 19339,
-    19341, 19343, 19345, 19347, 19349, 19351, 19353, 19355, 19357, 19359, 19361,
-    19364, 19366, 19368, 19370, 19372, 19374, 19376, 19378, 19380, 19382, 19384,
-    19386, 19388, 19390, 19392, 19394, 19396, 19398, 19400, 19402, 19404, 19406,
-    19408, 19411, 19413, 19415, 19417, 19419, 19421, 19423, 19425, 19427, 19429,
-    19431, 19433, 19435, 19437, 19439, 19441, 19443, 19445, 19447, 19449, 19451,
-    19453, 19455, 19457, 19459, 19461, 19463, 19465, 19467, 19469, 19471, 19473,
-    19475, 19477, 19479, 19481, 19483, 19485, 19487, 19489, 19491, 19493, 19495,
-    19497, 19499, 19501, 19503, 19505, 19507, 19509, 19511, 19513, 19515, 19517,
-    19519, 19521, 19523, 19525, 19527, 19529, 19531, 19533, 19535, 19537, 19539,
-    19541, 19543, 19545, 19547, 19549, 19551, 19553, 19555, 19557, 19559, 19561,
-    19563, 19565, 19567, 19569, 19571, 19573, 19575, 19577, 19579, 19581, 19583,
-    19584, 19586, 19588, 19590, 19592, 19594, 19596, 19598, 19600, 19602, 19604,
-    19606, 19608, 19610, 19612, 19614, 19616, 19618, 19620, 19622, 19624, 19626,
-    19628, 19630, 19631, 19633, 19635, 19637, 19639, 19641, 19643, 19645, 19647,
-    19649, 19651, 19653, 19655, 19657, 19659, 19661, 19663, 19665, 19666, 19668,
-    19670, 19672, 19674, 19676, 19678, 19680, 19682, 19684, 19686, 19688, 19690,
-    19692, 19693, 19695, 19697, 19699, 19701, 19703, 19705, 19707, 19709, 19711,
-    19713, 19715, 19717, 19718, 19720, 19722, 19724, 19726, 19728, 19730, 19732,
-    19734, 19736, 19738, 19740, 19741, 19743, 19745, 19747, 19749, 19751, 19753,
-    19755, 19757, 19759, 19760, 19762, 19764, 19766, 19768, 19770, 19772, 19774,
-    19776, 19778, 19779, 19781, 19783, 19785, 19787, 19789, 19791, 19793, 19795,
-    19797, 19798, 19800, 19802, 19804, 19806, 19808, 19810, 19812, 19813, 19815,
-    19817, 19819, 19821, 19823, 19825, 19827, 19829, 19830, 19832, 19834, 19836,
-    19838, 19840, 19842, 19844, 19845, 19847, 19849, 19851, 19853, 19855, 19857,
-    19858, 19860, 19862, 19864, 19866, 19868, 19870, 19872, 19873, 19875, 19877,
-    19879, 19881, 19883, 19885, 19886, 19888, 19890, 19892, 19894, 19896, 19898,
-    19899, 19901, 19903, 19905, 19907, 19909, 19910, 19912, 19914, 19916, 19918,
-    19920, 19922, 19923, 19925, 19927, 19929, 19931, 19933, 19934, 19936, 19938,
-    19940, 19942, 19944, 19946, 19947, 19949, 19951, 19953, 19955, 19957, 19958,
-    19960, 19962, 19964, 19966, 19967, 19969, 19971, 19973, 19975, 19977, 19978,
-    19980, 19982, 19984, 19986, 19988, 19989, 19991, 19993, 19995, 19997, 19998,
-    20000, 20002, 20004, 20006, 20008, 20009, 20011, 20013, 20015, 20017, 20018,
-    20020, 20022, 20024, 20026, 20027, 20029, 20031, 20033, 20035, 20037, 20038,
-    20040, 20042, 20044, 20046, 20047, 20049, 20051, 20053, 20055, 20056, 20058,
-    20060, 20062, 20064, 20065, 20067, 20069, 20071, 20072, 20074, 20076, 20078,
-    20080, 20081, 20083, 20085, 20087, 20089, 20090, 20092, 20094, 20096, 20098,
-    20099, 20101, 20103, 20105, 20106, 20108, 20110, 20112, 20114, 20115, 20117,
-    20119, 20121, 20122, 20124, 20126, 20128, 20130, 20131, 20133, 20135, 20137,
-    20138, 20140, 20142, 20144, 20145, 20147, 20149, 20151, 20153, 20154, 20156,
-    20158, 20160, 20161, 20163, 20165, 20167, 20168, 20170, 20172, 20174, 20175,
-    20177, 20179, 20181, 20182, 20184, 20186, 20188, 20189, 20191, 20193, 20195,
-    20196, 20198, 20200, 20202, 20203, 20205, 20207, 20209, 20210, 20212, 20214,
-    20216, 20217, 20219, 20221, 20223, 20224, 20226, 20228, 20230, 20231, 20233,
-    20235, 20237, 20238, 20240, 20242, 20244, 20245, 20247, 20249, 20250, 20252,
-    20254, 20256, 20257, 20259, 20261, 20263, 20264, 20266, 20268, 20270, 20271,
-    20273, 20275, 20276, 20278, 20280, 20282, 20283, 20285, 20287, 20288, 20290,
-    20292, 20294, 20295, 20297, 20299, 20301, 20302, 20304, 20306, 20307, 20309,
-    20311, 20313, 20314, 20316, 20318, 20319, 20321, 20323, 20324, 20326, 20328,
-    20330, 20331, 20333, 20335, 20336, 20338, 20340, 20342, 20343, 20345, 20347,
-    20348, 20350, 20352, 20353, 20355, 20357, 20359, 20360, 20362, 20364, 20365,
-    20367, 20369, 20370, 20372, 20374, 20375, 20377, 20379, 20381, 20382, 20384,
-    20386, 20387, 20389, 20391, 20392, 20394, 20396, 20397, 20399, 20401, 20402,
-    20404, 20406, 20408, 20409, 20411, 20413, 20414, 20416, 20418, 20419, 20421,
-    20423, 20424, 20426, 20428, 20429, 20431, 20433, 20434, 20436, 20438, 20439,
-    20441, 20443, 20444, 20446, 20448, 20449, 20451, 20453, 20454, 20456, 20458,
-    20459, 20461, 20463, 20464, 20466, 20468, 20469, 20471, 20473, 20474, 20476,
-    20478, 20479, 20481, 20483, 20484, 20486, 20488, 20489, 20491, 20493, 20494,
-    20496, 20498, 20499, 20501, 20503, 20504, 20506, 20507, 20509, 20511, 20512,
-    20514, 20516, 20517, 20519, 20521, 20522, 20524, 20526, 20527, 20529, 20531,
-    20532, 20534, 20535, 20537, 20539, 20540, 20542, 20544, 20545, 20547, 20549,
-    20550, 20552, 20553, 20555, 20557, 20558, 20560, 20562, 20563, 20565, 20567,
-    20568, 20570, 20571, 20573, 20575, 20576, 20578, 20580, 20581, 20583, 20584,
-    20586, 20588, 20589, 20591, 20593, 20594, 20596, 20597, 20599, 20601, 20602,
-    20604, 20606, 20607, 20609, 20610, 20612, 20614, 20615, 20617, 20619, 20620,
-    20622, 20623, 20625, 20627, 20628, 20630, 20631, 20633, 20635, 20636, 20638,
-    20639, 20641, 20643, 20644, 20646, 20648, 20649, 20651, 20652, 20654, 20656,
-    20657, 20659, 20660, 20662, 20664, 20665, 20667, 20668, 20670, 20672, 20673,
-    20675, 20676, 20678, 20680, 20681, 20683, 20684, 20686, 20688, 20689, 20691,
-    20692, 20694, 20695, 20697, 20699, 20700, 20702, 20703, 20705, 20707, 20708,
-    20710, 20711, 20713, 20715, 20716, 20718, 20719, 20721, 20722, 20724, 20726,
-    20727, 20729, 20730, 20732, 20734, 20735, 20737, 20738, 20740, 20741, 20743,
-    20745, 20746, 20748, 20749, 20751, 20752, 20754, 20756, 20757, 20759, 20760,
-    20762, 20763, 20765, 20767, 20768, 20770, 20771, 20773, 20774, 20776, 20778,
-    20779, 20781, 20782, 20784, 20785, 20787, 20789, 20790, 20792, 20793, 20795,
-    20796, 20798, 20800, 20801, 20803, 20804, 20806, 20807, 20809, 20810, 20812,
-    20814, 20815, 20817, 20818, 20820, 20821, 20823, 20824, 20826, 20828, 20829,
-    20831, 20832, 20834, 20835, 20837, 20838, 20840, 20841, 20843, 20845, 20846,
-    20848, 20849, 20851, 20852, 20854, 20855, 20857, 20859, 20860, 20862, 20863,
-    20865, 20866, 20868, 20869, 20871, 20872, 20874, 20875, 20877, 20879, 20880,
-    20882, 20883, 20885, 20886, 20888, 20889, 20891, 20892, 20894, 20895, 20897,
-    20898, 20900, 20902, 20903, 20905, 20906, 20908, 20909, 20911, 20912, 20914,
-    20915, 20917, 20918, 20920, 20921, 20923, 20924, 20926, 20927, 20929, 20931,
-    20932, 20934, 20935, 20937, 20938, 20940, 20941, 20943, 20944, 20946, 20947,
-    20949, 20950, 20952, 20953, 20955, 20956, 20958, 20959, 20961, 20962, 20964,
-    20965, 20967, 20968, 20970, 20971, 20973, 20975, 20976, 20978, 20979, 20981,
-    20982, 20984, 20985, 20987, 20988, 20990, 20991, 20993, 20994, 20996, 20997,
-    20999, 21000, 21002, 21003, 21005, 21006, 21008, 21009, 21011, 21012, 21014,
-    21015, 21017, 21018, 21020, 21021, 21023, 21024, 21026, 21027, 21029, 21030,
-    21032, 21033, 21035, 21036, 21038, 21039, 21041, 21042, 21044, 21045, 21046,
-    21048, 21049, 21051, 21052, 21054, 21055, 21057, 21058, 21060, 21061, 21063,
-    21064, 21066, 21067, 21069, 21070, 21072, 21073, 21075, 21076, 21078, 21079,
-    21081, 21082, 21084, 21085, 21087, 21088, 21089, 21091, 21092, 21094, 21095,
-    21097, 21098, 21100, 21101, 21103, 21104, 21106, 21107, 21109, 21110, 21112,
-    21113, 21115, 21116, 21117, 21119, 21120, 21122, 21123, 21125, 21126, 21128,
-    21129, 21131, 21132, 21134, 21135, 21137, 21138, 21139, 21141, 21142, 21144,
-    21145, 21147, 21148, 21150, 21151, 21153, 21154, 21156, 21157, 21158, 21160,
-    21161, 21163, 21164, 21166, 21167, 21169, 21170, 21172, 21173, 21174, 21176,
-    21177, 21179, 21180, 21182, 21183, 21185, 21186, 21188, 21189, 21190, 21192,
-    21193, 21195, 21196, 21198, 21199, 21201, 21202, 21203, 21205, 21206, 21208,
-    21209, 21211, 21212, 21214, 21215, 21216, 21218, 21219, 21221, 21222, 21224,
-    21225, 21227, 21228, 21229, 21231, 21232, 21234, 21235, 21237, 21238, 21239,
-    21241, 21242, 21244, 21245, 21247, 21248, 21250, 21251, 21252, 21254, 21255,
-    21257, 21258, 21260, 21261, 21262, 21264, 21265, 21267, 21268, 21270, 21271,
-    21272, 21274, 21275, 21277, 21278, 21280, 21281, 21282, 21284, 21285, 21287,
-    21288, 21289, 21291, 21292, 21294, 21295, 21297, 21298, 21299, 21301, 21302,
-    21304, 21305, 21307, 21308, 21309, 21311, 21312, 21314, 21315, 21316, 21318,
-    21319, 21321, 21322, 21323, 21325, 21326, 21328, 21329, 21331, 21332, 21333,
-    21335, 21336, 21338, 21339, 21340, 21342, 21343, 21345, 21346, 21347, 21349,
-    21350, 21352, 21353, 21354, 21356, 21357, 21359, 21360, 21361, 21363, 21364,
-    21366, 21367, 21368, 21370, 21371, 21373, 21374, 21375, 21377, 21378, 21380,
-    21381, 21382, 21384, 21385, 21387, 21388, 21389, 21391, 21392, 21394, 21395,
-    21396, 21398, 21399, 21401, 21402, 21403, 21405, 21406, 21408, 21409, 21410,
-    21412, 21413, 21415, 21416, 21417, 21419, 21420, 21421, 21423, 21424, 21426,
-    21427, 21428, 21430, 21431, 21433, 21434, 21435, 21437, 21438, 21439, 21441,
-    21442, 21444, 21445, 21446, 21448, 21449, 21450, 21452, 21453, 21455, 21456,
-    21457, 21459, 21460, 21462, 21463, 21464, 21466, 21467, 21468, 21470, 21471,
-    21473, 21474, 21475, 21477, 21478, 21479, 21481, 21482, 21483, 21485, 21486,
-    21488, 21489, 21490, 21492, 21493, 21494, 21496, 21497, 21499, 21500, 21501,
-    21503, 21504, 21505, 21507, 21508, 21509, 21511, 21512, 21514, 21515, 21516,
-    21518, 21519, 21520, 21522, 21523, 21524, 21526, 21527, 21529, 21530, 21531,
-    21533, 21534, 21535, 21537, 21538, 21539, 21541, 21542, 21543, 21545, 21546,
-    21547, 21549, 21550, 21552, 21553, 21554, 21556, 21557, 21558, 21560, 21561,
-    21562, 21564, 21565, 21566, 21568, 21569, 21570, 21572, 21573, 21575, 21576,
-    21577, 21579, 21580, 21581, 21583, 21584, 21585, 21587, 21588, 21589, 21591,
-    21592, 21593, 21595, 21596, 21597, 21599, 21600, 21601, 21603, 21604, 21605,
-    21607, 21608, 21609, 21611, 21612, 21613, 21615, 21616, 21617, 21619, 21620,
-    21621, 21623, 21624, 21625, 21627, 21628, 21629, 21631, 21632, 21633, 21635,
-    21636, 21637, 21639, 21640, 21641, 21643, 21644, 21645, 21647, 21648, 21649,
-    21651, 21652, 21653, 21655, 21656, 21657, 21659, 21660, 21661, 21663, 21664,
-    21665, 21667, 21668, 21669, 21671, 21672, 21673, 21675, 21676, 21677, 21679,
-    21680, 21681, 21682, 21684, 21685, 21686, 21688, 21689, 21690, 21692, 21693,
-    21694, 21696, 21697, 21698, 21700, 21701, 21702, 21704, 21705, 21706, 21707,
-    21709, 21710, 21711, 21713, 21714, 21715, 21717, 21718, 21719, 21721, 21722,
-    21723, 21725, 21726, 21727, 21728, 21730, 21731, 21732, 21734, 21735, 21736,
-    21738, 21739, 21740, 21742, 21743, 21744, 21745, 21747, 21748, 21749, 21751,
-    21752, 21753, 21755, 21756, 21757, 21758, 21760, 21761, 21762, 21764, 21765,
-    21766, 21768, 21769, 21770, 21771, 21773, 21774, 21775, 21777, 21778, 21779,
-    21781, 21782, 21783, 21784, 21786, 21787, 21788, 21790, 21791, 21792, 21793,
-    21795, 21796, 21797, 21799, 21800, 21801, 21802, 21804, 21805, 21806, 21808,
-    21809, 21810, 21811, 21813, 21814, 21815, 21817, 21818, 21819, 21821, 21822,
-    21823, 21824, 21826, 21827, 21828, 21829, 21831, 21832, 21833, 21835, 21836,
-    21837, 21838, 21840, 21841, 21842, 21844, 21845, 21846, 21847, 21849, 21850,
-    21851, 21853, 21854, 21855, 21856, 21858, 21859, 21860, 21861, 21863, 21864,
-    21865, 21867, 21868, 21869, 21870, 21872, 21873, 21874, 21875, 21877, 21878,
-    21879, 21881, 21882, 21883, 21884, 21886, 21887, 21888, 21889, 21891, 21892,
-    21893, 21895, 21896, 21897, 21898, 21900, 21901, 21902, 21903, 21905, 21906,
-    21907, 21908, 21910, 21911, 21912, 21913, 21915, 21916, 21917, 21919, 21920,
-    21921, 21922, 21924, 21925, 21926, 21927, 21929, 21930, 21931, 21932, 21934,
-    21935, 21936, 21937, 21939, 21940, 21941, 21942, 21944, 21945, 21946, 21947,
-    21949, 21950, 21951, 21952, 21954, 21955, 21956, 21957, 21959, 21960, 21961,
-    21963, 21964, 21965, 21966, 21968, 21969, 21970, 21971, 21973, 21974, 21975,
-    21976, 21977, 21979, 21980, 21981, 21982, 21984, 21985, 21986, 21987, 21989,
-    21990, 21991, 21992, 21994, 21995, 21996, 21997, 21999, 22000, 22001, 22002,
-    22004, 22005, 22006, 22007, 22009, 22010, 22011, 22012, 22014, 22015, 22016,
-    22017, 22018, 22020, 22021, 22022, 22023, 22025, 22026, 22027, 22028, 22030,
-    22031, 22032, 22033, 22035, 22036, 22037, 22038, 22039, 22041, 22042, 22043,
-    22044, 22046, 22047, 22048, 22049, 22051, 22052, 22053, 22054, 22055, 22057,
-    22058, 22059, 22060, 22062, 22063, 22064, 22065, 22067, 22068, 22069, 22070,
-    22071, 22073, 22074, 22075, 22076, 22078, 22079, 22080, 22081, 22082, 22084,
-    22085, 22086, 22087, 22089, 22090, 22091, 22092, 22093, 22095, 22096, 22097,
-    22098, 22100, 22101, 22102, 22103, 22104, 22106, 22107, 22108, 22109, 22111,
-    22112, 22113, 22114, 22115, 22117, 22118, 22119, 22120, 22121, 22123, 22124,
-    22125, 22126, 22128, 22129, 22130, 22131, 22132, 22134, 22135, 22136, 22137,
-    22138, 22140, 22141, 22142, 22143, 22144, 22146, 22147, 22148, 22149, 22150,
-    22152, 22153, 22154, 22155, 22157, 22158, 22159, 22160, 22161, 22163, 22164,
-    22165, 22166, 22167, 22169, 22170, 22171, 22172, 22173, 22175, 22176, 22177,
-    22178, 22179, 22181, 22182, 22183, 22184, 22185, 22187, 22188, 22189, 22190,
-    22191, 22193, 22194, 22195, 22196, 22197, 22199, 22200, 22201, 22202, 22203,
-    22205, 22206, 22207, 22208, 22209, 22210, 22212, 22213, 22214, 22215, 22216,
-    22218, 22219, 22220, 22221, 22222, 22224, 22225, 22226, 22227, 22228, 22230,
-    22231, 22232, 22233, 22234, 22235, 22237, 22238, 22239, 22240, 22241, 22243,
-    22244, 22245, 22246, 22247, 22249, 22250, 22251, 22252, 22253, 22254, 22256,
-    22257, 22258, 22259, 22260, 22262, 22263, 22264, 22265, 22266, 22267, 22269,
-    22270, 22271, 22272, 22273, 22275, 22276, 22277, 22278, 22279, 22280, 22282,
-    22283, 22284, 22285, 22286, 22287, 22289, 22290, 22291, 22292, 22293, 22295,
-    22296, 22297, 22298, 22299, 22300, 22302, 22303, 22304, 22305, 22306, 22307,
-    22309, 22310, 22311, 22312, 22313, 22314, 22316, 22317, 22318, 22319, 22320,
-    22321, 22323, 22324, 22325, 22326, 22327, 22328, 22330, 22331, 22332, 22333,
-    22334, 22335, 22337, 22338, 22339, 22340, 22341, 22342, 22344, 22345, 22346,
-    22347, 22348, 22349, 22351, 22352, 22353, 22354, 22355, 22356, 22358, 22359,
-    22360, 22361, 22362, 22363, 22365, 22366, 22367, 22368, 22369, 22370, 22371,
-    22373, 22374, 22375, 22376, 22377, 22378, 22380, 22381, 22382, 22383, 22384,
-    22385, 22387, 22388, 22389, 22390, 22391, 22392, 22393, 22395, 22396, 22397,
-    22398, 22399, 22400, 22401, 22403, 22404, 22405, 22406, 22407, 22408, 22410,
-    22411, 22412, 22413, 22414, 22415, 22416, 22418, 22419, 22420, 22421, 22422,
-    22423, 22424, 22426, 22427, 22428, 22429, 22430, 22431, 22432, 22434, 22435,
-    22436, 22437, 22438, 22439, 22440, 22442, 22443, 22444, 22445, 22446, 22447,
-    22448, 22450, 22451, 22452, 22453, 22454, 22455, 22456, 22458, 22459, 22460,
-    22461, 22462, 22463, 22464, 22466, 22467, 22468, 22469, 22470, 22471, 22472,
-    22473, 22475, 22476, 22477, 22478, 22479, 22480, 22481, 22483, 22484, 22485,
-    22486, 22487, 22488, 22489, 22490, 22492, 22493, 22494, 22495, 22496, 22497,
-    22498, 22500, 22501, 22502, 22503, 22504, 22505, 22506, 22507, 22509, 22510,
-    22511, 22512, 22513, 22514, 22515, 22516, 22518, 22519, 22520, 22521, 22522,
-    22523, 22524, 22525, 22527, 22528, 22529, 22530, 22531, 22532, 22533, 22534,
-    22536, 22537, 22538, 22539, 22540, 22541, 22542, 22543, 22545, 22546, 22547,
-    22548, 22549, 22550, 22551, 22552, 22553, 22555, 22556, 22557, 22558, 22559,
-    22560, 22561, 22562, 22564, 22565, 22566, 22567, 22568, 22569, 22570, 22571,
-    22572, 22574, 22575, 22576, 22577, 22578, 22579, 22580, 22581, 22582, 22584,
-    22585, 22586, 22587, 22588, 22589, 22590, 22591, 22592, 22594, 22595, 22596,
-    22597, 22598, 22599, 22600, 22601, 22602, 22604, 22605, 22606, 22607, 22608,
-    22609, 22610, 22611, 22612, 22613, 22615, 22616, 22617, 22618, 22619, 22620,
-    22621, 22622, 22623, 22625, 22626, 22627, 22628, 22629, 22630, 22631, 22632,
-    22633, 22634, 22636, 22637, 22638, 22639, 22640, 22641, 22642, 22643, 22644,
-    22645, 22647, 22648, 22649, 22650, 22651, 22652, 22653, 22654, 22655, 22656,
-    22657, 22659, 22660, 22661, 22662, 22663, 22664, 22665, 22666, 22667, 22668,
-    22670, 22671, 22672, 22673, 22674, 22675, 22676, 22677, 22678, 22679, 22680,
-    22682, 22683, 22684, 22685, 22686, 22687, 22688, 22689, 22690, 22691, 22692,
-    22694, 22695, 22696, 22697, 22698, 22699, 22700, 22701, 22702, 22703, 22704,
-    22705, 22707, 22708, 22709, 22710, 22711, 22712, 22713, 22714, 22715, 22716,
-    22717, 22719, 22720, 22721, 22722, 22723, 22724, 22725, 22726, 22727, 22728,
-    22729, 22730, 22731, 22733, 22734, 22735, 22736, 22737, 22738, 22739, 22740,
-    22741, 22742, 22743, 22744, 22746, 22747, 22748, 22749, 22750, 22751, 22752,
-    22753, 22754, 22755, 22756, 22757, 22758, 22760, 22761, 22762, 22763, 22764,
-    22765, 22766, 22767, 22768, 22769, 22770, 22771, 22772, 22773, 22775, 22776,
-    22777, 22778, 22779, 22780, 22781, 22782, 22783, 22784, 22785, 22786, 22787,
-    22788, 22790, 22791, 22792, 22793, 22794, 22795, 22796, 22797, 22798, 22799,
-    22800, 22801, 22802, 22803, 22804, 22806, 22807, 22808, 22809, 22810, 22811,
-    22812, 22813, 22814, 22815, 22816, 22817, 22818, 22819, 22820, 22821, 22823,
-    22824, 22825, 22826, 22827, 22828, 22829, 22830, 22831, 22832, 22833, 22834,
-    22835, 22836, 22837, 22838, 22840, 22841, 22842, 22843, 22844, 22845, 22846,
-    22847, 22848, 22849, 22850, 22851, 22852, 22853, 22854, 22855, 22856, 22857,
-    22859, 22860, 22861, 22862, 22863, 22864, 22865, 22866, 22867, 22868, 22869,
-    22870, 22871, 22872, 22873, 22874, 22875, 22876, 22877, 22879, 22880, 22881,
-    22882, 22883, 22884, 22885, 22886, 22887, 22888, 22889, 22890, 22891, 22892,
-    22893, 22894, 22895, 22896, 22897, 22898, 22900, 22901, 22902, 22903, 22904,
-    22905, 22906, 22907, 22908, 22909, 22910, 22911, 22912, 22913, 22914, 22915,
-    22916, 22917, 22918, 22919, 22920, 22921, 22922, 22924, 22925, 22926, 22927,
-    22928, 22929, 22930, 22931, 22932, 22933, 22934, 22935, 22936, 22937, 22938,
-    22939, 22940, 22941, 22942, 22943, 22944, 22945, 22946, 22947, 22948, 22950,
-    22951, 22952, 22953, 22954, 22955, 22956, 22957, 22958, 22959, 22960, 22961,
-    22962, 22963, 22964, 22965, 22966, 22967, 22968, 22969, 22970, 22971, 22972,
-    22973, 22974, 22975, 22976, 22977, 22978, 22979, 22981, 22982, 22983, 22984,
-    22985, 22986, 22987, 22988, 22989, 22990, 22991, 22992, 22993, 22994, 22995,
-    22996, 22997, 22998, 22999, 23000, 23001, 23002, 23003, 23004, 23005, 23006,
-    23007, 23008, 23009, 23010, 23011, 23012, 23013, 23014, 23015, 23016, 23017,
-    23019, 23020, 23021, 23022, 23023, 23024, 23025, 23026, 23027, 23028, 23029,
-    23030, 23031, 23032, 23033, 23034, 23035, 23036, 23037, 23038, 23039, 23040,
-    23041, 23042, 23043, 23044, 23045, 23046, 23047, 23048, 23049, 23050, 23051,
-    23052, 23053, 23054, 23055, 23056, 23057, 23058, 23059, 23060, 23061, 23062,
-    23063, 23064, 23065, 23066, 23067, 23068, 23069, 23070, 23071, 23072, 23073,
-    23074, 23076, 23077, 23078, 23079, 23080, 23081, 23082, 23083, 23084, 23085,
-    23086, 23087, 23088, 23089, 23090, 23091, 23092, 23093, 23094, 23095, 23096,
-    23097, 23098, 23099, 23100, 23101, 23102, 23103, 23104, 23105, 23106, 23107,
-    23108, 23109, 23110, 23111, 23112, 23113, 23114, 23115, 23116, 23117, 23118,
-    23119, 23120, 23121, 23122, 23123, 23124, 23125, 23126, 23127, 23128, 23129,
-    23130, 23131, 23132, 23133, 23134, 23135, 23136, 23137, 23138, 23139, 23140,
-    23141, 23142, 23143, 23144, 23145, 23146, 23147, 23148, 23149, 23150, 23151,
-    23152, 23153, 23154, 23155, 23156, 23157, 23158, 23159, 23160, 23161, 23162,
-    23163, 23164, 23165, 23166, 23167, 23168, 23169, 23170, 23171, 23172, 23173,
-    23174, 23175, 23176, 23177, 23178, 23179, 23180, 23181, 23182, 23183, 23184,
-    23185, 23186, 23187, 23188, 23189, 23190, 23191, 23192, 23193, 23194, 23195,
-    23196, 23197, 23198, 23199, 23200, 23201, 23202, 23202, 23203, 23204, 23205,
-    23206, 23207, 23208, 23209, 23210, 23211, 23212, 23213, 23214, 23215, 23216,
-    23217, 23218, 23219, 23220, 23221, 23222, 23223, 23224, 23225, 23226, 23227,
-    23228, 23229, 23230, 23231, 23232, 23233, 23234, 23235, 23236, 23237, 23238,
-    23239, 23240, 23241, 23242, 23243, 23244, 23245, 23246, 23247, 23248, 23249,
-    23250, 23251, 23252, 23253, 23254, 23255, 23256, 23257, 23258, 23259, 23259,
-    23260, 23261, 23262, 23263, 23264, 23265, 23266, 23267, 23268, 23269, 23270,
-    23271, 23272, 23273, 23274, 23275, 23276, 23277, 23278, 23279, 23280, 23281,
-    23282, 23283, 23284, 23285, 23286, 23287, 23288, 23289, 23290, 23291, 23292,
-    23293, 23294, 23295, 23296, 23296, 23297, 23298, 23299, 23300, 23301, 23302,
-    23303, 23304, 23305, 23306, 23307, 23308, 23309, 23310, 23311, 23312, 23313,
-    23314, 23315, 23316, 23317, 23318, 23319, 23320, 23321, 23322, 23323, 23324,
-    23325, 23326, 23326, 23327, 23328, 23329, 23330, 23331, 23332, 23333, 23334,
-    23335, 23336, 23337, 23338, 23339, 23340, 23341, 23342, 23343, 23344, 23345,
-    23346, 23347, 23348, 23349, 23350, 23351, 23352, 23352, 23353, 23354, 23355,
-    23356, 23357, 23358, 23359, 23360, 23361, 23362, 23363, 23364, 23365, 23366,
-    23367, 23368, 23369, 23370, 23371, 23372, 23373, 23374, 23375, 23375, 23376,
-    23377, 23378, 23379, 23380, 23381, 23382, 23383, 23384, 23385, 23386, 23387,
-    23388, 23389, 23390, 23391, 23392, 23393, 23394, 23395, 23396, 23396, 23397,
-    23398, 23399, 23400, 23401, 23402, 23403, 23404, 23405, 23406, 23407, 23408,
-    23409, 23410, 23411, 23412, 23413, 23414, 23415, 23415, 23416, 23417, 23418,
-    23419, 23420, 23421, 23422, 23423, 23424, 23425, 23426, 23427, 23428, 23429,
-    23430, 23431, 23432, 23433, 23433, 23434, 23435, 23436, 23437, 23438, 23439,
-    23440, 23441, 23442, 23443, 23444, 23445, 23446, 23447, 23448, 23449, 23450,
-    23450, 23451, 23452, 23453, 23454, 23455, 23456, 23457, 23458, 23459, 23460,
-    23461, 23462, 23463, 23464, 23465, 23466, 23466, 23467, 23468, 23469, 23470,
-    23471, 23472, 23473, 23474, 23475, 23476, 23477, 23478, 23479, 23480, 23481,
-    23481, 23482, 23483, 23484, 23485, 23486, 23487, 23488, 23489, 23490, 23491,
-    23492, 23493, 23494, 23495, 23495, 23496, 23497, 23498, 23499, 23500, 23501,
-    23502, 23503, 23504, 23505, 23506, 23507, 23508, 23509, 23509, 23510, 23511,
-    23512, 23513, 23514, 23515, 23516, 23517, 23518, 23519, 23520, 23521, 23522,
-    23523, 23523, 23524, 23525, 23526, 23527, 23528, 23529, 23530, 23531, 23532,
-    23533, 23534, 23535, 23536, 23536, 23537, 23538, 23539, 23540, 23541, 23542,
-    23543, 23544, 23545, 23546, 23547, 23548, 23548, 23549, 23550, 23551, 23552,
-    23553, 23554, 23555, 23556, 23557, 23558, 23559, 23560, 23560, 23561, 23562,
-    23563, 23564, 23565, 23566, 23567, 23568, 23569, 23570, 23571, 23572, 23572,
-    23573, 23574, 23575, 23576, 23577, 23578, 23579, 23580, 23581, 23582, 23583,
-    23584, 23584, 23585, 23586, 23587, 23588, 23589, 23590, 23591, 23592, 23593,
-    23594, 23595, 23595, 23596, 23597, 23598, 23599, 23600, 23601, 23602, 23603,
-    23604, 23605, 23606, 23606, 23607, 23608, 23609, 23610, 23611, 23612, 23613,
-    23614, 23615, 23616, 23616, 23617, 23618, 23619, 23620, 23621, 23622, 23623,
-    23624, 23625, 23626, 23627, 23627, 23628, 23629, 23630, 23631, 23632, 23633,
-    23634, 23635, 23636, 23637, 23637, 23638, 23639, 23640, 23641, 23642, 23643,
-    23644, 23645, 23646, 23647, 23647, 23648, 23649, 23650, 23651, 23652, 23653,
-    23654, 23655, 23656, 23657, 23657, 23658, 23659, 23660, 23661, 23662, 23663,
-    23664, 23665, 23666, 23666, 23667, 23668, 23669, 23670, 23671, 23672, 23673,
-    23674, 23675, 23676, 23676, 23677, 23678, 23679, 23680, 23681, 23682, 23683,
-    23684, 23685, 23685, 23686, 23687, 23688, 23689, 23690, 23691, 23692, 23693,
-    23694, 23694, 23695, 23696, 23697, 23698, 23699, 23700, 23701, 23702, 23703,
-    23703, 23704, 23705, 23706, 23707, 23708, 23709, 23710, 23711, 23712, 23712,
-    23713, 23714, 23715, 23716, 23717, 23718, 23719, 23720, 23720, 23721, 23722,
-    23723, 23724, 23725, 23726, 23727, 23728, 23729, 23729, 23730, 23731, 23732,
-    23733, 23734, 23735, 23736, 23737, 23737, 23738, 23739, 23740, 23741, 23742,
-    23743, 23744, 23745, 23745, 23746, 23747, 23748, 23749, 23750, 23751, 23752,
-    23753, 23753, 23754, 23755, 23756, 23757, 23758, 23759, 23760, 23761, 23761,
-    23762, 23763, 23764, 23765, 23766, 23767, 23768, 23769, 23769, 23770, 23771,
-    23772, 23773, 23774, 23775, 23776, 23777, 23777, 23778, 23779, 23780, 23781,
-    23782, 23783, 23784, 23785, 23785, 23786, 23787, 23788, 23789, 23790, 23791,
-    23792, 23792, 23793, 23794, 23795, 23796, 23797, 23798, 23799, 23800, 23800,
-    23801, 23802, 23803, 23804, 23805, 23806, 23807, 23807, 23808, 23809, 23810,
-    23811, 23812, 23813, 23814, 23815, 23815, 23816, 23817, 23818, 23819, 23820,
-    23821, 23822, 23822, 23823, 23824, 23825, 23826, 23827, 23828, 23829, 23829,
-    23830, 23831, 23832, 23833, 23834, 23835, 23836, 23836, 23837, 23838, 23839,
-    23840, 23841, 23842, 23843, 23843, 23844, 23845, 23846, 23847, 23848, 23849,
-    23850, 23850, 23851, 23852, 23853, 23854, 23855, 23856, 23857, 23857, 23858,
-    23859, 23860, 23861, 23862, 23863, 23864, 23864, 23865, 23866, 23867, 23868,
-    23869, 23870, 23870, 23871, 23872, 23873, 23874, 23875, 23876, 23877, 23877,
-    23878, 23879, 23880, 23881, 23882, 23883, 23884, 23884, 23885, 23886, 23887,
-    23888, 23889, 23890, 23890, 23891, 23892, 23893, 23894, 23895, 23896, 23897,
-    23897, 23898, 23899, 23900, 23901, 23902, 23903, 23903, 23904, 23905, 23906,
-    23907, 23908, 23909, 23909, 23910, 23911, 23912, 23913, 23914, 23915, 23916,
-    23916, 23917, 23918, 23919, 23920, 23921, 23922, 23922, 23923, 23924, 23925,
-    23926, 23927, 23928, 23928, 23929, 23930, 23931, 23932, 23933, 23934, 23934,
-    23935, 23936, 23937, 23938, 23939, 23940, 23940, 23941, 23942, 23943, 23944,
-    23945, 23946, 23946, 23947, 23948, 23949, 23950, 23951, 23952, 23952, 23953,
-    23954, 23955, 23956, 23957, 23958, 23958, 23959, 23960, 23961, 23962, 23963,
-    23964, 23964, 23965, 23966, 23967, 23968, 23969, 23970, 23970, 23971, 23972,
-    23973, 23974, 23975, 23976, 23976, 23977, 23978, 23979, 23980, 23981, 23982,
-    23982, 23983, 23984, 23985, 23986, 23987, 23987, 23988, 23989, 23990, 23991,
-    23992, 23993, 23993, 23994, 23995, 23996, 23997, 23998, 23999, 23999, 24000,
-    24001, 24002, 24003, 24004, 24004, 24005, 24006, 24007, 24008, 24009, 24010,
-    24010, 24011, 24012, 24013, 24014, 24015, 24015, 24016, 24017, 24018, 24019,
-    24020, 24021, 24021, 24022, 24023, 24024, 24025, 24026, 24026, 24027, 24028,
-    24029, 24030, 24031, 24032, 24032, 24033, 24034, 24035, 24036, 24037, 24037,
-    24038, 24039, 24040, 24041, 24042, 24043, 24043, 24044, 24045, 24046, 24047,
-    24048, 24048, 24049, 24050, 24051, 24052, 24053, 24053, 24054, 24055, 24056,
-    24057, 24058, 24058, 24059, 24060, 24061, 24062, 24063, 24064, 24064, 24065,
-    24066, 24067, 24068, 24069, 24069, 24070, 24071, 24072, 24073, 24074, 24074,
-    24075, 24076, 24077, 24078, 24079, 24079, 24080, 24081, 24082, 24083, 24084,
-    24084, 24085, 24086, 24087, 24088, 24089, 24089, 24090, 24091, 24092, 24093,
-    24094, 24094, 24095, 24096, 24097, 24098, 24099, 24099, 24100, 24101, 24102,
-    24103, 24104, 24104, 24105, 24106, 24107, 24108, 24109, 24109, 24110, 24111,
-    24112, 24113, 24114, 24114, 24115, 24116, 24117, 24118, 24119, 24119, 24120,
-    24121, 24122, 24123, 24124, 24124, 24125, 24126, 24127, 24128, 24129, 24129,
-    24130, 24131, 24132, 24133, 24133, 24134, 24135, 24136, 24137, 24138, 24138,
-    24139, 24140, 24141, 24142, 24143, 24143, 24144, 24145, 24146, 24147, 24148,
-    24148, 24149, 24150, 24151, 24152, 24152, 24153, 24154, 24155, 24156, 24157,
-    24157, 24158, 24159, 24160, 24161, 24162, 24162, 24163, 24164, 24165, 24166,
-    24166, 24167, 24168, 24169, 24170, 24171, 24171, 24172, 24173, 24174, 24175,
-    24176, 24176, 24177, 24178, 24179, 24180, 24180, 24181, 24182, 24183, 24184,
-    24185, 24185, 24186, 24187, 24188, 24189, 24189, 24190, 24191, 24192, 24193,
-    24194, 24194, 24195, 24196, 24197, 24198, 24198, 24199, 24200, 24201, 24202,
-    24203, 24203, 24204, 24205, 24206, 24207, 24207, 24208, 24209, 24210, 24211,
-    24212, 24212, 24213, 24214, 24215, 24216, 24216, 24217, 24218, 24219, 24220,
-    24220, 24221, 24222, 24223, 24224, 24225, 24225, 24226, 24227, 24228, 24229,
-    24229, 24230, 24231, 24232, 24233, 24233, 24234, 24235, 24236, 24237, 24238,
-    24238, 24239, 24240, 24241, 24242, 24242, 24243, 24244, 24245, 24246, 24246,
-    24247, 24248, 24249, 24250, 24251, 24251, 24252, 24253, 24254, 24255, 24255,
-    24256, 24257, 24258, 24259, 24259, 24260, 24261, 24262, 24263, 24263, 24264,
-    24265, 24266, 24267, 24267, 24268, 24269, 24270, 24271, 24272, 24272, 24273,
-    24274, 24275, 24276, 24276, 24277, 24278, 24279, 24280, 24280, 24281, 24282,
-    24283, 24284, 24284, 24285, 24286, 24287, 24288, 24288, 24289, 24290, 24291,
-    24292, 24292, 24293, 24294, 24295, 24296, 24296, 24297, 24298, 24299, 24300,
-    24300, 24301, 24302, 24303, 24304, 24304, 24305, 24306, 24307, 24308, 24308,
-    24309, 24310, 24311, 24312, 24312, 24313, 24314, 24315, 24316, 24316, 24317,
-    24318, 24319, 24320, 24320, 24321, 24322, 24323, 24324, 24324, 24325, 24326,
-    24327, 24328, 24328, 24329, 24330, 24331, 24332, 24332, 24333, 24334, 24335,
-    24336, 24336, 24337, 24338, 24339, 24340, 24340, 24341, 24342, 24343, 24344,
-    24344, 24345, 24346, 24347, 24348, 24348, 24349, 24350, 24351, 24352, 24352,
-    24353, 24354, 24355, 24355, 24356, 24357, 24358, 24359, 24359, 24360, 24361,
-    24362, 24363, 24363, 24364, 24365, 24366, 24367, 24367, 24368, 24369, 24370,
-    24371, 24371, 24372, 24373, 24374, 24374, 24375, 24376, 24377, 24378, 24378,
-    24379, 24380, 24381, 24382, 24382, 24383, 24384, 24385, 24386, 24386, 24387,
-    24388, 24389, 24389, 24390, 24391, 24392, 24393, 24393, 24394, 24395, 24396,
-    24397, 24397, 24398, 24399, 24400, 24401, 24401, 24402, 24403, 24404, 24404,
-    24405, 24406, 24407, 24408, 24408, 24409, 24410, 24411, 24412, 24412, 24413,
-    24414, 24415, 24415, 24416, 24417, 24418, 24419, 24419, 24420, 24421, 24422,
-    24422, 24423, 24424, 24425, 24426, 24426, 24427, 24428, 24429, 24430, 24430,
-    24431, 24432, 24433, 24433, 24434, 24435, 24436, 24437, 24437, 24438, 24439,
-    24440, 24440, 24441, 24442, 24443, 24444, 24444, 24445, 24446, 24447, 24447,
-    24448, 24449, 24450, 24451, 24451, 24452, 24453, 24454, 24454, 24455, 24456,
-    24457, 24458, 24458, 24459, 24460, 24461, 24461, 24462, 24463, 24464, 24465,
-    24465, 24466, 24467, 24468, 24468, 24469, 24470, 24471, 24472, 24472, 24473,
-    24474, 24475, 24475, 24476, 24477, 24478, 24479, 24479, 24480, 24481, 24482,
-    24482, 24483, 24484, 24485, 24486, 24486, 24487, 24488, 24489, 24489, 24490,
-    24491, 24492, 24493, 24493, 24494, 24495, 24496, 24496, 24497, 24498, 24499,
-    24499, 24500, 24501, 24502, 24503, 24503, 24504, 24505, 24506, 24506, 24507,
-    24508, 24509, 24509, 24510, 24511, 24512, 24513, 24513, 24514, 24515, 24516,
-    24516, 24517, 24518, 24519, 24519, 24520, 24521, 24522, 24523, 24523, 24524,
-    24525, 24526, 24526, 24527, 24528, 24529, 24529, 24530, 24531, 24532, 24533,
-    24533, 24534, 24535, 24536, 24536, 24537, 24538, 24539, 24539, 24540, 24541,
-    24542, 24543, 24543, 24544, 24545, 24546, 24546, 24547, 24548, 24549, 24549,
-    24550, 24551, 24552, 24552, 24553, 24554, 24555, 24555, 24556, 24557, 24558,
-    24559, 24559, 24560, 24561, 24562, 24562, 24563, 24564, 24565, 24565, 24566,
-    24567, 24568, 24568, 24569, 24570, 24571, 24572, 24572, 24573, 24574, 24575,
-    24575, 24576, 24577, 24578, 24578, 24579, 24580, 24581, 24581, 24582, 24583,
-    24584, 24584, 24585, 24586, 24587, 24587, 24588, 24589, 24590, 24591, 24591,
-    24592, 24593, 24594, 24594, 24595, 24596, 24597, 24597, 24598, 24599, 24600,
-    24600, 24601, 24602, 24603, 24603, 24604, 24605, 24606, 24606, 24607, 24608,
-    24609, 24609, 24610, 24611, 24612, 24612, 24613, 24614, 24615, 24615, 24616,
-    24617, 24618, 24619, 24619, 24620, 24621, 24622, 24622, 24623, 24624, 24625,
-    24625, 24626, 24627, 24628, 24628, 24629, 24630, 24631, 24631, 24632, 24633,
-    24634, 24634, 24635, 24636, 24637, 24637, 24638, 24639, 24640, 24640, 24641,
-    24642, 24643, 24643, 24644, 24645, 24646, 24646, 24647, 24648, 24649, 24649,
-    24650, 24651, 24652, 24652, 24653, 24654, 24655, 24655, 24656, 24657, 24658,
-    24658, 24659, 24660, 24661, 24661, 24662, 24663, 24664, 24664, 24665, 24666,
-    24667, 24667, 24668, 24669, 24670, 24670, 24671, 24672, 24673, 24673, 24674,
-    24675, 24676, 24676, 24677, 24678, 24679, 24679, 24680, 24681, 24682, 24682,
-    24683, 24684, 24684, 24685, 24686, 24687, 24687, 24688, 24689, 24690, 24690,
-    24691, 24692, 24693, 24693, 24694, 24695, 24696, 24696, 24697, 24698, 24699,
-    24699, 24700, 24701, 24702, 24702, 24703, 24704, 24705, 24705, 24706, 24707,
-    24708, 24708, 24709, 24710, 24711, 24711, 24712, 24713, 24713, 24714, 24715,
-    24716, 24716, 24717, 24718, 24719, 24719, 24720, 24721, 24722, 24722, 24723,
-    24724, 24725, 24725, 24726, 24727, 24728, 24728, 24729, 24730, 24730, 24731,
-    24732, 24733, 24733, 24734, 24735, 24736, 24736, 24737, 24738, 24739, 24739,
-    24740, 24741, 24742, 24742, 24743, 24744, 24745, 24745, 24746, 24747, 24747,
-    24748, 24749, 24750, 24750, 24751, 24752, 24753, 24753, 24754, 24755, 24756,
-    24756, 24757, 24758, 24758, 24759, 24760, 24761, 24761, 24762, 24763, 24764,
-    24764, 24765, 24766, 24767, 24767, 24768, 24769, 24769, 24770, 24771, 24772,
-    24772, 24773, 24774, 24775, 24775, 24776, 24777, 24778, 24778, 24779, 24780,
-    24780, 24781, 24782, 24783, 24783, 24784, 24785, 24786, 24786, 24787, 24788,
-    24789, 24789, 24790, 24791, 24791, 24792, 24793, 24794, 24794, 24795, 24796,
-    24797, 24797, 24798, 24799, 24799, 24800, 24801, 24802, 24802, 24803, 24804,
-    24805, 24805, 24806, 24807, 24807, 24808, 24809, 24810, 24810, 24811, 24812,
-    24813, 24813, 24814, 24815, 24815, 24816, 24817, 24818, 24818, 24819, 24820,
-    24821, 24821, 24822, 24823, 24823, 24824, 24825, 24826, 24826, 24827, 24828,
-    24829, 24829, 24830, 24831, 24831, 24832, 24833, 24834, 24834, 24835, 24836,
-    24837, 24837, 24838, 24839, 24839, 24840, 24841, 24842, 24842, 24843, 24844,
-    24844, 24845, 24846, 24847, 24847, 24848, 24849, 24850, 24850, 24851, 24852,
-    24852, 24853, 24854, 24855, 24855, 24856, 24857, 24857, 24858, 24859, 24860,
-    24860, 24861, 24862, 24863, 24863, 24864, 24865, 24865, 24866, 24867, 24868,
-    24868, 24869, 24870, 24870, 24871, 24872, 24873, 24873, 24874, 24875, 24875,
-    24876, 24877, 24878, 24878, 24879, 24880, 24880, 24881, 24882, 24883, 24883,
-    24884, 24885, 24886, 24886, 24887, 24888, 24888, 24889, 24890, 24891, 24891,
-    24892, 24893, 24893, 24894, 24895, 24896, 24896, 24897, 24898, 24898, 24899,
-    24900, 24901, 24901, 24902, 24903, 24903, 24904, 24905, 24906, 24906, 24907,
-    24908, 24908, 24909, 24910, 24911, 24911, 24912, 24913, 24913, 24914, 24915,
-    24916, 24916, 24917, 24918, 24918, 24919, 24920, 24921, 24921, 24922, 24923,
-    24923, 24924, 24925, 24926, 24926, 24927, 24928, 24928, 24929, 24930, 24930,
-    24931, 24932, 24933, 24933, 24934, 24935, 24935, 24936, 24937, 24938, 24938,
-    24939, 24940, 24940, 24941, 24942, 24943, 24943, 24944, 24945, 24945, 24946,
-    24947, 24948, 24948, 24949, 24950, 24950, 24951, 24952, 24952, 24953, 24954,
-    24955, 24955, 24956, 24957, 24957, 24958, 24959, 24960, 24960, 24961, 24962,
-    24962, 24963, 24964, 24965, 24965, 24966, 24967, 24967, 24968, 24969, 24969,
-    24970, 24971, 24972, 24972, 24973, 24974, 24974, 24975, 24976, 24977, 24977,
-    24978, 24979, 24979, 24980, 24981, 24981, 24982, 24983, 24984, 24984, 24985,
-    24986, 24986, 24987, 24988, 24988, 24989, 24990, 24991, 24991, 24992, 24993,
-    24993, 24994, 24995, 24996, 24996, 24997, 24998, 24998, 24999, 25000, 25000,
-    25001, 25002, 25003, 25003, 25004, 25005, 25005, 25006, 25007, 25007, 25008,
-    25009, 25010, 25010, 25011, 25012, 25012, 25013, 25014, 25014, 25015, 25016,
-    25017, 25017, 25018, 25019, 25019, 25020, 25021, 25021, 25022, 25023, 25024,
-    25024, 25025, 25026, 25026, 25027, 25028, 25028, 25029, 25030, 25031, 25031,
-    25032, 25033, 25033, 25034, 25035, 25035, 25036, 25037, 25037, 25038, 25039,
-    25040, 25040, 25041, 25042, 25042, 25043, 25044, 25044, 25045, 25046, 25047,
-    25047, 25048, 25049, 25049, 25050, 25051, 25051, 25052, 25053, 25053, 25054,
-    25055, 25056, 25056, 25057, 25058, 25058, 25059, 25060, 25060, 25061, 25062,
-    25063, 25063, 25064, 25065, 25065, 25066, 25067, 25067, 25068, 25069, 25069,
-    25070, 25071, 25072, 25072, 25073, 25074, 25074, 25075, 25076, 25076, 25077,
-    25078, 25078, 25079, 25080, 25081, 25081, 25082, 25083, 25083, 25084, 25085,
-    25085, 25086, 25087, 25087, 25088, 25089, 25089, 25090, 25091, 25092, 25092,
-    25093, 25094, 25094, 25095, 25096, 25096, 25097, 25098, 25098, 25099, 25100,
-    25101, 25101, 25102, 25103, 25103, 25104, 25105, 25105, 25106, 25107, 25107,
-    25108, 25109, 25109, 25110, 25111, 25112, 25112, 25113, 25114, 25114, 25115,
-    25116, 25116, 25117, 25118, 25118, 25119, 25120, 25120, 25121, 25122, 25122,
-    25123, 25124, 25125, 25125, 25126, 25127, 25127, 25128, 25129, 25129, 25130,
-    25131, 25131, 25132, 25133, 25133, 25134, 25135, 25135, 25136, 25137, 25138,
-    25138, 25139, 25140, 25140, 25141, 25142, 25142, 25143, 25144, 25144, 25145,
-    25146, 25146, 25147, 25148, 25148, 25149, 25150, 25151, 25151, 25152, 25153,
-    25153, 25154, 25155, 25155, 25156, 25157, 25157, 25158, 25159, 25159, 25160,
-    25161, 25161, 25162, 25163, 25163, 25164, 25165, 25165, 25166, 25167, 25168,
-    25168, 25169, 25170, 25170, 25171, 25172, 25172, 25173, 25174, 25174, 25175,
-    25176, 25176, 25177, 25178, 25178, 25179, 25180, 25180, 25181, 25182, 25182,
-    25183, 25184, 25185, 25185, 25186, 25187, 25187, 25188, 25189, 25189, 25190,
-    25191, 25191, 25192, 25193, 25193, 25194, 25195, 25195, 25196, 25197, 25197,
-    25198, 25199, 25199, 25200, 25201, 25201, 25202, 25203, 25203, 25204, 25205,
-    25205, 25206, 25207, 25207, 25208, 25209, 25210, 25210, 25211, 25212, 25212,
-    25213, 25214, 25214, 25215, 25216, 25216, 25217, 25218, 25218, 25219, 25220,
-    25220, 25221, 25222, 25222, 25223, 25224, 25224, 25225, 25226, 25226, 25227,
-    25228, 25228, 25229, 25230, 25230, 25231, 25232, 25232, 25233, 25234, 25234,
-    25235, 25236, 25236, 25237, 25238, 25238, 25239, 25240, 25240, 25241, 25242,
-    25242, 25243, 25244, 25244, 25245, 25246, 25246, 25247, 25248, 25248, 25249,
-    25250, 25250, 25251, 25252, 25252, 25253, 25254, 25254, 25255, 25256, 25257,
-    25257, 25258, 25259, 25259, 25260, 25261, 25261, 25262, 25263, 25263, 25264,
-    25265, 25265, 25266, 25267, 25267, 25268, 25269, 25269, 25270, 25271, 25271,
-    25272, 25273, 25273, 25274, 25275, 25275, 25276, 25277, 25277, 25278, 25279,
-    25279, 25280, 25281, 25281, 25282, 25282, 25283, 25284, 25284, 25285, 25286,
-    25286, 25287, 25288, 25288, 25289, 25290, 25290, 25291, 25292, 25292, 25293,
-    25294, 25294, 25295, 25296, 25296, 25297, 25298, 25298, 25299, 25300, 25300,
-    25301, 25302, 25302, 25303, 25304, 25304, 25305, 25306, 25306, 25307, 25308,
-    25308, 25309, 25310, 25310, 25311, 25312, 25312, 25313, 25314, 25314, 25315,
-    25316, 25316, 25317, 25318, 25318, 25319, 25320, 25320, 25321, 25322, 25322,
-    25323, 25324, 25324, 25325, 25326, 25326, 25327, 25328, 25328, 25329, 25330,
-    25330, 25331, 25331, 25332, 25333, 25333, 25334, 25335, 25335, 25336, 25337,
-    25337, 25338, 25339, 25339, 25340, 25341, 25341, 25342, 25343, 25343, 25344,
-    25345, 25345, 25346, 25347, 25347, 25348, 25349, 25349, 25350, 25351, 25351,
-    25352, 25353, 25353, 25354, 25354, 25355, 25356, 25356, 25357, 25358, 25358,
-    25359, 25360, 25360, 25361, 25362, 25362, 25363, 25364, 25364, 25365, 25366,
-    25366, 25367, 25368, 25368, 25369, 25370, 25370, 25371, 25372, 25372, 25373,
-    25373, 25374, 25375, 25375, 25376, 25377, 25377, 25378, 25379, 25379, 25380,
-    25381, 25381, 25382, 25383, 25383, 25384, 25385, 25385, 25386, 25387, 25387,
-    25388, 25388, 25389, 25390, 25390, 25391, 25392, 25392, 25393, 25394, 25394,
-    25395, 25396, 25396, 25397, 25398, 25398, 25399, 25400, 25400, 25401, 25402,
-    25402, 25403, 25403, 25404, 25405, 25405, 25406, 25407, 25407, 25408, 25409,
-    25409, 25410, 25411, 25411, 25412, 25413, 25413, 25414, 25414, 25415, 25416,
-    25416, 25417, 25418, 25418, 25419, 25420, 25420, 25421, 25422, 25422, 25423,
-    25424, 25424, 25425, 25426, 25426, 25427, 25427, 25428, 25429, 25429, 25430,
-    25431, 25431, 25432, 25433, 25433, 25434, 25435, 25435, 25436, 25436, 25437,
-    25438, 25438, 25439, 25440, 25440, 25441, 25442, 25442, 25443, 25444, 25444,
-    25445, 25446, 25446, 25447, 25447, 25448, 25449, 25449, 25450, 25451, 25451,
-    25452, 25453, 25453, 25454, 25455, 25455, 25456, 25456, 25457, 25458, 25458,
-    25459, 25460, 25460, 25461, 25462, 25462, 25463, 25464, 25464, 25465, 25465,
-    25466, 25467, 25467, 25468, 25469, 25469, 25470, 25471, 25471, 25472, 25473,
-    25473, 25474, 25474, 25475, 25476, 25476, 25477, 25478, 25478, 25479, 25480,
-    25480, 25481, 25482, 25482, 25483, 25483, 25484, 25485, 25485, 25486, 25487,
-    25487, 25488, 25489, 25489, 25490, 25490, 25491, 25492, 25492, 25493, 25494,
-    25494, 25495, 25496, 25496, 25497, 25497, 25498, 25499, 25499, 25500, 25501,
-    25501, 25502, 25503, 25503, 25504, 25505, 25505, 25506, 25506, 25507, 25508,
-    25508, 25509, 25510, 25510, 25511, 25512, 25512, 25513, 25513, 25514, 25515,
-    25515, 25516, 25517, 25517, 25518, 25519, 25519, 25520, 25520, 25521, 25522,
-    25522, 25523, 25524, 25524, 25525, 25525, 25526, 25527, 25527, 25528, 25529,
-    25529, 25530, 25531, 25531, 25532, 25532, 25533, 25534, 25534, 25535, 25536,
-    25536, 25537, 25538, 25538, 25539, 25539, 25540, 25541, 25541, 25542, 25543,
-    25543, 25544, 25545, 25545, 25546, 25546, 25547, 25548, 25548, 25549, 25550,
-    25550, 25551, 25551, 25552, 25553, 25553, 25554, 25555, 25555, 25556, 25557,
-    25557, 25558, 25558, 25559, 25560, 25560, 25561, 25562, 25562, 25563, 25563,
-    25564, 25565, 25565, 25566, 25567, 25567, 25568, 25568, 25569, 25570, 25570,
-    25571, 25572, 25572, 25573, 25574, 25574, 25575, 25575, 25576, 25577, 25577,
-    25578, 25579, 25579, 25580, 25580, 25581, 25582, 25582, 25583, 25584, 25584,
-    25585, 25585, 25586, 25587, 25587, 25588, 25589, 25589, 25590, 25590, 25591,
-    25592, 25592, 25593, 25594, 25594, 25595, 25596, 25596, 25597, 25597, 25598,
-    25599, 25599, 25600, 25601, 25601, 25602, 25602, 25603, 25604, 25604, 25605,
-    25606, 25606, 25607, 25607, 25608, 25609, 25609, 25610, 25611, 25611, 25612,
-    25612, 25613, 25614, 25614, 25615, 25616, 25616, 25617, 25617, 25618, 25619,
-    25619, 25620, 25621, 25621, 25622, 25622, 25623, 25624, 25624, 25625, 25625,
-    25626, 25627, 25627, 25628, 25629, 25629, 25630, 25630, 25631, 25632, 25632,
-    25633, 25634, 25634, 25635, 25635, 25636, 25637, 25637, 25638, 25639, 25639,
-    25640, 25640, 25641, 25642, 25642, 25643, 25644, 25644, 25645, 25645, 25646,
-    25647, 25647, 25648, 25648, 25649, 25650, 25650, 25651, 25652, 25652, 25653,
-    25653, 25654, 25655, 25655, 25656, 25657, 25657, 25658, 25658, 25659, 25660,
-    25660, 25661, 25661, 25662, 25663, 25663, 25664, 25665, 25665, 25666, 25666,
-    25667, 25668, 25668, 25669, 25670, 25670, 25671, 25671, 25672, 25673, 25673,
-    25674, 25674, 25675, 25676, 25676, 25677, 25678, 25678, 25679, 25679, 25680,
-    25681, 25681, 25682, 25682, 25683, 25684, 25684, 25685, 25686, 25686, 25687,
-    25687, 25688, 25689, 25689, 25690, 25690, 25691, 25692, 25692, 25693, 25694,
-    25694, 25695, 25695, 25696, 25697, 25697, 25698, 25698, 25699, 25700, 25700,
-    25701, 25702, 25702, 25703, 25703, 25704, 25705, 25705, 25706, 25706, 25707,
-    25708, 25708, 25709, 25710, 25710, 25711, 25711, 25712, 25713, 25713, 25714,
-    25714, 25715, 25716, 25716, 25717, 25718, 25718, 25719, 25719, 25720, 25721,
-    25721, 25722, 25722, 25723, 25724, 25724, 25725, 25725, 25726, 25727, 25727,
-    25728, 25729, 25729, 25730, 25730, 25731, 25732, 25732, 25733, 25733, 25734,
-    25735, 25735, 25736, 25736, 25737, 25738, 25738, 25739, 25739, 25740, 25741,
-    25741, 25742, 25743, 25743, 25744, 25744, 25745, 25746, 25746, 25747, 25747,
-    25748, 25749, 25749, 25750, 25750, 25751, 25752, 25752, 25753, 25753, 25754,
-    25755, 25755, 25756, 25757, 25757, 25758, 25758, 25759, 25760, 25760, 25761,
-    25761, 25762, 25763, 25763, 25764, 25764, 25765, 25766, 25766, 25767, 25767,
-    25768, 25769, 25769, 25770, 25770, 25771, 25772, 25772, 25773, 25774, 25774,
-    25775, 25775, 25776, 25777, 25777, 25778, 25778, 25779, 25780, 25780, 25781,
-    25781, 25782, 25783, 25783, 25784, 25784, 25785, 25786, 25786, 25787, 25787,
-    25788, 25789, 25789, 25790, 25790, 25791, 25792, 25792, 25793, 25793, 25794,
-    25795, 25795, 25796, 25796, 25797, 25798, 25798, 25799, 25799, 25800, 25801,
-    25801, 25802, 25803, 25803, 25804, 25804, 25805, 25806, 25806, 25807, 25807,
-    25808, 25809, 25809, 25810, 25810, 25811, 25812, 25812, 25813, 25813, 25814,
-    25815, 25815, 25816, 25816, 25817, 25818, 25818, 25819, 25819, 25820, 25821,
-    25821, 25822, 25822, 25823, 25824, 25824, 25825, 25825, 25826, 25827, 25827,
-    25828, 25828, 25829, 25830, 25830, 25831, 25831, 25832, 25833, 25833, 25834,
-    25834, 25835, 25836, 25836, 25837, 25837, 25838, 25839, 25839, 25840, 25840,
-    25841, 25842, 25842, 25843, 25843, 25844, 25845, 25845, 25846, 25846, 25847,
-    25847, 25848, 25849, 25849, 25850, 25850, 25851, 25852, 25852, 25853, 25853,
-    25854, 25855, 25855, 25856, 25856, 25857, 25858, 25858, 25859, 25859, 25860,
-    25861, 25861, 25862, 25862, 25863, 25864, 25864, 25865, 25865, 25866, 25867,
-    25867, 25868, 25868, 25869, 25870, 25870, 25871, 25871, 25872, 25873, 25873,
-    25874, 25874, 25875, 25875, 25876, 25877, 25877, 25878, 25878, 25879, 25880,
-    25880, 25881, 25881, 25882, 25883, 25883, 25884, 25884, 25885, 25886, 25886,
-    25887, 25887, 25888, 25889, 25889, 25890, 25890, 25891, 25891, 25892, 25893,
-    25893, 25894, 25894, 25895, 25896, 25896, 25897, 25897, 25898, 25899, 25899,
-    25900, 25900, 25901, 25902, 25902, 25903, 25903, 25904, 25905, 25905, 25906,
-    25906, 25907, 25907, 25908, 25909, 25909, 25910, 25910, 25911, 25912, 25912,
-    25913, 25913, 25914, 25915, 25915, 25916, 25916, 25917, 25917, 25918, 25919,
-    25919, 25920, 25920, 25921, 25922, 25922, 25923, 25923, 25924, 25925, 25925,
-    25926, 25926, 25927, 25927, 25928, 25929, 25929, 25930, 25930, 25931, 25932,
-    25932, 25933, 25933, 25934, 25935, 25935, 25936, 25936, 25937, 25937, 25938,
-    25939, 25939, 25940, 25940, 25941, 25942, 25942, 25943, 25943, 25944, 25945,
-    25945, 25946, 25946, 25947, 25947, 25948, 25949, 25949, 25950, 25950, 25951,
-    25952, 25952, 25953, 25953, 25954, 25954, 25955, 25956, 25956, 25957, 25957,
-    25958, 25959, 25959, 25960, 25960, 25961, 25962, 25962, 25963, 25963, 25964,
-    25964, 25965, 25966, 25966, 25967, 25967, 25968, 25969, 25969, 25970, 25970,
-    25971, 25971, 25972, 25973, 25973, 25974, 25974, 25975, 25976, 25976, 25977,
-    25977, 25978, 25978, 25979, 25980, 25980, 25981, 25981, 25982, 25982, 25983,
-    25984, 25984, 25985, 25985, 25986, 25987, 25987, 25988, 25988, 25989, 25989,
-    25990, 25991, 25991, 25992, 25992, 25993, 25994, 25994, 25995, 25995, 25996,
-    25996, 25997, 25998, 25998, 25999, 25999, 26000, 26001, 26001, 26002, 26002,
-    26003, 26003, 26004, 26005, 26005, 26006, 26006, 26007, 26007, 26008, 26009,
-    26009, 26010, 26010, 26011, 26012, 26012, 26013, 26013, 26014, 26014, 26015,
-    26016, 26016, 26017, 26017, 26018, 26018, 26019, 26020, 26020, 26021, 26021,
-    26022, 26023, 26023, 26024, 26024, 26025, 26025, 26026, 26027, 26027, 26028,
-    26028, 26029, 26029, 26030, 26031, 26031, 26032, 26032, 26033, 26033, 26034,
-    26035, 26035, 26036, 26036, 26037, 26038, 26038, 26039, 26039, 26040, 26040,
-    26041, 26042, 26042, 26043, 26043, 26044, 26044, 26045, 26046, 26046, 26047,
-    26047, 26048, 26048, 26049, 26050, 26050, 26051, 26051, 26052, 26052, 26053,
-    26054, 26054, 26055, 26055, 26056, 26056, 26057, 26058, 26058, 26059, 26059,
-    26060, 26060, 26061, 26062, 26062, 26063, 26063, 26064, 26065, 26065, 26066,
-    26066, 26067, 26067, 26068, 26069, 26069, 26070, 26070, 26071, 26071, 26072,
-    26073, 26073, 26074, 26074, 26075, 26075, 26076, 26077, 26077, 26078, 26078,
-    26079, 26079, 26080, 26081, 26081, 26082, 26082, 26083, 26083, 26084, 26085,
-    26085, 26086, 26086, 26087, 26087, 26088, 26089, 26089, 26090, 26090, 26091,
-    26091, 26092, 26093, 26093, 26094, 26094, 26095, 26095, 26096, 26096, 26097,
-    26098, 26098, 26099, 26099, 26100, 26100, 26101, 26102, 26102, 26103, 26103,
-    26104, 26104, 26105, 26106, 26106, 26107, 26107, 26108, 26108, 26109, 26110,
-    26110, 26111, 26111, 26112, 26112, 26113, 26114, 26114, 26115, 26115, 26116,
-    26116, 26117, 26118, 26118, 26119, 26119, 26120, 26120, 26121, 26121, 26122,
-    26123, 26123, 26124, 26124, 26125, 26125, 26126, 26127, 26127, 26128, 26128,
-    26129, 26129, 26130, 26131, 26131, 26132, 26132, 26133, 26133, 26134, 26135,
-    26135, 26136, 26136, 26137, 26137, 26138, 26138, 26139, 26140, 26140, 26141,
-    26141, 26142, 26142, 26143, 26144, 26144, 26145, 26145, 26146, 26146, 26147,
-    26148, 26148, 26149, 26149, 26150, 26150, 26151, 26151, 26152, 26153, 26153,
-    26154, 26154, 26155, 26155, 26156, 26157, 26157, 26158, 26158, 26159, 26159,
-    26160, 26160, 26161, 26162, 26162, 26163, 26163, 26164, 26164, 26165, 26166,
-    26166, 26167, 26167, 26168, 26168, 26169, 26169, 26170, 26171, 26171, 26172,
-    26172, 26173, 26173, 26174, 26175, 26175, 26176, 26176, 26177, 26177, 26178,
-    26178, 26179, 26180, 26180, 26181, 26181, 26182, 26182, 26183, 26183, 26184,
-    26185, 26185, 26186, 26186, 26187, 26187, 26188, 26189, 26189, 26190, 26190,
-    26191, 26191, 26192, 26192, 26193, 26194, 26194, 26195, 26195, 26196, 26196,
-    26197, 26197, 26198, 26199, 26199, 26200, 26200, 26201, 26201, 26202, 26202,
-    26203, 26204, 26204, 26205, 26205, 26206, 26206, 26207, 26208, 26208, 26209,
-    26209, 26210, 26210, 26211, 26211, 26212, 26213, 26213, 26214, 26214, 26215,
-    26215, 26216, 26216, 26217, 26218, 26218, 26219, 26219, 26220, 26220, 26221,
-    26221, 26222, 26223, 26223, 26224, 26224, 26225, 26225, 26226, 26226, 26227,
-    26228, 26228, 26229, 26229, 26230, 26230, 26231, 26231, 26232, 26233, 26233,
-    26234, 26234, 26235, 26235, 26236, 26236, 26237, 26238, 26238, 26239, 26239,
-    26240, 26240, 26241, 26241, 26242, 26243, 26243, 26244, 26244, 26245, 26245,
-    26246, 26246, 26247, 26248, 26248, 26249, 26249, 26250, 26250, 26251, 26251,
-    26252, 26252, 26253, 26254, 26254, 26255, 26255, 26256, 26256, 26257, 26257,
-    26258, 26259, 26259, 26260, 26260, 26261, 26261, 26262, 26262, 26263, 26264,
-    26264, 26265, 26265, 26266, 26266, 26267, 26267, 26268, 26268, 26269, 26270,
-    26270, 26271, 26271, 26272, 26272, 26273, 26273, 26274, 26275, 26275, 26276,
-    26276, 26277, 26277, 26278, 26278, 26279, 26280, 26280, 26281, 26281, 26282,
-    26282, 26283, 26283, 26284, 26284, 26285, 26286, 26286, 26287, 26287, 26288,
-    26288, 26289, 26289, 26290, 26290, 26291, 26292, 26292, 26293, 26293, 26294,
-    26294, 26295, 26295, 26296, 26297, 26297, 26298, 26298, 26299, 26299, 26300,
-    26300, 26301, 26301, 26302, 26303, 26303, 26304, 26304, 26305, 26305, 26306,
-    26306, 26307, 26307, 26308, 26309, 26309, 26310, 26310, 26311, 26311, 26312,
-    26312, 26313, 26314, 26314, 26315, 26315, 26316, 26316, 26317, 26317, 26318,
-    26318, 26319, 26320, 26320, 26321, 26321, 26322, 26322, 26323, 26323, 26324,
-    26324, 26325, 26326, 26326, 26327, 26327, 26328, 26328, 26329, 26329, 26330,
-    26330, 26331, 26332, 26332, 26333, 26333, 26334, 26334, 26335, 26335, 26336,
-    26336, 26337, 26337, 26338, 26339, 26339, 26340, 26340, 26341, 26341, 26342,
-    26342, 26343, 26343, 26344, 26345, 26345, 26346, 26346, 26347, 26347, 26348,
-    26348, 26349, 26349, 26350, 26351, 26351, 26352, 26352, 26353, 26353, 26354,
-    26354, 26355, 26355, 26356, 26356, 26357, 26358, 26358, 26359, 26359, 26360,
-    26360, 26361, 26361, 26362, 26362, 26363, 26364, 26364, 26365, 26365, 26366,
-    26366, 26367, 26367, 26368, 26368, 26369, 26369, 26370, 26371, 26371, 26372,
-    26372, 26373, 26373, 26374, 26374, 26375, 26375, 26376, 26377, 26377, 26378,
-    26378, 26379, 26379, 26380, 26380, 26381, 26381, 26382, 26382, 26383, 26384,
-    26384, 26385, 26385, 26386, 26386, 26387, 26387, 26388, 26388, 26389, 26389,
-    26390, 26391, 26391, 26392, 26392, 26393, 26393, 26394, 26394, 26395, 26395,
-    26396, 26396, 26397, 26398, 26398, 26399, 26399, 26400, 26400, 26401, 26401,
-    26402, 26402, 26403, 26403, 26404, 26405, 26405, 26406, 26406, 26407, 26407,
-    26408, 26408, 26409, 26409, 26410, 26410, 26411, 26411, 26412, 26413, 26413,
-    26414, 26414, 26415, 26415, 26416, 26416, 26417, 26417, 26418, 26418, 26419,
-    26420, 26420, 26421, 26421, 26422, 26422, 26423, 26423, 26424, 26424, 26425,
-    26425, 26426, 26426, 26427, 26428, 26428, 26429, 26429, 26430, 26430, 26431,
-    26431, 26432, 26432, 26433, 26433, 26434, 26435, 26435, 26436, 26436, 26437,
-    26437, 26438, 26438, 26439, 26439, 26440, 26440, 26441, 26441, 26442, 26443,
-    26443, 26444, 26444, 26445, 26445, 26446, 26446, 26447, 26447, 26448, 26448,
-    26449, 26449, 26450, 26451, 26451, 26452, 26452, 26453, 26453, 26454, 26454,
-    26455, 26455, 26456, 26456, 26457, 26457, 26458, 26458, 26459, 26460, 26460,
-    26461, 26461, 26462, 26462, 26463, 26463, 26464, 26464, 26465, 26465, 26466,
-    26466, 26467, 26468, 26468, 26469, 26469, 26470, 26470, 26471, 26471, 26472,
-    26472, 26473, 26473, 26474, 26474, 26475, 26475, 26476, 26477, 26477, 26478,
-    26478, 26479, 26479, 26480, 26480, 26481, 26481, 26482, 26482, 26483, 26483,
-    26484, 26484, 26485, 26486, 26486, 26487, 26487, 26488, 26488, 26489, 26489,
-    26490, 26490, 26491, 26491, 26492, 26492, 26493, 26493, 26494, 26495, 26495,
-    26496, 26496, 26497, 26497, 26498, 26498, 26499, 26499, 26500, 26500, 26501,
-    26501, 26502, 26502, 26503, 26503, 26504, 26505, 26505, 26506, 26506, 26507,
-    26507, 26508, 26508, 26509, 26509, 26510, 26510, 26511, 26511, 26512, 26512,
-    26513, 26513, 26514, 26515, 26515, 26516, 26516, 26517, 26517, 26518, 26518,
-    26519, 26519, 26520, 26520, 26521, 26521, 26522, 26522, 26523, 26523, 26524,
-    26525, 26525, 26526, 26526, 26527, 26527, 26528, 26528, 26529, 26529, 26530,
-    26530, 26531, 26531, 26532, 26532, 26533, 26533, 26534, 26534, 26535, 26536,
-    26536, 26537, 26537, 26538, 26538, 26539, 26539, 26540, 26540, 26541, 26541,
-    26542, 26542, 26543, 26543, 26544, 26544, 26545, 26545, 26546, 26547, 26547,
-    26548, 26548, 26549, 26549, 26550, 26550, 26551, 26551, 26552, 26552, 26553,
-    26553, 26554, 26554, 26555, 26555, 26556, 26556, 26557, 26557, 26558, 26559,
-    26559, 26560, 26560, 26561, 26561, 26562, 26562, 26563, 26563, 26564, 26564,
-    26565, 26565, 26566, 26566, 26567, 26567, 26568, 26568, 26569, 26569, 26570,
-    26571, 26571, 26572, 26572, 26573, 26573, 26574, 26574, 26575, 26575, 26576,
-    26576, 26577, 26577, 26578, 26578, 26579, 26579, 26580, 26580, 26581, 26581,
-    26582, 26582, 26583, 26584, 26584, 26585, 26585, 26586, 26586, 26587, 26587,
-    26588, 26588, 26589, 26589, 26590, 26590, 26591, 26591, 26592, 26592, 26593,
-    26593, 26594, 26594, 26595, 26595, 26596, 26596, 26597, 26598, 26598, 26599,
-    26599, 26600, 26600, 26601, 26601, 26602, 26602, 26603, 26603, 26604, 26604,
-    26605, 26605, 26606, 26606, 26607, 26607, 26608, 26608, 26609, 26609, 26610,
-    26610, 26611, 26611, 26612, 26613, 26613, 26614, 26614, 26615, 26615, 26616,
-    26616, 26617, 26617, 26618, 26618, 26619, 26619, 26620, 26620, 26621, 26621,
-    26622, 26622, 26623, 26623, 26624, 26624, 26625, 26625, 26626, 26626, 26627,
-    26627, 26628, 26628, 26629, 26630, 26630, 26631, 26631, 26632, 26632, 26633,
-    26633, 26634, 26634, 26635, 26635, 26636, 26636, 26637, 26637, 26638, 26638,
-    26639, 26639, 26640, 26640, 26641, 26641, 26642, 26642, 26643, 26643, 26644,
-    26644, 26645, 26645, 26646, 26646, 26647, 26647, 26648, 26649, 26649, 26650,
-    26650, 26651, 26651, 26652, 26652, 26653, 26653, 26654, 26654, 26655, 26655,
-    26656, 26656, 26657, 26657, 26658, 26658, 26659, 26659, 26660, 26660, 26661,
-    26661, 26662, 26662, 26663, 26663, 26664, 26664, 26665, 26665, 26666, 26666,
-    26667, 26667, 26668, 26668, 26669, 26670, 26670, 26671, 26671, 26672, 26672,
-    26673, 26673, 26674, 26674, 26675, 26675, 26676, 26676, 26677, 26677, 26678,
-    26678, 26679, 26679, 26680, 26680, 26681, 26681, 26682, 26682, 26683, 26683,
-    26684, 26684, 26685, 26685, 26686, 26686, 26687, 26687, 26688, 26688, 26689,
-    26689, 26690, 26690, 26691, 26691, 26692, 26692, 26693, 26693, 26694, 26694,
-    26695, 26695, 26696, 26697, 26697, 26698, 26698, 26699, 26699, 26700, 26700,
-    26701, 26701, 26702, 26702, 26703, 26703, 26704, 26704, 26705, 26705, 26706,
-    26706, 26707, 26707, 26708, 26708, 26709, 26709, 26710, 26710, 26711, 26711,
-    26712, 26712, 26713, 26713, 26714, 26714, 26715, 26715, 26716, 26716, 26717,
-    26717, 26718, 26718, 26719, 26719, 26720, 26720, 26721, 26721, 26722, 26722,
-    26723, 26723, 26724, 26724, 26725, 26725, 26726, 26726, 26727, 26727, 26728,
-    26728, 26729, 26729, 26730, 26730, 26731, 26731, 26732, 26732, 26733, 26733,
-    26734, 26734, 26735, 26735, 26736, 26736, 26737, 26737, 26738, 26739, 26739,
-    26740, 26740, 26741, 26741, 26742, 26742, 26743, 26743, 26744, 26744, 26745,
-    26745, 26746, 26746, 26747, 26747, 26748, 26748, 26749, 26749, 26750, 26750,
-    26751, 26751, 26752, 26752, 26753, 26753, 26754, 26754, 26755, 26755, 26756,
-    26756, 26757, 26757, 26758, 26758, 26759, 26759, 26760, 26760, 26761, 26761,
-    26762, 26762, 26763, 26763, 26764, 26764, 26765, 26765, 26766, 26766, 26767,
-    26767, 26768, 26768, 26769, 26769, 26770, 26770, 26771, 26771, 26772, 26772,
-    26773, 26773, 26774, 26774, 26775, 26775, 26776, 26776, 26777, 26777, 26778,
-    26778, 26779, 26779, 26780, 26780, 26781, 26781, 26782, 26782, 26783, 26783,
-    26784, 26784, 26785, 26785, 26786, 26786, 26787, 26787, 26788, 26788, 26789,
-    26789, 26790, 26790, 26791, 26791, 26792, 26792, 26793, 26793, 26794, 26794,
-    26795, 26795, 26796, 26796, 26797, 26797, 26798, 26798, 26799, 26799, 26800,
-    26800, 26801, 26801, 26802, 26802, 26803, 26803, 26804, 26804, 26805, 26805,
-    26806, 26806, 26807, 26807, 26808, 26808, 26809, 26809, 26810, 26810, 26811,
-    26811, 26812, 26812, 26813, 26813, 26814, 26814, 26815, 26815, 26816, 26816,
-    26817, 26817, 26818, 26818, 26819, 26819, 26820, 26820, 26821, 26821, 26822,
-    26822, 26823, 26823, 26823, 26824, 26824, 26825, 26825, 26826, 26826, 26827,
-    26827, 26828, 26828, 26829, 26829, 26830, 26830, 26831, 26831, 26832, 26832,
-    26833, 26833, 26834, 26834, 26835, 26835, 26836, 26836, 26837, 26837, 26838,
-    26838, 26839, 26839, 26840, 26840, 26841, 26841, 26842, 26842, 26843, 26843,
-    26844, 26844, 26845, 26845, 26846, 26846, 26847, 26847, 26848, 26848, 26849,
-    26849, 26850, 26850, 26851, 26851, 26852, 26852, 26853, 26853, 26854, 26854,
-    26855, 26855, 26856, 26856, 26857, 26857, 26858, 26858, 26859, 26859, 26860,
-    26860, 26861, 26861, 26862, 26862, 26863, 26863, 26864, 26864, 26865, 26865,
-    26865, 26866, 26866, 26867, 26867, 26868, 26868, 26869, 26869, 26870, 26870,
-    26871, 26871, 26872, 26872, 26873, 26873, 26874, 26874, 26875, 26875, 26876,
-    26876, 26877, 26877, 26878, 26878, 26879, 26879, 26880, 26880, 26881, 26881,
-    26882, 26882, 26883, 26883, 26884, 26884, 26885, 26885, 26886, 26886, 26887,
-    26887, 26888, 26888, 26889, 26889, 26890, 26890, 26891, 26891, 26891, 26892,
-    26892, 26893, 26893, 26894, 26894, 26895, 26895, 26896, 26896, 26897, 26897,
-    26898, 26898, 26899, 26899, 26900, 26900, 26901, 26901, 26902, 26902, 26903,
-    26903, 26904, 26904, 26905, 26905, 26906, 26906, 26907, 26907, 26908, 26908,
-    26909, 26909, 26910, 26910, 26911, 26911, 26912, 26912, 26913, 26913, 26913,
-    26914, 26914, 26915, 26915, 26916, 26916, 26917, 26917, 26918, 26918, 26919,
-    26919, 26920, 26920, 26921, 26921, 26922, 26922, 26923, 26923, 26924, 26924,
-    26925, 26925, 26926, 26926, 26927, 26927, 26928, 26928, 26929, 26929, 26930,
-    26930, 26931, 26931, 26931, 26932, 26932, 26933, 26933, 26934, 26934, 26935,
-    26935, 26936, 26936, 26937, 26937, 26938, 26938, 26939, 26939, 26940, 26940,
-    26941, 26941, 26942, 26942, 26943, 26943, 26944, 26944, 26945, 26945, 26946,
-    26946, 26947, 26947, 26947, 26948, 26948, 26949, 26949, 26950, 26950, 26951,
-    26951, 26952, 26952, 26953, 26953, 26954, 26954, 26955, 26955, 26956, 26956,
-    26957, 26957, 26958, 26958, 26959, 26959, 26960, 26960, 26961, 26961, 26962,
-    26962, 26962, 26963, 26963, 26964, 26964, 26965, 26965, 26966, 26966, 26967,
-    26967, 26968, 26968, 26969, 26969, 26970, 26970, 26971, 26971, 26972, 26972,
-    26973, 26973, 26974, 26974, 26975, 26975, 26976, 26976, 26976, 26977, 26977,
-    26978, 26978, 26979, 26979, 26980, 26980, 26981, 26981, 26982, 26982, 26983,
-    26983, 26984, 26984, 26985, 26985, 26986, 26986, 26987, 26987, 26988, 26988,
-    26989, 26989, 26989, 26990, 26990, 26991, 26991, 26992, 26992, 26993, 26993,
-    26994, 26994, 26995, 26995, 26996, 26996, 26997, 26997, 26998, 26998, 26999,
-    26999, 27000, 27000, 27001, 27001, 27001, 27002, 27002, 27003, 27003, 27004,
-    27004, 27005, 27005, 27006, 27006, 27007, 27007, 27008, 27008, 27009, 27009,
-    27010, 27010, 27011, 27011, 27012, 27012, 27012, 27013, 27013, 27014, 27014,
-    27015, 27015, 27016, 27016, 27017, 27017, 27018, 27018, 27019, 27019, 27020,
-    27020, 27021, 27021, 27022, 27022, 27023, 27023, 27023, 27024, 27024, 27025,
-    27025, 27026, 27026, 27027, 27027, 27028, 27028, 27029, 27029, 27030, 27030,
-    27031, 27031, 27032, 27032, 27033, 27033, 27033, 27034, 27034, 27035, 27035,
-    27036, 27036, 27037, 27037, 27038, 27038, 27039, 27039, 27040, 27040, 27041,
-    27041, 27042, 27042, 27043, 27043, 27043, 27044, 27044, 27045, 27045, 27046,
-    27046, 27047, 27047, 27048, 27048, 27049, 27049, 27050, 27050, 27051, 27051,
-    27052, 27052, 27053, 27053, 27053, 27054, 27054, 27055, 27055, 27056, 27056,
-    27057, 27057, 27058, 27058, 27059, 27059, 27060, 27060, 27061, 27061, 27062,
-    27062, 27062, 27063, 27063, 27064, 27064, 27065, 27065, 27066, 27066, 27067,
-    27067, 27068, 27068, 27069, 27069, 27070, 27070, 27071, 27071, 27071, 27072,
-    27072, 27073, 27073, 27074, 27074, 27075, 27075, 27076, 27076, 27077, 27077,
-    27078, 27078, 27079, 27079, 27080, 27080, 27080, 27081, 27081, 27082, 27082,
-    27083, 27083, 27084, 27084, 27085, 27085, 27086, 27086, 27087, 27087, 27088,
-    27088, 27088, 27089, 27089, 27090, 27090, 27091, 27091, 27092, 27092, 27093,
-    27093, 27094, 27094, 27095, 27095, 27096, 27096, 27096, 27097, 27097, 27098,
-    27098, 27099, 27099, 27100, 27100, 27101, 27101, 27102, 27102, 27103, 27103,
-    27104, 27104, 27104, 27105, 27105, 27106, 27106, 27107, 27107, 27108, 27108,
-    27109, 27109, 27110, 27110, 27111, 27111, 27112, 27112, 27112, 27113, 27113,
-    27114, 27114, 27115, 27115, 27116, 27116, 27117, 27117, 27118, 27118, 27119,
-    27119, 27120, 27120, 27120, 27121, 27121, 27122, 27122, 27123, 27123, 27124,
-    27124, 27125, 27125, 27126, 27126, 27127, 27127, 27127, 27128, 27128, 27129,
-    27129, 27130, 27130, 27131, 27131, 27132, 27132, 27133, 27133, 27134, 27134,
-    27134, 27135, 27135, 27136, 27136, 27137, 27137, 27138, 27138, 27139, 27139,
-    27140, 27140, 27141, 27141, 27141, 27142, 27142, 27143, 27143, 27144, 27144,
-    27145, 27145, 27146, 27146, 27147, 27147, 27148, 27148, 27148, 27149, 27149,
-    27150, 27150, 27151, 27151, 27152, 27152, 27153, 27153, 27154, 27154, 27155,
-    27155, 27155, 27156, 27156, 27157, 27157, 27158, 27158, 27159, 27159, 27160,
-    27160, 27161, 27161, 27162, 27162, 27162, 27163, 27163, 27164, 27164, 27165,
-    27165, 27166, 27166, 27167, 27167, 27168, 27168, 27169, 27169, 27169, 27170,
-    27170, 27171, 27171, 27172, 27172, 27173, 27173, 27174, 27174, 27175, 27175,
-    27175, 27176, 27176, 27177, 27177, 27178, 27178, 27179, 27179, 27180, 27180,
-    27181, 27181, 27181, 27182, 27182, 27183, 27183, 27184, 27184, 27185, 27185,
-    27186, 27186, 27187, 27187, 27188, 27188, 27188, 27189, 27189, 27190, 27190,
-    27191, 27191, 27192, 27192, 27193, 27193, 27194, 27194, 27194, 27195, 27195,
-    27196, 27196, 27197, 27197, 27198, 27198, 27199, 27199, 27200, 27200, 27200,
-    27201, 27201, 27202, 27202, 27203, 27203, 27204, 27204, 27205, 27205, 27206,
-    27206, 27206, 27207, 27207, 27208, 27208, 27209, 27209, 27210, 27210, 27211,
-    27211, 27212, 27212, 27212, 27213, 27213, 27214, 27214, 27215, 27215, 27216,
-    27216, 27217, 27217, 27218, 27218, 27218, 27219, 27219, 27220, 27220, 27221,
-    27221, 27222, 27222, 27223, 27223, 27223, 27224, 27224, 27225, 27225, 27226,
-    27226, 27227, 27227, 27228, 27228, 27229, 27229, 27229, 27230, 27230, 27231,
-    27231, 27232, 27232, 27233, 27233, 27234, 27234, 27235, 27235, 27235, 27236,
-    27236, 27237, 27237, 27238, 27238, 27239, 27239, 27240, 27240, 27240, 27241,
-    27241, 27242, 27242, 27243, 27243, 27244, 27244, 27245, 27245, 27245, 27246,
-    27246, 27247, 27247, 27248, 27248, 27249, 27249, 27250, 27250, 27251, 27251,
-    27251, 27252, 27252, 27253, 27253, 27254, 27254, 27255, 27255, 27256, 27256,
-    27256, 27257, 27257, 27258, 27258, 27259, 27259, 27260, 27260, 27261, 27261,
-    27261, 27262, 27262, 27263, 27263, 27264, 27264, 27265, 27265, 27266, 27266,
-    27267, 27267, 27267, 27268, 27268, 27269, 27269, 27270, 27270, 27271, 27271,
-    27272, 27272, 27272, 27273, 27273, 27274, 27274, 27275, 27275, 27276, 27276,
-    27277, 27277, 27277, 27278, 27278, 27279, 27279, 27280, 27280, 27281, 27281,
-    27282, 27282, 27282, 27283, 27283, 27284, 27284, 27285, 27285, 27286, 27286,
-    27287, 27287, 27287, 27288, 27288, 27289, 27289, 27290, 27290, 27291, 27291,
-    27292, 27292, 27292, 27293, 27293, 27294, 27294, 27295, 27295, 27296, 27296,
-    27297, 27297, 27297, 27298, 27298, 27299, 27299, 27300, 27300, 27301, 27301,
-    27301, 27302, 27302, 27303, 27303, 27304, 27304, 27305, 27305, 27306, 27306,
-    27306, 27307, 27307, 27308, 27308, 27309, 27309, 27310, 27310, 27311, 27311,
-    27311, 27312, 27312, 27313, 27313, 27314, 27314, 27315, 27315, 27316, 27316,
-    27316, 27317, 27317, 27318, 27318, 27319, 27319, 27320, 27320, 27320, 27321,
-    27321, 27322, 27322, 27323, 27323, 27324, 27324, 27325, 27325, 27325, 27326,
-    27326, 27327, 27327, 27328, 27328, 27329, 27329, 27329, 27330, 27330, 27331,
-    27331, 27332, 27332, 27333, 27333, 27334, 27334, 27334, 27335, 27335, 27336,
-    27336, 27337, 27337, 27338, 27338, 27338, 27339, 27339, 27340, 27340, 27341,
-    27341, 27342, 27342, 27343, 27343, 27343, 27344, 27344, 27345, 27345, 27346,
-    27346, 27347, 27347, 27347, 27348, 27348, 27349, 27349, 27350, 27350, 27351,
-    27351, 27352, 27352, 27352, 27353, 27353, 27354, 27354, 27355, 27355, 27356,
-    27356, 27356, 27357, 27357, 27358, 27358, 27359, 27359, 27360, 27360, 27360,
-    27361, 27361, 27362, 27362, 27363, 27363, 27364, 27364, 27365, 27365, 27365,
-    27366, 27366, 27367, 27367, 27368, 27368, 27369, 27369, 27369, 27370, 27370,
-    27371, 27371, 27372, 27372, 27373, 27373, 27373, 27374, 27374, 27375, 27375,
-    27376, 27376, 27377, 27377, 27377, 27378, 27378, 27379, 27379, 27380, 27380,
-    27381, 27381, 27381, 27382, 27382, 27383, 27383, 27384, 27384, 27385, 27385,
-    27385, 27386, 27386, 27387, 27387, 27388, 27388, 27389, 27389, 27390, 27390,
-    27390, 27391, 27391, 27392, 27392, 27393, 27393, 27394, 27394, 27394, 27395,
-    27395, 27396, 27396, 27397, 27397, 27398, 27398, 27398, 27399, 27399, 27400,
-    27400, 27401, 27401, 27402, 27402, 27402, 27403, 27403, 27404, 27404, 27405,
-    27405, 27406, 27406, 27406, 27407, 27407, 27408, 27408, 27409, 27409, 27410,
-    27410, 27410, 27411, 27411, 27412, 27412, 27413, 27413, 27413, 27414, 27414,
-    27415, 27415, 27416, 27416, 27417, 27417, 27417, 27418, 27418, 27419, 27419,
-    27420, 27420, 27421, 27421, 27421, 27422, 27422, 27423, 27423, 27424, 27424,
-    27425, 27425, 27425, 27426, 27426, 27427, 27427, 27428, 27428, 27429, 27429,
-    27429, 27430, 27430, 27431, 27431, 27432, 27432, 27433, 27433, 27433, 27434,
-    27434, 27435, 27435, 27436, 27436, 27436, 27437, 27437, 27438, 27438, 27439,
-    27439, 27440, 27440, 27440, 27441, 27441, 27442, 27442, 27443, 27443, 27444,
-    27444, 27444, 27445, 27445, 27446, 27446, 27447, 27447, 27448, 27448, 27448,
-    27449, 27449, 27450, 27450, 27451, 27451, 27451, 27452, 27452, 27453, 27453,
-    27454, 27454, 27455, 27455, 27455, 27456, 27456, 27457, 27457, 27458, 27458,
-    27459, 27459, 27459, 27460, 27460, 27461, 27461, 27462, 27462, 27462, 27463,
-    27463, 27464, 27464, 27465, 27465, 27466, 27466, 27466, 27467, 27467, 27468,
-    27468, 27469, 27469, 27469, 27470, 27470, 27471, 27471, 27472, 27472, 27473,
-    27473, 27473, 27474, 27474, 27475, 27475, 27476, 27476, 27477, 27477, 27477,
-    27478, 27478, 27479, 27479, 27480, 27480, 27480, 27481, 27481, 27482, 27482,
-    27483, 27483, 27484, 27484, 27484, 27485, 27485, 27486, 27486, 27487, 27487,
-    27487, 27488, 27488, 27489, 27489, 27490, 27490, 27490, 27491, 27491, 27492,
-    27492, 27493, 27493, 27494, 27494, 27494, 27495, 27495, 27496, 27496, 27497,
-    27497, 27497, 27498, 27498, 27499, 27499, 27500, 27500, 27501, 27501, 27501,
-    27502, 27502, 27503, 27503, 27504, 27504, 27504, 27505, 27505, 27506, 27506,
-    27507, 27507, 27508, 27508, 27508, 27509, 27509, 27510, 27510, 27511, 27511,
-    27511, 27512, 27512, 27513, 27513, 27514, 27514, 27514, 27515, 27515, 27516,
-    27516, 27517, 27517, 27518, 27518, 27518, 27519, 27519, 27520, 27520, 27521,
-    27521, 27521, 27522, 27522, 27523, 27523, 27524, 27524, 27524, 27525, 27525,
-    27526, 27526, 27527, 27527, 27527, 27528, 27528, 27529, 27529, 27530, 27530,
-    27531, 27531, 27531, 27532, 27532, 27533, 27533, 27534, 27534, 27534, 27535,
-    27535, 27536, 27536, 27537, 27537, 27537, 27538, 27538, 27539, 27539, 27540,
-    27540, 27540, 27541, 27541, 27542, 27542, 27543, 27543, 27544, 27544, 27544,
-    27545, 27545, 27546, 27546, 27547, 27547, 27547, 27548, 27548, 27549, 27549,
-    27550, 27550, 27550, 27551, 27551, 27552, 27552, 27553, 27553, 27553, 27554,
-    27554, 27555, 27555, 27556, 27556, 27556, 27557, 27557, 27558, 27558, 27559,
-    27559, 27559, 27560, 27560, 27561, 27561, 27562, 27562, 27563, 27563, 27563,
-    27564, 27564, 27565, 27565, 27566, 27566, 27566, 27567, 27567, 27568, 27568,
-    27569, 27569, 27569, 27570, 27570, 27571, 27571, 27572, 27572, 27572, 27573,
-    27573, 27574, 27574, 27575, 27575, 27575, 27576, 27576, 27577, 27577, 27578,
-    27578, 27578, 27579, 27579, 27580, 27580, 27581, 27581, 27581, 27582, 27582,
-    27583, 27583, 27584, 27584, 27584, 27585, 27585, 27586, 27586, 27587, 27587,
-    27587, 27588, 27588, 27589, 27589, 27590, 27590, 27590, 27591, 27591, 27592,
-    27592, 27593, 27593, 27593, 27594, 27594, 27595, 27595, 27596, 27596, 27596,
-    27597, 27597, 27598, 27598, 27599, 27599, 27599, 27600, 27600, 27601, 27601,
-    27602, 27602, 27602, 27603, 27603, 27604, 27604, 27605, 27605, 27605, 27606,
-    27606, 27607, 27607, 27608, 27608, 27608, 27609, 27609, 27610, 27610, 27611,
-    27611, 27611, 27612, 27612, 27613, 27613, 27614, 27614, 27614, 27615, 27615,
-    27616, 27616, 27617, 27617, 27617, 27618, 27618, 27619, 27619, 27620, 27620,
-    27620, 27621, 27621, 27622, 27622, 27622, 27623, 27623, 27624, 27624, 27625,
-    27625, 27625, 27626, 27626, 27627, 27627, 27628, 27628, 27628, 27629, 27629,
-    27630, 27630, 27631, 27631, 27631, 27632, 27632, 27633, 27633, 27634, 27634,
-    27634, 27635, 27635, 27636, 27636, 27637, 27637, 27637, 27638, 27638, 27639,
-    27639, 27640, 27640, 27640, 27641, 27641, 27642, 27642, 27642, 27643, 27643,
-    27644, 27644, 27645, 27645, 27645, 27646, 27646, 27647, 27647, 27648, 27648,
-    27648, 27649, 27649, 27650, 27650, 27651, 27651, 27651, 27652, 27652, 27653,
-    27653, 27653, 27654, 27654, 27655, 27655, 27656, 27656, 27656, 27657, 27657,
-    27658, 27658, 27659, 27659, 27659, 27660, 27660, 27661, 27661, 27662, 27662,
-    27662, 27663, 27663, 27664, 27664, 27664, 27665, 27665, 27666, 27666, 27667,
-    27667, 27667, 27668, 27668, 27669, 27669, 27670, 27670, 27670, 27671, 27671,
-    27672, 27672, 27673, 27673, 27673, 27674, 27674, 27675, 27675, 27675, 27676,
-    27676, 27677, 27677, 27678, 27678, 27678, 27679, 27679, 27680, 27680, 27681,
-    27681, 27681, 27682, 27682, 27683, 27683, 27683, 27684, 27684, 27685, 27685,
-    27686, 27686, 27686, 27687, 27687, 27688, 27688, 27689, 27689, 27689, 27690,
-    27690, 27691, 27691, 27691, 27692, 27692, 27693, 27693, 27694, 27694, 27694,
-    27695, 27695, 27696, 27696, 27697, 27697, 27697, 27698, 27698, 27699, 27699,
-    27699, 27700, 27700, 27701, 27701, 27702, 27702, 27702, 27703, 27703, 27704,
-    27704, 27704, 27705, 27705, 27706, 27706, 27707, 27707, 27707, 27708, 27708,
-    27709, 27709, 27710, 27710, 27710, 27711, 27711, 27712, 27712, 27712, 27713,
-    27713, 27714, 27714, 27715, 27715, 27715, 27716, 27716, 27717, 27717, 27717,
-    27718, 27718, 27719, 27719, 27720, 27720, 27720, 27721, 27721, 27722, 27722,
-    27722, 27723, 27723, 27724, 27724, 27725, 27725, 27725, 27726, 27726, 27727,
-    27727, 27728, 27728, 27728, 27729, 27729, 27730, 27730, 27730, 27731, 27731,
-    27732, 27732, 27733, 27733, 27733, 27734, 27734, 27735, 27735, 27735, 27736,
-    27736, 27737, 27737, 27738, 27738, 27738, 27739, 27739, 27740, 27740, 27740,
-    27741, 27741, 27742, 27742, 27743, 27743, 27743, 27744, 27744, 27745, 27745,
-    27745, 27746, 27746, 27747, 27747, 27748, 27748, 27748, 27749, 27749, 27750,
-    27750, 27750, 27751, 27751, 27752, 27752, 27753, 27753, 27753, 27754, 27754,
-    27755, 27755, 27755, 27756, 27756, 27757, 27757, 27757, 27758, 27758, 27759,
-    27759, 27760, 27760, 27760, 27761, 27761, 27762, 27762, 27762, 27763, 27763,
-    27764, 27764, 27765, 27765, 27765, 27766, 27766, 27767, 27767, 27767, 27768,
-    27768, 27769, 27769, 27770, 27770, 27770, 27771, 27771, 27772, 27772, 27772,
-    27773, 27773, 27774, 27774, 27774, 27775, 27775, 27776, 27776, 27777, 27777,
-    27777, 27778, 27778, 27779, 27779, 27779, 27780, 27780, 27781, 27781, 27782,
-    27782, 27782, 27783, 27783, 27784, 27784, 27784, 27785, 27785, 27786, 27786,
-    27786, 27787, 27787, 27788, 27788, 27789, 27789, 27789, 27790, 27790, 27791,
-    27791, 27791, 27792, 27792, 27793, 27793, 27793, 27794, 27794, 27795, 27795,
-    27796, 27796, 27796, 27797, 27797, 27798, 27798, 27798, 27799, 27799, 27800,
-    27800, 27800, 27801, 27801, 27802, 27802, 27803, 27803, 27803, 27804, 27804,
-    27805, 27805, 27805, 27806, 27806, 27807, 27807, 27807, 27808, 27808, 27809,
-    27809, 27810, 27810, 27810, 27811, 27811, 27812, 27812, 27812, 27813, 27813,
-    27814, 27814, 27814, 27815, 27815, 27816, 27816, 27817, 27817, 27817, 27818,
-    27818, 27819, 27819, 27819, 27820, 27820, 27821, 27821, 27821, 27822, 27822,
-    27823, 27823, 27823, 27824, 27824, 27825, 27825, 27826, 27826, 27826, 27827,
-    27827, 27828, 27828, 27828, 27829, 27829, 27830, 27830, 27830, 27831, 27831,
-    27832, 27832, 27833, 27833, 27833, 27834, 27834, 27835, 27835, 27835, 27836,
-    27836, 27837, 27837, 27837, 27838, 27838, 27839, 27839, 27839, 27840, 27840,
-    27841, 27841, 27842, 27842, 27842, 27843, 27843, 27844, 27844, 27844, 27845,
-    27845, 27846, 27846, 27846, 27847, 27847, 27848, 27848, 27848, 27849, 27849,
-    27850, 27850, 27850, 27851, 27851, 27852, 27852, 27853, 27853, 27853, 27854,
-    27854, 27855, 27855, 27855, 27856, 27856, 27857, 27857, 27857, 27858, 27858,
-    27859, 27859, 27859, 27860, 27860, 27861, 27861, 27861, 27862, 27862, 27863,
-    27863, 27864, 27864, 27864, 27865, 27865, 27866, 27866, 27866, 27867, 27867,
-    27868, 27868, 27868, 27869, 27869, 27870, 27870, 27870, 27871, 27871, 27872,
-    27872, 27872, 27873, 27873, 27874, 27874, 27874, 27875, 27875, 27876, 27876,
-    27877, 27877, 27877, 27878, 27878, 27879, 27879, 27879, 27880, 27880, 27881,
-    27881, 27881, 27882, 27882, 27883, 27883, 27883, 27884, 27884, 27885, 27885,
-    27885, 27886, 27886, 27887, 27887, 27887, 27888, 27888, 27889, 27889, 27890,
-    27890, 27890, 27891, 27891, 27892, 27892, 27892, 27893, 27893, 27894, 27894,
-    27894, 27895, 27895, 27896, 27896, 27896, 27897, 27897, 27898, 27898, 27898,
-    27899, 27899, 27900, 27900, 27900, 27901, 27901, 27902, 27902, 27902, 27903,
-    27903, 27904, 27904, 27904, 27905, 27905, 27906, 27906, 27906, 27907, 27907,
-    27908, 27908, 27908, 27909, 27909, 27910, 27910, 27911, 27911, 27911, 27912,
-    27912, 27913, 27913, 27913, 27914, 27914, 27915, 27915, 27915, 27916, 27916,
-    27917, 27917, 27917, 27918, 27918, 27919, 27919, 27919, 27920, 27920, 27921,
-    27921, 27921, 27922, 27922, 27923, 27923, 27923, 27924, 27924, 27925, 27925,
-    27925, 27926, 27926, 27927, 27927, 27927, 27928, 27928, 27929, 27929, 27929,
-    27930, 27930, 27931, 27931, 27931, 27932, 27932, 27933, 27933, 27933, 27934,
-    27934, 27935, 27935, 27935, 27936, 27936, 27937, 27937, 27937, 27938, 27938,
-    27939, 27939, 27939, 27940, 27940, 27941, 27941, 27941, 27942, 27942, 27943,
-    27943, 27943, 27944, 27944, 27945, 27945, 27945, 27946, 27946, 27947, 27947,
-    27947, 27948, 27948, 27949, 27949, 27949, 27950, 27950, 27951, 27951, 27951,
-    27952, 27952, 27953, 27953, 27953, 27954, 27954, 27955, 27955, 27955, 27956,
-    27956, 27957, 27957, 27957, 27958, 27958, 27959, 27959, 27959, 27960, 27960,
-    27961, 27961, 27961, 27962, 27962, 27963, 27963, 27963, 27964, 27964, 27965,
-    27965, 27965, 27966, 27966, 27967, 27967, 27967, 27968, 27968, 27969, 27969,
-    27969, 27970, 27970, 27971, 27971, 27971, 27972, 27972, 27973, 27973, 27973,
-    27974, 27974, 27975, 27975, 27975, 27976, 27976, 27977, 27977, 27977, 27978,
-    27978, 27979, 27979, 27979, 27980, 27980, 27981, 27981, 27981, 27982, 27982,
-    27983, 27983, 27983, 27984, 27984, 27985, 27985, 27985, 27986, 27986, 27987,
-    27987, 27987, 27988, 27988, 27989, 27989, 27989, 27990, 27990, 27991, 27991,
-    27991, 27992, 27992, 27993, 27993, 27993, 27994, 27994, 27995, 27995, 27995,
-    27996, 27996, 27997, 27997, 27997, 27998, 27998, 27998, 27999, 27999, 28000,
-    28000, 28000, 28001, 28001, 28002, 28002, 28002, 28003, 28003, 28004, 28004,
-    28004, 28005, 28005, 28006, 28006, 28006, 28007, 28007, 28008, 28008, 28008,
-    28009, 28009, 28010, 28010, 28010, 28011, 28011, 28012, 28012, 28012, 28013,
-    28013, 28014, 28014, 28014, 28015, 28015, 28016, 28016, 28016, 28017, 28017,
-    28017, 28018, 28018, 28019, 28019, 28019, 28020, 28020, 28021, 28021, 28021,
-    28022, 28022, 28023, 28023, 28023, 28024, 28024, 28025, 28025, 28025, 28026,
-    28026, 28027, 28027, 28027, 28028, 28028, 28029, 28029, 28029, 28030, 28030,
-    28031, 28031, 28031, 28032, 28032, 28032, 28033, 28033, 28034, 28034, 28034,
-    28035, 28035, 28036, 28036, 28036, 28037, 28037, 28038, 28038, 28038, 28039,
-    28039, 28040, 28040, 28040, 28041, 28041, 28042, 28042, 28042, 28043, 28043,
-    28044, 28044, 28044, 28045, 28045, 28045, 28046, 28046, 28047, 28047, 28047,
-    28048, 28048, 28049, 28049, 28049, 28050, 28050, 28051, 28051, 28051, 28052,
-    28052, 28053, 28053, 28053, 28054, 28054, 28055, 28055, 28055, 28056, 28056,
-    28056, 28057, 28057, 28058, 28058, 28058, 28059, 28059, 28060, 28060, 28060,
-    28061, 28061, 28062, 28062, 28062, 28063, 28063, 28064, 28064, 28064, 28065,
-    28065, 28065, 28066, 28066, 28067, 28067, 28067, 28068, 28068, 28069, 28069,
-    28069, 28070, 28070, 28071, 28071, 28071, 28072, 28072, 28073, 28073, 28073,
-    28074, 28074, 28074, 28075, 28075, 28076, 28076, 28076, 28077, 28077, 28078,
-    28078, 28078, 28079, 28079, 28080, 28080, 28080, 28081, 28081, 28082, 28082,
-    28082, 28083, 28083, 28083, 28084, 28084, 28085, 28085, 28085, 28086, 28086,
-    28087, 28087, 28087, 28088, 28088, 28089, 28089, 28089, 28090, 28090, 28090,
-    28091, 28091, 28092, 28092, 28092, 28093, 28093, 28094, 28094, 28094, 28095,
-    28095, 28096, 28096, 28096, 28097, 28097, 28097, 28098, 28098, 28099, 28099,
-    28099, 28100, 28100, 28101, 28101, 28101, 28102, 28102, 28103, 28103, 28103,
-    28104, 28104, 28104, 28105, 28105, 28106, 28106, 28106, 28107, 28107, 28108,
-    28108, 28108, 28109, 28109, 28110, 28110, 28110, 28111, 28111, 28111, 28112,
-    28112, 28113, 28113, 28113, 28114, 28114, 28115, 28115, 28115, 28116, 28116,
-    28117, 28117, 28117, 28118, 28118, 28118, 28119, 28119, 28120, 28120, 28120,
-    28121, 28121, 28122, 28122, 28122, 28123, 28123, 28123, 28124, 28124, 28125,
-    28125, 28125, 28126, 28126, 28127, 28127, 28127, 28128, 28128, 28129, 28129,
-    28129, 28130, 28130, 28130, 28131, 28131, 28132, 28132, 28132, 28133, 28133,
-    28134, 28134, 28134, 28135, 28135, 28135, 28136, 28136, 28137, 28137, 28137,
-    28138, 28138, 28139, 28139, 28139, 28140, 28140, 28141, 28141, 28141, 28142,
-    28142, 28142, 28143, 28143, 28144, 28144, 28144, 28145, 28145, 28146, 28146,
-    28146, 28147, 28147, 28147, 28148, 28148, 28149, 28149, 28149, 28150, 28150,
-    28151, 28151, 28151, 28152, 28152, 28152, 28153, 28153, 28154, 28154, 28154,
-    28155, 28155, 28156, 28156, 28156, 28157, 28157, 28157, 28158, 28158, 28159,
-    28159, 28159, 28160, 28160, 28161, 28161, 28161, 28162, 28162, 28162, 28163,
-    28163, 28164, 28164, 28164, 28165, 28165, 28166, 28166, 28166, 28167, 28167,
-    28167, 28168, 28168, 28169, 28169, 28169, 28170, 28170, 28171, 28171, 28171,
-    28172, 28172, 28172, 28173, 28173, 28174, 28174, 28174, 28175, 28175, 28176,
-    28176, 28176, 28177, 28177, 28177, 28178, 28178, 28179, 28179, 28179, 28180,
-    28180, 28180, 28181, 28181, 28182, 28182, 28182, 28183, 28183, 28184, 28184,
-    28184, 28185, 28185, 28185, 28186, 28186, 28187, 28187, 28187, 28188, 28188,
-    28189, 28189, 28189, 28190, 28190, 28190, 28191, 28191, 28192, 28192, 28192,
-    28193, 28193, 28194, 28194, 28194, 28195, 28195, 28195, 28196, 28196, 28197,
-    28197, 28197, 28198, 28198, 28198, 28199, 28199, 28200, 28200, 28200, 28201,
-    28201, 28202, 28202, 28202, 28203, 28203, 28203, 28204, 28204, 28205, 28205,
-    28205, 28206, 28206, 28206, 28207, 28207, 28208, 28208, 28208, 28209, 28209,
-    28210, 28210, 28210, 28211, 28211, 28211, 28212, 28212, 28213, 28213, 28213,
-    28214, 28214, 28214, 28215, 28215, 28216, 28216, 28216, 28217, 28217, 28218,
-    28218, 28218, 28219, 28219, 28219, 28220, 28220, 28221, 28221, 28221, 28222,
-    28222, 28222, 28223, 28223, 28224, 28224, 28224, 28225, 28225, 28226, 28226,
-    28226, 28227, 28227, 28227, 28228, 28228, 28229, 28229, 28229, 28230, 28230,
-    28230, 28231, 28231, 28232, 28232, 28232, 28233, 28233, 28233, 28234, 28234,
-    28235, 28235, 28235, 28236, 28236, 28237, 28237, 28237, 28238, 28238, 28238,
-    28239, 28239, 28240, 28240, 28240, 28241, 28241, 28241, 28242, 28242, 28243,
-    28243, 28243, 28244, 28244, 28244, 28245, 28245, 28246, 28246, 28246, 28247,
-    28247, 28247, 28248, 28248, 28249, 28249, 28249, 28250, 28250, 28251, 28251,
-    28251, 28252, 28252, 28252, 28253, 28253, 28254, 28254, 28254, 28255, 28255,
-    28255, 28256, 28256, 28257, 28257, 28257, 28258, 28258, 28258, 28259, 28259,
-    28260, 28260, 28260, 28261, 28261, 28261, 28262, 28262, 28263, 28263, 28263,
-    28264, 28264, 28264, 28265, 28265, 28266, 28266, 28266, 28267, 28267, 28267,
-    28268, 28268, 28269, 28269, 28269, 28270, 28270, 28271, 28271, 28271, 28272,
-    28272, 28272, 28273, 28273, 28274, 28274, 28274, 28275, 28275, 28275, 28276,
-    28276, 28277, 28277, 28277, 28278, 28278, 28278, 28279, 28279, 28280, 28280,
-    28280, 28281, 28281, 28281, 28282, 28282, 28283, 28283, 28283, 28284, 28284,
-    28284, 28285, 28285, 28286, 28286, 28286, 28287, 28287, 28287, 28288, 28288,
-    28289, 28289, 28289, 28290, 28290, 28290, 28291, 28291, 28292, 28292, 28292,
-    28293, 28293, 28293, 28294, 28294, 28295, 28295, 28295, 28296, 28296, 28296,
-    28297, 28297, 28298, 28298, 28298, 28299, 28299, 28299, 28300, 28300, 28301,
-    28301, 28301, 28302, 28302, 28302, 28303, 28303, 28304, 28304, 28304, 28305,
-    28305, 28305, 28306, 28306, 28307, 28307, 28307, 28308, 28308, 28308, 28309,
-    28309, 28310, 28310, 28310, 28311, 28311, 28311, 28312, 28312, 28313, 28313,
-    28313, 28314, 28314, 28314, 28315, 28315, 28315, 28316, 28316, 28317, 28317,
-    28317, 28318, 28318, 28318, 28319, 28319, 28320, 28320, 28320, 28321, 28321,
-    28321, 28322, 28322, 28323, 28323, 28323, 28324, 28324, 28324, 28325, 28325,
-    28326, 28326, 28326, 28327, 28327, 28327, 28328, 28328, 28329, 28329, 28329,
-    28330, 28330, 28330, 28331, 28331, 28332, 28332, 28332, 28333, 28333, 28333,
-    28334, 28334, 28335, 28335, 28335, 28336, 28336, 28336, 28337, 28337, 28337,
-    28338, 28338, 28339, 28339, 28339, 28340, 28340, 28340, 28341, 28341, 28342,
-    28342, 28342, 28343, 28343, 28343, 28344, 28344, 28345, 28345, 28345, 28346,
-    28346, 28346, 28347, 28347, 28348, 28348, 28348, 28349, 28349, 28349, 28350,
-    28350, 28350, 28351, 28351, 28352, 28352, 28352, 28353, 28353, 28353, 28354,
-    28354, 28355, 28355, 28355, 28356, 28356, 28356, 28357, 28357, 28358, 28358,
-    28358, 28359, 28359, 28359, 28360, 28360, 28360, 28361, 28361, 28362, 28362,
-    28362, 28363, 28363, 28363, 28364, 28364, 28365, 28365, 28365, 28366, 28366,
-    28366, 28367, 28367, 28368, 28368, 28368, 28369, 28369, 28369, 28370, 28370,
-    28370, 28371, 28371, 28372, 28372, 28372, 28373, 28373, 28373, 28374, 28374,
-    28375, 28375, 28375, 28376, 28376, 28376, 28377, 28377, 28377, 28378, 28378,
-    28379, 28379, 28379, 28380, 28380, 28380, 28381, 28381, 28382, 28382, 28382,
-    28383, 28383, 28383, 28384, 28384, 28384, 28385, 28385, 28386, 28386, 28386,
-    28387, 28387, 28387, 28388, 28388, 28389, 28389, 28389, 28390, 28390, 28390,
-    28391, 28391, 28391, 28392, 28392, 28393, 28393, 28393, 28394, 28394, 28394,
-    28395, 28395, 28396, 28396, 28396, 28397, 28397, 28397, 28398, 28398, 28398,
-    28399, 28399, 28400, 28400, 28400, 28401, 28401, 28401, 28402, 28402, 28403,
-    28403, 28403, 28404, 28404, 28404, 28405, 28405, 28405, 28406, 28406, 28407,
-    28407, 28407, 28408, 28408, 28408, 28409, 28409, 28409, 28410, 28410, 28411,
-    28411, 28411, 28412, 28412, 28412, 28413, 28413, 28414, 28414, 28414, 28415,
-    28415, 28415, 28416, 28416, 28416, 28417, 28417, 28418, 28418, 28418, 28419,
-    28419, 28419, 28420, 28420, 28420, 28421, 28421, 28422, 28422, 28422, 28423,
-    28423, 28423, 28424, 28424, 28424, 28425, 28425, 28426, 28426, 28426, 28427,
-    28427, 28427, 28428, 28428, 28429, 28429, 28429, 28430, 28430, 28430, 28431,
-    28431, 28431, 28432, 28432, 28433, 28433, 28433, 28434, 28434, 28434, 28435,
-    28435, 28435, 28436, 28436, 28437, 28437, 28437, 28438, 28438, 28438, 28439,
-    28439, 28439, 28440, 28440, 28441, 28441, 28441, 28442, 28442, 28442, 28443,
-    28443, 28443, 28444, 28444, 28445, 28445, 28445, 28446, 28446, 28446, 28447,
-    28447, 28447, 28448, 28448, 28449, 28449, 28449, 28450, 28450, 28450, 28451,
-    28451, 28451, 28452, 28452, 28453, 28453, 28453, 28454, 28454, 28454, 28455,
-    28455, 28455, 28456, 28456, 28457, 28457, 28457, 28458, 28458, 28458, 28459,
-    28459, 28459, 28460, 28460, 28461, 28461, 28461, 28462, 28462, 28462, 28463,
-    28463, 28463, 28464, 28464, 28465, 28465, 28465, 28466, 28466, 28466, 28467,
-    28467, 28467, 28468, 28468, 28469, 28469, 28469, 28470, 28470, 28470, 28471,
-    28471, 28471, 28472, 28472, 28473, 28473, 28473, 28474, 28474, 28474, 28475,
-    28475, 28475, 28476, 28476, 28477, 28477, 28477, 28478, 28478, 28478, 28479,
-    28479, 28479, 28480, 28480, 28481, 28481, 28481, 28482, 28482, 28482, 28483,
-    28483, 28483, 28484, 28484, 28484, 28485, 28485, 28486, 28486, 28486, 28487,
-    28487, 28487, 28488, 28488, 28488, 28489, 28489, 28490, 28490, 28490, 28491,
-    28491, 28491, 28492, 28492, 28492, 28493, 28493, 28494, 28494, 28494, 28495,
-    28495, 28495, 28496, 28496, 28496, 28497, 28497, 28497, 28498, 28498, 28499,
-    28499, 28499, 28500, 28500, 28500, 28501, 28501, 28501, 28502, 28502, 28503,
-    28503, 28503, 28504, 28504, 28504, 28505, 28505, 28505, 28506, 28506, 28506,
-    28507, 28507, 28508, 28508, 28508, 28509, 28509, 28509, 28510, 28510, 28510,
-    28511, 28511, 28512, 28512, 28512, 28513, 28513, 28513, 28514, 28514, 28514,
-    28515, 28515, 28515, 28516, 28516, 28517, 28517, 28517, 28518, 28518, 28518,
-    28519, 28519, 28519, 28520, 28520, 28521, 28521, 28521, 28522, 28522, 28522,
-    28523, 28523, 28523, 28524, 28524, 28524, 28525, 28525, 28526, 28526, 28526,
-    28527, 28527, 28527, 28528, 28528, 28528, 28529, 28529, 28529, 28530, 28530,
-    28531, 28531, 28531, 28532, 28532, 28532, 28533, 28533, 28533, 28534, 28534,
-    28535, 28535, 28535, 28536, 28536, 28536, 28537, 28537, 28537, 28538, 28538,
-    28538, 28539, 28539, 28540, 28540, 28540, 28541, 28541, 28541, 28542, 28542,
-    28542, 28543, 28543, 28543, 28544, 28544, 28545, 28545, 28545, 28546, 28546,
-    28546, 28547, 28547, 28547, 28548, 28548, 28548, 28549, 28549, 28550, 28550,
-    28550, 28551, 28551, 28551, 28552, 28552, 28552, 28553, 28553, 28553, 28554,
-    28554, 28555, 28555, 28555, 28556, 28556, 28556, 28557, 28557, 28557, 28558,
-    28558, 28558, 28559, 28559, 28560, 28560, 28560, 28561, 28561, 28561, 28562,
-    28562, 28562, 28563, 28563, 28563, 28564, 28564, 28564, 28565, 28565, 28566,
-    28566, 28566, 28567, 28567, 28567, 28568, 28568, 28568, 28569, 28569, 28569,
-    28570, 28570, 28571, 28571, 28571, 28572, 28572, 28572, 28573, 28573, 28573,
-    28574, 28574, 28574, 28575, 28575, 28576, 28576, 28576, 28577, 28577, 28577,
-    28578, 28578, 28578, 28579, 28579, 28579, 28580, 28580, 28580, 28581, 28581,
-    28582, 28582, 28582, 28583, 28583, 28583, 28584, 28584, 28584, 28585, 28585,
-    28585, 28586, 28586, 28587, 28587, 28587, 28588, 28588, 28588, 28589, 28589,
-    28589, 28590, 28590, 28590, 28591, 28591, 28591, 28592, 28592, 28593, 28593,
-    28593, 28594, 28594, 28594, 28595, 28595, 28595, 28596, 28596, 28596, 28597,
-    28597, 28598, 28598, 28598, 28599, 28599, 28599, 28600, 28600, 28600, 28601,
-    28601, 28601, 28602, 28602, 28602, 28603, 28603, 28604, 28604, 28604, 28605,
-    28605, 28605, 28606, 28606, 28606, 28607, 28607, 28607, 28608, 28608, 28608,
-    28609, 28609, 28610, 28610, 28610, 28611, 28611, 28611, 28612, 28612, 28612,
-    28613, 28613, 28613, 28614, 28614, 28614, 28615, 28615, 28616, 28616, 28616,
-    28617, 28617, 28617, 28618, 28618, 28618, 28619, 28619, 28619, 28620, 28620,
-    28620, 28621, 28621, 28622, 28622, 28622, 28623, 28623, 28623, 28624, 28624,
-    28624, 28625, 28625, 28625, 28626, 28626, 28626, 28627, 28627, 28627, 28628,
-    28628, 28629, 28629, 28629, 28630, 28630, 28630, 28631, 28631, 28631, 28632,
-    28632, 28632, 28633, 28633, 28633, 28634, 28634, 28635, 28635, 28635, 28636,
-    28636, 28636, 28637, 28637, 28637, 28638, 28638, 28638, 28639, 28639, 28639,
-    28640, 28640, 28641, 28641, 28641, 28642, 28642, 28642, 28643, 28643, 28643,
-    28644, 28644, 28644, 28645, 28645, 28645, 28646, 28646, 28646, 28647, 28647,
-    28648, 28648, 28648, 28649, 28649, 28649, 28650, 28650, 28650, 28651, 28651,
-    28651, 28652, 28652, 28652, 28653, 28653, 28653, 28654, 28654, 28655, 28655,
-    28655, 28656, 28656, 28656, 28657, 28657, 28657, 28658, 28658, 28658, 28659,
-    28659, 28659, 28660, 28660, 28660, 28661, 28661, 28662, 28662, 28662, 28663,
-    28663, 28663, 28664, 28664, 28664, 28665, 28665, 28665, 28666, 28666, 28666,
-    28667, 28667, 28667, 28668, 28668, 28669, 28669, 28669, 28670, 28670, 28670,
-    28671, 28671, 28671, 28672, 28672, 28672, 28673, 28673, 28673, 28674, 28674,
-    28674, 28675, 28675, 28675, 28676, 28676, 28677, 28677, 28677, 28678, 28678,
-    28678, 28679, 28679, 28679, 28680, 28680, 28680, 28681, 28681, 28681, 28682,
-    28682, 28682, 28683, 28683, 28683, 28684, 28684, 28685, 28685, 28685, 28686,
-    28686, 28686, 28687, 28687, 28687, 28688, 28688, 28688, 28689, 28689, 28689,
-    28690, 28690, 28690, 28691, 28691, 28691, 28692, 28692, 28693, 28693, 28693,
-    28694, 28694, 28694, 28695, 28695, 28695, 28696, 28696, 28696, 28697, 28697,
-    28697, 28698, 28698, 28698, 28699, 28699, 28699, 28700, 28700, 28701, 28701,
-    28701, 28702, 28702, 28702, 28703, 28703, 28703, 28704, 28704, 28704, 28705,
-    28705, 28705, 28706, 28706, 28706, 28707, 28707, 28707, 28708, 28708, 28708,
-    28709, 28709, 28710, 28710, 28710, 28711, 28711, 28711, 28712, 28712, 28712,
-    28713, 28713, 28713, 28714, 28714, 28714, 28715, 28715, 28715, 28716, 28716,
-    28716, 28717, 28717, 28717, 28718, 28718, 28719, 28719, 28719, 28720, 28720,
-    28720, 28721, 28721, 28721, 28722, 28722, 28722, 28723, 28723, 28723, 28724,
-    28724, 28724, 28725, 28725, 28725, 28726, 28726, 28726, 28727, 28727, 28728,
-    28728, 28728, 28729, 28729, 28729, 28730, 28730, 28730, 28731, 28731, 28731,
-    28732, 28732, 28732, 28733, 28733, 28733, 28734, 28734, 28734, 28735, 28735,
-    28735, 28736, 28736, 28736, 28737, 28737, 28738, 28738, 28738, 28739, 28739,
-    28739, 28740, 28740, 28740, 28741, 28741, 28741, 28742, 28742, 28742, 28743,
-    28743, 28743, 28744, 28744, 28744, 28745, 28745, 28745, 28746, 28746, 28746,
-    28747, 28747, 28747, 28748, 28748, 28749, 28749, 28749, 28750, 28750, 28750,
-    28751, 28751, 28751, 28752, 28752, 28752, 28753, 28753, 28753, 28754, 28754,
-    28754, 28755, 28755, 28755, 28756, 28756, 28756, 28757, 28757, 28757, 28758,
-    28758, 28758, 28759, 28759, 28760, 28760, 28760, 28761, 28761, 28761, 28762,
-    28762, 28762, 28763, 28763, 28763, 28764, 28764, 28764, 28765, 28765, 28765,
-    28766, 28766, 28766, 28767, 28767, 28767, 28768, 28768, 28768, 28769, 28769,
-    28769, 28770, 28770, 28770, 28771, 28771, 28772, 28772, 28772, 28773, 28773,
-    28773, 28774, 28774, 28774, 28775, 28775, 28775, 28776, 28776, 28776, 28777,
-    28777, 28777, 28778, 28778, 28778, 28779, 28779, 28779, 28780, 28780, 28780,
-    28781, 28781, 28781, 28782, 28782, 28782, 28783, 28783, 28783, 28784, 28784,
-    28785, 28785, 28785, 28786, 28786, 28786, 28787, 28787, 28787, 28788, 28788,
-    28788, 28789, 28789, 28789, 28790, 28790, 28790, 28791, 28791, 28791, 28792,
-    28792, 28792, 28793, 28793, 28793, 28794, 28794, 28794, 28795, 28795, 28795,
-    28796, 28796, 28796, 28797, 28797, 28797, 28798, 28798, 28798, 28799, 28799,
-    28800, 28800, 28800, 28801, 28801, 28801, 28802, 28802, 28802, 28803, 28803,
-    28803, 28804, 28804, 28804, 28805, 28805, 28805, 28806, 28806, 28806, 28807,
-    28807, 28807, 28808, 28808, 28808, 28809, 28809, 28809, 28810, 28810, 28810,
-    28811, 28811, 28811, 28812, 28812, 28812, 28813, 28813, 28813, 28814, 28814,
-    28814, 28815, 28815, 28815, 28816, 28816, 28817, 28817, 28817, 28818, 28818,
-    28818, 28819, 28819, 28819, 28820, 28820, 28820, 28821, 28821, 28821, 28822,
-    28822, 28822, 28823, 28823, 28823, 28824, 28824, 28824, 28825, 28825, 28825,
-    28826, 28826, 28826, 28827, 28827, 28827, 28828, 28828, 28828, 28829, 28829,
-    28829, 28830, 28830, 28830, 28831, 28831, 28831, 28832, 28832, 28832, 28833,
-    28833, 28833, 28834, 28834, 28834, 28835, 28835, 28835, 28836, 28836, 28836,
-    28837, 28837, 28838, 28838, 28838, 28839, 28839, 28839, 28840, 28840, 28840,
-    28841, 28841, 28841, 28842, 28842, 28842, 28843, 28843, 28843, 28844, 28844,
-    28844, 28845, 28845, 28845, 28846, 28846, 28846, 28847, 28847, 28847, 28848,
-    28848, 28848, 28849, 28849, 28849, 28850, 28850, 28850, 28851, 28851, 28851,
-    28852, 28852, 28852, 28853, 28853, 28853, 28854, 28854, 28854, 28855, 28855,
-    28855, 28856, 28856, 28856, 28857, 28857, 28857, 28858, 28858, 28858, 28859,
-    28859, 28859, 28860, 28860, 28860, 28861, 28861, 28861, 28862, 28862, 28862,
-    28863, 28863, 28863, 28864, 28864, 28864, 28865, 28865, 28865, 28866, 28866,
-    28866, 28867, 28867, 28868, 28868, 28868, 28869, 28869, 28869, 28870, 28870,
-    28870, 28871, 28871, 28871, 28872, 28872, 28872, 28873, 28873, 28873, 28874,
-    28874, 28874, 28875, 28875, 28875, 28876, 28876, 28876, 28877, 28877, 28877,
-    28878, 28878, 28878, 28879, 28879, 28879, 28880, 28880, 28880, 28881, 28881,
-    28881, 28882, 28882, 28882, 28883, 28883, 28883, 28884, 28884, 28884, 28885,
-    28885, 28885, 28886, 28886, 28886, 28887, 28887, 28887, 28888, 28888, 28888,
-    28889, 28889, 28889, 28890, 28890, 28890, 28891, 28891, 28891, 28892, 28892,
-    28892, 28893, 28893, 28893, 28894, 28894, 28894, 28895, 28895, 28895, 28896,
-    28896, 28896, 28897, 28897, 28897, 28898, 28898, 28898, 28899, 28899, 28899,
-    28900, 28900, 28900, 28901, 28901, 28901, 28902, 28902, 28902, 28903, 28903,
-    28903, 28904, 28904, 28904, 28905, 28905, 28905, 28906, 28906, 28906, 28907,
-    28907, 28907, 28908, 28908, 28908, 28909, 28909, 28909, 28910, 28910, 28910,
-    28911, 28911, 28911, 28912, 28912, 28912, 28913, 28913, 28913, 28914, 28914,
-    28914, 28915, 28915, 28915, 28916, 28916, 28916, 28917, 28917, 28917, 28918,
-    28918, 28918, 28919, 28919, 28919, 28920, 28920, 28920, 28921, 28921, 28921,
-    28922, 28922, 28922, 28923, 28923, 28923, 28924, 28924, 28924, 28925, 28925,
-    28925, 28926, 28926, 28926, 28927, 28927, 28927, 28928, 28928, 28928, 28929,
-    28929, 28929, 28930, 28930, 28930, 28931, 28931, 28931, 28932, 28932, 28932,
-    28933, 28933, 28933, 28934, 28934, 28934, 28935, 28935, 28935, 28936, 28936,
-    28936, 28937, 28937, 28937, 28938, 28938, 28938, 28939, 28939, 28939, 28940,
-    28940, 28940, 28941, 28941, 28941, 28942, 28942, 28942, 28943, 28943, 28943,
-    28944, 28944, 28944, 28945, 28945, 28945, 28946, 28946, 28946, 28947, 28947,
-    28947, 28948, 28948, 28948, 28949, 28949, 28949, 28950, 28950, 28950, 28951,
-    28951, 28951, 28952, 28952, 28952, 28953, 28953, 28953, 28954, 28954, 28954,
-    28955, 28955, 28955, 28955, 28956, 28956, 28956, 28957, 28957, 28957, 28958,
-    28958, 28958, 28959, 28959, 28959, 28960, 28960, 28960, 28961, 28961, 28961,
-    28962, 28962, 28962, 28963, 28963, 28963, 28964, 28964, 28964, 28965, 28965,
-    28965, 28966, 28966, 28966, 28967, 28967, 28967, 28968, 28968, 28968, 28969,
-    28969, 28969, 28970, 28970, 28970, 28971, 28971, 28971, 28972, 28972, 28972,
-    28973, 28973, 28973, 28974, 28974, 28974, 28975, 28975, 28975, 28976, 28976,
-    28976, 28977, 28977, 28977, 28978, 28978, 28978, 28979, 28979, 28979, 28980,
-    28980, 28980, 28981, 28981, 28981, 28982, 28982, 28982, 28983, 28983, 28983,
-    28984, 28984, 28984, 28985, 28985, 28985, 28985, 28986, 28986, 28986, 28987,
-    28987, 28987, 28988, 28988, 28988, 28989, 28989, 28989, 28990, 28990, 28990,
-    28991, 28991, 28991, 28992, 28992, 28992, 28993, 28993, 28993, 28994, 28994,
-    28994, 28995, 28995, 28995, 28996, 28996, 28996, 28997, 28997, 28997, 28998,
-    28998, 28998, 28999, 28999, 28999, 29000, 29000, 29000, 29001, 29001, 29001,
-    29002, 29002, 29002, 29003, 29003, 29003, 29004, 29004, 29004, 29005, 29005,
-    29005, 29005, 29006, 29006, 29006, 29007, 29007, 29007, 29008, 29008, 29008,
-    29009, 29009, 29009, 29010, 29010, 29010, 29011, 29011, 29011, 29012, 29012,
-    29012, 29013, 29013, 29013, 29014, 29014, 29014, 29015, 29015, 29015, 29016,
-    29016, 29016, 29017, 29017, 29017, 29018, 29018, 29018, 29019, 29019, 29019,
-    29020, 29020, 29020, 29021, 29021, 29021, 29022, 29022, 29022, 29022, 29023,
-    29023, 29023, 29024, 29024, 29024, 29025, 29025, 29025, 29026, 29026, 29026,
-    29027, 29027, 29027, 29028, 29028, 29028, 29029, 29029, 29029, 29030, 29030,
-    29030, 29031, 29031, 29031, 29032, 29032, 29032, 29033, 29033, 29033, 29034,
-    29034, 29034, 29035, 29035, 29035, 29036, 29036, 29036, 29037, 29037, 29037,
-    29037, 29038, 29038, 29038, 29039, 29039, 29039, 29040, 29040, 29040, 29041,
-    29041, 29041, 29042, 29042, 29042, 29043, 29043, 29043, 29044, 29044, 29044,
-    29045, 29045, 29045, 29046, 29046, 29046, 29047, 29047, 29047, 29048, 29048,
-    29048, 29049, 29049, 29049, 29050, 29050, 29050, 29050, 29051, 29051, 29051,
-    29052, 29052, 29052, 29053, 29053, 29053, 29054, 29054, 29054, 29055, 29055,
-    29055, 29056, 29056, 29056, 29057, 29057, 29057, 29058, 29058, 29058, 29059,
-    29059, 29059, 29060, 29060, 29060, 29061, 29061, 29061, 29062, 29062, 29062,
-    29062, 29063, 29063, 29063, 29064, 29064, 29064, 29065, 29065, 29065, 29066,
-    29066, 29066, 29067, 29067, 29067, 29068, 29068, 29068, 29069, 29069, 29069,
-    29070, 29070, 29070, 29071, 29071, 29071, 29072, 29072, 29072, 29073, 29073,
-    29073, 29073, 29074, 29074, 29074, 29075, 29075, 29075, 29076, 29076, 29076,
-    29077, 29077, 29077, 29078, 29078, 29078, 29079, 29079, 29079, 29080, 29080,
-    29080, 29081, 29081, 29081, 29082, 29082, 29082, 29083, 29083, 29083, 29083,
-    29084, 29084, 29084, 29085, 29085, 29085, 29086, 29086, 29086, 29087, 29087,
-    29087, 29088, 29088, 29088, 29089, 29089, 29089, 29090, 29090, 29090, 29091,
-    29091, 29091, 29092, 29092, 29092, 29093, 29093, 29093, 29093, 29094, 29094,
-    29094, 29095, 29095, 29095, 29096, 29096, 29096, 29097, 29097, 29097, 29098,
-    29098, 29098, 29099, 29099, 29099, 29100, 29100, 29100, 29101, 29101, 29101,
-    29102, 29102, 29102, 29102, 29103, 29103, 29103, 29104, 29104, 29104, 29105,
-    29105, 29105, 29106, 29106, 29106, 29107, 29107, 29107, 29108, 29108, 29108,
-    29109, 29109, 29109, 29110, 29110, 29110, 29111, 29111, 29111, 29111, 29112,
-    29112, 29112, 29113, 29113, 29113, 29114, 29114, 29114, 29115, 29115, 29115,
-    29116, 29116, 29116, 29117, 29117, 29117, 29118, 29118, 29118, 29119, 29119,
-    29119, 29119, 29120, 29120, 29120, 29121, 29121, 29121, 29122, 29122, 29122,
-    29123, 29123, 29123, 29124, 29124, 29124, 29125, 29125, 29125, 29126, 29126,
-    29126, 29127, 29127, 29127, 29128, 29128, 29128, 29128, 29129, 29129, 29129,
-    29130, 29130, 29130, 29131, 29131, 29131, 29132, 29132, 29132, 29133, 29133,
-    29133, 29134, 29134, 29134, 29135, 29135, 29135, 29135, 29136, 29136, 29136,
-    29137, 29137, 29137, 29138, 29138, 29138, 29139, 29139, 29139, 29140, 29140,
-    29140, 29141, 29141, 29141, 29142, 29142, 29142, 29143, 29143, 29143, 29143,
-    29144, 29144, 29144, 29145, 29145, 29145, 29146, 29146, 29146, 29147, 29147,
-    29147, 29148, 29148, 29148, 29149, 29149, 29149, 29150, 29150, 29150, 29150,
-    29151, 29151, 29151, 29152, 29152, 29152, 29153, 29153, 29153, 29154, 29154,
-    29154, 29155, 29155, 29155, 29156, 29156, 29156, 29157, 29157, 29157, 29157,
-    29158, 29158, 29158, 29159, 29159, 29159, 29160, 29160, 29160, 29161, 29161,
-    29161, 29162, 29162, 29162, 29163, 29163, 29163, 29164, 29164, 29164, 29164,
-    29165, 29165, 29165, 29166, 29166, 29166, 29167, 29167, 29167, 29168, 29168,
-    29168, 29169, 29169, 29169, 29170, 29170, 29170, 29171, 29171, 29171, 29171,
-    29172, 29172, 29172, 29173, 29173, 29173, 29174, 29174, 29174, 29175, 29175,
-    29175, 29176, 29176, 29176, 29177, 29177, 29177, 29177, 29178, 29178, 29178,
-    29179, 29179, 29179, 29180, 29180, 29180, 29181, 29181, 29181, 29182, 29182,
-    29182, 29183, 29183, 29183, 29184, 29184, 29184, 29184, 29185, 29185, 29185,
-    29186, 29186, 29186, 29187, 29187, 29187, 29188, 29188, 29188, 29189, 29189,
-    29189, 29190, 29190, 29190, 29190, 29191, 29191, 29191, 29192, 29192, 29192,
-    29193, 29193, 29193, 29194, 29194, 29194, 29195, 29195, 29195, 29196, 29196,
-    29196, 29196, 29197, 29197, 29197, 29198, 29198, 29198, 29199, 29199, 29199,
-    29200, 29200, 29200, 29201, 29201, 29201, 29202, 29202, 29202, 29202, 29203,
-    29203, 29203, 29204, 29204, 29204, 29205, 29205, 29205, 29206, 29206, 29206,
-    29207, 29207, 29207, 29207, 29208, 29208, 29208, 29209, 29209, 29209, 29210,
-    29210, 29210, 29211, 29211, 29211, 29212, 29212, 29212, 29213, 29213, 29213,
-    29213, 29214, 29214, 29214, 29215, 29215, 29215, 29216, 29216, 29216, 29217,
-    29217, 29217, 29218, 29218, 29218, 29219, 29219, 29219, 29219, 29220, 29220,
-    29220, 29221, 29221, 29221, 29222, 29222, 29222, 29223, 29223, 29223, 29224,
-    29224, 29224, 29224, 29225, 29225, 29225, 29226, 29226, 29226, 29227, 29227,
-    29227, 29228, 29228, 29228, 29229, 29229, 29229, 29230, 29230, 29230, 29230,
-    29231, 29231, 29231, 29232, 29232, 29232, 29233, 29233, 29233, 29234, 29234,
-    29234, 29235, 29235, 29235, 29235, 29236, 29236, 29236, 29237, 29237, 29237,
-    29238, 29238, 29238, 29239, 29239, 29239, 29240, 29240, 29240, 29240, 29241,
-    29241, 29241, 29242, 29242, 29242, 29243, 29243, 29243, 29244, 29244, 29244,
-    29245, 29245, 29245, 29245, 29246, 29246, 29246, 29247, 29247, 29247, 29248,
-    29248, 29248, 29249, 29249, 29249, 29250, 29250, 29250, 29250, 29251, 29251,
-    29251, 29252, 29252, 29252, 29253, 29253, 29253, 29254, 29254, 29254, 29255,
-    29255, 29255, 29255, 29256, 29256, 29256, 29257, 29257, 29257, 29258, 29258,
-    29258, 29259, 29259, 29259, 29260, 29260, 29260, 29260, 29261, 29261, 29261,
-    29262, 29262, 29262, 29263, 29263, 29263, 29264, 29264, 29264, 29265, 29265,
-    29265, 29265, 29266, 29266, 29266, 29267, 29267, 29267, 29268, 29268, 29268,
-    29269, 29269, 29269, 29270, 29270, 29270, 29270, 29271, 29271, 29271, 29272,
-    29272, 29272, 29273, 29273, 29273, 29274, 29274, 29274, 29274, 29275, 29275,
-    29275, 29276, 29276, 29276, 29277, 29277, 29277, 29278, 29278, 29278, 29279,
-    29279, 29279, 29279, 29280, 29280, 29280, 29281, 29281, 29281, 29282, 29282,
-    29282, 29283, 29283, 29283, 29284, 29284, 29284, 29284, 29285, 29285, 29285,
-    29286, 29286, 29286, 29287, 29287, 29287, 29288, 29288, 29288, 29288, 29289,
-    29289, 29289, 29290, 29290, 29290, 29291, 29291, 29291, 29292, 29292, 29292,
-    29293, 29293, 29293, 29293, 29294, 29294, 29294, 29295, 29295, 29295, 29296,
-    29296, 29296, 29297, 29297, 29297, 29297, 29298, 29298, 29298, 29299, 29299,
-    29299, 29300, 29300, 29300, 29301, 29301, 29301, 29301, 29302, 29302, 29302,
-    29303, 29303, 29303, 29304, 29304, 29304, 29305, 29305, 29305, 29306, 29306,
-    29306, 29306, 29307, 29307, 29307, 29308, 29308, 29308, 29309, 29309, 29309,
-    29310, 29310, 29310, 29310, 29311, 29311, 29311, 29312, 29312, 29312, 29313,
-    29313, 29313, 29314, 29314, 29314, 29314, 29315, 29315, 29315, 29316, 29316,
-    29316, 29317, 29317, 29317, 29318, 29318, 29318, 29318, 29319, 29319, 29319,
-    29320, 29320, 29320, 29321, 29321, 29321, 29322, 29322, 29322, 29322, 29323,
-    29323, 29323, 29324, 29324, 29324, 29325, 29325, 29325, 29326, 29326, 29326,
-    29326, 29327, 29327, 29327, 29328, 29328, 29328, 29329, 29329, 29329, 29330,
-    29330, 29330, 29330, 29331, 29331, 29331, 29332, 29332, 29332, 29333, 29333,
-    29333, 29334, 29334, 29334, 29334, 29335, 29335, 29335, 29336, 29336, 29336,
-    29337, 29337, 29337, 29338, 29338, 29338, 29338, 29339, 29339, 29339, 29340,
-    29340, 29340, 29341, 29341, 29341, 29342, 29342, 29342, 29342, 29343, 29343,
-    29343, 29344, 29344, 29344, 29345, 29345, 29345, 29346, 29346, 29346, 29346,
-    29347, 29347, 29347, 29348, 29348, 29348, 29349, 29349, 29349, 29350, 29350,
-    29350, 29350, 29351, 29351, 29351, 29352, 29352, 29352, 29353, 29353, 29353,
-    29354, 29354, 29354, 29354, 29355, 29355, 29355, 29356, 29356, 29356, 29357,
-    29357, 29357, 29358, 29358, 29358, 29358, 29359, 29359, 29359, 29360, 29360,
-    29360, 29361, 29361, 29361, 29361, 29362, 29362, 29362, 29363, 29363, 29363,
-    29364, 29364, 29364, 29365, 29365, 29365, 29365, 29366, 29366, 29366, 29367,
-    29367, 29367, 29368, 29368, 29368, 29369, 29369, 29369, 29369, 29370, 29370,
-    29370, 29371, 29371, 29371, 29372, 29372, 29372, 29372, 29373, 29373, 29373,
-    29374, 29374, 29374, 29375, 29375, 29375, 29376, 29376, 29376, 29376, 29377,
-    29377, 29377, 29378, 29378, 29378, 29379, 29379, 29379, 29380, 29380, 29380,
-    29380, 29381, 29381, 29381, 29382, 29382, 29382, 29383, 29383, 29383, 29383,
-    29384, 29384, 29384, 29385, 29385, 29385, 29386, 29386, 29386, 29387, 29387,
-    29387, 29387, 29388, 29388, 29388, 29389, 29389, 29389, 29390, 29390, 29390,
-    29390, 29391, 29391, 29391, 29392, 29392, 29392, 29393, 29393, 29393, 29394,
-    29394, 29394, 29394, 29395, 29395, 29395, 29396, 29396, 29396, 29397, 29397,
-    29397, 29397, 29398, 29398, 29398, 29399, 29399, 29399, 29400, 29400, 29400,
-    29401, 29401, 29401, 29401, 29402, 29402, 29402, 29403, 29403, 29403, 29404,
-    29404, 29404, 29404, 29405, 29405, 29405, 29406, 29406, 29406, 29407, 29407,
-    29407, 29407, 29408, 29408, 29408, 29409, 29409, 29409, 29410, 29410, 29410,
-    29411, 29411, 29411, 29411, 29412, 29412, 29412, 29413, 29413, 29413, 29414,
-    29414, 29414, 29414, 29415, 29415, 29415, 29416, 29416, 29416, 29417, 29417,
-    29417, 29417, 29418, 29418, 29418, 29419, 29419, 29419, 29420, 29420, 29420,
-    29421, 29421, 29421, 29421, 29422, 29422, 29422, 29423, 29423, 29423, 29424,
-    29424, 29424, 29424, 29425, 29425, 29425, 29426, 29426, 29426, 29427, 29427,
-    29427, 29427, 29428, 29428, 29428, 29429, 29429, 29429, 29430, 29430, 29430,
-    29430, 29431, 29431, 29431, 29432, 29432, 29432, 29433, 29433, 29433, 29434,
-    29434, 29434, 29434, 29435, 29435, 29435, 29436, 29436, 29436, 29437, 29437,
-    29437, 29437, 29438, 29438, 29438, 29439, 29439, 29439, 29440, 29440, 29440,
-    29440, 29441, 29441, 29441, 29442, 29442, 29442, 29443, 29443, 29443, 29443,
-    29444, 29444, 29444, 29445, 29445, 29445, 29446, 29446, 29446, 29446, 29447,
-    29447, 29447, 29448, 29448, 29448, 29449, 29449, 29449, 29449, 29450, 29450,
-    29450, 29451, 29451, 29451, 29452, 29452, 29452, 29452, 29453, 29453, 29453,
-    29454, 29454, 29454, 29455, 29455, 29455, 29455, 29456, 29456, 29456, 29457,
-    29457, 29457, 29458, 29458, 29458, 29458, 29459, 29459, 29459, 29460, 29460,
-    29460, 29461, 29461, 29461, 29461, 29462, 29462, 29462, 29463, 29463, 29463,
-    29464, 29464, 29464, 29464, 29465, 29465, 29465, 29466, 29466, 29466, 29467,
-    29467, 29467, 29467, 29468, 29468, 29468, 29469, 29469, 29469, 29470, 29470,
-    29470, 29470, 29471, 29471, 29471, 29472, 29472, 29472, 29473, 29473, 29473,
-    29473, 29474, 29474, 29474, 29475, 29475, 29475, 29476, 29476, 29476, 29476,
-    29477, 29477, 29477, 29478, 29478, 29478, 29479, 29479, 29479, 29479, 29480,
-    29480, 29480, 29481, 29481, 29481, 29482, 29482, 29482, 29482, 29483, 29483,
-    29483, 29484, 29484, 29484, 29485, 29485, 29485, 29485, 29486, 29486, 29486,
-    29487, 29487, 29487, 29488, 29488, 29488, 29488, 29489, 29489, 29489, 29490,
-    29490, 29490, 29491, 29491, 29491, 29491, 29492, 29492, 29492, 29493, 29493,
-    29493, 29494, 29494, 29494, 29494, 29495, 29495, 29495, 29496, 29496, 29496,
-    29496, 29497, 29497, 29497, 29498, 29498, 29498, 29499, 29499, 29499, 29499,
-    29500, 29500, 29500, 29501, 29501, 29501, 29502, 29502, 29502, 29502, 29503,
-    29503, 29503, 29504, 29504, 29504, 29505, 29505, 29505, 29505, 29506, 29506,
-    29506, 29507, 29507, 29507, 29508, 29508, 29508, 29508, 29509, 29509, 29509,
-    29510, 29510, 29510, 29510, 29511, 29511, 29511, 29512, 29512, 29512, 29513,
-    29513, 29513, 29513, 29514, 29514, 29514, 29515, 29515, 29515, 29516, 29516,
-    29516, 29516, 29517, 29517, 29517, 29518, 29518, 29518, 29519, 29519, 29519,
-    29519, 29520, 29520, 29520, 29521, 29521, 29521, 29521, 29522, 29522, 29522,
-    29523, 29523, 29523, 29524, 29524, 29524, 29524, 29525, 29525, 29525, 29526,
-    29526, 29526, 29527, 29527, 29527, 29527, 29528, 29528, 29528, 29529, 29529,
-    29529, 29529, 29530, 29530, 29530, 29531, 29531, 29531, 29532, 29532, 29532,
-    29532, 29533, 29533, 29533, 29534, 29534, 29534, 29535, 29535, 29535, 29535,
-    29536, 29536, 29536, 29537, 29537, 29537, 29537, 29538, 29538, 29538, 29539,
-    29539, 29539, 29540, 29540, 29540, 29540, 29541, 29541, 29541, 29542, 29542,
-    29542, 29543, 29543, 29543, 29543, 29544, 29544, 29544, 29545, 29545, 29545,
-    29545, 29546, 29546, 29546, 29547, 29547, 29547, 29548, 29548, 29548, 29548,
-    29549, 29549, 29549, 29550, 29550, 29550, 29550, 29551, 29551, 29551, 29552,
-    29552, 29552, 29553, 29553, 29553, 29553, 29554, 29554, 29554, 29555, 29555,
-    29555, 29556, 29556, 29556, 29556, 29557, 29557, 29557, 29558, 29558, 29558,
-    29558, 29559, 29559, 29559, 29560, 29560, 29560, 29561, 29561, 29561, 29561,
-    29562, 29562, 29562, 29563, 29563, 29563, 29563, 29564, 29564, 29564, 29565,
-    29565, 29565, 29566, 29566, 29566, 29566, 29567, 29567, 29567, 29568, 29568,
-    29568, 29568, 29569, 29569, 29569, 29570, 29570, 29570, 29571, 29571, 29571,
-    29571, 29572, 29572, 29572, 29573, 29573, 29573, 29573, 29574, 29574, 29574,
-    29575, 29575, 29575, 29576, 29576, 29576, 29576, 29577, 29577, 29577, 29578,
-    29578, 29578, 29578, 29579, 29579, 29579, 29580, 29580, 29580, 29581, 29581,
-    29581, 29581, 29582, 29582, 29582, 29583, 29583, 29583, 29583, 29584, 29584,
-    29584, 29585, 29585, 29585, 29585, 29586, 29586, 29586, 29587, 29587, 29587,
-    29588, 29588, 29588, 29588, 29589, 29589, 29589, 29590, 29590, 29590, 29590,
-    29591, 29591, 29591, 29592, 29592, 29592, 29593, 29593, 29593, 29593, 29594,
-    29594, 29594, 29595, 29595, 29595, 29595, 29596, 29596, 29596, 29597, 29597,
-    29597, 29598, 29598, 29598, 29598, 29599, 29599, 29599, 29600, 29600, 29600,
-    29600, 29601, 29601, 29601, 29602, 29602, 29602, 29602, 29603, 29603, 29603,
-    29604, 29604, 29604, 29605, 29605, 29605, 29605, 29606, 29606, 29606, 29607,
-    29607, 29607, 29607, 29608, 29608, 29608, 29609, 29609, 29609, 29609, 29610,
-    29610, 29610, 29611, 29611, 29611, 29612, 29612, 29612, 29612, 29613, 29613,
-    29613, 29614, 29614, 29614, 29614, 29615, 29615, 29615, 29616, 29616, 29616,
-    29616, 29617, 29617, 29617, 29618, 29618, 29618, 29619, 29619, 29619, 29619,
-    29620, 29620, 29620, 29621, 29621, 29621, 29621, 29622, 29622, 29622, 29623,
-    29623, 29623, 29623, 29624, 29624, 29624, 29625, 29625, 29625, 29626, 29626,
-    29626, 29626, 29627, 29627, 29627, 29628, 29628, 29628, 29628, 29629, 29629,
-    29629, 29630, 29630, 29630, 29630, 29631, 29631, 29631, 29632, 29632, 29632,
-    29632, 29633, 29633, 29633, 29634, 29634, 29634, 29635, 29635, 29635, 29635,
-    29636, 29636, 29636, 29637, 29637, 29637, 29637, 29638, 29638, 29638, 29639,
-    29639, 29639, 29639, 29640, 29640, 29640, 29641, 29641, 29641, 29641, 29642,
-    29642, 29642, 29643, 29643, 29643, 29644, 29644, 29644, 29644, 29645, 29645,
-    29645, 29646, 29646, 29646, 29646, 29647, 29647, 29647, 29648, 29648, 29648,
-    29648, 29649, 29649, 29649, 29650, 29650, 29650, 29650, 29651, 29651, 29651,
-    29652, 29652, 29652, 29652, 29653, 29653, 29653, 29654, 29654, 29654, 29655,
-    29655, 29655, 29655, 29656, 29656, 29656, 29657, 29657, 29657, 29657, 29658,
-    29658, 29658, 29659, 29659, 29659, 29659, 29660, 29660, 29660, 29661, 29661,
-    29661, 29661, 29662, 29662, 29662, 29663, 29663, 29663, 29663, 29664, 29664,
-    29664, 29665, 29665, 29665, 29666, 29666, 29666, 29666, 29667, 29667, 29667,
-    29668, 29668, 29668, 29668, 29669, 29669, 29669, 29670, 29670, 29670, 29670,
-    29671, 29671, 29671, 29672, 29672, 29672, 29672, 29673, 29673, 29673, 29674,
-    29674, 29674, 29674, 29675, 29675, 29675, 29676, 29676, 29676, 29676, 29677,
-    29677, 29677, 29678, 29678, 29678, 29678, 29679, 29679, 29679, 29680, 29680,
-    29680, 29680, 29681, 29681, 29681, 29682, 29682, 29682, 29683, 29683, 29683,
-    29683, 29684, 29684, 29684, 29685, 29685, 29685, 29685, 29686, 29686, 29686,
-    29687, 29687, 29687, 29687, 29688, 29688, 29688, 29689, 29689, 29689, 29689,
-    29690, 29690, 29690, 29691, 29691, 29691, 29691, 29692, 29692, 29692, 29693,
-    29693, 29693, 29693, 29694, 29694, 29694, 29695, 29695, 29695, 29695, 29696,
-    29696, 29696, 29697, 29697, 29697, 29697, 29698, 29698, 29698, 29699, 29699,
-    29699, 29699, 29700, 29700, 29700, 29701, 29701, 29701, 29701, 29702, 29702,
-    29702, 29703, 29703, 29703, 29703, 29704, 29704, 29704, 29705, 29705, 29705,
-    29705, 29706, 29706, 29706, 29707, 29707, 29707, 29707, 29708, 29708, 29708,
-    29709, 29709, 29709, 29710, 29710, 29710, 29710, 29711, 29711, 29711, 29712,
-    29712, 29712, 29712, 29713, 29713, 29713, 29714, 29714, 29714, 29714, 29715,
-    29715, 29715, 29716, 29716, 29716, 29716, 29717, 29717, 29717, 29718, 29718,
-    29718, 29718, 29719, 29719, 29719, 29720, 29720, 29720, 29720, 29721, 29721,
-    29721, 29722, 29722, 29722, 29722, 29723, 29723, 29723, 29724, 29724, 29724,
-    29724, 29725, 29725, 29725, 29726, 29726, 29726, 29726, 29727, 29727, 29727,
-    29728, 29728, 29728, 29728, 29729, 29729, 29729, 29730, 29730, 29730, 29730,
-    29731, 29731, 29731, 29732, 29732, 29732, 29732, 29733, 29733, 29733, 29733,
-    29734, 29734, 29734, 29735, 29735, 29735, 29735, 29736, 29736, 29736, 29737,
-    29737, 29737, 29737, 29738, 29738, 29738, 29739, 29739, 29739, 29739, 29740,
-    29740, 29740, 29741, 29741, 29741, 29741, 29742, 29742, 29742, 29743, 29743,
-    29743, 29743, 29744, 29744, 29744, 29745, 29745, 29745, 29745, 29746, 29746,
-    29746, 29747, 29747, 29747, 29747, 29748, 29748, 29748, 29749, 29749, 29749,
-    29749, 29750, 29750, 29750, 29751, 29751, 29751, 29751, 29752, 29752, 29752,
-    29753, 29753, 29753, 29753, 29754, 29754, 29754, 29755, 29755, 29755, 29755,
-    29756, 29756, 29756, 29757, 29757, 29757, 29757, 29758, 29758, 29758, 29759,
-    29759, 29759, 29759, 29760, 29760, 29760, 29761, 29761, 29761, 29761, 29762,
-    29762, 29762, 29762, 29763, 29763, 29763, 29764, 29764, 29764, 29764, 29765,
-    29765, 29765, 29766, 29766, 29766, 29766, 29767, 29767, 29767, 29768, 29768,
-    29768, 29768, 29769, 29769, 29769, 29770, 29770, 29770, 29770, 29771, 29771,
-    29771, 29772, 29772, 29772, 29772, 29773, 29773, 29773, 29774, 29774, 29774,
-    29774, 29775, 29775, 29775, 29776, 29776, 29776, 29776, 29777, 29777, 29777,
-    29777, 29778, 29778, 29778, 29779, 29779, 29779, 29779, 29780, 29780, 29780,
-    29781, 29781, 29781, 29781, 29782, 29782, 29782, 29783, 29783, 29783, 29783,
-    29784, 29784, 29784, 29785, 29785, 29785, 29785, 29786, 29786, 29786, 29787,
-    29787, 29787, 29787, 29788, 29788, 29788, 29789, 29789, 29789, 29789, 29790,
-    29790, 29790, 29790, 29791, 29791, 29791, 29792, 29792, 29792, 29792, 29793,
-    29793, 29793, 29794, 29794, 29794, 29794, 29795, 29795, 29795, 29796, 29796,
-    29796, 29796, 29797, 29797, 29797, 29798, 29798, 29798, 29798, 29799, 29799,
-    29799, 29799, 29800, 29800, 29800, 29801, 29801, 29801, 29801, 29802, 29802,
-    29802, 29803, 29803, 29803, 29803, 29804, 29804, 29804, 29805, 29805, 29805,
-    29805, 29806, 29806, 29806, 29807, 29807, 29807, 29807, 29808, 29808, 29808,
-    29808, 29809, 29809, 29809, 29810, 29810, 29810, 29810, 29811, 29811, 29811,
-    29812, 29812, 29812, 29812, 29813, 29813, 29813, 29814, 29814, 29814, 29814,
-    29815, 29815, 29815, 29816, 29816, 29816, 29816, 29817, 29817, 29817, 29817,
-    29818, 29818, 29818, 29819, 29819, 29819, 29819, 29820, 29820, 29820, 29821,
-    29821, 29821, 29821, 29822, 29822, 29822, 29823, 29823, 29823, 29823, 29824,
-    29824, 29824, 29824, 29825, 29825, 29825, 29826, 29826, 29826, 29826, 29827,
-    29827, 29827, 29828, 29828, 29828, 29828, 29829, 29829, 29829, 29830, 29830,
-    29830, 29830, 29831, 29831, 29831, 29831, 29832, 29832, 29832, 29833, 29833,
-    29833, 29833, 29834, 29834, 29834, 29835, 29835, 29835, 29835, 29836, 29836,
-    29836, 29837, 29837, 29837, 29837, 29838, 29838, 29838, 29838, 29839, 29839,
-    29839, 29840, 29840, 29840, 29840, 29841, 29841, 29841, 29842, 29842, 29842,
-    29842, 29843, 29843, 29843, 29844, 29844, 29844, 29844, 29845, 29845, 29845,
-    29845, 29846, 29846, 29846, 29847, 29847, 29847, 29847, 29848, 29848, 29848,
-    29849, 29849, 29849, 29849, 29850, 29850, 29850, 29850, 29851, 29851, 29851,
-    29852, 29852, 29852, 29852, 29853, 29853, 29853, 29854, 29854, 29854, 29854,
-    29855, 29855, 29855, 29855, 29856, 29856, 29856, 29857, 29857, 29857, 29857,
-    29858, 29858, 29858, 29859, 29859, 29859, 29859, 29860, 29860, 29860, 29861,
-    29861, 29861, 29861, 29862, 29862, 29862, 29862, 29863, 29863, 29863, 29864,
-    29864, 29864, 29864, 29865, 29865, 29865, 29866, 29866, 29866, 29866, 29867,
-    29867, 29867, 29867, 29868, 29868, 29868, 29869, 29869, 29869, 29869, 29870,
-    29870, 29870, 29871, 29871, 29871, 29871, 29872, 29872, 29872, 29872, 29873,
-    29873, 29873, 29874, 29874, 29874, 29874, 29875, 29875, 29875, 29876, 29876,
-    29876, 29876, 29877, 29877, 29877, 29877, 29878, 29878, 29878, 29879, 29879,
-    29879, 29879, 29880, 29880, 29880, 29880, 29881, 29881, 29881, 29882, 29882,
-    29882, 29882, 29883, 29883, 29883, 29884, 29884, 29884, 29884, 29885, 29885,
-    29885, 29885, 29886, 29886, 29886, 29887, 29887, 29887, 29887, 29888, 29888,
-    29888, 29889, 29889, 29889, 29889, 29890, 29890, 29890, 29890, 29891, 29891,
-    29891, 29892, 29892, 29892, 29892, 29893, 29893, 29893, 29894, 29894, 29894,
-    29894, 29895, 29895, 29895, 29895, 29896, 29896, 29896, 29897, 29897, 29897,
-    29897, 29898, 29898, 29898, 29898, 29899, 29899, 29899, 29900, 29900, 29900,
-    29900, 29901, 29901, 29901, 29902, 29902, 29902, 29902, 29903, 29903, 29903,
-    29903, 29904, 29904, 29904, 29905, 29905, 29905, 29905, 29906, 29906, 29906,
-    29906, 29907, 29907, 29907, 29908, 29908, 29908, 29908, 29909, 29909, 29909,
-    29910, 29910, 29910, 29910, 29911, 29911, 29911, 29911, 29912, 29912, 29912,
-    29913, 29913, 29913, 29913, 29914, 29914, 29914, 29914, 29915, 29915, 29915,
-    29916, 29916, 29916, 29916, 29917, 29917, 29917, 29918, 29918, 29918, 29918,
-    29919, 29919, 29919, 29919, 29920, 29920, 29920, 29921, 29921, 29921, 29921,
-    29922, 29922, 29922, 29922, 29923, 29923, 29923, 29924, 29924, 29924, 29924,
-    29925, 29925, 29925, 29925, 29926, 29926, 29926, 29927, 29927, 29927, 29927,
-    29928, 29928, 29928, 29929, 29929, 29929, 29929, 29930, 29930, 29930, 29930,
-    29931, 29931, 29931, 29932, 29932, 29932, 29932, 29933, 29933, 29933, 29933,
-    29934, 29934, 29934, 29935, 29935, 29935, 29935, 29936, 29936, 29936, 29936,
-    29937, 29937, 29937, 29938, 29938, 29938, 29938, 29939, 29939, 29939, 29939,
-    29940, 29940, 29940, 29941, 29941, 29941, 29941, 29942, 29942, 29942, 29942,
-    29943, 29943, 29943, 29944, 29944, 29944, 29944, 29945, 29945, 29945, 29946,
-    29946, 29946, 29946, 29947, 29947, 29947, 29947, 29948, 29948, 29948, 29949,
-    29949, 29949, 29949, 29950, 29950, 29950, 29950, 29951, 29951, 29951, 29952,
-    29952, 29952, 29952, 29953, 29953, 29953, 29953, 29954, 29954, 29954, 29955,
-    29955, 29955, 29955, 29956, 29956, 29956, 29956, 29957, 29957, 29957, 29958,
-    29958, 29958, 29958, 29959, 29959, 29959, 29959, 29960, 29960, 29960, 29961,
-    29961, 29961, 29961, 29962, 29962, 29962, 29962, 29963, 29963, 29963, 29964,
-    29964, 29964, 29964, 29965, 29965, 29965, 29965, 29966, 29966, 29966, 29967,
-    29967, 29967, 29967, 29968, 29968, 29968, 29968, 29969, 29969, 29969, 29970,
-    29970, 29970, 29970, 29971, 29971, 29971, 29971, 29972, 29972, 29972, 29973,
-    29973, 29973, 29973, 29974, 29974, 29974, 29974, 29975, 29975, 29975, 29976,
-    29976, 29976, 29976, 29977, 29977, 29977, 29977, 29978, 29978, 29978, 29979,
-    29979, 29979, 29979, 29980, 29980, 29980, 29980, 29981, 29981, 29981, 29982,
-    29982, 29982, 29982, 29983, 29983, 29983, 29983, 29984, 29984, 29984, 29985,
-    29985, 29985, 29985, 29986, 29986, 29986, 29986, 29987, 29987, 29987, 29987,
-    29988, 29988, 29988, 29989, 29989, 29989, 29989, 29990, 29990, 29990, 29990,
-    29991, 29991, 29991, 29992, 29992, 29992, 29992, 29993, 29993, 29993, 29993,
-    29994, 29994, 29994, 29995, 29995, 29995, 29995, 29996, 29996, 29996, 29996,
-    29997, 29997, 29997, 29998, 29998, 29998, 29998, 29999, 29999, 29999, 29999,
-    30000, 30000, 30000, 30001, 30001, 30001, 30001, 30002, 30002, 30002, 30002,
-    30003, 30003, 30003, 30003, 30004, 30004, 30004, 30005, 30005, 30005, 30005,
-    30006, 30006, 30006, 30006, 30007, 30007, 30007, 30008, 30008, 30008, 30008,
-    30009, 30009, 30009, 30009, 30010, 30010, 30010, 30011, 30011, 30011, 30011,
-    30012, 30012, 30012, 30012, 30013, 30013, 30013, 30014, 30014, 30014, 30014,
-    30015, 30015, 30015, 30015, 30016, 30016, 30016, 30016, 30017, 30017, 30017,
-    30018, 30018, 30018, 30018, 30019, 30019, 30019, 30019, 30020, 30020, 30020,
-    30021, 30021, 30021, 30021, 30022, 30022, 30022, 30022, 30023, 30023, 30023,
-    30023, 30024, 30024, 30024, 30025, 30025, 30025, 30025, 30026, 30026, 30026,
-    30026, 30027, 30027, 30027, 30028, 30028, 30028, 30028, 30029, 30029, 30029,
-    30029, 30030, 30030, 30030, 30031, 30031, 30031, 30031, 30032, 30032, 30032,
-    30032, 30033, 30033, 30033, 30033, 30034, 30034, 30034, 30035, 30035, 30035,
-    30035, 30036, 30036, 30036, 30036, 30037, 30037, 30037, 30038, 30038, 30038,
-    30038, 30039, 30039, 30039, 30039, 30040, 30040, 30040, 30040, 30041, 30041,
-    30041, 30042, 30042, 30042, 30042, 30043, 30043, 30043, 30043, 30044, 30044,
-    30044, 30044, 30045, 30045, 30045, 30046, 30046, 30046, 30046, 30047, 30047,
-    30047, 30047, 30048, 30048, 30048, 30049, 30049, 30049, 30049, 30050, 30050,
-    30050, 30050, 30051, 30051, 30051, 30051, 30052, 30052, 30052, 30053, 30053,
-    30053, 30053, 30054, 30054, 30054, 30054, 30055, 30055, 30055, 30055, 30056,
-    30056, 30056, 30057, 30057, 30057, 30057, 30058, 30058, 30058, 30058, 30059,
-    30059, 30059, 30060, 30060, 30060, 30060, 30061, 30061, 30061, 30061, 30062,
-    30062, 30062, 30062, 30063, 30063, 30063, 30064, 30064, 30064, 30064, 30065,
-    30065, 30065, 30065, 30066, 30066, 30066, 30066, 30067, 30067, 30067, 30068,
-    30068, 30068, 30068, 30069, 30069, 30069, 30069, 30070, 30070, 30070, 30070,
-    30071, 30071, 30071, 30072, 30072, 30072, 30072, 30073, 30073, 30073, 30073,
-    30074, 30074, 30074, 30074, 30075, 30075, 30075, 30076, 30076, 30076, 30076,
-    30077, 30077, 30077, 30077, 30078, 30078, 30078, 30079, 30079, 30079, 30079,
-    30080, 30080, 30080, 30080, 30081, 30081, 30081, 30081, 30082, 30082, 30082,
-    30083, 30083, 30083, 30083, 30084, 30084, 30084, 30084, 30085, 30085, 30085,
-    30085, 30086, 30086, 30086, 30087, 30087, 30087, 30087, 30088, 30088, 30088,
-    30088, 30089, 30089, 30089, 30089, 30090, 30090, 30090, 30090, 30091, 30091,
-    30091, 30092, 30092, 30092, 30092, 30093, 30093, 30093, 30093, 30094, 30094,
-    30094, 30094, 30095, 30095, 30095, 30096, 30096, 30096, 30096, 30097, 30097,
-    30097, 30097, 30098, 30098, 30098, 30098, 30099, 30099, 30099, 30100, 30100,
-    30100, 30100, 30101, 30101, 30101, 30101, 30102, 30102, 30102, 30102, 30103,
-    30103, 30103, 30104, 30104, 30104, 30104, 30105, 30105, 30105, 30105, 30106,
-    30106, 30106, 30106, 30107, 30107, 30107, 30108, 30108, 30108, 30108, 30109,
-    30109, 30109, 30109, 30110, 30110, 30110, 30110, 30111, 30111, 30111, 30111,
-    30112, 30112, 30112, 30113, 30113, 30113, 30113, 30114, 30114, 30114, 30114,
-    30115, 30115, 30115, 30115, 30116, 30116, 30116, 30117, 30117, 30117, 30117,
-    30118, 30118, 30118, 30118, 30119, 30119, 30119, 30119, 30120, 30120, 30120,
-    30121, 30121, 30121, 30121, 30122, 30122, 30122, 30122, 30123, 30123, 30123,
-    30123, 30124, 30124, 30124, 30124, 30125, 30125, 30125, 30126, 30126, 30126,
-    30126, 30127, 30127, 30127, 30127, 30128, 30128, 30128, 30128, 30129, 30129,
-    30129, 30130, 30130, 30130, 30130, 30131, 30131, 30131, 30131, 30132, 30132,
-    30132, 30132, 30133, 30133, 30133, 30133, 30134, 30134, 30134, 30135, 30135,
-    30135, 30135, 30136, 30136, 30136, 30136, 30137, 30137, 30137, 30137, 30138,
-    30138, 30138, 30138, 30139, 30139, 30139, 30140, 30140, 30140, 30140, 30141,
-    30141, 30141, 30141, 30142, 30142, 30142, 30142, 30143, 30143, 30143, 30143,
-    30144, 30144, 30144, 30145, 30145, 30145, 30145, 30146, 30146, 30146, 30146,
-    30147, 30147, 30147, 30147, 30148, 30148, 30148, 30149, 30149, 30149, 30149,
-    30150, 30150, 30150, 30150, 30151, 30151, 30151, 30151, 30152, 30152, 30152,
-    30152, 30153, 30153, 30153, 30154, 30154, 30154, 30154, 30155, 30155, 30155,
-    30155, 30156, 30156, 30156, 30156, 30157, 30157, 30157, 30157, 30158, 30158,
-    30158, 30159, 30159, 30159, 30159, 30160, 30160, 30160, 30160, 30161, 30161,
-    30161, 30161, 30162, 30162, 30162, 30162, 30163, 30163, 30163, 30163, 30164,
-    30164, 30164, 30165, 30165, 30165, 30165, 30166, 30166, 30166, 30166, 30167,
-    30167, 30167, 30167, 30168, 30168, 30168, 30168, 30169, 30169, 30169, 30170,
-    30170, 30170, 30170, 30171, 30171, 30171, 30171, 30172, 30172, 30172, 30172,
-    30173, 30173, 30173, 30173, 30174, 30174, 30174, 30175, 30175, 30175, 30175,
-    30176, 30176, 30176, 30176, 30177, 30177, 30177, 30177, 30178, 30178, 30178,
-    30178, 30179, 30179, 30179, 30179, 30180, 30180, 30180, 30181, 30181, 30181,
-    30181, 30182, 30182, 30182, 30182, 30183, 30183, 30183, 30183, 30184, 30184,
-    30184, 30184, 30185, 30185, 30185, 30186, 30186, 30186, 30186, 30187, 30187,
-    30187, 30187, 30188, 30188, 30188, 30188, 30189, 30189, 30189, 30189, 30190,
-    30190, 30190, 30190, 30191, 30191, 30191, 30192, 30192, 30192, 30192, 30193,
-    30193, 30193, 30193, 30194, 30194, 30194, 30194, 30195, 30195, 30195, 30195,
-    30196, 30196, 30196, 30196, 30197, 30197, 30197, 30198, 30198, 30198, 30198,
-    30199, 30199, 30199, 30199, 30200, 30200, 30200, 30200, 30201, 30201, 30201,
-    30201, 30202, 30202, 30202, 30202, 30203, 30203, 30203, 30204, 30204, 30204,
-    30204, 30205, 30205, 30205, 30205, 30206, 30206, 30206, 30206, 30207, 30207,
-    30207, 30207, 30208, 30208, 30208, 30208, 30209, 30209, 30209, 30210, 30210,
-    30210, 30210, 30211, 30211, 30211, 30211, 30212, 30212, 30212, 30212, 30213,
-    30213, 30213, 30213, 30214, 30214, 30214, 30214, 30215, 30215, 30215, 30216,
-    30216, 30216, 30216, 30217, 30217, 30217, 30217, 30218, 30218, 30218, 30218,
-    30219, 30219, 30219, 30219, 30220, 30220, 30220, 30220, 30221, 30221, 30221,
-    30221, 30222, 30222, 30222, 30223, 30223, 30223, 30223, 30224, 30224, 30224,
-    30224, 30225, 30225, 30225, 30225, 30226, 30226, 30226, 30226, 30227, 30227,
-    30227, 30227, 30228, 30228, 30228, 30228, 30229, 30229, 30229, 30230, 30230,
-    30230, 30230, 30231, 30231, 30231, 30231, 30232, 30232, 30232, 30232, 30233,
-    30233, 30233, 30233, 30234, 30234, 30234, 30234, 30235, 30235, 30235, 30235,
-    30236, 30236, 30236, 30237, 30237, 30237, 30237, 30238, 30238, 30238, 30238,
-    30239, 30239, 30239, 30239, 30240, 30240, 30240, 30240, 30241, 30241, 30241,
-    30241, 30242, 30242, 30242, 30242, 30243, 30243, 30243, 30244, 30244, 30244,
-    30244, 30245, 30245, 30245, 30245, 30246, 30246, 30246, 30246, 30247, 30247,
-    30247, 30247, 30248, 30248, 30248, 30248, 30249, 30249, 30249, 30249, 30250,
-    30250, 30250, 30250, 30251, 30251, 30251, 30252, 30252, 30252, 30252, 30253,
-    30253, 30253, 30253, 30254, 30254, 30254, 30254, 30255, 30255, 30255, 30255,
-    30256, 30256, 30256, 30256, 30257, 30257, 30257, 30257, 30258, 30258, 30258,
-    30258, 30259, 30259, 30259, 30260, 30260, 30260, 30260, 30261, 30261, 30261,
-    30261, 30262, 30262, 30262, 30262, 30263, 30263, 30263, 30263, 30264, 30264,
-    30264, 30264, 30265, 30265, 30265, 30265, 30266, 30266, 30266, 30266, 30267,
-    30267, 30267, 30268, 30268, 30268, 30268, 30269, 30269, 30269, 30269, 30270,
-    30270, 30270, 30270, 30271, 30271, 30271, 30271, 30272, 30272, 30272, 30272,
-    30273, 30273, 30273, 30273, 30274, 30274, 30274, 30274, 30275, 30275, 30275,
-    30275, 30276, 30276, 30276, 30277, 30277, 30277, 30277, 30278, 30278, 30278,
-    30278, 30279, 30279, 30279, 30279, 30280, 30280, 30280, 30280, 30281, 30281,
-    30281, 30281, 30282, 30282, 30282, 30282, 30283, 30283, 30283, 30283, 30284,
-    30284, 30284, 30284, 30285, 30285, 30285, 30286, 30286, 30286, 30286, 30287,
-    30287, 30287, 30287, 30288, 30288, 30288, 30288, 30289, 30289, 30289, 30289,
-    30290, 30290, 30290, 30290, 30291, 30291, 30291, 30291, 30292, 30292, 30292,
-    30292, 30293, 30293, 30293, 30293, 30294, 30294, 30294, 30294, 30295, 30295,
-    30295, 30296, 30296, 30296, 30296, 30297, 30297, 30297, 30297, 30298, 30298,
-    30298, 30298, 30299, 30299, 30299, 30299, 30300, 30300, 30300, 30300, 30301,
-    30301, 30301, 30301, 30302, 30302, 30302, 30302, 30303, 30303, 30303, 30303,
-    30304, 30304, 30304, 30304, 30305, 30305, 30305, 30305, 30306, 30306, 30306,
-    30307, 30307, 30307, 30307, 30308, 30308, 30308, 30308, 30309, 30309, 30309,
-    30309, 30310, 30310, 30310, 30310, 30311, 30311, 30311, 30311, 30312, 30312,
-    30312, 30312, 30313, 30313, 30313, 30313, 30314, 30314, 30314, 30314, 30315,
-    30315, 30315, 30315, 30316, 30316, 30316, 30316, 30317, 30317, 30317, 30317,
-    30318, 30318, 30318, 30319, 30319, 30319, 30319, 30320, 30320, 30320, 30320,
-    30321, 30321, 30321, 30321, 30322, 30322, 30322, 30322, 30323, 30323, 30323,
-    30323, 30324, 30324, 30324, 30324, 30325, 30325, 30325, 30325, 30326, 30326,
-    30326, 30326, 30327, 30327, 30327, 30327, 30328, 30328, 30328, 30328, 30329,
-    30329, 30329, 30329, 30330, 30330, 30330, 30330, 30331, 30331, 30331, 30331,
-    30332, 30332, 30332, 30333, 30333, 30333, 30333, 30334, 30334, 30334, 30334,
-    30335, 30335, 30335, 30335, 30336, 30336, 30336, 30336, 30337, 30337, 30337,
-    30337, 30338, 30338, 30338, 30338, 30339, 30339, 30339, 30339, 30340, 30340,
-    30340, 30340, 30341, 30341, 30341, 30341, 30342, 30342, 30342, 30342, 30343,
-    30343, 30343, 30343, 30344, 30344, 30344, 30344, 30345, 30345, 30345, 30345,
-    30346, 30346, 30346, 30346, 30347, 30347, 30347, 30347, 30348, 30348, 30348,
-    30349, 30349, 30349, 30349, 30350, 30350, 30350, 30350, 30351, 30351, 30351,
-    30351, 30352, 30352, 30352, 30352, 30353, 30353, 30353, 30353, 30354, 30354,
-    30354, 30354, 30355, 30355, 30355, 30355, 30356, 30356, 30356, 30356, 30357,
-    30357, 30357, 30357, 30358, 30358, 30358, 30358, 30359, 30359, 30359, 30359,
-    30360, 30360, 30360, 30360, 30361, 30361, 30361, 30361, 30362, 30362, 30362,
-    30362, 30363, 30363, 30363, 30363, 30364, 30364, 30364, 30364, 30365, 30365,
-    30365, 30365, 30366, 30366, 30366, 30366, 30367, 30367, 30367, 30367, 30368,
-    30368, 30368, 30369, 30369, 30369, 30369, 30370, 30370, 30370, 30370, 30371,
-    30371, 30371, 30371, 30372, 30372, 30372, 30372, 30373, 30373, 30373, 30373,
-    30374, 30374, 30374, 30374, 30375, 30375, 30375, 30375, 30376, 30376, 30376,
-    30376, 30377, 30377, 30377, 30377, 30378, 30378, 30378, 30378, 30379, 30379,
-    30379, 30379, 30380, 30380, 30380, 30380, 30381, 30381, 30381, 30381, 30382,
-    30382, 30382, 30382, 30383, 30383, 30383, 30383, 30384, 30384, 30384, 30384,
-    30385, 30385, 30385, 30385, 30386, 30386, 30386, 30386, 30387, 30387, 30387,
-    30387, 30388, 30388, 30388, 30388, 30389, 30389, 30389, 30389, 30390, 30390,
-    30390, 30390, 30391, 30391, 30391, 30391, 30392, 30392, 30392, 30392, 30393,
-    30393, 30393, 30393, 30394, 30394, 30394, 30394, 30395, 30395, 30395, 30395,
-    30396, 30396, 30396, 30396, 30397, 30397, 30397, 30397, 30398, 30398, 30398,
-    30398, 30399, 30399, 30399, 30399, 30400, 30400, 30400, 30400, 30401, 30401,
-    30401, 30401, 30402, 30402, 30402, 30402, 30403, 30403, 30403, 30403, 30404,
-    30404, 30404, 30404, 30405, 30405, 30405, 30406, 30406, 30406, 30406, 30407,
-    30407, 30407, 30407, 30408, 30408, 30408, 30408, 30409, 30409, 30409, 30409,
-    30410, 30410, 30410, 30410, 30411, 30411, 30411, 30411, 30412, 30412, 30412,
-    30412, 30413, 30413, 30413, 30413, 30414, 30414, 30414, 30414, 30415, 30415,
-    30415, 30415, 30416, 30416, 30416, 30416, 30417, 30417, 30417, 30417, 30418,
-    30418, 30418, 30418, 30419, 30419, 30419, 30419, 30420, 30420, 30420, 30420,
-    30421, 30421, 30421, 30421, 30422, 30422, 30422, 30422, 30423, 30423, 30423,
-    30423, 30424, 30424, 30424, 30424, 30425, 30425, 30425, 30425, 30426, 30426,
-    30426, 30426, 30427, 30427, 30427, 30427, 30428, 30428, 30428, 30428, 30429,
-    30429, 30429, 30429, 30430, 30430, 30430, 30430, 30431, 30431, 30431, 30431,
-    30432, 30432, 30432, 30432, 30433, 30433, 30433, 30433, 30434, 30434, 30434,
-    30434, 30435, 30435, 30435, 30435, 30436, 30436, 30436, 30436, 30437, 30437,
-    30437, 30437, 30438, 30438, 30438, 30438, 30439, 30439, 30439, 30439, 30440,
-    30440, 30440, 30440, 30441, 30441, 30441, 30441, 30441, 30442, 30442, 30442,
-    30442, 30443, 30443, 30443, 30443, 30444, 30444, 30444, 30444, 30445, 30445,
-    30445, 30445, 30446, 30446, 30446, 30446, 30447, 30447, 30447, 30447, 30448,
-    30448, 30448, 30448, 30449, 30449, 30449, 30449, 30450, 30450, 30450, 30450,
-    30451, 30451, 30451, 30451, 30452, 30452, 30452, 30452, 30453, 30453, 30453,
-    30453, 30454, 30454, 30454, 30454, 30455, 30455, 30455, 30455, 30456, 30456,
-    30456, 30456, 30457, 30457, 30457, 30457, 30458, 30458, 30458, 30458, 30459,
-    30459, 30459, 30459, 30460, 30460, 30460, 30460, 30461, 30461, 30461, 30461,
-    30462, 30462, 30462, 30462, 30463, 30463, 30463, 30463, 30464, 30464, 30464,
-    30464, 30465, 30465, 30465, 30465, 30466, 30466, 30466, 30466, 30467, 30467,
-    30467, 30467, 30468, 30468, 30468, 30468, 30469, 30469, 30469, 30469, 30470,
-    30470, 30470, 30470, 30471, 30471, 30471, 30471, 30472, 30472, 30472, 30472,
-    30473, 30473, 30473, 30473, 30474, 30474, 30474, 30474, 30475, 30475, 30475,
-    30475, 30476, 30476, 30476, 30476, 30477, 30477, 30477, 30477, 30477, 30478,
-    30478, 30478, 30478, 30479, 30479, 30479, 30479, 30480, 30480, 30480, 30480,
-    30481, 30481, 30481, 30481, 30482, 30482, 30482, 30482, 30483, 30483, 30483,
-    30483, 30484, 30484, 30484, 30484, 30485, 30485, 30485, 30485, 30486, 30486,
-    30486, 30486, 30487, 30487, 30487, 30487, 30488, 30488, 30488, 30488, 30489,
-    30489, 30489, 30489, 30490, 30490, 30490, 30490, 30491, 30491, 30491, 30491,
-    30492, 30492, 30492, 30492, 30493, 30493, 30493, 30493, 30494, 30494, 30494,
-    30494, 30495, 30495, 30495, 30495, 30496, 30496, 30496, 30496, 30497, 30497,
-    30497, 30497, 30497, 30498, 30498, 30498, 30498, 30499, 30499, 30499, 30499,
-    30500, 30500, 30500, 30500, 30501, 30501, 30501, 30501, 30502, 30502, 30502,
-    30502, 30503, 30503, 30503, 30503, 30504, 30504, 30504, 30504, 30505, 30505,
-    30505, 30505, 30506, 30506, 30506, 30506, 30507, 30507, 30507, 30507, 30508,
-    30508, 30508, 30508, 30509, 30509, 30509, 30509, 30510, 30510, 30510, 30510,
-    30511, 30511, 30511, 30511, 30512, 30512, 30512, 30512, 30513, 30513, 30513,
-    30513, 30513, 30514, 30514, 30514, 30514, 30515, 30515, 30515, 30515, 30516,
-    30516, 30516, 30516, 30517, 30517, 30517, 30517, 30518, 30518, 30518, 30518,
-    30519, 30519, 30519, 30519, 30520, 30520, 30520, 30520, 30521, 30521, 30521,
-    30521, 30522, 30522, 30522, 30522, 30523, 30523, 30523, 30523, 30524, 30524,
-    30524, 30524, 30525, 30525, 30525, 30525, 30526, 30526, 30526, 30526, 30526,
-    30527, 30527, 30527, 30527, 30528, 30528, 30528, 30528, 30529, 30529, 30529,
-    30529, 30530, 30530, 30530, 30530, 30531, 30531, 30531, 30531, 30532, 30532,
-    30532, 30532, 30533, 30533, 30533, 30533, 30534, 30534, 30534, 30534, 30535,
-    30535, 30535, 30535, 30536, 30536, 30536, 30536, 30537, 30537, 30537, 30537,
-    30538, 30538, 30538, 30538, 30538, 30539, 30539, 30539, 30539, 30540, 30540,
-    30540, 30540, 30541, 30541, 30541, 30541, 30542, 30542, 30542, 30542, 30543,
-    30543, 30543, 30543, 30544, 30544, 30544, 30544, 30545, 30545, 30545, 30545,
-    30546, 30546, 30546, 30546, 30547, 30547, 30547, 30547, 30548, 30548, 30548,
-    30548, 30549, 30549, 30549, 30549, 30549, 30550, 30550, 30550, 30550, 30551,
-    30551, 30551, 30551, 30552, 30552, 30552, 30552, 30553, 30553, 30553, 30553,
-    30554, 30554, 30554, 30554, 30555, 30555, 30555, 30555, 30556, 30556, 30556,
-    30556, 30557, 30557, 30557, 30557, 30558, 30558, 30558, 30558, 30559, 30559,
-    30559, 30559, 30559, 30560, 30560, 30560, 30560, 30561, 30561, 30561, 30561,
-    30562, 30562, 30562, 30562, 30563, 30563, 30563, 30563, 30564, 30564, 30564,
-    30564, 30565, 30565, 30565, 30565, 30566, 30566, 30566, 30566, 30567, 30567,
-    30567, 30567, 30568, 30568, 30568, 30568, 30568, 30569, 30569, 30569, 30569,
-    30570, 30570, 30570, 30570, 30571, 30571, 30571, 30571, 30572, 30572, 30572,
-    30572, 30573, 30573, 30573, 30573, 30574, 30574, 30574, 30574, 30575, 30575,
-    30575, 30575, 30576, 30576, 30576, 30576, 30577, 30577, 30577, 30577, 30577,
-    30578, 30578, 30578, 30578, 30579, 30579, 30579, 30579, 30580, 30580, 30580,
-    30580, 30581, 30581, 30581, 30581, 30582, 30582, 30582, 30582, 30583, 30583,
-    30583, 30583, 30584, 30584, 30584, 30584, 30585, 30585, 30585, 30585, 30585,
-    30586, 30586, 30586, 30586, 30587, 30587, 30587, 30587, 30588, 30588, 30588,
-    30588, 30589, 30589, 30589, 30589, 30590, 30590, 30590, 30590, 30591, 30591,
-    30591, 30591, 30592, 30592, 30592, 30592, 30593, 30593, 30593, 30593, 30593,
-    30594, 30594, 30594, 30594, 30595, 30595, 30595, 30595, 30596, 30596, 30596,
-    30596, 30597, 30597, 30597, 30597, 30598, 30598, 30598, 30598, 30599, 30599,
-    30599, 30599, 30600, 30600, 30600, 30600, 30600, 30601, 30601, 30601, 30601,
-    30602, 30602, 30602, 30602, 30603, 30603, 30603, 30603, 30604, 30604, 30604,
-    30604, 30605, 30605, 30605, 30605, 30606, 30606, 30606, 30606, 30607, 30607,
-    30607, 30607, 30607, 30608, 30608, 30608, 30608, 30609, 30609, 30609, 30609,
-    30610, 30610, 30610, 30610, 30611, 30611, 30611, 30611, 30612, 30612, 30612,
-    30612, 30613, 30613, 30613, 30613, 30614, 30614, 30614, 30614, 30614, 30615,
-    30615, 30615, 30615, 30616, 30616, 30616, 30616, 30617, 30617, 30617, 30617,
-    30618, 30618, 30618, 30618, 30619, 30619, 30619, 30619, 30620, 30620, 30620,
-    30620, 30621, 30621, 30621, 30621, 30621, 30622, 30622, 30622, 30622, 30623,
-    30623, 30623, 30623, 30624, 30624, 30624, 30624, 30625, 30625, 30625, 30625,
-    30626, 30626, 30626, 30626, 30627, 30627, 30627, 30627, 30627, 30628, 30628,
-    30628, 30628, 30629, 30629, 30629, 30629, 30630, 30630, 30630, 30630, 30631,
-    30631, 30631, 30631, 30632, 30632, 30632, 30632, 30633, 30633, 30633, 30633,
-    30633, 30634, 30634, 30634, 30634, 30635, 30635, 30635, 30635, 30636, 30636,
-    30636, 30636, 30637, 30637, 30637, 30637, 30638, 30638, 30638, 30638, 30639,
-    30639, 30639, 30639, 30639, 30640, 30640, 30640, 30640, 30641, 30641, 30641,
-    30641, 30642, 30642, 30642, 30642, 30643, 30643, 30643, 30643, 30644, 30644,
-    30644, 30644, 30645, 30645, 30645, 30645, 30645, 30646, 30646, 30646, 30646,
-    30647, 30647, 30647, 30647, 30648, 30648, 30648, 30648, 30649, 30649, 30649,
-    30649, 30650, 30650, 30650, 30650, 30651, 30651, 30651, 30651, 30651, 30652,
-    30652, 30652, 30652, 30653, 30653, 30653, 30653, 30654, 30654, 30654, 30654,
-    30655, 30655, 30655, 30655, 30656, 30656, 30656, 30656, 30656, 30657, 30657,
-    30657, 30657, 30658, 30658, 30658, 30658, 30659, 30659, 30659, 30659, 30660,
-    30660, 30660, 30660, 30661, 30661, 30661, 30661, 30662, 30662, 30662, 30662,
-    30662, 30663, 30663, 30663, 30663, 30664, 30664, 30664, 30664, 30665, 30665,
-    30665, 30665, 30666, 30666, 30666, 30666, 30667, 30667, 30667, 30667, 30667,
-    30668, 30668, 30668, 30668, 30669, 30669, 30669, 30669, 30670, 30670, 30670,
-    30670, 30671, 30671, 30671, 30671, 30672, 30672, 30672, 30672, 30672, 30673,
-    30673, 30673, 30673, 30674, 30674, 30674, 30674, 30675, 30675, 30675, 30675,
-    30676, 30676, 30676, 30676, 30677, 30677, 30677, 30677, 30677, 30678, 30678,
-    30678, 30678, 30679, 30679, 30679, 30679, 30680, 30680, 30680, 30680, 30681,
-    30681, 30681, 30681, 30682, 30682, 30682, 30682, 30682, 30683, 30683, 30683,
-    30683, 30684, 30684, 30684, 30684, 30685, 30685, 30685, 30685, 30686, 30686,
-    30686, 30686, 30687, 30687, 30687, 30687, 30687, 30688, 30688, 30688, 30688,
-    30689, 30689, 30689, 30689, 30690, 30690, 30690, 30690, 30691, 30691, 30691,
-    30691, 30692, 30692, 30692, 30692, 30692, 30693, 30693, 30693, 30693, 30694,
-    30694, 30694, 30694, 30695, 30695, 30695, 30695, 30696, 30696, 30696, 30696,
-    30697, 30697, 30697, 30697, 30697, 30698, 30698, 30698, 30698, 30699, 30699,
-    30699, 30699, 30700, 30700, 30700, 30700, 30701, 30701, 30701, 30701, 30701,
-    30702, 30702, 30702, 30702, 30703, 30703, 30703, 30703, 30704, 30704, 30704,
-    30704, 30705, 30705, 30705, 30705, 30706, 30706, 30706, 30706, 30706, 30707,
-    30707, 30707, 30707, 30708, 30708, 30708, 30708, 30709, 30709, 30709, 30709,
-    30710, 30710, 30710, 30710, 30710, 30711, 30711, 30711, 30711, 30712, 30712,
-    30712, 30712, 30713, 30713, 30713, 30713, 30714, 30714, 30714, 30714, 30715,
-    30715, 30715, 30715, 30715, 30716, 30716, 30716, 30716, 30717, 30717, 30717,
-    30717, 30718, 30718, 30718, 30718, 30719, 30719, 30719, 30719, 30719, 30720,
-    30720, 30720, 30720, 30721, 30721, 30721, 30721, 30722, 30722, 30722, 30722,
-    30723, 30723, 30723, 30723, 30724, 30724, 30724, 30724, 30724, 30725, 30725,
-    30725, 30725, 30726, 30726, 30726, 30726, 30727, 30727, 30727, 30727, 30728,
-    30728, 30728, 30728, 30728, 30729, 30729, 30729, 30729, 30730, 30730, 30730,
-    30730, 30731, 30731, 30731, 30731, 30732, 30732, 30732, 30732, 30732, 30733,
-    30733, 30733, 30733, 30734, 30734, 30734, 30734, 30735, 30735, 30735, 30735,
-    30736, 30736, 30736, 30736, 30736, 30737, 30737, 30737, 30737, 30738, 30738,
-    30738, 30738, 30739, 30739, 30739, 30739, 30740, 30740, 30740, 30740, 30740,
-    30741, 30741, 30741, 30741, 30742, 30742, 30742, 30742, 30743, 30743, 30743,
-    30743, 30744, 30744, 30744, 30744, 30744, 30745, 30745, 30745, 30745, 30746,
-    30746, 30746, 30746, 30747, 30747, 30747, 30747, 30748, 30748, 30748, 30748,
-    30748, 30749, 30749, 30749, 30749, 30750, 30750, 30750, 30750, 30751, 30751,
-    30751, 30751, 30752, 30752, 30752, 30752, 30752, 30753, 30753, 30753, 30753,
-    30754, 30754, 30754, 30754, 30755, 30755, 30755, 30755, 30756, 30756, 30756,
-    30756, 30756, 30757, 30757, 30757, 30757, 30758, 30758, 30758, 30758, 30759,
-    30759, 30759, 30759, 30759, 30760, 30760, 30760, 30760, 30761, 30761, 30761,
-    30761, 30762, 30762, 30762, 30762, 30763, 30763, 30763, 30763, 30763, 30764,
-    30764, 30764, 30764, 30765, 30765, 30765, 30765, 30766, 30766, 30766, 30766,
-    30767, 30767, 30767, 30767, 30767, 30768, 30768, 30768, 30768, 30769, 30769,
-    30769, 30769, 30770, 30770, 30770, 30770, 30771, 30771, 30771, 30771, 30771,
-    30772, 30772, 30772, 30772, 30773, 30773, 30773, 30773, 30774, 30774, 30774,
-    30774, 30774, 30775, 30775, 30775, 30775, 30776, 30776, 30776, 30776, 30777,
-    30777, 30777, 30777, 30778, 30778, 30778, 30778, 30778, 30779, 30779, 30779,
-    30779, 30780, 30780, 30780, 30780, 30781, 30781, 30781, 30781, 30781, 30782,
-    30782, 30782, 30782, 30783, 30783, 30783, 30783, 30784, 30784, 30784, 30784,
-    30785, 30785, 30785, 30785, 30785, 30786, 30786, 30786, 30786, 30787, 30787,
-    30787, 30787, 30788, 30788, 30788, 30788, 30788, 30789, 30789, 30789, 30789,
-    30790, 30790, 30790, 30790, 30791, 30791, 30791, 30791, 30792, 30792, 30792,
-    30792, 30792, 30793, 30793, 30793, 30793, 30794, 30794, 30794, 30794, 30795,
-    30795, 30795, 30795, 30795, 30796, 30796, 30796, 30796, 30797, 30797, 30797,
-    30797, 30798, 30798, 30798, 30798, 30799, 30799, 30799, 30799, 30799, 30800,
-    30800, 30800, 30800, 30801, 30801, 30801, 30801, 30802, 30802, 30802, 30802,
-    30802, 30803, 30803, 30803, 30803, 30804, 30804, 30804, 30804, 30805, 30805,
-    30805, 30805, 30805, 30806, 30806, 30806, 30806, 30807, 30807, 30807, 30807,
-    30808, 30808, 30808, 30808, 30809, 30809, 30809, 30809, 30809, 30810, 30810,
-    30810, 30810, 30811, 30811, 30811, 30811, 30812, 30812, 30812, 30812, 30812,
-    30813, 30813, 30813, 30813, 30814, 30814, 30814, 30814, 30815, 30815, 30815,
-    30815, 30815, 30816, 30816, 30816, 30816, 30817, 30817, 30817, 30817, 30818,
-    30818, 30818, 30818, 30818, 30819, 30819, 30819, 30819, 30820, 30820, 30820,
-    30820, 30821, 30821, 30821, 30821, 30822, 30822, 30822, 30822, 30822, 30823,
-    30823, 30823, 30823, 30824, 30824, 30824, 30824, 30825, 30825, 30825, 30825,
-    30825, 30826, 30826, 30826, 30826, 30827, 30827, 30827, 30827, 30828, 30828,
-    30828, 30828, 30828, 30829, 30829, 30829, 30829, 30830, 30830, 30830, 30830,
-    30831, 30831, 30831, 30831, 30831, 30832, 30832, 30832, 30832, 30833, 30833,
-    30833, 30833, 30834, 30834, 30834, 30834, 30834, 30835, 30835, 30835, 30835,
-    30836, 30836, 30836, 30836, 30837, 30837, 30837, 30837, 30837, 30838, 30838,
-    30838, 30838, 30839, 30839, 30839, 30839, 30840, 30840, 30840, 30840, 30840,
-    30841, 30841, 30841, 30841, 30842, 30842, 30842, 30842, 30843, 30843, 30843,
-    30843, 30843, 30844, 30844, 30844, 30844, 30845, 30845, 30845, 30845, 30846,
-    30846, 30846, 30846, 30846, 30847, 30847, 30847, 30847, 30848, 30848, 30848,
-    30848, 30849, 30849, 30849, 30849, 30849, 30850, 30850, 30850, 30850, 30851,
-    30851, 30851, 30851, 30852, 30852, 30852, 30852, 30852, 30853, 30853, 30853,
-    30853, 30854, 30854, 30854, 30854, 30855, 30855, 30855, 30855, 30855, 30856,
-    30856, 30856, 30856, 30857, 30857, 30857, 30857, 30858, 30858, 30858, 30858,
-    30858, 30859, 30859, 30859, 30859, 30860, 30860, 30860, 30860, 30861, 30861,
-    30861, 30861, 30861, 30862, 30862, 30862, 30862, 30863, 30863, 30863, 30863,
-    30864, 30864, 30864, 30864, 30864, 30865, 30865, 30865, 30865, 30866, 30866,
-    30866, 30866, 30866, 30867, 30867, 30867, 30867, 30868, 30868, 30868, 30868,
-    30869, 30869, 30869, 30869, 30869, 30870, 30870, 30870, 30870, 30871, 30871,
-    30871, 30871, 30872, 30872, 30872, 30872, 30872, 30873, 30873, 30873, 30873,
-    30874, 30874, 30874, 30874, 30875, 30875, 30875, 30875, 30875, 30876, 30876,
-    30876, 30876, 30877, 30877, 30877, 30877, 30878, 30878, 30878, 30878, 30878,
-    30879, 30879, 30879, 30879, 30880, 30880, 30880, 30880, 30880, 30881, 30881,
-    30881, 30881, 30882, 30882, 30882, 30882, 30883, 30883, 30883, 30883, 30883,
-    30884, 30884, 30884, 30884, 30885, 30885, 30885, 30885, 30886, 30886, 30886,
-    30886, 30886, 30887, 30887, 30887, 30887, 30888, 30888, 30888, 30888, 30889,
-    30889, 30889, 30889, 30889, 30890, 30890, 30890, 30890, 30891, 30891, 30891,
-    30891, 30891, 30892, 30892, 30892, 30892, 30893, 30893, 30893, 30893, 30894,
-    30894, 30894, 30894, 30894, 30895, 30895, 30895, 30895, 30896, 30896, 30896,
-    30896, 30897, 30897, 30897, 30897, 30897, 30898, 30898, 30898, 30898, 30899,
-    30899, 30899, 30899, 30899, 30900, 30900, 30900, 30900, 30901, 30901, 30901,
-    30901, 30902, 30902, 30902, 30902, 30902, 30903, 30903, 30903, 30903, 30904,
-    30904, 30904, 30904, 30904, 30905, 30905, 30905, 30905, 30906, 30906, 30906,
-    30906, 30907, 30907, 30907, 30907, 30907, 30908, 30908, 30908, 30908, 30909,
-    30909, 30909, 30909, 30910, 30910, 30910, 30910, 30910, 30911, 30911, 30911,
-    30911, 30912, 30912, 30912, 30912, 30912, 30913, 30913, 30913, 30913, 30914,
-    30914, 30914, 30914, 30915, 30915, 30915, 30915, 30915, 30916, 30916, 30916,
-    30916, 30917, 30917, 30917, 30917, 30917, 30918, 30918, 30918, 30918, 30919,
-    30919, 30919, 30919, 30920, 30920, 30920, 30920, 30920, 30921, 30921, 30921,
-    30921, 30922, 30922, 30922, 30922, 30922, 30923, 30923, 30923, 30923, 30924,
-    30924, 30924, 30924, 30925, 30925, 30925, 30925, 30925, 30926, 30926, 30926,
-    30926, 30927, 30927, 30927, 30927, 30927, 30928, 30928, 30928, 30928, 30929,
-    30929, 30929, 30929, 30930, 30930, 30930, 30930, 30930, 30931, 30931, 30931,
-    30931, 30932, 30932, 30932, 30932, 30932, 30933, 30933, 30933, 30933, 30934,
-    30934, 30934, 30934, 30935, 30935, 30935, 30935, 30935, 30936, 30936, 30936,
-    30936, 30937, 30937, 30937, 30937, 30937, 30938, 30938, 30938, 30938, 30939,
-    30939, 30939, 30939, 30940, 30940, 30940, 30940, 30940, 30941, 30941, 30941,
-    30941, 30942, 30942, 30942, 30942, 30942, 30943, 30943, 30943, 30943, 30944,
-    30944, 30944, 30944, 30944, 30945, 30945, 30945, 30945, 30946, 30946, 30946,
-    30946, 30947, 30947, 30947, 30947, 30947, 30948, 30948, 30948, 30948, 30949,
-    30949, 30949, 30949, 30949, 30950, 30950, 30950, 30950, 30951, 30951, 30951,
-    30951, 30951, 30952, 30952, 30952, 30952, 30953, 30953, 30953, 30953, 30954,
-    30954, 30954, 30954, 30954, 30955, 30955, 30955, 30955, 30956, 30956, 30956,
-    30956, 30956, 30957, 30957, 30957, 30957, 30958, 30958, 30958, 30958, 30959,
-    30959, 30959, 30959, 30959, 30960, 30960, 30960, 30960, 30961, 30961, 30961,
-    30961, 30961, 30962, 30962, 30962, 30962, 30963, 30963, 30963, 30963, 30963,
-    30964, 30964, 30964, 30964, 30965, 30965, 30965, 30965, 30965, 30966, 30966,
-    30966, 30966, 30967, 30967, 30967, 30967, 30968, 30968, 30968, 30968, 30968,
-    30969, 30969, 30969, 30969, 30970, 30970, 30970, 30970, 30970, 30971, 30971,
-    30971, 30971, 30972, 30972, 30972, 30972, 30972, 30973, 30973, 30973, 30973,
-    30974, 30974, 30974, 30974, 30975, 30975, 30975, 30975, 30975, 30976, 30976,
-    30976, 30976, 30977, 30977, 30977, 30977, 30977, 30978, 30978, 30978, 30978,
-    30979, 30979, 30979, 30979, 30979, 30980, 30980, 30980, 30980, 30981, 30981,
-    30981, 30981, 30981, 30982, 30982, 30982, 30982, 30983, 30983, 30983, 30983,
-    30984, 30984, 30984, 30984, 30984, 30985, 30985, 30985, 30985, 30986, 30986,
-    30986, 30986, 30986, 30987, 30987, 30987, 30987, 30988, 30988, 30988, 30988,
-    30988, 30989, 30989, 30989, 30989, 30990, 30990, 30990, 30990, 30990, 30991,
-    30991, 30991, 30991, 30992, 30992, 30992, 30992, 30992, 30993, 30993, 30993,
-    30993, 30994, 30994, 30994, 30994, 30995, 30995, 30995, 30995, 30995, 30996,
-    30996, 30996, 30996, 30997, 30997, 30997, 30997, 30997, 30998, 30998, 30998,
-    30998, 30999, 30999, 30999, 30999, 30999, 31000, 31000, 31000, 31000, 31001,
-    31001, 31001, 31001, 31001, 31002, 31002, 31002, 31002, 31003, 31003, 31003,
-    31003, 31003, 31004, 31004, 31004, 31004, 31005, 31005, 31005, 31005, 31005,
-    31006, 31006, 31006, 31006, 31007, 31007, 31007, 31007, 31007, 31008, 31008,
-    31008, 31008, 31009, 31009, 31009, 31009, 31010, 31010, 31010, 31010, 31010,
-    31011, 31011, 31011, 31011, 31012, 31012, 31012, 31012, 31012, 31013, 31013,
-    31013, 31013, 31014, 31014, 31014, 31014, 31014, 31015, 31015, 31015, 31015,
-    31016, 31016, 31016, 31016, 31016, 31017, 31017, 31017, 31017, 31018, 31018,
-    31018, 31018, 31018, 31019, 31019, 31019, 31019, 31020, 31020, 31020, 31020,
-    31020, 31021, 31021, 31021, 31021, 31022, 31022, 31022, 31022, 31022, 31023,
-    31023, 31023, 31023, 31024, 31024, 31024, 31024, 31024, 31025, 31025, 31025,
-    31025, 31026, 31026, 31026, 31026, 31026, 31027, 31027, 31027, 31027, 31028,
-    31028, 31028, 31028, 31028, 31029, 31029, 31029, 31029, 31030, 31030, 31030,
-    31030, 31030, 31031, 31031, 31031, 31031, 31032, 31032, 31032, 31032, 31032,
-    31033, 31033, 31033, 31033, 31034, 31034, 31034, 31034, 31034, 31035, 31035,
-    31035, 31035, 31036, 31036, 31036, 31036, 31036, 31037, 31037, 31037, 31037,
-    31038, 31038, 31038, 31038, 31038, 31039, 31039, 31039, 31039, 31040, 31040,
-    31040, 31040, 31040, 31041, 31041, 31041, 31041, 31042, 31042, 31042, 31042,
-    31042, 31043, 31043, 31043, 31043, 31044, 31044, 31044, 31044, 31044, 31045,
-    31045, 31045, 31045, 31046, 31046, 31046, 31046, 31046, 31047, 31047, 31047,
-    31047, 31048, 31048, 31048, 31048, 31048, 31049, 31049, 31049, 31049, 31050,
-    31050, 31050, 31050, 31050, 31051, 31051, 31051, 31051, 31052, 31052, 31052,
-    31052, 31052, 31053, 31053, 31053, 31053, 31054, 31054, 31054, 31054, 31054,
-    31055, 31055, 31055, 31055, 31056, 31056, 31056, 31056, 31056, 31057, 31057,
-    31057, 31057, 31058, 31058, 31058, 31058, 31058, 31059, 31059, 31059, 31059,
-    31060, 31060, 31060, 31060, 31060, 31061, 31061, 31061, 31061, 31062, 31062,
-    31062, 31062, 31062, 31063, 31063, 31063, 31063, 31064, 31064, 31064, 31064,
-    31064, 31065, 31065, 31065, 31065, 31066, 31066, 31066, 31066, 31066, 31067,
-    31067, 31067, 31067, 31068, 31068, 31068, 31068, 31068, 31069, 31069, 31069,
-    31069, 31070, 31070, 31070, 31070, 31070, 31071, 31071, 31071, 31071, 31072,
-    31072, 31072, 31072, 31072, 31073, 31073, 31073, 31073, 31074, 31074, 31074,
-    31074, 31074, 31075, 31075, 31075, 31075, 31075, 31076, 31076, 31076, 31076,
-    31077, 31077, 31077, 31077, 31077, 31078, 31078, 31078, 31078, 31079, 31079,
-    31079, 31079, 31079, 31080, 31080, 31080, 31080, 31081, 31081, 31081, 31081,
-    31081, 31082, 31082, 31082, 31082, 31083, 31083, 31083, 31083, 31083, 31084,
-    31084, 31084, 31084, 31085, 31085, 31085, 31085, 31085, 31086, 31086, 31086,
-    31086, 31087, 31087, 31087, 31087, 31087, 31088, 31088, 31088, 31088, 31088,
-    31089, 31089, 31089, 31089, 31090, 31090, 31090, 31090, 31090, 31091, 31091,
-    31091, 31091, 31092, 31092, 31092, 31092, 31092, 31093, 31093, 31093, 31093,
-    31094, 31094, 31094, 31094, 31094, 31095, 31095, 31095, 31095, 31096, 31096,
-    31096, 31096, 31096, 31097, 31097, 31097, 31097, 31098, 31098, 31098, 31098,
-    31098, 31099, 31099, 31099, 31099, 31099, 31100, 31100, 31100, 31100, 31101,
-    31101, 31101, 31101, 31101, 31102, 31102, 31102, 31102, 31103, 31103, 31103,
-    31103, 31103, 31104, 31104, 31104, 31104, 31105, 31105, 31105, 31105, 31105,
-    31106, 31106, 31106, 31106, 31107, 31107, 31107, 31107, 31107, 31108, 31108,
-    31108, 31108, 31109, 31109, 31109, 31109, 31109, 31110, 31110, 31110, 31110,
-    31110, 31111, 31111, 31111, 31111, 31112, 31112, 31112, 31112, 31112, 31113,
-    31113, 31113, 31113, 31114, 31114, 31114, 31114, 31114, 31115, 31115, 31115,
-    31115, 31116, 31116, 31116, 31116, 31116, 31117, 31117, 31117, 31117, 31117,
-    31118, 31118, 31118, 31118, 31119, 31119, 31119, 31119, 31119, 31120, 31120,
-    31120, 31120, 31121, 31121, 31121, 31121, 31121, 31122, 31122, 31122, 31122,
-    31123, 31123, 31123, 31123, 31123, 31124, 31124, 31124, 31124, 31124, 31125,
-    31125, 31125, 31125, 31126, 31126, 31126, 31126, 31126, 31127, 31127, 31127,
-    31127, 31128, 31128, 31128, 31128, 31128, 31129, 31129, 31129, 31129, 31130,
-    31130, 31130, 31130, 31130, 31131, 31131, 31131, 31131, 31131, 31132, 31132,
-    31132, 31132, 31133, 31133, 31133, 31133, 31133, 31134, 31134, 31134, 31134,
-    31135, 31135, 31135, 31135, 31135, 31136, 31136, 31136, 31136, 31137, 31137,
-    31137, 31137, 31137, 31138, 31138, 31138, 31138, 31138, 31139, 31139, 31139,
-    31139, 31140, 31140, 31140, 31140, 31140, 31141, 31141, 31141, 31141, 31142,
-    31142, 31142, 31142, 31142, 31143, 31143, 31143, 31143, 31143, 31144, 31144,
-    31144, 31144, 31145, 31145, 31145, 31145, 31145, 31146, 31146, 31146, 31146,
-    31147, 31147, 31147, 31147, 31147, 31148, 31148, 31148, 31148, 31149, 31149,
-    31149, 31149, 31149, 31150, 31150, 31150, 31150, 31150, 31151, 31151, 31151,
-    31151, 31152, 31152, 31152, 31152, 31152, 31153, 31153, 31153, 31153, 31154,
-    31154, 31154, 31154, 31154, 31155, 31155, 31155, 31155, 31155, 31156, 31156,
-    31156, 31156, 31157, 31157, 31157, 31157, 31157, 31158, 31158, 31158, 31158,
-    31159, 31159, 31159, 31159, 31159, 31160, 31160, 31160, 31160, 31160, 31161,
-    31161, 31161, 31161, 31162, 31162, 31162, 31162, 31162, 31163, 31163, 31163,
-    31163, 31164, 31164, 31164, 31164, 31164, 31165, 31165, 31165, 31165, 31165,
-    31166, 31166, 31166, 31166, 31167, 31167, 31167, 31167, 31167, 31168, 31168,
-    31168, 31168, 31168, 31169, 31169, 31169, 31169, 31170, 31170, 31170, 31170,
-    31170, 31171, 31171, 31171, 31171, 31172, 31172, 31172, 31172, 31172, 31173,
-    31173, 31173, 31173, 31173, 31174, 31174, 31174, 31174, 31175, 31175, 31175,
-    31175, 31175, 31176, 31176, 31176, 31176, 31177, 31177, 31177, 31177, 31177,
-    31178, 31178, 31178, 31178, 31178, 31179, 31179, 31179, 31179, 31180, 31180,
-    31180, 31180, 31180, 31181, 31181, 31181, 31181, 31181, 31182, 31182, 31182,
-    31182, 31183, 31183, 31183, 31183, 31183, 31184, 31184, 31184, 31184, 31185,
-    31185, 31185, 31185, 31185, 31186, 31186, 31186, 31186, 31186, 31187, 31187,
-    31187, 31187, 31188, 31188, 31188, 31188, 31188, 31189, 31189, 31189, 31189,
-    31189, 31190, 31190, 31190, 31190, 31191, 31191, 31191, 31191, 31191, 31192,
-    31192, 31192, 31192, 31193, 31193, 31193, 31193, 31193, 31194, 31194, 31194,
-    31194, 31194, 31195, 31195, 31195, 31195, 31196, 31196, 31196, 31196, 31196,
-    31197, 31197, 31197, 31197, 31197, 31198, 31198, 31198, 31198, 31199, 31199,
-    31199, 31199, 31199, 31200, 31200, 31200, 31200, 31201, 31201, 31201, 31201,
-    31201, 31202, 31202, 31202, 31202, 31202, 31203, 31203, 31203, 31203, 31204,
-    31204, 31204, 31204, 31204, 31205, 31205, 31205, 31205, 31205, 31206, 31206,
-    31206, 31206, 31207, 31207, 31207, 31207, 31207, 31208, 31208, 31208, 31208,
-    31208, 31209, 31209, 31209, 31209, 31210, 31210, 31210, 31210, 31210, 31211,
-    31211, 31211, 31211, 31211, 31212, 31212, 31212, 31212, 31213, 31213, 31213,
-    31213, 31213, 31214, 31214, 31214, 31214, 31214, 31215, 31215, 31215, 31215,
-    31216, 31216, 31216, 31216, 31216, 31217, 31217, 31217, 31217, 31218, 31218,
-    31218, 31218, 31218, 31219, 31219, 31219, 31219, 31219, 31220, 31220, 31220,
-    31220, 31221, 31221, 31221, 31221, 31221, 31222, 31222, 31222, 31222, 31222,
-    31223, 31223, 31223, 31223, 31224, 31224, 31224, 31224, 31224, 31225, 31225,
-    31225, 31225, 31225, 31226, 31226, 31226, 31226, 31227, 31227, 31227, 31227,
-    31227, 31228, 31228, 31228, 31228, 31228, 31229, 31229, 31229, 31229, 31230,
-    31230, 31230, 31230, 31230, 31231, 31231, 31231, 31231, 31231, 31232, 31232,
-    31232, 31232, 31233, 31233, 31233, 31233, 31233, 31234, 31234, 31234, 31234,
-    31234, 31235, 31235, 31235, 31235, 31236, 31236, 31236, 31236, 31236, 31237,
-    31237, 31237, 31237, 31237, 31238, 31238, 31238, 31238, 31239, 31239, 31239,
-    31239, 31239, 31240, 31240, 31240, 31240, 31240, 31241, 31241, 31241, 31241,
-    31242, 31242, 31242, 31242, 31242, 31243, 31243, 31243, 31243, 31243, 31244,
-    31244, 31244, 31244, 31245, 31245, 31245, 31245, 31245, 31246, 31246, 31246,
-    31246, 31246, 31247, 31247, 31247, 31247, 31248, 31248, 31248, 31248, 31248,
-    31249, 31249, 31249, 31249, 31249, 31250, 31250, 31250, 31250, 31250, 31251,
-    31251, 31251, 31251, 31252, 31252, 31252, 31252, 31252, 31253, 31253, 31253,
-    31253, 31253, 31254, 31254, 31254, 31254, 31255, 31255, 31255, 31255, 31255,
-    31256, 31256, 31256, 31256, 31256, 31257, 31257, 31257, 31257, 31258, 31258,
-    31258, 31258, 31258, 31259, 31259, 31259, 31259, 31259, 31260, 31260, 31260,
-    31260, 31261, 31261, 31261, 31261, 31261, 31262, 31262, 31262, 31262, 31262,
-    31263, 31263, 31263, 31263, 31264, 31264, 31264, 31264, 31264, 31265, 31265,
-    31265, 31265, 31265, 31266, 31266, 31266, 31266, 31266, 31267, 31267, 31267,
-    31267, 31268, 31268, 31268, 31268, 31268, 31269, 31269, 31269, 31269, 31269,
-    31270, 31270, 31270, 31270, 31271, 31271, 31271, 31271, 31271, 31272, 31272,
-    31272, 31272, 31272, 31273, 31273, 31273, 31273, 31274, 31274, 31274, 31274,
-    31274, 31275, 31275, 31275, 31275, 31275, 31276, 31276, 31276, 31276, 31276,
-    31277, 31277, 31277, 31277, 31278, 31278, 31278, 31278, 31278, 31279, 31279,
-    31279, 31279, 31279, 31280, 31280, 31280, 31280, 31281, 31281, 31281, 31281,
-    31281, 31282, 31282, 31282, 31282, 31282, 31283, 31283, 31283, 31283, 31283,
-    31284, 31284, 31284, 31284, 31285, 31285, 31285, 31285, 31285, 31286, 31286,
-    31286, 31286, 31286, 31287, 31287, 31287, 31287, 31288, 31288, 31288, 31288,
-    31288, 31289, 31289, 31289, 31289, 31289, 31290, 31290, 31290, 31290, 31290,
-    31291, 31291, 31291, 31291, 31292, 31292, 31292, 31292, 31292, 31293, 31293,
-    31293, 31293, 31293, 31294, 31294, 31294, 31294, 31295, 31295, 31295, 31295,
-    31295, 31296, 31296, 31296, 31296, 31296, 31297, 31297, 31297, 31297, 31297,
-    31298, 31298, 31298, 31298, 31299, 31299, 31299, 31299, 31299, 31300, 31300,
-    31300, 31300, 31300, 31301, 31301, 31301, 31301, 31302, 31302, 31302, 31302,
-    31302, 31303, 31303, 31303, 31303, 31303, 31304, 31304, 31304, 31304, 31304,
-    31305, 31305, 31305, 31305, 31306, 31306, 31306, 31306, 31306, 31307, 31307,
-    31307, 31307, 31307, 31308, 31308, 31308, 31308, 31308, 31309, 31309, 31309,
-    31309, 31310, 31310, 31310, 31310, 31310, 31311, 31311, 31311, 31311, 31311,
-    31312, 31312, 31312, 31312, 31312, 31313, 31313, 31313, 31313, 31314, 31314,
-    31314, 31314, 31314, 31315, 31315, 31315, 31315, 31315, 31316, 31316, 31316,
-    31316, 31316, 31317, 31317, 31317, 31317, 31318, 31318, 31318, 31318, 31318,
-    31319, 31319, 31319, 31319, 31319, 31320, 31320, 31320, 31320, 31321, 31321,
-    31321, 31321, 31321, 31322, 31322, 31322, 31322, 31322, 31323, 31323, 31323,
-    31323, 31323, 31324, 31324, 31324, 31324, 31325, 31325, 31325, 31325, 31325,
-    31326, 31326, 31326, 31326, 31326, 31327, 31327, 31327, 31327, 31327, 31328,
-    31328, 31328, 31328, 31329, 31329, 31329, 31329, 31329, 31330, 31330, 31330,
-    31330, 31330, 31331, 31331, 31331, 31331, 31331, 31332, 31332, 31332, 31332,
-    31333, 31333, 31333, 31333, 31333, 31334, 31334, 31334, 31334, 31334, 31335,
-    31335, 31335, 31335, 31335, 31336, 31336, 31336, 31336, 31336, 31337, 31337,
-    31337, 31337, 31338, 31338, 31338, 31338, 31338, 31339, 31339, 31339, 31339,
-    31339, 31340, 31340, 31340, 31340, 31340, 31341, 31341, 31341, 31341, 31342,
-    31342, 31342, 31342, 31342, 31343, 31343, 31343, 31343, 31343, 31344, 31344,
-    31344, 31344, 31344, 31345, 31345, 31345, 31345, 31346, 31346, 31346, 31346,
-    31346, 31347, 31347, 31347, 31347, 31347, 31348, 31348, 31348, 31348, 31348,
-    31349, 31349, 31349, 31349, 31350, 31350, 31350, 31350, 31350, 31351, 31351,
-    31351, 31351, 31351, 31352, 31352, 31352, 31352, 31352, 31353, 31353, 31353,
-    31353, 31353, 31354, 31354, 31354, 31354, 31355, 31355, 31355, 31355, 31355,
-    31356, 31356, 31356, 31356, 31356, 31357, 31357, 31357, 31357, 31357, 31358,
-    31358, 31358, 31358, 31359, 31359, 31359, 31359, 31359, 31360, 31360, 31360,
-    31360, 31360, 31361, 31361, 31361, 31361, 31361, 31362, 31362, 31362, 31362,
-    31362, 31363, 31363, 31363, 31363, 31364, 31364, 31364, 31364, 31364, 31365,
-    31365, 31365, 31365, 31365, 31366, 31366, 31366, 31366, 31366, 31367, 31367,
-    31367, 31367, 31367, 31368, 31368, 31368, 31368, 31369, 31369, 31369, 31369,
-    31369, 31370, 31370, 31370, 31370, 31370, 31371, 31371, 31371, 31371, 31371,
-    31372, 31372, 31372, 31372, 31373, 31373, 31373, 31373, 31373, 31374, 31374,
-    31374, 31374, 31374, 31375, 31375, 31375, 31375, 31375, 31376, 31376, 31376,
-    31376, 31376, 31377, 31377, 31377, 31377, 31378, 31378, 31378, 31378, 31378,
-    31379, 31379, 31379, 31379, 31379, 31380, 31380, 31380, 31380, 31380, 31381,
-    31381, 31381, 31381, 31381, 31382, 31382, 31382, 31382, 31383, 31383, 31383,
-    31383, 31383, 31384, 31384, 31384, 31384, 31384, 31385, 31385, 31385, 31385,
-    31385, 31386, 31386, 31386, 31386, 31386, 31387, 31387, 31387, 31387, 31388,
-    31388, 31388, 31388, 31388, 31389, 31389, 31389, 31389, 31389, 31390, 31390,
-    31390, 31390, 31390, 31391, 31391, 31391, 31391, 31391, 31392, 31392, 31392,
-    31392, 31392, 31393, 31393, 31393, 31393, 31394, 31394, 31394, 31394, 31394,
-    31395, 31395, 31395, 31395, 31395, 31396, 31396, 31396, 31396, 31396, 31397,
-    31397, 31397, 31397, 31397, 31398, 31398, 31398, 31398, 31399, 31399, 31399,
-    31399, 31399, 31400, 31400, 31400, 31400, 31400, 31401, 31401, 31401, 31401,
-    31401, 31402, 31402, 31402, 31402, 31402, 31403, 31403, 31403, 31403, 31404,
-    31404, 31404, 31404, 31404, 31405, 31405, 31405, 31405, 31405, 31406, 31406,
-    31406, 31406, 31406, 31407, 31407, 31407, 31407, 31407, 31408, 31408, 31408,
-    31408, 31408, 31409, 31409, 31409, 31409, 31410, 31410, 31410, 31410, 31410,
-    31411, 31411, 31411, 31411, 31411, 31412, 31412, 31412, 31412, 31412, 31413,
-    31413, 31413, 31413, 31413, 31414, 31414, 31414, 31414, 31414, 31415, 31415,
-    31415, 31415, 31416, 31416, 31416, 31416, 31416, 31417, 31417, 31417, 31417,
-    31417, 31418, 31418, 31418, 31418, 31418, 31419, 31419, 31419, 31419, 31419,
-    31420, 31420, 31420, 31420, 31420, 31421, 31421, 31421, 31421, 31422, 31422,
-    31422, 31422, 31422, 31423, 31423, 31423, 31423, 31423, 31424, 31424, 31424,
-    31424, 31424, 31425, 31425, 31425, 31425, 31425, 31426, 31426, 31426, 31426,
-    31426, 31427, 31427, 31427, 31427, 31428, 31428, 31428, 31428, 31428, 31429,
-    31429, 31429, 31429, 31429, 31430, 31430, 31430, 31430, 31430, 31431, 31431,
-    31431, 31431, 31431, 31432, 31432, 31432, 31432, 31432, 31433, 31433, 31433,
-    31433, 31433, 31434, 31434, 31434, 31434, 31435, 31435, 31435, 31435, 31435,
-    31436, 31436, 31436, 31436, 31436, 31437, 31437, 31437, 31437, 31437, 31438,
-    31438, 31438, 31438, 31438, 31439, 31439, 31439, 31439, 31439, 31440, 31440,
-    31440, 31440, 31441, 31441, 31441, 31441, 31441, 31442, 31442, 31442, 31442,
-    31442, 31443, 31443, 31443, 31443, 31443, 31444, 31444, 31444, 31444, 31444,
-    31445, 31445, 31445, 31445, 31445, 31446, 31446, 31446, 31446, 31446, 31447,
-    31447, 31447, 31447, 31448, 31448, 31448, 31448, 31448, 31449, 31449, 31449,
-    31449, 31449, 31450, 31450, 31450, 31450, 31450, 31451, 31451, 31451, 31451,
-    31451, 31452, 31452, 31452, 31452, 31452, 31453, 31453, 31453, 31453, 31453,
-    31454, 31454, 31454, 31454, 31454, 31455, 31455, 31455, 31455, 31456, 31456,
-    31456, 31456, 31456, 31457, 31457, 31457, 31457, 31457, 31458, 31458, 31458,
-    31458, 31458, 31459, 31459, 31459, 31459, 31459, 31460, 31460, 31460, 31460,
-    31460, 31461, 31461, 31461, 31461, 31461, 31462, 31462, 31462, 31462, 31462,
-    31463, 31463, 31463, 31463, 31464, 31464, 31464, 31464, 31464, 31465, 31465,
-    31465, 31465, 31465, 31466, 31466, 31466, 31466, 31466, 31467, 31467, 31467,
-    31467, 31467, 31468, 31468, 31468, 31468, 31468, 31469, 31469, 31469, 31469,
-    31469, 31470, 31470, 31470, 31470, 31470, 31471, 31471, 31471, 31471, 31472,
-    31472, 31472, 31472, 31472, 31473, 31473, 31473, 31473, 31473, 31474, 31474,
-    31474, 31474, 31474, 31475, 31475, 31475, 31475, 31475, 31476, 31476, 31476,
-    31476, 31476, 31477, 31477, 31477, 31477, 31477, 31478, 31478, 31478, 31478,
-    31478, 31479, 31479, 31479, 31479, 31479, 31480, 31480, 31480, 31480, 31481,
-    31481, 31481, 31481, 31481, 31482, 31482, 31482, 31482, 31482, 31483, 31483,
-    31483, 31483, 31483, 31484, 31484, 31484, 31484, 31484, 31485, 31485, 31485,
-    31485, 31485, 31486, 31486, 31486, 31486, 31486, 31487, 31487, 31487, 31487,
-    31487, 31488, 31488, 31488, 31488, 31488, 31489, 31489, 31489, 31489, 31490,
-    31490, 31490, 31490, 31490, 31491, 31491, 31491, 31491, 31491, 31492, 31492,
-    31492, 31492, 31492, 31493, 31493, 31493, 31493, 31493, 31494, 31494, 31494,
-    31494, 31494, 31495, 31495, 31495, 31495, 31495, 31496, 31496, 31496, 31496,
-    31496, 31497, 31497, 31497, 31497, 31497, 31498, 31498, 31498, 31498, 31498,
-    31499, 31499, 31499, 31499, 31499, 31500, 31500, 31500, 31500, 31501, 31501,
-    31501, 31501, 31501, 31502, 31502, 31502, 31502, 31502, 31503, 31503, 31503,
-    31503, 31503, 31504, 31504, 31504, 31504, 31504, 31505, 31505, 31505, 31505,
-    31505, 31506, 31506, 31506, 31506, 31506, 31507, 31507, 31507, 31507, 31507,
-    31508, 31508, 31508, 31508, 31508, 31509, 31509, 31509, 31509, 31509, 31510,
-    31510, 31510, 31510, 31510, 31511, 31511, 31511, 31511, 31511, 31512, 31512,
-    31512, 31512, 31513, 31513, 31513, 31513, 31513, 31514, 31514, 31514, 31514,
-    31514, 31515, 31515, 31515, 31515, 31515, 31516, 31516, 31516, 31516, 31516,
-    31517, 31517, 31517, 31517, 31517, 31518, 31518, 31518, 31518, 31518, 31519,
-    31519, 31519, 31519, 31519, 31520, 31520, 31520, 31520, 31520, 31521, 31521,
-    31521, 31521, 31521, 31522, 31522, 31522, 31522, 31522, 31523, 31523, 31523,
-    31523, 31523, 31524, 31524, 31524, 31524, 31524, 31525, 31525, 31525, 31525,
-    31525, 31526, 31526, 31526, 31526, 31527, 31527, 31527, 31527, 31527, 31528,
-    31528, 31528, 31528, 31528, 31529, 31529, 31529, 31529, 31529, 31530, 31530,
-    31530, 31530, 31530, 31531, 31531, 31531, 31531, 31531, 31532, 31532, 31532,
-    31532, 31532, 31533, 31533, 31533, 31533, 31533, 31534, 31534, 31534, 31534,
-    31534, 31535, 31535, 31535, 31535, 31535, 31536, 31536, 31536, 31536, 31536,
-    31537, 31537, 31537, 31537, 31537, 31538, 31538, 31538, 31538, 31538, 31539,
-    31539, 31539, 31539, 31539, 31540, 31540, 31540, 31540, 31540, 31541, 31541,
-    31541, 31541, 31541, 31542, 31542, 31542, 31542, 31542, 31543, 31543, 31543,
-    31543, 31544, 31544, 31544, 31544, 31544, 31545, 31545, 31545, 31545, 31545,
-    31546, 31546, 31546, 31546, 31546, 31547, 31547, 31547, 31547, 31547, 31548,
-    31548, 31548, 31548, 31548, 31549, 31549, 31549, 31549, 31549, 31550, 31550,
-    31550, 31550, 31550, 31551, 31551, 31551, 31551, 31551, 31552, 31552, 31552,
-    31552, 31552, 31553, 31553, 31553, 31553, 31553, 31554, 31554, 31554, 31554,
-    31554, 31555, 31555, 31555, 31555, 31555, 31556, 31556, 31556, 31556, 31556,
-    31557, 31557, 31557, 31557, 31557, 31558, 31558, 31558, 31558, 31558, 31559,
-    31559, 31559, 31559, 31559, 31560, 31560, 31560, 31560, 31560, 31561, 31561,
-    31561, 31561, 31561, 31562, 31562, 31562, 31562, 31562, 31563, 31563, 31563,
-    31563, 31563, 31564, 31564, 31564, 31564, 31564, 31565, 31565, 31565, 31565,
-    31565, 31566, 31566, 31566, 31566, 31566, 31567, 31567, 31567, 31567, 31567,
-    31568, 31568, 31568, 31568, 31568, 31569, 31569, 31569, 31569, 31569, 31570,
-    31570, 31570, 31570, 31570, 31571, 31571, 31571, 31571, 31572, 31572, 31572,
-    31572, 31572, 31573, 31573, 31573, 31573, 31573, 31574, 31574, 31574, 31574,
-    31574, 31575, 31575, 31575, 31575, 31575, 31576, 31576, 31576, 31576, 31576,
-    31577, 31577, 31577, 31577, 31577, 31578, 31578, 31578, 31578, 31578, 31579,
-    31579, 31579, 31579, 31579, 31580, 31580, 31580, 31580, 31580, 31581, 31581,
-    31581, 31581, 31581, 31582, 31582, 31582, 31582, 31582, 31583, 31583, 31583,
-    31583, 31583, 31584, 31584, 31584, 31584, 31584, 31585, 31585, 31585, 31585,
-    31585, 31586, 31586, 31586, 31586, 31586, 31587, 31587, 31587, 31587, 31587,
-    31588, 31588, 31588, 31588, 31588, 31589, 31589, 31589, 31589, 31589, 31590,
-    31590, 31590, 31590, 31590, 31591, 31591, 31591, 31591, 31591, 31592, 31592,
-    31592, 31592, 31592, 31593, 31593, 31593, 31593, 31593, 31594, 31594, 31594,
-    31594, 31594, 31595, 31595, 31595, 31595, 31595, 31596, 31596, 31596, 31596,
-    31596, 31597, 31597, 31597, 31597, 31597, 31598, 31598, 31598, 31598, 31598,
-    31599, 31599, 31599, 31599, 31599, 31600, 31600, 31600, 31600, 31600, 31601,
-    31601, 31601, 31601, 31601, 31602, 31602, 31602, 31602, 31602, 31603, 31603,
-    31603, 31603, 31603, 31604, 31604, 31604, 31604, 31604, 31605, 31605, 31605,
-    31605, 31605, 31606, 31606, 31606, 31606, 31606, 31607, 31607, 31607, 31607,
-    31607, 31608, 31608, 31608, 31608, 31608, 31609, 31609, 31609, 31609, 31609,
-    31610, 31610, 31610, 31610, 31610, 31611, 31611, 31611, 31611, 31611, 31612,
-    31612, 31612, 31612, 31612, 31613, 31613, 31613, 31613, 31613, 31614, 31614,
-    31614, 31614, 31614, 31615, 31615, 31615, 31615, 31615, 31616, 31616, 31616,
-    31616, 31616, 31617, 31617, 31617, 31617, 31617, 31618, 31618, 31618, 31618,
-    31618, 31619, 31619, 31619, 31619, 31619, 31619, 31620, 31620, 31620, 31620,
-    31620, 31621, 31621, 31621, 31621, 31621, 31622, 31622, 31622, 31622, 31622,
-    31623, 31623, 31623, 31623, 31623, 31624, 31624, 31624, 31624, 31624, 31625,
-    31625, 31625, 31625, 31625, 31626, 31626, 31626, 31626, 31626, 31627, 31627,
-    31627, 31627, 31627, 31628, 31628, 31628, 31628, 31628, 31629, 31629, 31629,
-    31629, 31629, 31630, 31630, 31630, 31630, 31630, 31631, 31631, 31631, 31631,
-    31631, 31632, 31632, 31632, 31632, 31632, 31633, 31633, 31633, 31633, 31633,
-    31634, 31634, 31634, 31634, 31634, 31635, 31635, 31635, 31635, 31635, 31636,
-    31636, 31636, 31636, 31636, 31637, 31637, 31637, 31637, 31637, 31638, 31638,
-    31638, 31638, 31638, 31639, 31639, 31639, 31639, 31639, 31640, 31640, 31640,
-    31640, 31640, 31641, 31641, 31641, 31641, 31641, 31642, 31642, 31642, 31642,
-    31642, 31643, 31643, 31643, 31643, 31643, 31644, 31644, 31644, 31644, 31644,
-    31645, 31645, 31645, 31645, 31645, 31646, 31646, 31646, 31646, 31646, 31647,
-    31647, 31647, 31647, 31647, 31647, 31648, 31648, 31648, 31648, 31648, 31649,
-    31649, 31649, 31649, 31649, 31650, 31650, 31650, 31650, 31650, 31651, 31651,
-    31651, 31651, 31651, 31652, 31652, 31652, 31652, 31652, 31653, 31653, 31653,
-    31653, 31653, 31654, 31654, 31654, 31654, 31654, 31655, 31655, 31655, 31655,
-    31655, 31656, 31656, 31656, 31656, 31656, 31657, 31657, 31657, 31657, 31657,
-    31658, 31658, 31658, 31658, 31658, 31659, 31659, 31659, 31659, 31659, 31660,
-    31660, 31660, 31660, 31660, 31661, 31661, 31661, 31661, 31661, 31662, 31662,
-    31662, 31662, 31662, 31663, 31663, 31663, 31663, 31663, 31664, 31664, 31664,
-    31664, 31664, 31664, 31665, 31665, 31665, 31665, 31665, 31666, 31666, 31666,
-    31666, 31666, 31667, 31667, 31667, 31667, 31667, 31668, 31668, 31668, 31668,
-    31668, 31669, 31669, 31669, 31669, 31669, 31670, 31670, 31670, 31670, 31670,
-    31671, 31671, 31671, 31671, 31671, 31672, 31672, 31672, 31672, 31672, 31673,
-    31673, 31673, 31673, 31673, 31674, 31674, 31674, 31674, 31674, 31675, 31675,
-    31675, 31675, 31675, 31676, 31676, 31676, 31676, 31676, 31677, 31677, 31677,
-    31677, 31677, 31678, 31678, 31678, 31678, 31678, 31678, 31679, 31679, 31679,
-    31679, 31679, 31680, 31680, 31680, 31680, 31680, 31681, 31681, 31681, 31681,
-    31681, 31682, 31682, 31682, 31682, 31682, 31683, 31683, 31683, 31683, 31683,
-    31684, 31684, 31684, 31684, 31684, 31685, 31685, 31685, 31685, 31685, 31686,
-    31686, 31686, 31686, 31686, 31687, 31687, 31687, 31687, 31687, 31688, 31688,
-    31688, 31688, 31688, 31689, 31689, 31689, 31689, 31689, 31690, 31690, 31690,
-    31690, 31690, 31690, 31691, 31691, 31691, 31691, 31691, 31692, 31692, 31692,
-    31692, 31692, 31693, 31693, 31693, 31693, 31693, 31694, 31694, 31694, 31694,
-    31694, 31695, 31695, 31695, 31695, 31695, 31696, 31696, 31696, 31696, 31696,
-    31697, 31697, 31697, 31697, 31697, 31698, 31698, 31698, 31698, 31698, 31699,
-    31699, 31699, 31699, 31699, 31700, 31700, 31700, 31700, 31700, 31700, 31701,
-    31701, 31701, 31701, 31701, 31702, 31702, 31702, 31702, 31702, 31703, 31703,
-    31703, 31703, 31703, 31704, 31704, 31704, 31704, 31704, 31705, 31705, 31705,
-    31705, 31705, 31706, 31706, 31706, 31706, 31706, 31707, 31707, 31707, 31707,
-    31707, 31708, 31708, 31708, 31708, 31708, 31709, 31709, 31709, 31709, 31709,
-    31709, 31710, 31710, 31710, 31710, 31710, 31711, 31711, 31711, 31711, 31711,
-    31712, 31712, 31712, 31712, 31712, 31713, 31713, 31713, 31713, 31713, 31714,
-    31714, 31714, 31714, 31714, 31715, 31715, 31715, 31715, 31715, 31716, 31716,
-    31716, 31716, 31716, 31717, 31717, 31717, 31717, 31717, 31718, 31718, 31718,
-    31718, 31718, 31718, 31719, 31719, 31719, 31719, 31719, 31720, 31720, 31720,
-    31720, 31720, 31721, 31721, 31721, 31721, 31721, 31722, 31722, 31722, 31722,
-    31722, 31723, 31723, 31723, 31723, 31723, 31724, 31724, 31724, 31724, 31724,
-    31725, 31725, 31725, 31725, 31725, 31726, 31726, 31726, 31726, 31726, 31726,
-    31727, 31727, 31727, 31727, 31727, 31728, 31728, 31728, 31728, 31728, 31729,
-    31729, 31729, 31729, 31729, 31730, 31730, 31730, 31730, 31730, 31731, 31731,
-    31731, 31731, 31731, 31732, 31732, 31732, 31732, 31732, 31733, 31733, 31733,
-    31733, 31733, 31734, 31734, 31734, 31734, 31734, 31734, 31735, 31735, 31735,
-    31735, 31735, 31736, 31736, 31736, 31736, 31736, 31737, 31737, 31737, 31737,
-    31737, 31738, 31738, 31738, 31738, 31738, 31739, 31739, 31739, 31739, 31739,
-    31740, 31740, 31740, 31740, 31740, 31741, 31741, 31741, 31741, 31741, 31741,
-    31742, 31742, 31742, 31742, 31742, 31743, 31743, 31743, 31743, 31743, 31744,
-    31744, 31744, 31744, 31744, 31745, 31745, 31745, 31745, 31745, 31746, 31746,
-    31746, 31746, 31746, 31747, 31747, 31747, 31747, 31747, 31748, 31748, 31748,
-    31748, 31748, 31748, 31749, 31749, 31749, 31749, 31749, 31750, 31750, 31750,
-    31750, 31750, 31751, 31751, 31751, 31751, 31751, 31752, 31752, 31752, 31752,
-    31752, 31753, 31753, 31753, 31753, 31753, 31754, 31754, 31754, 31754, 31754,
-    31755, 31755, 31755, 31755, 31755, 31755, 31756, 31756, 31756, 31756, 31756,
-    31757, 31757, 31757, 31757, 31757, 31758, 31758, 31758, 31758, 31758, 31759,
-    31759, 31759, 31759, 31759, 31760, 31760, 31760, 31760, 31760, 31761, 31761,
-    31761, 31761, 31761, 31761, 31762, 31762, 31762, 31762, 31762, 31763, 31763,
-    31763, 31763, 31763, 31764, 31764, 31764, 31764, 31764, 31765, 31765, 31765,
-    31765, 31765, 31766, 31766, 31766, 31766, 31766, 31767, 31767, 31767, 31767,
-    31767, 31767, 31768, 31768, 31768, 31768, 31768, 31769, 31769, 31769, 31769,
-    31769, 31770, 31770, 31770, 31770, 31770, 31771, 31771, 31771, 31771, 31771,
-    31772, 31772, 31772, 31772, 31772, 31773, 31773, 31773, 31773, 31773, 31773,
-    31774, 31774, 31774, 31774, 31774, 31775, 31775, 31775, 31775, 31775, 31776,
-    31776, 31776, 31776, 31776, 31777, 31777, 31777, 31777, 31777, 31778, 31778,
-    31778, 31778, 31778, 31779, 31779, 31779, 31779, 31779, 31779, 31780, 31780,
-    31780, 31780, 31780, 31781, 31781, 31781, 31781, 31781, 31782, 31782, 31782,
-    31782, 31782, 31783, 31783, 31783, 31783, 31783, 31784, 31784, 31784, 31784,
-    31784, 31784, 31785, 31785, 31785, 31785, 31785, 31786, 31786, 31786, 31786,
-    31786, 31787, 31787, 31787, 31787, 31787, 31788, 31788, 31788, 31788, 31788,
-    31789, 31789, 31789, 31789, 31789, 31790, 31790, 31790, 31790, 31790, 31790,
-    31791, 31791, 31791, 31791, 31791, 31792, 31792, 31792, 31792, 31792, 31793,
-    31793, 31793, 31793, 31793, 31794, 31794, 31794, 31794, 31794, 31795, 31795,
-    31795, 31795, 31795, 31795, 31796, 31796, 31796, 31796, 31796, 31797, 31797,
-    31797, 31797, 31797, 31798, 31798, 31798, 31798, 31798, 31799, 31799, 31799,
-    31799, 31799, 31800, 31800, 31800, 31800, 31800, 31800, 31801, 31801, 31801,
-    31801, 31801, 31802, 31802, 31802, 31802, 31802, 31803, 31803, 31803, 31803,
-    31803, 31804, 31804, 31804, 31804, 31804, 31805, 31805, 31805, 31805, 31805,
-    31805, 31806, 31806, 31806, 31806, 31806, 31807, 31807, 31807, 31807, 31807,
-    31808, 31808, 31808, 31808, 31808, 31809, 31809, 31809, 31809, 31809, 31810,
-    31810, 31810, 31810, 31810, 31810, 31811, 31811, 31811, 31811, 31811, 31812,
-    31812, 31812, 31812, 31812, 31813, 31813, 31813, 31813, 31813, 31814, 31814,
-    31814, 31814, 31814, 31815, 31815, 31815, 31815, 31815, 31815, 31816, 31816,
-    31816, 31816, 31816, 31817, 31817, 31817, 31817, 31817, 31818, 31818, 31818,
-    31818, 31818, 31819, 31819, 31819, 31819, 31819, 31819, 31820, 31820, 31820,
-    31820, 31820, 31821, 31821, 31821, 31821, 31821, 31822, 31822, 31822, 31822,
-    31822, 31823, 31823, 31823, 31823, 31823, 31824, 31824, 31824, 31824, 31824,
-    31824, 31825, 31825, 31825, 31825, 31825, 31826, 31826, 31826, 31826, 31826,
-    31827, 31827, 31827, 31827, 31827, 31828, 31828, 31828, 31828, 31828, 31828,
-    31829, 31829, 31829, 31829, 31829, 31830, 31830, 31830, 31830, 31830, 31831,
-    31831, 31831, 31831, 31831, 31832, 31832, 31832, 31832, 31832, 31833, 31833,
-    31833, 31833, 31833, 31833, 31834, 31834, 31834, 31834, 31834, 31835, 31835,
-    31835, 31835, 31835, 31836, 31836, 31836, 31836, 31836, 31837, 31837, 31837,
-    31837, 31837, 31837, 31838, 31838, 31838, 31838, 31838, 31839, 31839, 31839,
-    31839, 31839, 31840, 31840, 31840, 31840, 31840, 31841, 31841, 31841, 31841,
-    31841, 31841, 31842, 31842, 31842, 31842, 31842, 31843, 31843, 31843, 31843,
-    31843, 31844, 31844, 31844, 31844, 31844, 31845, 31845, 31845, 31845, 31845,
-    31845, 31846, 31846, 31846, 31846, 31846, 31847, 31847, 31847, 31847, 31847,
-    31848, 31848, 31848, 31848, 31848, 31849, 31849, 31849, 31849, 31849, 31849,
-    31850, 31850, 31850, 31850, 31850, 31851, 31851, 31851, 31851, 31851, 31852,
-    31852, 31852, 31852, 31852, 31853, 31853, 31853, 31853, 31853, 31853, 31854,
-    31854, 31854, 31854, 31854, 31855, 31855, 31855, 31855, 31855, 31856, 31856,
-    31856, 31856, 31856, 31857, 31857, 31857, 31857, 31857, 31857, 31858, 31858,
-    31858, 31858, 31858, 31859, 31859, 31859, 31859, 31859, 31860, 31860, 31860,
-    31860, 31860, 31861, 31861, 31861, 31861, 31861, 31861, 31862, 31862, 31862,
-    31862, 31862, 31863, 31863, 31863, 31863, 31863, 31864, 31864, 31864, 31864,
-    31864, 31865, 31865, 31865, 31865, 31865, 31865, 31866, 31866, 31866, 31866,
-    31866, 31867, 31867, 31867, 31867, 31867, 31868, 31868, 31868, 31868, 31868,
-    31869, 31869, 31869, 31869, 31869, 31869, 31870, 31870, 31870, 31870, 31870,
-    31871, 31871, 31871, 31871, 31871, 31872, 31872, 31872, 31872, 31872, 31872,
-    31873, 31873, 31873, 31873, 31873, 31874, 31874, 31874, 31874, 31874, 31875,
-    31875, 31875, 31875, 31875, 31876, 31876, 31876, 31876, 31876, 31876, 31877,
-    31877, 31877, 31877, 31877, 31878, 31878, 31878, 31878, 31878, 31879, 31879,
-    31879, 31879, 31879, 31880, 31880, 31880, 31880, 31880, 31880, 31881, 31881,
-    31881, 31881, 31881, 31882, 31882, 31882, 31882, 31882, 31883, 31883, 31883,
-    31883, 31883, 31883, 31884, 31884, 31884, 31884, 31884, 31885, 31885, 31885,
-    31885, 31885, 31886, 31886, 31886, 31886, 31886, 31887, 31887, 31887, 31887,
-    31887, 31887, 31888, 31888, 31888, 31888, 31888, 31889, 31889, 31889, 31889,
-    31889, 31890, 31890, 31890, 31890, 31890, 31890, 31891, 31891, 31891, 31891,
-    31891, 31892, 31892, 31892, 31892, 31892, 31893, 31893, 31893, 31893, 31893,
-    31894, 31894, 31894, 31894, 31894, 31894, 31895, 31895, 31895, 31895, 31895,
-    31896, 31896, 31896, 31896, 31896, 31897, 31897, 31897, 31897, 31897, 31897,
-    31898, 31898, 31898, 31898, 31898, 31899, 31899, 31899, 31899, 31899, 31900,
-    31900, 31900, 31900, 31900, 31901, 31901, 31901, 31901, 31901, 31901, 31902,
-    31902, 31902, 31902, 31902, 31903, 31903, 31903, 31903, 31903, 31904, 31904,
-    31904, 31904, 31904, 31904, 31905, 31905, 31905, 31905, 31905, 31906, 31906,
-    31906, 31906, 31906, 31907, 31907, 31907, 31907, 31907, 31907, 31908, 31908,
-    31908, 31908, 31908, 31909, 31909, 31909, 31909, 31909, 31910, 31910, 31910,
-    31910, 31910, 31910, 31911, 31911, 31911, 31911, 31911, 31912, 31912, 31912,
-    31912, 31912, 31913, 31913, 31913, 31913, 31913, 31914, 31914, 31914, 31914,
-    31914, 31914, 31915, 31915, 31915, 31915, 31915, 31916, 31916, 31916, 31916,
-    31916, 31917, 31917, 31917, 31917, 31917, 31917, 31918, 31918, 31918, 31918,
-    31918, 31919, 31919, 31919, 31919, 31919, 31920, 31920, 31920, 31920, 31920,
-    31920, 31921, 31921, 31921, 31921, 31921, 31922, 31922, 31922, 31922, 31922,
-    31923, 31923, 31923, 31923, 31923, 31923, 31924, 31924, 31924, 31924, 31924,
-    31925, 31925, 31925, 31925, 31925, 31926, 31926, 31926, 31926, 31926, 31926,
-    31927, 31927, 31927, 31927, 31927, 31928, 31928, 31928, 31928, 31928, 31929,
-    31929, 31929, 31929, 31929, 31929, 31930, 31930, 31930, 31930, 31930, 31931,
-    31931, 31931, 31931, 31931, 31932, 31932, 31932, 31932, 31932, 31932, 31933,
-    31933, 31933, 31933, 31933, 31934, 31934, 31934, 31934, 31934, 31935, 31935,
-    31935, 31935, 31935, 31935, 31936, 31936, 31936, 31936, 31936, 31937, 31937,
-    31937, 31937, 31937, 31938, 31938, 31938, 31938, 31938, 31938, 31939, 31939,
-    31939, 31939, 31939, 31940, 31940, 31940, 31940, 31940, 31941, 31941, 31941,
-    31941, 31941, 31941, 31942, 31942, 31942, 31942, 31942, 31943, 31943, 31943,
-    31943, 31943, 31944, 31944, 31944, 31944, 31944, 31944, 31945, 31945, 31945,
-    31945, 31945, 31946, 31946, 31946, 31946, 31946, 31947, 31947, 31947, 31947,
-    31947, 31947, 31948, 31948, 31948, 31948, 31948, 31949, 31949, 31949, 31949,
-    31949, 31950, 31950, 31950, 31950, 31950, 31950, 31951, 31951, 31951, 31951,
-    31951, 31952, 31952, 31952, 31952, 31952, 31953, 31953, 31953, 31953, 31953,
-    31953, 31954, 31954, 31954, 31954, 31954, 31955, 31955, 31955, 31955, 31955,
-    31956, 31956, 31956, 31956, 31956, 31956, 31957, 31957, 31957, 31957, 31957,
-    31958, 31958, 31958, 31958, 31958, 31958, 31959, 31959, 31959, 31959, 31959,
-    31960, 31960, 31960, 31960, 31960, 31961, 31961, 31961, 31961, 31961, 31961,
-    31962, 31962, 31962, 31962, 31962, 31963, 31963, 31963, 31963, 31963, 31964,
-    31964, 31964, 31964, 31964, 31964, 31965, 31965, 31965, 31965, 31965, 31966,
-    31966, 31966, 31966, 31966, 31967, 31967, 31967, 31967, 31967, 31967, 31968,
-    31968, 31968, 31968, 31968, 31969, 31969, 31969, 31969, 31969, 31969, 31970,
-    31970, 31970, 31970, 31970, 31971, 31971, 31971, 31971, 31971, 31972, 31972,
-    31972, 31972, 31972, 31972, 31973, 31973, 31973, 31973, 31973, 31974, 31974,
-    31974, 31974, 31974, 31975, 31975, 31975, 31975, 31975, 31975, 31976, 31976,
-    31976, 31976, 31976, 31977, 31977, 31977, 31977, 31977, 31977, 31978, 31978,
-    31978, 31978, 31978, 31979, 31979, 31979, 31979, 31979, 31980, 31980, 31980,
-    31980, 31980, 31980, 31981, 31981, 31981, 31981, 31981, 31982, 31982, 31982,
-    31982, 31982, 31983, 31983, 31983, 31983, 31983, 31983, 31984, 31984, 31984,
-    31984, 31984, 31985, 31985, 31985, 31985, 31985, 31985, 31986, 31986, 31986,
-    31986, 31986, 31987, 31987, 31987, 31987, 31987, 31988, 31988, 31988, 31988,
-    31988, 31988, 31989, 31989, 31989, 31989, 31989, 31990, 31990, 31990, 31990,
-    31990, 31990, 31991, 31991, 31991, 31991, 31991, 31992, 31992, 31992, 31992,
-    31992, 31993, 31993, 31993, 31993, 31993, 31993, 31994, 31994, 31994, 31994,
-    31994, 31995, 31995, 31995, 31995, 31995, 31996, 31996, 31996, 31996, 31996,
-    31996, 31997, 31997, 31997, 31997, 31997, 31998, 31998, 31998, 31998, 31998,
-    31998, 31999, 31999, 31999, 31999, 31999, 32000, 32000, 32000, 32000, 32000,
-    32001, 32001, 32001, 32001, 32001, 32001, 32002, 32002, 32002, 32002, 32002,
-    32003, 32003, 32003, 32003, 32003, 32003, 32004, 32004, 32004, 32004, 32004,
-    32005, 32005, 32005, 32005, 32005, 32005, 32006, 32006, 32006, 32006, 32006,
-    32007, 32007, 32007, 32007, 32007, 32008, 32008, 32008, 32008, 32008, 32008,
-    32009, 32009, 32009, 32009, 32009, 32010, 32010, 32010, 32010, 32010, 32010,
-    32011, 32011, 32011, 32011, 32011, 32012, 32012, 32012, 32012, 32012, 32013,
-    32013, 32013, 32013, 32013, 32013, 32014, 32014, 32014, 32014, 32014, 32015,
-    32015, 32015, 32015, 32015, 32015, 32016, 32016, 32016, 32016, 32016, 32017,
-    32017, 32017, 32017, 32017, 32018, 32018, 32018, 32018, 32018, 32018, 32019,
-    32019, 32019, 32019, 32019, 32020, 32020, 32020, 32020, 32020, 32020, 32021,
-    32021, 32021, 32021, 32021, 32022, 32022, 32022, 32022, 32022, 32022, 32023,
-    32023, 32023, 32023, 32023, 32024, 32024, 32024, 32024, 32024, 32025, 32025,
-    32025, 32025, 32025, 32025, 32026, 32026, 32026, 32026, 32026, 32027, 32027,
-    32027, 32027, 32027, 32027, 32028, 32028, 32028, 32028, 32028, 32029, 32029,
-    32029, 32029, 32029, 32029, 32030, 32030, 32030, 32030, 32030, 32031, 32031,
-    32031, 32031, 32031, 32032, 32032, 32032, 32032, 32032, 32032, 32033, 32033,
-    32033, 32033, 32033, 32034, 32034, 32034, 32034, 32034, 32034, 32035, 32035,
-    32035, 32035, 32035, 32036, 32036, 32036, 32036, 32036, 32036, 32037, 32037,
-    32037, 32037, 32037, 32038, 32038, 32038, 32038, 32038, 32039, 32039, 32039,
-    32039, 32039, 32039, 32040, 32040, 32040, 32040, 32040, 32041, 32041, 32041,
-    32041, 32041, 32041, 32042, 32042, 32042, 32042, 32042, 32043, 32043, 32043,
-    32043, 32043, 32043, 32044, 32044, 32044, 32044, 32044, 32045, 32045, 32045,
-    32045, 32045, 32045, 32046, 32046, 32046, 32046, 32046, 32047, 32047, 32047,
-    32047, 32047, 32048, 32048, 32048, 32048, 32048, 32048, 32049, 32049, 32049,
-    32049, 32049, 32050, 32050, 32050, 32050, 32050, 32050, 32051, 32051, 32051,
-    32051, 32051, 32052, 32052, 32052, 32052, 32052, 32052, 32053, 32053, 32053,
-    32053, 32053, 32054, 32054, 32054, 32054, 32054, 32054, 32055, 32055, 32055,
-    32055, 32055, 32056, 32056, 32056, 32056, 32056, 32056, 32057, 32057, 32057,
-    32057, 32057, 32058, 32058, 32058, 32058, 32058, 32059, 32059, 32059, 32059,
-    32059, 32059, 32060, 32060, 32060, 32060, 32060, 32061, 32061, 32061, 32061,
-    32061, 32061, 32062, 32062, 32062, 32062, 32062, 32063, 32063, 32063, 32063,
-    32063, 32063, 32064, 32064, 32064, 32064, 32064, 32065, 32065, 32065, 32065,
-    32065, 32065, 32066, 32066, 32066, 32066, 32066, 32067, 32067, 32067, 32067,
-    32067, 32067, 32068, 32068, 32068, 32068, 32068, 32069, 32069, 32069, 32069,
-    32069, 32069, 32070, 32070, 32070, 32070, 32070, 32071, 32071, 32071, 32071,
-    32071, 32071, 32072, 32072, 32072, 32072, 32072, 32073, 32073, 32073, 32073,
-    32073, 32073, 32074, 32074, 32074, 32074, 32074, 32075, 32075, 32075, 32075,
-    32075, 32076, 32076, 32076, 32076, 32076, 32076, 32077, 32077, 32077, 32077,
-    32077, 32078, 32078, 32078, 32078, 32078, 32078, 32079, 32079, 32079, 32079,
-    32079, 32080, 32080, 32080, 32080, 32080, 32080, 32081, 32081, 32081, 32081,
-    32081, 32082, 32082, 32082, 32082, 32082, 32082, 32083, 32083, 32083, 32083,
-    32083, 32084, 32084, 32084, 32084, 32084, 32084, 32085, 32085, 32085, 32085,
-    32085, 32086, 32086, 32086, 32086, 32086, 32086, 32087, 32087, 32087, 32087,
-    32087, 32088, 32088, 32088, 32088, 32088, 32088, 32089, 32089, 32089, 32089,
-    32089, 32090, 32090, 32090, 32090, 32090, 32090, 32091, 32091, 32091, 32091,
-    32091, 32092, 32092, 32092, 32092, 32092, 32092, 32093, 32093, 32093, 32093,
-    32093, 32094, 32094, 32094, 32094, 32094, 32094, 32095, 32095, 32095, 32095,
-    32095, 32096, 32096, 32096, 32096, 32096, 32096, 32097, 32097, 32097, 32097,
-    32097, 32098, 32098, 32098, 32098, 32098, 32098, 32099, 32099, 32099, 32099,
-    32099, 32100, 32100, 32100, 32100, 32100, 32100, 32101, 32101, 32101, 32101,
-    32101, 32102, 32102, 32102, 32102, 32102, 32102, 32103, 32103, 32103, 32103,
-    32103, 32104, 32104, 32104, 32104, 32104, 32104, 32105, 32105, 32105, 32105,
-    32105, 32106, 32106, 32106, 32106, 32106, 32106, 32107, 32107, 32107, 32107,
-    32107, 32108, 32108, 32108, 32108, 32108, 32108, 32109, 32109, 32109, 32109,
-    32109, 32110, 32110, 32110, 32110, 32110, 32110, 32111, 32111, 32111, 32111,
-    32111, 32112, 32112, 32112, 32112, 32112, 32112, 32113, 32113, 32113, 32113,
-    32113, 32114, 32114, 32114, 32114, 32114, 32114, 32115, 32115, 32115, 32115,
-    32115, 32116, 32116, 32116, 32116, 32116, 32116, 32117, 32117, 32117, 32117,
-    32117, 32117, 32118, 32118, 32118, 32118, 32118, 32119, 32119, 32119, 32119,
-    32119, 32119, 32120, 32120, 32120, 32120, 32120, 32121, 32121, 32121, 32121,
-    32121, 32121, 32122, 32122, 32122, 32122, 32122, 32123, 32123, 32123, 32123,
-    32123, 32123, 32124, 32124, 32124, 32124, 32124, 32125, 32125, 32125, 32125,
-    32125, 32125, 32126, 32126, 32126, 32126, 32126, 32127, 32127, 32127, 32127,
-    32127, 32127, 32128, 32128, 32128, 32128, 32128, 32129, 32129, 32129, 32129,
-    32129, 32129, 32130, 32130, 32130, 32130, 32130, 32131, 32131, 32131, 32131,
-    32131, 32131, 32132, 32132, 32132, 32132, 32132, 32133, 32133, 32133, 32133,
-    32133, 32133, 32134, 32134, 32134, 32134, 32134, 32134, 32135, 32135, 32135,
-    32135, 32135, 32136, 32136, 32136, 32136, 32136, 32136, 32137, 32137, 32137,
-    32137, 32137, 32138, 32138, 32138, 32138, 32138, 32138, 32139, 32139, 32139,
-    32139, 32139, 32140, 32140, 32140, 32140, 32140, 32140, 32141, 32141, 32141,
-    32141, 32141, 32142, 32142, 32142, 32142, 32142, 32142, 32143, 32143, 32143,
-    32143, 32143, 32144, 32144, 32144, 32144, 32144, 32144, 32145, 32145, 32145,
-    32145, 32145, 32145, 32146, 32146, 32146, 32146, 32146, 32147, 32147, 32147,
-    32147, 32147, 32147, 32148, 32148, 32148, 32148, 32148, 32149, 32149, 32149,
-    32149, 32149, 32149, 32150, 32150, 32150, 32150, 32150, 32151, 32151, 32151,
-    32151, 32151, 32151, 32152, 32152, 32152, 32152, 32152, 32153, 32153, 32153,
-    32153, 32153, 32153, 32154, 32154, 32154, 32154, 32154, 32154, 32155, 32155,
-    32155, 32155, 32155, 32156, 32156, 32156, 32156, 32156, 32156, 32157, 32157,
-    32157, 32157, 32157, 32158, 32158, 32158, 32158, 32158, 32158, 32159, 32159,
-    32159, 32159, 32159, 32160, 32160, 32160, 32160, 32160, 32160, 32161, 32161,
-    32161, 32161, 32161, 32161, 32162, 32162, 32162, 32162, 32162, 32163, 32163,
-    32163, 32163, 32163, 32163, 32164, 32164, 32164, 32164, 32164, 32165, 32165,
-    32165, 32165, 32165, 32165, 32166, 32166, 32166, 32166, 32166, 32167, 32167,
-    32167, 32167, 32167, 32167, 32168, 32168, 32168, 32168, 32168, 32168, 32169,
-    32169, 32169, 32169, 32169, 32170, 32170, 32170, 32170, 32170, 32170, 32171,
-    32171, 32171, 32171, 32171, 32172, 32172, 32172, 32172, 32172, 32172, 32173,
-    32173, 32173, 32173, 32173, 32174, 32174, 32174, 32174, 32174, 32174, 32175,
-    32175, 32175, 32175, 32175, 32175, 32176, 32176, 32176, 32176, 32176, 32177,
-    32177, 32177, 32177, 32177, 32177, 32178, 32178, 32178, 32178, 32178, 32179,
-    32179, 32179, 32179, 32179, 32179, 32180, 32180, 32180, 32180, 32180, 32180,
-    32181, 32181, 32181, 32181, 32181, 32182, 32182, 32182, 32182, 32182, 32182,
-    32183, 32183, 32183, 32183, 32183, 32184, 32184, 32184, 32184, 32184, 32184,
-    32185, 32185, 32185, 32185, 32185, 32186, 32186, 32186, 32186, 32186, 32186,
-    32187, 32187, 32187, 32187, 32187, 32187, 32188, 32188, 32188, 32188, 32188,
-    32189, 32189, 32189, 32189, 32189, 32189, 32190, 32190, 32190, 32190, 32190,
-    32191, 32191, 32191, 32191, 32191, 32191, 32192, 32192, 32192, 32192, 32192,
-    32192, 32193, 32193, 32193, 32193, 32193, 32194, 32194, 32194, 32194, 32194,
-    32194, 32195, 32195, 32195, 32195, 32195, 32196, 32196, 32196, 32196, 32196,
-    32196, 32197, 32197, 32197, 32197, 32197, 32197, 32198, 32198, 32198, 32198,
-    32198, 32199, 32199, 32199, 32199, 32199, 32199, 32200, 32200, 32200, 32200,
-    32200, 32200, 32201, 32201, 32201, 32201, 32201, 32202, 32202, 32202, 32202,
-    32202, 32202, 32203, 32203, 32203, 32203, 32203, 32204, 32204, 32204, 32204,
-    32204, 32204, 32205, 32205, 32205, 32205, 32205, 32205, 32206, 32206, 32206,
-    32206, 32206, 32207, 32207, 32207, 32207, 32207, 32207, 32208, 32208, 32208,
-    32208, 32208, 32209, 32209, 32209, 32209, 32209, 32209, 32210, 32210, 32210,
-    32210, 32210, 32210, 32211, 32211, 32211, 32211, 32211, 32212, 32212, 32212,
-    32212, 32212, 32212, 32213, 32213, 32213, 32213, 32213, 32213, 32214, 32214,
-    32214, 32214, 32214, 32215, 32215, 32215, 32215, 32215, 32215, 32216, 32216,
-    32216, 32216, 32216, 32217, 32217, 32217, 32217, 32217, 32217, 32218, 32218,
-    32218, 32218, 32218, 32218, 32219, 32219, 32219, 32219, 32219, 32220, 32220,
-    32220, 32220, 32220, 32220, 32221, 32221, 32221, 32221, 32221, 32221, 32222,
-    32222, 32222, 32222, 32222, 32223, 32223, 32223, 32223, 32223, 32223, 32224,
-    32224, 32224, 32224, 32224, 32225, 32225, 32225, 32225, 32225, 32225, 32226,
-    32226, 32226, 32226, 32226, 32226, 32227, 32227, 32227, 32227, 32227, 32228,
-    32228, 32228, 32228, 32228, 32228, 32229, 32229, 32229, 32229, 32229, 32229,
-    32230, 32230, 32230, 32230, 32230, 32231, 32231, 32231, 32231, 32231, 32231,
-    32232, 32232, 32232, 32232, 32232, 32232, 32233, 32233, 32233, 32233, 32233,
-    32234, 32234, 32234, 32234, 32234, 32234, 32235, 32235, 32235, 32235, 32235,
-    32235, 32236, 32236, 32236, 32236, 32236, 32237, 32237, 32237, 32237, 32237,
-    32237, 32238, 32238, 32238, 32238, 32238, 32238, 32239, 32239, 32239, 32239,
-    32239, 32240, 32240, 32240, 32240, 32240, 32240, 32241, 32241, 32241, 32241,
-    32241, 32242, 32242, 32242, 32242, 32242, 32242, 32243, 32243, 32243, 32243,
-    32243, 32243, 32244, 32244, 32244, 32244, 32244, 32245, 32245, 32245, 32245,
-    32245, 32245, 32246, 32246, 32246, 32246, 32246, 32246, 32247, 32247, 32247,
-    32247, 32247, 32248, 32248, 32248, 32248, 32248, 32248, 32249, 32249, 32249,
-    32249, 32249, 32249, 32250, 32250, 32250, 32250, 32250, 32251, 32251, 32251,
-    32251, 32251, 32251, 32252, 32252, 32252, 32252, 32252, 32252, 32253, 32253,
-    32253, 32253, 32253, 32254, 32254, 32254, 32254, 32254, 32254, 32255, 32255,
-    32255, 32255, 32255, 32255, 32256, 32256, 32256, 32256, 32256, 32257, 32257,
-    32257, 32257, 32257, 32257, 32258, 32258, 32258, 32258, 32258, 32258, 32259,
-    32259, 32259, 32259, 32259, 32260, 32260, 32260, 32260, 32260, 32260, 32261,
-    32261, 32261, 32261, 32261, 32261, 32262, 32262, 32262, 32262, 32262, 32263,
-    32263, 32263, 32263, 32263, 32263, 32264, 32264, 32264, 32264, 32264, 32264,
-    32265, 32265, 32265, 32265, 32265, 32266, 32266, 32266, 32266, 32266, 32266,
-    32267, 32267, 32267, 32267, 32267, 32267, 32268, 32268, 32268, 32268, 32268,
-    32268, 32269, 32269, 32269, 32269, 32269, 32270, 32270, 32270, 32270, 32270,
-    32270, 32271, 32271, 32271, 32271, 32271, 32271, 32272, 32272, 32272, 32272,
-    32272, 32273, 32273, 32273, 32273, 32273, 32273, 32274, 32274, 32274, 32274,
-    32274, 32274, 32275, 32275, 32275, 32275, 32275, 32276, 32276, 32276, 32276,
-    32276, 32276, 32277, 32277, 32277, 32277, 32277, 32277, 32278, 32278, 32278,
-    32278, 32278, 32279, 32279, 32279, 32279, 32279, 32279, 32280, 32280, 32280,
-    32280, 32280, 32280, 32281, 32281, 32281, 32281, 32281, 32281, 32282, 32282,
-    32282, 32282, 32282, 32283, 32283, 32283, 32283, 32283, 32283, 32284, 32284,
-    32284, 32284, 32284, 32284, 32285, 32285, 32285, 32285, 32285, 32286, 32286,
-    32286, 32286, 32286, 32286, 32287, 32287, 32287, 32287, 32287, 32287, 32288,
-    32288, 32288, 32288, 32288, 32289, 32289, 32289, 32289, 32289, 32289, 32290,
-    32290, 32290, 32290, 32290, 32290, 32291, 32291, 32291, 32291, 32291, 32291,
-    32292, 32292, 32292, 32292, 32292, 32293, 32293, 32293, 32293, 32293, 32293,
-    32294, 32294, 32294, 32294, 32294, 32294, 32295, 32295, 32295, 32295, 32295,
-    32296, 32296, 32296, 32296, 32296, 32296, 32297, 32297, 32297, 32297, 32297,
-    32297, 32298, 32298, 32298, 32298, 32298, 32298, 32299, 32299, 32299, 32299,
-    32299, 32300, 32300, 32300, 32300, 32300, 32300, 32301, 32301, 32301, 32301,
-    32301, 32301, 32302, 32302, 32302, 32302, 32302, 32303, 32303, 32303, 32303,
-    32303, 32303, 32304, 32304, 32304, 32304, 32304, 32304, 32305, 32305, 32305,
-    32305, 32305, 32305, 32306, 32306, 32306, 32306, 32306, 32307, 32307, 32307,
-    32307, 32307, 32307, 32308, 32308, 32308, 32308, 32308, 32308, 32309, 32309,
-    32309, 32309, 32309, 32310, 32310, 32310, 32310, 32310, 32310, 32311, 32311,
-    32311, 32311, 32311, 32311, 32312, 32312, 32312, 32312, 32312, 32312, 32313,
-    32313, 32313, 32313, 32313, 32314, 32314, 32314, 32314, 32314, 32314, 32315,
-    32315, 32315, 32315, 32315, 32315, 32316, 32316, 32316, 32316, 32316, 32316,
-    32317, 32317, 32317, 32317, 32317, 32318, 32318, 32318, 32318, 32318, 32318,
-    32319, 32319, 32319, 32319, 32319, 32319, 32320, 32320, 32320, 32320, 32320,
-    32320, 32321, 32321, 32321, 32321, 32321, 32322, 32322, 32322, 32322, 32322,
-    32322, 32323, 32323, 32323, 32323, 32323, 32323, 32324, 32324, 32324, 32324,
-    32324, 32324, 32325, 32325, 32325, 32325, 32325, 32326, 32326, 32326, 32326,
-    32326, 32326, 32327, 32327, 32327, 32327, 32327, 32327, 32328, 32328, 32328,
-    32328, 32328, 32328, 32329, 32329, 32329, 32329, 32329, 32330, 32330, 32330,
-    32330, 32330, 32330, 32331, 32331, 32331, 32331, 32331, 32331, 32332, 32332,
-    32332, 32332, 32332, 32332, 32333, 32333, 32333, 32333, 32333, 32334, 32334,
-    32334, 32334, 32334, 32334, 32335, 32335, 32335, 32335, 32335, 32335, 32336,
-    32336, 32336, 32336, 32336, 32336, 32337, 32337, 32337, 32337, 32337, 32338,
-    32338, 32338, 32338, 32338, 32338, 32339, 32339, 32339, 32339, 32339, 32339,
-    32340, 32340, 32340, 32340, 32340, 32340, 32341, 32341, 32341, 32341, 32341,
-    32342, 32342, 32342, 32342, 32342, 32342, 32343, 32343, 32343, 32343, 32343,
-    32343, 32344, 32344, 32344, 32344, 32344, 32344, 32345, 32345, 32345, 32345,
-    32345, 32346, 32346, 32346, 32346, 32346, 32346, 32347, 32347, 32347, 32347,
-    32347, 32347, 32348, 32348, 32348, 32348, 32348, 32348, 32349, 32349, 32349,
-    32349, 32349, 32350, 32350, 32350, 32350, 32350, 32350, 32351, 32351, 32351,
-    32351, 32351, 32351, 32352, 32352, 32352, 32352, 32352, 32352, 32353, 32353,
-    32353, 32353, 32353, 32353, 32354, 32354, 32354, 32354, 32354, 32355, 32355,
-    32355, 32355, 32355, 32355, 32356, 32356, 32356, 32356, 32356, 32356, 32357,
-    32357, 32357, 32357, 32357, 32357, 32358, 32358, 32358, 32358, 32358, 32359,
-    32359, 32359, 32359, 32359, 32359, 32360, 32360, 32360, 32360, 32360, 32360,
-    32361, 32361, 32361, 32361, 32361, 32361, 32362, 32362, 32362, 32362, 32362,
-    32362, 32363, 32363, 32363, 32363, 32363, 32364, 32364, 32364, 32364, 32364,
-    32364, 32365, 32365, 32365, 32365, 32365, 32365, 32366, 32366, 32366, 32366,
-    32366, 32366, 32367, 32367, 32367, 32367, 32367, 32367, 32368, 32368, 32368,
-    32368, 32368, 32369, 32369, 32369, 32369, 32369, 32369, 32370, 32370, 32370,
-    32370, 32370, 32370, 32371, 32371, 32371, 32371, 32371, 32371, 32372, 32372,
-    32372, 32372, 32372, 32372, 32373, 32373, 32373, 32373, 32373, 32374, 32374,
-    32374, 32374, 32374, 32374, 32375, 32375, 32375, 32375, 32375, 32375, 32376,
-    32376, 32376, 32376, 32376, 32376, 32377, 32377, 32377, 32377, 32377, 32377,
-    32378, 32378, 32378, 32378, 32378, 32379, 32379, 32379, 32379, 32379, 32379,
-    32380, 32380, 32380, 32380, 32380, 32380, 32381, 32381, 32381, 32381, 32381,
-    32381, 32382, 32382, 32382, 32382, 32382, 32382, 32383, 32383, 32383, 32383,
-    32383, 32384, 32384, 32384, 32384, 32384, 32384, 32385, 32385, 32385, 32385,
-    32385, 32385, 32386, 32386, 32386, 32386, 32386, 32386, 32387, 32387, 32387,
-    32387, 32387, 32387, 32388, 32388, 32388, 32388, 32388, 32389, 32389, 32389,
-    32389, 32389, 32389, 32390, 32390, 32390, 32390, 32390, 32390, 32391, 32391,
-    32391, 32391, 32391, 32391, 32392, 32392, 32392, 32392, 32392, 32392, 32393,
-    32393, 32393, 32393, 32393, 32393, 32394, 32394, 32394, 32394, 32394, 32395,
-    32395, 32395, 32395, 32395, 32395, 32396, 32396, 32396, 32396, 32396, 32396,
-    32397, 32397, 32397, 32397, 32397, 32397, 32398, 32398, 32398, 32398, 32398,
-    32398, 32399, 32399, 32399, 32399, 32399, 32400, 32400, 32400, 32400, 32400,
-    32400, 32401, 32401, 32401, 32401, 32401, 32401, 32402, 32402, 32402, 32402,
-    32402, 32402, 32403, 32403, 32403, 32403, 32403, 32403, 32404, 32404, 32404,
-    32404, 32404, 32404, 32405, 32405, 32405, 32405, 32405, 32406, 32406, 32406,
-    32406, 32406, 32406, 32407, 32407, 32407, 32407, 32407, 32407, 32408, 32408,
-    32408, 32408, 32408, 32408, 32409, 32409, 32409, 32409, 32409, 32409, 32410,
-    32410, 32410, 32410, 32410, 32410, 32411, 32411, 32411, 32411, 32411, 32412,
-    32412, 32412, 32412, 32412, 32412, 32413, 32413, 32413, 32413, 32413, 32413,
-    32414, 32414, 32414, 32414, 32414, 32414, 32415, 32415, 32415, 32415, 32415,
-    32415, 32416, 32416, 32416, 32416, 32416, 32416, 32417, 32417, 32417, 32417,
-    32417, 32417, 32418, 32418, 32418, 32418, 32418, 32419, 32419, 32419, 32419,
-    32419, 32419, 32420, 32420, 32420, 32420, 32420, 32420, 32421, 32421, 32421,
-    32421, 32421, 32421, 32422, 32422, 32422, 32422, 32422, 32422, 32423, 32423,
-    32423, 32423, 32423, 32423, 32424, 32424, 32424, 32424, 32424, 32425, 32425,
-    32425, 32425, 32425, 32425, 32426, 32426, 32426, 32426, 32426, 32426, 32427,
-    32427, 32427, 32427, 32427, 32427, 32428, 32428, 32428, 32428, 32428, 32428,
-    32429, 32429, 32429, 32429, 32429, 32429, 32430, 32430, 32430, 32430, 32430,
-    32430, 32431, 32431, 32431, 32431, 32431, 32432, 32432, 32432, 32432, 32432,
-    32432, 32433, 32433, 32433, 32433, 32433, 32433, 32434, 32434, 32434, 32434,
-    32434, 32434, 32435, 32435, 32435, 32435, 32435, 32435, 32436, 32436, 32436,
-    32436, 32436, 32436, 32437, 32437, 32437, 32437, 32437, 32437, 32438, 32438,
-    32438, 32438, 32438, 32438, 32439, 32439, 32439, 32439, 32439, 32440, 32440,
-    32440, 32440, 32440, 32440, 32441, 32441, 32441, 32441, 32441, 32441, 32442,
-    32442, 32442, 32442, 32442, 32442, 32443, 32443, 32443, 32443, 32443, 32443,
-    32444, 32444, 32444, 32444, 32444, 32444, 32445, 32445, 32445, 32445, 32445,
-    32445, 32446, 32446, 32446, 32446, 32446, 32446, 32447, 32447, 32447, 32447,
-    32447, 32448, 32448, 32448, 32448, 32448, 32448, 32449, 32449, 32449, 32449,
-    32449, 32449, 32450, 32450, 32450, 32450, 32450, 32450, 32451, 32451, 32451,
-    32451, 32451, 32451, 32452, 32452, 32452, 32452, 32452, 32452, 32453, 32453,
-    32453, 32453, 32453, 32453, 32454, 32454, 32454, 32454, 32454, 32454, 32455,
-    32455, 32455, 32455, 32455, 32455, 32456, 32456, 32456, 32456, 32456, 32457,
-    32457, 32457, 32457, 32457, 32457, 32458, 32458, 32458, 32458, 32458, 32458,
-    32459, 32459, 32459, 32459, 32459, 32459, 32460, 32460, 32460, 32460, 32460,
-    32460, 32461, 32461, 32461, 32461, 32461, 32461, 32462, 32462, 32462, 32462,
-    32462, 32462, 32463, 32463, 32463, 32463, 32463, 32463, 32464, 32464, 32464,
-    32464, 32464, 32464, 32465, 32465, 32465, 32465, 32465, 32466, 32466, 32466,
-    32466, 32466, 32466, 32467, 32467, 32467, 32467, 32467, 32467, 32468, 32468,
-    32468, 32468, 32468, 32468, 32469, 32469, 32469, 32469, 32469, 32469, 32470,
-    32470, 32470, 32470, 32470, 32470, 32471, 32471, 32471, 32471, 32471, 32471,
-    32472, 32472, 32472, 32472, 32472, 32472, 32473, 32473, 32473, 32473, 32473,
-    32473, 32474, 32474, 32474, 32474, 32474, 32474, 32475, 32475, 32475, 32475,
-    32475, 32475, 32476, 32476, 32476, 32476, 32476, 32477, 32477, 32477, 32477,
-    32477, 32477, 32478, 32478, 32478, 32478, 32478, 32478, 32479, 32479, 32479,
-    32479, 32479, 32479, 32480, 32480, 32480, 32480, 32480, 32480, 32481, 32481,
-    32481, 32481, 32481, 32481, 32482, 32482, 32482, 32482, 32482, 32482, 32483,
-    32483, 32483, 32483, 32483, 32483, 32484, 32484, 32484, 32484, 32484, 32484,
-    32485, 32485, 32485, 32485, 32485, 32485, 32486, 32486, 32486, 32486, 32486,
-    32486, 32487, 32487, 32487, 32487, 32487, 32487, 32488, 32488, 32488, 32488,
-    32488, 32489, 32489, 32489, 32489, 32489, 32489, 32490, 32490, 32490, 32490,
-    32490, 32490, 32491, 32491, 32491, 32491, 32491, 32491, 32492, 32492, 32492,
-    32492, 32492, 32492, 32493, 32493, 32493, 32493, 32493, 32493, 32494, 32494,
-    32494, 32494, 32494, 32494, 32495, 32495, 32495, 32495, 32495, 32495, 32496,
-    32496, 32496, 32496, 32496, 32496, 32497, 32497, 32497, 32497, 32497, 32497,
-    32498, 32498, 32498, 32498, 32498, 32498, 32499, 32499, 32499, 32499, 32499,
-    32499, 32500, 32500, 32500, 32500, 32500, 32500, 32501, 32501, 32501, 32501,
-    32501, 32501, 32502, 32502, 32502, 32502, 32502, 32502, 32503, 32503, 32503,
-    32503, 32503, 32503, 32504, 32504, 32504, 32504, 32504, 32505, 32505, 32505,
-    32505, 32505, 32505, 32506, 32506, 32506, 32506, 32506, 32506, 32507, 32507,
-    32507, 32507, 32507, 32507, 32508, 32508, 32508, 32508, 32508, 32508, 32509,
-    32509, 32509, 32509, 32509, 32509, 32510, 32510, 32510, 32510, 32510, 32510,
-    32511, 32511, 32511, 32511, 32511, 32511, 32512, 32512, 32512, 32512, 32512,
-    32512, 32513, 32513, 32513, 32513, 32513, 32513, 32514, 32514, 32514, 32514,
-    32514, 32514, 32515, 32515, 32515, 32515, 32515, 32515, 32516, 32516, 32516,
-    32516, 32516, 32516, 32517, 32517, 32517, 32517, 32517, 32517, 32518, 32518,
-    32518, 32518, 32518, 32518, 32519, 32519, 32519, 32519, 32519, 32519, 32520,
-    32520, 32520, 32520, 32520, 32520, 32521, 32521, 32521, 32521, 32521, 32521,
-    32522, 32522, 32522, 32522, 32522, 32522, 32523, 32523, 32523, 32523, 32523,
-    32523, 32524, 32524, 32524, 32524, 32524, 32524, 32525, 32525, 32525, 32525,
-    32525, 32525, 32526, 32526, 32526, 32526, 32526, 32526, 32527, 32527, 32527,
-    32527, 32527, 32528, 32528, 32528, 32528, 32528, 32528, 32529, 32529, 32529,
-    32529, 32529, 32529, 32530, 32530, 32530, 32530, 32530, 32530, 32531, 32531,
-    32531, 32531, 32531, 32531, 32532, 32532, 32532, 32532, 32532, 32532, 32533,
-    32533, 32533, 32533, 32533, 32533, 32534, 32534, 32534, 32534, 32534, 32534,
-    32535, 32535, 32535, 32535, 32535, 32535, 32536, 32536, 32536, 32536, 32536,
-    32536, 32537, 32537, 32537, 32537, 32537, 32537, 32538, 32538, 32538, 32538,
-    32538, 32538, 32539, 32539, 32539, 32539, 32539, 32539, 32540, 32540, 32540,
-    32540, 32540, 32540, 32541, 32541, 32541, 32541, 32541, 32541, 32542, 32542,
-    32542, 32542, 32542, 32542, 32543, 32543, 32543, 32543, 32543, 32543, 32544,
-    32544, 32544, 32544, 32544, 32544, 32545, 32545, 32545, 32545, 32545, 32545,
-    32546, 32546, 32546, 32546, 32546, 32546, 32547, 32547, 32547, 32547, 32547,
-    32547, 32548, 32548, 32548, 32548, 32548, 32548, 32549, 32549, 32549, 32549,
-    32549, 32549, 32550, 32550, 32550, 32550, 32550, 32550, 32551, 32551, 32551,
-    32551, 32551, 32551, 32552, 32552, 32552, 32552, 32552, 32552, 32553, 32553,
-    32553, 32553, 32553, 32553, 32554, 32554, 32554, 32554, 32554, 32554, 32555,
-    32555, 32555, 32555, 32555, 32555, 32556, 32556, 32556, 32556, 32556, 32556,
-    32557, 32557, 32557, 32557, 32557, 32557, 32558, 32558, 32558, 32558, 32558,
-    32558, 32559, 32559, 32559, 32559, 32559, 32559, 32560, 32560, 32560, 32560,
-    32560, 32560, 32561, 32561, 32561, 32561, 32561, 32561, 32562, 32562, 32562,
-    32562, 32562, 32562, 32563, 32563, 32563, 32563, 32563, 32563, 32564, 32564,
-    32564, 32564, 32564, 32564, 32565, 32565, 32565, 32565, 32565, 32565, 32566,
-    32566, 32566, 32566, 32566, 32566, 32567, 32567, 32567, 32567, 32567, 32567,
-    32568, 32568, 32568, 32568, 32568, 32568, 32569, 32569, 32569, 32569, 32569,
-    32569, 32570, 32570, 32570, 32570, 32570, 32570, 32571, 32571, 32571, 32571,
-    32571, 32571, 32572, 32572, 32572, 32572, 32572, 32572, 32573, 32573, 32573,
-    32573, 32573, 32573, 32574, 32574, 32574, 32574, 32574, 32574, 32575, 32575,
-    32575, 32575, 32575, 32575, 32576, 32576, 32576, 32576, 32576, 32576, 32577,
-    32577, 32577, 32577, 32577, 32577, 32578, 32578, 32578, 32578, 32578, 32578,
-    32579, 32579, 32579, 32579, 32579, 32579, 32579, 32580, 32580, 32580, 32580,
-    32580, 32580, 32581, 32581, 32581, 32581, 32581, 32581, 32582, 32582, 32582,
-    32582, 32582, 32582, 32583, 32583, 32583, 32583, 32583, 32583, 32584, 32584,
-    32584, 32584, 32584, 32584, 32585, 32585, 32585, 32585, 32585, 32585, 32586,
-    32586, 32586, 32586, 32586, 32586, 32587, 32587, 32587, 32587, 32587, 32587,
-    32588, 32588, 32588, 32588, 32588, 32588, 32589, 32589, 32589, 32589, 32589,
-    32589, 32590, 32590, 32590, 32590, 32590, 32590, 32591, 32591, 32591, 32591,
-    32591, 32591, 32592, 32592, 32592, 32592, 32592, 32592, 32593, 32593, 32593,
-    32593, 32593, 32593, 32594, 32594, 32594, 32594, 32594, 32594, 32595, 32595,
-    32595, 32595, 32595, 32595, 32596, 32596, 32596, 32596, 32596, 32596, 32597,
-    32597, 32597, 32597, 32597, 32597, 32598, 32598, 32598, 32598, 32598, 32598,
-    32599, 32599, 32599, 32599, 32599, 32599, 32600, 32600, 32600, 32600, 32600,
-    32600, 32601, 32601, 32601, 32601, 32601, 32601, 32602, 32602, 32602, 32602,
-    32602, 32602, 32602, 32603, 32603, 32603, 32603, 32603, 32603, 32604, 32604,
-    32604, 32604, 32604, 32604, 32605, 32605, 32605, 32605, 32605, 32605, 32606,
-    32606, 32606, 32606, 32606, 32606, 32607, 32607, 32607, 32607, 32607, 32607,
-    32608, 32608, 32608, 32608, 32608, 32608, 32609, 32609, 32609, 32609, 32609,
-    32609, 32610, 32610, 32610, 32610, 32610, 32610, 32611, 32611, 32611, 32611,
-    32611, 32611, 32612, 32612, 32612, 32612, 32612, 32612, 32613, 32613, 32613,
-    32613, 32613, 32613, 32614, 32614, 32614, 32614, 32614, 32614, 32615, 32615,
-    32615, 32615, 32615, 32615, 32616, 32616, 32616, 32616, 32616, 32616, 32617,
-    32617, 32617, 32617, 32617, 32617, 32617, 32618, 32618, 32618, 32618, 32618,
-    32618, 32619, 32619, 32619, 32619, 32619, 32619, 32620, 32620, 32620, 32620,
-    32620, 32620, 32621, 32621, 32621, 32621, 32621, 32621, 32622, 32622, 32622,
-    32622, 32622, 32622, 32623, 32623, 32623, 32623, 32623, 32623, 32624, 32624,
-    32624, 32624, 32624, 32624, 32625, 32625, 32625, 32625, 32625, 32625, 32626,
-    32626, 32626, 32626, 32626, 32626, 32627, 32627, 32627, 32627, 32627, 32627,
-    32628, 32628, 32628, 32628, 32628, 32628, 32629, 32629, 32629, 32629, 32629,
-    32629, 32630, 32630, 32630, 32630, 32630, 32630, 32630, 32631, 32631, 32631,
-    32631, 32631, 32631, 32632, 32632, 32632, 32632, 32632, 32632, 32633, 32633,
-    32633, 32633, 32633, 32633, 32634, 32634, 32634, 32634, 32634, 32634, 32635,
-    32635, 32635, 32635, 32635, 32635, 32636, 32636, 32636, 32636, 32636, 32636,
-    32637, 32637, 32637, 32637, 32637, 32637, 32638, 32638, 32638, 32638, 32638,
-    32638, 32639, 32639, 32639, 32639, 32639, 32639, 32640, 32640, 32640, 32640,
-    32640, 32640, 32640, 32641, 32641, 32641, 32641, 32641, 32641, 32642, 32642,
-    32642, 32642, 32642, 32642, 32643, 32643, 32643, 32643, 32643, 32643, 32644,
-    32644, 32644, 32644, 32644, 32644, 32645, 32645, 32645, 32645, 32645, 32645,
-    32646, 32646, 32646, 32646, 32646, 32646, 32647, 32647, 32647, 32647, 32647,
-    32647, 32648, 32648, 32648, 32648, 32648, 32648, 32649, 32649, 32649, 32649,
-    32649, 32649, 32650, 32650, 32650, 32650, 32650, 32650, 32650, 32651, 32651,
-    32651, 32651, 32651, 32651, 32652, 32652, 32652, 32652, 32652, 32652, 32653,
-    32653, 32653, 32653, 32653, 32653, 32654, 32654, 32654, 32654, 32654, 32654,
-    32655, 32655, 32655, 32655, 32655, 32655, 32656, 32656, 32656, 32656, 32656,
-    32656, 32657, 32657, 32657, 32657, 32657, 32657, 32658, 32658, 32658, 32658,
-    32658, 32658, 32658, 32659, 32659, 32659, 32659, 32659, 32659, 32660, 32660,
-    32660, 32660, 32660, 32660, 32661, 32661, 32661, 32661, 32661, 32661, 32662,
-    32662, 32662, 32662, 32662, 32662, 32663, 32663, 32663, 32663, 32663, 32663,
-    32664, 32664, 32664, 32664, 32664, 32664, 32665, 32665, 32665, 32665, 32665,
-    32665, 32666, 32666, 32666, 32666, 32666, 32666, 32666, 32667, 32667, 32667,
-    32667, 32667, 32667, 32668, 32668, 32668, 32668, 32668, 32668, 32669, 32669,
-    32669, 32669, 32669, 32669, 32670, 32670, 32670, 32670, 32670, 32670, 32671,
-    32671, 32671, 32671, 32671, 32671, 32672, 32672, 32672, 32672, 32672, 32672,
-    32673, 32673, 32673, 32673, 32673, 32673, 32674, 32674, 32674, 32674, 32674,
-    32674, 32674, 32675, 32675, 32675, 32675, 32675, 32675, 32676, 32676, 32676,
-    32676, 32676, 32676, 32677, 32677, 32677, 32677, 32677, 32677, 32678, 32678,
-    32678, 32678, 32678, 32678, 32679, 32679, 32679, 32679, 32679, 32679, 32680,
-    32680, 32680, 32680, 32680, 32680, 32681, 32681, 32681, 32681, 32681, 32681,
-    32681, 32682, 32682, 32682, 32682, 32682, 32682, 32683, 32683, 32683, 32683,
-    32683, 32683, 32684, 32684, 32684, 32684, 32684, 32684, 32685, 32685, 32685,
-    32685, 32685, 32685, 32686, 32686, 32686, 32686, 32686, 32686, 32687, 32687,
-    32687, 32687, 32687, 32687, 32687, 32688, 32688, 32688, 32688, 32688, 32688,
-    32689, 32689, 32689, 32689, 32689, 32689, 32690, 32690, 32690, 32690, 32690,
-    32690, 32691, 32691, 32691, 32691, 32691, 32691, 32692, 32692, 32692, 32692,
-    32692, 32692, 32693, 32693, 32693, 32693, 32693, 32693, 32694, 32694, 32694,
-    32694, 32694, 32694, 32694, 32695, 32695, 32695, 32695, 32695, 32695, 32696,
-    32696, 32696, 32696, 32696, 32696, 32697, 32697, 32697, 32697, 32697, 32697,
-    32698, 32698, 32698, 32698, 32698, 32698, 32699, 32699, 32699, 32699, 32699,
-    32699, 32700, 32700, 32700, 32700, 32700, 32700, 32700, 32701, 32701, 32701,
-    32701, 32701, 32701, 32702, 32702, 32702, 32702, 32702, 32702, 32703, 32703,
-    32703, 32703, 32703, 32703, 32704, 32704, 32704, 32704, 32704, 32704, 32705,
-    32705, 32705, 32705, 32705, 32705, 32705, 32706, 32706, 32706, 32706, 32706,
-    32706, 32707, 32707, 32707, 32707, 32707, 32707, 32708, 32708, 32708, 32708,
-    32708, 32708, 32709, 32709, 32709, 32709, 32709, 32709, 32710, 32710, 32710,
-    32710, 32710, 32710, 32711, 32711, 32711, 32711, 32711, 32711, 32711, 32712,
-    32712, 32712, 32712, 32712, 32712, 32713, 32713, 32713, 32713, 32713, 32713,
-    32714, 32714, 32714, 32714, 32714, 32714, 32715, 32715, 32715, 32715, 32715,
-    32715, 32716, 32716, 32716, 32716, 32716, 32716, 32716, 32717, 32717, 32717,
-    32717, 32717, 32717, 32718, 32718, 32718, 32718, 32718, 32718, 32719, 32719,
-    32719, 32719, 32719, 32719, 32720, 32720, 32720, 32720, 32720, 32720, 32721,
-    32721, 32721, 32721, 32721, 32721, 32721, 32722, 32722, 32722, 32722, 32722,
-    32722, 32723, 32723, 32723, 32723, 32723, 32723, 32724, 32724, 32724, 32724,
-    32724, 32724, 32725, 32725, 32725, 32725, 32725, 32725, 32726, 32726, 32726,
-    32726, 32726, 32726, 32727, 32727, 32727, 32727, 32727, 32727, 32727, 32728,
-    32728, 32728, 32728, 32728, 32728, 32729, 32729, 32729, 32729, 32729, 32729,
-    32730, 32730, 32730, 32730, 32730, 32730, 32731, 32731, 32731, 32731, 32731,
-    32731, 32731, 32732, 32732, 32732, 32732, 32732, 32732, 32733, 32733, 32733,
-    32733, 32733, 32733, 32734, 32734, 32734, 32734, 32734, 32734, 32735, 32735,
-    32735, 32735, 32735, 32735, 32736, 32736, 32736, 32736, 32736, 32736, 32736,
-    32737, 32737, 32737, 32737, 32737, 32737, 32738, 32738, 32738, 32738, 32738,
-    32738, 32739, 32739, 32739, 32739, 32739, 32739, 32740, 32740, 32740, 32740,
-    32740, 32740, 32741, 32741, 32741, 32741, 32741, 32741, 32741, 32742, 32742,
-    32742, 32742, 32742, 32742, 32743, 32743, 32743, 32743, 32743, 32743, 32744,
-    32744, 32744, 32744, 32744, 32744, 32745, 32745, 32745, 32745, 32745, 32745,
-    32745, 32746, 32746, 32746, 32746, 32746, 32746, 32747, 32747, 32747, 32747,
-    32747, 32747, 32748, 32748, 32748, 32748, 32748, 32748, 32749, 32749, 32749,
-    32749, 32749, 32749, 32750, 32750, 32750, 32750, 32750, 32750, 32750, 32751,
-    32751, 32751, 32751, 32751, 32751, 32752, 32752, 32752, 32752, 32752, 32752,
-    32753, 32753, 32753, 32753, 32753, 32753, 32754, 32754, 32754, 32754, 32754,
-    32754, 32754, 32755, 32755, 32755, 32755, 32755, 32755, 32756, 32756, 32756,
-    32756, 32756, 32756, 32757, 32757, 32757, 32757, 32757, 32757, 32758, 32758,
-    32758, 32758, 32758, 32758, 32758, 32759, 32759, 32759, 32759, 32759, 32759,
-    32760, 32760, 32760, 32760, 32760, 32760, 32761, 32761, 32761, 32761, 32761,
-    32761, 32762, 32762, 32762, 32762, 32762, 32762, 32762, 32763, 32763, 32763,
-    32763, 32763, 32763, 32764, 32764, 32764, 32764, 32764, 32764, 32765, 32765,
-    32765, 32765, 32765, 32765, 32766, 32766, 32766, 32766, 32766, 32766,
+#define SHAPER_RESOLUTION 10
+#define SHAPER_REDUCE 5
+int16_t compress_curve_data[1025] = {
+    0,     2123,  3631,  4802,  5758,  6567,  7268,  7886,  8439,  8940,  9397,
+    9817,  10206, 10568, 10907, 11226, 11526, 11810, 12079, 12335, 12580, 12813,
+    13037, 13251, 13457, 13655, 13846, 14031, 14209, 14381, 14548, 14710, 14866,
+    15019, 15167, 15311, 15451, 15587, 15720, 15850, 15976, 16100, 16221, 16339,
+    16454, 16567, 16678, 16786, 16892, 16996, 17098, 17198, 17297, 17393, 17488,
+    17581, 17672, 17762, 17850, 17937, 18022, 18106, 18189, 18271, 18351, 18430,
+    18508, 18584, 18660, 18734, 18808, 18880, 18952, 19022, 19092, 19161, 19228,
+    19295, 19361, 19427, 19491, 19555, 19618, 19680, 19741, 19802, 19862, 19922,
+    19980, 20038, 20096, 20153, 20209, 20264, 20319, 20374, 20428, 20481, 20534,
+    20586, 20638, 20689, 20740, 20790, 20840, 20889, 20938, 20987, 21035, 21082,
+    21129, 21176, 21222, 21268, 21314, 21359, 21403, 21448, 21492, 21535, 21579,
+    21621, 21664, 21706, 21748, 21790, 21831, 21872, 21912, 21952, 21992, 22032,
+    22071, 22111, 22149, 22188, 22226, 22264, 22302, 22339, 22376, 22413, 22450,
+    22486, 22522, 22558, 22594, 22629, 22664, 22699, 22734, 22768, 22802, 22836,
+    22870, 22904, 22937, 22970, 23003, 23036, 23068, 23101, 23133, 23165, 23197,
+    23228, 23259, 23291, 23322, 23352, 23383, 23414, 23444, 23474, 23504, 23534,
+    23563, 23593, 23622, 23651, 23680, 23709, 23737, 23766, 23794, 23822, 23850,
+    23878, 23906, 23934, 23961, 23988, 24015, 24043, 24069, 24096, 24123, 24149,
+    24176, 24202, 24228, 24254, 24280, 24305, 24331, 24356, 24382, 24407, 24432,
+    24457, 24482, 24506, 24531, 24555, 24580, 24604, 24628, 24652, 24676, 24700,
+    24724, 24747, 24771, 24794, 24818, 24841, 24864, 24887, 24910, 24933, 24955,
+    24978, 25000, 25023, 25045, 25067, 25089, 25112, 25133, 25155, 25177, 25199,
+    25220, 25242, 25263, 25284, 25306, 25327, 25348, 25369, 25390, 25411, 25431,
+    25452, 25473, 25493, 25513, 25534, 25554, 25574, 25594, 25614, 25634, 25654,
+    25674, 25694, 25713, 25733, 25752, 25772, 25791, 25810, 25830, 25849, 25868,
+    25887, 25906, 25925, 25943, 25962, 25981, 25999, 26018, 26036, 26055, 26073,
+    26091, 26110, 26128, 26146, 26164, 26182, 26200, 26218, 26235, 26253, 26271,
+    26288, 26306, 26323, 26341, 26358, 26375, 26393, 26410, 26427, 26444, 26461,
+    26478, 26495, 26512, 26529, 26545, 26562, 26579, 26595, 26612, 26628, 26645,
+    26661, 26678, 26694, 26710, 26726, 26743, 26759, 26775, 26791, 26807, 26823,
+    26838, 26854, 26870, 26886, 26901, 26917, 26932, 26948, 26963, 26979, 26994,
+    27010, 27025, 27040, 27055, 27071, 27086, 27101, 27116, 27131, 27146, 27161,
+    27175, 27190, 27205, 27220, 27235, 27249, 27264, 27278, 27293, 27307, 27322,
+    27336, 27351, 27365, 27379, 27394, 27408, 27422, 27436, 27450, 27464, 27478,
+    27492, 27506, 27520, 27534, 27548, 27562, 27575, 27589, 27603, 27617, 27630,
+    27644, 27657, 27671, 27684, 27698, 27711, 27725, 27738, 27751, 27765, 27778,
+    27791, 27804, 27817, 27830, 27844, 27857, 27870, 27883, 27896, 27908, 27921,
+    27934, 27947, 27960, 27973, 27985, 27998, 28011, 28023, 28036, 28049, 28061,
+    28074, 28086, 28099, 28111, 28123, 28136, 28148, 28161, 28173, 28185, 28197,
+    28210, 28222, 28234, 28246, 28258, 28270, 28282, 28294, 28306, 28318, 28330,
+    28342, 28354, 28366, 28377, 28389, 28401, 28413, 28424, 28436, 28448, 28459,
+    28471, 28483, 28494, 28506, 28517, 28529, 28540, 28552, 28563, 28574, 28586,
+    28597, 28608, 28620, 28631, 28642, 28653, 28665, 28676, 28687, 28698, 28709,
+    28720, 28731, 28742, 28753, 28764, 28775, 28786, 28797, 28808, 28819, 28830,
+    28841, 28851, 28862, 28873, 28884, 28894, 28905, 28916, 28926, 28937, 28948,
+    28958, 28969, 28979, 28990, 29000, 29011, 29021, 29032, 29042, 29052, 29063,
+    29073, 29083, 29094, 29104, 29114, 29125, 29135, 29145, 29155, 29165, 29176,
+    29186, 29196, 29206, 29216, 29226, 29236, 29246, 29256, 29266, 29276, 29286,
+    29296, 29306, 29316, 29326, 29335, 29345, 29355, 29365, 29375, 29384, 29394,
+    29404, 29414, 29423, 29433, 29443, 29452, 29462, 29471, 29481, 29491, 29500,
+    29510, 29519, 29529, 29538, 29548, 29557, 29566, 29576, 29585, 29595, 29604,
+    29613, 29623, 29632, 29641, 29650, 29660, 29669, 29678, 29687, 29697, 29706,
+    29715, 29724, 29733, 29742, 29751, 29761, 29770, 29779, 29788, 29797, 29806,
+    29815, 29824, 29833, 29842, 29850, 29859, 29868, 29877, 29886, 29895, 29904,
+    29913, 29921, 29930, 29939, 29948, 29956, 29965, 29974, 29983, 29991, 30000,
+    30009, 30017, 30026, 30035, 30043, 30052, 30060, 30069, 30077, 30086, 30094,
+    30103, 30111, 30120, 30128, 30137, 30145, 30154, 30162, 30171, 30179, 30187,
+    30196, 30204, 30212, 30221, 30229, 30237, 30246, 30254, 30262, 30270, 30279,
+    30287, 30295, 30303, 30311, 30320, 30328, 30336, 30344, 30352, 30360, 30368,
+    30376, 30384, 30392, 30400, 30409, 30417, 30425, 30433, 30441, 30448, 30456,
+    30464, 30472, 30480, 30488, 30496, 30504, 30512, 30520, 30527, 30535, 30543,
+    30551, 30559, 30567, 30574, 30582, 30590, 30598, 30605, 30613, 30621, 30628,
+    30636, 30644, 30651, 30659, 30667, 30674, 30682, 30690, 30697, 30705, 30712,
+    30720, 30728, 30735, 30743, 30750, 30758, 30765, 30773, 30780, 30788, 30795,
+    30802, 30810, 30817, 30825, 30832, 30840, 30847, 30854, 30862, 30869, 30876,
+    30884, 30891, 30898, 30906, 30913, 30920, 30927, 30935, 30942, 30949, 30956,
+    30964, 30971, 30978, 30985, 30992, 31000, 31007, 31014, 31021, 31028, 31035,
+    31042, 31050, 31057, 31064, 31071, 31078, 31085, 31092, 31099, 31106, 31113,
+    31120, 31127, 31134, 31141, 31148, 31155, 31162, 31169, 31176, 31183, 31190,
+    31197, 31204, 31210, 31217, 31224, 31231, 31238, 31245, 31252, 31258, 31265,
+    31272, 31279, 31286, 31292, 31299, 31306, 31313, 31319, 31326, 31333, 31340,
+    31346, 31353, 31360, 31366, 31373, 31380, 31386, 31393, 31400, 31406, 31413,
+    31420, 31426, 31433, 31439, 31446, 31453, 31459, 31466, 31472, 31479, 31485,
+    31492, 31498, 31505, 31511, 31518, 31524, 31531, 31537, 31544, 31550, 31557,
+    31563, 31570, 31576, 31583, 31589, 31595, 31602, 31608, 31615, 31621, 31627,
+    31634, 31640, 31646, 31653, 31659, 31665, 31672, 31678, 31684, 31690, 31697,
+    31703, 31709, 31716, 31722, 31728, 31734, 31741, 31747, 31753, 31759, 31765,
+    31772, 31778, 31784, 31790, 31796, 31802, 31809, 31815, 31821, 31827, 31833,
+    31839, 31845, 31851, 31857, 31864, 31870, 31876, 31882, 31888, 31894, 31900,
+    31906, 31912, 31918, 31924, 31930, 31936, 31942, 31948, 31954, 31960, 31966,
+    31972, 31978, 31984, 31990, 31996, 32002, 32008, 32013, 32019, 32025, 32031,
+    32037, 32043, 32049, 32055, 32061, 32066, 32072, 32078, 32084, 32090, 32096,
+    32101, 32107, 32113, 32119, 32125, 32130, 32136, 32142, 32148, 32153, 32159,
+    32165, 32171, 32176, 32182, 32188, 32194, 32199, 32205, 32211, 32216, 32222,
+    32228, 32233, 32239, 32245, 32250, 32256, 32262, 32267, 32273, 32279, 32284,
+    32290, 32295, 32301, 32307, 32312, 32318, 32323, 32329, 32334, 32340, 32346,
+    32351, 32357, 32362, 32368, 32373, 32379, 32384, 32390, 32395, 32401, 32406,
+    32412, 32417, 32423, 32428, 32434, 32439, 32444, 32450, 32455, 32461, 32466,
+    32472, 32477, 32482, 32488, 32493, 32499, 32504, 32509, 32515, 32520, 32525,
+    32531, 32536, 32542, 32547, 32552, 32558, 32563, 32568, 32574, 32579, 32584,
+    32589, 32595, 32600, 32605, 32611, 32616, 32621, 32626, 32632, 32637, 32642,
+    32647, 32653, 32658, 32663, 32668, 32674, 32679, 32684, 32689, 32694, 32700,
+    32705, 32710, 32715, 32720, 32725, 32731, 32736, 32741, 32746, 32751, 32756,
+    32761, 32767,
 };
-const int16_t __in_flash() expand_curve_data[32768] = {
-    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-    0,     0,     0,     0,     0,     1,     1,     1,     1,     1,     1,
-    1,     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-    1,     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-    1,     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-    1,     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-    1,     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-    1,     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-    1,     1,     1,     1,     1,     1,     1,     1,     2,     2,     2,
-    2,     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-    2,     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-    2,     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-    2,     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-    2,     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-    2,     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-    2,     2,     2,     2,     2,     2,     2,     2,     2,     3,     3,
-    3,     3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-    3,     3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-    3,     3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-    3,     3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-    3,     3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-    3,     3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-    3,     3,     3,     3,     3,     3,     3,     3,     3,     3,     4,
-    4,     4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-    4,     4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-    4,     4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-    4,     4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-    4,     4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-    4,     4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-    4,     4,     4,     4,     4,     4,     4,     4,     4,     5,     5,
-    5,     5,     5,     5,     5,     5,     5,     5,     5,     5,     5,
-    5,     5,     5,     5,     5,     5,     5,     5,     5,     5,     5,
-    5,     5,     5,     5,     5,     5,     5,     5,     5,     5,     5,
-    5,     5,     5,     5,     5,     5,     5,     5,     5,     5,     5,
-    5,     5,     5,     5,     5,     5,     5,     5,     5,     5,     5,
-    5,     5,     5,     5,     5,     5,     5,     5,     5,     5,     5,
-    5,     5,     5,     5,     5,     5,     5,     5,     6,     6,     6,
-    6,     6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-    6,     6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-    6,     6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-    6,     6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-    6,     6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-    6,     6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-    6,     6,     6,     6,     6,     7,     7,     7,     7,     7,     7,
-    7,     7,     7,     7,     7,     7,     7,     7,     7,     7,     7,
-    7,     7,     7,     7,     7,     7,     7,     7,     7,     7,     7,
-    7,     7,     7,     7,     7,     7,     7,     7,     7,     7,     7,
-    7,     7,     7,     7,     7,     7,     7,     7,     7,     7,     7,
-    7,     7,     7,     7,     7,     7,     7,     7,     7,     7,     7,
-    7,     7,     7,     7,     7,     7,     7,     7,     7,     7,     7,
-    7,     8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
-    8,     8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
-    8,     8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
-    8,     8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
-    8,     8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
-    8,     8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
-    8,     8,     8,     8,     8,     8,     8,     9,     9,     9,     9,
-    9,     9,     9,     9,     9,     9,     9,     9,     9,     9,     9,
-    9,     9,     9,     9,     9,     9,     9,     9,     9,     9,     9,
-    9,     9,     9,     9,     9,     9,     9,     9,     9,     9,     9,
-    9,     9,     9,     9,     9,     9,     9,     9,     9,     9,     9,
-    9,     9,     9,     9,     9,     9,     9,     9,     9,     9,     9,
-    9,     9,     9,     9,     9,     9,     9,     9,     9,     9,     9,
-    9,     9,     10,    10,    10,    10,    10,    10,    10,    10,    10,
-    10,    10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-    10,    10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-    10,    10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-    10,    10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-    10,    10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-    10,    10,    10,    10,    10,    10,    11,    11,    11,    11,    11,
-    11,    11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
-    11,    11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
-    11,    11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
-    11,    11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
-    11,    11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
-    11,    11,    11,    11,    11,    11,    11,    11,    11,    12,    12,
-    12,    12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
-    12,    12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
-    12,    12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
-    12,    12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
-    12,    12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
-    12,    12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
-    12,    13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
-    13,    13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
-    13,    13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
-    13,    13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
-    13,    13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
-    13,    13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
-    13,    13,    14,    14,    14,    14,    14,    14,    14,    14,    14,
-    14,    14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
-    14,    14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
-    14,    14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
-    14,    14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
-    14,    14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
-    14,    14,    14,    15,    15,    15,    15,    15,    15,    15,    15,
-    15,    15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
-    15,    15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
-    15,    15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
-    15,    15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
-    15,    15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
-    15,    15,    15,    16,    16,    16,    16,    16,    16,    16,    16,
-    16,    16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
-    16,    16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
-    16,    16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
-    16,    16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
-    16,    16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
-    16,    16,    17,    17,    17,    17,    17,    17,    17,    17,    17,
-    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,
-    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,
-    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,
-    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,
-    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,
-    18,    18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
-    18,    18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
-    18,    18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
-    18,    18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
-    18,    18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
-    18,    18,    18,    18,    18,    18,    18,    18,    18,    19,    19,
-    19,    19,    19,    19,    19,    19,    19,    19,    19,    19,    19,
-    19,    19,    19,    19,    19,    19,    19,    19,    19,    19,    19,
-    19,    19,    19,    19,    19,    19,    19,    19,    19,    19,    19,
-    19,    19,    19,    19,    19,    19,    19,    19,    19,    19,    19,
-    19,    19,    19,    19,    19,    19,    19,    19,    19,    19,    19,
-    19,    19,    19,    19,    19,    20,    20,    20,    20,    20,    20,
-    20,    20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
-    20,    20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
-    20,    20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
-    20,    20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
-    20,    20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
-    20,    21,    21,    21,    21,    21,    21,    21,    21,    21,    21,
-    21,    21,    21,    21,    21,    21,    21,    21,    21,    21,    21,
-    21,    21,    21,    21,    21,    21,    21,    21,    21,    21,    21,
-    21,    21,    21,    21,    21,    21,    21,    21,    21,    21,    21,
-    21,    21,    21,    21,    21,    21,    21,    21,    21,    21,    21,
-    21,    21,    21,    21,    21,    21,    21,    21,    22,    22,    22,
-    22,    22,    22,    22,    22,    22,    22,    22,    22,    22,    22,
-    22,    22,    22,    22,    22,    22,    22,    22,    22,    22,    22,
-    22,    22,    22,    22,    22,    22,    22,    22,    22,    22,    22,
-    22,    22,    22,    22,    22,    22,    22,    22,    22,    22,    22,
-    22,    22,    22,    22,    22,    22,    22,    22,    22,    22,    22,
-    22,    22,    23,    23,    23,    23,    23,    23,    23,    23,    23,
-    23,    23,    23,    23,    23,    23,    23,    23,    23,    23,    23,
-    23,    23,    23,    23,    23,    23,    23,    23,    23,    23,    23,
-    23,    23,    23,    23,    23,    23,    23,    23,    23,    23,    23,
-    23,    23,    23,    23,    23,    23,    23,    23,    23,    23,    23,
-    23,    23,    23,    23,    23,    23,    23,    24,    24,    24,    24,
-    24,    24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
-    24,    24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
-    24,    24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
-    24,    24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
-    24,    24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
-    25,    25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
-    25,    25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
-    25,    25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
-    25,    25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
-    25,    25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
-    25,    25,    25,    25,    26,    26,    26,    26,    26,    26,    26,
-    26,    26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
-    26,    26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
-    26,    26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
-    26,    26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
-    26,    26,    26,    26,    26,    26,    26,    27,    27,    27,    27,
-    27,    27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
-    27,    27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
-    27,    27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
-    27,    27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
-    27,    27,    27,    27,    27,    27,    27,    27,    27,    28,    28,
-    28,    28,    28,    28,    28,    28,    28,    28,    28,    28,    28,
-    28,    28,    28,    28,    28,    28,    28,    28,    28,    28,    28,
-    28,    28,    28,    28,    28,    28,    28,    28,    28,    28,    28,
-    28,    28,    28,    28,    28,    28,    28,    28,    28,    28,    28,
-    28,    28,    28,    28,    28,    28,    28,    28,    28,    28,    28,
-    29,    29,    29,    29,    29,    29,    29,    29,    29,    29,    29,
-    29,    29,    29,    29,    29,    29,    29,    29,    29,    29,    29,
-    29,    29,    29,    29,    29,    29,    29,    29,    29,    29,    29,
-    29,    29,    29,    29,    29,    29,    29,    29,    29,    29,    29,
-    29,    29,    29,    29,    29,    29,    29,    29,    29,    29,    29,
-    29,    30,    30,    30,    30,    30,    30,    30,    30,    30,    30,
-    30,    30,    30,    30,    30,    30,    30,    30,    30,    30,    30,
-    30,    30,    30,    30,    30,    30,    30,    30,    30,    30,    30,
-    30,    30,    30,    30,    30,    30,    30,    30,    30,    30,    30,
-    30,    30,    30,    30,    30,    30,    30,    30,    30,    30,    30,
-    30,    31,    31,    31,    31,    31,    31,    31,    31,    31,    31,
-    31,    31,    31,    31,    31,    31,    31,    31,    31,    31,    31,
-    31,    31,    31,    31,    31,    31,    31,    31,    31,    31,    31,
-    31,    31,    31,    31,    31,    31,    31,    31,    31,    31,    31,
-    31,    31,    31,    31,    31,    31,    31,    31,    31,    31,    31,
-    31,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
-    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
-    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
-    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
-    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,    32,
-    33,    33,    33,    33,    33,    33,    33,    33,    33,    33,    33,
-    33,    33,    33,    33,    33,    33,    33,    33,    33,    33,    33,
-    33,    33,    33,    33,    33,    33,    33,    33,    33,    33,    33,
-    33,    33,    33,    33,    33,    33,    33,    33,    33,    33,    33,
-    33,    33,    33,    33,    33,    33,    33,    33,    33,    33,    34,
-    34,    34,    34,    34,    34,    34,    34,    34,    34,    34,    34,
-    34,    34,    34,    34,    34,    34,    34,    34,    34,    34,    34,
-    34,    34,    34,    34,    34,    34,    34,    34,    34,    34,    34,
-    34,    34,    34,    34,    34,    34,    34,    34,    34,    34,    34,
-    34,    34,    34,    34,    34,    34,    34,    34,    35,    35,    35,
-    35,    35,    35,    35,    35,    35,    35,    35,    35,    35,    35,
-    35,    35,    35,    35,    35,    35,    35,    35,    35,    35,    35,
-    35,    35,    35,    35,    35,    35,    35,    35,    35,    35,    35,
-    35,    35,    35,    35,    35,    35,    35,    35,    35,    35,    35,
-    35,    35,    35,    35,    35,    35,    36,    36,    36,    36,    36,
-    36,    36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
-    36,    36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
-    36,    36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
-    36,    36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
-    36,    36,    36,    37,    37,    37,    37,    37,    37,    37,    37,
-    37,    37,    37,    37,    37,    37,    37,    37,    37,    37,    37,
-    37,    37,    37,    37,    37,    37,    37,    37,    37,    37,    37,
-    37,    37,    37,    37,    37,    37,    37,    37,    37,    37,    37,
-    37,    37,    37,    37,    37,    37,    37,    37,    37,    37,    37,
-    38,    38,    38,    38,    38,    38,    38,    38,    38,    38,    38,
-    38,    38,    38,    38,    38,    38,    38,    38,    38,    38,    38,
-    38,    38,    38,    38,    38,    38,    38,    38,    38,    38,    38,
-    38,    38,    38,    38,    38,    38,    38,    38,    38,    38,    38,
-    38,    38,    38,    38,    38,    38,    38,    39,    39,    39,    39,
-    39,    39,    39,    39,    39,    39,    39,    39,    39,    39,    39,
-    39,    39,    39,    39,    39,    39,    39,    39,    39,    39,    39,
-    39,    39,    39,    39,    39,    39,    39,    39,    39,    39,    39,
-    39,    39,    39,    39,    39,    39,    39,    39,    39,    39,    39,
-    39,    39,    39,    40,    40,    40,    40,    40,    40,    40,    40,
-    40,    40,    40,    40,    40,    40,    40,    40,    40,    40,    40,
-    40,    40,    40,    40,    40,    40,    40,    40,    40,    40,    40,
-    40,    40,    40,    40,    40,    40,    40,    40,    40,    40,    40,
-    40,    40,    40,    40,    40,    40,    40,    40,    40,    41,    41,
-    41,    41,    41,    41,    41,    41,    41,    41,    41,    41,    41,
-    41,    41,    41,    41,    41,    41,    41,    41,    41,    41,    41,
-    41,    41,    41,    41,    41,    41,    41,    41,    41,    41,    41,
-    41,    41,    41,    41,    41,    41,    41,    41,    41,    41,    41,
-    41,    41,    41,    41,    42,    42,    42,    42,    42,    42,    42,
-    42,    42,    42,    42,    42,    42,    42,    42,    42,    42,    42,
-    42,    42,    42,    42,    42,    42,    42,    42,    42,    42,    42,
-    42,    42,    42,    42,    42,    42,    42,    42,    42,    42,    42,
-    42,    42,    42,    42,    42,    42,    42,    42,    42,    43,    43,
-    43,    43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-    43,    43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-    43,    43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-    43,    43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-    43,    43,    43,    44,    44,    44,    44,    44,    44,    44,    44,
-    44,    44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
-    44,    44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
-    44,    44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
-    44,    44,    44,    44,    44,    44,    44,    45,    45,    45,    45,
-    45,    45,    45,    45,    45,    45,    45,    45,    45,    45,    45,
-    45,    45,    45,    45,    45,    45,    45,    45,    45,    45,    45,
-    45,    45,    45,    45,    45,    45,    45,    45,    45,    45,    45,
-    45,    45,    45,    45,    45,    45,    45,    45,    45,    45,    45,
-    46,    46,    46,    46,    46,    46,    46,    46,    46,    46,    46,
-    46,    46,    46,    46,    46,    46,    46,    46,    46,    46,    46,
-    46,    46,    46,    46,    46,    46,    46,    46,    46,    46,    46,
-    46,    46,    46,    46,    46,    46,    46,    46,    46,    46,    46,
-    46,    46,    46,    47,    47,    47,    47,    47,    47,    47,    47,
-    47,    47,    47,    47,    47,    47,    47,    47,    47,    47,    47,
-    47,    47,    47,    47,    47,    47,    47,    47,    47,    47,    47,
-    47,    47,    47,    47,    47,    47,    47,    47,    47,    47,    47,
-    47,    47,    47,    47,    47,    47,    48,    48,    48,    48,    48,
-    48,    48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
-    48,    48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
-    48,    48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
-    48,    48,    48,    48,    48,    48,    48,    48,    48,    49,    49,
-    49,    49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
-    49,    49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
-    49,    49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
-    49,    49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
-    50,    50,    50,    50,    50,    50,    50,    50,    50,    50,    50,
-    50,    50,    50,    50,    50,    50,    50,    50,    50,    50,    50,
-    50,    50,    50,    50,    50,    50,    50,    50,    50,    50,    50,
-    50,    50,    50,    50,    50,    50,    50,    50,    50,    50,    50,
-    50,    50,    51,    51,    51,    51,    51,    51,    51,    51,    51,
-    51,    51,    51,    51,    51,    51,    51,    51,    51,    51,    51,
-    51,    51,    51,    51,    51,    51,    51,    51,    51,    51,    51,
-    51,    51,    51,    51,    51,    51,    51,    51,    51,    51,    51,
-    51,    51,    51,    52,    52,    52,    52,    52,    52,    52,    52,
-    52,    52,    52,    52,    52,    52,    52,    52,    52,    52,    52,
-    52,    52,    52,    52,    52,    52,    52,    52,    52,    52,    52,
-    52,    52,    52,    52,    52,    52,    52,    52,    52,    52,    52,
-    52,    52,    52,    52,    53,    53,    53,    53,    53,    53,    53,
-    53,    53,    53,    53,    53,    53,    53,    53,    53,    53,    53,
-    53,    53,    53,    53,    53,    53,    53,    53,    53,    53,    53,
-    53,    53,    53,    53,    53,    53,    53,    53,    53,    53,    53,
-    53,    53,    53,    53,    53,    54,    54,    54,    54,    54,    54,
-    54,    54,    54,    54,    54,    54,    54,    54,    54,    54,    54,
-    54,    54,    54,    54,    54,    54,    54,    54,    54,    54,    54,
-    54,    54,    54,    54,    54,    54,    54,    54,    54,    54,    54,
-    54,    54,    54,    54,    54,    55,    55,    55,    55,    55,    55,
-    55,    55,    55,    55,    55,    55,    55,    55,    55,    55,    55,
-    55,    55,    55,    55,    55,    55,    55,    55,    55,    55,    55,
-    55,    55,    55,    55,    55,    55,    55,    55,    55,    55,    55,
-    55,    55,    55,    55,    55,    56,    56,    56,    56,    56,    56,
-    56,    56,    56,    56,    56,    56,    56,    56,    56,    56,    56,
-    56,    56,    56,    56,    56,    56,    56,    56,    56,    56,    56,
-    56,    56,    56,    56,    56,    56,    56,    56,    56,    56,    56,
-    56,    56,    56,    56,    57,    57,    57,    57,    57,    57,    57,
-    57,    57,    57,    57,    57,    57,    57,    57,    57,    57,    57,
-    57,    57,    57,    57,    57,    57,    57,    57,    57,    57,    57,
-    57,    57,    57,    57,    57,    57,    57,    57,    57,    57,    57,
-    57,    57,    57,    57,    58,    58,    58,    58,    58,    58,    58,
-    58,    58,    58,    58,    58,    58,    58,    58,    58,    58,    58,
-    58,    58,    58,    58,    58,    58,    58,    58,    58,    58,    58,
-    58,    58,    58,    58,    58,    58,    58,    58,    58,    58,    58,
-    58,    58,    59,    59,    59,    59,    59,    59,    59,    59,    59,
-    59,    59,    59,    59,    59,    59,    59,    59,    59,    59,    59,
-    59,    59,    59,    59,    59,    59,    59,    59,    59,    59,    59,
-    59,    59,    59,    59,    59,    59,    59,    59,    59,    59,    59,
-    59,    60,    60,    60,    60,    60,    60,    60,    60,    60,    60,
-    60,    60,    60,    60,    60,    60,    60,    60,    60,    60,    60,
-    60,    60,    60,    60,    60,    60,    60,    60,    60,    60,    60,
-    60,    60,    60,    60,    60,    60,    60,    60,    60,    60,    61,
-    61,    61,    61,    61,    61,    61,    61,    61,    61,    61,    61,
-    61,    61,    61,    61,    61,    61,    61,    61,    61,    61,    61,
-    61,    61,    61,    61,    61,    61,    61,    61,    61,    61,    61,
-    61,    61,    61,    61,    61,    61,    61,    61,    62,    62,    62,
-    62,    62,    62,    62,    62,    62,    62,    62,    62,    62,    62,
-    62,    62,    62,    62,    62,    62,    62,    62,    62,    62,    62,
-    62,    62,    62,    62,    62,    62,    62,    62,    62,    62,    62,
-    62,    62,    62,    62,    62,    63,    63,    63,    63,    63,    63,
-    63,    63,    63,    63,    63,    63,    63,    63,    63,    63,    63,
-    63,    63,    63,    63,    63,    63,    63,    63,    63,    63,    63,
-    63,    63,    63,    63,    63,    63,    63,    63,    63,    63,    63,
-    63,    63,    64,    64,    64,    64,    64,    64,    64,    64,    64,
-    64,    64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
-    64,    64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
-    64,    64,    64,    64,    64,    64,    64,    64,    64,    64,    65,
-    65,    65,    65,    65,    65,    65,    65,    65,    65,    65,    65,
-    65,    65,    65,    65,    65,    65,    65,    65,    65,    65,    65,
-    65,    65,    65,    65,    65,    65,    65,    65,    65,    65,    65,
-    65,    65,    65,    65,    65,    65,    65,    66,    66,    66,    66,
-    66,    66,    66,    66,    66,    66,    66,    66,    66,    66,    66,
-    66,    66,    66,    66,    66,    66,    66,    66,    66,    66,    66,
-    66,    66,    66,    66,    66,    66,    66,    66,    66,    66,    66,
-    66,    66,    66,    67,    67,    67,    67,    67,    67,    67,    67,
-    67,    67,    67,    67,    67,    67,    67,    67,    67,    67,    67,
-    67,    67,    67,    67,    67,    67,    67,    67,    67,    67,    67,
-    67,    67,    67,    67,    67,    67,    67,    67,    67,    67,    68,
-    68,    68,    68,    68,    68,    68,    68,    68,    68,    68,    68,
-    68,    68,    68,    68,    68,    68,    68,    68,    68,    68,    68,
-    68,    68,    68,    68,    68,    68,    68,    68,    68,    68,    68,
-    68,    68,    68,    68,    68,    69,    69,    69,    69,    69,    69,
-    69,    69,    69,    69,    69,    69,    69,    69,    69,    69,    69,
-    69,    69,    69,    69,    69,    69,    69,    69,    69,    69,    69,
-    69,    69,    69,    69,    69,    69,    69,    69,    69,    69,    69,
-    69,    70,    70,    70,    70,    70,    70,    70,    70,    70,    70,
-    70,    70,    70,    70,    70,    70,    70,    70,    70,    70,    70,
-    70,    70,    70,    70,    70,    70,    70,    70,    70,    70,    70,
-    70,    70,    70,    70,    70,    70,    70,    71,    71,    71,    71,
-    71,    71,    71,    71,    71,    71,    71,    71,    71,    71,    71,
-    71,    71,    71,    71,    71,    71,    71,    71,    71,    71,    71,
-    71,    71,    71,    71,    71,    71,    71,    71,    71,    71,    71,
-    71,    72,    72,    72,    72,    72,    72,    72,    72,    72,    72,
-    72,    72,    72,    72,    72,    72,    72,    72,    72,    72,    72,
-    72,    72,    72,    72,    72,    72,    72,    72,    72,    72,    72,
-    72,    72,    72,    72,    72,    72,    72,    73,    73,    73,    73,
-    73,    73,    73,    73,    73,    73,    73,    73,    73,    73,    73,
-    73,    73,    73,    73,    73,    73,    73,    73,    73,    73,    73,
-    73,    73,    73,    73,    73,    73,    73,    73,    73,    73,    73,
-    73,    74,    74,    74,    74,    74,    74,    74,    74,    74,    74,
-    74,    74,    74,    74,    74,    74,    74,    74,    74,    74,    74,
-    74,    74,    74,    74,    74,    74,    74,    74,    74,    74,    74,
-    74,    74,    74,    74,    74,    74,    75,    75,    75,    75,    75,
-    75,    75,    75,    75,    75,    75,    75,    75,    75,    75,    75,
-    75,    75,    75,    75,    75,    75,    75,    75,    75,    75,    75,
-    75,    75,    75,    75,    75,    75,    75,    75,    75,    75,    76,
-    76,    76,    76,    76,    76,    76,    76,    76,    76,    76,    76,
-    76,    76,    76,    76,    76,    76,    76,    76,    76,    76,    76,
-    76,    76,    76,    76,    76,    76,    76,    76,    76,    76,    76,
-    76,    76,    76,    76,    77,    77,    77,    77,    77,    77,    77,
-    77,    77,    77,    77,    77,    77,    77,    77,    77,    77,    77,
-    77,    77,    77,    77,    77,    77,    77,    77,    77,    77,    77,
-    77,    77,    77,    77,    77,    77,    77,    77,    78,    78,    78,
-    78,    78,    78,    78,    78,    78,    78,    78,    78,    78,    78,
-    78,    78,    78,    78,    78,    78,    78,    78,    78,    78,    78,
-    78,    78,    78,    78,    78,    78,    78,    78,    78,    78,    78,
-    78,    79,    79,    79,    79,    79,    79,    79,    79,    79,    79,
-    79,    79,    79,    79,    79,    79,    79,    79,    79,    79,    79,
-    79,    79,    79,    79,    79,    79,    79,    79,    79,    79,    79,
-    79,    79,    79,    79,    80,    80,    80,    80,    80,    80,    80,
-    80,    80,    80,    80,    80,    80,    80,    80,    80,    80,    80,
-    80,    80,    80,    80,    80,    80,    80,    80,    80,    80,    80,
-    80,    80,    80,    80,    80,    80,    80,    81,    81,    81,    81,
-    81,    81,    81,    81,    81,    81,    81,    81,    81,    81,    81,
-    81,    81,    81,    81,    81,    81,    81,    81,    81,    81,    81,
-    81,    81,    81,    81,    81,    81,    81,    81,    81,    81,    82,
-    82,    82,    82,    82,    82,    82,    82,    82,    82,    82,    82,
-    82,    82,    82,    82,    82,    82,    82,    82,    82,    82,    82,
-    82,    82,    82,    82,    82,    82,    82,    82,    82,    82,    82,
-    82,    82,    83,    83,    83,    83,    83,    83,    83,    83,    83,
-    83,    83,    83,    83,    83,    83,    83,    83,    83,    83,    83,
-    83,    83,    83,    83,    83,    83,    83,    83,    83,    83,    83,
-    83,    83,    83,    83,    83,    84,    84,    84,    84,    84,    84,
-    84,    84,    84,    84,    84,    84,    84,    84,    84,    84,    84,
-    84,    84,    84,    84,    84,    84,    84,    84,    84,    84,    84,
-    84,    84,    84,    84,    84,    84,    84,    85,    85,    85,    85,
-    85,    85,    85,    85,    85,    85,    85,    85,    85,    85,    85,
-    85,    85,    85,    85,    85,    85,    85,    85,    85,    85,    85,
-    85,    85,    85,    85,    85,    85,    85,    85,    85,    86,    86,
-    86,    86,    86,    86,    86,    86,    86,    86,    86,    86,    86,
-    86,    86,    86,    86,    86,    86,    86,    86,    86,    86,    86,
-    86,    86,    86,    86,    86,    86,    86,    86,    86,    86,    86,
-    87,    87,    87,    87,    87,    87,    87,    87,    87,    87,    87,
-    87,    87,    87,    87,    87,    87,    87,    87,    87,    87,    87,
-    87,    87,    87,    87,    87,    87,    87,    87,    87,    87,    87,
-    87,    87,    88,    88,    88,    88,    88,    88,    88,    88,    88,
-    88,    88,    88,    88,    88,    88,    88,    88,    88,    88,    88,
-    88,    88,    88,    88,    88,    88,    88,    88,    88,    88,    88,
-    88,    88,    88,    89,    89,    89,    89,    89,    89,    89,    89,
-    89,    89,    89,    89,    89,    89,    89,    89,    89,    89,    89,
-    89,    89,    89,    89,    89,    89,    89,    89,    89,    89,    89,
-    89,    89,    89,    89,    90,    90,    90,    90,    90,    90,    90,
-    90,    90,    90,    90,    90,    90,    90,    90,    90,    90,    90,
-    90,    90,    90,    90,    90,    90,    90,    90,    90,    90,    90,
-    90,    90,    90,    90,    90,    91,    91,    91,    91,    91,    91,
-    91,    91,    91,    91,    91,    91,    91,    91,    91,    91,    91,
-    91,    91,    91,    91,    91,    91,    91,    91,    91,    91,    91,
-    91,    91,    91,    91,    91,    91,    92,    92,    92,    92,    92,
-    92,    92,    92,    92,    92,    92,    92,    92,    92,    92,    92,
-    92,    92,    92,    92,    92,    92,    92,    92,    92,    92,    92,
-    92,    92,    92,    92,    92,    92,    93,    93,    93,    93,    93,
-    93,    93,    93,    93,    93,    93,    93,    93,    93,    93,    93,
-    93,    93,    93,    93,    93,    93,    93,    93,    93,    93,    93,
-    93,    93,    93,    93,    93,    93,    93,    94,    94,    94,    94,
-    94,    94,    94,    94,    94,    94,    94,    94,    94,    94,    94,
-    94,    94,    94,    94,    94,    94,    94,    94,    94,    94,    94,
-    94,    94,    94,    94,    94,    94,    94,    95,    95,    95,    95,
-    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,
-    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,
-    95,    95,    95,    95,    95,    95,    95,    96,    96,    96,    96,
-    96,    96,    96,    96,    96,    96,    96,    96,    96,    96,    96,
-    96,    96,    96,    96,    96,    96,    96,    96,    96,    96,    96,
-    96,    96,    96,    96,    96,    96,    97,    97,    97,    97,    97,
-    97,    97,    97,    97,    97,    97,    97,    97,    97,    97,    97,
-    97,    97,    97,    97,    97,    97,    97,    97,    97,    97,    97,
-    97,    97,    97,    97,    97,    97,    98,    98,    98,    98,    98,
-    98,    98,    98,    98,    98,    98,    98,    98,    98,    98,    98,
-    98,    98,    98,    98,    98,    98,    98,    98,    98,    98,    98,
-    98,    98,    98,    98,    98,    99,    99,    99,    99,    99,    99,
-    99,    99,    99,    99,    99,    99,    99,    99,    99,    99,    99,
-    99,    99,    99,    99,    99,    99,    99,    99,    99,    99,    99,
-    99,    99,    99,    99,    100,   100,   100,   100,   100,   100,   100,
-    100,   100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
-    100,   100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
-    100,   100,   100,   101,   101,   101,   101,   101,   101,   101,   101,
-    101,   101,   101,   101,   101,   101,   101,   101,   101,   101,   101,
-    101,   101,   101,   101,   101,   101,   101,   101,   101,   101,   101,
-    101,   101,   102,   102,   102,   102,   102,   102,   102,   102,   102,
-    102,   102,   102,   102,   102,   102,   102,   102,   102,   102,   102,
-    102,   102,   102,   102,   102,   102,   102,   102,   102,   102,   102,
-    103,   103,   103,   103,   103,   103,   103,   103,   103,   103,   103,
-    103,   103,   103,   103,   103,   103,   103,   103,   103,   103,   103,
-    103,   103,   103,   103,   103,   103,   103,   103,   103,   103,   104,
-    104,   104,   104,   104,   104,   104,   104,   104,   104,   104,   104,
-    104,   104,   104,   104,   104,   104,   104,   104,   104,   104,   104,
-    104,   104,   104,   104,   104,   104,   104,   104,   105,   105,   105,
-    105,   105,   105,   105,   105,   105,   105,   105,   105,   105,   105,
-    105,   105,   105,   105,   105,   105,   105,   105,   105,   105,   105,
-    105,   105,   105,   105,   105,   105,   106,   106,   106,   106,   106,
-    106,   106,   106,   106,   106,   106,   106,   106,   106,   106,   106,
-    106,   106,   106,   106,   106,   106,   106,   106,   106,   106,   106,
-    106,   106,   106,   106,   107,   107,   107,   107,   107,   107,   107,
-    107,   107,   107,   107,   107,   107,   107,   107,   107,   107,   107,
-    107,   107,   107,   107,   107,   107,   107,   107,   107,   107,   107,
-    107,   108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
-    108,   108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
-    108,   108,   108,   108,   108,   108,   108,   108,   108,   108,   109,
-    109,   109,   109,   109,   109,   109,   109,   109,   109,   109,   109,
-    109,   109,   109,   109,   109,   109,   109,   109,   109,   109,   109,
-    109,   109,   109,   109,   109,   109,   109,   110,   110,   110,   110,
-    110,   110,   110,   110,   110,   110,   110,   110,   110,   110,   110,
-    110,   110,   110,   110,   110,   110,   110,   110,   110,   110,   110,
-    110,   110,   110,   110,   111,   111,   111,   111,   111,   111,   111,
-    111,   111,   111,   111,   111,   111,   111,   111,   111,   111,   111,
-    111,   111,   111,   111,   111,   111,   111,   111,   111,   111,   111,
-    111,   112,   112,   112,   112,   112,   112,   112,   112,   112,   112,
-    112,   112,   112,   112,   112,   112,   112,   112,   112,   112,   112,
-    112,   112,   112,   112,   112,   112,   112,   112,   112,   113,   113,
-    113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,
-    113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,
-    113,   113,   113,   113,   113,   114,   114,   114,   114,   114,   114,
-    114,   114,   114,   114,   114,   114,   114,   114,   114,   114,   114,
-    114,   114,   114,   114,   114,   114,   114,   114,   114,   114,   114,
-    114,   114,   115,   115,   115,   115,   115,   115,   115,   115,   115,
-    115,   115,   115,   115,   115,   115,   115,   115,   115,   115,   115,
-    115,   115,   115,   115,   115,   115,   115,   115,   115,   116,   116,
-    116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,
-    116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,
-    116,   116,   116,   116,   116,   117,   117,   117,   117,   117,   117,
-    117,   117,   117,   117,   117,   117,   117,   117,   117,   117,   117,
-    117,   117,   117,   117,   117,   117,   117,   117,   117,   117,   117,
-    117,   118,   118,   118,   118,   118,   118,   118,   118,   118,   118,
-    118,   118,   118,   118,   118,   118,   118,   118,   118,   118,   118,
-    118,   118,   118,   118,   118,   118,   118,   119,   119,   119,   119,
-    119,   119,   119,   119,   119,   119,   119,   119,   119,   119,   119,
-    119,   119,   119,   119,   119,   119,   119,   119,   119,   119,   119,
-    119,   119,   119,   120,   120,   120,   120,   120,   120,   120,   120,
-    120,   120,   120,   120,   120,   120,   120,   120,   120,   120,   120,
-    120,   120,   120,   120,   120,   120,   120,   120,   120,   120,   121,
-    121,   121,   121,   121,   121,   121,   121,   121,   121,   121,   121,
-    121,   121,   121,   121,   121,   121,   121,   121,   121,   121,   121,
-    121,   121,   121,   121,   121,   122,   122,   122,   122,   122,   122,
-    122,   122,   122,   122,   122,   122,   122,   122,   122,   122,   122,
-    122,   122,   122,   122,   122,   122,   122,   122,   122,   122,   122,
-    123,   123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
-    123,   123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
-    123,   123,   123,   123,   123,   123,   124,   124,   124,   124,   124,
-    124,   124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
-    124,   124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
-    124,   125,   125,   125,   125,   125,   125,   125,   125,   125,   125,
-    125,   125,   125,   125,   125,   125,   125,   125,   125,   125,   125,
-    125,   125,   125,   125,   125,   125,   126,   126,   126,   126,   126,
-    126,   126,   126,   126,   126,   126,   126,   126,   126,   126,   126,
-    126,   126,   126,   126,   126,   126,   126,   126,   126,   126,   126,
-    126,   127,   127,   127,   127,   127,   127,   127,   127,   127,   127,
-    127,   127,   127,   127,   127,   127,   127,   127,   127,   127,   127,
-    127,   127,   127,   127,   127,   127,   128,   128,   128,   128,   128,
-    128,   128,   128,   128,   128,   128,   128,   128,   128,   128,   128,
-    128,   128,   128,   128,   128,   128,   128,   128,   128,   128,   128,
-    128,   129,   129,   129,   129,   129,   129,   129,   129,   129,   129,
-    129,   129,   129,   129,   129,   129,   129,   129,   129,   129,   129,
-    129,   129,   129,   129,   129,   129,   130,   130,   130,   130,   130,
-    130,   130,   130,   130,   130,   130,   130,   130,   130,   130,   130,
-    130,   130,   130,   130,   130,   130,   130,   130,   130,   130,   130,
-    131,   131,   131,   131,   131,   131,   131,   131,   131,   131,   131,
-    131,   131,   131,   131,   131,   131,   131,   131,   131,   131,   131,
-    131,   131,   131,   131,   131,   132,   132,   132,   132,   132,   132,
-    132,   132,   132,   132,   132,   132,   132,   132,   132,   132,   132,
-    132,   132,   132,   132,   132,   132,   132,   132,   132,   133,   133,
-    133,   133,   133,   133,   133,   133,   133,   133,   133,   133,   133,
-    133,   133,   133,   133,   133,   133,   133,   133,   133,   133,   133,
-    133,   133,   133,   134,   134,   134,   134,   134,   134,   134,   134,
-    134,   134,   134,   134,   134,   134,   134,   134,   134,   134,   134,
-    134,   134,   134,   134,   134,   134,   134,   135,   135,   135,   135,
-    135,   135,   135,   135,   135,   135,   135,   135,   135,   135,   135,
-    135,   135,   135,   135,   135,   135,   135,   135,   135,   135,   135,
-    135,   136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
-    136,   136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
-    136,   136,   136,   136,   136,   137,   137,   137,   137,   137,   137,
-    137,   137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
-    137,   137,   137,   137,   137,   137,   137,   137,   137,   138,   138,
-    138,   138,   138,   138,   138,   138,   138,   138,   138,   138,   138,
-    138,   138,   138,   138,   138,   138,   138,   138,   138,   138,   138,
-    138,   138,   139,   139,   139,   139,   139,   139,   139,   139,   139,
-    139,   139,   139,   139,   139,   139,   139,   139,   139,   139,   139,
-    139,   139,   139,   139,   139,   139,   140,   140,   140,   140,   140,
-    140,   140,   140,   140,   140,   140,   140,   140,   140,   140,   140,
-    140,   140,   140,   140,   140,   140,   140,   140,   140,   141,   141,
-    141,   141,   141,   141,   141,   141,   141,   141,   141,   141,   141,
-    141,   141,   141,   141,   141,   141,   141,   141,   141,   141,   141,
-    141,   141,   142,   142,   142,   142,   142,   142,   142,   142,   142,
-    142,   142,   142,   142,   142,   142,   142,   142,   142,   142,   142,
-    142,   142,   142,   142,   142,   143,   143,   143,   143,   143,   143,
-    143,   143,   143,   143,   143,   143,   143,   143,   143,   143,   143,
-    143,   143,   143,   143,   143,   143,   143,   143,   144,   144,   144,
-    144,   144,   144,   144,   144,   144,   144,   144,   144,   144,   144,
-    144,   144,   144,   144,   144,   144,   144,   144,   144,   144,   144,
-    144,   145,   145,   145,   145,   145,   145,   145,   145,   145,   145,
-    145,   145,   145,   145,   145,   145,   145,   145,   145,   145,   145,
-    145,   145,   145,   145,   146,   146,   146,   146,   146,   146,   146,
-    146,   146,   146,   146,   146,   146,   146,   146,   146,   146,   146,
-    146,   146,   146,   146,   146,   146,   146,   147,   147,   147,   147,
-    147,   147,   147,   147,   147,   147,   147,   147,   147,   147,   147,
-    147,   147,   147,   147,   147,   147,   147,   147,   147,   148,   148,
-    148,   148,   148,   148,   148,   148,   148,   148,   148,   148,   148,
-    148,   148,   148,   148,   148,   148,   148,   148,   148,   148,   148,
-    148,   149,   149,   149,   149,   149,   149,   149,   149,   149,   149,
-    149,   149,   149,   149,   149,   149,   149,   149,   149,   149,   149,
-    149,   149,   149,   149,   150,   150,   150,   150,   150,   150,   150,
-    150,   150,   150,   150,   150,   150,   150,   150,   150,   150,   150,
-    150,   150,   150,   150,   150,   150,   151,   151,   151,   151,   151,
-    151,   151,   151,   151,   151,   151,   151,   151,   151,   151,   151,
-    151,   151,   151,   151,   151,   151,   151,   151,   151,   152,   152,
-    152,   152,   152,   152,   152,   152,   152,   152,   152,   152,   152,
-    152,   152,   152,   152,   152,   152,   152,   152,   152,   152,   152,
-    153,   153,   153,   153,   153,   153,   153,   153,   153,   153,   153,
-    153,   153,   153,   153,   153,   153,   153,   153,   153,   153,   153,
-    153,   153,   154,   154,   154,   154,   154,   154,   154,   154,   154,
-    154,   154,   154,   154,   154,   154,   154,   154,   154,   154,   154,
-    154,   154,   154,   154,   155,   155,   155,   155,   155,   155,   155,
-    155,   155,   155,   155,   155,   155,   155,   155,   155,   155,   155,
-    155,   155,   155,   155,   155,   155,   156,   156,   156,   156,   156,
-    156,   156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
-    156,   156,   156,   156,   156,   156,   156,   156,   157,   157,   157,
-    157,   157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
-    157,   157,   157,   157,   157,   157,   157,   157,   157,   158,   158,
-    158,   158,   158,   158,   158,   158,   158,   158,   158,   158,   158,
-    158,   158,   158,   158,   158,   158,   158,   158,   158,   158,   158,
-    159,   159,   159,   159,   159,   159,   159,   159,   159,   159,   159,
-    159,   159,   159,   159,   159,   159,   159,   159,   159,   159,   159,
-    159,   160,   160,   160,   160,   160,   160,   160,   160,   160,   160,
-    160,   160,   160,   160,   160,   160,   160,   160,   160,   160,   160,
-    160,   160,   160,   161,   161,   161,   161,   161,   161,   161,   161,
-    161,   161,   161,   161,   161,   161,   161,   161,   161,   161,   161,
-    161,   161,   161,   161,   162,   162,   162,   162,   162,   162,   162,
-    162,   162,   162,   162,   162,   162,   162,   162,   162,   162,   162,
-    162,   162,   162,   162,   162,   163,   163,   163,   163,   163,   163,
-    163,   163,   163,   163,   163,   163,   163,   163,   163,   163,   163,
-    163,   163,   163,   163,   163,   163,   164,   164,   164,   164,   164,
-    164,   164,   164,   164,   164,   164,   164,   164,   164,   164,   164,
-    164,   164,   164,   164,   164,   164,   164,   165,   165,   165,   165,
-    165,   165,   165,   165,   165,   165,   165,   165,   165,   165,   165,
-    165,   165,   165,   165,   165,   165,   165,   165,   166,   166,   166,
-    166,   166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
-    166,   166,   166,   166,   166,   166,   166,   166,   166,   167,   167,
-    167,   167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
-    167,   167,   167,   167,   167,   167,   167,   167,   167,   167,   168,
-    168,   168,   168,   168,   168,   168,   168,   168,   168,   168,   168,
-    168,   168,   168,   168,   168,   168,   168,   168,   168,   168,   169,
-    169,   169,   169,   169,   169,   169,   169,   169,   169,   169,   169,
-    169,   169,   169,   169,   169,   169,   169,   169,   169,   169,   169,
-    170,   170,   170,   170,   170,   170,   170,   170,   170,   170,   170,
-    170,   170,   170,   170,   170,   170,   170,   170,   170,   170,   170,
-    171,   171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-    171,   171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-    172,   172,   172,   172,   172,   172,   172,   172,   172,   172,   172,
-    172,   172,   172,   172,   172,   172,   172,   172,   172,   172,   172,
-    173,   173,   173,   173,   173,   173,   173,   173,   173,   173,   173,
-    173,   173,   173,   173,   173,   173,   173,   173,   173,   173,   173,
-    173,   174,   174,   174,   174,   174,   174,   174,   174,   174,   174,
-    174,   174,   174,   174,   174,   174,   174,   174,   174,   174,   174,
-    174,   175,   175,   175,   175,   175,   175,   175,   175,   175,   175,
-    175,   175,   175,   175,   175,   175,   175,   175,   175,   175,   175,
-    176,   176,   176,   176,   176,   176,   176,   176,   176,   176,   176,
-    176,   176,   176,   176,   176,   176,   176,   176,   176,   176,   176,
-    177,   177,   177,   177,   177,   177,   177,   177,   177,   177,   177,
-    177,   177,   177,   177,   177,   177,   177,   177,   177,   177,   177,
-    178,   178,   178,   178,   178,   178,   178,   178,   178,   178,   178,
-    178,   178,   178,   178,   178,   178,   178,   178,   178,   178,   178,
-    179,   179,   179,   179,   179,   179,   179,   179,   179,   179,   179,
-    179,   179,   179,   179,   179,   179,   179,   179,   179,   179,   180,
-    180,   180,   180,   180,   180,   180,   180,   180,   180,   180,   180,
-    180,   180,   180,   180,   180,   180,   180,   180,   180,   180,   181,
-    181,   181,   181,   181,   181,   181,   181,   181,   181,   181,   181,
-    181,   181,   181,   181,   181,   181,   181,   181,   181,   182,   182,
-    182,   182,   182,   182,   182,   182,   182,   182,   182,   182,   182,
-    182,   182,   182,   182,   182,   182,   182,   182,   183,   183,   183,
-    183,   183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
-    183,   183,   183,   183,   183,   183,   183,   183,   184,   184,   184,
-    184,   184,   184,   184,   184,   184,   184,   184,   184,   184,   184,
-    184,   184,   184,   184,   184,   184,   184,   185,   185,   185,   185,
-    185,   185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
-    185,   185,   185,   185,   185,   185,   186,   186,   186,   186,   186,
-    186,   186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
-    186,   186,   186,   186,   186,   187,   187,   187,   187,   187,   187,
-    187,   187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
-    187,   187,   187,   187,   188,   188,   188,   188,   188,   188,   188,
-    188,   188,   188,   188,   188,   188,   188,   188,   188,   188,   188,
-    188,   188,   189,   189,   189,   189,   189,   189,   189,   189,   189,
-    189,   189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
-    189,   190,   190,   190,   190,   190,   190,   190,   190,   190,   190,
-    190,   190,   190,   190,   190,   190,   190,   190,   190,   190,   190,
-    191,   191,   191,   191,   191,   191,   191,   191,   191,   191,   191,
-    191,   191,   191,   191,   191,   191,   191,   191,   191,   192,   192,
-    192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
-    192,   192,   192,   192,   192,   192,   192,   192,   193,   193,   193,
-    193,   193,   193,   193,   193,   193,   193,   193,   193,   193,   193,
-    193,   193,   193,   193,   193,   193,   194,   194,   194,   194,   194,
-    194,   194,   194,   194,   194,   194,   194,   194,   194,   194,   194,
-    194,   194,   194,   194,   195,   195,   195,   195,   195,   195,   195,
-    195,   195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-    195,   195,   195,   196,   196,   196,   196,   196,   196,   196,   196,
-    196,   196,   196,   196,   196,   196,   196,   196,   196,   196,   196,
-    196,   197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
-    197,   197,   197,   197,   197,   197,   197,   197,   197,   197,   198,
-    198,   198,   198,   198,   198,   198,   198,   198,   198,   198,   198,
-    198,   198,   198,   198,   198,   198,   198,   198,   199,   199,   199,
-    199,   199,   199,   199,   199,   199,   199,   199,   199,   199,   199,
-    199,   199,   199,   199,   199,   199,   200,   200,   200,   200,   200,
-    200,   200,   200,   200,   200,   200,   200,   200,   200,   200,   200,
-    200,   200,   200,   200,   201,   201,   201,   201,   201,   201,   201,
-    201,   201,   201,   201,   201,   201,   201,   201,   201,   201,   201,
-    201,   202,   202,   202,   202,   202,   202,   202,   202,   202,   202,
-    202,   202,   202,   202,   202,   202,   202,   202,   202,   202,   203,
-    203,   203,   203,   203,   203,   203,   203,   203,   203,   203,   203,
-    203,   203,   203,   203,   203,   203,   203,   203,   204,   204,   204,
-    204,   204,   204,   204,   204,   204,   204,   204,   204,   204,   204,
-    204,   204,   204,   204,   204,   205,   205,   205,   205,   205,   205,
-    205,   205,   205,   205,   205,   205,   205,   205,   205,   205,   205,
-    205,   205,   205,   206,   206,   206,   206,   206,   206,   206,   206,
-    206,   206,   206,   206,   206,   206,   206,   206,   206,   206,   206,
-    207,   207,   207,   207,   207,   207,   207,   207,   207,   207,   207,
-    207,   207,   207,   207,   207,   207,   207,   207,   207,   208,   208,
-    208,   208,   208,   208,   208,   208,   208,   208,   208,   208,   208,
-    208,   208,   208,   208,   208,   208,   209,   209,   209,   209,   209,
-    209,   209,   209,   209,   209,   209,   209,   209,   209,   209,   209,
-    209,   209,   209,   210,   210,   210,   210,   210,   210,   210,   210,
-    210,   210,   210,   210,   210,   210,   210,   210,   210,   210,   210,
-    211,   211,   211,   211,   211,   211,   211,   211,   211,   211,   211,
-    211,   211,   211,   211,   211,   211,   211,   211,   212,   212,   212,
-    212,   212,   212,   212,   212,   212,   212,   212,   212,   212,   212,
-    212,   212,   212,   212,   212,   213,   213,   213,   213,   213,   213,
-    213,   213,   213,   213,   213,   213,   213,   213,   213,   213,   213,
-    213,   213,   214,   214,   214,   214,   214,   214,   214,   214,   214,
-    214,   214,   214,   214,   214,   214,   214,   214,   214,   214,   215,
-    215,   215,   215,   215,   215,   215,   215,   215,   215,   215,   215,
-    215,   215,   215,   215,   215,   215,   215,   216,   216,   216,   216,
-    216,   216,   216,   216,   216,   216,   216,   216,   216,   216,   216,
-    216,   216,   216,   217,   217,   217,   217,   217,   217,   217,   217,
-    217,   217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
-    218,   218,   218,   218,   218,   218,   218,   218,   218,   218,   218,
-    218,   218,   218,   218,   218,   218,   218,   218,   219,   219,   219,
-    219,   219,   219,   219,   219,   219,   219,   219,   219,   219,   219,
-    219,   219,   219,   219,   220,   220,   220,   220,   220,   220,   220,
-    220,   220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
-    220,   221,   221,   221,   221,   221,   221,   221,   221,   221,   221,
-    221,   221,   221,   221,   221,   221,   221,   221,   222,   222,   222,
-    222,   222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
-    222,   222,   222,   222,   223,   223,   223,   223,   223,   223,   223,
-    223,   223,   223,   223,   223,   223,   223,   223,   223,   223,   223,
-    223,   224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
-    224,   224,   224,   224,   224,   224,   224,   224,   225,   225,   225,
-    225,   225,   225,   225,   225,   225,   225,   225,   225,   225,   225,
-    225,   225,   225,   225,   226,   226,   226,   226,   226,   226,   226,
-    226,   226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
-    227,   227,   227,   227,   227,   227,   227,   227,   227,   227,   227,
-    227,   227,   227,   227,   227,   227,   227,   228,   228,   228,   228,
-    228,   228,   228,   228,   228,   228,   228,   228,   228,   228,   228,
-    228,   228,   228,   229,   229,   229,   229,   229,   229,   229,   229,
-    229,   229,   229,   229,   229,   229,   229,   229,   229,   229,   230,
-    230,   230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-    230,   230,   230,   230,   230,   230,   231,   231,   231,   231,   231,
-    231,   231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
-    231,   232,   232,   232,   232,   232,   232,   232,   232,   232,   232,
-    232,   232,   232,   232,   232,   232,   232,   232,   233,   233,   233,
-    233,   233,   233,   233,   233,   233,   233,   233,   233,   233,   233,
-    233,   233,   233,   233,   234,   234,   234,   234,   234,   234,   234,
-    234,   234,   234,   234,   234,   234,   234,   234,   234,   234,   235,
-    235,   235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
-    235,   235,   235,   235,   235,   235,   236,   236,   236,   236,   236,
-    236,   236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-    236,   237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
-    237,   237,   237,   237,   237,   237,   237,   237,   238,   238,   238,
-    238,   238,   238,   238,   238,   238,   238,   238,   238,   238,   238,
-    238,   238,   238,   239,   239,   239,   239,   239,   239,   239,   239,
-    239,   239,   239,   239,   239,   239,   239,   239,   239,   240,   240,
-    240,   240,   240,   240,   240,   240,   240,   240,   240,   240,   240,
-    240,   240,   240,   240,   240,   241,   241,   241,   241,   241,   241,
-    241,   241,   241,   241,   241,   241,   241,   241,   241,   241,   241,
-    242,   242,   242,   242,   242,   242,   242,   242,   242,   242,   242,
-    242,   242,   242,   242,   242,   242,   243,   243,   243,   243,   243,
-    243,   243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-    243,   244,   244,   244,   244,   244,   244,   244,   244,   244,   244,
-    244,   244,   244,   244,   244,   244,   244,   245,   245,   245,   245,
-    245,   245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
-    245,   245,   246,   246,   246,   246,   246,   246,   246,   246,   246,
-    246,   246,   246,   246,   246,   246,   246,   246,   247,   247,   247,
-    247,   247,   247,   247,   247,   247,   247,   247,   247,   247,   247,
-    247,   247,   247,   248,   248,   248,   248,   248,   248,   248,   248,
-    248,   248,   248,   248,   248,   248,   248,   248,   248,   249,   249,
-    249,   249,   249,   249,   249,   249,   249,   249,   249,   249,   249,
-    249,   249,   249,   250,   250,   250,   250,   250,   250,   250,   250,
-    250,   250,   250,   250,   250,   250,   250,   250,   250,   251,   251,
-    251,   251,   251,   251,   251,   251,   251,   251,   251,   251,   251,
-    251,   251,   251,   251,   252,   252,   252,   252,   252,   252,   252,
-    252,   252,   252,   252,   252,   252,   252,   252,   252,   253,   253,
-    253,   253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
-    253,   253,   253,   253,   254,   254,   254,   254,   254,   254,   254,
-    254,   254,   254,   254,   254,   254,   254,   254,   254,   255,   255,
-    255,   255,   255,   255,   255,   255,   255,   255,   255,   255,   255,
-    255,   255,   255,   255,   256,   256,   256,   256,   256,   256,   256,
-    256,   256,   256,   256,   256,   256,   256,   256,   256,   257,   257,
-    257,   257,   257,   257,   257,   257,   257,   257,   257,   257,   257,
-    257,   257,   257,   258,   258,   258,   258,   258,   258,   258,   258,
-    258,   258,   258,   258,   258,   258,   258,   258,   258,   259,   259,
-    259,   259,   259,   259,   259,   259,   259,   259,   259,   259,   259,
-    259,   259,   259,   260,   260,   260,   260,   260,   260,   260,   260,
-    260,   260,   260,   260,   260,   260,   260,   260,   261,   261,   261,
-    261,   261,   261,   261,   261,   261,   261,   261,   261,   261,   261,
-    261,   261,   262,   262,   262,   262,   262,   262,   262,   262,   262,
-    262,   262,   262,   262,   262,   262,   262,   263,   263,   263,   263,
-    263,   263,   263,   263,   263,   263,   263,   263,   263,   263,   263,
-    263,   264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
-    264,   264,   264,   264,   264,   264,   265,   265,   265,   265,   265,
-    265,   265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
-    266,   266,   266,   266,   266,   266,   266,   266,   266,   266,   266,
-    266,   266,   266,   266,   266,   267,   267,   267,   267,   267,   267,
-    267,   267,   267,   267,   267,   267,   267,   267,   267,   267,   268,
-    268,   268,   268,   268,   268,   268,   268,   268,   268,   268,   268,
-    268,   268,   268,   268,   269,   269,   269,   269,   269,   269,   269,
-    269,   269,   269,   269,   269,   269,   269,   269,   269,   270,   270,
-    270,   270,   270,   270,   270,   270,   270,   270,   270,   270,   270,
-    270,   270,   271,   271,   271,   271,   271,   271,   271,   271,   271,
-    271,   271,   271,   271,   271,   271,   271,   272,   272,   272,   272,
-    272,   272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-    273,   273,   273,   273,   273,   273,   273,   273,   273,   273,   273,
-    273,   273,   273,   273,   273,   274,   274,   274,   274,   274,   274,
-    274,   274,   274,   274,   274,   274,   274,   274,   274,   274,   275,
-    275,   275,   275,   275,   275,   275,   275,   275,   275,   275,   275,
-    275,   275,   275,   276,   276,   276,   276,   276,   276,   276,   276,
-    276,   276,   276,   276,   276,   276,   276,   277,   277,   277,   277,
-    277,   277,   277,   277,   277,   277,   277,   277,   277,   277,   277,
-    277,   278,   278,   278,   278,   278,   278,   278,   278,   278,   278,
-    278,   278,   278,   278,   278,   279,   279,   279,   279,   279,   279,
-    279,   279,   279,   279,   279,   279,   279,   279,   279,   280,   280,
-    280,   280,   280,   280,   280,   280,   280,   280,   280,   280,   280,
-    280,   280,   280,   281,   281,   281,   281,   281,   281,   281,   281,
-    281,   281,   281,   281,   281,   281,   281,   282,   282,   282,   282,
-    282,   282,   282,   282,   282,   282,   282,   282,   282,   282,   282,
-    283,   283,   283,   283,   283,   283,   283,   283,   283,   283,   283,
-    283,   283,   283,   283,   284,   284,   284,   284,   284,   284,   284,
-    284,   284,   284,   284,   284,   284,   284,   284,   285,   285,   285,
-    285,   285,   285,   285,   285,   285,   285,   285,   285,   285,   285,
-    285,   286,   286,   286,   286,   286,   286,   286,   286,   286,   286,
-    286,   286,   286,   286,   286,   287,   287,   287,   287,   287,   287,
-    287,   287,   287,   287,   287,   287,   287,   287,   287,   288,   288,
-    288,   288,   288,   288,   288,   288,   288,   288,   288,   288,   288,
-    288,   288,   289,   289,   289,   289,   289,   289,   289,   289,   289,
-    289,   289,   289,   289,   289,   289,   290,   290,   290,   290,   290,
-    290,   290,   290,   290,   290,   290,   290,   290,   290,   290,   291,
-    291,   291,   291,   291,   291,   291,   291,   291,   291,   291,   291,
-    291,   291,   292,   292,   292,   292,   292,   292,   292,   292,   292,
-    292,   292,   292,   292,   292,   292,   293,   293,   293,   293,   293,
-    293,   293,   293,   293,   293,   293,   293,   293,   293,   293,   294,
-    294,   294,   294,   294,   294,   294,   294,   294,   294,   294,   294,
-    294,   294,   294,   295,   295,   295,   295,   295,   295,   295,   295,
-    295,   295,   295,   295,   295,   295,   296,   296,   296,   296,   296,
-    296,   296,   296,   296,   296,   296,   296,   296,   296,   296,   297,
-    297,   297,   297,   297,   297,   297,   297,   297,   297,   297,   297,
-    297,   297,   298,   298,   298,   298,   298,   298,   298,   298,   298,
-    298,   298,   298,   298,   298,   298,   299,   299,   299,   299,   299,
-    299,   299,   299,   299,   299,   299,   299,   299,   299,   300,   300,
-    300,   300,   300,   300,   300,   300,   300,   300,   300,   300,   300,
-    300,   300,   301,   301,   301,   301,   301,   301,   301,   301,   301,
-    301,   301,   301,   301,   301,   302,   302,   302,   302,   302,   302,
-    302,   302,   302,   302,   302,   302,   302,   302,   303,   303,   303,
-    303,   303,   303,   303,   303,   303,   303,   303,   303,   303,   303,
-    303,   304,   304,   304,   304,   304,   304,   304,   304,   304,   304,
-    304,   304,   304,   304,   305,   305,   305,   305,   305,   305,   305,
-    305,   305,   305,   305,   305,   305,   305,   306,   306,   306,   306,
-    306,   306,   306,   306,   306,   306,   306,   306,   306,   306,   307,
-    307,   307,   307,   307,   307,   307,   307,   307,   307,   307,   307,
-    307,   307,   308,   308,   308,   308,   308,   308,   308,   308,   308,
-    308,   308,   308,   308,   308,   309,   309,   309,   309,   309,   309,
-    309,   309,   309,   309,   309,   309,   309,   309,   310,   310,   310,
-    310,   310,   310,   310,   310,   310,   310,   310,   310,   310,   310,
-    311,   311,   311,   311,   311,   311,   311,   311,   311,   311,   311,
-    311,   311,   311,   312,   312,   312,   312,   312,   312,   312,   312,
-    312,   312,   312,   312,   312,   312,   313,   313,   313,   313,   313,
-    313,   313,   313,   313,   313,   313,   313,   313,   313,   314,   314,
-    314,   314,   314,   314,   314,   314,   314,   314,   314,   314,   314,
-    314,   315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-    315,   315,   315,   315,   316,   316,   316,   316,   316,   316,   316,
-    316,   316,   316,   316,   316,   316,   316,   317,   317,   317,   317,
-    317,   317,   317,   317,   317,   317,   317,   317,   317,   317,   318,
-    318,   318,   318,   318,   318,   318,   318,   318,   318,   318,   318,
-    318,   319,   319,   319,   319,   319,   319,   319,   319,   319,   319,
-    319,   319,   319,   319,   320,   320,   320,   320,   320,   320,   320,
-    320,   320,   320,   320,   320,   320,   320,   321,   321,   321,   321,
-    321,   321,   321,   321,   321,   321,   321,   321,   321,   322,   322,
-    322,   322,   322,   322,   322,   322,   322,   322,   322,   322,   322,
-    322,   323,   323,   323,   323,   323,   323,   323,   323,   323,   323,
-    323,   323,   323,   324,   324,   324,   324,   324,   324,   324,   324,
-    324,   324,   324,   324,   324,   324,   325,   325,   325,   325,   325,
-    325,   325,   325,   325,   325,   325,   325,   325,   326,   326,   326,
-    326,   326,   326,   326,   326,   326,   326,   326,   326,   326,   326,
-    327,   327,   327,   327,   327,   327,   327,   327,   327,   327,   327,
-    327,   327,   328,   328,   328,   328,   328,   328,   328,   328,   328,
-    328,   328,   328,   328,   328,   329,   329,   329,   329,   329,   329,
-    329,   329,   329,   329,   329,   329,   329,   330,   330,   330,   330,
-    330,   330,   330,   330,   330,   330,   330,   330,   330,   331,   331,
-    331,   331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
-    331,   332,   332,   332,   332,   332,   332,   332,   332,   332,   332,
-    332,   332,   332,   333,   333,   333,   333,   333,   333,   333,   333,
-    333,   333,   333,   333,   333,   334,   334,   334,   334,   334,   334,
-    334,   334,   334,   334,   334,   334,   334,   335,   335,   335,   335,
-    335,   335,   335,   335,   335,   335,   335,   335,   335,   336,   336,
-    336,   336,   336,   336,   336,   336,   336,   336,   336,   336,   336,
-    337,   337,   337,   337,   337,   337,   337,   337,   337,   337,   337,
-    337,   337,   337,   338,   338,   338,   338,   338,   338,   338,   338,
-    338,   338,   338,   338,   338,   339,   339,   339,   339,   339,   339,
-    339,   339,   339,   339,   339,   339,   339,   340,   340,   340,   340,
-    340,   340,   340,   340,   340,   340,   340,   340,   340,   341,   341,
-    341,   341,   341,   341,   341,   341,   341,   341,   341,   341,   341,
-    342,   342,   342,   342,   342,   342,   342,   342,   342,   342,   342,
-    342,   343,   343,   343,   343,   343,   343,   343,   343,   343,   343,
-    343,   343,   343,   344,   344,   344,   344,   344,   344,   344,   344,
-    344,   344,   344,   344,   344,   345,   345,   345,   345,   345,   345,
-    345,   345,   345,   345,   345,   345,   345,   346,   346,   346,   346,
-    346,   346,   346,   346,   346,   346,   346,   346,   346,   347,   347,
-    347,   347,   347,   347,   347,   347,   347,   347,   347,   347,   347,
-    348,   348,   348,   348,   348,   348,   348,   348,   348,   348,   348,
-    348,   349,   349,   349,   349,   349,   349,   349,   349,   349,   349,
-    349,   349,   349,   350,   350,   350,   350,   350,   350,   350,   350,
-    350,   350,   350,   350,   350,   351,   351,   351,   351,   351,   351,
-    351,   351,   351,   351,   351,   351,   352,   352,   352,   352,   352,
-    352,   352,   352,   352,   352,   352,   352,   352,   353,   353,   353,
-    353,   353,   353,   353,   353,   353,   353,   353,   353,   353,   354,
-    354,   354,   354,   354,   354,   354,   354,   354,   354,   354,   354,
-    355,   355,   355,   355,   355,   355,   355,   355,   355,   355,   355,
-    355,   355,   356,   356,   356,   356,   356,   356,   356,   356,   356,
-    356,   356,   356,   357,   357,   357,   357,   357,   357,   357,   357,
-    357,   357,   357,   357,   357,   358,   358,   358,   358,   358,   358,
-    358,   358,   358,   358,   358,   358,   359,   359,   359,   359,   359,
-    359,   359,   359,   359,   359,   359,   359,   360,   360,   360,   360,
-    360,   360,   360,   360,   360,   360,   360,   360,   360,   361,   361,
-    361,   361,   361,   361,   361,   361,   361,   361,   361,   361,   362,
-    362,   362,   362,   362,   362,   362,   362,   362,   362,   362,   362,
-    363,   363,   363,   363,   363,   363,   363,   363,   363,   363,   363,
-    363,   363,   364,   364,   364,   364,   364,   364,   364,   364,   364,
-    364,   364,   364,   365,   365,   365,   365,   365,   365,   365,   365,
-    365,   365,   365,   365,   366,   366,   366,   366,   366,   366,   366,
-    366,   366,   366,   366,   366,   367,   367,   367,   367,   367,   367,
-    367,   367,   367,   367,   367,   367,   367,   368,   368,   368,   368,
-    368,   368,   368,   368,   368,   368,   368,   368,   369,   369,   369,
-    369,   369,   369,   369,   369,   369,   369,   369,   369,   370,   370,
-    370,   370,   370,   370,   370,   370,   370,   370,   370,   370,   371,
-    371,   371,   371,   371,   371,   371,   371,   371,   371,   371,   371,
-    372,   372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
-    372,   373,   373,   373,   373,   373,   373,   373,   373,   373,   373,
-    373,   373,   374,   374,   374,   374,   374,   374,   374,   374,   374,
-    374,   374,   374,   375,   375,   375,   375,   375,   375,   375,   375,
-    375,   375,   375,   375,   376,   376,   376,   376,   376,   376,   376,
-    376,   376,   376,   376,   376,   377,   377,   377,   377,   377,   377,
-    377,   377,   377,   377,   377,   377,   378,   378,   378,   378,   378,
-    378,   378,   378,   378,   378,   378,   378,   379,   379,   379,   379,
-    379,   379,   379,   379,   379,   379,   379,   380,   380,   380,   380,
-    380,   380,   380,   380,   380,   380,   380,   380,   381,   381,   381,
-    381,   381,   381,   381,   381,   381,   381,   381,   381,   382,   382,
-    382,   382,   382,   382,   382,   382,   382,   382,   382,   382,   383,
-    383,   383,   383,   383,   383,   383,   383,   383,   383,   383,   384,
-    384,   384,   384,   384,   384,   384,   384,   384,   384,   384,   384,
-    385,   385,   385,   385,   385,   385,   385,   385,   385,   385,   385,
-    385,   386,   386,   386,   386,   386,   386,   386,   386,   386,   386,
-    386,   386,   387,   387,   387,   387,   387,   387,   387,   387,   387,
-    387,   387,   388,   388,   388,   388,   388,   388,   388,   388,   388,
-    388,   388,   388,   389,   389,   389,   389,   389,   389,   389,   389,
-    389,   389,   389,   390,   390,   390,   390,   390,   390,   390,   390,
-    390,   390,   390,   390,   391,   391,   391,   391,   391,   391,   391,
-    391,   391,   391,   391,   392,   392,   392,   392,   392,   392,   392,
-    392,   392,   392,   392,   392,   393,   393,   393,   393,   393,   393,
-    393,   393,   393,   393,   393,   394,   394,   394,   394,   394,   394,
-    394,   394,   394,   394,   394,   394,   395,   395,   395,   395,   395,
-    395,   395,   395,   395,   395,   395,   396,   396,   396,   396,   396,
-    396,   396,   396,   396,   396,   396,   396,   397,   397,   397,   397,
-    397,   397,   397,   397,   397,   397,   397,   398,   398,   398,   398,
-    398,   398,   398,   398,   398,   398,   398,   399,   399,   399,   399,
-    399,   399,   399,   399,   399,   399,   399,   399,   400,   400,   400,
-    400,   400,   400,   400,   400,   400,   400,   400,   401,   401,   401,
-    401,   401,   401,   401,   401,   401,   401,   401,   402,   402,   402,
-    402,   402,   402,   402,   402,   402,   402,   402,   402,   403,   403,
-    403,   403,   403,   403,   403,   403,   403,   403,   403,   404,   404,
-    404,   404,   404,   404,   404,   404,   404,   404,   404,   405,   405,
-    405,   405,   405,   405,   405,   405,   405,   405,   405,   406,   406,
-    406,   406,   406,   406,   406,   406,   406,   406,   406,   407,   407,
-    407,   407,   407,   407,   407,   407,   407,   407,   407,   407,   408,
-    408,   408,   408,   408,   408,   408,   408,   408,   408,   408,   409,
-    409,   409,   409,   409,   409,   409,   409,   409,   409,   409,   410,
-    410,   410,   410,   410,   410,   410,   410,   410,   410,   410,   411,
-    411,   411,   411,   411,   411,   411,   411,   411,   411,   411,   412,
-    412,   412,   412,   412,   412,   412,   412,   412,   412,   412,   413,
-    413,   413,   413,   413,   413,   413,   413,   413,   413,   413,   414,
-    414,   414,   414,   414,   414,   414,   414,   414,   414,   414,   415,
-    415,   415,   415,   415,   415,   415,   415,   415,   415,   415,   416,
-    416,   416,   416,   416,   416,   416,   416,   416,   416,   416,   417,
-    417,   417,   417,   417,   417,   417,   417,   417,   417,   417,   418,
-    418,   418,   418,   418,   418,   418,   418,   418,   418,   418,   419,
-    419,   419,   419,   419,   419,   419,   419,   419,   419,   420,   420,
-    420,   420,   420,   420,   420,   420,   420,   420,   420,   421,   421,
-    421,   421,   421,   421,   421,   421,   421,   421,   421,   422,   422,
-    422,   422,   422,   422,   422,   422,   422,   422,   422,   423,   423,
-    423,   423,   423,   423,   423,   423,   423,   423,   423,   424,   424,
-    424,   424,   424,   424,   424,   424,   424,   424,   425,   425,   425,
-    425,   425,   425,   425,   425,   425,   425,   425,   426,   426,   426,
-    426,   426,   426,   426,   426,   426,   426,   426,   427,   427,   427,
-    427,   427,   427,   427,   427,   427,   427,   428,   428,   428,   428,
-    428,   428,   428,   428,   428,   428,   428,   429,   429,   429,   429,
-    429,   429,   429,   429,   429,   429,   429,   430,   430,   430,   430,
-    430,   430,   430,   430,   430,   430,   431,   431,   431,   431,   431,
-    431,   431,   431,   431,   431,   431,   432,   432,   432,   432,   432,
-    432,   432,   432,   432,   432,   432,   433,   433,   433,   433,   433,
-    433,   433,   433,   433,   433,   434,   434,   434,   434,   434,   434,
-    434,   434,   434,   434,   434,   435,   435,   435,   435,   435,   435,
-    435,   435,   435,   435,   436,   436,   436,   436,   436,   436,   436,
-    436,   436,   436,   436,   437,   437,   437,   437,   437,   437,   437,
-    437,   437,   437,   438,   438,   438,   438,   438,   438,   438,   438,
-    438,   438,   438,   439,   439,   439,   439,   439,   439,   439,   439,
-    439,   439,   440,   440,   440,   440,   440,   440,   440,   440,   440,
-    440,   441,   441,   441,   441,   441,   441,   441,   441,   441,   441,
-    441,   442,   442,   442,   442,   442,   442,   442,   442,   442,   442,
-    443,   443,   443,   443,   443,   443,   443,   443,   443,   443,   443,
-    444,   444,   444,   444,   444,   444,   444,   444,   444,   444,   445,
-    445,   445,   445,   445,   445,   445,   445,   445,   445,   446,   446,
-    446,   446,   446,   446,   446,   446,   446,   446,   447,   447,   447,
-    447,   447,   447,   447,   447,   447,   447,   447,   448,   448,   448,
-    448,   448,   448,   448,   448,   448,   448,   449,   449,   449,   449,
-    449,   449,   449,   449,   449,   449,   450,   450,   450,   450,   450,
-    450,   450,   450,   450,   450,   451,   451,   451,   451,   451,   451,
-    451,   451,   451,   451,   451,   452,   452,   452,   452,   452,   452,
-    452,   452,   452,   452,   453,   453,   453,   453,   453,   453,   453,
-    453,   453,   453,   454,   454,   454,   454,   454,   454,   454,   454,
-    454,   454,   455,   455,   455,   455,   455,   455,   455,   455,   455,
-    455,   456,   456,   456,   456,   456,   456,   456,   456,   456,   456,
-    457,   457,   457,   457,   457,   457,   457,   457,   457,   457,   458,
-    458,   458,   458,   458,   458,   458,   458,   458,   458,   459,   459,
-    459,   459,   459,   459,   459,   459,   459,   459,   460,   460,   460,
-    460,   460,   460,   460,   460,   460,   460,   461,   461,   461,   461,
-    461,   461,   461,   461,   461,   461,   462,   462,   462,   462,   462,
-    462,   462,   462,   462,   462,   463,   463,   463,   463,   463,   463,
-    463,   463,   463,   463,   464,   464,   464,   464,   464,   464,   464,
-    464,   464,   464,   465,   465,   465,   465,   465,   465,   465,   465,
-    465,   465,   466,   466,   466,   466,   466,   466,   466,   466,   466,
-    466,   467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
-    468,   468,   468,   468,   468,   468,   468,   468,   468,   468,   469,
-    469,   469,   469,   469,   469,   469,   469,   469,   469,   470,   470,
-    470,   470,   470,   470,   470,   470,   470,   470,   471,   471,   471,
-    471,   471,   471,   471,   471,   471,   472,   472,   472,   472,   472,
-    472,   472,   472,   472,   472,   473,   473,   473,   473,   473,   473,
-    473,   473,   473,   473,   474,   474,   474,   474,   474,   474,   474,
-    474,   474,   474,   475,   475,   475,   475,   475,   475,   475,   475,
-    475,   476,   476,   476,   476,   476,   476,   476,   476,   476,   476,
-    477,   477,   477,   477,   477,   477,   477,   477,   477,   477,   478,
-    478,   478,   478,   478,   478,   478,   478,   478,   479,   479,   479,
-    479,   479,   479,   479,   479,   479,   479,   480,   480,   480,   480,
-    480,   480,   480,   480,   480,   480,   481,   481,   481,   481,   481,
-    481,   481,   481,   481,   482,   482,   482,   482,   482,   482,   482,
-    482,   482,   482,   483,   483,   483,   483,   483,   483,   483,   483,
-    483,   483,   484,   484,   484,   484,   484,   484,   484,   484,   484,
-    485,   485,   485,   485,   485,   485,   485,   485,   485,   485,   486,
-    486,   486,   486,   486,   486,   486,   486,   486,   487,   487,   487,
-    487,   487,   487,   487,   487,   487,   487,   488,   488,   488,   488,
-    488,   488,   488,   488,   488,   489,   489,   489,   489,   489,   489,
-    489,   489,   489,   489,   490,   490,   490,   490,   490,   490,   490,
-    490,   490,   491,   491,   491,   491,   491,   491,   491,   491,   491,
-    491,   492,   492,   492,   492,   492,   492,   492,   492,   492,   493,
-    493,   493,   493,   493,   493,   493,   493,   493,   493,   494,   494,
-    494,   494,   494,   494,   494,   494,   494,   495,   495,   495,   495,
-    495,   495,   495,   495,   495,   496,   496,   496,   496,   496,   496,
-    496,   496,   496,   496,   497,   497,   497,   497,   497,   497,   497,
-    497,   497,   498,   498,   498,   498,   498,   498,   498,   498,   498,
-    499,   499,   499,   499,   499,   499,   499,   499,   499,   499,   500,
-    500,   500,   500,   500,   500,   500,   500,   500,   501,   501,   501,
-    501,   501,   501,   501,   501,   501,   502,   502,   502,   502,   502,
-    502,   502,   502,   502,   502,   503,   503,   503,   503,   503,   503,
-    503,   503,   503,   504,   504,   504,   504,   504,   504,   504,   504,
-    504,   505,   505,   505,   505,   505,   505,   505,   505,   505,   506,
-    506,   506,   506,   506,   506,   506,   506,   506,   506,   507,   507,
-    507,   507,   507,   507,   507,   507,   507,   508,   508,   508,   508,
-    508,   508,   508,   508,   508,   509,   509,   509,   509,   509,   509,
-    509,   509,   509,   510,   510,   510,   510,   510,   510,   510,   510,
-    510,   511,   511,   511,   511,   511,   511,   511,   511,   511,   512,
-    512,   512,   512,   512,   512,   512,   512,   512,   513,   513,   513,
-    513,   513,   513,   513,   513,   513,   513,   514,   514,   514,   514,
-    514,   514,   514,   514,   514,   515,   515,   515,   515,   515,   515,
-    515,   515,   515,   516,   516,   516,   516,   516,   516,   516,   516,
-    516,   517,   517,   517,   517,   517,   517,   517,   517,   517,   518,
-    518,   518,   518,   518,   518,   518,   518,   518,   519,   519,   519,
-    519,   519,   519,   519,   519,   519,   520,   520,   520,   520,   520,
-    520,   520,   520,   520,   521,   521,   521,   521,   521,   521,   521,
-    521,   521,   522,   522,   522,   522,   522,   522,   522,   522,   522,
-    523,   523,   523,   523,   523,   523,   523,   523,   523,   524,   524,
-    524,   524,   524,   524,   524,   524,   524,   525,   525,   525,   525,
-    525,   525,   525,   525,   526,   526,   526,   526,   526,   526,   526,
-    526,   526,   527,   527,   527,   527,   527,   527,   527,   527,   527,
-    528,   528,   528,   528,   528,   528,   528,   528,   528,   529,   529,
-    529,   529,   529,   529,   529,   529,   529,   530,   530,   530,   530,
-    530,   530,   530,   530,   530,   531,   531,   531,   531,   531,   531,
-    531,   531,   531,   532,   532,   532,   532,   532,   532,   532,   532,
-    533,   533,   533,   533,   533,   533,   533,   533,   533,   534,   534,
-    534,   534,   534,   534,   534,   534,   534,   535,   535,   535,   535,
-    535,   535,   535,   535,   535,   536,   536,   536,   536,   536,   536,
-    536,   536,   537,   537,   537,   537,   537,   537,   537,   537,   537,
-    538,   538,   538,   538,   538,   538,   538,   538,   538,   539,   539,
-    539,   539,   539,   539,   539,   539,   539,   540,   540,   540,   540,
-    540,   540,   540,   540,   541,   541,   541,   541,   541,   541,   541,
-    541,   541,   542,   542,   542,   542,   542,   542,   542,   542,   542,
-    543,   543,   543,   543,   543,   543,   543,   543,   544,   544,   544,
-    544,   544,   544,   544,   544,   544,   545,   545,   545,   545,   545,
-    545,   545,   545,   545,   546,   546,   546,   546,   546,   546,   546,
-    546,   547,   547,   547,   547,   547,   547,   547,   547,   547,   548,
-    548,   548,   548,   548,   548,   548,   548,   549,   549,   549,   549,
-    549,   549,   549,   549,   549,   550,   550,   550,   550,   550,   550,
-    550,   550,   551,   551,   551,   551,   551,   551,   551,   551,   551,
-    552,   552,   552,   552,   552,   552,   552,   552,   553,   553,   553,
-    553,   553,   553,   553,   553,   553,   554,   554,   554,   554,   554,
-    554,   554,   554,   555,   555,   555,   555,   555,   555,   555,   555,
-    555,   556,   556,   556,   556,   556,   556,   556,   556,   557,   557,
-    557,   557,   557,   557,   557,   557,   557,   558,   558,   558,   558,
-    558,   558,   558,   558,   559,   559,   559,   559,   559,   559,   559,
-    559,   559,   560,   560,   560,   560,   560,   560,   560,   560,   561,
-    561,   561,   561,   561,   561,   561,   561,   561,   562,   562,   562,
-    562,   562,   562,   562,   562,   563,   563,   563,   563,   563,   563,
-    563,   563,   564,   564,   564,   564,   564,   564,   564,   564,   564,
-    565,   565,   565,   565,   565,   565,   565,   565,   566,   566,   566,
-    566,   566,   566,   566,   566,   567,   567,   567,   567,   567,   567,
-    567,   567,   567,   568,   568,   568,   568,   568,   568,   568,   568,
-    569,   569,   569,   569,   569,   569,   569,   569,   570,   570,   570,
-    570,   570,   570,   570,   570,   570,   571,   571,   571,   571,   571,
-    571,   571,   571,   572,   572,   572,   572,   572,   572,   572,   572,
-    573,   573,   573,   573,   573,   573,   573,   573,   574,   574,   574,
-    574,   574,   574,   574,   574,   575,   575,   575,   575,   575,   575,
-    575,   575,   575,   576,   576,   576,   576,   576,   576,   576,   576,
-    577,   577,   577,   577,   577,   577,   577,   577,   578,   578,   578,
-    578,   578,   578,   578,   578,   579,   579,   579,   579,   579,   579,
-    579,   579,   580,   580,   580,   580,   580,   580,   580,   580,   580,
-    581,   581,   581,   581,   581,   581,   581,   581,   582,   582,   582,
-    582,   582,   582,   582,   582,   583,   583,   583,   583,   583,   583,
-    583,   583,   584,   584,   584,   584,   584,   584,   584,   584,   585,
-    585,   585,   585,   585,   585,   585,   585,   586,   586,   586,   586,
-    586,   586,   586,   586,   587,   587,   587,   587,   587,   587,   587,
-    587,   588,   588,   588,   588,   588,   588,   588,   588,   589,   589,
-    589,   589,   589,   589,   589,   589,   590,   590,   590,   590,   590,
-    590,   590,   590,   591,   591,   591,   591,   591,   591,   591,   591,
-    592,   592,   592,   592,   592,   592,   592,   592,   593,   593,   593,
-    593,   593,   593,   593,   593,   594,   594,   594,   594,   594,   594,
-    594,   594,   595,   595,   595,   595,   595,   595,   595,   595,   596,
-    596,   596,   596,   596,   596,   596,   596,   597,   597,   597,   597,
-    597,   597,   597,   597,   598,   598,   598,   598,   598,   598,   598,
-    598,   599,   599,   599,   599,   599,   599,   599,   599,   600,   600,
-    600,   600,   600,   600,   600,   600,   601,   601,   601,   601,   601,
-    601,   601,   601,   602,   602,   602,   602,   602,   602,   602,   602,
-    603,   603,   603,   603,   603,   603,   603,   603,   604,   604,   604,
-    604,   604,   604,   604,   605,   605,   605,   605,   605,   605,   605,
-    605,   606,   606,   606,   606,   606,   606,   606,   606,   607,   607,
-    607,   607,   607,   607,   607,   607,   608,   608,   608,   608,   608,
-    608,   608,   608,   609,   609,   609,   609,   609,   609,   609,   609,
-    610,   610,   610,   610,   610,   610,   610,   611,   611,   611,   611,
-    611,   611,   611,   611,   612,   612,   612,   612,   612,   612,   612,
-    612,   613,   613,   613,   613,   613,   613,   613,   613,   614,   614,
-    614,   614,   614,   614,   614,   615,   615,   615,   615,   615,   615,
-    615,   615,   616,   616,   616,   616,   616,   616,   616,   616,   617,
-    617,   617,   617,   617,   617,   617,   617,   618,   618,   618,   618,
-    618,   618,   618,   619,   619,   619,   619,   619,   619,   619,   619,
-    620,   620,   620,   620,   620,   620,   620,   620,   621,   621,   621,
-    621,   621,   621,   621,   622,   622,   622,   622,   622,   622,   622,
-    622,   623,   623,   623,   623,   623,   623,   623,   623,   624,   624,
-    624,   624,   624,   624,   624,   625,   625,   625,   625,   625,   625,
-    625,   625,   626,   626,   626,   626,   626,   626,   626,   627,   627,
-    627,   627,   627,   627,   627,   627,   628,   628,   628,   628,   628,
-    628,   628,   628,   629,   629,   629,   629,   629,   629,   629,   630,
-    630,   630,   630,   630,   630,   630,   630,   631,   631,   631,   631,
-    631,   631,   631,   632,   632,   632,   632,   632,   632,   632,   632,
-    633,   633,   633,   633,   633,   633,   633,   634,   634,   634,   634,
-    634,   634,   634,   634,   635,   635,   635,   635,   635,   635,   635,
-    636,   636,   636,   636,   636,   636,   636,   636,   637,   637,   637,
-    637,   637,   637,   637,   638,   638,   638,   638,   638,   638,   638,
-    638,   639,   639,   639,   639,   639,   639,   639,   640,   640,   640,
-    640,   640,   640,   640,   640,   641,   641,   641,   641,   641,   641,
-    641,   642,   642,   642,   642,   642,   642,   642,   642,   643,   643,
-    643,   643,   643,   643,   643,   644,   644,   644,   644,   644,   644,
-    644,   645,   645,   645,   645,   645,   645,   645,   645,   646,   646,
-    646,   646,   646,   646,   646,   647,   647,   647,   647,   647,   647,
-    647,   647,   648,   648,   648,   648,   648,   648,   648,   649,   649,
-    649,   649,   649,   649,   649,   650,   650,   650,   650,   650,   650,
-    650,   650,   651,   651,   651,   651,   651,   651,   651,   652,   652,
-    652,   652,   652,   652,   652,   653,   653,   653,   653,   653,   653,
-    653,   653,   654,   654,   654,   654,   654,   654,   654,   655,   655,
-    655,   655,   655,   655,   655,   656,   656,   656,   656,   656,   656,
-    656,   656,   657,   657,   657,   657,   657,   657,   657,   658,   658,
-    658,   658,   658,   658,   658,   659,   659,   659,   659,   659,   659,
-    659,   660,   660,   660,   660,   660,   660,   660,   660,   661,   661,
-    661,   661,   661,   661,   661,   662,   662,   662,   662,   662,   662,
-    662,   663,   663,   663,   663,   663,   663,   663,   664,   664,   664,
-    664,   664,   664,   664,   664,   665,   665,   665,   665,   665,   665,
-    665,   666,   666,   666,   666,   666,   666,   666,   667,   667,   667,
-    667,   667,   667,   667,   668,   668,   668,   668,   668,   668,   668,
-    669,   669,   669,   669,   669,   669,   669,   670,   670,   670,   670,
-    670,   670,   670,   670,   671,   671,   671,   671,   671,   671,   671,
-    672,   672,   672,   672,   672,   672,   672,   673,   673,   673,   673,
-    673,   673,   673,   674,   674,   674,   674,   674,   674,   674,   675,
-    675,   675,   675,   675,   675,   675,   676,   676,   676,   676,   676,
-    676,   676,   677,   677,   677,   677,   677,   677,   677,   678,   678,
-    678,   678,   678,   678,   678,   678,   679,   679,   679,   679,   679,
-    679,   679,   680,   680,   680,   680,   680,   680,   680,   681,   681,
-    681,   681,   681,   681,   681,   682,   682,   682,   682,   682,   682,
-    682,   683,   683,   683,   683,   683,   683,   683,   684,   684,   684,
-    684,   684,   684,   684,   685,   685,   685,   685,   685,   685,   685,
-    686,   686,   686,   686,   686,   686,   686,   687,   687,   687,   687,
-    687,   687,   687,   688,   688,   688,   688,   688,   688,   688,   689,
-    689,   689,   689,   689,   689,   689,   690,   690,   690,   690,   690,
-    690,   690,   691,   691,   691,   691,   691,   691,   691,   692,   692,
-    692,   692,   692,   692,   692,   693,   693,   693,   693,   693,   693,
-    694,   694,   694,   694,   694,   694,   694,   695,   695,   695,   695,
-    695,   695,   695,   696,   696,   696,   696,   696,   696,   696,   697,
-    697,   697,   697,   697,   697,   697,   698,   698,   698,   698,   698,
-    698,   698,   699,   699,   699,   699,   699,   699,   699,   700,   700,
-    700,   700,   700,   700,   700,   701,   701,   701,   701,   701,   701,
-    701,   702,   702,   702,   702,   702,   702,   703,   703,   703,   703,
-    703,   703,   703,   704,   704,   704,   704,   704,   704,   704,   705,
-    705,   705,   705,   705,   705,   705,   706,   706,   706,   706,   706,
-    706,   706,   707,   707,   707,   707,   707,   707,   707,   708,   708,
-    708,   708,   708,   708,   709,   709,   709,   709,   709,   709,   709,
-    710,   710,   710,   710,   710,   710,   710,   711,   711,   711,   711,
-    711,   711,   711,   712,   712,   712,   712,   712,   712,   712,   713,
-    713,   713,   713,   713,   713,   714,   714,   714,   714,   714,   714,
-    714,   715,   715,   715,   715,   715,   715,   715,   716,   716,   716,
-    716,   716,   716,   716,   717,   717,   717,   717,   717,   717,   718,
-    718,   718,   718,   718,   718,   718,   719,   719,   719,   719,   719,
-    719,   719,   720,   720,   720,   720,   720,   720,   721,   721,   721,
-    721,   721,   721,   721,   722,   722,   722,   722,   722,   722,   722,
-    723,   723,   723,   723,   723,   723,   724,   724,   724,   724,   724,
-    724,   724,   725,   725,   725,   725,   725,   725,   725,   726,   726,
-    726,   726,   726,   726,   727,   727,   727,   727,   727,   727,   727,
-    728,   728,   728,   728,   728,   728,   728,   729,   729,   729,   729,
-    729,   729,   730,   730,   730,   730,   730,   730,   730,   731,   731,
-    731,   731,   731,   731,   732,   732,   732,   732,   732,   732,   732,
-    733,   733,   733,   733,   733,   733,   733,   734,   734,   734,   734,
-    734,   734,   735,   735,   735,   735,   735,   735,   735,   736,   736,
-    736,   736,   736,   736,   737,   737,   737,   737,   737,   737,   737,
-    738,   738,   738,   738,   738,   738,   739,   739,   739,   739,   739,
-    739,   739,   740,   740,   740,   740,   740,   740,   741,   741,   741,
-    741,   741,   741,   741,   742,   742,   742,   742,   742,   742,   742,
-    743,   743,   743,   743,   743,   743,   744,   744,   744,   744,   744,
-    744,   744,   745,   745,   745,   745,   745,   745,   746,   746,   746,
-    746,   746,   746,   747,   747,   747,   747,   747,   747,   747,   748,
-    748,   748,   748,   748,   748,   749,   749,   749,   749,   749,   749,
-    749,   750,   750,   750,   750,   750,   750,   751,   751,   751,   751,
-    751,   751,   751,   752,   752,   752,   752,   752,   752,   753,   753,
-    753,   753,   753,   753,   753,   754,   754,   754,   754,   754,   754,
-    755,   755,   755,   755,   755,   755,   756,   756,   756,   756,   756,
-    756,   756,   757,   757,   757,   757,   757,   757,   758,   758,   758,
-    758,   758,   758,   758,   759,   759,   759,   759,   759,   759,   760,
-    760,   760,   760,   760,   760,   761,   761,   761,   761,   761,   761,
-    761,   762,   762,   762,   762,   762,   762,   763,   763,   763,   763,
-    763,   763,   764,   764,   764,   764,   764,   764,   764,   765,   765,
-    765,   765,   765,   765,   766,   766,   766,   766,   766,   766,   767,
-    767,   767,   767,   767,   767,   767,   768,   768,   768,   768,   768,
-    768,   769,   769,   769,   769,   769,   769,   770,   770,   770,   770,
-    770,   770,   770,   771,   771,   771,   771,   771,   771,   772,   772,
-    772,   772,   772,   772,   773,   773,   773,   773,   773,   773,   773,
-    774,   774,   774,   774,   774,   774,   775,   775,   775,   775,   775,
-    775,   776,   776,   776,   776,   776,   776,   777,   777,   777,   777,
-    777,   777,   777,   778,   778,   778,   778,   778,   778,   779,   779,
-    779,   779,   779,   779,   780,   780,   780,   780,   780,   780,   781,
-    781,   781,   781,   781,   781,   782,   782,   782,   782,   782,   782,
-    782,   783,   783,   783,   783,   783,   783,   784,   784,   784,   784,
-    784,   784,   785,   785,   785,   785,   785,   785,   786,   786,   786,
-    786,   786,   786,   787,   787,   787,   787,   787,   787,   787,   788,
-    788,   788,   788,   788,   788,   789,   789,   789,   789,   789,   789,
-    790,   790,   790,   790,   790,   790,   791,   791,   791,   791,   791,
-    791,   792,   792,   792,   792,   792,   792,   793,   793,   793,   793,
-    793,   793,   794,   794,   794,   794,   794,   794,   794,   795,   795,
-    795,   795,   795,   795,   796,   796,   796,   796,   796,   796,   797,
-    797,   797,   797,   797,   797,   798,   798,   798,   798,   798,   798,
-    799,   799,   799,   799,   799,   799,   800,   800,   800,   800,   800,
-    800,   801,   801,   801,   801,   801,   801,   802,   802,   802,   802,
-    802,   802,   803,   803,   803,   803,   803,   803,   804,   804,   804,
-    804,   804,   804,   805,   805,   805,   805,   805,   805,   806,   806,
-    806,   806,   806,   806,   807,   807,   807,   807,   807,   807,   808,
-    808,   808,   808,   808,   808,   809,   809,   809,   809,   809,   809,
-    810,   810,   810,   810,   810,   810,   811,   811,   811,   811,   811,
-    811,   812,   812,   812,   812,   812,   812,   813,   813,   813,   813,
-    813,   813,   814,   814,   814,   814,   814,   814,   815,   815,   815,
-    815,   815,   815,   816,   816,   816,   816,   816,   816,   817,   817,
-    817,   817,   817,   817,   818,   818,   818,   818,   818,   818,   819,
-    819,   819,   819,   819,   819,   820,   820,   820,   820,   820,   820,
-    821,   821,   821,   821,   821,   821,   822,   822,   822,   822,   822,
-    822,   823,   823,   823,   823,   823,   823,   824,   824,   824,   824,
-    824,   824,   825,   825,   825,   825,   825,   825,   826,   826,   826,
-    826,   826,   826,   827,   827,   827,   827,   827,   827,   828,   828,
-    828,   828,   828,   829,   829,   829,   829,   829,   829,   830,   830,
-    830,   830,   830,   830,   831,   831,   831,   831,   831,   831,   832,
-    832,   832,   832,   832,   832,   833,   833,   833,   833,   833,   833,
-    834,   834,   834,   834,   834,   834,   835,   835,   835,   835,   835,
-    836,   836,   836,   836,   836,   836,   837,   837,   837,   837,   837,
-    837,   838,   838,   838,   838,   838,   838,   839,   839,   839,   839,
-    839,   839,   840,   840,   840,   840,   840,   840,   841,   841,   841,
-    841,   841,   842,   842,   842,   842,   842,   842,   843,   843,   843,
-    843,   843,   843,   844,   844,   844,   844,   844,   844,   845,   845,
-    845,   845,   845,   846,   846,   846,   846,   846,   846,   847,   847,
-    847,   847,   847,   847,   848,   848,   848,   848,   848,   848,   849,
-    849,   849,   849,   849,   849,   850,   850,   850,   850,   850,   851,
-    851,   851,   851,   851,   851,   852,   852,   852,   852,   852,   852,
-    853,   853,   853,   853,   853,   854,   854,   854,   854,   854,   854,
-    855,   855,   855,   855,   855,   855,   856,   856,   856,   856,   856,
-    856,   857,   857,   857,   857,   857,   858,   858,   858,   858,   858,
-    858,   859,   859,   859,   859,   859,   859,   860,   860,   860,   860,
-    860,   861,   861,   861,   861,   861,   861,   862,   862,   862,   862,
-    862,   862,   863,   863,   863,   863,   863,   864,   864,   864,   864,
-    864,   864,   865,   865,   865,   865,   865,   865,   866,   866,   866,
-    866,   866,   867,   867,   867,   867,   867,   867,   868,   868,   868,
-    868,   868,   868,   869,   869,   869,   869,   869,   870,   870,   870,
-    870,   870,   870,   871,   871,   871,   871,   871,   872,   872,   872,
-    872,   872,   872,   873,   873,   873,   873,   873,   873,   874,   874,
-    874,   874,   874,   875,   875,   875,   875,   875,   875,   876,   876,
-    876,   876,   876,   877,   877,   877,   877,   877,   877,   878,   878,
-    878,   878,   878,   878,   879,   879,   879,   879,   879,   880,   880,
-    880,   880,   880,   880,   881,   881,   881,   881,   881,   882,   882,
-    882,   882,   882,   882,   883,   883,   883,   883,   883,   884,   884,
-    884,   884,   884,   884,   885,   885,   885,   885,   885,   886,   886,
-    886,   886,   886,   886,   887,   887,   887,   887,   887,   887,   888,
-    888,   888,   888,   888,   889,   889,   889,   889,   889,   889,   890,
-    890,   890,   890,   890,   891,   891,   891,   891,   891,   891,   892,
-    892,   892,   892,   892,   893,   893,   893,   893,   893,   893,   894,
-    894,   894,   894,   894,   895,   895,   895,   895,   895,   896,   896,
-    896,   896,   896,   896,   897,   897,   897,   897,   897,   898,   898,
-    898,   898,   898,   898,   899,   899,   899,   899,   899,   900,   900,
-    900,   900,   900,   900,   901,   901,   901,   901,   901,   902,   902,
-    902,   902,   902,   902,   903,   903,   903,   903,   903,   904,   904,
-    904,   904,   904,   905,   905,   905,   905,   905,   905,   906,   906,
-    906,   906,   906,   907,   907,   907,   907,   907,   907,   908,   908,
-    908,   908,   908,   909,   909,   909,   909,   909,   909,   910,   910,
-    910,   910,   910,   911,   911,   911,   911,   911,   912,   912,   912,
-    912,   912,   912,   913,   913,   913,   913,   913,   914,   914,   914,
-    914,   914,   915,   915,   915,   915,   915,   915,   916,   916,   916,
-    916,   916,   917,   917,   917,   917,   917,   918,   918,   918,   918,
-    918,   918,   919,   919,   919,   919,   919,   920,   920,   920,   920,
-    920,   920,   921,   921,   921,   921,   921,   922,   922,   922,   922,
-    922,   923,   923,   923,   923,   923,   924,   924,   924,   924,   924,
-    924,   925,   925,   925,   925,   925,   926,   926,   926,   926,   926,
-    927,   927,   927,   927,   927,   927,   928,   928,   928,   928,   928,
-    929,   929,   929,   929,   929,   930,   930,   930,   930,   930,   930,
-    931,   931,   931,   931,   931,   932,   932,   932,   932,   932,   933,
-    933,   933,   933,   933,   934,   934,   934,   934,   934,   934,   935,
-    935,   935,   935,   935,   936,   936,   936,   936,   936,   937,   937,
-    937,   937,   937,   938,   938,   938,   938,   938,   938,   939,   939,
-    939,   939,   939,   940,   940,   940,   940,   940,   941,   941,   941,
-    941,   941,   942,   942,   942,   942,   942,   942,   943,   943,   943,
-    943,   943,   944,   944,   944,   944,   944,   945,   945,   945,   945,
-    945,   946,   946,   946,   946,   946,   947,   947,   947,   947,   947,
-    947,   948,   948,   948,   948,   948,   949,   949,   949,   949,   949,
-    950,   950,   950,   950,   950,   951,   951,   951,   951,   951,   952,
-    952,   952,   952,   952,   953,   953,   953,   953,   953,   953,   954,
-    954,   954,   954,   954,   955,   955,   955,   955,   955,   956,   956,
-    956,   956,   956,   957,   957,   957,   957,   957,   958,   958,   958,
-    958,   958,   959,   959,   959,   959,   959,   960,   960,   960,   960,
-    960,   960,   961,   961,   961,   961,   961,   962,   962,   962,   962,
-    962,   963,   963,   963,   963,   963,   964,   964,   964,   964,   964,
-    965,   965,   965,   965,   965,   966,   966,   966,   966,   966,   967,
-    967,   967,   967,   967,   968,   968,   968,   968,   968,   969,   969,
-    969,   969,   969,   969,   970,   970,   970,   970,   970,   971,   971,
-    971,   971,   971,   972,   972,   972,   972,   972,   973,   973,   973,
-    973,   973,   974,   974,   974,   974,   974,   975,   975,   975,   975,
-    975,   976,   976,   976,   976,   976,   977,   977,   977,   977,   977,
-    978,   978,   978,   978,   978,   979,   979,   979,   979,   979,   980,
-    980,   980,   980,   980,   981,   981,   981,   981,   981,   982,   982,
-    982,   982,   982,   983,   983,   983,   983,   983,   984,   984,   984,
-    984,   984,   985,   985,   985,   985,   985,   986,   986,   986,   986,
-    986,   987,   987,   987,   987,   987,   988,   988,   988,   988,   988,
-    989,   989,   989,   989,   989,   990,   990,   990,   990,   990,   991,
-    991,   991,   991,   991,   992,   992,   992,   992,   992,   993,   993,
-    993,   993,   993,   994,   994,   994,   994,   994,   995,   995,   995,
-    995,   995,   996,   996,   996,   996,   996,   997,   997,   997,   997,
-    997,   998,   998,   998,   998,   998,   999,   999,   999,   999,   999,
-    1000,  1000,  1000,  1000,  1000,  1001,  1001,  1001,  1001,  1001,  1002,
-    1002,  1002,  1002,  1002,  1003,  1003,  1003,  1003,  1004,  1004,  1004,
-    1004,  1004,  1005,  1005,  1005,  1005,  1005,  1006,  1006,  1006,  1006,
-    1006,  1007,  1007,  1007,  1007,  1007,  1008,  1008,  1008,  1008,  1008,
-    1009,  1009,  1009,  1009,  1009,  1010,  1010,  1010,  1010,  1010,  1011,
-    1011,  1011,  1011,  1011,  1012,  1012,  1012,  1012,  1012,  1013,  1013,
-    1013,  1013,  1014,  1014,  1014,  1014,  1014,  1015,  1015,  1015,  1015,
-    1015,  1016,  1016,  1016,  1016,  1016,  1017,  1017,  1017,  1017,  1017,
-    1018,  1018,  1018,  1018,  1018,  1019,  1019,  1019,  1019,  1019,  1020,
-    1020,  1020,  1020,  1021,  1021,  1021,  1021,  1021,  1022,  1022,  1022,
-    1022,  1022,  1023,  1023,  1023,  1023,  1023,  1024,  1024,  1024,  1024,
-    1024,  1025,  1025,  1025,  1025,  1025,  1026,  1026,  1026,  1026,  1027,
-    1027,  1027,  1027,  1027,  1028,  1028,  1028,  1028,  1028,  1029,  1029,
-    1029,  1029,  1029,  1030,  1030,  1030,  1030,  1030,  1031,  1031,  1031,
-    1031,  1032,  1032,  1032,  1032,  1032,  1033,  1033,  1033,  1033,  1033,
-    1034,  1034,  1034,  1034,  1034,  1035,  1035,  1035,  1035,  1035,  1036,
-    1036,  1036,  1036,  1037,  1037,  1037,  1037,  1037,  1038,  1038,  1038,
-    1038,  1038,  1039,  1039,  1039,  1039,  1039,  1040,  1040,  1040,  1040,
-    1041,  1041,  1041,  1041,  1041,  1042,  1042,  1042,  1042,  1042,  1043,
-    1043,  1043,  1043,  1043,  1044,  1044,  1044,  1044,  1045,  1045,  1045,
-    1045,  1045,  1046,  1046,  1046,  1046,  1046,  1047,  1047,  1047,  1047,
-    1047,  1048,  1048,  1048,  1048,  1049,  1049,  1049,  1049,  1049,  1050,
-    1050,  1050,  1050,  1050,  1051,  1051,  1051,  1051,  1052,  1052,  1052,
-    1052,  1052,  1053,  1053,  1053,  1053,  1053,  1054,  1054,  1054,  1054,
-    1054,  1055,  1055,  1055,  1055,  1056,  1056,  1056,  1056,  1056,  1057,
-    1057,  1057,  1057,  1057,  1058,  1058,  1058,  1058,  1059,  1059,  1059,
-    1059,  1059,  1060,  1060,  1060,  1060,  1060,  1061,  1061,  1061,  1061,
-    1062,  1062,  1062,  1062,  1062,  1063,  1063,  1063,  1063,  1063,  1064,
-    1064,  1064,  1064,  1065,  1065,  1065,  1065,  1065,  1066,  1066,  1066,
-    1066,  1066,  1067,  1067,  1067,  1067,  1068,  1068,  1068,  1068,  1068,
-    1069,  1069,  1069,  1069,  1070,  1070,  1070,  1070,  1070,  1071,  1071,
-    1071,  1071,  1071,  1072,  1072,  1072,  1072,  1073,  1073,  1073,  1073,
-    1073,  1074,  1074,  1074,  1074,  1074,  1075,  1075,  1075,  1075,  1076,
-    1076,  1076,  1076,  1076,  1077,  1077,  1077,  1077,  1078,  1078,  1078,
-    1078,  1078,  1079,  1079,  1079,  1079,  1079,  1080,  1080,  1080,  1080,
-    1081,  1081,  1081,  1081,  1081,  1082,  1082,  1082,  1082,  1083,  1083,
-    1083,  1083,  1083,  1084,  1084,  1084,  1084,  1084,  1085,  1085,  1085,
-    1085,  1086,  1086,  1086,  1086,  1086,  1087,  1087,  1087,  1087,  1088,
-    1088,  1088,  1088,  1088,  1089,  1089,  1089,  1089,  1090,  1090,  1090,
-    1090,  1090,  1091,  1091,  1091,  1091,  1092,  1092,  1092,  1092,  1092,
-    1093,  1093,  1093,  1093,  1093,  1094,  1094,  1094,  1094,  1095,  1095,
-    1095,  1095,  1095,  1096,  1096,  1096,  1096,  1097,  1097,  1097,  1097,
-    1097,  1098,  1098,  1098,  1098,  1099,  1099,  1099,  1099,  1099,  1100,
-    1100,  1100,  1100,  1101,  1101,  1101,  1101,  1101,  1102,  1102,  1102,
-    1102,  1103,  1103,  1103,  1103,  1103,  1104,  1104,  1104,  1104,  1105,
-    1105,  1105,  1105,  1105,  1106,  1106,  1106,  1106,  1107,  1107,  1107,
-    1107,  1107,  1108,  1108,  1108,  1108,  1109,  1109,  1109,  1109,  1109,
-    1110,  1110,  1110,  1110,  1111,  1111,  1111,  1111,  1111,  1112,  1112,
-    1112,  1112,  1113,  1113,  1113,  1113,  1114,  1114,  1114,  1114,  1114,
-    1115,  1115,  1115,  1115,  1116,  1116,  1116,  1116,  1116,  1117,  1117,
-    1117,  1117,  1118,  1118,  1118,  1118,  1118,  1119,  1119,  1119,  1119,
-    1120,  1120,  1120,  1120,  1120,  1121,  1121,  1121,  1121,  1122,  1122,
-    1122,  1122,  1123,  1123,  1123,  1123,  1123,  1124,  1124,  1124,  1124,
-    1125,  1125,  1125,  1125,  1125,  1126,  1126,  1126,  1126,  1127,  1127,
-    1127,  1127,  1127,  1128,  1128,  1128,  1128,  1129,  1129,  1129,  1129,
-    1130,  1130,  1130,  1130,  1130,  1131,  1131,  1131,  1131,  1132,  1132,
-    1132,  1132,  1132,  1133,  1133,  1133,  1133,  1134,  1134,  1134,  1134,
-    1135,  1135,  1135,  1135,  1135,  1136,  1136,  1136,  1136,  1137,  1137,
-    1137,  1137,  1138,  1138,  1138,  1138,  1138,  1139,  1139,  1139,  1139,
-    1140,  1140,  1140,  1140,  1140,  1141,  1141,  1141,  1141,  1142,  1142,
-    1142,  1142,  1143,  1143,  1143,  1143,  1143,  1144,  1144,  1144,  1144,
-    1145,  1145,  1145,  1145,  1146,  1146,  1146,  1146,  1146,  1147,  1147,
-    1147,  1147,  1148,  1148,  1148,  1148,  1149,  1149,  1149,  1149,  1149,
-    1150,  1150,  1150,  1150,  1151,  1151,  1151,  1151,  1152,  1152,  1152,
-    1152,  1152,  1153,  1153,  1153,  1153,  1154,  1154,  1154,  1154,  1155,
-    1155,  1155,  1155,  1155,  1156,  1156,  1156,  1156,  1157,  1157,  1157,
-    1157,  1158,  1158,  1158,  1158,  1159,  1159,  1159,  1159,  1159,  1160,
-    1160,  1160,  1160,  1161,  1161,  1161,  1161,  1162,  1162,  1162,  1162,
-    1162,  1163,  1163,  1163,  1163,  1164,  1164,  1164,  1164,  1165,  1165,
-    1165,  1165,  1166,  1166,  1166,  1166,  1166,  1167,  1167,  1167,  1167,
-    1168,  1168,  1168,  1168,  1169,  1169,  1169,  1169,  1170,  1170,  1170,
-    1170,  1170,  1171,  1171,  1171,  1171,  1172,  1172,  1172,  1172,  1173,
-    1173,  1173,  1173,  1174,  1174,  1174,  1174,  1174,  1175,  1175,  1175,
-    1175,  1176,  1176,  1176,  1176,  1177,  1177,  1177,  1177,  1178,  1178,
-    1178,  1178,  1178,  1179,  1179,  1179,  1179,  1180,  1180,  1180,  1180,
-    1181,  1181,  1181,  1181,  1182,  1182,  1182,  1182,  1183,  1183,  1183,
-    1183,  1183,  1184,  1184,  1184,  1184,  1185,  1185,  1185,  1185,  1186,
-    1186,  1186,  1186,  1187,  1187,  1187,  1187,  1187,  1188,  1188,  1188,
-    1188,  1189,  1189,  1189,  1189,  1190,  1190,  1190,  1190,  1191,  1191,
-    1191,  1191,  1192,  1192,  1192,  1192,  1193,  1193,  1193,  1193,  1193,
-    1194,  1194,  1194,  1194,  1195,  1195,  1195,  1195,  1196,  1196,  1196,
-    1196,  1197,  1197,  1197,  1197,  1198,  1198,  1198,  1198,  1199,  1199,
-    1199,  1199,  1199,  1200,  1200,  1200,  1200,  1201,  1201,  1201,  1201,
-    1202,  1202,  1202,  1202,  1203,  1203,  1203,  1203,  1204,  1204,  1204,
-    1204,  1205,  1205,  1205,  1205,  1205,  1206,  1206,  1206,  1206,  1207,
-    1207,  1207,  1207,  1208,  1208,  1208,  1208,  1209,  1209,  1209,  1209,
-    1210,  1210,  1210,  1210,  1211,  1211,  1211,  1211,  1212,  1212,  1212,
-    1212,  1213,  1213,  1213,  1213,  1214,  1214,  1214,  1214,  1214,  1215,
-    1215,  1215,  1215,  1216,  1216,  1216,  1216,  1217,  1217,  1217,  1217,
-    1218,  1218,  1218,  1218,  1219,  1219,  1219,  1219,  1220,  1220,  1220,
-    1220,  1221,  1221,  1221,  1221,  1222,  1222,  1222,  1222,  1223,  1223,
-    1223,  1223,  1224,  1224,  1224,  1224,  1224,  1225,  1225,  1225,  1225,
-    1226,  1226,  1226,  1226,  1227,  1227,  1227,  1227,  1228,  1228,  1228,
-    1228,  1229,  1229,  1229,  1229,  1230,  1230,  1230,  1230,  1231,  1231,
-    1231,  1231,  1232,  1232,  1232,  1232,  1233,  1233,  1233,  1233,  1234,
-    1234,  1234,  1234,  1235,  1235,  1235,  1235,  1236,  1236,  1236,  1236,
-    1237,  1237,  1237,  1237,  1238,  1238,  1238,  1238,  1239,  1239,  1239,
-    1239,  1240,  1240,  1240,  1240,  1241,  1241,  1241,  1241,  1242,  1242,
-    1242,  1242,  1243,  1243,  1243,  1243,  1244,  1244,  1244,  1244,  1245,
-    1245,  1245,  1245,  1246,  1246,  1246,  1246,  1247,  1247,  1247,  1247,
-    1248,  1248,  1248,  1248,  1249,  1249,  1249,  1249,  1250,  1250,  1250,
-    1250,  1251,  1251,  1251,  1251,  1252,  1252,  1252,  1252,  1253,  1253,
-    1253,  1253,  1254,  1254,  1254,  1254,  1255,  1255,  1255,  1255,  1256,
-    1256,  1256,  1256,  1257,  1257,  1257,  1257,  1258,  1258,  1258,  1258,
-    1259,  1259,  1259,  1259,  1260,  1260,  1260,  1260,  1261,  1261,  1261,
-    1261,  1262,  1262,  1262,  1262,  1263,  1263,  1263,  1263,  1264,  1264,
-    1264,  1264,  1265,  1265,  1265,  1265,  1266,  1266,  1266,  1266,  1267,
-    1267,  1267,  1267,  1268,  1268,  1268,  1268,  1269,  1269,  1269,  1269,
-    1270,  1270,  1270,  1270,  1271,  1271,  1271,  1271,  1272,  1272,  1272,
-    1272,  1273,  1273,  1273,  1273,  1274,  1274,  1274,  1275,  1275,  1275,
-    1275,  1276,  1276,  1276,  1276,  1277,  1277,  1277,  1277,  1278,  1278,
-    1278,  1278,  1279,  1279,  1279,  1279,  1280,  1280,  1280,  1280,  1281,
-    1281,  1281,  1281,  1282,  1282,  1282,  1282,  1283,  1283,  1283,  1283,
-    1284,  1284,  1284,  1284,  1285,  1285,  1285,  1286,  1286,  1286,  1286,
-    1287,  1287,  1287,  1287,  1288,  1288,  1288,  1288,  1289,  1289,  1289,
-    1289,  1290,  1290,  1290,  1290,  1291,  1291,  1291,  1291,  1292,  1292,
-    1292,  1292,  1293,  1293,  1293,  1294,  1294,  1294,  1294,  1295,  1295,
-    1295,  1295,  1296,  1296,  1296,  1296,  1297,  1297,  1297,  1297,  1298,
-    1298,  1298,  1298,  1299,  1299,  1299,  1299,  1300,  1300,  1300,  1301,
-    1301,  1301,  1301,  1302,  1302,  1302,  1302,  1303,  1303,  1303,  1303,
-    1304,  1304,  1304,  1304,  1305,  1305,  1305,  1305,  1306,  1306,  1306,
-    1306,  1307,  1307,  1307,  1308,  1308,  1308,  1308,  1309,  1309,  1309,
-    1309,  1310,  1310,  1310,  1310,  1311,  1311,  1311,  1311,  1312,  1312,
-    1312,  1313,  1313,  1313,  1313,  1314,  1314,  1314,  1314,  1315,  1315,
-    1315,  1315,  1316,  1316,  1316,  1316,  1317,  1317,  1317,  1318,  1318,
-    1318,  1318,  1319,  1319,  1319,  1319,  1320,  1320,  1320,  1320,  1321,
-    1321,  1321,  1321,  1322,  1322,  1322,  1323,  1323,  1323,  1323,  1324,
-    1324,  1324,  1324,  1325,  1325,  1325,  1325,  1326,  1326,  1326,  1326,
-    1327,  1327,  1327,  1328,  1328,  1328,  1328,  1329,  1329,  1329,  1329,
-    1330,  1330,  1330,  1330,  1331,  1331,  1331,  1332,  1332,  1332,  1332,
-    1333,  1333,  1333,  1333,  1334,  1334,  1334,  1334,  1335,  1335,  1335,
-    1336,  1336,  1336,  1336,  1337,  1337,  1337,  1337,  1338,  1338,  1338,
-    1338,  1339,  1339,  1339,  1340,  1340,  1340,  1340,  1341,  1341,  1341,
-    1341,  1342,  1342,  1342,  1342,  1343,  1343,  1343,  1344,  1344,  1344,
-    1344,  1345,  1345,  1345,  1345,  1346,  1346,  1346,  1346,  1347,  1347,
-    1347,  1348,  1348,  1348,  1348,  1349,  1349,  1349,  1349,  1350,  1350,
-    1350,  1351,  1351,  1351,  1351,  1352,  1352,  1352,  1352,  1353,  1353,
-    1353,  1353,  1354,  1354,  1354,  1355,  1355,  1355,  1355,  1356,  1356,
-    1356,  1356,  1357,  1357,  1357,  1358,  1358,  1358,  1358,  1359,  1359,
-    1359,  1359,  1360,  1360,  1360,  1361,  1361,  1361,  1361,  1362,  1362,
-    1362,  1362,  1363,  1363,  1363,  1363,  1364,  1364,  1364,  1365,  1365,
-    1365,  1365,  1366,  1366,  1366,  1366,  1367,  1367,  1367,  1368,  1368,
-    1368,  1368,  1369,  1369,  1369,  1369,  1370,  1370,  1370,  1371,  1371,
-    1371,  1371,  1372,  1372,  1372,  1372,  1373,  1373,  1373,  1374,  1374,
-    1374,  1374,  1375,  1375,  1375,  1376,  1376,  1376,  1376,  1377,  1377,
-    1377,  1377,  1378,  1378,  1378,  1379,  1379,  1379,  1379,  1380,  1380,
-    1380,  1380,  1381,  1381,  1381,  1382,  1382,  1382,  1382,  1383,  1383,
-    1383,  1383,  1384,  1384,  1384,  1385,  1385,  1385,  1385,  1386,  1386,
-    1386,  1387,  1387,  1387,  1387,  1388,  1388,  1388,  1388,  1389,  1389,
-    1389,  1390,  1390,  1390,  1390,  1391,  1391,  1391,  1391,  1392,  1392,
-    1392,  1393,  1393,  1393,  1393,  1394,  1394,  1394,  1395,  1395,  1395,
-    1395,  1396,  1396,  1396,  1396,  1397,  1397,  1397,  1398,  1398,  1398,
-    1398,  1399,  1399,  1399,  1400,  1400,  1400,  1400,  1401,  1401,  1401,
-    1402,  1402,  1402,  1402,  1403,  1403,  1403,  1403,  1404,  1404,  1404,
-    1405,  1405,  1405,  1405,  1406,  1406,  1406,  1407,  1407,  1407,  1407,
-    1408,  1408,  1408,  1408,  1409,  1409,  1409,  1410,  1410,  1410,  1410,
-    1411,  1411,  1411,  1412,  1412,  1412,  1412,  1413,  1413,  1413,  1414,
-    1414,  1414,  1414,  1415,  1415,  1415,  1416,  1416,  1416,  1416,  1417,
-    1417,  1417,  1417,  1418,  1418,  1418,  1419,  1419,  1419,  1419,  1420,
-    1420,  1420,  1421,  1421,  1421,  1421,  1422,  1422,  1422,  1423,  1423,
-    1423,  1423,  1424,  1424,  1424,  1425,  1425,  1425,  1425,  1426,  1426,
-    1426,  1427,  1427,  1427,  1427,  1428,  1428,  1428,  1429,  1429,  1429,
-    1429,  1430,  1430,  1430,  1431,  1431,  1431,  1431,  1432,  1432,  1432,
-    1433,  1433,  1433,  1433,  1434,  1434,  1434,  1435,  1435,  1435,  1435,
-    1436,  1436,  1436,  1437,  1437,  1437,  1437,  1438,  1438,  1438,  1439,
-    1439,  1439,  1439,  1440,  1440,  1440,  1441,  1441,  1441,  1441,  1442,
-    1442,  1442,  1443,  1443,  1443,  1443,  1444,  1444,  1444,  1445,  1445,
-    1445,  1445,  1446,  1446,  1446,  1447,  1447,  1447,  1447,  1448,  1448,
-    1448,  1449,  1449,  1449,  1449,  1450,  1450,  1450,  1451,  1451,  1451,
-    1451,  1452,  1452,  1452,  1453,  1453,  1453,  1453,  1454,  1454,  1454,
-    1455,  1455,  1455,  1455,  1456,  1456,  1456,  1457,  1457,  1457,  1458,
-    1458,  1458,  1458,  1459,  1459,  1459,  1460,  1460,  1460,  1460,  1461,
-    1461,  1461,  1462,  1462,  1462,  1462,  1463,  1463,  1463,  1464,  1464,
-    1464,  1464,  1465,  1465,  1465,  1466,  1466,  1466,  1467,  1467,  1467,
-    1467,  1468,  1468,  1468,  1469,  1469,  1469,  1469,  1470,  1470,  1470,
-    1471,  1471,  1471,  1471,  1472,  1472,  1472,  1473,  1473,  1473,  1474,
-    1474,  1474,  1474,  1475,  1475,  1475,  1476,  1476,  1476,  1476,  1477,
-    1477,  1477,  1478,  1478,  1478,  1479,  1479,  1479,  1479,  1480,  1480,
-    1480,  1481,  1481,  1481,  1481,  1482,  1482,  1482,  1483,  1483,  1483,
-    1484,  1484,  1484,  1484,  1485,  1485,  1485,  1486,  1486,  1486,  1486,
-    1487,  1487,  1487,  1488,  1488,  1488,  1489,  1489,  1489,  1489,  1490,
-    1490,  1490,  1491,  1491,  1491,  1492,  1492,  1492,  1492,  1493,  1493,
-    1493,  1494,  1494,  1494,  1494,  1495,  1495,  1495,  1496,  1496,  1496,
-    1497,  1497,  1497,  1497,  1498,  1498,  1498,  1499,  1499,  1499,  1500,
-    1500,  1500,  1500,  1501,  1501,  1501,  1502,  1502,  1502,  1503,  1503,
-    1503,  1503,  1504,  1504,  1504,  1505,  1505,  1505,  1505,  1506,  1506,
-    1506,  1507,  1507,  1507,  1508,  1508,  1508,  1508,  1509,  1509,  1509,
-    1510,  1510,  1510,  1511,  1511,  1511,  1511,  1512,  1512,  1512,  1513,
-    1513,  1513,  1514,  1514,  1514,  1514,  1515,  1515,  1515,  1516,  1516,
-    1516,  1517,  1517,  1517,  1517,  1518,  1518,  1518,  1519,  1519,  1519,
-    1520,  1520,  1520,  1521,  1521,  1521,  1521,  1522,  1522,  1522,  1523,
-    1523,  1523,  1524,  1524,  1524,  1524,  1525,  1525,  1525,  1526,  1526,
-    1526,  1527,  1527,  1527,  1527,  1528,  1528,  1528,  1529,  1529,  1529,
-    1530,  1530,  1530,  1530,  1531,  1531,  1531,  1532,  1532,  1532,  1533,
-    1533,  1533,  1534,  1534,  1534,  1534,  1535,  1535,  1535,  1536,  1536,
-    1536,  1537,  1537,  1537,  1537,  1538,  1538,  1538,  1539,  1539,  1539,
-    1540,  1540,  1540,  1541,  1541,  1541,  1541,  1542,  1542,  1542,  1543,
-    1543,  1543,  1544,  1544,  1544,  1545,  1545,  1545,  1545,  1546,  1546,
-    1546,  1547,  1547,  1547,  1548,  1548,  1548,  1549,  1549,  1549,  1549,
-    1550,  1550,  1550,  1551,  1551,  1551,  1552,  1552,  1552,  1552,  1553,
-    1553,  1553,  1554,  1554,  1554,  1555,  1555,  1555,  1556,  1556,  1556,
-    1557,  1557,  1557,  1557,  1558,  1558,  1558,  1559,  1559,  1559,  1560,
-    1560,  1560,  1561,  1561,  1561,  1561,  1562,  1562,  1562,  1563,  1563,
-    1563,  1564,  1564,  1564,  1565,  1565,  1565,  1565,  1566,  1566,  1566,
-    1567,  1567,  1567,  1568,  1568,  1568,  1569,  1569,  1569,  1570,  1570,
-    1570,  1570,  1571,  1571,  1571,  1572,  1572,  1572,  1573,  1573,  1573,
-    1574,  1574,  1574,  1575,  1575,  1575,  1575,  1576,  1576,  1576,  1577,
-    1577,  1577,  1578,  1578,  1578,  1579,  1579,  1579,  1580,  1580,  1580,
-    1580,  1581,  1581,  1581,  1582,  1582,  1582,  1583,  1583,  1583,  1584,
-    1584,  1584,  1585,  1585,  1585,  1585,  1586,  1586,  1586,  1587,  1587,
-    1587,  1588,  1588,  1588,  1589,  1589,  1589,  1590,  1590,  1590,  1590,
-    1591,  1591,  1591,  1592,  1592,  1592,  1593,  1593,  1593,  1594,  1594,
-    1594,  1595,  1595,  1595,  1596,  1596,  1596,  1596,  1597,  1597,  1597,
-    1598,  1598,  1598,  1599,  1599,  1599,  1600,  1600,  1600,  1601,  1601,
-    1601,  1602,  1602,  1602,  1603,  1603,  1603,  1603,  1604,  1604,  1604,
-    1605,  1605,  1605,  1606,  1606,  1606,  1607,  1607,  1607,  1608,  1608,
-    1608,  1609,  1609,  1609,  1609,  1610,  1610,  1610,  1611,  1611,  1611,
-    1612,  1612,  1612,  1613,  1613,  1613,  1614,  1614,  1614,  1615,  1615,
-    1615,  1616,  1616,  1616,  1617,  1617,  1617,  1617,  1618,  1618,  1618,
-    1619,  1619,  1619,  1620,  1620,  1620,  1621,  1621,  1621,  1622,  1622,
-    1622,  1623,  1623,  1623,  1624,  1624,  1624,  1625,  1625,  1625,  1626,
-    1626,  1626,  1626,  1627,  1627,  1627,  1628,  1628,  1628,  1629,  1629,
-    1629,  1630,  1630,  1630,  1631,  1631,  1631,  1632,  1632,  1632,  1633,
-    1633,  1633,  1634,  1634,  1634,  1635,  1635,  1635,  1636,  1636,  1636,
-    1636,  1637,  1637,  1637,  1638,  1638,  1638,  1639,  1639,  1639,  1640,
-    1640,  1640,  1641,  1641,  1641,  1642,  1642,  1642,  1643,  1643,  1643,
-    1644,  1644,  1644,  1645,  1645,  1645,  1646,  1646,  1646,  1647,  1647,
-    1647,  1648,  1648,  1648,  1649,  1649,  1649,  1649,  1650,  1650,  1650,
-    1651,  1651,  1651,  1652,  1652,  1652,  1653,  1653,  1653,  1654,  1654,
-    1654,  1655,  1655,  1655,  1656,  1656,  1656,  1657,  1657,  1657,  1658,
-    1658,  1658,  1659,  1659,  1659,  1660,  1660,  1660,  1661,  1661,  1661,
-    1662,  1662,  1662,  1663,  1663,  1663,  1664,  1664,  1664,  1665,  1665,
-    1665,  1666,  1666,  1666,  1667,  1667,  1667,  1668,  1668,  1668,  1669,
-    1669,  1669,  1669,  1670,  1670,  1670,  1671,  1671,  1671,  1672,  1672,
-    1672,  1673,  1673,  1673,  1674,  1674,  1674,  1675,  1675,  1675,  1676,
-    1676,  1676,  1677,  1677,  1677,  1678,  1678,  1678,  1679,  1679,  1679,
-    1680,  1680,  1680,  1681,  1681,  1681,  1682,  1682,  1682,  1683,  1683,
-    1683,  1684,  1684,  1684,  1685,  1685,  1685,  1686,  1686,  1686,  1687,
-    1687,  1687,  1688,  1688,  1688,  1689,  1689,  1689,  1690,  1690,  1690,
-    1691,  1691,  1691,  1692,  1692,  1692,  1693,  1693,  1693,  1694,  1694,
-    1694,  1695,  1695,  1695,  1696,  1696,  1696,  1697,  1697,  1697,  1698,
-    1698,  1698,  1699,  1699,  1699,  1700,  1700,  1700,  1701,  1701,  1701,
-    1702,  1702,  1702,  1703,  1703,  1703,  1704,  1704,  1705,  1705,  1705,
-    1706,  1706,  1706,  1707,  1707,  1707,  1708,  1708,  1708,  1709,  1709,
-    1709,  1710,  1710,  1710,  1711,  1711,  1711,  1712,  1712,  1712,  1713,
-    1713,  1713,  1714,  1714,  1714,  1715,  1715,  1715,  1716,  1716,  1716,
-    1717,  1717,  1717,  1718,  1718,  1718,  1719,  1719,  1719,  1720,  1720,
-    1720,  1721,  1721,  1721,  1722,  1722,  1722,  1723,  1723,  1723,  1724,
-    1724,  1724,  1725,  1725,  1726,  1726,  1726,  1727,  1727,  1727,  1728,
-    1728,  1728,  1729,  1729,  1729,  1730,  1730,  1730,  1731,  1731,  1731,
-    1732,  1732,  1732,  1733,  1733,  1733,  1734,  1734,  1734,  1735,  1735,
-    1735,  1736,  1736,  1736,  1737,  1737,  1737,  1738,  1738,  1738,  1739,
-    1739,  1740,  1740,  1740,  1741,  1741,  1741,  1742,  1742,  1742,  1743,
-    1743,  1743,  1744,  1744,  1744,  1745,  1745,  1745,  1746,  1746,  1746,
-    1747,  1747,  1747,  1748,  1748,  1748,  1749,  1749,  1750,  1750,  1750,
-    1751,  1751,  1751,  1752,  1752,  1752,  1753,  1753,  1753,  1754,  1754,
-    1754,  1755,  1755,  1755,  1756,  1756,  1756,  1757,  1757,  1757,  1758,
-    1758,  1759,  1759,  1759,  1760,  1760,  1760,  1761,  1761,  1761,  1762,
-    1762,  1762,  1763,  1763,  1763,  1764,  1764,  1764,  1765,  1765,  1765,
-    1766,  1766,  1767,  1767,  1767,  1768,  1768,  1768,  1769,  1769,  1769,
-    1770,  1770,  1770,  1771,  1771,  1771,  1772,  1772,  1772,  1773,  1773,
-    1773,  1774,  1774,  1775,  1775,  1775,  1776,  1776,  1776,  1777,  1777,
-    1777,  1778,  1778,  1778,  1779,  1779,  1779,  1780,  1780,  1781,  1781,
-    1781,  1782,  1782,  1782,  1783,  1783,  1783,  1784,  1784,  1784,  1785,
-    1785,  1785,  1786,  1786,  1786,  1787,  1787,  1788,  1788,  1788,  1789,
-    1789,  1789,  1790,  1790,  1790,  1791,  1791,  1791,  1792,  1792,  1792,
-    1793,  1793,  1794,  1794,  1794,  1795,  1795,  1795,  1796,  1796,  1796,
-    1797,  1797,  1797,  1798,  1798,  1799,  1799,  1799,  1800,  1800,  1800,
-    1801,  1801,  1801,  1802,  1802,  1802,  1803,  1803,  1803,  1804,  1804,
-    1805,  1805,  1805,  1806,  1806,  1806,  1807,  1807,  1807,  1808,  1808,
-    1808,  1809,  1809,  1810,  1810,  1810,  1811,  1811,  1811,  1812,  1812,
-    1812,  1813,  1813,  1813,  1814,  1814,  1815,  1815,  1815,  1816,  1816,
-    1816,  1817,  1817,  1817,  1818,  1818,  1818,  1819,  1819,  1820,  1820,
-    1820,  1821,  1821,  1821,  1822,  1822,  1822,  1823,  1823,  1823,  1824,
-    1824,  1825,  1825,  1825,  1826,  1826,  1826,  1827,  1827,  1827,  1828,
-    1828,  1829,  1829,  1829,  1830,  1830,  1830,  1831,  1831,  1831,  1832,
-    1832,  1832,  1833,  1833,  1834,  1834,  1834,  1835,  1835,  1835,  1836,
-    1836,  1836,  1837,  1837,  1838,  1838,  1838,  1839,  1839,  1839,  1840,
-    1840,  1840,  1841,  1841,  1842,  1842,  1842,  1843,  1843,  1843,  1844,
-    1844,  1844,  1845,  1845,  1846,  1846,  1846,  1847,  1847,  1847,  1848,
-    1848,  1848,  1849,  1849,  1850,  1850,  1850,  1851,  1851,  1851,  1852,
-    1852,  1852,  1853,  1853,  1854,  1854,  1854,  1855,  1855,  1855,  1856,
-    1856,  1856,  1857,  1857,  1858,  1858,  1858,  1859,  1859,  1859,  1860,
-    1860,  1861,  1861,  1861,  1862,  1862,  1862,  1863,  1863,  1863,  1864,
-    1864,  1865,  1865,  1865,  1866,  1866,  1866,  1867,  1867,  1867,  1868,
-    1868,  1869,  1869,  1869,  1870,  1870,  1870,  1871,  1871,  1872,  1872,
-    1872,  1873,  1873,  1873,  1874,  1874,  1874,  1875,  1875,  1876,  1876,
-    1876,  1877,  1877,  1877,  1878,  1878,  1879,  1879,  1879,  1880,  1880,
-    1880,  1881,  1881,  1882,  1882,  1882,  1883,  1883,  1883,  1884,  1884,
-    1884,  1885,  1885,  1886,  1886,  1886,  1887,  1887,  1887,  1888,  1888,
-    1889,  1889,  1889,  1890,  1890,  1890,  1891,  1891,  1892,  1892,  1892,
-    1893,  1893,  1893,  1894,  1894,  1895,  1895,  1895,  1896,  1896,  1896,
-    1897,  1897,  1897,  1898,  1898,  1899,  1899,  1899,  1900,  1900,  1900,
-    1901,  1901,  1902,  1902,  1902,  1903,  1903,  1903,  1904,  1904,  1905,
-    1905,  1905,  1906,  1906,  1906,  1907,  1907,  1908,  1908,  1908,  1909,
-    1909,  1909,  1910,  1910,  1911,  1911,  1911,  1912,  1912,  1912,  1913,
-    1913,  1914,  1914,  1914,  1915,  1915,  1916,  1916,  1916,  1917,  1917,
-    1917,  1918,  1918,  1919,  1919,  1919,  1920,  1920,  1920,  1921,  1921,
-    1922,  1922,  1922,  1923,  1923,  1923,  1924,  1924,  1925,  1925,  1925,
-    1926,  1926,  1926,  1927,  1927,  1928,  1928,  1928,  1929,  1929,  1929,
-    1930,  1930,  1931,  1931,  1931,  1932,  1932,  1933,  1933,  1933,  1934,
-    1934,  1934,  1935,  1935,  1936,  1936,  1936,  1937,  1937,  1937,  1938,
-    1938,  1939,  1939,  1939,  1940,  1940,  1941,  1941,  1941,  1942,  1942,
-    1942,  1943,  1943,  1944,  1944,  1944,  1945,  1945,  1946,  1946,  1946,
-    1947,  1947,  1947,  1948,  1948,  1949,  1949,  1949,  1950,  1950,  1950,
-    1951,  1951,  1952,  1952,  1952,  1953,  1953,  1954,  1954,  1954,  1955,
-    1955,  1955,  1956,  1956,  1957,  1957,  1957,  1958,  1958,  1959,  1959,
-    1959,  1960,  1960,  1960,  1961,  1961,  1962,  1962,  1962,  1963,  1963,
-    1964,  1964,  1964,  1965,  1965,  1965,  1966,  1966,  1967,  1967,  1967,
-    1968,  1968,  1969,  1969,  1969,  1970,  1970,  1971,  1971,  1971,  1972,
-    1972,  1972,  1973,  1973,  1974,  1974,  1974,  1975,  1975,  1976,  1976,
-    1976,  1977,  1977,  1978,  1978,  1978,  1979,  1979,  1979,  1980,  1980,
-    1981,  1981,  1981,  1982,  1982,  1983,  1983,  1983,  1984,  1984,  1985,
-    1985,  1985,  1986,  1986,  1986,  1987,  1987,  1988,  1988,  1988,  1989,
-    1989,  1990,  1990,  1990,  1991,  1991,  1992,  1992,  1992,  1993,  1993,
-    1994,  1994,  1994,  1995,  1995,  1995,  1996,  1996,  1997,  1997,  1997,
-    1998,  1998,  1999,  1999,  1999,  2000,  2000,  2001,  2001,  2001,  2002,
-    2002,  2003,  2003,  2003,  2004,  2004,  2005,  2005,  2005,  2006,  2006,
-    2006,  2007,  2007,  2008,  2008,  2008,  2009,  2009,  2010,  2010,  2010,
-    2011,  2011,  2012,  2012,  2012,  2013,  2013,  2014,  2014,  2014,  2015,
-    2015,  2016,  2016,  2016,  2017,  2017,  2018,  2018,  2018,  2019,  2019,
-    2020,  2020,  2020,  2021,  2021,  2022,  2022,  2022,  2023,  2023,  2023,
-    2024,  2024,  2025,  2025,  2025,  2026,  2026,  2027,  2027,  2027,  2028,
-    2028,  2029,  2029,  2029,  2030,  2030,  2031,  2031,  2031,  2032,  2032,
-    2033,  2033,  2033,  2034,  2034,  2035,  2035,  2035,  2036,  2036,  2037,
-    2037,  2037,  2038,  2038,  2039,  2039,  2039,  2040,  2040,  2041,  2041,
-    2041,  2042,  2042,  2043,  2043,  2043,  2044,  2044,  2045,  2045,  2045,
-    2046,  2046,  2047,  2047,  2047,  2048,  2048,  2049,  2049,  2049,  2050,
-    2050,  2051,  2051,  2052,  2052,  2052,  2053,  2053,  2054,  2054,  2054,
-    2055,  2055,  2056,  2056,  2056,  2057,  2057,  2058,  2058,  2058,  2059,
-    2059,  2060,  2060,  2060,  2061,  2061,  2062,  2062,  2062,  2063,  2063,
-    2064,  2064,  2064,  2065,  2065,  2066,  2066,  2066,  2067,  2067,  2068,
-    2068,  2068,  2069,  2069,  2070,  2070,  2071,  2071,  2071,  2072,  2072,
-    2073,  2073,  2073,  2074,  2074,  2075,  2075,  2075,  2076,  2076,  2077,
-    2077,  2077,  2078,  2078,  2079,  2079,  2079,  2080,  2080,  2081,  2081,
-    2082,  2082,  2082,  2083,  2083,  2084,  2084,  2084,  2085,  2085,  2086,
-    2086,  2086,  2087,  2087,  2088,  2088,  2088,  2089,  2089,  2090,  2090,
-    2091,  2091,  2091,  2092,  2092,  2093,  2093,  2093,  2094,  2094,  2095,
-    2095,  2095,  2096,  2096,  2097,  2097,  2098,  2098,  2098,  2099,  2099,
-    2100,  2100,  2100,  2101,  2101,  2102,  2102,  2102,  2103,  2103,  2104,
-    2104,  2105,  2105,  2105,  2106,  2106,  2107,  2107,  2107,  2108,  2108,
-    2109,  2109,  2109,  2110,  2110,  2111,  2111,  2112,  2112,  2112,  2113,
-    2113,  2114,  2114,  2114,  2115,  2115,  2116,  2116,  2117,  2117,  2117,
-    2118,  2118,  2119,  2119,  2119,  2120,  2120,  2121,  2121,  2122,  2122,
-    2122,  2123,  2123,  2124,  2124,  2124,  2125,  2125,  2126,  2126,  2127,
-    2127,  2127,  2128,  2128,  2129,  2129,  2129,  2130,  2130,  2131,  2131,
-    2132,  2132,  2132,  2133,  2133,  2134,  2134,  2134,  2135,  2135,  2136,
-    2136,  2137,  2137,  2137,  2138,  2138,  2139,  2139,  2139,  2140,  2140,
-    2141,  2141,  2142,  2142,  2142,  2143,  2143,  2144,  2144,  2145,  2145,
-    2145,  2146,  2146,  2147,  2147,  2147,  2148,  2148,  2149,  2149,  2150,
-    2150,  2150,  2151,  2151,  2152,  2152,  2153,  2153,  2153,  2154,  2154,
-    2155,  2155,  2155,  2156,  2156,  2157,  2157,  2158,  2158,  2158,  2159,
-    2159,  2160,  2160,  2161,  2161,  2161,  2162,  2162,  2163,  2163,  2164,
-    2164,  2164,  2165,  2165,  2166,  2166,  2166,  2167,  2167,  2168,  2168,
-    2169,  2169,  2169,  2170,  2170,  2171,  2171,  2172,  2172,  2172,  2173,
-    2173,  2174,  2174,  2175,  2175,  2175,  2176,  2176,  2177,  2177,  2178,
-    2178,  2178,  2179,  2179,  2180,  2180,  2181,  2181,  2181,  2182,  2182,
-    2183,  2183,  2184,  2184,  2184,  2185,  2185,  2186,  2186,  2187,  2187,
-    2187,  2188,  2188,  2189,  2189,  2190,  2190,  2190,  2191,  2191,  2192,
-    2192,  2193,  2193,  2193,  2194,  2194,  2195,  2195,  2196,  2196,  2196,
-    2197,  2197,  2198,  2198,  2199,  2199,  2199,  2200,  2200,  2201,  2201,
-    2202,  2202,  2202,  2203,  2203,  2204,  2204,  2205,  2205,  2205,  2206,
-    2206,  2207,  2207,  2208,  2208,  2208,  2209,  2209,  2210,  2210,  2211,
-    2211,  2212,  2212,  2212,  2213,  2213,  2214,  2214,  2215,  2215,  2215,
-    2216,  2216,  2217,  2217,  2218,  2218,  2218,  2219,  2219,  2220,  2220,
-    2221,  2221,  2222,  2222,  2222,  2223,  2223,  2224,  2224,  2225,  2225,
-    2225,  2226,  2226,  2227,  2227,  2228,  2228,  2228,  2229,  2229,  2230,
-    2230,  2231,  2231,  2232,  2232,  2232,  2233,  2233,  2234,  2234,  2235,
-    2235,  2235,  2236,  2236,  2237,  2237,  2238,  2238,  2239,  2239,  2239,
-    2240,  2240,  2241,  2241,  2242,  2242,  2242,  2243,  2243,  2244,  2244,
-    2245,  2245,  2246,  2246,  2246,  2247,  2247,  2248,  2248,  2249,  2249,
-    2250,  2250,  2250,  2251,  2251,  2252,  2252,  2253,  2253,  2253,  2254,
-    2254,  2255,  2255,  2256,  2256,  2257,  2257,  2257,  2258,  2258,  2259,
-    2259,  2260,  2260,  2261,  2261,  2261,  2262,  2262,  2263,  2263,  2264,
-    2264,  2265,  2265,  2265,  2266,  2266,  2267,  2267,  2268,  2268,  2269,
-    2269,  2269,  2270,  2270,  2271,  2271,  2272,  2272,  2273,  2273,  2273,
-    2274,  2274,  2275,  2275,  2276,  2276,  2277,  2277,  2277,  2278,  2278,
-    2279,  2279,  2280,  2280,  2281,  2281,  2281,  2282,  2282,  2283,  2283,
-    2284,  2284,  2285,  2285,  2285,  2286,  2286,  2287,  2287,  2288,  2288,
-    2289,  2289,  2290,  2290,  2290,  2291,  2291,  2292,  2292,  2293,  2293,
-    2294,  2294,  2294,  2295,  2295,  2296,  2296,  2297,  2297,  2298,  2298,
-    2298,  2299,  2299,  2300,  2300,  2301,  2301,  2302,  2302,  2303,  2303,
-    2303,  2304,  2304,  2305,  2305,  2306,  2306,  2307,  2307,  2307,  2308,
-    2308,  2309,  2309,  2310,  2310,  2311,  2311,  2312,  2312,  2312,  2313,
-    2313,  2314,  2314,  2315,  2315,  2316,  2316,  2317,  2317,  2317,  2318,
-    2318,  2319,  2319,  2320,  2320,  2321,  2321,  2322,  2322,  2322,  2323,
-    2323,  2324,  2324,  2325,  2325,  2326,  2326,  2327,  2327,  2327,  2328,
-    2328,  2329,  2329,  2330,  2330,  2331,  2331,  2332,  2332,  2332,  2333,
-    2333,  2334,  2334,  2335,  2335,  2336,  2336,  2337,  2337,  2337,  2338,
-    2338,  2339,  2339,  2340,  2340,  2341,  2341,  2342,  2342,  2343,  2343,
-    2343,  2344,  2344,  2345,  2345,  2346,  2346,  2347,  2347,  2348,  2348,
-    2348,  2349,  2349,  2350,  2350,  2351,  2351,  2352,  2352,  2353,  2353,
-    2354,  2354,  2354,  2355,  2355,  2356,  2356,  2357,  2357,  2358,  2358,
-    2359,  2359,  2360,  2360,  2360,  2361,  2361,  2362,  2362,  2363,  2363,
-    2364,  2364,  2365,  2365,  2366,  2366,  2366,  2367,  2367,  2368,  2368,
-    2369,  2369,  2370,  2370,  2371,  2371,  2372,  2372,  2372,  2373,  2373,
-    2374,  2374,  2375,  2375,  2376,  2376,  2377,  2377,  2378,  2378,  2379,
-    2379,  2379,  2380,  2380,  2381,  2381,  2382,  2382,  2383,  2383,  2384,
-    2384,  2385,  2385,  2386,  2386,  2386,  2387,  2387,  2388,  2388,  2389,
-    2389,  2390,  2390,  2391,  2391,  2392,  2392,  2393,  2393,  2393,  2394,
-    2394,  2395,  2395,  2396,  2396,  2397,  2397,  2398,  2398,  2399,  2399,
-    2400,  2400,  2400,  2401,  2401,  2402,  2402,  2403,  2403,  2404,  2404,
-    2405,  2405,  2406,  2406,  2407,  2407,  2408,  2408,  2408,  2409,  2409,
-    2410,  2410,  2411,  2411,  2412,  2412,  2413,  2413,  2414,  2414,  2415,
-    2415,  2416,  2416,  2416,  2417,  2417,  2418,  2418,  2419,  2419,  2420,
-    2420,  2421,  2421,  2422,  2422,  2423,  2423,  2424,  2424,  2425,  2425,
-    2425,  2426,  2426,  2427,  2427,  2428,  2428,  2429,  2429,  2430,  2430,
-    2431,  2431,  2432,  2432,  2433,  2433,  2434,  2434,  2434,  2435,  2435,
-    2436,  2436,  2437,  2437,  2438,  2438,  2439,  2439,  2440,  2440,  2441,
-    2441,  2442,  2442,  2443,  2443,  2444,  2444,  2444,  2445,  2445,  2446,
-    2446,  2447,  2447,  2448,  2448,  2449,  2449,  2450,  2450,  2451,  2451,
-    2452,  2452,  2453,  2453,  2454,  2454,  2455,  2455,  2456,  2456,  2456,
-    2457,  2457,  2458,  2458,  2459,  2459,  2460,  2460,  2461,  2461,  2462,
-    2462,  2463,  2463,  2464,  2464,  2465,  2465,  2466,  2466,  2467,  2467,
-    2468,  2468,  2468,  2469,  2469,  2470,  2470,  2471,  2471,  2472,  2472,
-    2473,  2473,  2474,  2474,  2475,  2475,  2476,  2476,  2477,  2477,  2478,
-    2478,  2479,  2479,  2480,  2480,  2481,  2481,  2482,  2482,  2483,  2483,
-    2483,  2484,  2484,  2485,  2485,  2486,  2486,  2487,  2487,  2488,  2488,
-    2489,  2489,  2490,  2490,  2491,  2491,  2492,  2492,  2493,  2493,  2494,
-    2494,  2495,  2495,  2496,  2496,  2497,  2497,  2498,  2498,  2499,  2499,
-    2500,  2500,  2501,  2501,  2501,  2502,  2502,  2503,  2503,  2504,  2504,
-    2505,  2505,  2506,  2506,  2507,  2507,  2508,  2508,  2509,  2509,  2510,
-    2510,  2511,  2511,  2512,  2512,  2513,  2513,  2514,  2514,  2515,  2515,
-    2516,  2516,  2517,  2517,  2518,  2518,  2519,  2519,  2520,  2520,  2521,
-    2521,  2522,  2522,  2523,  2523,  2524,  2524,  2525,  2525,  2526,  2526,
-    2527,  2527,  2528,  2528,  2528,  2529,  2529,  2530,  2530,  2531,  2531,
-    2532,  2532,  2533,  2533,  2534,  2534,  2535,  2535,  2536,  2536,  2537,
-    2537,  2538,  2538,  2539,  2539,  2540,  2540,  2541,  2541,  2542,  2542,
-    2543,  2543,  2544,  2544,  2545,  2545,  2546,  2546,  2547,  2547,  2548,
-    2548,  2549,  2549,  2550,  2550,  2551,  2551,  2552,  2552,  2553,  2553,
-    2554,  2554,  2555,  2555,  2556,  2556,  2557,  2557,  2558,  2558,  2559,
-    2559,  2560,  2560,  2561,  2561,  2562,  2562,  2563,  2563,  2564,  2564,
-    2565,  2565,  2566,  2566,  2567,  2567,  2568,  2568,  2569,  2569,  2570,
-    2570,  2571,  2571,  2572,  2572,  2573,  2573,  2574,  2574,  2575,  2575,
-    2576,  2576,  2577,  2577,  2578,  2578,  2579,  2579,  2580,  2580,  2581,
-    2581,  2582,  2582,  2583,  2583,  2584,  2584,  2585,  2585,  2586,  2586,
-    2587,  2587,  2588,  2588,  2589,  2589,  2590,  2590,  2591,  2591,  2592,
-    2592,  2593,  2593,  2594,  2594,  2595,  2595,  2596,  2596,  2597,  2598,
-    2598,  2599,  2599,  2600,  2600,  2601,  2601,  2602,  2602,  2603,  2603,
-    2604,  2604,  2605,  2605,  2606,  2606,  2607,  2607,  2608,  2608,  2609,
-    2609,  2610,  2610,  2611,  2611,  2612,  2612,  2613,  2613,  2614,  2614,
-    2615,  2615,  2616,  2616,  2617,  2617,  2618,  2618,  2619,  2619,  2620,
-    2620,  2621,  2621,  2622,  2622,  2623,  2623,  2624,  2624,  2625,  2626,
-    2626,  2627,  2627,  2628,  2628,  2629,  2629,  2630,  2630,  2631,  2631,
-    2632,  2632,  2633,  2633,  2634,  2634,  2635,  2635,  2636,  2636,  2637,
-    2637,  2638,  2638,  2639,  2639,  2640,  2640,  2641,  2641,  2642,  2642,
-    2643,  2643,  2644,  2645,  2645,  2646,  2646,  2647,  2647,  2648,  2648,
-    2649,  2649,  2650,  2650,  2651,  2651,  2652,  2652,  2653,  2653,  2654,
-    2654,  2655,  2655,  2656,  2656,  2657,  2657,  2658,  2658,  2659,  2660,
-    2660,  2661,  2661,  2662,  2662,  2663,  2663,  2664,  2664,  2665,  2665,
-    2666,  2666,  2667,  2667,  2668,  2668,  2669,  2669,  2670,  2670,  2671,
-    2671,  2672,  2673,  2673,  2674,  2674,  2675,  2675,  2676,  2676,  2677,
-    2677,  2678,  2678,  2679,  2679,  2680,  2680,  2681,  2681,  2682,  2682,
-    2683,  2683,  2684,  2685,  2685,  2686,  2686,  2687,  2687,  2688,  2688,
-    2689,  2689,  2690,  2690,  2691,  2691,  2692,  2692,  2693,  2693,  2694,
-    2694,  2695,  2696,  2696,  2697,  2697,  2698,  2698,  2699,  2699,  2700,
-    2700,  2701,  2701,  2702,  2702,  2703,  2703,  2704,  2704,  2705,  2706,
-    2706,  2707,  2707,  2708,  2708,  2709,  2709,  2710,  2710,  2711,  2711,
-    2712,  2712,  2713,  2713,  2714,  2715,  2715,  2716,  2716,  2717,  2717,
-    2718,  2718,  2719,  2719,  2720,  2720,  2721,  2721,  2722,  2722,  2723,
-    2724,  2724,  2725,  2725,  2726,  2726,  2727,  2727,  2728,  2728,  2729,
-    2729,  2730,  2730,  2731,  2731,  2732,  2733,  2733,  2734,  2734,  2735,
-    2735,  2736,  2736,  2737,  2737,  2738,  2738,  2739,  2739,  2740,  2741,
-    2741,  2742,  2742,  2743,  2743,  2744,  2744,  2745,  2745,  2746,  2746,
-    2747,  2747,  2748,  2749,  2749,  2750,  2750,  2751,  2751,  2752,  2752,
-    2753,  2753,  2754,  2754,  2755,  2756,  2756,  2757,  2757,  2758,  2758,
-    2759,  2759,  2760,  2760,  2761,  2761,  2762,  2763,  2763,  2764,  2764,
-    2765,  2765,  2766,  2766,  2767,  2767,  2768,  2768,  2769,  2770,  2770,
-    2771,  2771,  2772,  2772,  2773,  2773,  2774,  2774,  2775,  2775,  2776,
-    2777,  2777,  2778,  2778,  2779,  2779,  2780,  2780,  2781,  2781,  2782,
-    2783,  2783,  2784,  2784,  2785,  2785,  2786,  2786,  2787,  2787,  2788,
-    2788,  2789,  2790,  2790,  2791,  2791,  2792,  2792,  2793,  2793,  2794,
-    2794,  2795,  2796,  2796,  2797,  2797,  2798,  2798,  2799,  2799,  2800,
-    2800,  2801,  2802,  2802,  2803,  2803,  2804,  2804,  2805,  2805,  2806,
-    2806,  2807,  2808,  2808,  2809,  2809,  2810,  2810,  2811,  2811,  2812,
-    2812,  2813,  2814,  2814,  2815,  2815,  2816,  2816,  2817,  2817,  2818,
-    2818,  2819,  2820,  2820,  2821,  2821,  2822,  2822,  2823,  2823,  2824,
-    2825,  2825,  2826,  2826,  2827,  2827,  2828,  2828,  2829,  2829,  2830,
-    2831,  2831,  2832,  2832,  2833,  2833,  2834,  2834,  2835,  2836,  2836,
-    2837,  2837,  2838,  2838,  2839,  2839,  2840,  2841,  2841,  2842,  2842,
-    2843,  2843,  2844,  2844,  2845,  2846,  2846,  2847,  2847,  2848,  2848,
-    2849,  2849,  2850,  2850,  2851,  2852,  2852,  2853,  2853,  2854,  2854,
-    2855,  2855,  2856,  2857,  2857,  2858,  2858,  2859,  2859,  2860,  2860,
-    2861,  2862,  2862,  2863,  2863,  2864,  2864,  2865,  2866,  2866,  2867,
-    2867,  2868,  2868,  2869,  2869,  2870,  2871,  2871,  2872,  2872,  2873,
-    2873,  2874,  2874,  2875,  2876,  2876,  2877,  2877,  2878,  2878,  2879,
-    2879,  2880,  2881,  2881,  2882,  2882,  2883,  2883,  2884,  2885,  2885,
-    2886,  2886,  2887,  2887,  2888,  2888,  2889,  2890,  2890,  2891,  2891,
-    2892,  2892,  2893,  2894,  2894,  2895,  2895,  2896,  2896,  2897,  2897,
-    2898,  2899,  2899,  2900,  2900,  2901,  2901,  2902,  2903,  2903,  2904,
-    2904,  2905,  2905,  2906,  2907,  2907,  2908,  2908,  2909,  2909,  2910,
-    2910,  2911,  2912,  2912,  2913,  2913,  2914,  2914,  2915,  2916,  2916,
-    2917,  2917,  2918,  2918,  2919,  2920,  2920,  2921,  2921,  2922,  2922,
-    2923,  2924,  2924,  2925,  2925,  2926,  2926,  2927,  2928,  2928,  2929,
-    2929,  2930,  2930,  2931,  2931,  2932,  2933,  2933,  2934,  2934,  2935,
-    2935,  2936,  2937,  2937,  2938,  2938,  2939,  2939,  2940,  2941,  2941,
-    2942,  2942,  2943,  2943,  2944,  2945,  2945,  2946,  2946,  2947,  2948,
-    2948,  2949,  2949,  2950,  2950,  2951,  2952,  2952,  2953,  2953,  2954,
-    2954,  2955,  2956,  2956,  2957,  2957,  2958,  2958,  2959,  2960,  2960,
-    2961,  2961,  2962,  2962,  2963,  2964,  2964,  2965,  2965,  2966,  2966,
-    2967,  2968,  2968,  2969,  2969,  2970,  2971,  2971,  2972,  2972,  2973,
-    2973,  2974,  2975,  2975,  2976,  2976,  2977,  2977,  2978,  2979,  2979,
-    2980,  2980,  2981,  2982,  2982,  2983,  2983,  2984,  2984,  2985,  2986,
-    2986,  2987,  2987,  2988,  2988,  2989,  2990,  2990,  2991,  2991,  2992,
-    2993,  2993,  2994,  2994,  2995,  2995,  2996,  2997,  2997,  2998,  2998,
-    2999,  3000,  3000,  3001,  3001,  3002,  3002,  3003,  3004,  3004,  3005,
-    3005,  3006,  3007,  3007,  3008,  3008,  3009,  3009,  3010,  3011,  3011,
-    3012,  3012,  3013,  3014,  3014,  3015,  3015,  3016,  3017,  3017,  3018,
-    3018,  3019,  3019,  3020,  3021,  3021,  3022,  3022,  3023,  3024,  3024,
-    3025,  3025,  3026,  3026,  3027,  3028,  3028,  3029,  3029,  3030,  3031,
-    3031,  3032,  3032,  3033,  3034,  3034,  3035,  3035,  3036,  3037,  3037,
-    3038,  3038,  3039,  3039,  3040,  3041,  3041,  3042,  3042,  3043,  3044,
-    3044,  3045,  3045,  3046,  3047,  3047,  3048,  3048,  3049,  3050,  3050,
-    3051,  3051,  3052,  3052,  3053,  3054,  3054,  3055,  3055,  3056,  3057,
-    3057,  3058,  3058,  3059,  3060,  3060,  3061,  3061,  3062,  3063,  3063,
-    3064,  3064,  3065,  3066,  3066,  3067,  3067,  3068,  3069,  3069,  3070,
-    3070,  3071,  3072,  3072,  3073,  3073,  3074,  3075,  3075,  3076,  3076,
-    3077,  3078,  3078,  3079,  3079,  3080,  3080,  3081,  3082,  3082,  3083,
-    3083,  3084,  3085,  3085,  3086,  3086,  3087,  3088,  3088,  3089,  3089,
-    3090,  3091,  3091,  3092,  3092,  3093,  3094,  3094,  3095,  3095,  3096,
-    3097,  3097,  3098,  3099,  3099,  3100,  3100,  3101,  3102,  3102,  3103,
-    3103,  3104,  3105,  3105,  3106,  3106,  3107,  3108,  3108,  3109,  3109,
-    3110,  3111,  3111,  3112,  3112,  3113,  3114,  3114,  3115,  3115,  3116,
-    3117,  3117,  3118,  3118,  3119,  3120,  3120,  3121,  3121,  3122,  3123,
-    3123,  3124,  3124,  3125,  3126,  3126,  3127,  3128,  3128,  3129,  3129,
-    3130,  3131,  3131,  3132,  3132,  3133,  3134,  3134,  3135,  3135,  3136,
-    3137,  3137,  3138,  3138,  3139,  3140,  3140,  3141,  3142,  3142,  3143,
-    3143,  3144,  3145,  3145,  3146,  3146,  3147,  3148,  3148,  3149,  3149,
-    3150,  3151,  3151,  3152,  3153,  3153,  3154,  3154,  3155,  3156,  3156,
-    3157,  3157,  3158,  3159,  3159,  3160,  3161,  3161,  3162,  3162,  3163,
-    3164,  3164,  3165,  3165,  3166,  3167,  3167,  3168,  3168,  3169,  3170,
-    3170,  3171,  3172,  3172,  3173,  3173,  3174,  3175,  3175,  3176,  3177,
-    3177,  3178,  3178,  3179,  3180,  3180,  3181,  3181,  3182,  3183,  3183,
-    3184,  3185,  3185,  3186,  3186,  3187,  3188,  3188,  3189,  3189,  3190,
-    3191,  3191,  3192,  3193,  3193,  3194,  3194,  3195,  3196,  3196,  3197,
-    3198,  3198,  3199,  3199,  3200,  3201,  3201,  3202,  3203,  3203,  3204,
-    3204,  3205,  3206,  3206,  3207,  3207,  3208,  3209,  3209,  3210,  3211,
-    3211,  3212,  3212,  3213,  3214,  3214,  3215,  3216,  3216,  3217,  3217,
-    3218,  3219,  3219,  3220,  3221,  3221,  3222,  3222,  3223,  3224,  3224,
-    3225,  3226,  3226,  3227,  3227,  3228,  3229,  3229,  3230,  3231,  3231,
-    3232,  3233,  3233,  3234,  3234,  3235,  3236,  3236,  3237,  3238,  3238,
-    3239,  3239,  3240,  3241,  3241,  3242,  3243,  3243,  3244,  3244,  3245,
-    3246,  3246,  3247,  3248,  3248,  3249,  3249,  3250,  3251,  3251,  3252,
-    3253,  3253,  3254,  3255,  3255,  3256,  3256,  3257,  3258,  3258,  3259,
-    3260,  3260,  3261,  3261,  3262,  3263,  3263,  3264,  3265,  3265,  3266,
-    3267,  3267,  3268,  3268,  3269,  3270,  3270,  3271,  3272,  3272,  3273,
-    3274,  3274,  3275,  3275,  3276,  3277,  3277,  3278,  3279,  3279,  3280,
-    3281,  3281,  3282,  3282,  3283,  3284,  3284,  3285,  3286,  3286,  3287,
-    3288,  3288,  3289,  3289,  3290,  3291,  3291,  3292,  3293,  3293,  3294,
-    3295,  3295,  3296,  3296,  3297,  3298,  3298,  3299,  3300,  3300,  3301,
-    3302,  3302,  3303,  3304,  3304,  3305,  3305,  3306,  3307,  3307,  3308,
-    3309,  3309,  3310,  3311,  3311,  3312,  3313,  3313,  3314,  3314,  3315,
-    3316,  3316,  3317,  3318,  3318,  3319,  3320,  3320,  3321,  3322,  3322,
-    3323,  3323,  3324,  3325,  3325,  3326,  3327,  3327,  3328,  3329,  3329,
-    3330,  3331,  3331,  3332,  3333,  3333,  3334,  3334,  3335,  3336,  3336,
-    3337,  3338,  3338,  3339,  3340,  3340,  3341,  3342,  3342,  3343,  3344,
-    3344,  3345,  3345,  3346,  3347,  3347,  3348,  3349,  3349,  3350,  3351,
-    3351,  3352,  3353,  3353,  3354,  3355,  3355,  3356,  3357,  3357,  3358,
-    3358,  3359,  3360,  3360,  3361,  3362,  3362,  3363,  3364,  3364,  3365,
-    3366,  3366,  3367,  3368,  3368,  3369,  3370,  3370,  3371,  3372,  3372,
-    3373,  3373,  3374,  3375,  3375,  3376,  3377,  3377,  3378,  3379,  3379,
-    3380,  3381,  3381,  3382,  3383,  3383,  3384,  3385,  3385,  3386,  3387,
-    3387,  3388,  3389,  3389,  3390,  3391,  3391,  3392,  3393,  3393,  3394,
-    3394,  3395,  3396,  3396,  3397,  3398,  3398,  3399,  3400,  3400,  3401,
-    3402,  3402,  3403,  3404,  3404,  3405,  3406,  3406,  3407,  3408,  3408,
-    3409,  3410,  3410,  3411,  3412,  3412,  3413,  3414,  3414,  3415,  3416,
-    3416,  3417,  3418,  3418,  3419,  3420,  3420,  3421,  3422,  3422,  3423,
-    3424,  3424,  3425,  3426,  3426,  3427,  3428,  3428,  3429,  3430,  3430,
-    3431,  3432,  3432,  3433,  3434,  3434,  3435,  3436,  3436,  3437,  3438,
-    3438,  3439,  3440,  3440,  3441,  3442,  3442,  3443,  3444,  3444,  3445,
-    3446,  3446,  3447,  3448,  3448,  3449,  3450,  3450,  3451,  3452,  3452,
-    3453,  3454,  3454,  3455,  3456,  3456,  3457,  3458,  3458,  3459,  3460,
-    3460,  3461,  3462,  3462,  3463,  3464,  3464,  3465,  3466,  3466,  3467,
-    3468,  3468,  3469,  3470,  3470,  3471,  3472,  3472,  3473,  3474,  3474,
-    3475,  3476,  3476,  3477,  3478,  3478,  3479,  3480,  3480,  3481,  3482,
-    3482,  3483,  3484,  3485,  3485,  3486,  3487,  3487,  3488,  3489,  3489,
-    3490,  3491,  3491,  3492,  3493,  3493,  3494,  3495,  3495,  3496,  3497,
-    3497,  3498,  3499,  3499,  3500,  3501,  3501,  3502,  3503,  3503,  3504,
-    3505,  3506,  3506,  3507,  3508,  3508,  3509,  3510,  3510,  3511,  3512,
-    3512,  3513,  3514,  3514,  3515,  3516,  3516,  3517,  3518,  3518,  3519,
-    3520,  3521,  3521,  3522,  3523,  3523,  3524,  3525,  3525,  3526,  3527,
-    3527,  3528,  3529,  3529,  3530,  3531,  3531,  3532,  3533,  3533,  3534,
-    3535,  3536,  3536,  3537,  3538,  3538,  3539,  3540,  3540,  3541,  3542,
-    3542,  3543,  3544,  3544,  3545,  3546,  3547,  3547,  3548,  3549,  3549,
-    3550,  3551,  3551,  3552,  3553,  3553,  3554,  3555,  3555,  3556,  3557,
-    3558,  3558,  3559,  3560,  3560,  3561,  3562,  3562,  3563,  3564,  3564,
-    3565,  3566,  3567,  3567,  3568,  3569,  3569,  3570,  3571,  3571,  3572,
-    3573,  3573,  3574,  3575,  3576,  3576,  3577,  3578,  3578,  3579,  3580,
-    3580,  3581,  3582,  3582,  3583,  3584,  3585,  3585,  3586,  3587,  3587,
-    3588,  3589,  3589,  3590,  3591,  3591,  3592,  3593,  3594,  3594,  3595,
-    3596,  3596,  3597,  3598,  3598,  3599,  3600,  3601,  3601,  3602,  3603,
-    3603,  3604,  3605,  3605,  3606,  3607,  3608,  3608,  3609,  3610,  3610,
-    3611,  3612,  3612,  3613,  3614,  3615,  3615,  3616,  3617,  3617,  3618,
-    3619,  3619,  3620,  3621,  3622,  3622,  3623,  3624,  3624,  3625,  3626,
-    3626,  3627,  3628,  3629,  3629,  3630,  3631,  3631,  3632,  3633,  3633,
-    3634,  3635,  3636,  3636,  3637,  3638,  3638,  3639,  3640,  3641,  3641,
-    3642,  3643,  3643,  3644,  3645,  3645,  3646,  3647,  3648,  3648,  3649,
-    3650,  3650,  3651,  3652,  3653,  3653,  3654,  3655,  3655,  3656,  3657,
-    3657,  3658,  3659,  3660,  3660,  3661,  3662,  3662,  3663,  3664,  3665,
-    3665,  3666,  3667,  3667,  3668,  3669,  3670,  3670,  3671,  3672,  3672,
-    3673,  3674,  3675,  3675,  3676,  3677,  3677,  3678,  3679,  3680,  3680,
-    3681,  3682,  3682,  3683,  3684,  3684,  3685,  3686,  3687,  3687,  3688,
-    3689,  3689,  3690,  3691,  3692,  3692,  3693,  3694,  3695,  3695,  3696,
-    3697,  3697,  3698,  3699,  3700,  3700,  3701,  3702,  3702,  3703,  3704,
-    3705,  3705,  3706,  3707,  3707,  3708,  3709,  3710,  3710,  3711,  3712,
-    3712,  3713,  3714,  3715,  3715,  3716,  3717,  3717,  3718,  3719,  3720,
-    3720,  3721,  3722,  3723,  3723,  3724,  3725,  3725,  3726,  3727,  3728,
-    3728,  3729,  3730,  3730,  3731,  3732,  3733,  3733,  3734,  3735,  3736,
-    3736,  3737,  3738,  3738,  3739,  3740,  3741,  3741,  3742,  3743,  3743,
-    3744,  3745,  3746,  3746,  3747,  3748,  3749,  3749,  3750,  3751,  3751,
-    3752,  3753,  3754,  3754,  3755,  3756,  3757,  3757,  3758,  3759,  3759,
-    3760,  3761,  3762,  3762,  3763,  3764,  3765,  3765,  3766,  3767,  3767,
-    3768,  3769,  3770,  3770,  3771,  3772,  3773,  3773,  3774,  3775,  3775,
-    3776,  3777,  3778,  3778,  3779,  3780,  3781,  3781,  3782,  3783,  3784,
-    3784,  3785,  3786,  3786,  3787,  3788,  3789,  3789,  3790,  3791,  3792,
-    3792,  3793,  3794,  3795,  3795,  3796,  3797,  3797,  3798,  3799,  3800,
-    3800,  3801,  3802,  3803,  3803,  3804,  3805,  3806,  3806,  3807,  3808,
-    3809,  3809,  3810,  3811,  3811,  3812,  3813,  3814,  3814,  3815,  3816,
-    3817,  3817,  3818,  3819,  3820,  3820,  3821,  3822,  3823,  3823,  3824,
-    3825,  3826,  3826,  3827,  3828,  3828,  3829,  3830,  3831,  3831,  3832,
-    3833,  3834,  3834,  3835,  3836,  3837,  3837,  3838,  3839,  3840,  3840,
-    3841,  3842,  3843,  3843,  3844,  3845,  3846,  3846,  3847,  3848,  3849,
-    3849,  3850,  3851,  3852,  3852,  3853,  3854,  3854,  3855,  3856,  3857,
-    3857,  3858,  3859,  3860,  3860,  3861,  3862,  3863,  3863,  3864,  3865,
-    3866,  3866,  3867,  3868,  3869,  3869,  3870,  3871,  3872,  3872,  3873,
-    3874,  3875,  3875,  3876,  3877,  3878,  3878,  3879,  3880,  3881,  3881,
-    3882,  3883,  3884,  3884,  3885,  3886,  3887,  3887,  3888,  3889,  3890,
-    3890,  3891,  3892,  3893,  3893,  3894,  3895,  3896,  3896,  3897,  3898,
-    3899,  3900,  3900,  3901,  3902,  3903,  3903,  3904,  3905,  3906,  3906,
-    3907,  3908,  3909,  3909,  3910,  3911,  3912,  3912,  3913,  3914,  3915,
-    3915,  3916,  3917,  3918,  3918,  3919,  3920,  3921,  3921,  3922,  3923,
-    3924,  3924,  3925,  3926,  3927,  3928,  3928,  3929,  3930,  3931,  3931,
-    3932,  3933,  3934,  3934,  3935,  3936,  3937,  3937,  3938,  3939,  3940,
-    3940,  3941,  3942,  3943,  3944,  3944,  3945,  3946,  3947,  3947,  3948,
-    3949,  3950,  3950,  3951,  3952,  3953,  3953,  3954,  3955,  3956,  3956,
-    3957,  3958,  3959,  3960,  3960,  3961,  3962,  3963,  3963,  3964,  3965,
-    3966,  3966,  3967,  3968,  3969,  3970,  3970,  3971,  3972,  3973,  3973,
-    3974,  3975,  3976,  3976,  3977,  3978,  3979,  3980,  3980,  3981,  3982,
-    3983,  3983,  3984,  3985,  3986,  3986,  3987,  3988,  3989,  3990,  3990,
-    3991,  3992,  3993,  3993,  3994,  3995,  3996,  3996,  3997,  3998,  3999,
-    4000,  4000,  4001,  4002,  4003,  4003,  4004,  4005,  4006,  4007,  4007,
-    4008,  4009,  4010,  4010,  4011,  4012,  4013,  4014,  4014,  4015,  4016,
-    4017,  4017,  4018,  4019,  4020,  4021,  4021,  4022,  4023,  4024,  4024,
-    4025,  4026,  4027,  4028,  4028,  4029,  4030,  4031,  4031,  4032,  4033,
-    4034,  4035,  4035,  4036,  4037,  4038,  4038,  4039,  4040,  4041,  4042,
-    4042,  4043,  4044,  4045,  4045,  4046,  4047,  4048,  4049,  4049,  4050,
-    4051,  4052,  4053,  4053,  4054,  4055,  4056,  4056,  4057,  4058,  4059,
-    4060,  4060,  4061,  4062,  4063,  4064,  4064,  4065,  4066,  4067,  4067,
-    4068,  4069,  4070,  4071,  4071,  4072,  4073,  4074,  4075,  4075,  4076,
-    4077,  4078,  4078,  4079,  4080,  4081,  4082,  4082,  4083,  4084,  4085,
-    4086,  4086,  4087,  4088,  4089,  4090,  4090,  4091,  4092,  4093,  4093,
-    4094,  4095,  4096,  4097,  4097,  4098,  4099,  4100,  4101,  4101,  4102,
-    4103,  4104,  4105,  4105,  4106,  4107,  4108,  4109,  4109,  4110,  4111,
-    4112,  4113,  4113,  4114,  4115,  4116,  4116,  4117,  4118,  4119,  4120,
-    4120,  4121,  4122,  4123,  4124,  4124,  4125,  4126,  4127,  4128,  4128,
-    4129,  4130,  4131,  4132,  4132,  4133,  4134,  4135,  4136,  4136,  4137,
-    4138,  4139,  4140,  4140,  4141,  4142,  4143,  4144,  4144,  4145,  4146,
-    4147,  4148,  4148,  4149,  4150,  4151,  4152,  4152,  4153,  4154,  4155,
-    4156,  4156,  4157,  4158,  4159,  4160,  4160,  4161,  4162,  4163,  4164,
-    4165,  4165,  4166,  4167,  4168,  4169,  4169,  4170,  4171,  4172,  4173,
-    4173,  4174,  4175,  4176,  4177,  4177,  4178,  4179,  4180,  4181,  4181,
-    4182,  4183,  4184,  4185,  4185,  4186,  4187,  4188,  4189,  4190,  4190,
-    4191,  4192,  4193,  4194,  4194,  4195,  4196,  4197,  4198,  4198,  4199,
-    4200,  4201,  4202,  4203,  4203,  4204,  4205,  4206,  4207,  4207,  4208,
-    4209,  4210,  4211,  4211,  4212,  4213,  4214,  4215,  4216,  4216,  4217,
-    4218,  4219,  4220,  4220,  4221,  4222,  4223,  4224,  4224,  4225,  4226,
-    4227,  4228,  4229,  4229,  4230,  4231,  4232,  4233,  4233,  4234,  4235,
-    4236,  4237,  4238,  4238,  4239,  4240,  4241,  4242,  4242,  4243,  4244,
-    4245,  4246,  4247,  4247,  4248,  4249,  4250,  4251,  4252,  4252,  4253,
-    4254,  4255,  4256,  4256,  4257,  4258,  4259,  4260,  4261,  4261,  4262,
-    4263,  4264,  4265,  4266,  4266,  4267,  4268,  4269,  4270,  4270,  4271,
-    4272,  4273,  4274,  4275,  4275,  4276,  4277,  4278,  4279,  4280,  4280,
-    4281,  4282,  4283,  4284,  4285,  4285,  4286,  4287,  4288,  4289,  4289,
-    4290,  4291,  4292,  4293,  4294,  4294,  4295,  4296,  4297,  4298,  4299,
-    4299,  4300,  4301,  4302,  4303,  4304,  4304,  4305,  4306,  4307,  4308,
-    4309,  4309,  4310,  4311,  4312,  4313,  4314,  4314,  4315,  4316,  4317,
-    4318,  4319,  4319,  4320,  4321,  4322,  4323,  4324,  4324,  4325,  4326,
-    4327,  4328,  4329,  4329,  4330,  4331,  4332,  4333,  4334,  4334,  4335,
-    4336,  4337,  4338,  4339,  4339,  4340,  4341,  4342,  4343,  4344,  4345,
-    4345,  4346,  4347,  4348,  4349,  4350,  4350,  4351,  4352,  4353,  4354,
-    4355,  4355,  4356,  4357,  4358,  4359,  4360,  4360,  4361,  4362,  4363,
-    4364,  4365,  4366,  4366,  4367,  4368,  4369,  4370,  4371,  4371,  4372,
-    4373,  4374,  4375,  4376,  4377,  4377,  4378,  4379,  4380,  4381,  4382,
-    4382,  4383,  4384,  4385,  4386,  4387,  4388,  4388,  4389,  4390,  4391,
-    4392,  4393,  4393,  4394,  4395,  4396,  4397,  4398,  4399,  4399,  4400,
-    4401,  4402,  4403,  4404,  4404,  4405,  4406,  4407,  4408,  4409,  4410,
-    4410,  4411,  4412,  4413,  4414,  4415,  4416,  4416,  4417,  4418,  4419,
-    4420,  4421,  4422,  4422,  4423,  4424,  4425,  4426,  4427,  4428,  4428,
-    4429,  4430,  4431,  4432,  4433,  4434,  4434,  4435,  4436,  4437,  4438,
-    4439,  4440,  4440,  4441,  4442,  4443,  4444,  4445,  4446,  4446,  4447,
-    4448,  4449,  4450,  4451,  4452,  4452,  4453,  4454,  4455,  4456,  4457,
-    4458,  4458,  4459,  4460,  4461,  4462,  4463,  4464,  4464,  4465,  4466,
-    4467,  4468,  4469,  4470,  4470,  4471,  4472,  4473,  4474,  4475,  4476,
-    4477,  4477,  4478,  4479,  4480,  4481,  4482,  4483,  4483,  4484,  4485,
-    4486,  4487,  4488,  4489,  4490,  4490,  4491,  4492,  4493,  4494,  4495,
-    4496,  4496,  4497,  4498,  4499,  4500,  4501,  4502,  4503,  4503,  4504,
-    4505,  4506,  4507,  4508,  4509,  4509,  4510,  4511,  4512,  4513,  4514,
-    4515,  4516,  4516,  4517,  4518,  4519,  4520,  4521,  4522,  4523,  4523,
-    4524,  4525,  4526,  4527,  4528,  4529,  4530,  4530,  4531,  4532,  4533,
-    4534,  4535,  4536,  4537,  4537,  4538,  4539,  4540,  4541,  4542,  4543,
-    4544,  4544,  4545,  4546,  4547,  4548,  4549,  4550,  4551,  4551,  4552,
-    4553,  4554,  4555,  4556,  4557,  4558,  4558,  4559,  4560,  4561,  4562,
-    4563,  4564,  4565,  4566,  4566,  4567,  4568,  4569,  4570,  4571,  4572,
-    4573,  4573,  4574,  4575,  4576,  4577,  4578,  4579,  4580,  4581,  4581,
-    4582,  4583,  4584,  4585,  4586,  4587,  4588,  4589,  4589,  4590,  4591,
-    4592,  4593,  4594,  4595,  4596,  4596,  4597,  4598,  4599,  4600,  4601,
-    4602,  4603,  4604,  4604,  4605,  4606,  4607,  4608,  4609,  4610,  4611,
-    4612,  4612,  4613,  4614,  4615,  4616,  4617,  4618,  4619,  4620,  4620,
-    4621,  4622,  4623,  4624,  4625,  4626,  4627,  4628,  4629,  4629,  4630,
-    4631,  4632,  4633,  4634,  4635,  4636,  4637,  4637,  4638,  4639,  4640,
-    4641,  4642,  4643,  4644,  4645,  4646,  4646,  4647,  4648,  4649,  4650,
-    4651,  4652,  4653,  4654,  4655,  4655,  4656,  4657,  4658,  4659,  4660,
-    4661,  4662,  4663,  4663,  4664,  4665,  4666,  4667,  4668,  4669,  4670,
-    4671,  4672,  4673,  4673,  4674,  4675,  4676,  4677,  4678,  4679,  4680,
-    4681,  4682,  4682,  4683,  4684,  4685,  4686,  4687,  4688,  4689,  4690,
-    4691,  4691,  4692,  4693,  4694,  4695,  4696,  4697,  4698,  4699,  4700,
-    4701,  4701,  4702,  4703,  4704,  4705,  4706,  4707,  4708,  4709,  4710,
-    4711,  4711,  4712,  4713,  4714,  4715,  4716,  4717,  4718,  4719,  4720,
-    4721,  4721,  4722,  4723,  4724,  4725,  4726,  4727,  4728,  4729,  4730,
-    4731,  4731,  4732,  4733,  4734,  4735,  4736,  4737,  4738,  4739,  4740,
-    4741,  4742,  4742,  4743,  4744,  4745,  4746,  4747,  4748,  4749,  4750,
-    4751,  4752,  4753,  4753,  4754,  4755,  4756,  4757,  4758,  4759,  4760,
-    4761,  4762,  4763,  4764,  4764,  4765,  4766,  4767,  4768,  4769,  4770,
-    4771,  4772,  4773,  4774,  4775,  4775,  4776,  4777,  4778,  4779,  4780,
-    4781,  4782,  4783,  4784,  4785,  4786,  4787,  4787,  4788,  4789,  4790,
-    4791,  4792,  4793,  4794,  4795,  4796,  4797,  4798,  4799,  4799,  4800,
-    4801,  4802,  4803,  4804,  4805,  4806,  4807,  4808,  4809,  4810,  4811,
-    4812,  4812,  4813,  4814,  4815,  4816,  4817,  4818,  4819,  4820,  4821,
-    4822,  4823,  4824,  4825,  4825,  4826,  4827,  4828,  4829,  4830,  4831,
-    4832,  4833,  4834,  4835,  4836,  4837,  4838,  4839,  4839,  4840,  4841,
-    4842,  4843,  4844,  4845,  4846,  4847,  4848,  4849,  4850,  4851,  4852,
-    4853,  4853,  4854,  4855,  4856,  4857,  4858,  4859,  4860,  4861,  4862,
-    4863,  4864,  4865,  4866,  4867,  4868,  4868,  4869,  4870,  4871,  4872,
-    4873,  4874,  4875,  4876,  4877,  4878,  4879,  4880,  4881,  4882,  4883,
-    4884,  4884,  4885,  4886,  4887,  4888,  4889,  4890,  4891,  4892,  4893,
-    4894,  4895,  4896,  4897,  4898,  4899,  4900,  4901,  4901,  4902,  4903,
-    4904,  4905,  4906,  4907,  4908,  4909,  4910,  4911,  4912,  4913,  4914,
-    4915,  4916,  4917,  4918,  4918,  4919,  4920,  4921,  4922,  4923,  4924,
-    4925,  4926,  4927,  4928,  4929,  4930,  4931,  4932,  4933,  4934,  4935,
-    4936,  4937,  4938,  4938,  4939,  4940,  4941,  4942,  4943,  4944,  4945,
-    4946,  4947,  4948,  4949,  4950,  4951,  4952,  4953,  4954,  4955,  4956,
-    4957,  4958,  4958,  4959,  4960,  4961,  4962,  4963,  4964,  4965,  4966,
-    4967,  4968,  4969,  4970,  4971,  4972,  4973,  4974,  4975,  4976,  4977,
-    4978,  4979,  4980,  4981,  4981,  4982,  4983,  4984,  4985,  4986,  4987,
-    4988,  4989,  4990,  4991,  4992,  4993,  4994,  4995,  4996,  4997,  4998,
-    4999,  5000,  5001,  5002,  5003,  5004,  5005,  5006,  5007,  5007,  5008,
-    5009,  5010,  5011,  5012,  5013,  5014,  5015,  5016,  5017,  5018,  5019,
-    5020,  5021,  5022,  5023,  5024,  5025,  5026,  5027,  5028,  5029,  5030,
-    5031,  5032,  5033,  5034,  5035,  5036,  5037,  5037,  5038,  5039,  5040,
-    5041,  5042,  5043,  5044,  5045,  5046,  5047,  5048,  5049,  5050,  5051,
-    5052,  5053,  5054,  5055,  5056,  5057,  5058,  5059,  5060,  5061,  5062,
-    5063,  5064,  5065,  5066,  5067,  5068,  5069,  5070,  5071,  5072,  5073,
-    5074,  5075,  5076,  5076,  5077,  5078,  5079,  5080,  5081,  5082,  5083,
-    5084,  5085,  5086,  5087,  5088,  5089,  5090,  5091,  5092,  5093,  5094,
-    5095,  5096,  5097,  5098,  5099,  5100,  5101,  5102,  5103,  5104,  5105,
-    5106,  5107,  5108,  5109,  5110,  5111,  5112,  5113,  5114,  5115,  5116,
-    5117,  5118,  5119,  5120,  5121,  5122,  5123,  5124,  5125,  5126,  5127,
-    5128,  5129,  5130,  5131,  5132,  5133,  5134,  5135,  5136,  5137,  5138,
-    5139,  5139,  5140,  5141,  5142,  5143,  5144,  5145,  5146,  5147,  5148,
-    5149,  5150,  5151,  5152,  5153,  5154,  5155,  5156,  5157,  5158,  5159,
-    5160,  5161,  5162,  5163,  5164,  5165,  5166,  5167,  5168,  5169,  5170,
-    5171,  5172,  5173,  5174,  5175,  5176,  5177,  5178,  5179,  5180,  5181,
-    5182,  5183,  5184,  5185,  5186,  5187,  5188,  5189,  5190,  5191,  5192,
-    5193,  5194,  5195,  5196,  5197,  5198,  5199,  5200,  5201,  5202,  5203,
-    5204,  5205,  5206,  5207,  5208,  5209,  5210,  5211,  5212,  5213,  5214,
-    5215,  5216,  5217,  5218,  5219,  5220,  5221,  5222,  5223,  5224,  5225,
-    5226,  5227,  5228,  5229,  5230,  5231,  5232,  5233,  5234,  5235,  5236,
-    5237,  5238,  5239,  5240,  5242,  5243,  5244,  5245,  5246,  5247,  5248,
-    5249,  5250,  5251,  5252,  5253,  5254,  5255,  5256,  5257,  5258,  5259,
-    5260,  5261,  5262,  5263,  5264,  5265,  5266,  5267,  5268,  5269,  5270,
-    5271,  5272,  5273,  5274,  5275,  5276,  5277,  5278,  5279,  5280,  5281,
-    5282,  5283,  5284,  5285,  5286,  5287,  5288,  5289,  5290,  5291,  5292,
-    5293,  5294,  5295,  5296,  5297,  5298,  5299,  5300,  5301,  5302,  5303,
-    5304,  5306,  5307,  5308,  5309,  5310,  5311,  5312,  5313,  5314,  5315,
-    5316,  5317,  5318,  5319,  5320,  5321,  5322,  5323,  5324,  5325,  5326,
-    5327,  5328,  5329,  5330,  5331,  5332,  5333,  5334,  5335,  5336,  5337,
-    5338,  5339,  5340,  5341,  5342,  5343,  5344,  5346,  5347,  5348,  5349,
-    5350,  5351,  5352,  5353,  5354,  5355,  5356,  5357,  5358,  5359,  5360,
-    5361,  5362,  5363,  5364,  5365,  5366,  5367,  5368,  5369,  5370,  5371,
-    5372,  5373,  5374,  5375,  5377,  5378,  5379,  5380,  5381,  5382,  5383,
-    5384,  5385,  5386,  5387,  5388,  5389,  5390,  5391,  5392,  5393,  5394,
-    5395,  5396,  5397,  5398,  5399,  5400,  5401,  5402,  5403,  5405,  5406,
-    5407,  5408,  5409,  5410,  5411,  5412,  5413,  5414,  5415,  5416,  5417,
-    5418,  5419,  5420,  5421,  5422,  5423,  5424,  5425,  5426,  5427,  5429,
-    5430,  5431,  5432,  5433,  5434,  5435,  5436,  5437,  5438,  5439,  5440,
-    5441,  5442,  5443,  5444,  5445,  5446,  5447,  5448,  5449,  5451,  5452,
-    5453,  5454,  5455,  5456,  5457,  5458,  5459,  5460,  5461,  5462,  5463,
-    5464,  5465,  5466,  5467,  5468,  5469,  5471,  5472,  5473,  5474,  5475,
-    5476,  5477,  5478,  5479,  5480,  5481,  5482,  5483,  5484,  5485,  5486,
-    5487,  5488,  5490,  5491,  5492,  5493,  5494,  5495,  5496,  5497,  5498,
-    5499,  5500,  5501,  5502,  5503,  5504,  5505,  5506,  5508,  5509,  5510,
-    5511,  5512,  5513,  5514,  5515,  5516,  5517,  5518,  5519,  5520,  5521,
-    5522,  5523,  5524,  5526,  5527,  5528,  5529,  5530,  5531,  5532,  5533,
-    5534,  5535,  5536,  5537,  5538,  5539,  5540,  5542,  5543,  5544,  5545,
-    5546,  5547,  5548,  5549,  5550,  5551,  5552,  5553,  5554,  5555,  5556,
-    5558,  5559,  5560,  5561,  5562,  5563,  5564,  5565,  5566,  5567,  5568,
-    5569,  5570,  5571,  5573,  5574,  5575,  5576,  5577,  5578,  5579,  5580,
-    5581,  5582,  5583,  5584,  5585,  5587,  5588,  5589,  5590,  5591,  5592,
-    5593,  5594,  5595,  5596,  5597,  5598,  5599,  5601,  5602,  5603,  5604,
-    5605,  5606,  5607,  5608,  5609,  5610,  5611,  5612,  5613,  5615,  5616,
-    5617,  5618,  5619,  5620,  5621,  5622,  5623,  5624,  5625,  5626,  5628,
-    5629,  5630,  5631,  5632,  5633,  5634,  5635,  5636,  5637,  5638,  5639,
-    5641,  5642,  5643,  5644,  5645,  5646,  5647,  5648,  5649,  5650,  5651,
-    5653,  5654,  5655,  5656,  5657,  5658,  5659,  5660,  5661,  5662,  5663,
-    5665,  5666,  5667,  5668,  5669,  5670,  5671,  5672,  5673,  5674,  5675,
-    5677,  5678,  5679,  5680,  5681,  5682,  5683,  5684,  5685,  5686,  5687,
-    5689,  5690,  5691,  5692,  5693,  5694,  5695,  5696,  5697,  5698,  5700,
-    5701,  5702,  5703,  5704,  5705,  5706,  5707,  5708,  5709,  5710,  5712,
-    5713,  5714,  5715,  5716,  5717,  5718,  5719,  5720,  5721,  5723,  5724,
-    5725,  5726,  5727,  5728,  5729,  5730,  5731,  5733,  5734,  5735,  5736,
-    5737,  5738,  5739,  5740,  5741,  5742,  5744,  5745,  5746,  5747,  5748,
-    5749,  5750,  5751,  5752,  5754,  5755,  5756,  5757,  5758,  5759,  5760,
-    5761,  5762,  5763,  5765,  5766,  5767,  5768,  5769,  5770,  5771,  5772,
-    5773,  5775,  5776,  5777,  5778,  5779,  5780,  5781,  5782,  5783,  5785,
-    5786,  5787,  5788,  5789,  5790,  5791,  5792,  5794,  5795,  5796,  5797,
-    5798,  5799,  5800,  5801,  5802,  5804,  5805,  5806,  5807,  5808,  5809,
-    5810,  5811,  5812,  5814,  5815,  5816,  5817,  5818,  5819,  5820,  5821,
-    5823,  5824,  5825,  5826,  5827,  5828,  5829,  5830,  5832,  5833,  5834,
-    5835,  5836,  5837,  5838,  5839,  5841,  5842,  5843,  5844,  5845,  5846,
-    5847,  5848,  5850,  5851,  5852,  5853,  5854,  5855,  5856,  5857,  5859,
-    5860,  5861,  5862,  5863,  5864,  5865,  5866,  5868,  5869,  5870,  5871,
-    5872,  5873,  5874,  5875,  5877,  5878,  5879,  5880,  5881,  5882,  5883,
-    5885,  5886,  5887,  5888,  5889,  5890,  5891,  5892,  5894,  5895,  5896,
-    5897,  5898,  5899,  5900,  5902,  5903,  5904,  5905,  5906,  5907,  5908,
-    5909,  5911,  5912,  5913,  5914,  5915,  5916,  5917,  5919,  5920,  5921,
-    5922,  5923,  5924,  5925,  5927,  5928,  5929,  5930,  5931,  5932,  5933,
-    5935,  5936,  5937,  5938,  5939,  5940,  5941,  5943,  5944,  5945,  5946,
-    5947,  5948,  5949,  5951,  5952,  5953,  5954,  5955,  5956,  5957,  5959,
-    5960,  5961,  5962,  5963,  5964,  5965,  5967,  5968,  5969,  5970,  5971,
-    5972,  5973,  5975,  5976,  5977,  5978,  5979,  5980,  5982,  5983,  5984,
-    5985,  5986,  5987,  5988,  5990,  5991,  5992,  5993,  5994,  5995,  5997,
-    5998,  5999,  6000,  6001,  6002,  6003,  6005,  6006,  6007,  6008,  6009,
-    6010,  6012,  6013,  6014,  6015,  6016,  6017,  6018,  6020,  6021,  6022,
-    6023,  6024,  6025,  6027,  6028,  6029,  6030,  6031,  6032,  6034,  6035,
-    6036,  6037,  6038,  6039,  6041,  6042,  6043,  6044,  6045,  6046,  6047,
-    6049,  6050,  6051,  6052,  6053,  6054,  6056,  6057,  6058,  6059,  6060,
-    6061,  6063,  6064,  6065,  6066,  6067,  6068,  6070,  6071,  6072,  6073,
-    6074,  6075,  6077,  6078,  6079,  6080,  6081,  6082,  6084,  6085,  6086,
-    6087,  6088,  6090,  6091,  6092,  6093,  6094,  6095,  6097,  6098,  6099,
-    6100,  6101,  6102,  6104,  6105,  6106,  6107,  6108,  6109,  6111,  6112,
-    6113,  6114,  6115,  6117,  6118,  6119,  6120,  6121,  6122,  6124,  6125,
-    6126,  6127,  6128,  6129,  6131,  6132,  6133,  6134,  6135,  6137,  6138,
-    6139,  6140,  6141,  6142,  6144,  6145,  6146,  6147,  6148,  6150,  6151,
-    6152,  6153,  6154,  6155,  6157,  6158,  6159,  6160,  6161,  6163,  6164,
-    6165,  6166,  6167,  6168,  6170,  6171,  6172,  6173,  6174,  6176,  6177,
-    6178,  6179,  6180,  6182,  6183,  6184,  6185,  6186,  6188,  6189,  6190,
-    6191,  6192,  6193,  6195,  6196,  6197,  6198,  6199,  6201,  6202,  6203,
-    6204,  6205,  6207,  6208,  6209,  6210,  6211,  6213,  6214,  6215,  6216,
-    6217,  6219,  6220,  6221,  6222,  6223,  6225,  6226,  6227,  6228,  6229,
-    6230,  6232,  6233,  6234,  6235,  6236,  6238,  6239,  6240,  6241,  6242,
-    6244,  6245,  6246,  6247,  6248,  6250,  6251,  6252,  6253,  6254,  6256,
-    6257,  6258,  6259,  6261,  6262,  6263,  6264,  6265,  6267,  6268,  6269,
-    6270,  6271,  6273,  6274,  6275,  6276,  6277,  6279,  6280,  6281,  6282,
-    6283,  6285,  6286,  6287,  6288,  6289,  6291,  6292,  6293,  6294,  6296,
-    6297,  6298,  6299,  6300,  6302,  6303,  6304,  6305,  6306,  6308,  6309,
-    6310,  6311,  6312,  6314,  6315,  6316,  6317,  6319,  6320,  6321,  6322,
-    6323,  6325,  6326,  6327,  6328,  6330,  6331,  6332,  6333,  6334,  6336,
-    6337,  6338,  6339,  6340,  6342,  6343,  6344,  6345,  6347,  6348,  6349,
-    6350,  6351,  6353,  6354,  6355,  6356,  6358,  6359,  6360,  6361,  6362,
-    6364,  6365,  6366,  6367,  6369,  6370,  6371,  6372,  6373,  6375,  6376,
-    6377,  6378,  6380,  6381,  6382,  6383,  6385,  6386,  6387,  6388,  6389,
-    6391,  6392,  6393,  6394,  6396,  6397,  6398,  6399,  6400,  6402,  6403,
-    6404,  6405,  6407,  6408,  6409,  6410,  6412,  6413,  6414,  6415,  6416,
-    6418,  6419,  6420,  6421,  6423,  6424,  6425,  6426,  6428,  6429,  6430,
-    6431,  6433,  6434,  6435,  6436,  6437,  6439,  6440,  6441,  6442,  6444,
-    6445,  6446,  6447,  6449,  6450,  6451,  6452,  6454,  6455,  6456,  6457,
-    6459,  6460,  6461,  6462,  6464,  6465,  6466,  6467,  6469,  6470,  6471,
-    6472,  6473,  6475,  6476,  6477,  6478,  6480,  6481,  6482,  6483,  6485,
-    6486,  6487,  6488,  6490,  6491,  6492,  6493,  6495,  6496,  6497,  6498,
-    6500,  6501,  6502,  6503,  6505,  6506,  6507,  6508,  6510,  6511,  6512,
-    6513,  6515,  6516,  6517,  6518,  6520,  6521,  6522,  6523,  6525,  6526,
-    6527,  6528,  6530,  6531,  6532,  6533,  6535,  6536,  6537,  6539,  6540,
-    6541,  6542,  6544,  6545,  6546,  6547,  6549,  6550,  6551,  6552,  6554,
-    6555,  6556,  6557,  6559,  6560,  6561,  6562,  6564,  6565,  6566,  6567,
-    6569,  6570,  6571,  6573,  6574,  6575,  6576,  6578,  6579,  6580,  6581,
-    6583,  6584,  6585,  6586,  6588,  6589,  6590,  6592,  6593,  6594,  6595,
-    6597,  6598,  6599,  6600,  6602,  6603,  6604,  6605,  6607,  6608,  6609,
-    6611,  6612,  6613,  6614,  6616,  6617,  6618,  6619,  6621,  6622,  6623,
-    6625,  6626,  6627,  6628,  6630,  6631,  6632,  6633,  6635,  6636,  6637,
-    6639,  6640,  6641,  6642,  6644,  6645,  6646,  6647,  6649,  6650,  6651,
-    6653,  6654,  6655,  6656,  6658,  6659,  6660,  6662,  6663,  6664,  6665,
-    6667,  6668,  6669,  6671,  6672,  6673,  6674,  6676,  6677,  6678,  6679,
-    6681,  6682,  6683,  6685,  6686,  6687,  6688,  6690,  6691,  6692,  6694,
-    6695,  6696,  6697,  6699,  6700,  6701,  6703,  6704,  6705,  6706,  6708,
-    6709,  6710,  6712,  6713,  6714,  6716,  6717,  6718,  6719,  6721,  6722,
-    6723,  6725,  6726,  6727,  6728,  6730,  6731,  6732,  6734,  6735,  6736,
-    6737,  6739,  6740,  6741,  6743,  6744,  6745,  6747,  6748,  6749,  6750,
-    6752,  6753,  6754,  6756,  6757,  6758,  6760,  6761,  6762,  6763,  6765,
-    6766,  6767,  6769,  6770,  6771,  6773,  6774,  6775,  6776,  6778,  6779,
-    6780,  6782,  6783,  6784,  6786,  6787,  6788,  6789,  6791,  6792,  6793,
-    6795,  6796,  6797,  6799,  6800,  6801,  6803,  6804,  6805,  6806,  6808,
-    6809,  6810,  6812,  6813,  6814,  6816,  6817,  6818,  6820,  6821,  6822,
-    6823,  6825,  6826,  6827,  6829,  6830,  6831,  6833,  6834,  6835,  6837,
-    6838,  6839,  6841,  6842,  6843,  6844,  6846,  6847,  6848,  6850,  6851,
-    6852,  6854,  6855,  6856,  6858,  6859,  6860,  6862,  6863,  6864,  6866,
-    6867,  6868,  6870,  6871,  6872,  6873,  6875,  6876,  6877,  6879,  6880,
-    6881,  6883,  6884,  6885,  6887,  6888,  6889,  6891,  6892,  6893,  6895,
-    6896,  6897,  6899,  6900,  6901,  6903,  6904,  6905,  6907,  6908,  6909,
-    6911,  6912,  6913,  6915,  6916,  6917,  6919,  6920,  6921,  6923,  6924,
-    6925,  6926,  6928,  6929,  6930,  6932,  6933,  6934,  6936,  6937,  6938,
-    6940,  6941,  6942,  6944,  6945,  6946,  6948,  6949,  6950,  6952,  6953,
-    6954,  6956,  6957,  6959,  6960,  6961,  6963,  6964,  6965,  6967,  6968,
-    6969,  6971,  6972,  6973,  6975,  6976,  6977,  6979,  6980,  6981,  6983,
-    6984,  6985,  6987,  6988,  6989,  6991,  6992,  6993,  6995,  6996,  6997,
-    6999,  7000,  7001,  7003,  7004,  7005,  7007,  7008,  7009,  7011,  7012,
-    7014,  7015,  7016,  7018,  7019,  7020,  7022,  7023,  7024,  7026,  7027,
-    7028,  7030,  7031,  7032,  7034,  7035,  7036,  7038,  7039,  7041,  7042,
-    7043,  7045,  7046,  7047,  7049,  7050,  7051,  7053,  7054,  7055,  7057,
-    7058,  7059,  7061,  7062,  7064,  7065,  7066,  7068,  7069,  7070,  7072,
-    7073,  7074,  7076,  7077,  7078,  7080,  7081,  7083,  7084,  7085,  7087,
-    7088,  7089,  7091,  7092,  7093,  7095,  7096,  7098,  7099,  7100,  7102,
-    7103,  7104,  7106,  7107,  7108,  7110,  7111,  7113,  7114,  7115,  7117,
-    7118,  7119,  7121,  7122,  7123,  7125,  7126,  7128,  7129,  7130,  7132,
-    7133,  7134,  7136,  7137,  7139,  7140,  7141,  7143,  7144,  7145,  7147,
-    7148,  7150,  7151,  7152,  7154,  7155,  7156,  7158,  7159,  7161,  7162,
-    7163,  7165,  7166,  7167,  7169,  7170,  7172,  7173,  7174,  7176,  7177,
-    7178,  7180,  7181,  7183,  7184,  7185,  7187,  7188,  7189,  7191,  7192,
-    7194,  7195,  7196,  7198,  7199,  7201,  7202,  7203,  7205,  7206,  7207,
-    7209,  7210,  7212,  7213,  7214,  7216,  7217,  7219,  7220,  7221,  7223,
-    7224,  7225,  7227,  7228,  7230,  7231,  7232,  7234,  7235,  7237,  7238,
-    7239,  7241,  7242,  7243,  7245,  7246,  7248,  7249,  7250,  7252,  7253,
-    7255,  7256,  7257,  7259,  7260,  7262,  7263,  7264,  7266,  7267,  7269,
-    7270,  7271,  7273,  7274,  7276,  7277,  7278,  7280,  7281,  7283,  7284,
-    7285,  7287,  7288,  7290,  7291,  7292,  7294,  7295,  7297,  7298,  7299,
-    7301,  7302,  7304,  7305,  7306,  7308,  7309,  7311,  7312,  7313,  7315,
-    7316,  7318,  7319,  7320,  7322,  7323,  7325,  7326,  7327,  7329,  7330,
-    7332,  7333,  7334,  7336,  7337,  7339,  7340,  7342,  7343,  7344,  7346,
-    7347,  7349,  7350,  7351,  7353,  7354,  7356,  7357,  7358,  7360,  7361,
-    7363,  7364,  7366,  7367,  7368,  7370,  7371,  7373,  7374,  7375,  7377,
-    7378,  7380,  7381,  7383,  7384,  7385,  7387,  7388,  7390,  7391,  7392,
-    7394,  7395,  7397,  7398,  7400,  7401,  7402,  7404,  7405,  7407,  7408,
-    7409,  7411,  7412,  7414,  7415,  7417,  7418,  7419,  7421,  7422,  7424,
-    7425,  7427,  7428,  7429,  7431,  7432,  7434,  7435,  7437,  7438,  7439,
-    7441,  7442,  7444,  7445,  7447,  7448,  7449,  7451,  7452,  7454,  7455,
-    7457,  7458,  7459,  7461,  7462,  7464,  7465,  7467,  7468,  7469,  7471,
-    7472,  7474,  7475,  7477,  7478,  7480,  7481,  7482,  7484,  7485,  7487,
-    7488,  7490,  7491,  7492,  7494,  7495,  7497,  7498,  7500,  7501,  7503,
-    7504,  7505,  7507,  7508,  7510,  7511,  7513,  7514,  7515,  7517,  7518,
-    7520,  7521,  7523,  7524,  7526,  7527,  7528,  7530,  7531,  7533,  7534,
-    7536,  7537,  7539,  7540,  7542,  7543,  7544,  7546,  7547,  7549,  7550,
-    7552,  7553,  7555,  7556,  7557,  7559,  7560,  7562,  7563,  7565,  7566,
-    7568,  7569,  7571,  7572,  7573,  7575,  7576,  7578,  7579,  7581,  7582,
-    7584,  7585,  7587,  7588,  7589,  7591,  7592,  7594,  7595,  7597,  7598,
-    7600,  7601,  7603,  7604,  7605,  7607,  7608,  7610,  7611,  7613,  7614,
-    7616,  7617,  7619,  7620,  7622,  7623,  7624,  7626,  7627,  7629,  7630,
-    7632,  7633,  7635,  7636,  7638,  7639,  7641,  7642,  7644,  7645,  7646,
-    7648,  7649,  7651,  7652,  7654,  7655,  7657,  7658,  7660,  7661,  7663,
-    7664,  7666,  7667,  7668,  7670,  7671,  7673,  7674,  7676,  7677,  7679,
-    7680,  7682,  7683,  7685,  7686,  7688,  7689,  7691,  7692,  7694,  7695,
-    7697,  7698,  7699,  7701,  7702,  7704,  7705,  7707,  7708,  7710,  7711,
-    7713,  7714,  7716,  7717,  7719,  7720,  7722,  7723,  7725,  7726,  7728,
-    7729,  7731,  7732,  7734,  7735,  7736,  7738,  7739,  7741,  7742,  7744,
-    7745,  7747,  7748,  7750,  7751,  7753,  7754,  7756,  7757,  7759,  7760,
-    7762,  7763,  7765,  7766,  7768,  7769,  7771,  7772,  7774,  7775,  7777,
-    7778,  7780,  7781,  7783,  7784,  7786,  7787,  7789,  7790,  7792,  7793,
-    7795,  7796,  7798,  7799,  7801,  7802,  7804,  7805,  7807,  7808,  7810,
-    7811,  7813,  7814,  7816,  7817,  7819,  7820,  7822,  7823,  7825,  7826,
-    7828,  7829,  7831,  7832,  7834,  7835,  7837,  7838,  7840,  7841,  7843,
-    7844,  7846,  7847,  7849,  7850,  7852,  7853,  7855,  7856,  7858,  7859,
-    7861,  7862,  7864,  7865,  7867,  7868,  7870,  7871,  7873,  7874,  7876,
-    7877,  7879,  7880,  7882,  7883,  7885,  7886,  7888,  7889,  7891,  7892,
-    7894,  7895,  7897,  7899,  7900,  7902,  7903,  7905,  7906,  7908,  7909,
-    7911,  7912,  7914,  7915,  7917,  7918,  7920,  7921,  7923,  7924,  7926,
-    7927,  7929,  7930,  7932,  7933,  7935,  7936,  7938,  7940,  7941,  7943,
-    7944,  7946,  7947,  7949,  7950,  7952,  7953,  7955,  7956,  7958,  7959,
-    7961,  7962,  7964,  7965,  7967,  7969,  7970,  7972,  7973,  7975,  7976,
-    7978,  7979,  7981,  7982,  7984,  7985,  7987,  7988,  7990,  7991,  7993,
-    7995,  7996,  7998,  7999,  8001,  8002,  8004,  8005,  8007,  8008,  8010,
-    8011,  8013,  8015,  8016,  8018,  8019,  8021,  8022,  8024,  8025,  8027,
-    8028,  8030,  8031,  8033,  8035,  8036,  8038,  8039,  8041,  8042,  8044,
-    8045,  8047,  8048,  8050,  8052,  8053,  8055,  8056,  8058,  8059,  8061,
-    8062,  8064,  8065,  8067,  8069,  8070,  8072,  8073,  8075,  8076,  8078,
-    8079,  8081,  8082,  8084,  8086,  8087,  8089,  8090,  8092,  8093,  8095,
-    8096,  8098,  8100,  8101,  8103,  8104,  8106,  8107,  8109,  8110,  8112,
-    8114,  8115,  8117,  8118,  8120,  8121,  8123,  8124,  8126,  8128,  8129,
-    8131,  8132,  8134,  8135,  8137,  8138,  8140,  8142,  8143,  8145,  8146,
-    8148,  8149,  8151,  8153,  8154,  8156,  8157,  8159,  8160,  8162,  8163,
-    8165,  8167,  8168,  8170,  8171,  8173,  8174,  8176,  8178,  8179,  8181,
-    8182,  8184,  8185,  8187,  8189,  8190,  8192,  8193,  8195,  8196,  8198,
-    8200,  8201,  8203,  8204,  8206,  8207,  8209,  8211,  8212,  8214,  8215,
-    8217,  8218,  8220,  8222,  8223,  8225,  8226,  8228,  8230,  8231,  8233,
-    8234,  8236,  8237,  8239,  8241,  8242,  8244,  8245,  8247,  8248,  8250,
-    8252,  8253,  8255,  8256,  8258,  8260,  8261,  8263,  8264,  8266,  8267,
-    8269,  8271,  8272,  8274,  8275,  8277,  8279,  8280,  8282,  8283,  8285,
-    8287,  8288,  8290,  8291,  8293,  8294,  8296,  8298,  8299,  8301,  8302,
-    8304,  8306,  8307,  8309,  8310,  8312,  8314,  8315,  8317,  8318,  8320,
-    8322,  8323,  8325,  8326,  8328,  8330,  8331,  8333,  8334,  8336,  8338,
-    8339,  8341,  8342,  8344,  8346,  8347,  8349,  8350,  8352,  8354,  8355,
-    8357,  8358,  8360,  8362,  8363,  8365,  8366,  8368,  8370,  8371,  8373,
-    8374,  8376,  8378,  8379,  8381,  8382,  8384,  8386,  8387,  8389,  8391,
-    8392,  8394,  8395,  8397,  8399,  8400,  8402,  8403,  8405,  8407,  8408,
-    8410,  8411,  8413,  8415,  8416,  8418,  8420,  8421,  8423,  8424,  8426,
-    8428,  8429,  8431,  8432,  8434,  8436,  8437,  8439,  8441,  8442,  8444,
-    8445,  8447,  8449,  8450,  8452,  8453,  8455,  8457,  8458,  8460,  8462,
-    8463,  8465,  8466,  8468,  8470,  8471,  8473,  8475,  8476,  8478,  8479,
-    8481,  8483,  8484,  8486,  8488,  8489,  8491,  8492,  8494,  8496,  8497,
-    8499,  8501,  8502,  8504,  8506,  8507,  8509,  8510,  8512,  8514,  8515,
-    8517,  8519,  8520,  8522,  8523,  8525,  8527,  8528,  8530,  8532,  8533,
-    8535,  8537,  8538,  8540,  8541,  8543,  8545,  8546,  8548,  8550,  8551,
-    8553,  8555,  8556,  8558,  8560,  8561,  8563,  8564,  8566,  8568,  8569,
-    8571,  8573,  8574,  8576,  8578,  8579,  8581,  8583,  8584,  8586,  8587,
-    8589,  8591,  8592,  8594,  8596,  8597,  8599,  8601,  8602,  8604,  8606,
-    8607,  8609,  8611,  8612,  8614,  8616,  8617,  8619,  8620,  8622,  8624,
-    8625,  8627,  8629,  8630,  8632,  8634,  8635,  8637,  8639,  8640,  8642,
-    8644,  8645,  8647,  8649,  8650,  8652,  8654,  8655,  8657,  8659,  8660,
-    8662,  8664,  8665,  8667,  8669,  8670,  8672,  8674,  8675,  8677,  8679,
-    8680,  8682,  8684,  8685,  8687,  8689,  8690,  8692,  8694,  8695,  8697,
-    8699,  8700,  8702,  8704,  8705,  8707,  8709,  8710,  8712,  8714,  8715,
-    8717,  8719,  8720,  8722,  8724,  8725,  8727,  8729,  8730,  8732,  8734,
-    8735,  8737,  8739,  8740,  8742,  8744,  8745,  8747,  8749,  8750,  8752,
-    8754,  8755,  8757,  8759,  8760,  8762,  8764,  8765,  8767,  8769,  8771,
-    8772,  8774,  8776,  8777,  8779,  8781,  8782,  8784,  8786,  8787,  8789,
-    8791,  8792,  8794,  8796,  8797,  8799,  8801,  8803,  8804,  8806,  8808,
-    8809,  8811,  8813,  8814,  8816,  8818,  8819,  8821,  8823,  8824,  8826,
-    8828,  8830,  8831,  8833,  8835,  8836,  8838,  8840,  8841,  8843,  8845,
-    8847,  8848,  8850,  8852,  8853,  8855,  8857,  8858,  8860,  8862,  8863,
-    8865,  8867,  8869,  8870,  8872,  8874,  8875,  8877,  8879,  8880,  8882,
-    8884,  8886,  8887,  8889,  8891,  8892,  8894,  8896,  8898,  8899,  8901,
-    8903,  8904,  8906,  8908,  8909,  8911,  8913,  8915,  8916,  8918,  8920,
-    8921,  8923,  8925,  8927,  8928,  8930,  8932,  8933,  8935,  8937,  8939,
-    8940,  8942,  8944,  8945,  8947,  8949,  8951,  8952,  8954,  8956,  8957,
-    8959,  8961,  8963,  8964,  8966,  8968,  8969,  8971,  8973,  8975,  8976,
-    8978,  8980,  8982,  8983,  8985,  8987,  8988,  8990,  8992,  8994,  8995,
-    8997,  8999,  9000,  9002,  9004,  9006,  9007,  9009,  9011,  9013,  9014,
-    9016,  9018,  9019,  9021,  9023,  9025,  9026,  9028,  9030,  9032,  9033,
-    9035,  9037,  9039,  9040,  9042,  9044,  9045,  9047,  9049,  9051,  9052,
-    9054,  9056,  9058,  9059,  9061,  9063,  9065,  9066,  9068,  9070,  9071,
-    9073,  9075,  9077,  9078,  9080,  9082,  9084,  9085,  9087,  9089,  9091,
-    9092,  9094,  9096,  9098,  9099,  9101,  9103,  9105,  9106,  9108,  9110,
-    9112,  9113,  9115,  9117,  9119,  9120,  9122,  9124,  9126,  9127,  9129,
-    9131,  9133,  9134,  9136,  9138,  9140,  9141,  9143,  9145,  9147,  9148,
-    9150,  9152,  9154,  9155,  9157,  9159,  9161,  9162,  9164,  9166,  9168,
-    9169,  9171,  9173,  9175,  9176,  9178,  9180,  9182,  9183,  9185,  9187,
-    9189,  9190,  9192,  9194,  9196,  9198,  9199,  9201,  9203,  9205,  9206,
-    9208,  9210,  9212,  9213,  9215,  9217,  9219,  9220,  9222,  9224,  9226,
-    9228,  9229,  9231,  9233,  9235,  9236,  9238,  9240,  9242,  9243,  9245,
-    9247,  9249,  9251,  9252,  9254,  9256,  9258,  9259,  9261,  9263,  9265,
-    9267,  9268,  9270,  9272,  9274,  9275,  9277,  9279,  9281,  9283,  9284,
-    9286,  9288,  9290,  9291,  9293,  9295,  9297,  9299,  9300,  9302,  9304,
-    9306,  9307,  9309,  9311,  9313,  9315,  9316,  9318,  9320,  9322,  9324,
-    9325,  9327,  9329,  9331,  9332,  9334,  9336,  9338,  9340,  9341,  9343,
-    9345,  9347,  9349,  9350,  9352,  9354,  9356,  9358,  9359,  9361,  9363,
-    9365,  9367,  9368,  9370,  9372,  9374,  9375,  9377,  9379,  9381,  9383,
-    9384,  9386,  9388,  9390,  9392,  9393,  9395,  9397,  9399,  9401,  9402,
-    9404,  9406,  9408,  9410,  9412,  9413,  9415,  9417,  9419,  9421,  9422,
-    9424,  9426,  9428,  9430,  9431,  9433,  9435,  9437,  9439,  9440,  9442,
-    9444,  9446,  9448,  9449,  9451,  9453,  9455,  9457,  9459,  9460,  9462,
-    9464,  9466,  9468,  9469,  9471,  9473,  9475,  9477,  9478,  9480,  9482,
-    9484,  9486,  9488,  9489,  9491,  9493,  9495,  9497,  9498,  9500,  9502,
-    9504,  9506,  9508,  9509,  9511,  9513,  9515,  9517,  9519,  9520,  9522,
-    9524,  9526,  9528,  9529,  9531,  9533,  9535,  9537,  9539,  9540,  9542,
-    9544,  9546,  9548,  9550,  9551,  9553,  9555,  9557,  9559,  9561,  9562,
-    9564,  9566,  9568,  9570,  9572,  9573,  9575,  9577,  9579,  9581,  9583,
-    9584,  9586,  9588,  9590,  9592,  9594,  9595,  9597,  9599,  9601,  9603,
-    9605,  9606,  9608,  9610,  9612,  9614,  9616,  9618,  9619,  9621,  9623,
-    9625,  9627,  9629,  9630,  9632,  9634,  9636,  9638,  9640,  9641,  9643,
-    9645,  9647,  9649,  9651,  9653,  9654,  9656,  9658,  9660,  9662,  9664,
-    9666,  9667,  9669,  9671,  9673,  9675,  9677,  9679,  9680,  9682,  9684,
-    9686,  9688,  9690,  9691,  9693,  9695,  9697,  9699,  9701,  9703,  9705,
-    9706,  9708,  9710,  9712,  9714,  9716,  9718,  9719,  9721,  9723,  9725,
-    9727,  9729,  9731,  9732,  9734,  9736,  9738,  9740,  9742,  9744,  9745,
-    9747,  9749,  9751,  9753,  9755,  9757,  9759,  9760,  9762,  9764,  9766,
-    9768,  9770,  9772,  9774,  9775,  9777,  9779,  9781,  9783,  9785,  9787,
-    9789,  9790,  9792,  9794,  9796,  9798,  9800,  9802,  9804,  9805,  9807,
-    9809,  9811,  9813,  9815,  9817,  9819,  9820,  9822,  9824,  9826,  9828,
-    9830,  9832,  9834,  9836,  9837,  9839,  9841,  9843,  9845,  9847,  9849,
-    9851,  9852,  9854,  9856,  9858,  9860,  9862,  9864,  9866,  9868,  9869,
-    9871,  9873,  9875,  9877,  9879,  9881,  9883,  9885,  9887,  9888,  9890,
-    9892,  9894,  9896,  9898,  9900,  9902,  9904,  9905,  9907,  9909,  9911,
-    9913,  9915,  9917,  9919,  9921,  9923,  9924,  9926,  9928,  9930,  9932,
-    9934,  9936,  9938,  9940,  9942,  9944,  9945,  9947,  9949,  9951,  9953,
-    9955,  9957,  9959,  9961,  9963,  9964,  9966,  9968,  9970,  9972,  9974,
-    9976,  9978,  9980,  9982,  9984,  9985,  9987,  9989,  9991,  9993,  9995,
-    9997,  9999,  10001, 10003, 10005, 10007, 10008, 10010, 10012, 10014, 10016,
-    10018, 10020, 10022, 10024, 10026, 10028, 10030, 10032, 10033, 10035, 10037,
-    10039, 10041, 10043, 10045, 10047, 10049, 10051, 10053, 10055, 10057, 10058,
-    10060, 10062, 10064, 10066, 10068, 10070, 10072, 10074, 10076, 10078, 10080,
-    10082, 10084, 10085, 10087, 10089, 10091, 10093, 10095, 10097, 10099, 10101,
-    10103, 10105, 10107, 10109, 10111, 10113, 10114, 10116, 10118, 10120, 10122,
-    10124, 10126, 10128, 10130, 10132, 10134, 10136, 10138, 10140, 10142, 10144,
-    10146, 10147, 10149, 10151, 10153, 10155, 10157, 10159, 10161, 10163, 10165,
-    10167, 10169, 10171, 10173, 10175, 10177, 10179, 10181, 10183, 10184, 10186,
-    10188, 10190, 10192, 10194, 10196, 10198, 10200, 10202, 10204, 10206, 10208,
-    10210, 10212, 10214, 10216, 10218, 10220, 10222, 10224, 10226, 10227, 10229,
-    10231, 10233, 10235, 10237, 10239, 10241, 10243, 10245, 10247, 10249, 10251,
-    10253, 10255, 10257, 10259, 10261, 10263, 10265, 10267, 10269, 10271, 10273,
-    10275, 10277, 10279, 10280, 10282, 10284, 10286, 10288, 10290, 10292, 10294,
-    10296, 10298, 10300, 10302, 10304, 10306, 10308, 10310, 10312, 10314, 10316,
-    10318, 10320, 10322, 10324, 10326, 10328, 10330, 10332, 10334, 10336, 10338,
-    10340, 10342, 10344, 10346, 10348, 10350, 10352, 10354, 10356, 10358, 10360,
-    10362, 10364, 10365, 10367, 10369, 10371, 10373, 10375, 10377, 10379, 10381,
-    10383, 10385, 10387, 10389, 10391, 10393, 10395, 10397, 10399, 10401, 10403,
-    10405, 10407, 10409, 10411, 10413, 10415, 10417, 10419, 10421, 10423, 10425,
-    10427, 10429, 10431, 10433, 10435, 10437, 10439, 10441, 10443, 10445, 10447,
-    10449, 10451, 10453, 10455, 10457, 10459, 10461, 10463, 10465, 10467, 10469,
-    10471, 10473, 10475, 10477, 10479, 10481, 10483, 10485, 10487, 10489, 10491,
-    10493, 10495, 10497, 10499, 10501, 10503, 10505, 10507, 10509, 10511, 10513,
-    10515, 10517, 10519, 10521, 10523, 10526, 10528, 10530, 10532, 10534, 10536,
-    10538, 10540, 10542, 10544, 10546, 10548, 10550, 10552, 10554, 10556, 10558,
-    10560, 10562, 10564, 10566, 10568, 10570, 10572, 10574, 10576, 10578, 10580,
-    10582, 10584, 10586, 10588, 10590, 10592, 10594, 10596, 10598, 10600, 10602,
-    10604, 10606, 10608, 10611, 10613, 10615, 10617, 10619, 10621, 10623, 10625,
-    10627, 10629, 10631, 10633, 10635, 10637, 10639, 10641, 10643, 10645, 10647,
-    10649, 10651, 10653, 10655, 10657, 10659, 10661, 10663, 10666, 10668, 10670,
-    10672, 10674, 10676, 10678, 10680, 10682, 10684, 10686, 10688, 10690, 10692,
-    10694, 10696, 10698, 10700, 10702, 10704, 10706, 10708, 10711, 10713, 10715,
-    10717, 10719, 10721, 10723, 10725, 10727, 10729, 10731, 10733, 10735, 10737,
-    10739, 10741, 10743, 10745, 10748, 10750, 10752, 10754, 10756, 10758, 10760,
-    10762, 10764, 10766, 10768, 10770, 10772, 10774, 10776, 10778, 10780, 10783,
-    10785, 10787, 10789, 10791, 10793, 10795, 10797, 10799, 10801, 10803, 10805,
-    10807, 10809, 10811, 10814, 10816, 10818, 10820, 10822, 10824, 10826, 10828,
-    10830, 10832, 10834, 10836, 10838, 10840, 10843, 10845, 10847, 10849, 10851,
-    10853, 10855, 10857, 10859, 10861, 10863, 10865, 10868, 10870, 10872, 10874,
-    10876, 10878, 10880, 10882, 10884, 10886, 10888, 10890, 10893, 10895, 10897,
-    10899, 10901, 10903, 10905, 10907, 10909, 10911, 10913, 10915, 10918, 10920,
-    10922, 10924, 10926, 10928, 10930, 10932, 10934, 10936, 10938, 10941, 10943,
-    10945, 10947, 10949, 10951, 10953, 10955, 10957, 10959, 10962, 10964, 10966,
-    10968, 10970, 10972, 10974, 10976, 10978, 10980, 10983, 10985, 10987, 10989,
-    10991, 10993, 10995, 10997, 10999, 11001, 11004, 11006, 11008, 11010, 11012,
-    11014, 11016, 11018, 11020, 11023, 11025, 11027, 11029, 11031, 11033, 11035,
-    11037, 11039, 11042, 11044, 11046, 11048, 11050, 11052, 11054, 11056, 11058,
-    11061, 11063, 11065, 11067, 11069, 11071, 11073, 11075, 11078, 11080, 11082,
-    11084, 11086, 11088, 11090, 11092, 11095, 11097, 11099, 11101, 11103, 11105,
-    11107, 11109, 11112, 11114, 11116, 11118, 11120, 11122, 11124, 11126, 11129,
-    11131, 11133, 11135, 11137, 11139, 11141, 11143, 11146, 11148, 11150, 11152,
-    11154, 11156, 11158, 11161, 11163, 11165, 11167, 11169, 11171, 11173, 11176,
-    11178, 11180, 11182, 11184, 11186, 11188, 11191, 11193, 11195, 11197, 11199,
-    11201, 11203, 11206, 11208, 11210, 11212, 11214, 11216, 11218, 11221, 11223,
-    11225, 11227, 11229, 11231, 11233, 11236, 11238, 11240, 11242, 11244, 11246,
-    11249, 11251, 11253, 11255, 11257, 11259, 11261, 11264, 11266, 11268, 11270,
-    11272, 11274, 11277, 11279, 11281, 11283, 11285, 11287, 11289, 11292, 11294,
-    11296, 11298, 11300, 11302, 11305, 11307, 11309, 11311, 11313, 11315, 11318,
-    11320, 11322, 11324, 11326, 11328, 11331, 11333, 11335, 11337, 11339, 11341,
-    11344, 11346, 11348, 11350, 11352, 11355, 11357, 11359, 11361, 11363, 11365,
-    11368, 11370, 11372, 11374, 11376, 11378, 11381, 11383, 11385, 11387, 11389,
-    11392, 11394, 11396, 11398, 11400, 11402, 11405, 11407, 11409, 11411, 11413,
-    11416, 11418, 11420, 11422, 11424, 11426, 11429, 11431, 11433, 11435, 11437,
-    11440, 11442, 11444, 11446, 11448, 11451, 11453, 11455, 11457, 11459, 11461,
-    11464, 11466, 11468, 11470, 11472, 11475, 11477, 11479, 11481, 11483, 11486,
-    11488, 11490, 11492, 11494, 11497, 11499, 11501, 11503, 11505, 11508, 11510,
-    11512, 11514, 11516, 11519, 11521, 11523, 11525, 11527, 11530, 11532, 11534,
-    11536, 11539, 11541, 11543, 11545, 11547, 11550, 11552, 11554, 11556, 11558,
-    11561, 11563, 11565, 11567, 11569, 11572, 11574, 11576, 11578, 11581, 11583,
-    11585, 11587, 11589, 11592, 11594, 11596, 11598, 11601, 11603, 11605, 11607,
-    11609, 11612, 11614, 11616, 11618, 11621, 11623, 11625, 11627, 11629, 11632,
-    11634, 11636, 11638, 11641, 11643, 11645, 11647, 11649, 11652, 11654, 11656,
-    11658, 11661, 11663, 11665, 11667, 11670, 11672, 11674, 11676, 11678, 11681,
-    11683, 11685, 11687, 11690, 11692, 11694, 11696, 11699, 11701, 11703, 11705,
-    11708, 11710, 11712, 11714, 11717, 11719, 11721, 11723, 11726, 11728, 11730,
-    11732, 11735, 11737, 11739, 11741, 11743, 11746, 11748, 11750, 11752, 11755,
-    11757, 11759, 11761, 11764, 11766, 11768, 11770, 11773, 11775, 11777, 11780,
-    11782, 11784, 11786, 11789, 11791, 11793, 11795, 11798, 11800, 11802, 11804,
-    11807, 11809, 11811, 11813, 11816, 11818, 11820, 11822, 11825, 11827, 11829,
-    11831, 11834, 11836, 11838, 11841, 11843, 11845, 11847, 11850, 11852, 11854,
-    11856, 11859, 11861, 11863, 11865, 11868, 11870, 11872, 11875, 11877, 11879,
-    11881, 11884, 11886, 11888, 11890, 11893, 11895, 11897, 11900, 11902, 11904,
-    11906, 11909, 11911, 11913, 11916, 11918, 11920, 11922, 11925, 11927, 11929,
-    11931, 11934, 11936, 11938, 11941, 11943, 11945, 11947, 11950, 11952, 11954,
-    11957, 11959, 11961, 11964, 11966, 11968, 11970, 11973, 11975, 11977, 11980,
-    11982, 11984, 11986, 11989, 11991, 11993, 11996, 11998, 12000, 12002, 12005,
-    12007, 12009, 12012, 12014, 12016, 12019, 12021, 12023, 12025, 12028, 12030,
-    12032, 12035, 12037, 12039, 12042, 12044, 12046, 12049, 12051, 12053, 12055,
-    12058, 12060, 12062, 12065, 12067, 12069, 12072, 12074, 12076, 12079, 12081,
-    12083, 12085, 12088, 12090, 12092, 12095, 12097, 12099, 12102, 12104, 12106,
-    12109, 12111, 12113, 12116, 12118, 12120, 12123, 12125, 12127, 12129, 12132,
-    12134, 12136, 12139, 12141, 12143, 12146, 12148, 12150, 12153, 12155, 12157,
-    12160, 12162, 12164, 12167, 12169, 12171, 12174, 12176, 12178, 12181, 12183,
-    12185, 12188, 12190, 12192, 12195, 12197, 12199, 12202, 12204, 12206, 12209,
-    12211, 12213, 12216, 12218, 12220, 12223, 12225, 12227, 12230, 12232, 12234,
-    12237, 12239, 12241, 12244, 12246, 12248, 12251, 12253, 12255, 12258, 12260,
-    12262, 12265, 12267, 12270, 12272, 12274, 12277, 12279, 12281, 12284, 12286,
-    12288, 12291, 12293, 12295, 12298, 12300, 12302, 12305, 12307, 12309, 12312,
-    12314, 12317, 12319, 12321, 12324, 12326, 12328, 12331, 12333, 12335, 12338,
-    12340, 12342, 12345, 12347, 12350, 12352, 12354, 12357, 12359, 12361, 12364,
-    12366, 12368, 12371, 12373, 12376, 12378, 12380, 12383, 12385, 12387, 12390,
-    12392, 12395, 12397, 12399, 12402, 12404, 12406, 12409, 12411, 12414, 12416,
-    12418, 12421, 12423, 12425, 12428, 12430, 12433, 12435, 12437, 12440, 12442,
-    12444, 12447, 12449, 12452, 12454, 12456, 12459, 12461, 12464, 12466, 12468,
-    12471, 12473, 12475, 12478, 12480, 12483, 12485, 12487, 12490, 12492, 12495,
-    12497, 12499, 12502, 12504, 12506, 12509, 12511, 12514, 12516, 12518, 12521,
-    12523, 12526, 12528, 12530, 12533, 12535, 12538, 12540, 12542, 12545, 12547,
-    12550, 12552, 12554, 12557, 12559, 12562, 12564, 12566, 12569, 12571, 12574,
-    12576, 12578, 12581, 12583, 12586, 12588, 12591, 12593, 12595, 12598, 12600,
-    12603, 12605, 12607, 12610, 12612, 12615, 12617, 12619, 12622, 12624, 12627,
-    12629, 12632, 12634, 12636, 12639, 12641, 12644, 12646, 12648, 12651, 12653,
-    12656, 12658, 12661, 12663, 12665, 12668, 12670, 12673, 12675, 12678, 12680,
-    12682, 12685, 12687, 12690, 12692, 12695, 12697, 12699, 12702, 12704, 12707,
-    12709, 12712, 12714, 12716, 12719, 12721, 12724, 12726, 12729, 12731, 12733,
-    12736, 12738, 12741, 12743, 12746, 12748, 12750, 12753, 12755, 12758, 12760,
-    12763, 12765, 12768, 12770, 12772, 12775, 12777, 12780, 12782, 12785, 12787,
-    12790, 12792, 12794, 12797, 12799, 12802, 12804, 12807, 12809, 12812, 12814,
-    12817, 12819, 12821, 12824, 12826, 12829, 12831, 12834, 12836, 12839, 12841,
-    12844, 12846, 12848, 12851, 12853, 12856, 12858, 12861, 12863, 12866, 12868,
-    12871, 12873, 12875, 12878, 12880, 12883, 12885, 12888, 12890, 12893, 12895,
-    12898, 12900, 12903, 12905, 12908, 12910, 12912, 12915, 12917, 12920, 12922,
-    12925, 12927, 12930, 12932, 12935, 12937, 12940, 12942, 12945, 12947, 12950,
-    12952, 12955, 12957, 12959, 12962, 12964, 12967, 12969, 12972, 12974, 12977,
-    12979, 12982, 12984, 12987, 12989, 12992, 12994, 12997, 12999, 13002, 13004,
-    13007, 13009, 13012, 13014, 13017, 13019, 13022, 13024, 13027, 13029, 13032,
-    13034, 13037, 13039, 13042, 13044, 13047, 13049, 13052, 13054, 13057, 13059,
-    13062, 13064, 13067, 13069, 13072, 13074, 13077, 13079, 13082, 13084, 13087,
-    13089, 13092, 13094, 13097, 13099, 13102, 13104, 13107, 13109, 13112, 13114,
-    13117, 13119, 13122, 13124, 13127, 13129, 13132, 13134, 13137, 13139, 13142,
-    13144, 13147, 13149, 13152, 13154, 13157, 13159, 13162, 13164, 13167, 13169,
-    13172, 13174, 13177, 13179, 13182, 13184, 13187, 13190, 13192, 13195, 13197,
-    13200, 13202, 13205, 13207, 13210, 13212, 13215, 13217, 13220, 13222, 13225,
-    13227, 13230, 13232, 13235, 13238, 13240, 13243, 13245, 13248, 13250, 13253,
-    13255, 13258, 13260, 13263, 13265, 13268, 13271, 13273, 13276, 13278, 13281,
-    13283, 13286, 13288, 13291, 13293, 13296, 13298, 13301, 13304, 13306, 13309,
-    13311, 13314, 13316, 13319, 13321, 13324, 13326, 13329, 13332, 13334, 13337,
-    13339, 13342, 13344, 13347, 13349, 13352, 13355, 13357, 13360, 13362, 13365,
-    13367, 13370, 13372, 13375, 13378, 13380, 13383, 13385, 13388, 13390, 13393,
-    13395, 13398, 13401, 13403, 13406, 13408, 13411, 13413, 13416, 13419, 13421,
-    13424, 13426, 13429, 13431, 13434, 13436, 13439, 13442, 13444, 13447, 13449,
-    13452, 13454, 13457, 13460, 13462, 13465, 13467, 13470, 13473, 13475, 13478,
-    13480, 13483, 13485, 13488, 13491, 13493, 13496, 13498, 13501, 13503, 13506,
-    13509, 13511, 13514, 13516, 13519, 13522, 13524, 13527, 13529, 13532, 13534,
-    13537, 13540, 13542, 13545, 13547, 13550, 13553, 13555, 13558, 13560, 13563,
-    13566, 13568, 13571, 13573, 13576, 13579, 13581, 13584, 13586, 13589, 13592,
-    13594, 13597, 13599, 13602, 13605, 13607, 13610, 13612, 13615, 13618, 13620,
-    13623, 13625, 13628, 13631, 13633, 13636, 13638, 13641, 13644, 13646, 13649,
-    13651, 13654, 13657, 13659, 13662, 13665, 13667, 13670, 13672, 13675, 13678,
-    13680, 13683, 13685, 13688, 13691, 13693, 13696, 13699, 13701, 13704, 13706,
-    13709, 13712, 13714, 13717, 13720, 13722, 13725, 13727, 13730, 13733, 13735,
-    13738, 13741, 13743, 13746, 13748, 13751, 13754, 13756, 13759, 13762, 13764,
-    13767, 13769, 13772, 13775, 13777, 13780, 13783, 13785, 13788, 13791, 13793,
-    13796, 13798, 13801, 13804, 13806, 13809, 13812, 13814, 13817, 13820, 13822,
-    13825, 13827, 13830, 13833, 13835, 13838, 13841, 13843, 13846, 13849, 13851,
-    13854, 13857, 13859, 13862, 13865, 13867, 13870, 13873, 13875, 13878, 13880,
-    13883, 13886, 13888, 13891, 13894, 13896, 13899, 13902, 13904, 13907, 13910,
-    13912, 13915, 13918, 13920, 13923, 13926, 13928, 13931, 13934, 13936, 13939,
-    13942, 13944, 13947, 13950, 13952, 13955, 13958, 13960, 13963, 13966, 13968,
-    13971, 13974, 13976, 13979, 13982, 13984, 13987, 13990, 13992, 13995, 13998,
-    14000, 14003, 14006, 14008, 14011, 14014, 14016, 14019, 14022, 14025, 14027,
-    14030, 14033, 14035, 14038, 14041, 14043, 14046, 14049, 14051, 14054, 14057,
-    14059, 14062, 14065, 14067, 14070, 14073, 14076, 14078, 14081, 14084, 14086,
-    14089, 14092, 14094, 14097, 14100, 14102, 14105, 14108, 14111, 14113, 14116,
-    14119, 14121, 14124, 14127, 14129, 14132, 14135, 14138, 14140, 14143, 14146,
-    14148, 14151, 14154, 14157, 14159, 14162, 14165, 14167, 14170, 14173, 14175,
-    14178, 14181, 14184, 14186, 14189, 14192, 14194, 14197, 14200, 14203, 14205,
-    14208, 14211, 14213, 14216, 14219, 14222, 14224, 14227, 14230, 14233, 14235,
-    14238, 14241, 14243, 14246, 14249, 14252, 14254, 14257, 14260, 14262, 14265,
-    14268, 14271, 14273, 14276, 14279, 14282, 14284, 14287, 14290, 14292, 14295,
-    14298, 14301, 14303, 14306, 14309, 14312, 14314, 14317, 14320, 14323, 14325,
-    14328, 14331, 14334, 14336, 14339, 14342, 14345, 14347, 14350, 14353, 14355,
-    14358, 14361, 14364, 14366, 14369, 14372, 14375, 14377, 14380, 14383, 14386,
-    14388, 14391, 14394, 14397, 14399, 14402, 14405, 14408, 14410, 14413, 14416,
-    14419, 14421, 14424, 14427, 14430, 14433, 14435, 14438, 14441, 14444, 14446,
-    14449, 14452, 14455, 14457, 14460, 14463, 14466, 14468, 14471, 14474, 14477,
-    14480, 14482, 14485, 14488, 14491, 14493, 14496, 14499, 14502, 14504, 14507,
-    14510, 14513, 14516, 14518, 14521, 14524, 14527, 14529, 14532, 14535, 14538,
-    14541, 14543, 14546, 14549, 14552, 14554, 14557, 14560, 14563, 14566, 14568,
-    14571, 14574, 14577, 14580, 14582, 14585, 14588, 14591, 14593, 14596, 14599,
-    14602, 14605, 14607, 14610, 14613, 14616, 14619, 14621, 14624, 14627, 14630,
-    14633, 14635, 14638, 14641, 14644, 14647, 14649, 14652, 14655, 14658, 14661,
-    14663, 14666, 14669, 14672, 14675, 14677, 14680, 14683, 14686, 14689, 14691,
-    14694, 14697, 14700, 14703, 14705, 14708, 14711, 14714, 14717, 14720, 14722,
-    14725, 14728, 14731, 14734, 14736, 14739, 14742, 14745, 14748, 14751, 14753,
-    14756, 14759, 14762, 14765, 14767, 14770, 14773, 14776, 14779, 14782, 14784,
-    14787, 14790, 14793, 14796, 14799, 14801, 14804, 14807, 14810, 14813, 14816,
-    14818, 14821, 14824, 14827, 14830, 14833, 14835, 14838, 14841, 14844, 14847,
-    14850, 14852, 14855, 14858, 14861, 14864, 14867, 14869, 14872, 14875, 14878,
-    14881, 14884, 14886, 14889, 14892, 14895, 14898, 14901, 14904, 14906, 14909,
-    14912, 14915, 14918, 14921, 14924, 14926, 14929, 14932, 14935, 14938, 14941,
-    14943, 14946, 14949, 14952, 14955, 14958, 14961, 14963, 14966, 14969, 14972,
-    14975, 14978, 14981, 14984, 14986, 14989, 14992, 14995, 14998, 15001, 15004,
-    15006, 15009, 15012, 15015, 15018, 15021, 15024, 15027, 15029, 15032, 15035,
-    15038, 15041, 15044, 15047, 15050, 15052, 15055, 15058, 15061, 15064, 15067,
-    15070, 15073, 15075, 15078, 15081, 15084, 15087, 15090, 15093, 15096, 15099,
-    15101, 15104, 15107, 15110, 15113, 15116, 15119, 15122, 15125, 15127, 15130,
-    15133, 15136, 15139, 15142, 15145, 15148, 15151, 15153, 15156, 15159, 15162,
-    15165, 15168, 15171, 15174, 15177, 15180, 15182, 15185, 15188, 15191, 15194,
-    15197, 15200, 15203, 15206, 15209, 15211, 15214, 15217, 15220, 15223, 15226,
-    15229, 15232, 15235, 15238, 15241, 15244, 15246, 15249, 15252, 15255, 15258,
-    15261, 15264, 15267, 15270, 15273, 15276, 15279, 15281, 15284, 15287, 15290,
-    15293, 15296, 15299, 15302, 15305, 15308, 15311, 15314, 15317, 15319, 15322,
-    15325, 15328, 15331, 15334, 15337, 15340, 15343, 15346, 15349, 15352, 15355,
-    15358, 15360, 15363, 15366, 15369, 15372, 15375, 15378, 15381, 15384, 15387,
-    15390, 15393, 15396, 15399, 15402, 15405, 15408, 15410, 15413, 15416, 15419,
-    15422, 15425, 15428, 15431, 15434, 15437, 15440, 15443, 15446, 15449, 15452,
-    15455, 15458, 15461, 15464, 15467, 15469, 15472, 15475, 15478, 15481, 15484,
-    15487, 15490, 15493, 15496, 15499, 15502, 15505, 15508, 15511, 15514, 15517,
-    15520, 15523, 15526, 15529, 15532, 15535, 15538, 15541, 15544, 15547, 15550,
-    15552, 15555, 15558, 15561, 15564, 15567, 15570, 15573, 15576, 15579, 15582,
-    15585, 15588, 15591, 15594, 15597, 15600, 15603, 15606, 15609, 15612, 15615,
-    15618, 15621, 15624, 15627, 15630, 15633, 15636, 15639, 15642, 15645, 15648,
-    15651, 15654, 15657, 15660, 15663, 15666, 15669, 15672, 15675, 15678, 15681,
-    15684, 15687, 15690, 15693, 15696, 15699, 15702, 15705, 15708, 15711, 15714,
-    15717, 15720, 15723, 15726, 15729, 15732, 15735, 15738, 15741, 15744, 15747,
-    15750, 15753, 15756, 15759, 15762, 15765, 15768, 15771, 15774, 15777, 15780,
-    15783, 15786, 15789, 15792, 15795, 15798, 15801, 15804, 15807, 15810, 15813,
-    15816, 15819, 15822, 15825, 15828, 15831, 15834, 15837, 15840, 15843, 15847,
-    15850, 15853, 15856, 15859, 15862, 15865, 15868, 15871, 15874, 15877, 15880,
-    15883, 15886, 15889, 15892, 15895, 15898, 15901, 15904, 15907, 15910, 15913,
-    15916, 15919, 15922, 15925, 15928, 15932, 15935, 15938, 15941, 15944, 15947,
-    15950, 15953, 15956, 15959, 15962, 15965, 15968, 15971, 15974, 15977, 15980,
-    15983, 15986, 15989, 15993, 15996, 15999, 16002, 16005, 16008, 16011, 16014,
-    16017, 16020, 16023, 16026, 16029, 16032, 16035, 16038, 16042, 16045, 16048,
-    16051, 16054, 16057, 16060, 16063, 16066, 16069, 16072, 16075, 16078, 16081,
-    16084, 16088, 16091, 16094, 16097, 16100, 16103, 16106, 16109, 16112, 16115,
-    16118, 16121, 16124, 16128, 16131, 16134, 16137, 16140, 16143, 16146, 16149,
-    16152, 16155, 16158, 16161, 16165, 16168, 16171, 16174, 16177, 16180, 16183,
-    16186, 16189, 16192, 16195, 16199, 16202, 16205, 16208, 16211, 16214, 16217,
-    16220, 16223, 16226, 16230, 16233, 16236, 16239, 16242, 16245, 16248, 16251,
-    16254, 16258, 16261, 16264, 16267, 16270, 16273, 16276, 16279, 16282, 16285,
-    16289, 16292, 16295, 16298, 16301, 16304, 16307, 16310, 16314, 16317, 16320,
-    16323, 16326, 16329, 16332, 16335, 16338, 16342, 16345, 16348, 16351, 16354,
-    16357, 16360, 16363, 16367, 16370, 16373, 16376, 16379, 16382, 16385, 16389,
-    16392, 16395, 16398, 16401, 16404, 16407, 16410, 16414, 16417, 16420, 16423,
-    16426, 16429, 16432, 16436, 16439, 16442, 16445, 16448, 16451, 16454, 16458,
-    16461, 16464, 16467, 16470, 16473, 16476, 16480, 16483, 16486, 16489, 16492,
-    16495, 16498, 16502, 16505, 16508, 16511, 16514, 16517, 16521, 16524, 16527,
-    16530, 16533, 16536, 16539, 16543, 16546, 16549, 16552, 16555, 16558, 16562,
-    16565, 16568, 16571, 16574, 16577, 16581, 16584, 16587, 16590, 16593, 16596,
-    16600, 16603, 16606, 16609, 16612, 16616, 16619, 16622, 16625, 16628, 16631,
-    16635, 16638, 16641, 16644, 16647, 16650, 16654, 16657, 16660, 16663, 16666,
-    16670, 16673, 16676, 16679, 16682, 16686, 16689, 16692, 16695, 16698, 16701,
-    16705, 16708, 16711, 16714, 16717, 16721, 16724, 16727, 16730, 16733, 16737,
-    16740, 16743, 16746, 16749, 16753, 16756, 16759, 16762, 16765, 16769, 16772,
-    16775, 16778, 16781, 16785, 16788, 16791, 16794, 16797, 16801, 16804, 16807,
-    16810, 16814, 16817, 16820, 16823, 16826, 16830, 16833, 16836, 16839, 16842,
-    16846, 16849, 16852, 16855, 16859, 16862, 16865, 16868, 16871, 16875, 16878,
-    16881, 16884, 16888, 16891, 16894, 16897, 16900, 16904, 16907, 16910, 16913,
-    16917, 16920, 16923, 16926, 16930, 16933, 16936, 16939, 16942, 16946, 16949,
-    16952, 16955, 16959, 16962, 16965, 16968, 16972, 16975, 16978, 16981, 16985,
-    16988, 16991, 16994, 16998, 17001, 17004, 17007, 17011, 17014, 17017, 17020,
-    17024, 17027, 17030, 17033, 17037, 17040, 17043, 17046, 17050, 17053, 17056,
-    17059, 17063, 17066, 17069, 17072, 17076, 17079, 17082, 17086, 17089, 17092,
-    17095, 17099, 17102, 17105, 17108, 17112, 17115, 17118, 17121, 17125, 17128,
-    17131, 17135, 17138, 17141, 17144, 17148, 17151, 17154, 17157, 17161, 17164,
-    17167, 17171, 17174, 17177, 17180, 17184, 17187, 17190, 17194, 17197, 17200,
-    17203, 17207, 17210, 17213, 17217, 17220, 17223, 17226, 17230, 17233, 17236,
-    17240, 17243, 17246, 17249, 17253, 17256, 17259, 17263, 17266, 17269, 17273,
-    17276, 17279, 17282, 17286, 17289, 17292, 17296, 17299, 17302, 17306, 17309,
-    17312, 17316, 17319, 17322, 17325, 17329, 17332, 17335, 17339, 17342, 17345,
-    17349, 17352, 17355, 17359, 17362, 17365, 17369, 17372, 17375, 17378, 17382,
-    17385, 17388, 17392, 17395, 17398, 17402, 17405, 17408, 17412, 17415, 17418,
-    17422, 17425, 17428, 17432, 17435, 17438, 17442, 17445, 17448, 17452, 17455,
-    17458, 17462, 17465, 17468, 17472, 17475, 17478, 17482, 17485, 17488, 17492,
-    17495, 17498, 17502, 17505, 17508, 17512, 17515, 17518, 17522, 17525, 17529,
-    17532, 17535, 17539, 17542, 17545, 17549, 17552, 17555, 17559, 17562, 17565,
-    17569, 17572, 17575, 17579, 17582, 17586, 17589, 17592, 17596, 17599, 17602,
-    17606, 17609, 17612, 17616, 17619, 17623, 17626, 17629, 17633, 17636, 17639,
-    17643, 17646, 17649, 17653, 17656, 17660, 17663, 17666, 17670, 17673, 17676,
-    17680, 17683, 17687, 17690, 17693, 17697, 17700, 17703, 17707, 17710, 17714,
-    17717, 17720, 17724, 17727, 17731, 17734, 17737, 17741, 17744, 17747, 17751,
-    17754, 17758, 17761, 17764, 17768, 17771, 17775, 17778, 17781, 17785, 17788,
-    17792, 17795, 17798, 17802, 17805, 17809, 17812, 17815, 17819, 17822, 17826,
-    17829, 17832, 17836, 17839, 17843, 17846, 17849, 17853, 17856, 17860, 17863,
-    17867, 17870, 17873, 17877, 17880, 17884, 17887, 17890, 17894, 17897, 17901,
-    17904, 17908, 17911, 17914, 17918, 17921, 17925, 17928, 17932, 17935, 17938,
-    17942, 17945, 17949, 17952, 17955, 17959, 17962, 17966, 17969, 17973, 17976,
-    17980, 17983, 17986, 17990, 17993, 17997, 18000, 18004, 18007, 18010, 18014,
-    18017, 18021, 18024, 18028, 18031, 18035, 18038, 18041, 18045, 18048, 18052,
-    18055, 18059, 18062, 18066, 18069, 18072, 18076, 18079, 18083, 18086, 18090,
-    18093, 18097, 18100, 18104, 18107, 18110, 18114, 18117, 18121, 18124, 18128,
-    18131, 18135, 18138, 18142, 18145, 18149, 18152, 18156, 18159, 18162, 18166,
-    18169, 18173, 18176, 18180, 18183, 18187, 18190, 18194, 18197, 18201, 18204,
-    18208, 18211, 18215, 18218, 18222, 18225, 18228, 18232, 18235, 18239, 18242,
-    18246, 18249, 18253, 18256, 18260, 18263, 18267, 18270, 18274, 18277, 18281,
-    18284, 18288, 18291, 18295, 18298, 18302, 18305, 18309, 18312, 18316, 18319,
-    18323, 18326, 18330, 18333, 18337, 18340, 18344, 18347, 18351, 18354, 18358,
-    18361, 18365, 18368, 18372, 18375, 18379, 18382, 18386, 18389, 18393, 18396,
-    18400, 18403, 18407, 18410, 18414, 18417, 18421, 18424, 18428, 18432, 18435,
-    18439, 18442, 18446, 18449, 18453, 18456, 18460, 18463, 18467, 18470, 18474,
-    18477, 18481, 18484, 18488, 18491, 18495, 18499, 18502, 18506, 18509, 18513,
-    18516, 18520, 18523, 18527, 18530, 18534, 18537, 18541, 18545, 18548, 18552,
-    18555, 18559, 18562, 18566, 18569, 18573, 18576, 18580, 18584, 18587, 18591,
-    18594, 18598, 18601, 18605, 18608, 18612, 18615, 18619, 18623, 18626, 18630,
-    18633, 18637, 18640, 18644, 18648, 18651, 18655, 18658, 18662, 18665, 18669,
-    18672, 18676, 18680, 18683, 18687, 18690, 18694, 18697, 18701, 18705, 18708,
-    18712, 18715, 18719, 18722, 18726, 18730, 18733, 18737, 18740, 18744, 18747,
-    18751, 18755, 18758, 18762, 18765, 18769, 18773, 18776, 18780, 18783, 18787,
-    18791, 18794, 18798, 18801, 18805, 18808, 18812, 18816, 18819, 18823, 18826,
-    18830, 18834, 18837, 18841, 18844, 18848, 18852, 18855, 18859, 18862, 18866,
-    18870, 18873, 18877, 18880, 18884, 18888, 18891, 18895, 18898, 18902, 18906,
-    18909, 18913, 18917, 18920, 18924, 18927, 18931, 18935, 18938, 18942, 18945,
-    18949, 18953, 18956, 18960, 18964, 18967, 18971, 18974, 18978, 18982, 18985,
-    18989, 18993, 18996, 19000, 19003, 19007, 19011, 19014, 19018, 19022, 19025,
-    19029, 19032, 19036, 19040, 19043, 19047, 19051, 19054, 19058, 19062, 19065,
-    19069, 19072, 19076, 19080, 19083, 19087, 19091, 19094, 19098, 19102, 19105,
-    19109, 19113, 19116, 19120, 19124, 19127, 19131, 19135, 19138, 19142, 19145,
-    19149, 19153, 19156, 19160, 19164, 19167, 19171, 19175, 19178, 19182, 19186,
-    19189, 19193, 19197, 19200, 19204, 19208, 19211, 19215, 19219, 19222, 19226,
-    19230, 19233, 19237, 19241, 19244, 19248, 19252, 19255, 19259, 19263, 19267,
-    19270, 19274, 19278, 19281, 19285, 19289, 19292, 19296, 19300, 19303, 19307,
-    19311, 19314, 19318, 19322, 19325, 19329, 19333, 19337, 19340, 19344, 19348,
-    19351, 19355, 19359, 19362, 19366, 19370, 19373, 19377, 19381, 19385, 19388,
-    19392, 19396, 19399, 19403, 19407, 19411, 19414, 19418, 19422, 19425, 19429,
-    19433, 19436, 19440, 19444, 19448, 19451, 19455, 19459, 19462, 19466, 19470,
-    19474, 19477, 19481, 19485, 19489, 19492, 19496, 19500, 19503, 19507, 19511,
-    19515, 19518, 19522, 19526, 19529, 19533, 19537, 19541, 19544, 19548, 19552,
-    19556, 19559, 19563, 19567, 19571, 19574, 19578, 19582, 19586, 19589, 19593,
-    19597, 19600, 19604, 19608, 19612, 19615, 19619, 19623, 19627, 19630, 19634,
-    19638, 19642, 19645, 19649, 19653, 19657, 19660, 19664, 19668, 19672, 19675,
-    19679, 19683, 19687, 19691, 19694, 19698, 19702, 19706, 19709, 19713, 19717,
-    19721, 19724, 19728, 19732, 19736, 19739, 19743, 19747, 19751, 19755, 19758,
-    19762, 19766, 19770, 19773, 19777, 19781, 19785, 19789, 19792, 19796, 19800,
-    19804, 19807, 19811, 19815, 19819, 19823, 19826, 19830, 19834, 19838, 19841,
-    19845, 19849, 19853, 19857, 19860, 19864, 19868, 19872, 19876, 19879, 19883,
-    19887, 19891, 19895, 19898, 19902, 19906, 19910, 19914, 19917, 19921, 19925,
-    19929, 19933, 19936, 19940, 19944, 19948, 19952, 19955, 19959, 19963, 19967,
-    19971, 19975, 19978, 19982, 19986, 19990, 19994, 19997, 20001, 20005, 20009,
-    20013, 20017, 20020, 20024, 20028, 20032, 20036, 20039, 20043, 20047, 20051,
-    20055, 20059, 20062, 20066, 20070, 20074, 20078, 20082, 20085, 20089, 20093,
-    20097, 20101, 20105, 20108, 20112, 20116, 20120, 20124, 20128, 20131, 20135,
-    20139, 20143, 20147, 20151, 20155, 20158, 20162, 20166, 20170, 20174, 20178,
-    20182, 20185, 20189, 20193, 20197, 20201, 20205, 20209, 20212, 20216, 20220,
-    20224, 20228, 20232, 20236, 20239, 20243, 20247, 20251, 20255, 20259, 20263,
-    20266, 20270, 20274, 20278, 20282, 20286, 20290, 20294, 20297, 20301, 20305,
-    20309, 20313, 20317, 20321, 20325, 20328, 20332, 20336, 20340, 20344, 20348,
-    20352, 20356, 20360, 20363, 20367, 20371, 20375, 20379, 20383, 20387, 20391,
-    20395, 20398, 20402, 20406, 20410, 20414, 20418, 20422, 20426, 20430, 20434,
-    20437, 20441, 20445, 20449, 20453, 20457, 20461, 20465, 20469, 20473, 20477,
-    20480, 20484, 20488, 20492, 20496, 20500, 20504, 20508, 20512, 20516, 20520,
-    20523, 20527, 20531, 20535, 20539, 20543, 20547, 20551, 20555, 20559, 20563,
-    20567, 20571, 20574, 20578, 20582, 20586, 20590, 20594, 20598, 20602, 20606,
-    20610, 20614, 20618, 20622, 20626, 20630, 20633, 20637, 20641, 20645, 20649,
-    20653, 20657, 20661, 20665, 20669, 20673, 20677, 20681, 20685, 20689, 20693,
-    20697, 20701, 20705, 20708, 20712, 20716, 20720, 20724, 20728, 20732, 20736,
-    20740, 20744, 20748, 20752, 20756, 20760, 20764, 20768, 20772, 20776, 20780,
-    20784, 20788, 20792, 20796, 20800, 20804, 20808, 20812, 20815, 20819, 20823,
-    20827, 20831, 20835, 20839, 20843, 20847, 20851, 20855, 20859, 20863, 20867,
-    20871, 20875, 20879, 20883, 20887, 20891, 20895, 20899, 20903, 20907, 20911,
-    20915, 20919, 20923, 20927, 20931, 20935, 20939, 20943, 20947, 20951, 20955,
-    20959, 20963, 20967, 20971, 20975, 20979, 20983, 20987, 20991, 20995, 20999,
-    21003, 21007, 21011, 21015, 21019, 21023, 21027, 21031, 21035, 21039, 21043,
-    21047, 21051, 21055, 21059, 21063, 21067, 21071, 21075, 21079, 21083, 21087,
-    21091, 21096, 21100, 21104, 21108, 21112, 21116, 21120, 21124, 21128, 21132,
-    21136, 21140, 21144, 21148, 21152, 21156, 21160, 21164, 21168, 21172, 21176,
-    21180, 21184, 21188, 21192, 21196, 21200, 21205, 21209, 21213, 21217, 21221,
-    21225, 21229, 21233, 21237, 21241, 21245, 21249, 21253, 21257, 21261, 21265,
-    21269, 21273, 21278, 21282, 21286, 21290, 21294, 21298, 21302, 21306, 21310,
-    21314, 21318, 21322, 21326, 21330, 21334, 21339, 21343, 21347, 21351, 21355,
-    21359, 21363, 21367, 21371, 21375, 21379, 21383, 21387, 21392, 21396, 21400,
-    21404, 21408, 21412, 21416, 21420, 21424, 21428, 21432, 21437, 21441, 21445,
-    21449, 21453, 21457, 21461, 21465, 21469, 21473, 21477, 21482, 21486, 21490,
-    21494, 21498, 21502, 21506, 21510, 21514, 21519, 21523, 21527, 21531, 21535,
-    21539, 21543, 21547, 21551, 21556, 21560, 21564, 21568, 21572, 21576, 21580,
-    21584, 21588, 21593, 21597, 21601, 21605, 21609, 21613, 21617, 21621, 21626,
-    21630, 21634, 21638, 21642, 21646, 21650, 21654, 21659, 21663, 21667, 21671,
-    21675, 21679, 21683, 21688, 21692, 21696, 21700, 21704, 21708, 21712, 21717,
-    21721, 21725, 21729, 21733, 21737, 21741, 21746, 21750, 21754, 21758, 21762,
-    21766, 21771, 21775, 21779, 21783, 21787, 21791, 21795, 21800, 21804, 21808,
-    21812, 21816, 21820, 21825, 21829, 21833, 21837, 21841, 21845, 21850, 21854,
-    21858, 21862, 21866, 21871, 21875, 21879, 21883, 21887, 21891, 21896, 21900,
-    21904, 21908, 21912, 21916, 21921, 21925, 21929, 21933, 21937, 21942, 21946,
-    21950, 21954, 21958, 21963, 21967, 21971, 21975, 21979, 21984, 21988, 21992,
-    21996, 22000, 22005, 22009, 22013, 22017, 22021, 22026, 22030, 22034, 22038,
-    22042, 22047, 22051, 22055, 22059, 22063, 22068, 22072, 22076, 22080, 22084,
-    22089, 22093, 22097, 22101, 22106, 22110, 22114, 22118, 22122, 22127, 22131,
-    22135, 22139, 22144, 22148, 22152, 22156, 22160, 22165, 22169, 22173, 22177,
-    22182, 22186, 22190, 22194, 22199, 22203, 22207, 22211, 22216, 22220, 22224,
-    22228, 22232, 22237, 22241, 22245, 22249, 22254, 22258, 22262, 22266, 22271,
-    22275, 22279, 22283, 22288, 22292, 22296, 22300, 22305, 22309, 22313, 22318,
-    22322, 22326, 22330, 22335, 22339, 22343, 22347, 22352, 22356, 22360, 22364,
-    22369, 22373, 22377, 22382, 22386, 22390, 22394, 22399, 22403, 22407, 22411,
-    22416, 22420, 22424, 22429, 22433, 22437, 22441, 22446, 22450, 22454, 22459,
-    22463, 22467, 22471, 22476, 22480, 22484, 22489, 22493, 22497, 22501, 22506,
-    22510, 22514, 22519, 22523, 22527, 22532, 22536, 22540, 22544, 22549, 22553,
-    22557, 22562, 22566, 22570, 22575, 22579, 22583, 22587, 22592, 22596, 22600,
-    22605, 22609, 22613, 22618, 22622, 22626, 22631, 22635, 22639, 22644, 22648,
-    22652, 22657, 22661, 22665, 22670, 22674, 22678, 22683, 22687, 22691, 22696,
-    22700, 22704, 22709, 22713, 22717, 22722, 22726, 22730, 22735, 22739, 22743,
-    22748, 22752, 22756, 22761, 22765, 22769, 22774, 22778, 22782, 22787, 22791,
-    22795, 22800, 22804, 22808, 22813, 22817, 22821, 22826, 22830, 22835, 22839,
-    22843, 22848, 22852, 22856, 22861, 22865, 22869, 22874, 22878, 22883, 22887,
-    22891, 22896, 22900, 22904, 22909, 22913, 22918, 22922, 22926, 22931, 22935,
-    22939, 22944, 22948, 22953, 22957, 22961, 22966, 22970, 22974, 22979, 22983,
-    22988, 22992, 22996, 23001, 23005, 23010, 23014, 23018, 23023, 23027, 23032,
-    23036, 23040, 23045, 23049, 23054, 23058, 23062, 23067, 23071, 23076, 23080,
-    23084, 23089, 23093, 23098, 23102, 23106, 23111, 23115, 23120, 23124, 23128,
-    23133, 23137, 23142, 23146, 23151, 23155, 23159, 23164, 23168, 23173, 23177,
-    23181, 23186, 23190, 23195, 23199, 23204, 23208, 23212, 23217, 23221, 23226,
-    23230, 23235, 23239, 23243, 23248, 23252, 23257, 23261, 23266, 23270, 23275,
-    23279, 23283, 23288, 23292, 23297, 23301, 23306, 23310, 23315, 23319, 23323,
-    23328, 23332, 23337, 23341, 23346, 23350, 23355, 23359, 23364, 23368, 23372,
-    23377, 23381, 23386, 23390, 23395, 23399, 23404, 23408, 23413, 23417, 23422,
-    23426, 23431, 23435, 23439, 23444, 23448, 23453, 23457, 23462, 23466, 23471,
-    23475, 23480, 23484, 23489, 23493, 23498, 23502, 23507, 23511, 23516, 23520,
-    23525, 23529, 23534, 23538, 23543, 23547, 23552, 23556, 23561, 23565, 23570,
-    23574, 23579, 23583, 23588, 23592, 23597, 23601, 23606, 23610, 23615, 23619,
-    23624, 23628, 23633, 23637, 23642, 23646, 23651, 23655, 23660, 23664, 23669,
-    23673, 23678, 23682, 23687, 23691, 23696, 23700, 23705, 23709, 23714, 23718,
-    23723, 23728, 23732, 23737, 23741, 23746, 23750, 23755, 23759, 23764, 23768,
-    23773, 23777, 23782, 23786, 23791, 23796, 23800, 23805, 23809, 23814, 23818,
-    23823, 23827, 23832, 23836, 23841, 23846, 23850, 23855, 23859, 23864, 23868,
-    23873, 23877, 23882, 23887, 23891, 23896, 23900, 23905, 23909, 23914, 23918,
-    23923, 23928, 23932, 23937, 23941, 23946, 23950, 23955, 23960, 23964, 23969,
-    23973, 23978, 23982, 23987, 23992, 23996, 24001, 24005, 24010, 24015, 24019,
-    24024, 24028, 24033, 24037, 24042, 24047, 24051, 24056, 24060, 24065, 24070,
-    24074, 24079, 24083, 24088, 24093, 24097, 24102, 24106, 24111, 24116, 24120,
-    24125, 24129, 24134, 24139, 24143, 24148, 24152, 24157, 24162, 24166, 24171,
-    24175, 24180, 24185, 24189, 24194, 24199, 24203, 24208, 24212, 24217, 24222,
-    24226, 24231, 24236, 24240, 24245, 24249, 24254, 24259, 24263, 24268, 24273,
-    24277, 24282, 24286, 24291, 24296, 24300, 24305, 24310, 24314, 24319, 24324,
-    24328, 24333, 24337, 24342, 24347, 24351, 24356, 24361, 24365, 24370, 24375,
-    24379, 24384, 24389, 24393, 24398, 24403, 24407, 24412, 24417, 24421, 24426,
-    24431, 24435, 24440, 24445, 24449, 24454, 24459, 24463, 24468, 24473, 24477,
-    24482, 24487, 24491, 24496, 24501, 24505, 24510, 24515, 24519, 24524, 24529,
-    24533, 24538, 24543, 24547, 24552, 24557, 24561, 24566, 24571, 24575, 24580,
-    24585, 24590, 24594, 24599, 24604, 24608, 24613, 24618, 24622, 24627, 24632,
-    24637, 24641, 24646, 24651, 24655, 24660, 24665, 24669, 24674, 24679, 24684,
-    24688, 24693, 24698, 24702, 24707, 24712, 24717, 24721, 24726, 24731, 24735,
-    24740, 24745, 24750, 24754, 24759, 24764, 24768, 24773, 24778, 24783, 24787,
-    24792, 24797, 24802, 24806, 24811, 24816, 24821, 24825, 24830, 24835, 24839,
-    24844, 24849, 24854, 24858, 24863, 24868, 24873, 24877, 24882, 24887, 24892,
-    24896, 24901, 24906, 24911, 24915, 24920, 24925, 24930, 24934, 24939, 24944,
-    24949, 24953, 24958, 24963, 24968, 24973, 24977, 24982, 24987, 24992, 24996,
-    25001, 25006, 25011, 25015, 25020, 25025, 25030, 25035, 25039, 25044, 25049,
-    25054, 25058, 25063, 25068, 25073, 25078, 25082, 25087, 25092, 25097, 25102,
-    25106, 25111, 25116, 25121, 25125, 25130, 25135, 25140, 25145, 25149, 25154,
-    25159, 25164, 25169, 25173, 25178, 25183, 25188, 25193, 25198, 25202, 25207,
-    25212, 25217, 25222, 25226, 25231, 25236, 25241, 25246, 25250, 25255, 25260,
-    25265, 25270, 25275, 25279, 25284, 25289, 25294, 25299, 25304, 25308, 25313,
-    25318, 25323, 25328, 25332, 25337, 25342, 25347, 25352, 25357, 25362, 25366,
-    25371, 25376, 25381, 25386, 25391, 25395, 25400, 25405, 25410, 25415, 25420,
-    25424, 25429, 25434, 25439, 25444, 25449, 25454, 25458, 25463, 25468, 25473,
-    25478, 25483, 25488, 25493, 25497, 25502, 25507, 25512, 25517, 25522, 25527,
-    25531, 25536, 25541, 25546, 25551, 25556, 25561, 25566, 25570, 25575, 25580,
-    25585, 25590, 25595, 25600, 25605, 25610, 25614, 25619, 25624, 25629, 25634,
-    25639, 25644, 25649, 25654, 25658, 25663, 25668, 25673, 25678, 25683, 25688,
-    25693, 25698, 25703, 25707, 25712, 25717, 25722, 25727, 25732, 25737, 25742,
-    25747, 25752, 25757, 25761, 25766, 25771, 25776, 25781, 25786, 25791, 25796,
-    25801, 25806, 25811, 25816, 25820, 25825, 25830, 25835, 25840, 25845, 25850,
-    25855, 25860, 25865, 25870, 25875, 25880, 25885, 25890, 25894, 25899, 25904,
-    25909, 25914, 25919, 25924, 25929, 25934, 25939, 25944, 25949, 25954, 25959,
-    25964, 25969, 25974, 25979, 25984, 25989, 25993, 25998, 26003, 26008, 26013,
-    26018, 26023, 26028, 26033, 26038, 26043, 26048, 26053, 26058, 26063, 26068,
-    26073, 26078, 26083, 26088, 26093, 26098, 26103, 26108, 26113, 26118, 26123,
-    26128, 26133, 26138, 26143, 26148, 26153, 26158, 26163, 26168, 26173, 26178,
-    26183, 26188, 26193, 26198, 26203, 26208, 26213, 26218, 26223, 26228, 26233,
-    26238, 26243, 26248, 26253, 26258, 26263, 26268, 26273, 26278, 26283, 26288,
-    26293, 26298, 26303, 26308, 26313, 26318, 26323, 26328, 26333, 26338, 26343,
-    26348, 26353, 26358, 26363, 26368, 26373, 26378, 26383, 26388, 26393, 26398,
-    26403, 26408, 26413, 26418, 26423, 26429, 26434, 26439, 26444, 26449, 26454,
-    26459, 26464, 26469, 26474, 26479, 26484, 26489, 26494, 26499, 26504, 26509,
-    26514, 26519, 26525, 26530, 26535, 26540, 26545, 26550, 26555, 26560, 26565,
-    26570, 26575, 26580, 26585, 26590, 26595, 26601, 26606, 26611, 26616, 26621,
-    26626, 26631, 26636, 26641, 26646, 26651, 26656, 26661, 26667, 26672, 26677,
-    26682, 26687, 26692, 26697, 26702, 26707, 26712, 26718, 26723, 26728, 26733,
-    26738, 26743, 26748, 26753, 26758, 26763, 26769, 26774, 26779, 26784, 26789,
-    26794, 26799, 26804, 26809, 26815, 26820, 26825, 26830, 26835, 26840, 26845,
-    26850, 26855, 26861, 26866, 26871, 26876, 26881, 26886, 26891, 26897, 26902,
-    26907, 26912, 26917, 26922, 26927, 26932, 26938, 26943, 26948, 26953, 26958,
-    26963, 26968, 26974, 26979, 26984, 26989, 26994, 26999, 27004, 27010, 27015,
-    27020, 27025, 27030, 27035, 27041, 27046, 27051, 27056, 27061, 27066, 27072,
-    27077, 27082, 27087, 27092, 27097, 27103, 27108, 27113, 27118, 27123, 27128,
-    27134, 27139, 27144, 27149, 27154, 27159, 27165, 27170, 27175, 27180, 27185,
-    27191, 27196, 27201, 27206, 27211, 27217, 27222, 27227, 27232, 27237, 27242,
-    27248, 27253, 27258, 27263, 27268, 27274, 27279, 27284, 27289, 27295, 27300,
-    27305, 27310, 27315, 27321, 27326, 27331, 27336, 27341, 27347, 27352, 27357,
-    27362, 27368, 27373, 27378, 27383, 27388, 27394, 27399, 27404, 27409, 27415,
-    27420, 27425, 27430, 27435, 27441, 27446, 27451, 27456, 27462, 27467, 27472,
-    27477, 27483, 27488, 27493, 27498, 27504, 27509, 27514, 27519, 27525, 27530,
-    27535, 27540, 27546, 27551, 27556, 27561, 27567, 27572, 27577, 27582, 27588,
-    27593, 27598, 27603, 27609, 27614, 27619, 27625, 27630, 27635, 27640, 27646,
-    27651, 27656, 27661, 27667, 27672, 27677, 27683, 27688, 27693, 27698, 27704,
-    27709, 27714, 27720, 27725, 27730, 27735, 27741, 27746, 27751, 27757, 27762,
-    27767, 27772, 27778, 27783, 27788, 27794, 27799, 27804, 27810, 27815, 27820,
-    27826, 27831, 27836, 27841, 27847, 27852, 27857, 27863, 27868, 27873, 27879,
-    27884, 27889, 27895, 27900, 27905, 27911, 27916, 27921, 27927, 27932, 27937,
-    27943, 27948, 27953, 27959, 27964, 27969, 27975, 27980, 27985, 27991, 27996,
-    28001, 28007, 28012, 28017, 28023, 28028, 28033, 28039, 28044, 28049, 28055,
-    28060, 28065, 28071, 28076, 28081, 28087, 28092, 28098, 28103, 28108, 28114,
-    28119, 28124, 28130, 28135, 28140, 28146, 28151, 28157, 28162, 28167, 28173,
-    28178, 28183, 28189, 28194, 28200, 28205, 28210, 28216, 28221, 28226, 28232,
-    28237, 28243, 28248, 28253, 28259, 28264, 28270, 28275, 28280, 28286, 28291,
-    28297, 28302, 28307, 28313, 28318, 28324, 28329, 28334, 28340, 28345, 28351,
-    28356, 28361, 28367, 28372, 28378, 28383, 28388, 28394, 28399, 28405, 28410,
-    28416, 28421, 28426, 28432, 28437, 28443, 28448, 28454, 28459, 28464, 28470,
-    28475, 28481, 28486, 28492, 28497, 28502, 28508, 28513, 28519, 28524, 28530,
-    28535, 28540, 28546, 28551, 28557, 28562, 28568, 28573, 28579, 28584, 28590,
-    28595, 28600, 28606, 28611, 28617, 28622, 28628, 28633, 28639, 28644, 28650,
-    28655, 28661, 28666, 28671, 28677, 28682, 28688, 28693, 28699, 28704, 28710,
-    28715, 28721, 28726, 28732, 28737, 28743, 28748, 28754, 28759, 28765, 28770,
-    28776, 28781, 28787, 28792, 28798, 28803, 28808, 28814, 28819, 28825, 28830,
-    28836, 28841, 28847, 28852, 28858, 28864, 28869, 28875, 28880, 28886, 28891,
-    28897, 28902, 28908, 28913, 28919, 28924, 28930, 28935, 28941, 28946, 28952,
-    28957, 28963, 28968, 28974, 28979, 28985, 28990, 28996, 29001, 29007, 29013,
-    29018, 29024, 29029, 29035, 29040, 29046, 29051, 29057, 29062, 29068, 29073,
-    29079, 29085, 29090, 29096, 29101, 29107, 29112, 29118, 29123, 29129, 29135,
-    29140, 29146, 29151, 29157, 29162, 29168, 29173, 29179, 29185, 29190, 29196,
-    29201, 29207, 29212, 29218, 29224, 29229, 29235, 29240, 29246, 29251, 29257,
-    29263, 29268, 29274, 29279, 29285, 29291, 29296, 29302, 29307, 29313, 29319,
-    29324, 29330, 29335, 29341, 29346, 29352, 29358, 29363, 29369, 29374, 29380,
-    29386, 29391, 29397, 29403, 29408, 29414, 29419, 29425, 29431, 29436, 29442,
-    29447, 29453, 29459, 29464, 29470, 29476, 29481, 29487, 29492, 29498, 29504,
-    29509, 29515, 29521, 29526, 29532, 29537, 29543, 29549, 29554, 29560, 29566,
-    29571, 29577, 29583, 29588, 29594, 29599, 29605, 29611, 29616, 29622, 29628,
-    29633, 29639, 29645, 29650, 29656, 29662, 29667, 29673, 29679, 29684, 29690,
-    29696, 29701, 29707, 29713, 29718, 29724, 29730, 29735, 29741, 29747, 29752,
-    29758, 29764, 29769, 29775, 29781, 29786, 29792, 29798, 29803, 29809, 29815,
-    29820, 29826, 29832, 29838, 29843, 29849, 29855, 29860, 29866, 29872, 29877,
-    29883, 29889, 29894, 29900, 29906, 29912, 29917, 29923, 29929, 29934, 29940,
-    29946, 29952, 29957, 29963, 29969, 29974, 29980, 29986, 29992, 29997, 30003,
-    30009, 30014, 30020, 30026, 30032, 30037, 30043, 30049, 30055, 30060, 30066,
-    30072, 30077, 30083, 30089, 30095, 30100, 30106, 30112, 30118, 30123, 30129,
-    30135, 30141, 30146, 30152, 30158, 30164, 30169, 30175, 30181, 30187, 30192,
-    30198, 30204, 30210, 30215, 30221, 30227, 30233, 30239, 30244, 30250, 30256,
-    30262, 30267, 30273, 30279, 30285, 30290, 30296, 30302, 30308, 30314, 30319,
-    30325, 30331, 30337, 30343, 30348, 30354, 30360, 30366, 30371, 30377, 30383,
-    30389, 30395, 30400, 30406, 30412, 30418, 30424, 30429, 30435, 30441, 30447,
-    30453, 30458, 30464, 30470, 30476, 30482, 30488, 30493, 30499, 30505, 30511,
-    30517, 30522, 30528, 30534, 30540, 30546, 30552, 30557, 30563, 30569, 30575,
-    30581, 30587, 30592, 30598, 30604, 30610, 30616, 30622, 30627, 30633, 30639,
-    30645, 30651, 30657, 30662, 30668, 30674, 30680, 30686, 30692, 30698, 30703,
-    30709, 30715, 30721, 30727, 30733, 30739, 30744, 30750, 30756, 30762, 30768,
-    30774, 30780, 30786, 30791, 30797, 30803, 30809, 30815, 30821, 30827, 30833,
-    30838, 30844, 30850, 30856, 30862, 30868, 30874, 30880, 30886, 30891, 30897,
-    30903, 30909, 30915, 30921, 30927, 30933, 30939, 30944, 30950, 30956, 30962,
-    30968, 30974, 30980, 30986, 30992, 30998, 31004, 31009, 31015, 31021, 31027,
-    31033, 31039, 31045, 31051, 31057, 31063, 31069, 31075, 31081, 31086, 31092,
-    31098, 31104, 31110, 31116, 31122, 31128, 31134, 31140, 31146, 31152, 31158,
-    31164, 31170, 31176, 31181, 31187, 31193, 31199, 31205, 31211, 31217, 31223,
-    31229, 31235, 31241, 31247, 31253, 31259, 31265, 31271, 31277, 31283, 31289,
-    31295, 31301, 31307, 31313, 31319, 31325, 31330, 31336, 31342, 31348, 31354,
-    31360, 31366, 31372, 31378, 31384, 31390, 31396, 31402, 31408, 31414, 31420,
-    31426, 31432, 31438, 31444, 31450, 31456, 31462, 31468, 31474, 31480, 31486,
-    31492, 31498, 31504, 31510, 31516, 31522, 31528, 31534, 31540, 31546, 31552,
-    31558, 31564, 31570, 31576, 31582, 31588, 31594, 31601, 31607, 31613, 31619,
-    31625, 31631, 31637, 31643, 31649, 31655, 31661, 31667, 31673, 31679, 31685,
-    31691, 31697, 31703, 31709, 31715, 31721, 31727, 31733, 31739, 31745, 31752,
-    31758, 31764, 31770, 31776, 31782, 31788, 31794, 31800, 31806, 31812, 31818,
-    31824, 31830, 31836, 31842, 31849, 31855, 31861, 31867, 31873, 31879, 31885,
-    31891, 31897, 31903, 31909, 31915, 31922, 31928, 31934, 31940, 31946, 31952,
-    31958, 31964, 31970, 31976, 31982, 31989, 31995, 32001, 32007, 32013, 32019,
-    32025, 32031, 32037, 32044, 32050, 32056, 32062, 32068, 32074, 32080, 32086,
-    32092, 32099, 32105, 32111, 32117, 32123, 32129, 32135, 32141, 32148, 32154,
-    32160, 32166, 32172, 32178, 32184, 32191, 32197, 32203, 32209, 32215, 32221,
-    32227, 32234, 32240, 32246, 32252, 32258, 32264, 32270, 32277, 32283, 32289,
-    32295, 32301, 32307, 32314, 32320, 32326, 32332, 32338, 32344, 32351, 32357,
-    32363, 32369, 32375, 32381, 32388, 32394, 32400, 32406, 32412, 32418, 32425,
-    32431, 32437, 32443, 32449, 32456, 32462, 32468, 32474, 32480, 32487, 32493,
-    32499, 32505, 32511, 32518, 32524, 32530, 32536, 32542, 32549, 32555, 32561,
-    32567, 32573, 32580, 32586, 32592, 32598, 32604, 32611, 32617, 32623, 32629,
-    32636, 32642, 32648, 32654, 32660, 32667, 32673, 32679, 32685, 32692, 32698,
-    32704, 32710, 32717, 32723, 32729, 32735, 32742, 32748, 32754, 32760,
+int16_t expand_curve_data[1025] = {
+    0,     0,     0,     1,     1,     1,     2,     2,     3,     3,     4,
+    4,     4,     5,     5,     6,     6,     7,     7,     7,     8,     8,
+    9,     9,     10,    10,    11,    11,    11,    12,    12,    13,    13,
+    14,    14,    15,    15,    16,    16,    17,    17,    18,    18,    19,
+    19,    20,    20,    21,    21,    22,    22,    23,    23,    24,    25,
+    25,    26,    26,    27,    27,    28,    28,    29,    30,    30,    31,
+    31,    32,    32,    33,    34,    34,    35,    35,    36,    37,    37,
+    38,    39,    39,    40,    40,    41,    42,    42,    43,    44,    44,
+    45,    46,    46,    47,    48,    48,    49,    50,    51,    51,    52,
+    53,    53,    54,    55,    56,    56,    57,    58,    59,    59,    60,
+    61,    62,    62,    63,    64,    65,    65,    66,    67,    68,    69,
+    69,    70,    71,    72,    73,    74,    74,    75,    76,    77,    78,
+    79,    80,    81,    81,    82,    83,    84,    85,    86,    87,    88,
+    89,    90,    91,    92,    93,    93,    94,    95,    96,    97,    98,
+    99,    100,   101,   102,   103,   104,   105,   107,   108,   109,   110,
+    111,   112,   113,   114,   115,   116,   117,   118,   120,   121,   122,
+    123,   124,   125,   126,   128,   129,   130,   131,   132,   133,   135,
+    136,   137,   138,   140,   141,   142,   143,   145,   146,   147,   149,
+    150,   151,   152,   154,   155,   156,   158,   159,   161,   162,   163,
+    165,   166,   167,   169,   170,   172,   173,   175,   176,   178,   179,
+    181,   182,   184,   185,   187,   188,   190,   191,   193,   194,   196,
+    198,   199,   201,   202,   204,   206,   207,   209,   211,   212,   214,
+    216,   217,   219,   221,   223,   224,   226,   228,   230,   232,   233,
+    235,   237,   239,   241,   243,   244,   246,   248,   250,   252,   254,
+    256,   258,   260,   262,   264,   266,   268,   270,   272,   274,   276,
+    278,   280,   282,   285,   287,   289,   291,   293,   295,   298,   300,
+    302,   304,   306,   309,   311,   313,   316,   318,   320,   323,   325,
+    327,   330,   332,   335,   337,   339,   342,   344,   347,   349,   352,
+    355,   357,   360,   362,   365,   367,   370,   373,   375,   378,   381,
+    384,   386,   389,   392,   395,   397,   400,   403,   406,   409,   412,
+    415,   418,   421,   423,   426,   429,   432,   436,   439,   442,   445,
+    448,   451,   454,   457,   461,   464,   467,   470,   473,   477,   480,
+    483,   487,   490,   493,   497,   500,   504,   507,   511,   514,   518,
+    521,   525,   529,   532,   536,   539,   543,   547,   551,   554,   558,
+    562,   566,   570,   574,   577,   581,   585,   589,   593,   597,   601,
+    605,   609,   614,   618,   622,   626,   630,   635,   639,   643,   647,
+    652,   656,   661,   665,   670,   674,   678,   683,   688,   692,   697,
+    701,   706,   711,   716,   720,   725,   730,   735,   740,   745,   750,
+    755,   760,   765,   770,   775,   780,   785,   790,   795,   801,   806,
+    811,   817,   822,   827,   833,   838,   844,   849,   855,   861,   866,
+    872,   878,   884,   889,   895,   901,   907,   913,   919,   925,   931,
+    937,   943,   949,   955,   962,   968,   974,   981,   987,   993,   1000,
+    1006,  1013,  1019,  1026,  1033,  1039,  1046,  1053,  1060,  1067,  1074,
+    1081,  1088,  1095,  1102,  1109,  1116,  1123,  1130,  1138,  1145,  1152,
+    1160,  1167,  1175,  1183,  1190,  1198,  1205,  1213,  1221,  1229,  1237,
+    1245,  1253,  1261,  1269,  1277,  1285,  1294,  1302,  1310,  1319,  1327,
+    1336,  1344,  1353,  1361,  1370,  1379,  1388,  1396,  1405,  1414,  1423,
+    1433,  1442,  1451,  1460,  1469,  1479,  1488,  1498,  1507,  1517,  1527,
+    1536,  1546,  1556,  1566,  1576,  1586,  1596,  1606,  1616,  1626,  1637,
+    1647,  1658,  1668,  1679,  1689,  1700,  1711,  1722,  1733,  1744,  1755,
+    1766,  1777,  1788,  1800,  1811,  1822,  1834,  1846,  1857,  1869,  1881,
+    1893,  1905,  1917,  1929,  1941,  1953,  1965,  1978,  1990,  2003,  2016,
+    2028,  2041,  2054,  2067,  2080,  2093,  2106,  2119,  2133,  2146,  2160,
+    2173,  2187,  2201,  2215,  2228,  2242,  2257,  2271,  2285,  2299,  2314,
+    2328,  2343,  2358,  2372,  2387,  2402,  2417,  2433,  2448,  2463,  2479,
+    2494,  2510,  2526,  2541,  2557,  2573,  2589,  2606,  2622,  2638,  2655,
+    2671,  2688,  2705,  2722,  2739,  2756,  2773,  2791,  2808,  2826,  2843,
+    2861,  2879,  2897,  2915,  2933,  2952,  2970,  2988,  3007,  3026,  3045,
+    3064,  3083,  3102,  3121,  3141,  3161,  3180,  3200,  3220,  3240,  3260,
+    3281,  3301,  3322,  3342,  3363,  3384,  3405,  3426,  3448,  3469,  3491,
+    3512,  3534,  3556,  3578,  3601,  3623,  3645,  3668,  3691,  3714,  3737,
+    3760,  3784,  3807,  3831,  3854,  3878,  3903,  3927,  3951,  3976,  4000,
+    4025,  4050,  4075,  4101,  4126,  4152,  4177,  4203,  4229,  4256,  4282,
+    4309,  4335,  4362,  4389,  4416,  4444,  4471,  4499,  4527,  4555,  4583,
+    4612,  4640,  4669,  4698,  4727,  4756,  4786,  4815,  4845,  4875,  4905,
+    4936,  4966,  4997,  5028,  5059,  5090,  5122,  5153,  5185,  5217,  5250,
+    5282,  5315,  5348,  5381,  5414,  5447,  5481,  5515,  5549,  5583,  5618,
+    5653,  5687,  5723,  5758,  5794,  5829,  5865,  5902,  5938,  5975,  6012,
+    6049,  6086,  6124,  6161,  6199,  6238,  6276,  6315,  6354,  6393,  6433,
+    6472,  6512,  6552,  6593,  6633,  6674,  6716,  6757,  6799,  6841,  6883,
+    6925,  6968,  7011,  7054,  7098,  7141,  7185,  7230,  7274,  7319,  7364,
+    7409,  7455,  7501,  7547,  7594,  7641,  7688,  7735,  7783,  7831,  7879,
+    7927,  7976,  8025,  8075,  8124,  8174,  8225,  8275,  8326,  8378,  8429,
+    8481,  8533,  8586,  8639,  8692,  8745,  8799,  8853,  8908,  8963,  9018,
+    9073,  9129,  9185,  9242,  9299,  9356,  9413,  9471,  9529,  9588,  9647,
+    9706,  9766,  9826,  9887,  9947,  10008, 10070, 10132, 10194, 10257, 10320,
+    10383, 10447, 10511, 10576, 10641, 10706, 10772, 10838, 10905, 10972, 11039,
+    11107, 11176, 11244, 11313, 11383, 11453, 11523, 11594, 11665, 11737, 11809,
+    11881, 11954, 12028, 12102, 12176, 12251, 12326, 12402, 12478, 12554, 12632,
+    12709, 12787, 12866, 12945, 13024, 13104, 13184, 13265, 13347, 13429, 13511,
+    13594, 13678, 13762, 13846, 13931, 14016, 14102, 14189, 14276, 14364, 14452,
+    14541, 14630, 14720, 14810, 14901, 14992, 15084, 15177, 15270, 15363, 15458,
+    15552, 15648, 15744, 15840, 15938, 16035, 16134, 16233, 16332, 16432, 16533,
+    16635, 16737, 16839, 16942, 17046, 17151, 17256, 17362, 17468, 17575, 17683,
+    17792, 17901, 18010, 18121, 18232, 18344, 18456, 18569, 18683, 18798, 18913,
+    19029, 19145, 19263, 19381, 19500, 19619, 19739, 19860, 19982, 20105, 20228,
+    20352, 20477, 20602, 20728, 20855, 20983, 21112, 21241, 21371, 21502, 21634,
+    21766, 21900, 22034, 22169, 22305, 22441, 22579, 22717, 22856, 22996, 23137,
+    23279, 23422, 23565, 23709, 23855, 24001, 24148, 24296, 24445, 24594, 24745,
+    24896, 25049, 25202, 25357, 25512, 25668, 25825, 25984, 26143, 26303, 26464,
+    26626, 26789, 26953, 27118, 27284, 27451, 27619, 27788, 27959, 28130, 28302,
+    28475, 28650, 28825, 29001, 29179, 29358, 29537, 29718, 29900, 30083, 30267,
+    30453, 30639, 30827, 31015, 31205, 31396, 31588, 31782, 31976, 32172, 32369,
+    32567, 32767,
 };
 #endif
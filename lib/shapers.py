@@ -4,7 +4,7 @@ import numpy as np
 
 def compress_curve(mu):
     y = []
-    for i in range(int(math.pow(2, resolution))):
+    for i in range(int(math.pow(2, resolution)) + 1):
         x = float(i) / math.pow(2, resolution)
         y.append(np.sign(x) * math.log(1 + mu * abs(x)) / math.log(1 + mu))
     return np.multiply(y, math.pow(2, 15) - 1)
@@ -12,13 +12,16 @@ def compress_curve(mu):
 
 def expand_curve(mu):
     y = []
-    for i in range(int(math.pow(2, resolution))):
+    for i in range(int(math.pow(2, resolution)) + 1):
         x = float(i) / math.pow(2, resolution)
         y.append(np.sign(x) * (math.pow(1 + mu, abs(x)) - 1) / mu)
     return np.multiply(y, math.pow(2, 15) - 1)
 
 
-resolution = 15
+# the curves are sampled at 2^resolution + 1 points and linearly interpolated
+# (see shaper.h) so they fit in SRAM rather than being read through the XIP
+# cache at random per sample
+resolution = 10
 mu = 255 * 2
 cc = compress_curve(mu)
 ce = expand_curve(mu)
@@ -36,12 +39,12 @@ print("#ifndef LIB_SHAPER")
 print("#define LIB_SHAPER 1")
 print("#define SHAPER_RESOLUTION " + str(resolution))
 print("#define SHAPER_REDUCE " + str(15 - resolution))
-print(f"const int16_t __in_flash() compress_curve_data[{len(cc)}] = {{")
+print(f"int16_t compress_curve_data[{len(cc)}] = {{")
 for v in cc:
     print(f"\t{int(v)},")
 print("};")
 
-print(f"const int16_t __in_flash() expand_curve_data[{len(ce)}] = {{")
+print(f"int16_t expand_curve_data[{len(ce)}] = {{")
 for v in ce:
     print(f"\t{int(v)},")
 print("};")
@@ -0,0 +1,98 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_SMOOTH_H_
+#define LIB_SMOOTH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Smooth glides a parameter to its target, so an fx does not jump when a
+// knob moves. the target can be written at any time from either core. once
+// a block the audio core calls Smooth_beginBlock, which closes 1/2^shift of
+// the distance left (all of it with shift 0) and works out the step, and
+// the fx then adds the step on every sample of the block.
+//
+// values are in the units of the parameter, which should have enough
+// fraction bits that a block's distance is many steps; anything closer than
+// a step a sample is jumped.
+
+typedef struct Smooth {
+  volatile int32_t target;
+  // at the start of the block, the step a sample and at the end of it
+  int32_t value;
+  int32_t step;
+  int32_t end;
+  uint8_t shift;
+} Smooth;
+
+// at value and not moving
+void Smooth_init(Smooth *self, int32_t value, uint8_t shift) {
+  self->target = value;
+  self->value = value;
+  self->step = 0;
+  self->end = value;
+  self->shift = shift;
+}
+
+static inline void Smooth_set(Smooth *self, int32_t target) {
+  self->target = target;
+}
+
+// straight to value, from the audio core
+void Smooth_jump(Smooth *self, int32_t value) {
+  self->target = value;
+  self->value = value;
+  self->step = 0;
+  self->end = value;
+}
+
+// moves on to the next block of n samples
+void Smooth_beginBlock(Smooth *self, uint16_t n) {
+  int32_t target = self->target;
+  self->value = self->end;
+  if (n == 0) {
+    self->step = 0;
+    return;
+  }
+  int32_t distance = target - self->value;
+  int32_t step = distance / (1 << self->shift) / n;
+  if (step == 0) {
+    step = distance / n;
+  }
+  if (step == 0) {
+    self->value = target;
+  }
+  self->step = step;
+  self->end = self->value + step * n;
+}
+
+// the value i samples into the block
+static inline int32_t Smooth_at(Smooth *self, uint16_t i) {
+  return self->value + self->step * i;
+}
+
+static inline bool Smooth_moving(Smooth *self) { return self->step != 0; }
+
+#endif
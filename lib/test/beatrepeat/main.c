@@ -119,10 +119,16 @@ int main() {
   fclose(file);
 
   /* process the audio here*/
-  BeatRepeat *br = BeatRepeat_malloc();
+  FxPool *pool = FxPool_malloc(FXPOOL_SIZE);
+  BeatRepeat *br = BeatRepeat_malloc(pool);
+  BeatRepeat_setActive(br, true);
   for (int i = 0; i < num_samples; i += 1000) {
-    int16_t audio_block[1000];
-    memcpy(audio_block, audio_data + i, 1000 * sizeof(int16_t));
+    // the beat repeat works on the stereo output
+    int32_t audio_block[2000];
+    for (int j = 0; j < 1000; j++) {
+      audio_block[j * 2 + 0] = audio_data[i + j] << 16;
+      audio_block[j * 2 + 1] = audio_data[i + j] << 16;
+    }
     if (i == 20000) {
       BeatRepeat_repeat(br, 15000);
     }
@@ -130,12 +136,14 @@ int main() {
       BeatRepeat_repeat(br, 0);
     }
     if (i == 60000) {
+      BeatRepeat_setDecay(br, 64);
       BeatRepeat_repeat(br, 5000);
     }
     if (i == 80000) {
       BeatRepeat_repeat(br, 0);
     }
     if (i == 81000) {
+      BeatRepeat_setDecay(br, 0);
       BeatRepeat_repeat(br, 1000);
     }
     if (i == 108000) {
@@ -148,9 +156,12 @@ int main() {
       BeatRepeat_repeat(br, 0);
     }
     BeatRepeat_process(br, audio_block, 1000);
-    memcpy(audio_data + i, audio_block, 1000 * sizeof(int16_t));
+    for (int j = 0; j < 1000; j++) {
+      audio_data[i + j] = audio_block[j * 2 + 0] >> 16;
+    }
   }
   BeatRepeat_free(br);
+  FxPool_free(pool);
 
   /* end processing the audio here */
 
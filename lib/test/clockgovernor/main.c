@@ -0,0 +1,113 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// policy checks for the clock governor. the callback cost is modelled as a
+// fixed number of cycles per block, so the time it takes follows the clock
+// the governor picked.
+//
+// gcc -O2 -o main main.c -lm && ./main
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../clockgovernor.h"
+
+#define BLOCK_US 10000
+#define BLOCKS_PER_SECOND 100
+
+ClockGovernor *governor;
+int changes = 0;
+
+// runs blocks costing cycles each, returns the busy time of the last one
+void run(int blocks, uint32_t cycles, bool idle) {
+  for (int i = 0; i < blocks; i++) {
+    uint32_t busy_us =
+        (uint64_t)cycles * 1000 / clockgovernor_khz[governor->step];
+    if (ClockGovernor_update(governor, busy_us, idle)) {
+      changes++;
+      governor->step_last = governor->step;
+    }
+  }
+}
+
+int expect(const char *what, uint32_t khz) {
+  if (ClockGovernor_khz(governor) != khz) {
+    printf("%s: at %d khz, expected %d khz\n", what,
+           ClockGovernor_khz(governor), khz);
+    return 1;
+  }
+  printf("%-36s %6d khz\n", what, khz);
+  return 0;
+}
+
+int main() {
+  // 6 ms and 3.4 ms of a block at 250 MHz, and the idle fast path
+  uint32_t heavy = 1500000;
+  uint32_t light = 850000;
+  uint32_t idle = 20000;
+  int fail = 0;
+
+  governor = ClockGovernor_malloc(BLOCK_US, 60, BLOCKS_PER_SECOND, 250000);
+  fail += expect("boot", 250000);
+  run(BLOCKS_PER_SECOND / 2, idle, true);
+  fail += expect("idle under the calm time", 250000);
+  run(BLOCKS_PER_SECOND, idle, true);
+  fail += expect("idle for a while", 125000);
+  run(1, heavy, false);
+  fail += expect("first heavy block", 250000);
+  run(BLOCKS_PER_SECOND * 5, heavy, false);
+  fail += expect("heavy playback", 250000);
+  run(BLOCKS_PER_SECOND * 5, light, false);
+  fail += expect("light playback does not drop", 250000);
+  run(BLOCKS_PER_SECOND * 2, idle, true);
+  run(1, light, false);
+  fail += expect("light playback after idle", 187500);
+  run(BLOCKS_PER_SECOND * 5, light, false);
+  fail += expect("light playback", 187500);
+  run(1, light * 3, false);
+  fail += expect("overrun", 250000);
+
+  // a gate chopping playback every 100 ms never rests long enough to drop
+  changes = 0;
+  for (int i = 0; i < 50; i++) {
+    run(5, heavy, false);
+    run(5, idle, true);
+  }
+  fail += expect("gated playback", 250000);
+  if (changes != 0) {
+    printf("gated playback changed the clock %d times\n", changes);
+    fail++;
+  }
+
+  // without overclocking the clock stays at 125 MHz
+  ClockGovernor_free(governor);
+  governor = ClockGovernor_malloc(BLOCK_US, 60, BLOCKS_PER_SECOND, 125000);
+  run(BLOCKS_PER_SECOND, heavy, false);
+  fail += expect("no overclock", 125000);
+  ClockGovernor_free(governor);
+
+  printf(fail ? "FAIL\n" : "PASS\n");
+  return fail;
+}
@@ -0,0 +1,144 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// checks ordering, overflow counting, the sample offsets and latency stats of
+// the core0 -> audio core command queue with a fake clock.
+//
+// gcc -O2 -o main main.c -lm && ./main
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+uint32_t now_us = 0;
+uint32_t core = 0;
+static inline uint32_t time_us_32(void) { return now_us; }
+static inline uint32_t get_core_num(void) { return core; }
+static inline uint32_t save_and_disable_interrupts(void) { return 0; }
+static inline void restore_interrupts(uint32_t s) {}
+#define __dmb()
+
+#include "../../commandqueue.h"
+#include "../check.h"
+
+#define BLOCK_US 10000
+#define BLOCK_SAMPLES 441
+
+Command applied;
+uint16_t applied_count = 0;
+
+void apply(Command *c) {
+  applied = *c;
+  applied_count++;
+}
+
+int main() {
+  CommandQueue *q = CommandQueue_malloc(apply);
+  Command c;
+
+  // pushes spread over one block come out in order, at the same relative
+  // place in the next block
+  now_us = 1000000;
+  CommandQueue_push(q, COMMAND_JUMP, 0, 0, 1234);
+  now_us += 2500;
+  CommandQueue_push(q, COMMAND_SAMPLE, 3, 7, 0);
+  now_us += 5000;
+  CommandQueue_push(q, COMMAND_FX_TOGGLE, 5, 0, 0);
+  now_us = 1000000 + BLOCK_US;
+  CommandQueue_beginBlock(q, now_us);
+  check_int("pop jump", CommandQueue_pop(q, &c, BLOCK_US, BLOCK_SAMPLES),
+            true);
+  check_int("jump type", c.type, COMMAND_JUMP);
+  check_int("jump value", c.value, 1234);
+  check_int("jump offset", c.offset, 0);
+  check_int("pop sample", CommandQueue_pop(q, &c, BLOCK_US, BLOCK_SAMPLES),
+            true);
+  check_int("sample bank", c.a, 3);
+  check_int("sample sample", c.b, 7);
+  check_int("sample offset", c.offset, 110);
+  check_int("pop fx", CommandQueue_pop(q, &c, BLOCK_US, BLOCK_SAMPLES),
+            true);
+  check_int("fx offset", c.offset, 330);
+  check_int("empty", CommandQueue_pop(q, &c, BLOCK_US, BLOCK_SAMPLES), false);
+  check_int("count", q->count, 3);
+  check_int("latency max", q->latency_max, BLOCK_US);
+  check_int("latency avg", (int32_t)(q->latency_sum / q->count), 6666);
+  check_int("depth", q->depth_max, 3);
+
+  // a command pushed right before the block lands at its end
+  now_us += BLOCK_US - 10;
+  CommandQueue_push(q, COMMAND_RETRIG, 48, 0, 1 << 15);
+  now_us += 10;
+  CommandQueue_beginBlock(q, now_us);
+  CommandQueue_pop(q, &c, BLOCK_US, BLOCK_SAMPLES);
+  check_int("late offset", c.offset, 440);
+  check_int("retrig volume", c.value, 1 << 15);
+
+  // a full queue drops and counts, and keeps the oldest commands
+  for (uint16_t i = 0; i < COMMANDQUEUE_SIZE + 3; i++) {
+    CommandQueue_push(q, COMMAND_JUMP, 0, 0, i);
+  }
+  check_int("dropped", q->dropped, 3);
+  CommandQueue_beginBlock(q, now_us);
+  for (uint16_t i = 0; i < COMMANDQUEUE_SIZE; i++) {
+    CommandQueue_pop(q, &c, BLOCK_US, BLOCK_SAMPLES);
+    check_int("kept in order", c.value, i);
+  }
+  check_int("drained", CommandQueue_pop(q, &c, BLOCK_US, BLOCK_SAMPLES), false);
+  check_int("depth max", q->depth_max, COMMANDQUEUE_SIZE);
+
+  // the indices wrap around 16 bits
+  q->write = q->read = 0xFFF0;
+  for (uint16_t i = 0; i < 40; i++) {
+    CommandQueue_push(q, COMMAND_JUMP, 0, 0, i);
+    CommandQueue_pop(q, &c, BLOCK_US, BLOCK_SAMPLES);
+    check_int("wrap", c.value, i);
+  }
+
+  // sends from the audio core apply right away, at the offset of the beat
+  // clock while it runs, sends from core0 at the same time still queue
+  q->write = q->read = 0;
+  core = 1;
+  CommandQueue_direct(q, 123);
+  CommandQueue_send(q, COMMAND_JUMP, 0, 0, 777);
+  check_int("applied", applied_count, 1);
+  check_int("applied value", applied.value, 777);
+  check_int("applied offset", applied.offset, 123);
+  core = 0;
+  CommandQueue_send(q, COMMAND_JUMP, 0, 0, 888);
+  check_int("core0 not applied", applied_count, 1);
+  check_int("core0 queued", (uint16_t)(q->write - q->read), 1);
+  core = 1;
+  CommandQueue_endDirect(q);
+  CommandQueue_send(q, COMMAND_JUMP, 0, 0, 999);
+  check_int("applied after end", applied_count, 2);
+  check_int("applied after end offset", applied.offset, 0);
+  check_int("nothing queued after end", (uint16_t)(q->write - q->read), 1);
+
+  CommandQueue_printStats(q);
+  CommandQueue_free(q);
+  return check_done();
+}
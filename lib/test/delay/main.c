@@ -31,31 +31,36 @@
 #include "../../sinewave.h"
 
 int main() {
-  init_sinewaves();
   SinOsc *osc1 = SinOsc_malloc();
   SinOsc *osc2 = SinOsc_malloc();
   SinOsc_wave(osc1, 24);
   SinOsc_quiet(osc1, 0);
   SinOsc_wave(osc2, 29);
   SinOsc_quiet(osc2, 1);
-  Delay *dly = Delay_malloc();
+  FxPool *pool = FxPool_malloc(FXPOOL_SIZE);
+  Delay *dly = Delay_malloc(pool);
   Delay_setDuration(dly, 1000);
+  Delay_setFeedback(dly, 1);
   Delay_setActive(dly, true);
-  int32_t vals[8000];
+  int32_t vals[8000 * 2];
   for (int i = 0; i < 8000; i++) {
     if (i < 500) {
-      vals[i] = (SinOsc_next(osc1) >> 17) + (SinOsc_next(osc2) >> 17);
+      vals[i * 2 + 0] = (SinOsc_next(osc1) >> 1) + (SinOsc_next(osc2) >> 1);
     } else {
-      vals[i] = 0;
+      vals[i * 2 + 0] = 0;
     }
+    vals[i * 2 + 1] = vals[i * 2 + 0];
+  }
+  for (int i = 0; i < 8000; i += 400) {
+    Delay_process(dly, vals + i * 2, 400);
   }
-  Delay_process(dly, vals, 8000);
   for (int i = 0; i < 8000; i++) {
-    printf("%d\n", vals[i]);
+    printf("%d %d\n", vals[i * 2 + 0], vals[i * 2 + 1]);
   }
 
   SinOsc_free(osc1);
   SinOsc_free(osc2);
   Delay_free(dly);
+  FxPool_free(pool);
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,216 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// checks the table envelopes against the curves they replace: the cosine
+// against Envelope2 and the linear one against EnvelopeLinearInteger, then
+// the exponential, the segments and the per sample gain.
+//
+// gcc -O2 -o main main.c -lm && ./main
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../envelope2.h"
+#include "../../envelope_linear_integer.h"
+#include "../../envelopetable.h"
+#include "../check.h"
+
+#define BLOCKS_PER_SECOND 100
+
+// the largest difference from Envelope2 over a ramp and past its end, as a
+// fraction of the range
+float cosine_error(float start, float stop, float duration) {
+  Envelope2 *want = Envelope2_create(BLOCKS_PER_SECOND, start, stop, duration);
+  EnvelopeTable *got = EnvelopeTable_create(BLOCKS_PER_SECOND, start, stop,
+                                            duration, ENVELOPE_COSINE);
+  float error = 0;
+  for (int i = 0; i < BLOCKS_PER_SECOND * duration + 10; i++) {
+    float w = Envelope2_update(want);
+    float g = q16_16_fp_to_float(EnvelopeTable_advance(got, 1));
+    float e = fabsf(w - g) / fabsf(stop - start);
+    if (e > error) {
+      error = e;
+    }
+  }
+  Envelope2_destroy(want);
+  EnvelopeTable_destroy(got);
+  return error;
+}
+
+void test_cosine() {
+  // the pitch and volume ramps the firmware uses
+  check("cosine up", cosine_error(0.5, 1.0, 1.5) < 0.001);
+  check("cosine down", cosine_error(1.0, 0.005, 2.7) < 0.001);
+  check("cosine volume", cosine_error(0, 1, 1.618 / 2) < 0.001);
+  check("cosine wide", cosine_error(3, 20, 2) < 0.001);
+  check("cosine short", cosine_error(1, 2, 0.03) < 0.001);
+}
+
+// the filter envelope, compared on the whole index
+void test_linear() {
+  int32_t starts[] = {1, 80, 5};
+  int32_t stops[] = {80, 5, 80};
+  float durations[] = {0.3, 1.618, 1.618};
+  for (int c = 0; c < 3; c++) {
+    EnvelopeLinearInteger *want = EnvelopeLinearInteger_create(
+        BLOCKS_PER_SECOND, starts[c], stops[c], durations[c]);
+    EnvelopeTable *got =
+        EnvelopeTable_create(BLOCKS_PER_SECOND, starts[c], stops[c],
+                             durations[c], ENVELOPE_LINEAR);
+    int span = abs(stops[c] - starts[c]);
+    float steps = roundf(BLOCKS_PER_SECOND * durations[c]);
+    int error = 0;
+    float line_error = 0;
+    for (int i = 0; i < BLOCKS_PER_SECOND * 3; i++) {
+      int32_t w = EnvelopeLinearInteger_update(want, NULL);
+      int32_t g = EnvelopeTable_advance(got, 1);
+      if (abs(w - (g >> 16)) > error) {
+        error = abs(w - (g >> 16));
+      }
+      float x = i + 1 < steps ? (i + 1) / steps : 1;
+      float line = starts[c] + (stops[c] - starts[c]) * x;
+      if (fabsf(q16_16_fp_to_float(g) - line) > line_error) {
+        line_error = fabsf(q16_16_fp_to_float(g) - line);
+      }
+      if (i == BLOCKS_PER_SECOND * 3 - 1) {
+        check("linear ends", g >> 16 == stops[c] && w == stops[c]);
+      }
+    }
+    check("linear on the line", line_error < 0.01);
+    // the integer envelope takes a whole number of blocks (at least one)
+    // for each index, so it runs ahead or behind by that rounding
+    int inc_t = round(steps / span);
+    float drift = fabsf((inc_t < 1 ? 1 : inc_t) * span - steps) / steps;
+    check("linear parity", error <= span * drift + 1);
+    free(want);
+    EnvelopeTable_destroy(got);
+  }
+}
+
+void test_exponential() {
+  EnvelopeTable *env =
+      EnvelopeTable_create(1000, 0, 1, 1, ENVELOPE_EXPONENTIAL);
+  int32_t last = 0;
+  bool rising = true;
+  int32_t quarter = 0;
+  for (int i = 1; i <= 1000; i++) {
+    int32_t v = EnvelopeTable_advance(env, 1);
+    rising = rising && v >= last;
+    last = v;
+    if (i == 250) {
+      quarter = v;
+    }
+  }
+  check("exponential rises", rising);
+  check("exponential ends", last == Q16_16_1 && EnvelopeTable_done(env));
+  // 1 - e^-1.25 of the way, scaled by 1 / (1 - e^-5)
+  float want = (1 - expf(-1.25f)) / (1 - expf(-5));
+  check("exponential quarter",
+        fabsf(q16_16_fp_to_float(quarter) - want) < 0.001);
+  EnvelopeTable_destroy(env);
+}
+
+// an attack, a decay and a release, each ending where the next starts
+void test_stages() {
+  EnvelopeTable *env = EnvelopeTable_create(1000, 0, 1, 0.01, ENVELOPE_LINEAR);
+  check("add decay", EnvelopeTable_add(env, 0.5, 0.1, ENVELOPE_EXPONENTIAL));
+  check("add hold", EnvelopeTable_add(env, 0.5, 0.05, ENVELOPE_LINEAR));
+  check("add release", EnvelopeTable_add(env, 0, 0.2, ENVELOPE_COSINE));
+  check("stages full", !EnvelopeTable_add(env, 1, 1, ENVELOPE_LINEAR));
+  int32_t v[400];
+  for (int i = 0; i < 400; i++) {
+    v[i] = EnvelopeTable_advance(env, 1);
+  }
+  check("attack peak", v[9] == Q16_16_1);
+  check("decay to sustain", v[109] == Q16_16_0_5);
+  check("hold", v[130] == Q16_16_0_5 && v[159] == Q16_16_0_5);
+  check("release", v[200] < Q16_16_0_5 && v[200] > 0);
+  check("end", v[359] == 0 && v[399] == 0 && EnvelopeTable_done(env));
+  int32_t step_max = 0;
+  for (int i = 1; i < 400; i++) {
+    if (abs(v[i] - v[i - 1]) > step_max) {
+      step_max = abs(v[i] - v[i - 1]);
+    }
+  }
+  // the steepest is the attack, a tenth of the range a step
+  check("no jumps", step_max <= Q16_16_1 / 10 + 1);
+
+  // once done, adding starts from where it ended
+  EnvelopeTable_add(env, 1, 0.01, ENVELOPE_LINEAR);
+  check("restart", abs(EnvelopeTable_advance(env, 1) - Q16_16_1 / 10) < 8);
+  EnvelopeTable_destroy(env);
+}
+
+// the per sample gain follows the same curve as advancing a step at a time,
+// and passes the samples untouched once it rests at 1
+void test_process() {
+  EnvelopeTable *gain =
+      EnvelopeTable_create(44100, 0, 1, 0.02, ENVELOPE_COSINE);
+  EnvelopeTable *ref = EnvelopeTable_create(44100, 0, 1, 0.02, ENVELOPE_COSINE);
+  int32_t samples[441 * 2];
+  bool same = true;
+  for (int b = 0; b < 4; b++) {
+    for (int i = 0; i < 441 * 2; i++) {
+      samples[i] = 1 << 30;
+    }
+    EnvelopeTable_process(gain, samples, 441);
+    for (int i = 0; i < 441; i++) {
+      int32_t g = EnvelopeTable_advance(ref, 1);
+      same = same && samples[i * 2] == (1 << 14) * g &&
+             samples[i * 2 + 1] == samples[i * 2];
+    }
+  }
+  check("process follows the curve", same);
+  check("process rests", EnvelopeTable_done(gain));
+  for (int i = 0; i < 441 * 2; i++) {
+    samples[i] = 12345;
+  }
+  EnvelopeTable_process(gain, samples, 441);
+  check("process at 1 passes", samples[0] == 12345 && samples[881] == 12345);
+
+  // resting below 1 keeps the gain
+  EnvelopeTable_goto(gain, 0.5, 0.001, ENVELOPE_LINEAR);
+  for (int b = 0; b < 2; b++) {
+    for (int i = 0; i < 441 * 2; i++) {
+      samples[i] = 1 << 30;
+    }
+    EnvelopeTable_process(gain, samples, 441);
+  }
+  check("process rests at half",
+        samples[0] == 1 << 29 && samples[881] == 1 << 29);
+  EnvelopeTable_destroy(gain);
+  EnvelopeTable_destroy(ref);
+}
+
+int main() {
+  test_cosine();
+  test_linear();
+  test_exponential();
+  test_stages();
+  test_process();
+  return check_done();
+}
@@ -0,0 +1,146 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// drives the flight recorder with fake blocks, checks that it freezes after
+// an overrun and that the dump comes out oldest first around the trigger.
+// the dump goes to flight00.bin in a temporary directory, the same format
+// dev/flightrecorder.py decodes, and is removed once it is read back.
+//
+// gcc -O2 -o main main.c -lm && ./main
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// just enough of FatFs and the sdk to write to a host file
+typedef FILE *FIL;
+typedef int FRESULT;
+#define FR_OK 0
+#define FA_WRITE 0
+#define FA_CREATE_ALWAYS 0
+char dump_dir[] = "/tmp/flightrecorderXXXXXX";
+char dump_path[64];
+FRESULT f_open(FIL *fp, const char *path, int mode) {
+  snprintf(dump_path, sizeof(dump_path), "%s%s", dump_dir, path);
+  *fp = fopen(dump_path, "wb");
+  return *fp == NULL;
+}
+FRESULT f_write(FIL *fp, const void *buff, unsigned int btw,
+                unsigned int *bw) {
+  *bw = fwrite(buff, 1, btw, *fp);
+  return *bw != btw;
+}
+FRESULT f_close(FIL *fp) { return fclose(*fp); }
+const char *FRESULT_str(FRESULT fr) { return "error"; }
+void sleep_us(uint32_t us) {}
+#define __dmb()
+#define SAMPLES_PER_BUFFER 441
+#define SAMPLE_RATE 44100
+#define US_PER_BLOCK 1000000 * SAMPLES_PER_BUFFER / SAMPLE_RATE
+
+#include "../../flightrecorder.h"
+#include "../check.h"
+
+void run_block(FlightRecorder *fr, uint16_t total_us) {
+  FlightRecord *r = FlightRecorder_next(fr);
+  if (r == NULL) {
+    return;
+  }
+  memset(r, 0, sizeof(FlightRecord));
+  r->block = fr->block;
+  r->total_us = total_us;
+  r->phase = fr->block * 1764;
+  r->flags = FLIGHTRECORD_FILE_OPEN;
+  FlightRecorder_commit(fr, US_PER_BLOCK);
+}
+
+int main() {
+  if (mkdtemp(dump_dir) == NULL) {
+    printf("FAIL no temporary directory\n");
+    return 1;
+  }
+  check_int("record size", sizeof(FlightRecord), 52);
+  check_int("header size", sizeof(FlightRecorderHeader), 16);
+
+  FlightRecorder *fr = FlightRecorder_malloc();
+  bool sync = false;
+  check_int("nothing to write", FlightRecorder_write(fr, &sync), false);
+
+  // wrap the ring a few times, then overrun on block 200
+  for (uint32_t i = 0; i < 200; i++) {
+    run_block(fr, 5000);
+  }
+  check_int("not frozen", fr->frozen, false);
+  run_block(fr, 12000);
+  for (uint32_t i = 0; i < FLIGHTRECORDER_POST - 1; i++) {
+    run_block(fr, 6000);
+    check_int("still recording", fr->frozen, false);
+  }
+  // a second overrun inside the window does not move the trigger
+  run_block(fr, 11000);
+  check_int("frozen", fr->frozen, true);
+  // blocks while frozen are dropped
+  run_block(fr, 20000);
+  check_int("blocks while frozen", fr->block, 201 + FLIGHTRECORDER_POST);
+
+  check_int("written", FlightRecorder_write(fr, &sync), true);
+  check_int("sync released", sync, false);
+  check_int("unfrozen", fr->frozen, false);
+  check_int("next file", fr->file_index, 1);
+
+  check_str("dump name", strrchr(dump_path, '/'), "/flight00.bin");
+  FILE *f = fopen(dump_path, "rb");
+  FlightRecorderHeader header;
+  FlightRecord records[FLIGHTRECORDER_RECORDS];
+  fread(&header, sizeof(header), 1, f);
+  check_int("read back",
+            fread(records, sizeof(FlightRecord), FLIGHTRECORDER_RECORDS, f),
+            FLIGHTRECORDER_RECORDS);
+  fclose(f);
+  remove(dump_path);
+  rmdir(dump_dir);
+  check_int("magic", header.magic, FLIGHTRECORDER_MAGIC);
+  check_int("trigger position", header.trigger,
+            FLIGHTRECORDER_RECORDS - 1 - FLIGHTRECORDER_POST);
+  check_int("trigger block", records[header.trigger].block, 200);
+  check_int("trigger flagged",
+            records[header.trigger].flags & FLIGHTRECORD_OVERRUN,
+            FLIGHTRECORD_OVERRUN);
+  check_int("oldest", records[0].block, 201 + FLIGHTRECORDER_POST - 64);
+  for (uint16_t i = 1; i < FLIGHTRECORDER_RECORDS; i++) {
+    check_int("in order", records[i].block, records[i - 1].block + 1);
+  }
+  check_int("last overrun flagged",
+            records[FLIGHTRECORDER_RECORDS - 1].flags & FLIGHTRECORD_OVERRUN,
+            FLIGHTRECORD_OVERRUN);
+
+  // recording picks up again after the write
+  run_block(fr, 5000);
+  check_int("recording again", fr->block, 202 + FLIGHTRECORDER_POST);
+
+  FlightRecorder_free(fr);
+  return check_done();
+}
@@ -0,0 +1,121 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// checks the fx pool: full and degraded grants, rejection, shrinking, reuse
+// of freed gaps, and that the delay and beat repeat take their buffers on activation
+// and give them back once faded out.
+// needs lib/crossfade3.h (make lib/crossfade3.h in the root)
+//
+// gcc -O2 -o main main.c -lm && ./main
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../beatrepeat.h"
+#include "../../delay.h"
+#include "../check.h"
+
+int main() {
+  FxPool *pool = FxPool_malloc(1000);
+  uint32_t granted = 0;
+  uint8_t *a = FxPool_alloc(pool, 400, 400, &granted);
+  check_int("a granted", granted, 400);
+  uint8_t *b = FxPool_alloc(pool, 401, 100, &granted);
+  check_int("b aligned", granted, 404);
+  check_int("b after a", b - a, 400);
+  // 196 left
+  uint8_t *c = FxPool_alloc(pool, 300, 100, &granted);
+  check_int("c degraded", granted, 196);
+  check_int("degraded count", pool->degraded, 1);
+  check_int("d rejected", FxPool_alloc(pool, 300, 100, &granted) == NULL, 1);
+  check_int("rejected count", pool->rejected, 1);
+  // freeing a leaves a gap in front that is reused
+  FxPool_release(pool, a);
+  check_int("used after release", pool->used, 600);
+  uint8_t *d = FxPool_alloc(pool, 300, 300, &granted);
+  check_int("d in the gap", d == a, 1);
+  // the end of d goes back to the gap
+  FxPool_shrink(pool, d, 101);
+  check_int("used after shrink", pool->used, 704);
+  FxPool_release(pool, b);
+  FxPool_release(pool, c);
+  FxPool_release(pool, d);
+  check_int("empty", pool->used + pool->num_blocks, 0);
+  check_int("used max", pool->used_max, 1000);
+  FxPool_free(pool);
+
+  // the effects only hold memory while on, and shrink to fit. the pool holds
+  // the delay at full size alone, or at half next to the repeat
+  pool = FxPool_malloc(BEATREPEAT_RINGBUFFER_SIZE * 4 + DELAY_LINE_SIZE * 2 +
+                       100);
+  Delay *delay = Delay_malloc(pool);
+  BeatRepeat *br = BeatRepeat_malloc(pool);
+  check_int("registered", pool->num_effects, 2);
+  check_int("nothing held", pool->used, 0);
+  check_int("beat repeat on", BeatRepeat_setActive(br, true), true);
+  check_int("beat repeat size", br->ringbuffer_size,
+            BEATREPEAT_RINGBUFFER_SIZE);
+  check_int("delay on", Delay_setActive(delay, true), true);
+  check_int("delay degraded", delay->line_size,
+            (DELAY_LINE_SIZE * 2 + 100) / 4);
+  check_int("delay right line",
+            delay->right_line - delay->delay_ringbuffer, delay->line_size);
+  // one request, degraded by the pool, split into two lines
+  check_int("delay degraded count", pool->degraded, 1);
+  check_int("delay rejected count", pool->rejected, 0);
+  check_int("delay shrunk", pool->used,
+            BEATREPEAT_RINGBUFFER_SIZE * 4 + delay->line_size * 4);
+
+  int32_t block[441 * 2];
+  for (int i = 0; i < 441 * 2; i++) {
+    block[i] = (i % 40 - 20) << 24;
+  }
+  BeatRepeat_repeat(br, 200);
+  for (int i = 0; i < 4; i++) {
+    Delay_process(delay, block, 441);
+    BeatRepeat_process(br, block, 441);
+  }
+  check_int("repeating", br->repeating, true);
+  // a repeat holds its capture until the fade is done
+  BeatRepeat_setActive(br, false);
+  check_int("beat repeat fading", br->ringbuffer != NULL, 1);
+  BeatRepeat_process(br, block, 441);
+  check_int("beat repeat released", br->ringbuffer == NULL, 1);
+  Delay_setActive(delay, false);
+  check_int("delay fading", delay->delay_ringbuffer != NULL, 1);
+  Delay_process(delay, block, 441);
+  check_int("delay released", delay->delay_ringbuffer == NULL, 1);
+  check_int("pool empty", pool->used, 0);
+  // with the pool free the delay gets its full ring again
+  Delay_setActive(delay, true);
+  check_int("delay full", delay->line_size, DELAY_LINE_SIZE);
+  Delay_free(delay);
+  BeatRepeat_free(br);
+  check_int("freed", pool->used, 0);
+  FxPool_report(pool);
+  FxPool_free(pool);
+
+  return check_done();
+}
@@ -0,0 +1,150 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// load harness for the quality governor. each level takes away some of the
+// callback cost, the load jumps up for a while (a busy passage) and drops
+// back, and the overload counting mirrors the audio callback: three blocks
+// over 150% within a second sheds a level, and only when nothing is left
+// does it mute.
+//
+// gcc -O2 -o main main.c -lm && ./main
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../governor.h"
+
+#define BLOCKS_PER_SECOND 100
+#define THRESHOLD 150
+#define FLAG_LIMIT 3
+
+// percent of the block each level saves
+const int savings[GOVERNOR_LEVELS] = {0, 25, 40, 45, 55, 70};
+
+int main() {
+  Governor *governor = Governor_malloc(80, BLOCKS_PER_SECOND * 2);
+
+  // the ladder and its ends
+  for (int i = 0; i < GOVERNOR_LEVELS - 1; i++) {
+    if (!Governor_shed(governor)) {
+      printf("could not shed level %d\n", i);
+      return 1;
+    }
+  }
+  if (Governor_shed(governor)) {
+    printf("shed past the last level\n");
+    return 1;
+  }
+  // a lone slow block does not restart the calm count
+  for (int i = 0; i < BLOCKS_PER_SECOND; i++) {
+    Governor_update(governor, 50);
+  }
+  Governor_update(governor, 150);
+  int restored_at = 0;
+  for (int i = 0; i < BLOCKS_PER_SECOND * 2 && restored_at == 0; i++) {
+    if (Governor_update(governor, 50)) {
+      restored_at = i + 1;
+    }
+  }
+  if (restored_at != BLOCKS_PER_SECOND - 1 ||
+      governor->level != GOVERNOR_LEVELS - 2) {
+    printf("lone slow block restarted the calm count (%d)\n", restored_at);
+    return 1;
+  }
+  // a busy stretch does, and the next level waits for the average to settle
+  for (int i = 0; i < 20; i++) {
+    Governor_update(governor, 150);
+  }
+  restored_at = 0;
+  for (int i = 0; i < BLOCKS_PER_SECOND * 3 && restored_at == 0; i++) {
+    if (Governor_update(governor, 50)) {
+      restored_at = i + 1;
+    }
+  }
+  if (restored_at <= BLOCKS_PER_SECOND * 2 ||
+      restored_at > BLOCKS_PER_SECOND * 2 + 32) {
+    printf("restored %d blocks after a busy stretch\n", restored_at);
+    return 1;
+  }
+  Governor_free(governor);
+
+  // a minute of audio with a busy passage from 10 s to 30 s
+  governor = Governor_malloc(80, BLOCKS_PER_SECOND * 2);
+  uint32_t seed = 1;
+  int flag = 0;
+  int flag_counter = 0;
+  int muted = 0;
+  int transitions = 0;
+  int worst = 0;
+  uint8_t level_last = governor->level;
+  for (int block = 0; block < BLOCKS_PER_SECOND * 60; block++) {
+    int base = block >= BLOCKS_PER_SECOND * 10 && block < BLOCKS_PER_SECOND * 30
+                   ? 200
+                   : 60;
+    seed = seed * 1664525 + 1013904223;
+    // sd reads every so often spike a block
+    int load = base + ((seed >> 24) < 20 ? 80 : (int)(seed >> 28));
+    load = load * (100 - savings[governor->level]) / 100;
+    if (Governor_update(governor, load)) {
+      transitions++;
+    }
+    if (load > THRESHOLD) {
+      flag++;
+      if (flag_counter == 0) {
+        flag_counter = BLOCKS_PER_SECOND;
+      }
+      if (flag == FLAG_LIMIT) {
+        flag = 0;
+        if (Governor_shed(governor)) {
+          transitions++;
+        } else {
+          muted++;
+        }
+      }
+    } else if (flag_counter > 0) {
+      flag_counter--;
+    } else {
+      flag = 0;
+    }
+    if (governor->level > worst) {
+      worst = governor->level;
+    }
+    if (governor->level != level_last) {
+      printf("%6.2f s  %-12s -> %s\n", (float)block / BLOCKS_PER_SECOND,
+             governor_names[level_last], Governor_name(governor));
+      level_last = governor->level;
+    }
+  }
+  printf("transitions: %d, deepest: %s, muted: %d, end: %s\n", transitions,
+         governor_names[worst], muted, Governor_name(governor));
+  if (muted > 0 || governor->level != GOVERNOR_FULL) {
+    printf("FAIL\n");
+    return 1;
+  }
+  Governor_free(governor);
+  printf("PASS\n");
+  return 0;
+}
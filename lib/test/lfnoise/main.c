@@ -0,0 +1,118 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// checks the block noise: the same seed gives the same noise whatever the
+// block size, loops repeat, step noise holds for its period and glide noise
+// passes through the midpoints without jumps.
+//
+// gcc -O2 -o main main.c ../../pcg_basic.c -lm && ./main
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../lfnoise.h"
+#include "../check.h"
+
+#define SAMPLES 88200
+#define PERIOD 300
+
+typedef void (*fill_fn)(LFNoise *, int32_t *, uint16_t);
+
+// fills out with SAMPLES of noise in blocks of block samples
+void fill(fill_fn f, uint64_t seed, uint16_t block, int32_t *out) {
+  LFNoise *noise = LFNoise_malloc(seed, PERIOD);
+  for (int i = 0; i < SAMPLES; i += block) {
+    f(noise, out + i, SAMPLES - i < block ? SAMPLES - i : block);
+  }
+  LFNoise_free(noise);
+}
+
+int32_t a[SAMPLES];
+int32_t b[SAMPLES];
+
+int main() {
+  fill_fn kinds[2] = {LFNoise_step, LFNoise_glide};
+  const char *names[2] = {"step", "glide"};
+  for (int k = 0; k < 2; k++) {
+    char name[64];
+    fill(kinds[k], 7, 441, a);
+    fill(kinds[k], 7, 31, b);
+    snprintf(name, sizeof(name), "%s same seed", names[k]);
+    check(name, memcmp(a, b, sizeof(a)) == 0);
+    fill(kinds[k], 8, 441, b);
+    snprintf(name, sizeof(name), "%s other seed", names[k]);
+    check(name, memcmp(a, b, sizeof(a)) != 0);
+  }
+
+  // step noise changes only on the period
+  fill(LFNoise_step, 1, 441, a);
+  bool held = true;
+  for (int i = 1; i < SAMPLES; i++) {
+    held = held && ((i % PERIOD == 0) || a[i] == a[i - 1]);
+  }
+  check("step held", held);
+
+  // the step noise holds the draws in turn
+  LFNoise *noise = LFNoise_malloc(3, 1);
+  int32_t held_draws[2];
+  LFNoise_step(noise, held_draws, 2);
+  LFNoise_seed(noise, 3);
+  check("step draws", LFNoise_draw(noise) == held_draws[0] &&
+                          LFNoise_draw(noise) == held_draws[1]);
+
+  // a loop repeats every loop draws
+  LFNoise_seed(noise, 3);
+  LFNoise_setLoop(noise, 4);
+  LFNoise_step(noise, a, 12);
+  check("loop", memcmp(a, a + 4, 8 * sizeof(int32_t)) == 0 && a[0] != a[1]);
+  LFNoise_free(noise);
+
+  // glide noise is at each midpoint at the end of its segment, and moves
+  // no more than its segment asks
+  noise = LFNoise_malloc(5, PERIOD);
+  int32_t draws[SAMPLES / PERIOD + 1];
+  for (int i = 0; i <= SAMPLES / PERIOD; i++) {
+    draws[i] = LFNoise_draw(noise);
+  }
+  LFNoise_free(noise);
+  fill(LFNoise_glide, 5, 441, a);
+  int32_t err = 0;
+  int64_t jump = 0;
+  for (int s = 2; s < SAMPLES / PERIOD; s++) {
+    int32_t midpt = (draws[s - 1] + draws[s - 2]) / 2;
+    int32_t e = abs(a[s * PERIOD - 1] - midpt);
+    err = e > err ? e : err;
+  }
+  for (int i = 1; i < SAMPLES; i++) {
+    int64_t d = llabs((int64_t)a[i] - a[i - 1]);
+    jump = d > jump ? d : jump;
+  }
+  check("glide midpoints", err <= 1);
+  check("glide smooth", jump < 4 * 65536 / PERIOD);
+
+  return check_done();
+}
@@ -0,0 +1,144 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// checks that LogRing prints records the same as printf would, that a full
+// ring counts its drops, and runs a second "core" as a thread against core0
+// draining to check nothing is lost or torn.
+//
+// gcc -O2 -o main main.c -lm -lpthread && ./main
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+_Thread_local uint32_t core_num = 0;
+static inline uint32_t get_core_num(void) { return core_num; }
+static inline uint32_t save_and_disable_interrupts(void) { return 0; }
+static inline void restore_interrupts(uint32_t s) {}
+#define __dmb() __sync_synchronize()
+
+#include "../../logring.h"
+#include "../check.h"
+
+// runs LogRing_print with stdout going to a file and returns what it printed
+char printed[8192];
+const char *capture(LogRing *lr) {
+  fflush(stdout);
+  int saved = dup(1);
+  FILE *f = tmpfile();
+  dup2(fileno(f), 1);
+  LogRing_print(lr);
+  fflush(stdout);
+  dup2(saved, 1);
+  close(saved);
+  rewind(f);
+  size_t n = fread(printed, 1, sizeof(printed) - 1, f);
+  printed[n] = '\0';
+  fclose(f);
+  return printed;
+}
+
+#define PER_THREAD 100000
+LogRing *shared;
+uint32_t sent = 0;
+volatile bool finished = false;
+
+void *core1(void *arg) {
+  core_num = 1;
+  LogRingQueue *q = &shared->queues[1];
+  for (uint32_t i = 0; i < PER_THREAD; i++) {
+    // wait for room so every record goes through the handoff
+    while ((uint16_t)(q->write - q->read) >= LOGRING_SIZE) {
+      sched_yield();
+    }
+    LogRing_printf(shared, "%d %d\n", i, i * 3);
+    sent++;
+  }
+  finished = true;
+  return NULL;
+}
+
+int main() {
+  LogRing *lr = LogRing_malloc();
+  LogRing_printf(lr, "[delay] feedback %d\n", 5);
+  LogRing_printf(lr, "sdcard%2.1f %ld %d %d %ld\n", 93.25f, 4100, 1764, 12,
+                 7);
+  LogRing_printf(lr, "memory usage: %2.1f%% (%ld/%ld)\n", 12.5, 1000, 8000);
+  LogRing_printf(lr, "%s=%x %5u|%-4d|\n", "name", 0xbeef, 42, -3);
+  check_str("format", capture(lr),
+            "[delay] feedback 5\n"
+            "sdcard93.2 4100 1764 12 7\n"
+            "memory usage: 12.5% (1000/8000)\n"
+            "name=beef    42|-3  |\n");
+  check_str("drained", capture(lr), "");
+
+  for (uint16_t i = 0; i < LOGRING_SIZE + 5; i++) {
+    LogRing_printf(lr, "");
+  }
+  check_str("dropped", capture(lr), "[logring] core0 dropped 5 messages\n");
+  check_str("dropped once", capture(lr), "");
+
+  // core1 logs as fast as it can while core0 drains, every record that made it
+  // in has to come out whole and in order
+  shared = LogRing_malloc();
+  pthread_t thread;
+  pthread_create(&thread, NULL, core1, NULL);
+  uint32_t received = 0;
+  int64_t last = -1;
+  while (true) {
+    bool done = finished;
+    LogRingQueue *q = &shared->queues[1];
+    while (q->read != q->write) {
+      __dmb();
+      LogRecord *r = &q->records[q->read & LOGRING_MASK];
+      if (r->nargs != 2 || r->args[1] != r->args[0] * 3 ||
+          (int64_t)r->args[0] <= last) {
+        printf("FAIL torn or out of order record at %ld\n", (long)r->args[0]);
+        failures++;
+      }
+      last = r->args[0];
+      received++;
+      __dmb();
+      q->read++;
+    }
+    if (done) {
+      break;
+    }
+    sched_yield();
+  }
+  pthread_join(thread, NULL);
+  printf("core1 sent %u, received %u, dropped %u\n", sent, received,
+         shared->queues[1].dropped);
+  if (received != PER_THREAD || shared->queues[1].dropped != 0) {
+    printf("FAIL lost records\n");
+    failures++;
+  }
+
+  LogRing_free(lr);
+  LogRing_free(shared);
+  return check_done();
+}
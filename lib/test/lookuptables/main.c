@@ -0,0 +1,169 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// compares the interpolated low-resolution lookup tables against the full
+// resolution curves they replace (as computed by the old generators) and
+// times both versions over a block with fuzz, shaper and saturate all active.
+//
+// gcc -O2 -o main main.c -lm && ./main
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../../utils.h"
+//
+#include "../../fuzz.h"
+#include "../../shaper.h"
+#include "../../transfer_saturate2.h"
+
+#define BLOCK 441
+#define BLOCKS 20000
+
+int16_t fuzz_full[32768];
+int16_t compress_full[32768];
+int16_t expand_full[32768];
+int16_t doublesine_full[8192];
+
+void make_full_tables() {
+  double max_value = 65535.0 * pow(10, -6.0 / 20.0);
+  double mu = 510;
+  for (int i = 0; i < 32768; i++) {
+    double x = (double)i / 32768.0;
+    fuzz_full[i] = (int16_t)((5.4 * x) / (1 + 5.4 * x) * max_value);
+    compress_full[i] = (int16_t)(log(1 + mu * x) / log(1 + mu) * 32767);
+    expand_full[i] = (int16_t)((pow(1 + mu, x) - 1) / mu * 32767);
+  }
+  for (int i = 0; i < 8192; i++) {
+    doublesine_full[i] =
+        (int16_t)round(0.75 * 32767 * sin(2 * M_PI * (double)i / 32767));
+  }
+}
+
+int16_t doublesine_full_lookup(int32_t v) {
+  v = v + 32768;
+  int32_t p = v & 8191;
+  if (v & 8192) {
+    p = 8191 - p;
+  }
+  if (v & 16384) {
+    return -doublesine_full[p];
+  }
+  return doublesine_full[p];
+}
+
+void report(const char *name, int16_t (*interp)(int32_t),
+            int16_t (*full)(int32_t), int32_t lo, int32_t hi) {
+  int32_t max_err = 0;
+  int32_t max_at = 0;
+  double sum = 0;
+  double sum2 = 0;
+  for (int32_t v = lo; v <= hi; v++) {
+    int32_t e = abs(interp(v) - full(v));
+    if (e > max_err) {
+      max_err = e;
+      max_at = v;
+    }
+    sum += e;
+    sum2 += (double)e * e;
+  }
+  double n = hi - lo + 1;
+  printf("%-10s max %4d (at %6d)  mean %.3f  rms %.3f  (%.1f dBFS)\n", name,
+         max_err, max_at, sum / n, sqrt(sum2 / n),
+         20 * log10((sqrt(sum2 / n) + 1e-9) / 32767.0));
+}
+
+int16_t fuzz_interp(int32_t v) { return fuzz_lookup(v); }
+int16_t fuzz_full_lookup(int32_t v) { return fuzz_full[v]; }
+int16_t compress_interp(int32_t v) {
+  return shaper_lookup(compress_curve_data, v);
+}
+int16_t compress_full_lookup(int32_t v) { return compress_full[v]; }
+int16_t expand_interp(int32_t v) { return shaper_lookup(expand_curve_data, v); }
+int16_t expand_full_lookup(int32_t v) { return expand_full[v]; }
+int16_t doublesine_interp(int32_t v) { return transfer_doublesine(v); }
+
+// the per-sample chain as it ran before: direct indexing into 32k tables
+void process_full(int16_t *values, uint16_t n) {
+  for (uint16_t i = 0; i < n; i++) {
+    int16_t v = doublesine_full_lookup(values[i]);
+    v = v < 0 ? -compress_full[-v] : compress_full[v];
+    v = v < 0 ? -fuzz_full[-v] : fuzz_full[v];
+    values[i] = v;
+  }
+}
+
+void process_interp(int16_t *values, uint16_t n) {
+  for (uint16_t i = 0; i < n; i++) {
+    int16_t v = transfer_doublesine(values[i]);
+    v = v < 0 ? -shaper_lookup(compress_curve_data, -v)
+              : shaper_lookup(compress_curve_data, v);
+    v = v < 0 ? -fuzz_lookup(-v) : fuzz_lookup(v);
+    values[i] = v;
+  }
+}
+
+double time_blocks(void (*fn)(int16_t *, uint16_t)) {
+  int16_t values[BLOCK];
+  uint32_t seed = 1234;
+  int64_t check = 0;
+  clock_t t0 = clock();
+  for (int b = 0; b < BLOCKS; b++) {
+    for (int i = 0; i < BLOCK; i++) {
+      seed = seed * 1664525 + 1013904223;
+      values[i] = (int16_t)(seed >> 16);
+    }
+    fn(values, BLOCK);
+    check += values[b % BLOCK];
+  }
+  clock_t t1 = clock();
+  if (check == 1) {
+    printf("\n");
+  }
+  return (double)(t1 - t0) / CLOCKS_PER_SEC * 1e9 / BLOCKS;
+}
+
+int main() {
+  make_full_tables();
+  printf("table sizes (bytes): fuzz %d -> %d, shaper %d -> %d, "
+         "doublesine %d -> %d\n",
+         (int)sizeof(fuzz_full), (int)sizeof(fuzz_samples),
+         (int)(sizeof(compress_full) + sizeof(expand_full)),
+         (int)(sizeof(compress_curve_data) + sizeof(expand_curve_data)),
+         (int)sizeof(doublesine_full), (int)sizeof(transfer_doublesine_raw));
+  printf("error vs full resolution tables:\n");
+  report("fuzz", fuzz_interp, fuzz_full_lookup, 0, 32767);
+  report("compress", compress_interp, compress_full_lookup, 0, 32767);
+  report("expand", expand_interp, expand_full_lookup, 0, 32767);
+  report("doublesine", doublesine_interp, doublesine_full_lookup, -32768,
+         32767);
+  // host timing only: the cache behaviour that motivates the change is the
+  // rp2040 XIP cache, measure on device with PRINT_AUDIO_CPU_USAGE
+  printf("host ns per block (%d samples, saturate+shaper+fuzz):\n", BLOCK);
+  printf("  full tables    %8.1f\n", time_blocks(process_full));
+  printf("  interpolated   %8.1f\n", time_blocks(process_interp));
+  return 0;
+}
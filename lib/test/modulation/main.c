@@ -0,0 +1,228 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// checks the modulation: the lfo periods follow the tempo, the shapes, the
+// volume and pan ramps between control points without steps, and the routes
+// to the pitch and the cutoff.
+//
+// gcc -O2 -o main main.c ../../pcg_basic.c -lm && ./main
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../modulation.h"
+#include "../check.h"
+
+#define BLOCK 441
+#define BPM 120
+// a period of TRANSPORT_TICKS is half a beat
+#define PERIOD_SAMPLES (44100 * 30 / BPM)
+#define LEVEL (1 << 28)
+
+int32_t samples[BLOCK * 2];
+
+// runs a block of constant samples through the volume and the pan
+void run(Modulation *mod) {
+  for (int i = 0; i < BLOCK * 2; i++) {
+    samples[i] = LEVEL;
+  }
+  Modulation_beginBlock(mod, BLOCK, BPM);
+  Modulation_process(mod, samples, BLOCK);
+}
+
+void test_shapes() {
+  Modulation_tables();
+  check("sine quarter", mod_wavetable[MOD_SINE][MOD_TABLE_SIZE / 4] == 32767);
+  check("sine guard", mod_wavetable[MOD_SINE][MOD_TABLE_SIZE] ==
+                          mod_wavetable[MOD_SINE][0]);
+  check("triangle start", mod_wavetable[MOD_TRIANGLE][0] == -32767);
+  check("triangle half",
+        mod_wavetable[MOD_TRIANGLE][MOD_TABLE_SIZE / 2] == 32767);
+  check("triangle quarter",
+        abs(mod_wavetable[MOD_TRIANGLE][MOD_TABLE_SIZE / 4]) < 2);
+  check("square", mod_wavetable[MOD_SQUARE][1] == 32767 &&
+                      mod_wavetable[MOD_SQUARE][MOD_TABLE_SIZE - 1] == -32767);
+
+  // sample and hold only moves when the lfo wraps
+  Modulation *mod = Modulation_malloc(1);
+  Modulation_setLfo(mod, MOD_LFO1, TRANSPORT_TICKS, MOD_SAMPLE_HOLD);
+  Modulation_beginBlock(mod, BLOCK, BPM);
+  int changes = 0;
+  int32_t last = Modulation_source(mod, MOD_LFO1, 0);
+  for (int i = 0; i < PERIOD_SAMPLES * 4; i += 32) {
+    int32_t v = Modulation_source(mod, MOD_LFO1, 32);
+    changes += v != last;
+    last = v;
+  }
+  check("sample and hold changes once a period", changes >= 3 && changes <= 4);
+
+  // the noise glides, a little at a time, and wanders over the range
+  int32_t lo = 0, hi = 0, step_max = 0;
+  last = Modulation_source(mod, MOD_NOISE, 32);
+  for (int i = 0; i < PERIOD_SAMPLES * 64; i += 32) {
+    int32_t v = Modulation_source(mod, MOD_NOISE, 32);
+    step_max = abs(v - last) > step_max ? abs(v - last) : step_max;
+    lo = v < lo ? v : lo;
+    hi = v > hi ? v : hi;
+    last = v;
+  }
+  check("noise glides", step_max < 4 * 65536 * 32 / PERIOD_SAMPLES);
+  check("noise wanders", lo < -8192 && hi > 8192);
+  Modulation_free(mod);
+}
+
+// full tremolo on a sine: silence at the troughs a period apart, full
+// volume at the peaks, and no steps larger than the slope of the sine
+void test_tremolo() {
+  Modulation *mod = Modulation_malloc(1);
+  Modulation_setLfo(mod, MOD_LFO1, TRANSPORT_TICKS, MOD_SINE);
+  Modulation_route(mod, MOD_LFO1, MOD_VOLUME, MOD_DEPTH_FULL);
+  check("volume active", Modulation_active(mod, MOD_VOLUME));
+  int32_t lo = LEVEL, hi = 0;
+  int troughs[8];
+  int troughs_num = 0;
+  int64_t step_max = 0;
+  int32_t prev = LEVEL;
+  bool falling = false;
+  for (int b = 0; b < PERIOD_SAMPLES * 3 / BLOCK; b++) {
+    run(mod);
+    for (int i = 0; i < BLOCK; i++) {
+      int32_t v = samples[i * 2];
+      check("channels match", v == samples[i * 2 + 1]);
+      if (v < lo) lo = v;
+      if (v > hi) hi = v;
+      int64_t step = llabs((int64_t)v - prev);
+      if (b > 0 && step > step_max) step_max = step;
+      // where it first dips near silence after being loud
+      if (v > LEVEL / 2) {
+        falling = true;
+      } else if (falling && v < LEVEL / 64 && troughs_num < 8) {
+        troughs[troughs_num++] = b * BLOCK + i;
+        falling = false;
+      }
+      prev = v;
+    }
+  }
+  check("tremolo reaches silence", lo < LEVEL / 1000);
+  check("tremolo reaches full", hi > LEVEL - LEVEL / 1000);
+  check("tremolo troughs", troughs_num >= 2);
+  if (troughs_num >= 2) {
+    int period = troughs[1] - troughs[0];
+    check("tremolo period", abs(period - PERIOD_SAMPLES) < 64);
+  }
+  // the steepest the sine moves per sample, with room for rounding
+  double slope = LEVEL * M_PI / PERIOD_SAMPLES;
+  check("tremolo ramps", step_max < slope * 1.1 + 64);
+
+  // the rate follows the tempo
+  Modulation_setLfo(mod, MOD_LFO1, TRANSPORT_TICKS * 2, MOD_SINE);
+  Modulation_beginBlock(mod, BLOCK, BPM);
+  uint32_t slow = mod->source[MOD_LFO1].step;
+  Modulation_beginBlock(mod, BLOCK, BPM * 2);
+  uint32_t fast = mod->source[MOD_LFO1].step;
+  check("tempo doubles the rate", fast == slow * 2 || fast == slow * 2 + 1);
+
+  // without a route the samples pass untouched
+  Modulation_route(mod, MOD_LFO1, MOD_VOLUME, 0);
+  check("volume inactive", !Modulation_active(mod, MOD_VOLUME));
+  run(mod);
+  bool untouched = true;
+  for (int i = 0; i < BLOCK * 2; i++) {
+    untouched = untouched && samples[i] == LEVEL;
+  }
+  check("no route passes", untouched);
+  Modulation_free(mod);
+}
+
+// pan splits the level between the channels: half each in the centre and
+// all of it on one side at the ends
+void test_pan() {
+  Modulation *mod = Modulation_malloc(1);
+  Modulation_setLfo(mod, MOD_LFO2, TRANSPORT_TICKS, MOD_SQUARE);
+  Modulation_route(mod, MOD_LFO2, MOD_PAN, MOD_DEPTH_FULL);
+  int32_t left_max = 0, right_max = 0;
+  bool sums = true;
+  for (int b = 0; b < PERIOD_SAMPLES * 2 / BLOCK; b++) {
+    run(mod);
+    for (int i = 0; i < BLOCK; i++) {
+      int32_t l = samples[i * 2], r = samples[i * 2 + 1];
+      if (l > left_max) left_max = l;
+      if (r > right_max) right_max = r;
+      sums = sums && abs(l + r - LEVEL) < LEVEL / 1000;
+    }
+  }
+  check("pan keeps the level", sums);
+  check("pan reaches left", left_max > LEVEL - LEVEL / 1000);
+  check("pan reaches right", right_max > LEVEL - LEVEL / 1000);
+
+  // a zero depth centres it
+  Modulation_route(mod, MOD_LFO2, MOD_PAN, 0);
+  Modulation_route(mod, MOD_ENVELOPE, MOD_PAN, 1);
+  Modulation_setEnvelope(mod, 0);
+  run(mod);
+  run(mod);
+  check("pan centre", abs(samples[0] - LEVEL / 2) < LEVEL / 1000 &&
+                          abs(samples[1] - LEVEL / 2) < LEVEL / 1000);
+  Modulation_free(mod);
+}
+
+// the envelope ramps over the block to where it was set, the pitch and
+// cutoff follow it
+void test_pitch_cutoff() {
+  Modulation *mod = Modulation_malloc(1);
+  check("no pitch", Modulation_pitch(mod) == 1.0f);
+  Modulation_route(mod, MOD_ENVELOPE, MOD_PITCH, MOD_DEPTH_FULL);
+  Modulation_route(mod, MOD_ENVELOPE, MOD_CUTOFF, MOD_DEPTH_FULL);
+  Modulation_setEnvelope(mod, 32767);
+  Modulation_beginBlock(mod, BLOCK, BPM);
+  // the pitch of a block is where the last one ended
+  check("pitch starts at rest", Modulation_pitch(mod) == 1.0f);
+  check("cutoff ramps", Modulation_cutoff(mod, 1, 100, 200) <
+                            Modulation_cutoff(mod, mod->points - 1, 100, 200));
+  check("cutoff reaches", Modulation_cutoff(mod, mod->points - 1, 100, 200) ==
+                              199 ||
+                              Modulation_cutoff(mod, mod->points - 1, 100,
+                                                200) == 200);
+  check("cutoff clamps", Modulation_cutoff(mod, mod->points - 1, 190, 200) ==
+                             200);
+  Modulation_beginBlock(mod, BLOCK, BPM);
+  check("pitch up an octave", fabsf(Modulation_pitch(mod) - 2.0f) < 0.01f);
+  Modulation_setEnvelope(mod, -32767);
+  Modulation_beginBlock(mod, BLOCK, BPM);
+  Modulation_beginBlock(mod, BLOCK, BPM);
+  check("pitch down an octave", fabsf(Modulation_pitch(mod) - 0.5f) < 0.01f);
+  check("cutoff clamps low", Modulation_cutoff(mod, 1, 10, 200) == 0);
+  Modulation_free(mod);
+}
+
+int main() {
+  test_shapes();
+  test_tremolo();
+  test_pan();
+  test_pitch_cutoff();
+  return check_done();
+}
@@ -0,0 +1,119 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// checks the profiler's stage attribution, SysTick wraparound, histogram and
+// the dump handshake against a fake SysTick that only moves when told to.
+//
+// gcc -O2 -o main main.c -lm && ./main
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+  uint32_t csr;
+  uint32_t rvr;
+  uint32_t cvr;
+} fake_systick_t;
+fake_systick_t fake_systick;
+#define systick_hw (&fake_systick)
+#define clk_sys 0
+uint32_t clock_get_hz(int clk) { return 125000000; }
+#define SAMPLES_PER_BUFFER 441
+#define SAMPLE_RATE 44100
+#define US_PER_BLOCK 1000000 * SAMPLES_PER_BUFFER / SAMPLE_RATE
+
+#include "../../profiler.h"
+#include "../check.h"
+
+// SysTick counts down and wraps at 24 bits
+void tick(uint32_t cycles) {
+  fake_systick.cvr = (fake_systick.cvr - cycles) & PROFILER_SYSTICK_MASK;
+}
+
+void run_block(Profiler *p, uint32_t sd, uint32_t fx, uint32_t delay) {
+  Profiler_blockStart(p);
+  tick(100);
+  Profiler_mark(p, PROFILER_TAKE_BUFFER);
+  tick(sd);
+  Profiler_mark(p, PROFILER_SD_READ);
+  tick(fx);
+  Profiler_mark(p, PROFILER_FX);
+  tick(delay);
+  Profiler_mark(p, PROFILER_DELAY);
+  tick(50);
+  Profiler_blockEnd(p);
+}
+
+int main() {
+  Profiler *p = Profiler_malloc();
+  Profiler_blockStart(p);
+  check_int("started", p->started, 1);
+  check_int("mark cycles", p->mark_cycles, 0);
+
+  // start near zero so the first blocks wrap
+  fake_systick.cvr = 300;
+  for (uint32_t i = 0; i < 100; i++) {
+    run_block(p, 1000 + i, 4000, i < 50 ? 0 : 2000);
+  }
+  ProfilerStage *s = p->stages;
+  check_int("take count", s[PROFILER_TAKE_BUFFER].count, 100);
+  check_int("take min", s[PROFILER_TAKE_BUFFER].min, 100);
+  check_int("take max", s[PROFILER_TAKE_BUFFER].max, 100);
+  check_int("sd min", s[PROFILER_SD_READ].min, 1000);
+  check_int("sd max", s[PROFILER_SD_READ].max, 1099);
+  check_int("sd avg", s[PROFILER_SD_READ].sum / 100, 1049);
+  check_int("seek unhit", s[PROFILER_SD_SEEK].count, 0);
+  check_int("delay min", s[PROFILER_DELAY].min, 0);
+  check_int("delay max", s[PROFILER_DELAY].max, 2000);
+  check_int("other", s[PROFILER_OTHER].max, 50);
+  check_int("total min", s[PROFILER_TOTAL].min, 100 + 1000 + 4000 + 50);
+  check_int("total max", s[PROFILER_TOTAL].max, 100 + 1099 + 4000 + 2000 + 50);
+  // 4000 lands in [2^11, 2^12)
+  check_int("fx histogram", s[PROFILER_FX].histogram[11], 100);
+  check_int("delay zero bin", s[PROFILER_DELAY].histogram[0], 50);
+  check_int("delay histogram", s[PROFILER_DELAY].histogram[10], 50);
+
+  // nothing is copied until the audio side finishes a block
+  Profiler_request(p, true);
+  check_int("not ready", p->snapshot_ready, 0);
+  run_block(p, 500, 4000, 0);
+  check_int("ready", p->snapshot_ready, 1);
+  check_int("request cleared", p->dump_requested, 0);
+  // the reset happens before the block is folded in, so the snapshot only has
+  // the one block
+  check_int("snapshot count", p->snapshot[PROFILER_SD_READ].count, 1);
+  check_int("snapshot sd", p->snapshot[PROFILER_SD_READ].max, 500);
+  check_int("snapshot total", p->snapshot[PROFILER_TOTAL].max, 4650);
+  run_block(p, 600, 4000, 0);
+  check_int("stats keep going", p->stages[PROFILER_SD_READ].count, 2);
+  check_int("snapshot frozen", p->snapshot[PROFILER_SD_READ].count, 1);
+
+  Profiler_poll(p);
+  check_int("printed", p->snapshot_ready, 0);
+
+  Profiler_free(p);
+  return check_done();
+}
@@ -0,0 +1,257 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// benchmark matrix over every render kernel (channels x interpolation x
+// direction x fade) at 1x and 2x oversampling, plus a check against the old
+// reverse -> resample -> fade -> volume path and a block from a single frame.
+//
+// needs lib/crossfade3.h (make lib/crossfade3.h in the root)
+// gcc -O2 -o main main.c -lm && ./main
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../../utils.h"
+//
+#include "../../fixedpoint.h"
+//
+#include "../../array_resample.h"
+#include "../../crossfade3.h"
+#include "../../render.h"
+
+#define OUT_FRAMES 441
+#define BLOCKS 20000
+
+int16_t values[OUT_FRAMES * 2 * 2 * 2];
+int32_t samples[OUT_FRAMES * 2];
+
+double time_kernel(render_fn fn, uint16_t in_frames, const int32_t *fade) {
+  int64_t check = 0;
+  clock_t t0 = clock();
+  for (int b = 0; b < BLOCKS; b++) {
+    fn(samples, values, in_frames, OUT_FRAMES, fade, 200);
+    check += samples[b % OUT_FRAMES];
+  }
+  clock_t t1 = clock();
+  if (check == 1) {
+    printf("\n");
+  }
+  return (double)(t1 - t0) / CLOCKS_PER_SEC * 1e9 / BLOCKS;
+}
+
+// the mono path as it was: reverse in place, resample into a new array,
+// fade, then volume
+void render_old(int32_t *out, int16_t *in, uint16_t in_frames, bool reverse,
+                bool quadratic, bool faded, uint32_t vol) {
+  int16_t buf[in_frames];
+  memcpy(buf, in, sizeof(buf));
+  if (reverse) {
+    for (int i = 0; i < in_frames / 2; i++) {
+      int16_t temp = buf[i];
+      buf[i] = buf[in_frames - i - 1];
+      buf[in_frames - i - 1] = temp;
+    }
+  }
+  int16_t *newArray;
+  if (quadratic) {
+    newArray = array_resample_quadratic_fp(buf, in_frames, OUT_FRAMES);
+  } else {
+    newArray = array_resample_linear(buf, in_frames, OUT_FRAMES);
+  }
+  for (uint16_t i = 0; i < OUT_FRAMES; i++) {
+    if (faded) {
+      newArray[i] = crossfade3_in(newArray[i], i, CROSSFADE3_COS);
+    }
+    out[i * 2] = (vol * newArray[i]) << 8u;
+    out[i * 2] += (out[i * 2] >> 16u);
+  }
+  free(newArray);
+}
+
+int main() {
+  uint32_t seed = 1234;
+  for (int i = 0; i < sizeof(values) / sizeof(int16_t); i++) {
+    seed = seed * 1664525 + 1013904223;
+    values[i] = (int16_t)(20000 * sin(i * 0.01) + (int16_t)(seed >> 16) / 8);
+  }
+
+  printf("ns per block of %d frames (host)\n", OUT_FRAMES);
+  printf("%-8s %-10s %-8s %-5s %10s %10s\n", "channels", "interp", "dir",
+         "fade", "1x", "2x");
+  for (int stereo = 0; stereo < 2; stereo++) {
+    for (int quadratic = 0; quadratic < 2; quadratic++) {
+      for (int reverse = 0; reverse < 2; reverse++) {
+        for (int faded = 0; faded < 2; faded++) {
+          render_fn fn = Render_select(stereo, quadratic, reverse, faded);
+          const int32_t *fade = faded ? crossfade3_cos_in : NULL;
+          printf("%-8s %-10s %-8s %-5s %10.1f %10.1f\n",
+                 stereo ? "stereo" : "mono",
+                 quadratic ? "quadratic" : "linear",
+                 reverse ? "reverse" : "forward", faded ? "yes" : "no",
+                 time_kernel(fn, OUT_FRAMES, fade),
+                 time_kernel(fn, OUT_FRAMES * 2, fade));
+        }
+      }
+    }
+  }
+
+  // compare both paths against an exact double precision resampler (mono,
+  // pitched up a little). the old linear resampler truncates its step, so
+  // it drifts towards the end of the block
+  printf("\nmax error vs exact resampling (int16 steps)\n");
+  printf("%-10s %-8s %-5s %6s %6s\n", "interp", "dir", "fade", "old", "new");
+  uint16_t in_frames = 517;
+  for (int quadratic = 0; quadratic < 2; quadratic++) {
+    for (int reverse = 0; reverse < 2; reverse++) {
+      for (int faded = 0; faded < 2; faded++) {
+        int32_t old[OUT_FRAMES * 2];
+        render_old(old, values, in_frames, reverse, quadratic, faded, 256);
+        memset(samples, 0, sizeof(samples));
+        Render_select(false, quadratic, reverse, faded)(
+            samples, values, in_frames, OUT_FRAMES,
+            faded ? crossfade3_cos_in : NULL, 256);
+        int32_t max_old = 0;
+        int32_t max_new = 0;
+        for (int i = 0; i < OUT_FRAMES; i++) {
+          double p = (double)i * (in_frames - 1) / (OUT_FRAMES - 1);
+          int k = (int)p;
+          double f = p - k;
+          int k2 = k + 1 < in_frames ? k + 1 : in_frames - 1;
+          int k0 = k > 0 ? k - 1 : 0;
+          if (reverse) {
+            k = in_frames - 1 - k;
+            k2 = in_frames - 1 - k2;
+            k0 = in_frames - 1 - k0;
+          }
+          double y;
+          if (quadratic) {
+            double x0 = values[k0], x1 = values[k], x2 = values[k2];
+            y = x1 + 0.5 * f * (x2 - x0 + f * (x0 - 2 * x1 + x2));
+          } else {
+            y = values[k] + f * (values[k2] - values[k]);
+          }
+          if (faded) {
+            y = y * crossfade3_cos_in[i] / 65536.0;
+          }
+          int32_t e_old = fabs((old[i * 2] >> 16) - y);
+          int32_t e_new = fabs((samples[i * 2] >> 16) - y);
+          max_old = e_old > max_old ? e_old : max_old;
+          max_new = e_new > max_new ? e_new : max_new;
+        }
+        printf("%-10s %-8s %-5s %6d %6d\n",
+               quadratic ? "quadratic" : "linear",
+               reverse ? "reverse" : "forward", faded ? "yes" : "no", max_old,
+               max_new);
+      }
+    }
+  }
+
+  // a single input frame holds for the whole block. the frame sits against
+  // pages that fault when read, so reading a neighbour past it crashes
+  // instead of being weighted by a zero fraction
+  printf("\nsingle input frame\n");
+  long page = sysconf(_SC_PAGESIZE);
+  uint8_t *pages = mmap(NULL, page * 3, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  mprotect(pages, page, PROT_NONE);
+  mprotect(pages + page * 2, page, PROT_NONE);
+  int16_t frame_values[2] = {1000, -1000};
+  int32_t single_out[2];
+  for (int c = 0; c < 2; c++) {
+    single_out[c] = (256 * frame_values[c]) << 8u;
+    single_out[c] += single_out[c] >> 16u;
+  }
+  for (int stereo = 0; stereo < 2; stereo++) {
+    for (int quadratic = 0; quadratic < 2; quadratic++) {
+      for (int reverse = 0; reverse < 2; reverse++) {
+        // forward reads after the frame, reverse before it
+        size_t bytes = (stereo ? 2 : 1) * sizeof(int16_t);
+        int16_t *frame =
+            (int16_t *)(reverse ? pages + page : pages + page * 2 - bytes);
+        memcpy(frame, frame_values, bytes);
+        memset(samples, 0, sizeof(samples));
+        Render_select(stereo, quadratic, reverse, false)(
+            samples, frame, 1, OUT_FRAMES, NULL, 256);
+        for (int i = 0; i < OUT_FRAMES; i++) {
+          if (samples[i * 2] != single_out[0] ||
+              samples[i * 2 + 1] != single_out[stereo]) {
+            printf("single frame %s %s %s wrong at %d\n",
+                   stereo ? "stereo" : "mono",
+                   quadratic ? "quadratic" : "linear",
+                   reverse ? "reverse" : "forward", i);
+            return 1;
+          }
+        }
+      }
+    }
+  }
+  munmap(pages, page * 3);
+  printf("ok\n");
+
+  // a jump at a sample offset: the old head holds unity until the split and
+  // then fades out, the new head fades in over what is left of the block
+  printf("\nsplit fades (offset, out[split], out[end], in[0], in[end], ns)\n");
+  int32_t fade_out[OUT_FRAMES];
+  int32_t fade_in[OUT_FRAMES];
+  uint16_t splits[] = {1, 100, 220, 377};
+  for (int s = 0; s < 4; s++) {
+    uint16_t split = splits[s];
+    clock_t t0 = clock();
+    for (int b = 0; b < BLOCKS; b++) {
+      Render_fade(fade_out, OUT_FRAMES, split, crossfade3_cos_out,
+                  CROSSFADE3_LIMIT);
+      Render_fade(fade_in, OUT_FRAMES - split, 0, crossfade3_cos_in,
+                  CROSSFADE3_LIMIT);
+    }
+    clock_t t1 = clock();
+    for (int i = 0; i < split; i++) {
+      if (fade_out[i] != 65536) {
+        printf("fade out not held at %d\n", i);
+        return 1;
+      }
+    }
+    for (int i = split + 1; i < OUT_FRAMES; i++) {
+      if (fade_out[i] > fade_out[i - 1]) {
+        printf("fade out not falling at %d\n", i);
+        return 1;
+      }
+    }
+    for (int i = 1; i < OUT_FRAMES - split; i++) {
+      if (fade_in[i] < fade_in[i - 1]) {
+        printf("fade in not rising at %d\n", i);
+        return 1;
+      }
+    }
+    printf("%3d %6d %6d %6d %6d %8.1f\n", split, fade_out[split],
+           fade_out[OUT_FRAMES - 1], fade_in[0], fade_in[OUT_FRAMES - split - 1],
+           (double)(t1 - t0) / CLOCKS_PER_SEC * 1e9 / BLOCKS);
+  }
+  return 0;
+}
@@ -0,0 +1,88 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// checks that the reverb tail dies out: after an impulse the lines reach
+// all zero, at every decay and tone and at both rates, rather than settling
+// into a small limit cycle, so switching off gives them back to the pool on
+// silence rather than after REVERB_TAIL_SAMPLES.
+//
+// gcc -O2 -o main main.c -lm && ./main
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../reverb.h"
+#include "../check.h"
+
+#define BLOCK 441
+// the longest decay loses 3% a trip of about 40 ms, so the tail takes
+// longer than REVERB_TAIL_SAMPLES; give it a bound rather than ringing on
+#define TAIL_LIMIT (44100 * 30)
+
+int main() {
+  FxPool *pool = FxPool_malloc(FXPOOL_SIZE);
+  Reverb *reverb = Reverb_malloc(pool);
+  int32_t block[BLOCK * 2];
+  const uint8_t settings[3] = {0, 128, 255};
+  for (uint8_t half = 0; half < 2; half++) {
+    for (uint8_t d = 0; d < 3; d++) {
+      for (uint8_t t = 0; t < 3; t++) {
+        char name[64];
+        snprintf(name, sizeof(name), "half %d decay %d tone %d", half,
+                 settings[d], settings[t]);
+        Reverb_setHalfRate(reverb, half);
+        Reverb_set(reverb, settings[d], 255, settings[t]);
+        check(name, Reverb_setActive(reverb, true));
+        // a full scale impulse, then silence until the lines are empty
+        memset(block, 0, sizeof(block));
+        block[0] = 0x7FFF0000;
+        block[1] = 0x7FFF0000;
+        Reverb_process(reverb, block, BLOCK);
+        check(name, !Reverb_isSilent(reverb));
+        uint32_t samples = BLOCK;
+        while (!Reverb_isSilent(reverb) && samples < TAIL_LIMIT) {
+          // the wet tail is mixed into the block, clear it every time
+          memset(block, 0, sizeof(block));
+          Reverb_process(reverb, block, BLOCK);
+          samples += BLOCK;
+        }
+        if (!Reverb_isSilent(reverb)) {
+          printf("%s: still ringing after %u samples\n", name, samples);
+        }
+        check(name, Reverb_isSilent(reverb));
+        // and switched off the lines go back right away
+        Reverb_setActive(reverb, false);
+        memset(block, 0, sizeof(block));
+        Reverb_process(reverb, block, BLOCK);
+        check(name, reverb->buffer == NULL && pool->used == 0);
+      }
+    }
+  }
+  Reverb_free(reverb);
+  FxPool_free(pool);
+
+  return check_done();
+}
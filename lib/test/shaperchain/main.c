@@ -0,0 +1,198 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// compares the fused saturate/shaper/fuzz/bitcrush curve against the separate
+// passes it replaces, and times both over a block.
+//
+// gcc -O2 -o main main.c -lm && ./main
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+void __dmb() {}
+
+#include "../../definitions.h"
+#include "../../utils.h"
+//
+#include "../../bitcrush.h"
+#include "../../shaperchain.h"
+
+#define BLOCK 441
+#define BLOCKS 20000
+
+bool fx_active[16];
+uint8_t fx_param[16][3];
+
+void process_separate(int16_t *values, uint16_t n) {
+  if (fx_active[FX_SATURATE]) {
+    for (uint16_t i = 0; i < n; i++) {
+      values[i] = values[i] * fx_param[FX_SATURATE][0] / 128;
+      values[i] = transfer_doublesine(values[i]);
+    }
+  }
+  if (fx_active[FX_SHAPER]) {
+    if (fx_param[FX_SHAPER][0] > 128) {
+      Shaper_expandUnder_compressOver_process(values, n,
+                                              fx_param[FX_SHAPER][1] << 7);
+    } else {
+      Shaper_expandOver_compressUnder_process(values, n,
+                                              fx_param[FX_SHAPER][1] << 7);
+    }
+  }
+  if (fx_active[FX_FUZZ]) {
+    Fuzz_process(values, n, fx_param[FX_FUZZ][0], fx_param[FX_FUZZ][1]);
+  }
+  if (fx_active[FX_BITCRUSH]) {
+    Bitcrush_process(values, n, fx_param[FX_BITCRUSH][0],
+                     fx_param[FX_BITCRUSH][1]);
+  }
+}
+
+ShaperChain *chain;
+
+void process_fused(int16_t *values, uint16_t n) {
+  ShaperChain_beginBlock(chain);
+  ShaperChain_process(chain, values, n, fx_active[FX_BITCRUSH],
+                      fx_param[FX_BITCRUSH][0], fx_param[FX_BITCRUSH][1]);
+  ShaperChain_endBlock(chain);
+}
+
+void fill(int16_t *values, uint32_t *seed) {
+  // a loud sine with some noise on it
+  for (int i = 0; i < BLOCK; i++) {
+    *seed = *seed * 1664525 + 1013904223;
+    values[i] = (int16_t)(28000 * sin(i * 0.05) + (int16_t)(*seed >> 16) / 16);
+  }
+}
+
+double time_blocks(void (*fn)(int16_t *, uint16_t)) {
+  int16_t source[BLOCK];
+  int16_t values[BLOCK];
+  uint32_t seed = 1234;
+  int64_t check = 0;
+  fill(source, &seed);
+  clock_t t0 = clock();
+  for (int b = 0; b < BLOCKS; b++) {
+    memcpy(values, source, sizeof(source));
+    fn(values, BLOCK);
+    check += values[b % BLOCK];
+  }
+  clock_t t1 = clock();
+  if (check == 1) {
+    printf("\n");
+  }
+  return (double)(t1 - t0) / CLOCKS_PER_SEC * 1e9 / BLOCKS;
+}
+
+void compare(const char *name) {
+  // settle the chain on the new settings (one block blends)
+  while (ShaperChain_update(chain, fx_active, fx_param)) {
+    int16_t tmp[BLOCK] = {0};
+    process_fused(tmp, BLOCK);
+  }
+  int16_t tmp[BLOCK] = {0};
+  process_fused(tmp, BLOCK);
+
+  int32_t max_err = 0;
+  int32_t over = 0;
+  double sum2 = 0;
+  uint32_t seed = 99;
+  for (int b = 0; b < 100; b++) {
+    int16_t a[BLOCK];
+    int16_t c[BLOCK];
+    fill(a, &seed);
+    memcpy(c, a, sizeof(a));
+    process_separate(a, BLOCK);
+    process_fused(c, BLOCK);
+    for (int i = 0; i < BLOCK; i++) {
+      int32_t e = abs(a[i] - c[i]);
+      if (e > max_err) {
+        max_err = e;
+      }
+      if (e > 64) {
+        over++;
+      }
+      sum2 += (double)e * e;
+    }
+  }
+  double rms = sqrt(sum2 / (100 * BLOCK));
+  // large errors only happen where the shaper switches curves at its
+  // threshold, which interpolation moves by up to one table segment
+  printf("%-28s max err %5d  rms %7.2f  >64: %5.2f%%  "
+         "ns/block %7.1f -> %7.1f\n",
+         name, max_err, rms, 100.0 * over / (100 * BLOCK),
+         time_blocks(process_separate), time_blocks(process_fused));
+}
+
+int main() {
+  chain = ShaperChain_malloc();
+  fx_param[FX_SATURATE][0] = 64;
+  fx_param[FX_SHAPER][0] = 250;
+  fx_param[FX_SHAPER][1] = 35;
+  fx_param[FX_FUZZ][0] = 245;
+  fx_param[FX_FUZZ][1] = 60;
+  fx_param[FX_BITCRUSH][0] = 218;
+  fx_param[FX_BITCRUSH][1] = 90;
+
+  compare("all off");
+  fx_active[FX_SATURATE] = true;
+  compare("saturate");
+  fx_active[FX_SATURATE] = false;
+  fx_active[FX_SHAPER] = true;
+  compare("shaper");
+  fx_param[FX_SHAPER][0] = 20;
+  compare("shaper (other mode)");
+  fx_active[FX_SHAPER] = false;
+  fx_active[FX_FUZZ] = true;
+  compare("fuzz");
+  fx_active[FX_SATURATE] = true;
+  fx_active[FX_SHAPER] = true;
+  compare("saturate+shaper+fuzz");
+  fx_active[FX_BITCRUSH] = true;
+  compare("saturate+shaper+fuzz+crush");
+
+  // the swap blends from the old curve to the new one over a block
+  fx_active[FX_SATURATE] = false;
+  fx_active[FX_SHAPER] = false;
+  fx_active[FX_FUZZ] = false;
+  fx_active[FX_BITCRUSH] = false;
+  ShaperChain_update(chain, fx_active, fx_param);
+  int16_t tmp[BLOCK];
+  process_fused(tmp, BLOCK);
+  fx_active[FX_FUZZ] = true;
+  ShaperChain_update(chain, fx_active, fx_param);
+  int16_t values[BLOCK];
+  for (int i = 0; i < BLOCK; i++) {
+    values[i] = 4000;
+  }
+  process_fused(values, BLOCK);
+  printf("blend into fuzz: %d %d %d %d\n", values[0], values[BLOCK / 4],
+         values[BLOCK / 2], values[BLOCK - 1]);
+  ShaperChain_free(chain);
+  return 0;
+}
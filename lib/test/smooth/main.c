@@ -0,0 +1,98 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// checks the parameter glide: each block starts where the last ended, a
+// change closes its share of the distance each block and lands on the
+// target, and the per-sample steps add up to the block.
+//
+// gcc -O2 -o main main.c -lm && ./main
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../smooth.h"
+#include "../check.h"
+
+#define BLOCK 441
+
+int main() {
+  Smooth s;
+
+  // at rest it does not move
+  Smooth_init(&s, 1000 << 16, 3);
+  Smooth_beginBlock(&s, BLOCK);
+  check("rest", !Smooth_moving(&s) && Smooth_at(&s, BLOCK) == 1000 << 16);
+
+  // a change closes an eighth of the distance each block, continuing from
+  // where the last block ended, and lands on the target
+  Smooth_set(&s, 2000 << 16);
+  int blocks = 0;
+  bool joined = true;
+  bool share = true;
+  while (s.end != 2000 << 16 && blocks < 1000) {
+    int32_t end = s.end;
+    int32_t eighth = ((2000 << 16) - end) / 8;
+    Smooth_beginBlock(&s, BLOCK);
+    if (Smooth_moving(&s)) {
+      joined = joined && s.value == end;
+      int32_t moved = s.end - s.value;
+      // the last few blocks take what is left in one
+      share = share && ((moved <= eighth && moved > eighth - BLOCK) ||
+                        eighth < BLOCK);
+    } else {
+      joined = joined && abs(s.value - end) < BLOCK;
+    }
+    blocks++;
+  }
+  check("joined", joined);
+  check("share", share);
+  check("lands", s.end == 2000 << 16 && blocks > 1 && blocks < 200);
+
+  // the steps of a block add up to its end
+  Smooth_init(&s, 0, 0);
+  Smooth_set(&s, -(300 << 16));
+  Smooth_beginBlock(&s, BLOCK);
+  int32_t v = s.value;
+  for (int i = 0; i < BLOCK; i++) {
+    v += s.step;
+  }
+  check("steps", v == s.end && v == Smooth_at(&s, BLOCK));
+  check("shift 0", abs(s.end + (300 << 16)) < BLOCK);
+  Smooth_beginBlock(&s, BLOCK);
+  check("shift 0 lands", s.end == -(300 << 16) && !Smooth_moving(&s));
+
+  // closer than a step a sample is jumped, and an empty block is no step
+  Smooth_set(&s, s.end + 100);
+  Smooth_beginBlock(&s, BLOCK);
+  check("close", s.value == s.target && !Smooth_moving(&s));
+  Smooth_set(&s, 0);
+  Smooth_beginBlock(&s, 0);
+  check("empty", !Smooth_moving(&s) && s.end == -(300 << 16) + 100);
+  Smooth_jump(&s, 5);
+  Smooth_beginBlock(&s, BLOCK);
+  check("jump", s.value == 5 && s.end == 5);
+
+  return check_done();
+}
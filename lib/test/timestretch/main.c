@@ -0,0 +1,178 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// checks the time stretch on a sine: the position moves by the ratio, the
+// grains join without jumps, forwards and in reverse, and the window gives
+// the same audio as reading every grain in full, from fewer bytes.
+//
+// gcc -O2 -o main main.c -lm && ./main
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../timestretch.h"
+#include "../check.h"
+
+#define FILE_FRAMES 44100
+#define BLOCK 441
+#define BLOCKS 60
+// a period that does not divide the block
+#define PERIOD 100.3
+#define PERIOD_FRAMES 101
+
+int16_t file_mono[FILE_FRAMES];
+int16_t file_stereo[FILE_FRAMES * 2];
+int16_t out[BLOCKS * BLOCK];
+
+// what stretch saw: the largest step between two output frames of the left
+// channel, the lowest peak over a period (a grain joined out of phase dips
+// in level), how far the position moved and the bytes read
+int max_step;
+int level;
+int32_t moved;
+uint32_t bytes_read;
+
+// plays BLOCKS grains of n frames from inside the file into out, reading
+// through the window like the audio callback
+void stretch(TimeStretch *ts, uint16_t n, bool stereo, bool reverse) {
+  uint8_t channels = stereo ? 2 : 1;
+  uint8_t frame_bytes = channels * 2;
+  const uint8_t *file =
+      stereo ? (const uint8_t *)file_stereo : (const uint8_t *)file_mono;
+  int16_t values[(BLOCK + TIMESTRETCH_EXTRA) * 2];
+  int32_t pos = reverse ? FILE_FRAMES * 3 / 4 : FILE_FRAMES / 4;
+  int32_t start = pos;
+  int32_t last = 0;
+  int peak = 0;
+  int frames = 0;
+  max_step = 0;
+  level = 32767;
+  bytes_read = 0;
+  TimeStretch_reset(ts);
+  for (int b = 0; b < BLOCKS; b++) {
+    int32_t read_phase;
+    uint32_t read_len;
+    int16_t *read_to;
+    int16_t *buffer = TimeStretch_window(
+        ts, values, (pos - TIMESTRETCH_BEFORE(reverse)) * frame_bytes,
+        (n + TIMESTRETCH_EXTRA) * frame_bytes, &read_phase, &read_len,
+        &read_to);
+    memcpy(read_to, file + read_phase, read_len);
+    bytes_read += read_len;
+    int16_t *grain = TimeStretch_process(ts, buffer, values, n, stereo, reverse,
+                                         TIMESTRETCH_SEARCH);
+    for (int i = 0; i < n; i++) {
+      int32_t v = grain[(reverse ? n - 1 - i : i) * channels];
+      out[b * n + i] = v;
+      if (b > 0 || i > 0) {
+        int step = abs(v - last);
+        if (step > max_step) {
+          max_step = step;
+        }
+      }
+      last = v;
+      if (abs(v) > peak) {
+        peak = abs(v);
+      }
+      if (++frames == PERIOD_FRAMES) {
+        if (peak < level) {
+          level = peak;
+        }
+        peak = 0;
+        frames = 0;
+      }
+    }
+    int32_t advance = TimeStretch_advance(ts, n);
+    pos += reverse ? -advance : advance;
+  }
+  moved = abs(pos - start);
+}
+
+int main() {
+  int max_slope = (int)ceil(16000 * 2 * M_PI / PERIOD);
+  for (int i = 0; i < FILE_FRAMES; i++) {
+    int16_t v = (int16_t)(16000 * sin(2 * M_PI * i / PERIOD));
+    file_mono[i] = v;
+    file_stereo[i * 2] = v;
+    file_stereo[i * 2 + 1] = -v;
+  }
+
+  FxPool *pool = FxPool_malloc(FXPOOL_SIZE);
+  TimeStretch *ts = TimeStretch_malloc(pool);
+  static int16_t full[BLOCKS * BLOCK];
+  char name[64];
+  for (uint8_t stereo = 0; stereo < 2; stereo++) {
+    for (uint8_t reverse = 0; reverse < 2; reverse++) {
+      TimeStretch_setRatio(ts, 0);
+      stretch(ts, BLOCK, stereo, reverse);
+      sprintf(name, "1/8 stereo=%d reverse=%d jumps", stereo, reverse);
+      check_int(name, max_step > max_slope * 5 / 4, 0);
+      sprintf(name, "1/8 stereo=%d reverse=%d level", stereo, reverse);
+      check_int(name, level < 15000, 0);
+      sprintf(name, "1/8 stereo=%d reverse=%d moved", stereo, reverse);
+      check_int(name, moved, BLOCK * BLOCKS / 8);
+      memcpy(full, out, sizeof(out));
+      uint32_t full_bytes = bytes_read;
+
+      // the same through the window, reading a little over what it moved
+      TimeStretch_setActive(ts, true);
+      TimeStretch_setRatio(ts, 0);
+      stretch(ts, BLOCK, stereo, reverse);
+      sprintf(name, "1/8 stereo=%d reverse=%d window", stereo, reverse);
+      check_int(name, memcmp(full, out, sizeof(out)), 0);
+      sprintf(name, "1/8 stereo=%d reverse=%d window bytes", stereo, reverse);
+      check_int(name,
+                bytes_read > full_bytes / BLOCKS + moved * (stereo + 1) * 2, 0);
+      TimeStretch_setActive(ts, false);
+    }
+  }
+
+  // the original tempo moves with the grains, and a short grain (low pitch)
+  // shrinks the overlap to fit
+  TimeStretch_setRatio(ts, 255);
+  stretch(ts, BLOCK, true, false);
+  check_int("1/1 jumps", max_step > max_slope * 5 / 4, 0);
+  check_int("1/1 level", level < 15000, 0);
+  check_int("1/1 moved", moved, BLOCK * BLOCKS);
+  TimeStretch_setRatio(ts, 128);
+  stretch(ts, 100, true, false);
+  check_int("short grain jumps", max_step > max_slope * 5 / 4, 0);
+  check_int("short grain level", level < 15000, 0);
+
+  // switching off gives the window back
+  TimeStretch_setActive(ts, true);
+  check_int("window taken", ts->window != NULL, 1);
+  TimeStretch_setActive(ts, false);
+  check_int("window released", ts->window == NULL, 1);
+  check_int("pool empty", FxPool_alloc(pool, FXPOOL_SIZE, FXPOOL_SIZE,
+                                       &(uint32_t){0}) != NULL,
+            1);
+  TimeStretch_free(ts);
+  FxPool_free(pool);
+
+  return check_done();
+}
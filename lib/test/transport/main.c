@@ -0,0 +1,162 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// jitter harness for the beat clock. runs ten minutes of ticks with a tempo
+// change after one minute and compares when each tick takes effect in the
+// audio against the ideal tick time, for
+//
+//   timer:     the old hardware timer (period round(30000000 / bpm / 96) us,
+//              re-armed on the first tick after a tempo change), taking
+//              effect at the next block start
+//   transport: the sample-counting transport, taking effect at its sample
+//              offset in the block
+//
+// gcc -O2 -o main main.c -lm && ./main
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../transport.h"
+
+#define SAMPLE_RATE 44100
+#define BLOCK 441
+#define SECONDS 600
+#define CHANGE_SECONDS 60
+#define BPM_START 120
+#define BPM_CHANGE 133
+
+typedef struct Stats {
+  double max;
+  double sum;
+  double sum2;
+  double last;
+  uint32_t count;
+} Stats;
+
+void Stats_add(Stats *s, double error_us) {
+  if (fabs(error_us) > s->max) {
+    s->max = fabs(error_us);
+  }
+  s->sum += error_us;
+  s->sum2 += error_us * error_us;
+  s->last = error_us;
+  s->count++;
+}
+
+void Stats_print(const char *name, Stats *s) {
+  double mean = s->sum / s->count;
+  printf("%-10s %7d ticks  mean %9.1f us  sd %8.1f us  max %9.1f us  "
+         "last %9.1f us\n",
+         name, s->count, mean, sqrt(fmax(0, s->sum2 / s->count - mean * mean)),
+         s->max, s->last);
+}
+
+// time of tick k (counted from 1) in us, tempo changes at CHANGE_SECONDS
+double ideal_us(uint32_t k) {
+  double rate0 = BPM_START * 192.0 / 60.0;
+  double rate1 = BPM_CHANGE * 192.0 / 60.0;
+  double ticks0 = rate0 * CHANGE_SECONDS;
+  if (k <= ticks0) {
+    return k / rate0 * 1e6;
+  }
+  return (CHANGE_SECONDS + (k - ticks0) / rate1) * 1e6;
+}
+
+uint64_t block_start;
+Stats transport_stats;
+uint32_t transport_ticks = 0;
+
+void tick(uint16_t offset) {
+  transport_ticks++;
+  // the tick is heard on the sample it lands on; the ideal tick is heard on
+  // the first sample at or after its time
+  double heard = (block_start + offset) * 1e6 / SAMPLE_RATE;
+  double ideal =
+      ceil(ideal_us(transport_ticks) * SAMPLE_RATE / 1e6 - 1e-6) * 1e6 /
+      SAMPLE_RATE;
+  Stats_add(&transport_stats, heard - ideal);
+}
+
+int main() {
+  double block_us = BLOCK * 1e6 / SAMPLE_RATE;
+
+  // the old timer
+  Stats timer_fire = {0};
+  Stats timer_heard = {0};
+  uint16_t bpm = BPM_START;
+  uint16_t bpm_last = bpm;
+  double period = round(30000000 / bpm / 96);
+  double fire = 0;
+  for (uint32_t k = 1;; k++) {
+    fire += period;
+    if (fire > SECONDS * 1e6) {
+      break;
+    }
+    if (fire >= CHANGE_SECONDS * 1e6) {
+      bpm = BPM_CHANGE;
+    }
+    if (bpm != bpm_last) {
+      // the callback notices the new tempo and re-arms from now
+      bpm_last = bpm;
+      period = round(30000000 / bpm / 96);
+    }
+    Stats_add(&timer_fire, fire - ideal_us(k));
+    Stats_add(&timer_heard, ceil(fire / block_us) * block_us - ideal_us(k));
+  }
+
+  // the transport
+  Transport *transport = Transport_malloc(SAMPLE_RATE, tick);
+  for (block_start = 0; block_start < (uint64_t)SECONDS * SAMPLE_RATE;
+       block_start += BLOCK) {
+    Transport_setTempo(transport, block_start < CHANGE_SECONDS * SAMPLE_RATE
+                                      ? BPM_START
+                                      : BPM_CHANGE);
+    Transport_process(transport, BLOCK);
+  }
+
+  printf("%d s at %d bpm then %d bpm, %d sample blocks\n", SECONDS, BPM_START,
+         BPM_CHANGE, BLOCK);
+  Stats_print("timer", &timer_fire);
+  Stats_print("timer+blk", &timer_heard);
+  Stats_print("transport", &transport_stats);
+
+  Transport_free(transport);
+  // every tick is heard on exactly the sample it should be
+  if (transport_stats.max > 1e-3) {
+    printf("FAIL transport jitter\n");
+    return 1;
+  }
+  uint32_t ideal_ticks = 0;
+  while (ideal_us(ideal_ticks + 1) < SECONDS * 1e6 - 1e-3) {
+    ideal_ticks++;
+  }
+  if (transport_ticks != ideal_ticks) {
+    printf("FAIL tick count %d vs %d\n", transport_ticks, ideal_ticks);
+    return 1;
+  }
+  printf("ok\n");
+  return 0;
+}
@@ -32,6 +32,7 @@
 #define FREQUENCY 440
 #define DURATION 8
 
+// needs lib/crossfade3.h (make lib/crossfade3.h in the root)
 #include "../../wavetablebass.h"
 
 void write_wav_header(FILE *file, int num_samples) {
@@ -63,6 +64,20 @@ void write_wav_header(FILE *file, int num_samples) {
   fwrite(&subchunk2_size, 4, 1, file);
 }
 
+// renders n samples a block at a time, keeping the left channel
+void render(WaveBass *wavebass, int32_t *out, int64_t *j, int n) {
+  int32_t block[441 * 2];
+  for (int i = 0; i < n; i += 441) {
+    memset(block, 0, sizeof(block));
+    WaveBass_render(wavebass, block, 441);
+    for (int k = 0; k < 441; k++) {
+      out[*j] = block[k * 2];
+      printf("%d\n", out[*j]);
+      (*j)++;
+    }
+  }
+}
+
 int main() {
   int num_samples = DURATION * SAMPLE_RATE;
   int32_t *sine_wave = malloc((44100 * 30) * sizeof(int32_t));
@@ -70,23 +85,11 @@ int main() {
 
   WaveBass *wavebass = WaveBass_malloc();
   WaveBass_note_on(wavebass, 0);
-  for (int i = 0; i < 44100 * 4; i++) {
-    sine_wave[j] = WaveBass_next(wavebass);
-    printf("%d\n", sine_wave[j]);
-    j++;
-  }
+  render(wavebass, sine_wave, &j, 44100 * 4);
   WaveBass_note_on(wavebass, 5);
-  for (int i = 0; i < 44100 * 1; i++) {
-    sine_wave[j] = WaveBass_next(wavebass);
-    printf("%d\n", sine_wave[j]);
-    j++;
-  }
+  render(wavebass, sine_wave, &j, 44100 * 1);
   WaveBass_release(wavebass);
-  for (int i = 0; i < 44100 * 2; i++) {
-    sine_wave[j] = WaveBass_next(wavebass);
-    printf("%d\n", sine_wave[j]);
-    j++;
-  }
+  render(wavebass, sine_wave, &j, 44100 * 2);
 
   WaveBass_free(wavebass);
 
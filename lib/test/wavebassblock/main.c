@@ -0,0 +1,171 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+// checks the block bass: the partials at their pitches and levels, blocks
+// that join without steps through attacks, fast retriggers and releases,
+// and every voice back to rest after the release.
+//
+// needs lib/crossfade3.h (make lib/crossfade3.h in the root)
+// gcc -O2 -o main main.c -lm && ./main
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../wavetablebass.h"
+#include "../check.h"
+
+#define BLOCK 441
+#define BLOCKS 400
+
+int32_t out[BLOCKS * BLOCK];
+
+// renders blocks into out from block start, left channel only
+void render(WaveBass *bass, int start, int blocks) {
+  int32_t samples[BLOCK * 2];
+  for (int b = start; b < start + blocks; b++) {
+    memset(samples, 0, sizeof(samples));
+    WaveBass_render(bass, samples, BLOCK);
+    for (int i = 0; i < BLOCK; i++) {
+      check("channels match", samples[i * 2] == samples[i * 2 + 1]);
+      out[b * BLOCK + i] = samples[i * 2];
+    }
+  }
+}
+
+// the level of out at freq over n samples from start
+double level(int start, int n, double freq) {
+  double re = 0, im = 0;
+  for (int i = 0; i < n; i++) {
+    double w = 2 * M_PI * freq * i / 44100;
+    re += out[start + i] * cos(w);
+    im += out[start + i] * sin(w);
+  }
+  return 2 * sqrt(re * re + im * im) / n;
+}
+
+// the largest step between samples, against the most the partials can move
+// in a sample
+bool smooth(int from, int to, double freq) {
+  double slope = 0;
+  for (int p = 0; p < WAVEBASS_PARTIALS; p++) {
+    slope += (1073741823.0 / 3 / (1 << wavebass_partial_quiet[p])) * 2 * M_PI *
+             freq * pow(2, wavetablebass_harmonics[p] / 12.0) / 44100;
+  }
+  int64_t step_max = 0;
+  for (int i = from + 1; i < to; i++) {
+    int64_t step = llabs((int64_t)out[i] - out[i - 1]);
+    if (step > step_max) {
+      step_max = step;
+    }
+  }
+  return step_max < slope * 1.1;
+}
+
+bool at_rest(WaveBass *bass) {
+  for (int p = 0; p < WAVEBASS_PARTIALS; p++) {
+    for (int v = 0; v < WAVEBASS_VOICES; v++) {
+      if (bass->voice[p][v].stage != WAVEVOICE_OFF) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+int main() {
+  WaveBass *bass = WaveBass_malloc();
+  double f0 = 440.0 * pow(2, (5 + 24 - 69.0) / 12.0);
+
+  // a held note: the root, the octave at half and the twelfth at a quarter
+  WaveBass_note_on(bass, 5);
+  render(bass, 0, 200);
+  check("silent before", out[0] == 0);
+  check("attack smooth", smooth(0, 200 * BLOCK, f0));
+  double root = level(100 * BLOCK, 44100, f0);
+  double octave = level(100 * BLOCK, 44100, f0 * 2);
+  double twelfth = level(100 * BLOCK, 44100, f0 * pow(2, 19 / 12.0));
+  check("root level", fabs(root - 1073741823.0 / 3) < 1073741823.0 / 300);
+  check("octave level", fabs(octave / root - 0.5) < 0.01);
+  check("twelfth level", fabs(twelfth / root - 0.25) < 0.01);
+  check("nothing between", level(100 * BLOCK, 44100, f0 * 1.5) < root / 100);
+
+  // the release fades every voice out
+  WaveBass_release(bass);
+  render(bass, 200, 120);
+  check("release smooth", smooth(199 * BLOCK, 320 * BLOCK, f0));
+  check("release ends", out[320 * BLOCK - 1] == 0 && at_rest(bass));
+
+  // a release before the upper partials are in keeps them out
+  WaveBass_note_on(bass, 5);
+  render(bass, 0, 1);
+  WaveBass_release(bass);
+  render(bass, 1, 120);
+  check("early release", out[121 * BLOCK - 1] == 0 && at_rest(bass));
+
+  // a note and its release before the next block still sound, the release
+  // coming after
+  WaveBass_note_on(bass, 5);
+  WaveBass_release(bass);
+  render(bass, 0, 120);
+  check("tap sounds", level(0, 2 * BLOCK, f0) > root / 10);
+  check("tap ends", out[120 * BLOCK - 1] == 0 && at_rest(bass));
+
+  // a release and the next note before a block keep their order
+  WaveBass_note_on(bass, 5);
+  render(bass, 0, 10);
+  WaveBass_release(bass);
+  WaveBass_note_on(bass, 7);
+  render(bass, 10, 100);
+  check("note after release",
+        level(30 * BLOCK, 60 * BLOCK, f0 * pow(2, 2 / 12.0)) > root / 2);
+  WaveBass_release(bass);
+  render(bass, 110, 120);
+  check("note after release ends", at_rest(bass));
+
+  // notes faster than the partials come in or fade out
+  for (int b = 0; b < BLOCKS; b++) {
+    if (b % 3 == 0 && b < 200) {
+      WaveBass_note_on(bass, 1 + (b / 3) % 12);
+    }
+    if (b == 200) {
+      WaveBass_release(bass);
+    }
+    render(bass, b, 1);
+  }
+  check("retrigger smooth", smooth(0, BLOCKS * BLOCK, f0 * pow(2, 11 / 12.0)));
+  check("retrigger ends", at_rest(bass));
+
+  // a note above the tables only fades out what was playing
+  WaveBass_note_on(bass, 1);
+  render(bass, 0, 10);
+  WaveBass_note_on(bass, 40);
+  render(bass, 10, 200);
+  check("out of range fades", out[210 * BLOCK - 1] == 0 && at_rest(bass));
+
+  WaveBass_free(bass);
+  return check_done();
+}
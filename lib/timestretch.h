@@ -0,0 +1,291 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_TIMESTRETCH_H_
+#define LIB_TIMESTRETCH_H_
+
+#include "fxpool.h"
+#include "ramfunc.h"
+//
+#include "stdbool.h"
+
+// TimeStretch changes the tempo of the sample without changing its pitch
+// (wsola). every block plays a grain of the file as usual, but the position
+// in the file only moves on by the grain length times the ratio. to hide
+// the seam, each grain is shifted by up to TIMESTRETCH_SEARCH frames to
+// where it best matches the frames that would have followed the last grain,
+// and the first TIMESTRETCH_OVERLAP frames crossfade from those frames to
+// the grain.
+//
+// the caller reads TIMESTRETCH_BEFORE frames before the grain and
+// TIMESTRETCH_EXTRA frames more than it in all. the match is the smallest
+// sum of differences on the left channel. it is searched every
+// TIMESTRETCH_COARSE frames comparing every TIMESTRETCH_COARSE-th frame,
+// then around the best of those comparing every TIMESTRETCH_STRIDE-th, so
+// the work per block is bounded by the search and the overlap. slow ratios
+// cost the most, as the grain rarely lines up where it is;
+// host/bench_timestretch.c checks it.
+//
+// at slow ratios the frames read for one block are mostly the ones read for
+// the last, so while it is on the stretch keeps them in a window from the fx
+// pool and only the new part is read from the card. a grain bigger than the
+// window, or no window at all, reads everything into the caller's buffer.
+
+#define TIMESTRETCH_OVERLAP 128
+#define TIMESTRETCH_SEARCH 128
+#define TIMESTRETCH_COARSE 4
+#define TIMESTRETCH_STRIDE 2
+// the search either side, and the next tail after the grain, or before it
+// when reversed
+#define TIMESTRETCH_EXTRA (TIMESTRETCH_SEARCH * 2 + TIMESTRETCH_OVERLAP)
+#define TIMESTRETCH_BEFORE(reverse) \
+  (TIMESTRETCH_SEARCH + ((reverse) ? TIMESTRETCH_OVERLAP : 0))
+// 1/8 (q16), the slowest
+#define TIMESTRETCH_RATIO_MIN 8192
+#ifndef SAMPLES_PER_BUFFER
+#define SAMPLES_PER_BUFFER 441
+#endif
+// bytes, room for stereo grains of two blocks, or of one at the least
+#define TIMESTRETCH_WINDOW_SIZE \
+  ((SAMPLES_PER_BUFFER * 2 + TIMESTRETCH_EXTRA) * 2 * sizeof(int16_t))
+#define TIMESTRETCH_WINDOW_MIN \
+  ((SAMPLES_PER_BUFFER + TIMESTRETCH_EXTRA) * 2 * sizeof(int16_t))
+
+typedef struct TimeStretch {
+  FxPool *pool;
+  // the frames of the file from window_phase, NULL while off
+  int16_t *window;
+  uint32_t window_size;
+  int32_t window_phase;
+  uint32_t window_len;
+  // the frames that would have followed the last grain, in file order
+  int16_t tail[TIMESTRETCH_OVERLAP * 2];
+  uint16_t tail_len;
+  // q16, and the fraction of a frame the position is behind
+  uint32_t ratio;
+  uint32_t frac;
+} TimeStretch;
+
+TimeStretch *TimeStretch_malloc(FxPool *pool) {
+  TimeStretch *self = (TimeStretch *)malloc(sizeof(TimeStretch));
+  self->pool = pool;
+  self->window = NULL;
+  self->window_size = 0;
+  self->window_len = 0;
+  self->tail_len = 0;
+  self->ratio = TIMESTRETCH_RATIO_MIN;
+  self->frac = 0;
+  FxPool_register(pool, "timestretch", TIMESTRETCH_WINDOW_SIZE,
+                  TIMESTRETCH_WINDOW_MIN);
+  return self;
+}
+
+// forgets the last grain and the window, after a jump or a read error the
+// next grain starts clean
+void TimeStretch_reset(TimeStretch *self) {
+  self->tail_len = 0;
+  self->frac = 0;
+  self->window_len = 0;
+}
+
+// switching on takes a window from the pool, without one every grain is
+// read in full
+void TimeStretch_setActive(TimeStretch *self, bool on) {
+  if (on && self->window == NULL) {
+    self->window = (int16_t *)FxPool_alloc(self->pool, TIMESTRETCH_WINDOW_SIZE,
+                                           TIMESTRETCH_WINDOW_MIN,
+                                           &self->window_size);
+  } else if (!on && self->window != NULL) {
+    FxPool_release(self->pool, self->window);
+    self->window = NULL;
+  }
+  TimeStretch_reset(self);
+}
+
+void TimeStretch_free(TimeStretch *self) {
+  TimeStretch_setActive(self, false);
+  free(self);
+}
+
+// the grain needs len bytes of the file from phase. returns the buffer they
+// will be in, once the caller has read *read_len bytes from *read_phase into
+// *read_to. with a window the frames it already has are moved into place
+// and only the rest is read, otherwise it all goes into values.
+int16_t *TimeStretch_window(TimeStretch *self, int16_t *values, int32_t phase,
+                            uint32_t len, int32_t *read_phase,
+                            uint32_t *read_len, int16_t **read_to) {
+  if (self->window == NULL || len > self->window_size) {
+    self->window_len = 0;
+    *read_phase = phase;
+    *read_len = len;
+    *read_to = values;
+    return values;
+  }
+  int32_t end = phase + (int32_t)len;
+  int32_t cached = self->window_phase;
+  int32_t cached_end = cached + (int32_t)self->window_len;
+  uint8_t *window = (uint8_t *)self->window;
+  if (self->window_len > 0 && phase >= cached && phase < cached_end &&
+      end >= cached_end) {
+    // moved forwards, keep the end of the window
+    uint32_t keep = cached_end - phase;
+    memmove(window, window + (phase - cached), keep);
+    *read_phase = cached_end;
+    *read_len = len - keep;
+    *read_to = (int16_t *)(window + keep);
+  } else if (self->window_len > 0 && end > cached && end <= cached_end &&
+             phase <= cached) {
+    // moved backwards, keep the start of the window
+    uint32_t keep = end - cached;
+    memmove(window + (cached - phase), window, keep);
+    *read_phase = phase;
+    *read_len = len - keep;
+    *read_to = self->window;
+  } else {
+    *read_phase = phase;
+    *read_len = len;
+    *read_to = self->window;
+  }
+  self->window_phase = phase;
+  self->window_len = len;
+  return self->window;
+}
+
+// 0-255 goes from 1/8 to the original tempo
+void TimeStretch_setRatio(TimeStretch *self, uint8_t val) {
+  self->ratio = TIMESTRETCH_RATIO_MIN +
+                (uint32_t)val * (65536 - TIMESTRETCH_RATIO_MIN) / 255;
+}
+
+// frames to move the position by after a grain of n frames
+uint32_t TimeStretch_advance(TimeStretch *self, uint32_t n) {
+  uint32_t q = n * self->ratio + self->frac;
+  self->frac = q & 0xFFFF;
+  return q >> 16;
+}
+
+// sum of differences of the left channel every stride frames, stopping once
+// it passes best
+static inline uint32_t RAM_FUNC(TimeStretch_distance)(
+    const int16_t *a, const int16_t *b, uint16_t o, uint8_t channels,
+    uint8_t stride, uint32_t best) {
+  uint32_t sum = 0;
+  uint16_t step = stride * channels;
+  for (uint16_t i = 0; i < o * channels; i += step) {
+    int32_t d = a[i] - b[i];
+    sum += d < 0 ? -d : d;
+    if (sum >= best) {
+      break;
+    }
+  }
+  return sum;
+}
+
+// buffer holds TIMESTRETCH_BEFORE frames, the n frames of the grain and the
+// rest of the TIMESTRETCH_EXTRA frames. the grain is shifted by at most
+// search frames and faded in from the tail, and a pointer to its n frames
+// is returned. it is copied to out, as the window must keep the frames as
+// read, or faded in place when out is the buffer. reverse grains play from
+// the end, so they match and fade at the end and the tail is taken from
+// before them.
+int16_t *RAM_FUNC(TimeStretch_process)(TimeStretch *self, int16_t *buffer,
+                                       int16_t *out, uint16_t n, bool stereo,
+                                       bool reverse, uint16_t search) {
+  uint8_t channels = stereo ? 2 : 1;
+  if (search > TIMESTRETCH_SEARCH) {
+    search = TIMESTRETCH_SEARCH;
+  }
+  uint16_t o = self->tail_len < n ? self->tail_len : n;
+  // the overlap sits at the start of the grain, or the end when reversed
+  uint16_t ov = reverse ? n - o : 0;
+  // the tail frames next to the last grain
+  const int16_t *tail =
+      self->tail + (reverse ? self->tail_len - o : 0) * channels;
+  int16_t *base = buffer + TIMESTRETCH_BEFORE(reverse) * channels;
+
+  int16_t shift = 0;
+  if (o > 0) {
+    int16_t coarse = 0;
+    uint32_t best = TimeStretch_distance(tail, base + ov * channels, o,
+                                         channels, TIMESTRETCH_COARSE,
+                                         UINT32_MAX);
+    for (int16_t d = -(int16_t)search; d <= (int16_t)search;
+         d += TIMESTRETCH_COARSE) {
+      uint32_t dist = TimeStretch_distance(
+          tail, base + ((int32_t)ov + d) * channels, o, channels,
+          TIMESTRETCH_COARSE, best);
+      if (dist < best) {
+        best = dist;
+        coarse = d;
+      }
+    }
+    shift = coarse;
+    best = TimeStretch_distance(tail, base + ((int32_t)ov + coarse) * channels,
+                                o, channels, TIMESTRETCH_STRIDE, UINT32_MAX);
+    for (int16_t d = coarse - TIMESTRETCH_COARSE + 1;
+         d < coarse + TIMESTRETCH_COARSE; d++) {
+      if (d == coarse || d < -(int16_t)search || d > (int16_t)search) {
+        continue;
+      }
+      uint32_t dist = TimeStretch_distance(
+          tail, base + ((int32_t)ov + d) * channels, o, channels,
+          TIMESTRETCH_STRIDE, best);
+      if (dist < best) {
+        best = dist;
+        shift = d;
+      }
+    }
+  }
+  int16_t *grain = base + shift * channels;
+  if (out == buffer) {
+    out = grain;
+  } else {
+    memcpy(out, grain, n * channels * sizeof(int16_t));
+  }
+
+  // crossfade (q15) from the tail to the grain in playing order
+  if (o > 0) {
+    int32_t step = 32768 / (o + 1);
+    int16_t *p = out + ov * channels;
+    for (uint16_t i = 0; i < o; i++) {
+      int32_t w = (reverse ? o - i : i + 1) * step;
+      for (uint8_t c = 0; c < channels; c++) {
+        p[i * channels + c] =
+            (tail[i * channels + c] * (32768 - w) + p[i * channels + c] * w) >>
+            15;
+      }
+    }
+  }
+
+  // keep what would follow this grain for the next one
+  const int16_t *next = reverse ? grain - TIMESTRETCH_OVERLAP * channels
+                                : grain + n * channels;
+  for (uint16_t i = 0; i < TIMESTRETCH_OVERLAP * channels; i++) {
+    self->tail[i] = next[i];
+  }
+  self->tail_len = TIMESTRETCH_OVERLAP;
+  return out;
+}
+
+#endif
@@ -1,771 +1,73 @@
+#ifndef LIB_TRANSFER_SATURATE2
+#define LIB_TRANSFER_SATURATE2 1
 
-const int16_t transfer_doublesine_raw[] = {
-
-    0,     5,     9,     14,    19,    24,    28,    33,    38,    42,    47,
-    52,    57,    61,    66,    71,    75,    80,    85,    90,    94,    99,
-    104,   108,   113,   118,   123,   127,   132,   137,   141,   146,   151,
-    156,   160,   165,   170,   174,   179,   184,   188,   193,   198,   203,
-    207,   212,   217,   221,   226,   231,   236,   240,   245,   250,   254,
-    259,   264,   269,   273,   278,   283,   287,   292,   297,   302,   306,
-    311,   316,   320,   325,   330,   335,   339,   344,   349,   353,   358,
-    363,   368,   372,   377,   382,   386,   391,   396,   401,   405,   410,
-    415,   419,   424,   429,   434,   438,   443,   448,   452,   457,   462,
-    466,   471,   476,   481,   485,   490,   495,   499,   504,   509,   514,
-    518,   523,   528,   532,   537,   542,   547,   551,   556,   561,   565,
-    570,   575,   580,   584,   589,   594,   598,   603,   608,   613,   617,
-    622,   627,   631,   636,   641,   646,   650,   655,   660,   664,   669,
-    674,   678,   683,   688,   693,   697,   702,   707,   711,   716,   721,
-    726,   730,   735,   740,   744,   749,   754,   759,   763,   768,   773,
-    777,   782,   787,   792,   796,   801,   806,   810,   815,   820,   825,
-    829,   834,   839,   843,   848,   853,   857,   862,   867,   872,   876,
-    881,   886,   890,   895,   900,   905,   909,   914,   919,   923,   928,
-    933,   938,   942,   947,   952,   956,   961,   966,   970,   975,   980,
-    985,   989,   994,   999,   1003,  1008,  1013,  1018,  1022,  1027,  1032,
-    1036,  1041,  1046,  1051,  1055,  1060,  1065,  1069,  1074,  1079,  1083,
-    1088,  1093,  1098,  1102,  1107,  1112,  1116,  1121,  1126,  1131,  1135,
-    1140,  1145,  1149,  1154,  1159,  1164,  1168,  1173,  1178,  1182,  1187,
-    1192,  1196,  1201,  1206,  1211,  1215,  1220,  1225,  1229,  1234,  1239,
-    1244,  1248,  1253,  1258,  1262,  1267,  1272,  1276,  1281,  1286,  1291,
-    1295,  1300,  1305,  1309,  1314,  1319,  1324,  1328,  1333,  1338,  1342,
-    1347,  1352,  1356,  1361,  1366,  1371,  1375,  1380,  1385,  1389,  1394,
-    1399,  1404,  1408,  1413,  1418,  1422,  1427,  1432,  1436,  1441,  1446,
-    1451,  1455,  1460,  1465,  1469,  1474,  1479,  1484,  1488,  1493,  1498,
-    1502,  1507,  1512,  1516,  1521,  1526,  1531,  1535,  1540,  1545,  1549,
-    1554,  1559,  1563,  1568,  1573,  1578,  1582,  1587,  1592,  1596,  1601,
-    1606,  1610,  1615,  1620,  1625,  1629,  1634,  1639,  1643,  1648,  1653,
-    1658,  1662,  1667,  1672,  1676,  1681,  1686,  1690,  1695,  1700,  1705,
-    1709,  1714,  1719,  1723,  1728,  1733,  1737,  1742,  1747,  1752,  1756,
-    1761,  1766,  1770,  1775,  1780,  1784,  1789,  1794,  1799,  1803,  1808,
-    1813,  1817,  1822,  1827,  1831,  1836,  1841,  1846,  1850,  1855,  1860,
-    1864,  1869,  1874,  1878,  1883,  1888,  1893,  1897,  1902,  1907,  1911,
-    1916,  1921,  1925,  1930,  1935,  1939,  1944,  1949,  1954,  1958,  1963,
-    1968,  1972,  1977,  1982,  1986,  1991,  1996,  2001,  2005,  2010,  2015,
-    2019,  2024,  2029,  2033,  2038,  2043,  2048,  2052,  2057,  2062,  2066,
-    2071,  2076,  2080,  2085,  2090,  2094,  2099,  2104,  2109,  2113,  2118,
-    2123,  2127,  2132,  2137,  2141,  2146,  2151,  2156,  2160,  2165,  2170,
-    2174,  2179,  2184,  2188,  2193,  2198,  2202,  2207,  2212,  2217,  2221,
-    2226,  2231,  2235,  2240,  2245,  2249,  2254,  2259,  2263,  2268,  2273,
-    2278,  2282,  2287,  2292,  2296,  2301,  2306,  2310,  2315,  2320,  2324,
-    2329,  2334,  2339,  2343,  2348,  2353,  2357,  2362,  2367,  2371,  2376,
-    2381,  2385,  2390,  2395,  2399,  2404,  2409,  2414,  2418,  2423,  2428,
-    2432,  2437,  2442,  2446,  2451,  2456,  2460,  2465,  2470,  2475,  2479,
-    2484,  2489,  2493,  2498,  2503,  2507,  2512,  2517,  2521,  2526,  2531,
-    2535,  2540,  2545,  2550,  2554,  2559,  2564,  2568,  2573,  2578,  2582,
-    2587,  2592,  2596,  2601,  2606,  2610,  2615,  2620,  2624,  2629,  2634,
-    2639,  2643,  2648,  2653,  2657,  2662,  2667,  2671,  2676,  2681,  2685,
-    2690,  2695,  2699,  2704,  2709,  2714,  2718,  2723,  2728,  2732,  2737,
-    2742,  2746,  2751,  2756,  2760,  2765,  2770,  2774,  2779,  2784,  2788,
-    2793,  2798,  2802,  2807,  2812,  2817,  2821,  2826,  2831,  2835,  2840,
-    2845,  2849,  2854,  2859,  2863,  2868,  2873,  2877,  2882,  2887,  2891,
-    2896,  2901,  2905,  2910,  2915,  2919,  2924,  2929,  2934,  2938,  2943,
-    2948,  2952,  2957,  2962,  2966,  2971,  2976,  2980,  2985,  2990,  2994,
-    2999,  3004,  3008,  3013,  3018,  3022,  3027,  3032,  3036,  3041,  3046,
-    3050,  3055,  3060,  3064,  3069,  3074,  3079,  3083,  3088,  3093,  3097,
-    3102,  3107,  3111,  3116,  3121,  3125,  3130,  3135,  3139,  3144,  3149,
-    3153,  3158,  3163,  3167,  3172,  3177,  3181,  3186,  3191,  3195,  3200,
-    3205,  3209,  3214,  3219,  3223,  3228,  3233,  3237,  3242,  3247,  3251,
-    3256,  3261,  3265,  3270,  3275,  3279,  3284,  3289,  3293,  3298,  3303,
-    3307,  3312,  3317,  3321,  3326,  3331,  3335,  3340,  3345,  3349,  3354,
-    3359,  3363,  3368,  3373,  3377,  3382,  3387,  3391,  3396,  3401,  3405,
-    3410,  3415,  3419,  3424,  3429,  3433,  3438,  3443,  3447,  3452,  3457,
-    3461,  3466,  3471,  3475,  3480,  3485,  3489,  3494,  3499,  3503,  3508,
-    3513,  3517,  3522,  3527,  3531,  3536,  3541,  3545,  3550,  3555,  3559,
-    3564,  3569,  3573,  3578,  3583,  3587,  3592,  3597,  3601,  3606,  3611,
-    3615,  3620,  3625,  3629,  3634,  3639,  3643,  3648,  3653,  3657,  3662,
-    3667,  3671,  3676,  3681,  3685,  3690,  3695,  3699,  3704,  3709,  3713,
-    3718,  3723,  3727,  3732,  3737,  3741,  3746,  3750,  3755,  3760,  3764,
-    3769,  3774,  3778,  3783,  3788,  3792,  3797,  3802,  3806,  3811,  3816,
-    3820,  3825,  3830,  3834,  3839,  3844,  3848,  3853,  3858,  3862,  3867,
-    3872,  3876,  3881,  3885,  3890,  3895,  3899,  3904,  3909,  3913,  3918,
-    3923,  3927,  3932,  3937,  3941,  3946,  3951,  3955,  3960,  3965,  3969,
-    3974,  3979,  3983,  3988,  3992,  3997,  4002,  4006,  4011,  4016,  4020,
-    4025,  4030,  4034,  4039,  4044,  4048,  4053,  4058,  4062,  4067,  4071,
-    4076,  4081,  4085,  4090,  4095,  4099,  4104,  4109,  4113,  4118,  4123,
-    4127,  4132,  4137,  4141,  4146,  4150,  4155,  4160,  4164,  4169,  4174,
-    4178,  4183,  4188,  4192,  4197,  4202,  4206,  4211,  4215,  4220,  4225,
-    4229,  4234,  4239,  4243,  4248,  4253,  4257,  4262,  4267,  4271,  4276,
-    4280,  4285,  4290,  4294,  4299,  4304,  4308,  4313,  4318,  4322,  4327,
-    4332,  4336,  4341,  4345,  4350,  4355,  4359,  4364,  4369,  4373,  4378,
-    4383,  4387,  4392,  4396,  4401,  4406,  4410,  4415,  4420,  4424,  4429,
-    4434,  4438,  4443,  4447,  4452,  4457,  4461,  4466,  4471,  4475,  4480,
-    4484,  4489,  4494,  4498,  4503,  4508,  4512,  4517,  4522,  4526,  4531,
-    4535,  4540,  4545,  4549,  4554,  4559,  4563,  4568,  4572,  4577,  4582,
-    4586,  4591,  4596,  4600,  4605,  4610,  4614,  4619,  4623,  4628,  4633,
-    4637,  4642,  4647,  4651,  4656,  4660,  4665,  4670,  4674,  4679,  4684,
-    4688,  4693,  4697,  4702,  4707,  4711,  4716,  4721,  4725,  4730,  4734,
-    4739,  4744,  4748,  4753,  4758,  4762,  4767,  4771,  4776,  4781,  4785,
-    4790,  4795,  4799,  4804,  4808,  4813,  4818,  4822,  4827,  4832,  4836,
-    4841,  4845,  4850,  4855,  4859,  4864,  4868,  4873,  4878,  4882,  4887,
-    4892,  4896,  4901,  4905,  4910,  4915,  4919,  4924,  4928,  4933,  4938,
-    4942,  4947,  4952,  4956,  4961,  4965,  4970,  4975,  4979,  4984,  4988,
-    4993,  4998,  5002,  5007,  5012,  5016,  5021,  5025,  5030,  5035,  5039,
-    5044,  5048,  5053,  5058,  5062,  5067,  5072,  5076,  5081,  5085,  5090,
-    5095,  5099,  5104,  5108,  5113,  5118,  5122,  5127,  5131,  5136,  5141,
-    5145,  5150,  5154,  5159,  5164,  5168,  5173,  5178,  5182,  5187,  5191,
-    5196,  5201,  5205,  5210,  5214,  5219,  5224,  5228,  5233,  5237,  5242,
-    5247,  5251,  5256,  5260,  5265,  5270,  5274,  5279,  5283,  5288,  5293,
-    5297,  5302,  5306,  5311,  5316,  5320,  5325,  5329,  5334,  5339,  5343,
-    5348,  5352,  5357,  5362,  5366,  5371,  5375,  5380,  5385,  5389,  5394,
-    5398,  5403,  5408,  5412,  5417,  5421,  5426,  5431,  5435,  5440,  5444,
-    5449,  5454,  5458,  5463,  5467,  5472,  5477,  5481,  5486,  5490,  5495,
-    5500,  5504,  5509,  5513,  5518,  5522,  5527,  5532,  5536,  5541,  5545,
-    5550,  5555,  5559,  5564,  5568,  5573,  5578,  5582,  5587,  5591,  5596,
-    5601,  5605,  5610,  5614,  5619,  5623,  5628,  5633,  5637,  5642,  5646,
-    5651,  5656,  5660,  5665,  5669,  5674,  5678,  5683,  5688,  5692,  5697,
-    5701,  5706,  5711,  5715,  5720,  5724,  5729,  5733,  5738,  5743,  5747,
-    5752,  5756,  5761,  5766,  5770,  5775,  5779,  5784,  5788,  5793,  5798,
-    5802,  5807,  5811,  5816,  5821,  5825,  5830,  5834,  5839,  5843,  5848,
-    5853,  5857,  5862,  5866,  5871,  5875,  5880,  5885,  5889,  5894,  5898,
-    5903,  5907,  5912,  5917,  5921,  5926,  5930,  5935,  5939,  5944,  5949,
-    5953,  5958,  5962,  5967,  5971,  5976,  5981,  5985,  5990,  5994,  5999,
-    6003,  6008,  6013,  6017,  6022,  6026,  6031,  6035,  6040,  6045,  6049,
-    6054,  6058,  6063,  6067,  6072,  6077,  6081,  6086,  6090,  6095,  6099,
-    6104,  6109,  6113,  6118,  6122,  6127,  6131,  6136,  6140,  6145,  6150,
-    6154,  6159,  6163,  6168,  6172,  6177,  6182,  6186,  6191,  6195,  6200,
-    6204,  6209,  6213,  6218,  6223,  6227,  6232,  6236,  6241,  6245,  6250,
-    6254,  6259,  6264,  6268,  6273,  6277,  6282,  6286,  6291,  6295,  6300,
-    6305,  6309,  6314,  6318,  6323,  6327,  6332,  6336,  6341,  6346,  6350,
-    6355,  6359,  6364,  6368,  6373,  6377,  6382,  6387,  6391,  6396,  6400,
-    6405,  6409,  6414,  6418,  6423,  6427,  6432,  6437,  6441,  6446,  6450,
-    6455,  6459,  6464,  6468,  6473,  6477,  6482,  6487,  6491,  6496,  6500,
-    6505,  6509,  6514,  6518,  6523,  6527,  6532,  6537,  6541,  6546,  6550,
-    6555,  6559,  6564,  6568,  6573,  6577,  6582,  6587,  6591,  6596,  6600,
-    6605,  6609,  6614,  6618,  6623,  6627,  6632,  6636,  6641,  6646,  6650,
-    6655,  6659,  6664,  6668,  6673,  6677,  6682,  6686,  6691,  6695,  6700,
-    6704,  6709,  6714,  6718,  6723,  6727,  6732,  6736,  6741,  6745,  6750,
-    6754,  6759,  6763,  6768,  6772,  6777,  6782,  6786,  6791,  6795,  6800,
-    6804,  6809,  6813,  6818,  6822,  6827,  6831,  6836,  6840,  6845,  6849,
-    6854,  6858,  6863,  6868,  6872,  6877,  6881,  6886,  6890,  6895,  6899,
-    6904,  6908,  6913,  6917,  6922,  6926,  6931,  6935,  6940,  6944,  6949,
-    6953,  6958,  6962,  6967,  6972,  6976,  6981,  6985,  6990,  6994,  6999,
-    7003,  7008,  7012,  7017,  7021,  7026,  7030,  7035,  7039,  7044,  7048,
-    7053,  7057,  7062,  7066,  7071,  7075,  7080,  7084,  7089,  7093,  7098,
-    7102,  7107,  7111,  7116,  7121,  7125,  7130,  7134,  7139,  7143,  7148,
-    7152,  7157,  7161,  7166,  7170,  7175,  7179,  7184,  7188,  7193,  7197,
-    7202,  7206,  7211,  7215,  7220,  7224,  7229,  7233,  7238,  7242,  7247,
-    7251,  7256,  7260,  7265,  7269,  7274,  7278,  7283,  7287,  7292,  7296,
-    7301,  7305,  7310,  7314,  7319,  7323,  7328,  7332,  7337,  7341,  7346,
-    7350,  7355,  7359,  7364,  7368,  7373,  7377,  7382,  7386,  7391,  7395,
-    7400,  7404,  7409,  7413,  7418,  7422,  7427,  7431,  7436,  7440,  7445,
-    7449,  7454,  7458,  7463,  7467,  7471,  7476,  7480,  7485,  7489,  7494,
-    7498,  7503,  7507,  7512,  7516,  7521,  7525,  7530,  7534,  7539,  7543,
-    7548,  7552,  7557,  7561,  7566,  7570,  7575,  7579,  7584,  7588,  7593,
-    7597,  7602,  7606,  7611,  7615,  7619,  7624,  7628,  7633,  7637,  7642,
-    7646,  7651,  7655,  7660,  7664,  7669,  7673,  7678,  7682,  7687,  7691,
-    7696,  7700,  7705,  7709,  7714,  7718,  7722,  7727,  7731,  7736,  7740,
-    7745,  7749,  7754,  7758,  7763,  7767,  7772,  7776,  7781,  7785,  7790,
-    7794,  7798,  7803,  7807,  7812,  7816,  7821,  7825,  7830,  7834,  7839,
-    7843,  7848,  7852,  7857,  7861,  7865,  7870,  7874,  7879,  7883,  7888,
-    7892,  7897,  7901,  7906,  7910,  7915,  7919,  7923,  7928,  7932,  7937,
-    7941,  7946,  7950,  7955,  7959,  7964,  7968,  7973,  7977,  7981,  7986,
-    7990,  7995,  7999,  8004,  8008,  8013,  8017,  8022,  8026,  8030,  8035,
-    8039,  8044,  8048,  8053,  8057,  8062,  8066,  8071,  8075,  8079,  8084,
-    8088,  8093,  8097,  8102,  8106,  8111,  8115,  8119,  8124,  8128,  8133,
-    8137,  8142,  8146,  8151,  8155,  8159,  8164,  8168,  8173,  8177,  8182,
-    8186,  8191,  8195,  8199,  8204,  8208,  8213,  8217,  8222,  8226,  8231,
-    8235,  8239,  8244,  8248,  8253,  8257,  8262,  8266,  8271,  8275,  8279,
-    8284,  8288,  8293,  8297,  8302,  8306,  8310,  8315,  8319,  8324,  8328,
-    8333,  8337,  8341,  8346,  8350,  8355,  8359,  8364,  8368,  8373,  8377,
-    8381,  8386,  8390,  8395,  8399,  8404,  8408,  8412,  8417,  8421,  8426,
-    8430,  8434,  8439,  8443,  8448,  8452,  8457,  8461,  8465,  8470,  8474,
-    8479,  8483,  8488,  8492,  8496,  8501,  8505,  8510,  8514,  8519,  8523,
-    8527,  8532,  8536,  8541,  8545,  8549,  8554,  8558,  8563,  8567,  8572,
-    8576,  8580,  8585,  8589,  8594,  8598,  8602,  8607,  8611,  8616,  8620,
-    8625,  8629,  8633,  8638,  8642,  8647,  8651,  8655,  8660,  8664,  8669,
-    8673,  8677,  8682,  8686,  8691,  8695,  8700,  8704,  8708,  8713,  8717,
-    8722,  8726,  8730,  8735,  8739,  8744,  8748,  8752,  8757,  8761,  8766,
-    8770,  8774,  8779,  8783,  8788,  8792,  8796,  8801,  8805,  8810,  8814,
-    8818,  8823,  8827,  8832,  8836,  8840,  8845,  8849,  8854,  8858,  8862,
-    8867,  8871,  8876,  8880,  8884,  8889,  8893,  8898,  8902,  8906,  8911,
-    8915,  8919,  8924,  8928,  8933,  8937,  8941,  8946,  8950,  8955,  8959,
-    8963,  8968,  8972,  8977,  8981,  8985,  8990,  8994,  8998,  9003,  9007,
-    9012,  9016,  9020,  9025,  9029,  9034,  9038,  9042,  9047,  9051,  9055,
-    9060,  9064,  9069,  9073,  9077,  9082,  9086,  9090,  9095,  9099,  9104,
-    9108,  9112,  9117,  9121,  9125,  9130,  9134,  9139,  9143,  9147,  9152,
-    9156,  9160,  9165,  9169,  9174,  9178,  9182,  9187,  9191,  9195,  9200,
-    9204,  9209,  9213,  9217,  9222,  9226,  9230,  9235,  9239,  9243,  9248,
-    9252,  9257,  9261,  9265,  9270,  9274,  9278,  9283,  9287,  9292,  9296,
-    9300,  9305,  9309,  9313,  9318,  9322,  9326,  9331,  9335,  9339,  9344,
-    9348,  9353,  9357,  9361,  9366,  9370,  9374,  9379,  9383,  9387,  9392,
-    9396,  9400,  9405,  9409,  9414,  9418,  9422,  9427,  9431,  9435,  9440,
-    9444,  9448,  9453,  9457,  9461,  9466,  9470,  9474,  9479,  9483,  9487,
-    9492,  9496,  9501,  9505,  9509,  9514,  9518,  9522,  9527,  9531,  9535,
-    9540,  9544,  9548,  9553,  9557,  9561,  9566,  9570,  9574,  9579,  9583,
-    9587,  9592,  9596,  9600,  9605,  9609,  9613,  9618,  9622,  9626,  9631,
-    9635,  9639,  9644,  9648,  9652,  9657,  9661,  9665,  9670,  9674,  9678,
-    9683,  9687,  9691,  9696,  9700,  9704,  9709,  9713,  9717,  9722,  9726,
-    9730,  9735,  9739,  9743,  9748,  9752,  9756,  9761,  9765,  9769,  9774,
-    9778,  9782,  9787,  9791,  9795,  9800,  9804,  9808,  9813,  9817,  9821,
-    9825,  9830,  9834,  9838,  9843,  9847,  9851,  9856,  9860,  9864,  9869,
-    9873,  9877,  9882,  9886,  9890,  9895,  9899,  9903,  9907,  9912,  9916,
-    9920,  9925,  9929,  9933,  9938,  9942,  9946,  9951,  9955,  9959,  9964,
-    9968,  9972,  9976,  9981,  9985,  9989,  9994,  9998,  10002, 10007, 10011,
-    10015, 10019, 10024, 10028, 10032, 10037, 10041, 10045, 10050, 10054, 10058,
-    10062, 10067, 10071, 10075, 10080, 10084, 10088, 10093, 10097, 10101, 10105,
-    10110, 10114, 10118, 10123, 10127, 10131, 10136, 10140, 10144, 10148, 10153,
-    10157, 10161, 10166, 10170, 10174, 10178, 10183, 10187, 10191, 10196, 10200,
-    10204, 10208, 10213, 10217, 10221, 10226, 10230, 10234, 10238, 10243, 10247,
-    10251, 10256, 10260, 10264, 10268, 10273, 10277, 10281, 10286, 10290, 10294,
-    10298, 10303, 10307, 10311, 10315, 10320, 10324, 10328, 10333, 10337, 10341,
-    10345, 10350, 10354, 10358, 10363, 10367, 10371, 10375, 10380, 10384, 10388,
-    10392, 10397, 10401, 10405, 10409, 10414, 10418, 10422, 10427, 10431, 10435,
-    10439, 10444, 10448, 10452, 10456, 10461, 10465, 10469, 10473, 10478, 10482,
-    10486, 10491, 10495, 10499, 10503, 10508, 10512, 10516, 10520, 10525, 10529,
-    10533, 10537, 10542, 10546, 10550, 10554, 10559, 10563, 10567, 10571, 10576,
-    10580, 10584, 10588, 10593, 10597, 10601, 10605, 10610, 10614, 10618, 10622,
-    10627, 10631, 10635, 10639, 10644, 10648, 10652, 10656, 10661, 10665, 10669,
-    10673, 10678, 10682, 10686, 10690, 10695, 10699, 10703, 10707, 10712, 10716,
-    10720, 10724, 10729, 10733, 10737, 10741, 10746, 10750, 10754, 10758, 10762,
-    10767, 10771, 10775, 10779, 10784, 10788, 10792, 10796, 10801, 10805, 10809,
-    10813, 10818, 10822, 10826, 10830, 10834, 10839, 10843, 10847, 10851, 10856,
-    10860, 10864, 10868, 10872, 10877, 10881, 10885, 10889, 10894, 10898, 10902,
-    10906, 10910, 10915, 10919, 10923, 10927, 10932, 10936, 10940, 10944, 10948,
-    10953, 10957, 10961, 10965, 10970, 10974, 10978, 10982, 10986, 10991, 10995,
-    10999, 11003, 11008, 11012, 11016, 11020, 11024, 11029, 11033, 11037, 11041,
-    11045, 11050, 11054, 11058, 11062, 11066, 11071, 11075, 11079, 11083, 11087,
-    11092, 11096, 11100, 11104, 11109, 11113, 11117, 11121, 11125, 11130, 11134,
-    11138, 11142, 11146, 11151, 11155, 11159, 11163, 11167, 11172, 11176, 11180,
-    11184, 11188, 11192, 11197, 11201, 11205, 11209, 11213, 11218, 11222, 11226,
-    11230, 11234, 11239, 11243, 11247, 11251, 11255, 11260, 11264, 11268, 11272,
-    11276, 11281, 11285, 11289, 11293, 11297, 11301, 11306, 11310, 11314, 11318,
-    11322, 11327, 11331, 11335, 11339, 11343, 11347, 11352, 11356, 11360, 11364,
-    11368, 11373, 11377, 11381, 11385, 11389, 11393, 11398, 11402, 11406, 11410,
-    11414, 11418, 11423, 11427, 11431, 11435, 11439, 11443, 11448, 11452, 11456,
-    11460, 11464, 11468, 11473, 11477, 11481, 11485, 11489, 11493, 11498, 11502,
-    11506, 11510, 11514, 11518, 11523, 11527, 11531, 11535, 11539, 11543, 11548,
-    11552, 11556, 11560, 11564, 11568, 11573, 11577, 11581, 11585, 11589, 11593,
-    11597, 11602, 11606, 11610, 11614, 11618, 11622, 11627, 11631, 11635, 11639,
-    11643, 11647, 11651, 11656, 11660, 11664, 11668, 11672, 11676, 11680, 11685,
-    11689, 11693, 11697, 11701, 11705, 11710, 11714, 11718, 11722, 11726, 11730,
-    11734, 11738, 11743, 11747, 11751, 11755, 11759, 11763, 11767, 11772, 11776,
-    11780, 11784, 11788, 11792, 11796, 11801, 11805, 11809, 11813, 11817, 11821,
-    11825, 11829, 11834, 11838, 11842, 11846, 11850, 11854, 11858, 11863, 11867,
-    11871, 11875, 11879, 11883, 11887, 11891, 11896, 11900, 11904, 11908, 11912,
-    11916, 11920, 11924, 11928, 11933, 11937, 11941, 11945, 11949, 11953, 11957,
-    11961, 11966, 11970, 11974, 11978, 11982, 11986, 11990, 11994, 11998, 12003,
-    12007, 12011, 12015, 12019, 12023, 12027, 12031, 12035, 12040, 12044, 12048,
-    12052, 12056, 12060, 12064, 12068, 12072, 12077, 12081, 12085, 12089, 12093,
-    12097, 12101, 12105, 12109, 12113, 12118, 12122, 12126, 12130, 12134, 12138,
-    12142, 12146, 12150, 12154, 12159, 12163, 12167, 12171, 12175, 12179, 12183,
-    12187, 12191, 12195, 12199, 12204, 12208, 12212, 12216, 12220, 12224, 12228,
-    12232, 12236, 12240, 12244, 12248, 12253, 12257, 12261, 12265, 12269, 12273,
-    12277, 12281, 12285, 12289, 12293, 12297, 12302, 12306, 12310, 12314, 12318,
-    12322, 12326, 12330, 12334, 12338, 12342, 12346, 12350, 12355, 12359, 12363,
-    12367, 12371, 12375, 12379, 12383, 12387, 12391, 12395, 12399, 12403, 12407,
-    12412, 12416, 12420, 12424, 12428, 12432, 12436, 12440, 12444, 12448, 12452,
-    12456, 12460, 12464, 12468, 12473, 12477, 12481, 12485, 12489, 12493, 12497,
-    12501, 12505, 12509, 12513, 12517, 12521, 12525, 12529, 12533, 12537, 12541,
-    12546, 12550, 12554, 12558, 12562, 12566, 12570, 12574, 12578, 12582, 12586,
-    12590, 12594, 12598, 12602, 12606, 12610, 12614, 12618, 12622, 12626, 12631,
-    12635, 12639, 12643, 12647, 12651, 12655, 12659, 12663, 12667, 12671, 12675,
-    12679, 12683, 12687, 12691, 12695, 12699, 12703, 12707, 12711, 12715, 12719,
-    12723, 12727, 12731, 12735, 12739, 12744, 12748, 12752, 12756, 12760, 12764,
-    12768, 12772, 12776, 12780, 12784, 12788, 12792, 12796, 12800, 12804, 12808,
-    12812, 12816, 12820, 12824, 12828, 12832, 12836, 12840, 12844, 12848, 12852,
-    12856, 12860, 12864, 12868, 12872, 12876, 12880, 12884, 12888, 12892, 12896,
-    12900, 12904, 12908, 12912, 12916, 12920, 12924, 12928, 12932, 12936, 12940,
-    12944, 12948, 12952, 12956, 12960, 12964, 12968, 12972, 12976, 12980, 12984,
-    12988, 12992, 12996, 13000, 13004, 13008, 13012, 13016, 13020, 13024, 13028,
-    13032, 13036, 13040, 13044, 13048, 13052, 13056, 13060, 13064, 13068, 13072,
-    13076, 13080, 13084, 13088, 13092, 13096, 13100, 13104, 13108, 13112, 13116,
-    13120, 13124, 13128, 13132, 13136, 13140, 13144, 13148, 13152, 13156, 13160,
-    13164, 13168, 13172, 13176, 13180, 13184, 13188, 13192, 13196, 13200, 13204,
-    13208, 13212, 13216, 13220, 13224, 13228, 13232, 13236, 13239, 13243, 13247,
-    13251, 13255, 13259, 13263, 13267, 13271, 13275, 13279, 13283, 13287, 13291,
-    13295, 13299, 13303, 13307, 13311, 13315, 13319, 13323, 13327, 13331, 13335,
-    13339, 13343, 13347, 13350, 13354, 13358, 13362, 13366, 13370, 13374, 13378,
-    13382, 13386, 13390, 13394, 13398, 13402, 13406, 13410, 13414, 13418, 13422,
-    13426, 13429, 13433, 13437, 13441, 13445, 13449, 13453, 13457, 13461, 13465,
-    13469, 13473, 13477, 13481, 13485, 13489, 13493, 13497, 13500, 13504, 13508,
-    13512, 13516, 13520, 13524, 13528, 13532, 13536, 13540, 13544, 13548, 13552,
-    13556, 13559, 13563, 13567, 13571, 13575, 13579, 13583, 13587, 13591, 13595,
-    13599, 13603, 13607, 13611, 13614, 13618, 13622, 13626, 13630, 13634, 13638,
-    13642, 13646, 13650, 13654, 13658, 13661, 13665, 13669, 13673, 13677, 13681,
-    13685, 13689, 13693, 13697, 13701, 13705, 13708, 13712, 13716, 13720, 13724,
-    13728, 13732, 13736, 13740, 13744, 13748, 13751, 13755, 13759, 13763, 13767,
-    13771, 13775, 13779, 13783, 13787, 13790, 13794, 13798, 13802, 13806, 13810,
-    13814, 13818, 13822, 13826, 13829, 13833, 13837, 13841, 13845, 13849, 13853,
-    13857, 13861, 13864, 13868, 13872, 13876, 13880, 13884, 13888, 13892, 13896,
-    13899, 13903, 13907, 13911, 13915, 13919, 13923, 13927, 13931, 13934, 13938,
-    13942, 13946, 13950, 13954, 13958, 13962, 13965, 13969, 13973, 13977, 13981,
-    13985, 13989, 13993, 13996, 14000, 14004, 14008, 14012, 14016, 14020, 14024,
-    14027, 14031, 14035, 14039, 14043, 14047, 14051, 14055, 14058, 14062, 14066,
-    14070, 14074, 14078, 14082, 14085, 14089, 14093, 14097, 14101, 14105, 14109,
-    14112, 14116, 14120, 14124, 14128, 14132, 14136, 14139, 14143, 14147, 14151,
-    14155, 14159, 14163, 14166, 14170, 14174, 14178, 14182, 14186, 14190, 14193,
-    14197, 14201, 14205, 14209, 14213, 14216, 14220, 14224, 14228, 14232, 14236,
-    14239, 14243, 14247, 14251, 14255, 14259, 14263, 14266, 14270, 14274, 14278,
-    14282, 14286, 14289, 14293, 14297, 14301, 14305, 14309, 14312, 14316, 14320,
-    14324, 14328, 14332, 14335, 14339, 14343, 14347, 14351, 14354, 14358, 14362,
-    14366, 14370, 14374, 14377, 14381, 14385, 14389, 14393, 14397, 14400, 14404,
-    14408, 14412, 14416, 14419, 14423, 14427, 14431, 14435, 14438, 14442, 14446,
-    14450, 14454, 14458, 14461, 14465, 14469, 14473, 14477, 14480, 14484, 14488,
-    14492, 14496, 14499, 14503, 14507, 14511, 14515, 14518, 14522, 14526, 14530,
-    14534, 14537, 14541, 14545, 14549, 14553, 14556, 14560, 14564, 14568, 14572,
-    14575, 14579, 14583, 14587, 14591, 14594, 14598, 14602, 14606, 14610, 14613,
-    14617, 14621, 14625, 14628, 14632, 14636, 14640, 14644, 14647, 14651, 14655,
-    14659, 14663, 14666, 14670, 14674, 14678, 14681, 14685, 14689, 14693, 14697,
-    14700, 14704, 14708, 14712, 14715, 14719, 14723, 14727, 14731, 14734, 14738,
-    14742, 14746, 14749, 14753, 14757, 14761, 14764, 14768, 14772, 14776, 14780,
-    14783, 14787, 14791, 14795, 14798, 14802, 14806, 14810, 14813, 14817, 14821,
-    14825, 14828, 14832, 14836, 14840, 14843, 14847, 14851, 14855, 14858, 14862,
-    14866, 14870, 14873, 14877, 14881, 14885, 14888, 14892, 14896, 14900, 14903,
-    14907, 14911, 14915, 14918, 14922, 14926, 14930, 14933, 14937, 14941, 14945,
-    14948, 14952, 14956, 14960, 14963, 14967, 14971, 14975, 14978, 14982, 14986,
-    14989, 14993, 14997, 15001, 15004, 15008, 15012, 15016, 15019, 15023, 15027,
-    15031, 15034, 15038, 15042, 15045, 15049, 15053, 15057, 15060, 15064, 15068,
-    15072, 15075, 15079, 15083, 15086, 15090, 15094, 15098, 15101, 15105, 15109,
-    15112, 15116, 15120, 15124, 15127, 15131, 15135, 15138, 15142, 15146, 15150,
-    15153, 15157, 15161, 15164, 15168, 15172, 15176, 15179, 15183, 15187, 15190,
-    15194, 15198, 15201, 15205, 15209, 15213, 15216, 15220, 15224, 15227, 15231,
-    15235, 15238, 15242, 15246, 15250, 15253, 15257, 15261, 15264, 15268, 15272,
-    15275, 15279, 15283, 15286, 15290, 15294, 15298, 15301, 15305, 15309, 15312,
-    15316, 15320, 15323, 15327, 15331, 15334, 15338, 15342, 15345, 15349, 15353,
-    15356, 15360, 15364, 15368, 15371, 15375, 15379, 15382, 15386, 15390, 15393,
-    15397, 15401, 15404, 15408, 15412, 15415, 15419, 15423, 15426, 15430, 15434,
-    15437, 15441, 15445, 15448, 15452, 15456, 15459, 15463, 15467, 15470, 15474,
-    15478, 15481, 15485, 15489, 15492, 15496, 15500, 15503, 15507, 15510, 15514,
-    15518, 15521, 15525, 15529, 15532, 15536, 15540, 15543, 15547, 15551, 15554,
-    15558, 15562, 15565, 15569, 15573, 15576, 15580, 15583, 15587, 15591, 15594,
-    15598, 15602, 15605, 15609, 15613, 15616, 15620, 15624, 15627, 15631, 15634,
-    15638, 15642, 15645, 15649, 15653, 15656, 15660, 15664, 15667, 15671, 15674,
-    15678, 15682, 15685, 15689, 15693, 15696, 15700, 15703, 15707, 15711, 15714,
-    15718, 15722, 15725, 15729, 15732, 15736, 15740, 15743, 15747, 15750, 15754,
-    15758, 15761, 15765, 15769, 15772, 15776, 15779, 15783, 15787, 15790, 15794,
-    15797, 15801, 15805, 15808, 15812, 15816, 15819, 15823, 15826, 15830, 15834,
-    15837, 15841, 15844, 15848, 15852, 15855, 15859, 15862, 15866, 15870, 15873,
-    15877, 15880, 15884, 15888, 15891, 15895, 15898, 15902, 15905, 15909, 15913,
-    15916, 15920, 15923, 15927, 15931, 15934, 15938, 15941, 15945, 15949, 15952,
-    15956, 15959, 15963, 15966, 15970, 15974, 15977, 15981, 15984, 15988, 15992,
-    15995, 15999, 16002, 16006, 16009, 16013, 16017, 16020, 16024, 16027, 16031,
-    16034, 16038, 16042, 16045, 16049, 16052, 16056, 16059, 16063, 16067, 16070,
-    16074, 16077, 16081, 16084, 16088, 16092, 16095, 16099, 16102, 16106, 16109,
-    16113, 16116, 16120, 16124, 16127, 16131, 16134, 16138, 16141, 16145, 16148,
-    16152, 16156, 16159, 16163, 16166, 16170, 16173, 16177, 16180, 16184, 16187,
-    16191, 16195, 16198, 16202, 16205, 16209, 16212, 16216, 16219, 16223, 16226,
-    16230, 16233, 16237, 16241, 16244, 16248, 16251, 16255, 16258, 16262, 16265,
-    16269, 16272, 16276, 16279, 16283, 16286, 16290, 16294, 16297, 16301, 16304,
-    16308, 16311, 16315, 16318, 16322, 16325, 16329, 16332, 16336, 16339, 16343,
-    16346, 16350, 16353, 16357, 16360, 16364, 16368, 16371, 16375, 16378, 16382,
-    16385, 16389, 16392, 16396, 16399, 16403, 16406, 16410, 16413, 16417, 16420,
-    16424, 16427, 16431, 16434, 16438, 16441, 16445, 16448, 16452, 16455, 16459,
-    16462, 16466, 16469, 16473, 16476, 16480, 16483, 16487, 16490, 16494, 16497,
-    16501, 16504, 16508, 16511, 16515, 16518, 16522, 16525, 16529, 16532, 16536,
-    16539, 16543, 16546, 16549, 16553, 16556, 16560, 16563, 16567, 16570, 16574,
-    16577, 16581, 16584, 16588, 16591, 16595, 16598, 16602, 16605, 16609, 16612,
-    16616, 16619, 16623, 16626, 16629, 16633, 16636, 16640, 16643, 16647, 16650,
-    16654, 16657, 16661, 16664, 16668, 16671, 16674, 16678, 16681, 16685, 16688,
-    16692, 16695, 16699, 16702, 16706, 16709, 16713, 16716, 16719, 16723, 16726,
-    16730, 16733, 16737, 16740, 16744, 16747, 16751, 16754, 16757, 16761, 16764,
-    16768, 16771, 16775, 16778, 16782, 16785, 16788, 16792, 16795, 16799, 16802,
-    16806, 16809, 16812, 16816, 16819, 16823, 16826, 16830, 16833, 16837, 16840,
-    16843, 16847, 16850, 16854, 16857, 16861, 16864, 16867, 16871, 16874, 16878,
-    16881, 16885, 16888, 16891, 16895, 16898, 16902, 16905, 16908, 16912, 16915,
-    16919, 16922, 16926, 16929, 16932, 16936, 16939, 16943, 16946, 16949, 16953,
-    16956, 16960, 16963, 16967, 16970, 16973, 16977, 16980, 16984, 16987, 16990,
-    16994, 16997, 17001, 17004, 17007, 17011, 17014, 17018, 17021, 17024, 17028,
-    17031, 17035, 17038, 17041, 17045, 17048, 17052, 17055, 17058, 17062, 17065,
-    17069, 17072, 17075, 17079, 17082, 17085, 17089, 17092, 17096, 17099, 17102,
-    17106, 17109, 17113, 17116, 17119, 17123, 17126, 17129, 17133, 17136, 17140,
-    17143, 17146, 17150, 17153, 17156, 17160, 17163, 17167, 17170, 17173, 17177,
-    17180, 17183, 17187, 17190, 17194, 17197, 17200, 17204, 17207, 17210, 17214,
-    17217, 17220, 17224, 17227, 17231, 17234, 17237, 17241, 17244, 17247, 17251,
-    17254, 17257, 17261, 17264, 17267, 17271, 17274, 17277, 17281, 17284, 17288,
-    17291, 17294, 17298, 17301, 17304, 17308, 17311, 17314, 17318, 17321, 17324,
-    17328, 17331, 17334, 17338, 17341, 17344, 17348, 17351, 17354, 17358, 17361,
-    17364, 17368, 17371, 17374, 17378, 17381, 17384, 17388, 17391, 17394, 17398,
-    17401, 17404, 17408, 17411, 17414, 17418, 17421, 17424, 17428, 17431, 17434,
-    17438, 17441, 17444, 17448, 17451, 17454, 17458, 17461, 17464, 17467, 17471,
-    17474, 17477, 17481, 17484, 17487, 17491, 17494, 17497, 17501, 17504, 17507,
-    17511, 17514, 17517, 17520, 17524, 17527, 17530, 17534, 17537, 17540, 17544,
-    17547, 17550, 17553, 17557, 17560, 17563, 17567, 17570, 17573, 17577, 17580,
-    17583, 17586, 17590, 17593, 17596, 17600, 17603, 17606, 17609, 17613, 17616,
-    17619, 17623, 17626, 17629, 17632, 17636, 17639, 17642, 17646, 17649, 17652,
-    17655, 17659, 17662, 17665, 17668, 17672, 17675, 17678, 17682, 17685, 17688,
-    17691, 17695, 17698, 17701, 17704, 17708, 17711, 17714, 17718, 17721, 17724,
-    17727, 17731, 17734, 17737, 17740, 17744, 17747, 17750, 17753, 17757, 17760,
-    17763, 17766, 17770, 17773, 17776, 17779, 17783, 17786, 17789, 17792, 17796,
-    17799, 17802, 17805, 17809, 17812, 17815, 17818, 17822, 17825, 17828, 17831,
-    17835, 17838, 17841, 17844, 17848, 17851, 17854, 17857, 17861, 17864, 17867,
-    17870, 17874, 17877, 17880, 17883, 17886, 17890, 17893, 17896, 17899, 17903,
-    17906, 17909, 17912, 17916, 17919, 17922, 17925, 17928, 17932, 17935, 17938,
-    17941, 17945, 17948, 17951, 17954, 17957, 17961, 17964, 17967, 17970, 17973,
-    17977, 17980, 17983, 17986, 17990, 17993, 17996, 17999, 18002, 18006, 18009,
-    18012, 18015, 18018, 18022, 18025, 18028, 18031, 18034, 18038, 18041, 18044,
-    18047, 18050, 18054, 18057, 18060, 18063, 18066, 18070, 18073, 18076, 18079,
-    18082, 18086, 18089, 18092, 18095, 18098, 18101, 18105, 18108, 18111, 18114,
-    18117, 18121, 18124, 18127, 18130, 18133, 18137, 18140, 18143, 18146, 18149,
-    18152, 18156, 18159, 18162, 18165, 18168, 18171, 18175, 18178, 18181, 18184,
-    18187, 18190, 18194, 18197, 18200, 18203, 18206, 18209, 18213, 18216, 18219,
-    18222, 18225, 18228, 18232, 18235, 18238, 18241, 18244, 18247, 18251, 18254,
-    18257, 18260, 18263, 18266, 18269, 18273, 18276, 18279, 18282, 18285, 18288,
-    18292, 18295, 18298, 18301, 18304, 18307, 18310, 18314, 18317, 18320, 18323,
-    18326, 18329, 18332, 18336, 18339, 18342, 18345, 18348, 18351, 18354, 18357,
-    18361, 18364, 18367, 18370, 18373, 18376, 18379, 18383, 18386, 18389, 18392,
-    18395, 18398, 18401, 18404, 18408, 18411, 18414, 18417, 18420, 18423, 18426,
-    18429, 18432, 18436, 18439, 18442, 18445, 18448, 18451, 18454, 18457, 18460,
-    18464, 18467, 18470, 18473, 18476, 18479, 18482, 18485, 18488, 18492, 18495,
-    18498, 18501, 18504, 18507, 18510, 18513, 18516, 18519, 18523, 18526, 18529,
-    18532, 18535, 18538, 18541, 18544, 18547, 18550, 18554, 18557, 18560, 18563,
-    18566, 18569, 18572, 18575, 18578, 18581, 18584, 18587, 18591, 18594, 18597,
-    18600, 18603, 18606, 18609, 18612, 18615, 18618, 18621, 18624, 18627, 18631,
-    18634, 18637, 18640, 18643, 18646, 18649, 18652, 18655, 18658, 18661, 18664,
-    18667, 18670, 18674, 18677, 18680, 18683, 18686, 18689, 18692, 18695, 18698,
-    18701, 18704, 18707, 18710, 18713, 18716, 18719, 18722, 18725, 18729, 18732,
-    18735, 18738, 18741, 18744, 18747, 18750, 18753, 18756, 18759, 18762, 18765,
-    18768, 18771, 18774, 18777, 18780, 18783, 18786, 18789, 18792, 18795, 18799,
-    18802, 18805, 18808, 18811, 18814, 18817, 18820, 18823, 18826, 18829, 18832,
-    18835, 18838, 18841, 18844, 18847, 18850, 18853, 18856, 18859, 18862, 18865,
-    18868, 18871, 18874, 18877, 18880, 18883, 18886, 18889, 18892, 18895, 18898,
-    18901, 18904, 18907, 18910, 18913, 18916, 18919, 18922, 18925, 18928, 18931,
-    18934, 18937, 18940, 18943, 18946, 18949, 18952, 18955, 18958, 18961, 18964,
-    18967, 18970, 18973, 18976, 18979, 18982, 18985, 18988, 18991, 18994, 18997,
-    19000, 19003, 19006, 19009, 19012, 19015, 19018, 19021, 19024, 19027, 19030,
-    19033, 19036, 19039, 19042, 19045, 19048, 19051, 19054, 19057, 19060, 19063,
-    19066, 19069, 19072, 19075, 19078, 19081, 19084, 19087, 19090, 19093, 19096,
-    19099, 19102, 19105, 19107, 19110, 19113, 19116, 19119, 19122, 19125, 19128,
-    19131, 19134, 19137, 19140, 19143, 19146, 19149, 19152, 19155, 19158, 19161,
-    19164, 19167, 19170, 19173, 19175, 19178, 19181, 19184, 19187, 19190, 19193,
-    19196, 19199, 19202, 19205, 19208, 19211, 19214, 19217, 19220, 19223, 19225,
-    19228, 19231, 19234, 19237, 19240, 19243, 19246, 19249, 19252, 19255, 19258,
-    19261, 19264, 19266, 19269, 19272, 19275, 19278, 19281, 19284, 19287, 19290,
-    19293, 19296, 19299, 19302, 19304, 19307, 19310, 19313, 19316, 19319, 19322,
-    19325, 19328, 19331, 19334, 19336, 19339, 19342, 19345, 19348, 19351, 19354,
-    19357, 19360, 19363, 19366, 19368, 19371, 19374, 19377, 19380, 19383, 19386,
-    19389, 19392, 19395, 19397, 19400, 19403, 19406, 19409, 19412, 19415, 19418,
-    19421, 19423, 19426, 19429, 19432, 19435, 19438, 19441, 19444, 19446, 19449,
-    19452, 19455, 19458, 19461, 19464, 19467, 19470, 19472, 19475, 19478, 19481,
-    19484, 19487, 19490, 19492, 19495, 19498, 19501, 19504, 19507, 19510, 19513,
-    19515, 19518, 19521, 19524, 19527, 19530, 19533, 19535, 19538, 19541, 19544,
-    19547, 19550, 19553, 19555, 19558, 19561, 19564, 19567, 19570, 19573, 19575,
-    19578, 19581, 19584, 19587, 19590, 19592, 19595, 19598, 19601, 19604, 19607,
-    19610, 19612, 19615, 19618, 19621, 19624, 19627, 19629, 19632, 19635, 19638,
-    19641, 19644, 19646, 19649, 19652, 19655, 19658, 19661, 19663, 19666, 19669,
-    19672, 19675, 19678, 19680, 19683, 19686, 19689, 19692, 19694, 19697, 19700,
-    19703, 19706, 19709, 19711, 19714, 19717, 19720, 19723, 19725, 19728, 19731,
-    19734, 19737, 19739, 19742, 19745, 19748, 19751, 19753, 19756, 19759, 19762,
-    19765, 19767, 19770, 19773, 19776, 19779, 19781, 19784, 19787, 19790, 19793,
-    19795, 19798, 19801, 19804, 19807, 19809, 19812, 19815, 19818, 19821, 19823,
-    19826, 19829, 19832, 19834, 19837, 19840, 19843, 19846, 19848, 19851, 19854,
-    19857, 19859, 19862, 19865, 19868, 19871, 19873, 19876, 19879, 19882, 19884,
-    19887, 19890, 19893, 19895, 19898, 19901, 19904, 19907, 19909, 19912, 19915,
-    19918, 19920, 19923, 19926, 19929, 19931, 19934, 19937, 19940, 19942, 19945,
-    19948, 19951, 19953, 19956, 19959, 19962, 19964, 19967, 19970, 19973, 19975,
-    19978, 19981, 19984, 19986, 19989, 19992, 19995, 19997, 20000, 20003, 20006,
-    20008, 20011, 20014, 20017, 20019, 20022, 20025, 20027, 20030, 20033, 20036,
-    20038, 20041, 20044, 20047, 20049, 20052, 20055, 20057, 20060, 20063, 20066,
-    20068, 20071, 20074, 20076, 20079, 20082, 20085, 20087, 20090, 20093, 20095,
-    20098, 20101, 20104, 20106, 20109, 20112, 20114, 20117, 20120, 20123, 20125,
-    20128, 20131, 20133, 20136, 20139, 20141, 20144, 20147, 20150, 20152, 20155,
-    20158, 20160, 20163, 20166, 20168, 20171, 20174, 20177, 20179, 20182, 20185,
-    20187, 20190, 20193, 20195, 20198, 20201, 20203, 20206, 20209, 20211, 20214,
-    20217, 20219, 20222, 20225, 20228, 20230, 20233, 20236, 20238, 20241, 20244,
-    20246, 20249, 20252, 20254, 20257, 20260, 20262, 20265, 20268, 20270, 20273,
-    20276, 20278, 20281, 20284, 20286, 20289, 20292, 20294, 20297, 20299, 20302,
-    20305, 20307, 20310, 20313, 20315, 20318, 20321, 20323, 20326, 20329, 20331,
-    20334, 20337, 20339, 20342, 20345, 20347, 20350, 20352, 20355, 20358, 20360,
-    20363, 20366, 20368, 20371, 20374, 20376, 20379, 20381, 20384, 20387, 20389,
-    20392, 20395, 20397, 20400, 20403, 20405, 20408, 20410, 20413, 20416, 20418,
-    20421, 20424, 20426, 20429, 20431, 20434, 20437, 20439, 20442, 20444, 20447,
-    20450, 20452, 20455, 20458, 20460, 20463, 20465, 20468, 20471, 20473, 20476,
-    20478, 20481, 20484, 20486, 20489, 20491, 20494, 20497, 20499, 20502, 20504,
-    20507, 20510, 20512, 20515, 20517, 20520, 20523, 20525, 20528, 20530, 20533,
-    20536, 20538, 20541, 20543, 20546, 20548, 20551, 20554, 20556, 20559, 20561,
-    20564, 20567, 20569, 20572, 20574, 20577, 20579, 20582, 20585, 20587, 20590,
-    20592, 20595, 20597, 20600, 20603, 20605, 20608, 20610, 20613, 20615, 20618,
-    20621, 20623, 20626, 20628, 20631, 20633, 20636, 20638, 20641, 20644, 20646,
-    20649, 20651, 20654, 20656, 20659, 20661, 20664, 20667, 20669, 20672, 20674,
-    20677, 20679, 20682, 20684, 20687, 20689, 20692, 20695, 20697, 20700, 20702,
-    20705, 20707, 20710, 20712, 20715, 20717, 20720, 20722, 20725, 20728, 20730,
-    20733, 20735, 20738, 20740, 20743, 20745, 20748, 20750, 20753, 20755, 20758,
-    20760, 20763, 20765, 20768, 20770, 20773, 20775, 20778, 20781, 20783, 20786,
-    20788, 20791, 20793, 20796, 20798, 20801, 20803, 20806, 20808, 20811, 20813,
-    20816, 20818, 20821, 20823, 20826, 20828, 20831, 20833, 20836, 20838, 20841,
-    20843, 20846, 20848, 20851, 20853, 20856, 20858, 20861, 20863, 20866, 20868,
-    20871, 20873, 20876, 20878, 20881, 20883, 20886, 20888, 20890, 20893, 20895,
-    20898, 20900, 20903, 20905, 20908, 20910, 20913, 20915, 20918, 20920, 20923,
-    20925, 20928, 20930, 20933, 20935, 20937, 20940, 20942, 20945, 20947, 20950,
-    20952, 20955, 20957, 20960, 20962, 20965, 20967, 20969, 20972, 20974, 20977,
-    20979, 20982, 20984, 20987, 20989, 20992, 20994, 20996, 20999, 21001, 21004,
-    21006, 21009, 21011, 21014, 21016, 21018, 21021, 21023, 21026, 21028, 21031,
-    21033, 21036, 21038, 21040, 21043, 21045, 21048, 21050, 21053, 21055, 21057,
-    21060, 21062, 21065, 21067, 21070, 21072, 21074, 21077, 21079, 21082, 21084,
-    21087, 21089, 21091, 21094, 21096, 21099, 21101, 21103, 21106, 21108, 21111,
-    21113, 21116, 21118, 21120, 21123, 21125, 21128, 21130, 21132, 21135, 21137,
-    21140, 21142, 21144, 21147, 21149, 21152, 21154, 21156, 21159, 21161, 21164,
-    21166, 21168, 21171, 21173, 21176, 21178, 21180, 21183, 21185, 21188, 21190,
-    21192, 21195, 21197, 21199, 21202, 21204, 21207, 21209, 21211, 21214, 21216,
-    21218, 21221, 21223, 21226, 21228, 21230, 21233, 21235, 21237, 21240, 21242,
-    21245, 21247, 21249, 21252, 21254, 21256, 21259, 21261, 21264, 21266, 21268,
-    21271, 21273, 21275, 21278, 21280, 21282, 21285, 21287, 21289, 21292, 21294,
-    21297, 21299, 21301, 21304, 21306, 21308, 21311, 21313, 21315, 21318, 21320,
-    21322, 21325, 21327, 21329, 21332, 21334, 21336, 21339, 21341, 21343, 21346,
-    21348, 21350, 21353, 21355, 21357, 21360, 21362, 21364, 21367, 21369, 21371,
-    21374, 21376, 21378, 21381, 21383, 21385, 21388, 21390, 21392, 21395, 21397,
-    21399, 21402, 21404, 21406, 21408, 21411, 21413, 21415, 21418, 21420, 21422,
-    21425, 21427, 21429, 21432, 21434, 21436, 21439, 21441, 21443, 21445, 21448,
-    21450, 21452, 21455, 21457, 21459, 21462, 21464, 21466, 21468, 21471, 21473,
-    21475, 21478, 21480, 21482, 21484, 21487, 21489, 21491, 21494, 21496, 21498,
-    21500, 21503, 21505, 21507, 21510, 21512, 21514, 21516, 21519, 21521, 21523,
-    21525, 21528, 21530, 21532, 21535, 21537, 21539, 21541, 21544, 21546, 21548,
-    21550, 21553, 21555, 21557, 21559, 21562, 21564, 21566, 21569, 21571, 21573,
-    21575, 21578, 21580, 21582, 21584, 21587, 21589, 21591, 21593, 21596, 21598,
-    21600, 21602, 21605, 21607, 21609, 21611, 21614, 21616, 21618, 21620, 21623,
-    21625, 21627, 21629, 21631, 21634, 21636, 21638, 21640, 21643, 21645, 21647,
-    21649, 21652, 21654, 21656, 21658, 21660, 21663, 21665, 21667, 21669, 21672,
-    21674, 21676, 21678, 21680, 21683, 21685, 21687, 21689, 21692, 21694, 21696,
-    21698, 21700, 21703, 21705, 21707, 21709, 21711, 21714, 21716, 21718, 21720,
-    21722, 21725, 21727, 21729, 21731, 21734, 21736, 21738, 21740, 21742, 21744,
-    21747, 21749, 21751, 21753, 21755, 21758, 21760, 21762, 21764, 21766, 21769,
-    21771, 21773, 21775, 21777, 21780, 21782, 21784, 21786, 21788, 21790, 21793,
-    21795, 21797, 21799, 21801, 21803, 21806, 21808, 21810, 21812, 21814, 21817,
-    21819, 21821, 21823, 21825, 21827, 21830, 21832, 21834, 21836, 21838, 21840,
-    21842, 21845, 21847, 21849, 21851, 21853, 21855, 21858, 21860, 21862, 21864,
-    21866, 21868, 21870, 21873, 21875, 21877, 21879, 21881, 21883, 21886, 21888,
-    21890, 21892, 21894, 21896, 21898, 21901, 21903, 21905, 21907, 21909, 21911,
-    21913, 21915, 21918, 21920, 21922, 21924, 21926, 21928, 21930, 21932, 21935,
-    21937, 21939, 21941, 21943, 21945, 21947, 21949, 21952, 21954, 21956, 21958,
-    21960, 21962, 21964, 21966, 21969, 21971, 21973, 21975, 21977, 21979, 21981,
-    21983, 21985, 21987, 21990, 21992, 21994, 21996, 21998, 22000, 22002, 22004,
-    22006, 22008, 22011, 22013, 22015, 22017, 22019, 22021, 22023, 22025, 22027,
-    22029, 22032, 22034, 22036, 22038, 22040, 22042, 22044, 22046, 22048, 22050,
-    22052, 22054, 22057, 22059, 22061, 22063, 22065, 22067, 22069, 22071, 22073,
-    22075, 22077, 22079, 22081, 22083, 22086, 22088, 22090, 22092, 22094, 22096,
-    22098, 22100, 22102, 22104, 22106, 22108, 22110, 22112, 22114, 22116, 22118,
-    22121, 22123, 22125, 22127, 22129, 22131, 22133, 22135, 22137, 22139, 22141,
-    22143, 22145, 22147, 22149, 22151, 22153, 22155, 22157, 22159, 22161, 22163,
-    22166, 22168, 22170, 22172, 22174, 22176, 22178, 22180, 22182, 22184, 22186,
-    22188, 22190, 22192, 22194, 22196, 22198, 22200, 22202, 22204, 22206, 22208,
-    22210, 22212, 22214, 22216, 22218, 22220, 22222, 22224, 22226, 22228, 22230,
-    22232, 22234, 22236, 22238, 22240, 22242, 22244, 22246, 22248, 22250, 22252,
-    22254, 22256, 22258, 22260, 22262, 22264, 22266, 22268, 22270, 22272, 22274,
-    22276, 22278, 22280, 22282, 22284, 22286, 22288, 22290, 22292, 22294, 22296,
-    22298, 22300, 22302, 22304, 22306, 22308, 22310, 22312, 22314, 22316, 22318,
-    22320, 22322, 22324, 22326, 22328, 22330, 22332, 22334, 22336, 22337, 22339,
-    22341, 22343, 22345, 22347, 22349, 22351, 22353, 22355, 22357, 22359, 22361,
-    22363, 22365, 22367, 22369, 22371, 22373, 22375, 22377, 22379, 22381, 22382,
-    22384, 22386, 22388, 22390, 22392, 22394, 22396, 22398, 22400, 22402, 22404,
-    22406, 22408, 22410, 22412, 22413, 22415, 22417, 22419, 22421, 22423, 22425,
-    22427, 22429, 22431, 22433, 22435, 22437, 22439, 22440, 22442, 22444, 22446,
-    22448, 22450, 22452, 22454, 22456, 22458, 22460, 22462, 22463, 22465, 22467,
-    22469, 22471, 22473, 22475, 22477, 22479, 22481, 22483, 22484, 22486, 22488,
-    22490, 22492, 22494, 22496, 22498, 22500, 22502, 22503, 22505, 22507, 22509,
-    22511, 22513, 22515, 22517, 22519, 22520, 22522, 22524, 22526, 22528, 22530,
-    22532, 22534, 22535, 22537, 22539, 22541, 22543, 22545, 22547, 22549, 22551,
-    22552, 22554, 22556, 22558, 22560, 22562, 22564, 22565, 22567, 22569, 22571,
-    22573, 22575, 22577, 22579, 22580, 22582, 22584, 22586, 22588, 22590, 22592,
-    22593, 22595, 22597, 22599, 22601, 22603, 22604, 22606, 22608, 22610, 22612,
-    22614, 22616, 22617, 22619, 22621, 22623, 22625, 22627, 22628, 22630, 22632,
-    22634, 22636, 22638, 22639, 22641, 22643, 22645, 22647, 22649, 22650, 22652,
-    22654, 22656, 22658, 22660, 22661, 22663, 22665, 22667, 22669, 22670, 22672,
-    22674, 22676, 22678, 22680, 22681, 22683, 22685, 22687, 22689, 22690, 22692,
-    22694, 22696, 22698, 22699, 22701, 22703, 22705, 22707, 22709, 22710, 22712,
-    22714, 22716, 22718, 22719, 22721, 22723, 22725, 22726, 22728, 22730, 22732,
-    22734, 22735, 22737, 22739, 22741, 22743, 22744, 22746, 22748, 22750, 22752,
-    22753, 22755, 22757, 22759, 22760, 22762, 22764, 22766, 22768, 22769, 22771,
-    22773, 22775, 22776, 22778, 22780, 22782, 22783, 22785, 22787, 22789, 22790,
-    22792, 22794, 22796, 22798, 22799, 22801, 22803, 22805, 22806, 22808, 22810,
-    22812, 22813, 22815, 22817, 22819, 22820, 22822, 22824, 22826, 22827, 22829,
-    22831, 22833, 22834, 22836, 22838, 22840, 22841, 22843, 22845, 22846, 22848,
-    22850, 22852, 22853, 22855, 22857, 22859, 22860, 22862, 22864, 22866, 22867,
-    22869, 22871, 22872, 22874, 22876, 22878, 22879, 22881, 22883, 22884, 22886,
-    22888, 22890, 22891, 22893, 22895, 22896, 22898, 22900, 22902, 22903, 22905,
-    22907, 22908, 22910, 22912, 22914, 22915, 22917, 22919, 22920, 22922, 22924,
-    22925, 22927, 22929, 22931, 22932, 22934, 22936, 22937, 22939, 22941, 22942,
-    22944, 22946, 22947, 22949, 22951, 22953, 22954, 22956, 22958, 22959, 22961,
-    22963, 22964, 22966, 22968, 22969, 22971, 22973, 22974, 22976, 22978, 22979,
-    22981, 22983, 22984, 22986, 22988, 22989, 22991, 22993, 22994, 22996, 22998,
-    22999, 23001, 23003, 23004, 23006, 23008, 23009, 23011, 23013, 23014, 23016,
-    23018, 23019, 23021, 23022, 23024, 23026, 23027, 23029, 23031, 23032, 23034,
-    23036, 23037, 23039, 23041, 23042, 23044, 23045, 23047, 23049, 23050, 23052,
-    23054, 23055, 23057, 23059, 23060, 23062, 23063, 23065, 23067, 23068, 23070,
-    23072, 23073, 23075, 23076, 23078, 23080, 23081, 23083, 23085, 23086, 23088,
-    23089, 23091, 23093, 23094, 23096, 23097, 23099, 23101, 23102, 23104, 23105,
-    23107, 23109, 23110, 23112, 23113, 23115, 23117, 23118, 23120, 23121, 23123,
-    23125, 23126, 23128, 23129, 23131, 23133, 23134, 23136, 23137, 23139, 23141,
-    23142, 23144, 23145, 23147, 23148, 23150, 23152, 23153, 23155, 23156, 23158,
-    23160, 23161, 23163, 23164, 23166, 23167, 23169, 23171, 23172, 23174, 23175,
-    23177, 23178, 23180, 23182, 23183, 23185, 23186, 23188, 23189, 23191, 23192,
-    23194, 23196, 23197, 23199, 23200, 23202, 23203, 23205, 23206, 23208, 23210,
-    23211, 23213, 23214, 23216, 23217, 23219, 23220, 23222, 23223, 23225, 23227,
-    23228, 23230, 23231, 23233, 23234, 23236, 23237, 23239, 23240, 23242, 23243,
-    23245, 23246, 23248, 23250, 23251, 23253, 23254, 23256, 23257, 23259, 23260,
-    23262, 23263, 23265, 23266, 23268, 23269, 23271, 23272, 23274, 23275, 23277,
-    23278, 23280, 23281, 23283, 23284, 23286, 23287, 23289, 23290, 23292, 23293,
-    23295, 23296, 23298, 23299, 23301, 23302, 23304, 23305, 23307, 23308, 23310,
-    23311, 23313, 23314, 23316, 23317, 23319, 23320, 23322, 23323, 23325, 23326,
-    23328, 23329, 23331, 23332, 23334, 23335, 23337, 23338, 23340, 23341, 23343,
-    23344, 23346, 23347, 23348, 23350, 23351, 23353, 23354, 23356, 23357, 23359,
-    23360, 23362, 23363, 23365, 23366, 23367, 23369, 23370, 23372, 23373, 23375,
-    23376, 23378, 23379, 23381, 23382, 23383, 23385, 23386, 23388, 23389, 23391,
-    23392, 23394, 23395, 23397, 23398, 23399, 23401, 23402, 23404, 23405, 23407,
-    23408, 23409, 23411, 23412, 23414, 23415, 23417, 23418, 23419, 23421, 23422,
-    23424, 23425, 23427, 23428, 23429, 23431, 23432, 23434, 23435, 23437, 23438,
-    23439, 23441, 23442, 23444, 23445, 23446, 23448, 23449, 23451, 23452, 23453,
-    23455, 23456, 23458, 23459, 23461, 23462, 23463, 23465, 23466, 23468, 23469,
-    23470, 23472, 23473, 23475, 23476, 23477, 23479, 23480, 23481, 23483, 23484,
-    23486, 23487, 23488, 23490, 23491, 23493, 23494, 23495, 23497, 23498, 23499,
-    23501, 23502, 23504, 23505, 23506, 23508, 23509, 23510, 23512, 23513, 23515,
-    23516, 23517, 23519, 23520, 23521, 23523, 23524, 23526, 23527, 23528, 23530,
-    23531, 23532, 23534, 23535, 23536, 23538, 23539, 23540, 23542, 23543, 23545,
-    23546, 23547, 23549, 23550, 23551, 23553, 23554, 23555, 23557, 23558, 23559,
-    23561, 23562, 23563, 23565, 23566, 23567, 23569, 23570, 23571, 23573, 23574,
-    23575, 23577, 23578, 23579, 23581, 23582, 23583, 23585, 23586, 23587, 23589,
-    23590, 23591, 23593, 23594, 23595, 23597, 23598, 23599, 23600, 23602, 23603,
-    23604, 23606, 23607, 23608, 23610, 23611, 23612, 23614, 23615, 23616, 23617,
-    23619, 23620, 23621, 23623, 23624, 23625, 23627, 23628, 23629, 23630, 23632,
-    23633, 23634, 23636, 23637, 23638, 23639, 23641, 23642, 23643, 23645, 23646,
-    23647, 23648, 23650, 23651, 23652, 23654, 23655, 23656, 23657, 23659, 23660,
-    23661, 23663, 23664, 23665, 23666, 23668, 23669, 23670, 23671, 23673, 23674,
-    23675, 23676, 23678, 23679, 23680, 23682, 23683, 23684, 23685, 23687, 23688,
-    23689, 23690, 23692, 23693, 23694, 23695, 23697, 23698, 23699, 23700, 23702,
-    23703, 23704, 23705, 23707, 23708, 23709, 23710, 23711, 23713, 23714, 23715,
-    23716, 23718, 23719, 23720, 23721, 23723, 23724, 23725, 23726, 23728, 23729,
-    23730, 23731, 23732, 23734, 23735, 23736, 23737, 23739, 23740, 23741, 23742,
-    23743, 23745, 23746, 23747, 23748, 23749, 23751, 23752, 23753, 23754, 23756,
-    23757, 23758, 23759, 23760, 23762, 23763, 23764, 23765, 23766, 23768, 23769,
-    23770, 23771, 23772, 23774, 23775, 23776, 23777, 23778, 23779, 23781, 23782,
-    23783, 23784, 23785, 23787, 23788, 23789, 23790, 23791, 23793, 23794, 23795,
-    23796, 23797, 23798, 23800, 23801, 23802, 23803, 23804, 23805, 23807, 23808,
-    23809, 23810, 23811, 23812, 23814, 23815, 23816, 23817, 23818, 23819, 23821,
-    23822, 23823, 23824, 23825, 23826, 23828, 23829, 23830, 23831, 23832, 23833,
-    23834, 23836, 23837, 23838, 23839, 23840, 23841, 23842, 23844, 23845, 23846,
-    23847, 23848, 23849, 23850, 23852, 23853, 23854, 23855, 23856, 23857, 23858,
-    23859, 23861, 23862, 23863, 23864, 23865, 23866, 23867, 23868, 23870, 23871,
-    23872, 23873, 23874, 23875, 23876, 23877, 23879, 23880, 23881, 23882, 23883,
-    23884, 23885, 23886, 23887, 23889, 23890, 23891, 23892, 23893, 23894, 23895,
-    23896, 23897, 23898, 23900, 23901, 23902, 23903, 23904, 23905, 23906, 23907,
-    23908, 23909, 23910, 23912, 23913, 23914, 23915, 23916, 23917, 23918, 23919,
-    23920, 23921, 23922, 23923, 23925, 23926, 23927, 23928, 23929, 23930, 23931,
-    23932, 23933, 23934, 23935, 23936, 23937, 23938, 23940, 23941, 23942, 23943,
-    23944, 23945, 23946, 23947, 23948, 23949, 23950, 23951, 23952, 23953, 23954,
-    23955, 23956, 23958, 23959, 23960, 23961, 23962, 23963, 23964, 23965, 23966,
-    23967, 23968, 23969, 23970, 23971, 23972, 23973, 23974, 23975, 23976, 23977,
-    23978, 23979, 23980, 23981, 23982, 23983, 23985, 23986, 23987, 23988, 23989,
-    23990, 23991, 23992, 23993, 23994, 23995, 23996, 23997, 23998, 23999, 24000,
-    24001, 24002, 24003, 24004, 24005, 24006, 24007, 24008, 24009, 24010, 24011,
-    24012, 24013, 24014, 24015, 24016, 24017, 24018, 24019, 24020, 24021, 24022,
-    24023, 24024, 24025, 24026, 24027, 24028, 24029, 24030, 24031, 24032, 24033,
-    24034, 24035, 24036, 24037, 24038, 24039, 24040, 24041, 24042, 24043, 24044,
-    24045, 24046, 24047, 24047, 24048, 24049, 24050, 24051, 24052, 24053, 24054,
-    24055, 24056, 24057, 24058, 24059, 24060, 24061, 24062, 24063, 24064, 24065,
-    24066, 24067, 24068, 24069, 24070, 24071, 24071, 24072, 24073, 24074, 24075,
-    24076, 24077, 24078, 24079, 24080, 24081, 24082, 24083, 24084, 24085, 24086,
-    24087, 24087, 24088, 24089, 24090, 24091, 24092, 24093, 24094, 24095, 24096,
-    24097, 24098, 24099, 24100, 24100, 24101, 24102, 24103, 24104, 24105, 24106,
-    24107, 24108, 24109, 24110, 24111, 24111, 24112, 24113, 24114, 24115, 24116,
-    24117, 24118, 24119, 24120, 24121, 24121, 24122, 24123, 24124, 24125, 24126,
-    24127, 24128, 24129, 24130, 24130, 24131, 24132, 24133, 24134, 24135, 24136,
-    24137, 24138, 24138, 24139, 24140, 24141, 24142, 24143, 24144, 24145, 24145,
-    24146, 24147, 24148, 24149, 24150, 24151, 24152, 24152, 24153, 24154, 24155,
-    24156, 24157, 24158, 24159, 24159, 24160, 24161, 24162, 24163, 24164, 24165,
-    24165, 24166, 24167, 24168, 24169, 24170, 24171, 24171, 24172, 24173, 24174,
-    24175, 24176, 24176, 24177, 24178, 24179, 24180, 24181, 24182, 24182, 24183,
-    24184, 24185, 24186, 24187, 24187, 24188, 24189, 24190, 24191, 24192, 24192,
-    24193, 24194, 24195, 24196, 24197, 24197, 24198, 24199, 24200, 24201, 24201,
-    24202, 24203, 24204, 24205, 24206, 24206, 24207, 24208, 24209, 24210, 24210,
-    24211, 24212, 24213, 24214, 24214, 24215, 24216, 24217, 24218, 24218, 24219,
-    24220, 24221, 24222, 24222, 24223, 24224, 24225, 24226, 24226, 24227, 24228,
-    24229, 24230, 24230, 24231, 24232, 24233, 24233, 24234, 24235, 24236, 24237,
-    24237, 24238, 24239, 24240, 24240, 24241, 24242, 24243, 24244, 24244, 24245,
-    24246, 24247, 24247, 24248, 24249, 24250, 24250, 24251, 24252, 24253, 24254,
-    24254, 24255, 24256, 24257, 24257, 24258, 24259, 24260, 24260, 24261, 24262,
-    24263, 24263, 24264, 24265, 24266, 24266, 24267, 24268, 24269, 24269, 24270,
-    24271, 24272, 24272, 24273, 24274, 24274, 24275, 24276, 24277, 24277, 24278,
-    24279, 24280, 24280, 24281, 24282, 24283, 24283, 24284, 24285, 24285, 24286,
-    24287, 24288, 24288, 24289, 24290, 24290, 24291, 24292, 24293, 24293, 24294,
-    24295, 24295, 24296, 24297, 24298, 24298, 24299, 24300, 24300, 24301, 24302,
-    24302, 24303, 24304, 24305, 24305, 24306, 24307, 24307, 24308, 24309, 24309,
-    24310, 24311, 24311, 24312, 24313, 24314, 24314, 24315, 24316, 24316, 24317,
-    24318, 24318, 24319, 24320, 24320, 24321, 24322, 24322, 24323, 24324, 24324,
-    24325, 24326, 24326, 24327, 24328, 24328, 24329, 24330, 24330, 24331, 24332,
-    24332, 24333, 24334, 24334, 24335, 24336, 24336, 24337, 24338, 24338, 24339,
-    24340, 24340, 24341, 24342, 24342, 24343, 24344, 24344, 24345, 24345, 24346,
-    24347, 24347, 24348, 24349, 24349, 24350, 24351, 24351, 24352, 24352, 24353,
-    24354, 24354, 24355, 24356, 24356, 24357, 24357, 24358, 24359, 24359, 24360,
-    24361, 24361, 24362, 24362, 24363, 24364, 24364, 24365, 24366, 24366, 24367,
-    24367, 24368, 24369, 24369, 24370, 24370, 24371, 24372, 24372, 24373, 24373,
-    24374, 24375, 24375, 24376, 24376, 24377, 24378, 24378, 24379, 24379, 24380,
-    24381, 24381, 24382, 24382, 24383, 24384, 24384, 24385, 24385, 24386, 24387,
-    24387, 24388, 24388, 24389, 24389, 24390, 24391, 24391, 24392, 24392, 24393,
-    24393, 24394, 24395, 24395, 24396, 24396, 24397, 24397, 24398, 24399, 24399,
-    24400, 24400, 24401, 24401, 24402, 24402, 24403, 24404, 24404, 24405, 24405,
-    24406, 24406, 24407, 24407, 24408, 24409, 24409, 24410, 24410, 24411, 24411,
-    24412, 24412, 24413, 24413, 24414, 24415, 24415, 24416, 24416, 24417, 24417,
-    24418, 24418, 24419, 24419, 24420, 24420, 24421, 24421, 24422, 24423, 24423,
-    24424, 24424, 24425, 24425, 24426, 24426, 24427, 24427, 24428, 24428, 24429,
-    24429, 24430, 24430, 24431, 24431, 24432, 24432, 24433, 24433, 24434, 24434,
-    24435, 24435, 24436, 24436, 24437, 24437, 24438, 24438, 24439, 24439, 24440,
-    24440, 24441, 24441, 24442, 24442, 24443, 24443, 24444, 24444, 24445, 24445,
-    24446, 24446, 24447, 24447, 24448, 24448, 24449, 24449, 24450, 24450, 24450,
-    24451, 24451, 24452, 24452, 24453, 24453, 24454, 24454, 24455, 24455, 24456,
-    24456, 24457, 24457, 24457, 24458, 24458, 24459, 24459, 24460, 24460, 24461,
-    24461, 24462, 24462, 24462, 24463, 24463, 24464, 24464, 24465, 24465, 24466,
-    24466, 24467, 24467, 24467, 24468, 24468, 24469, 24469, 24470, 24470, 24470,
-    24471, 24471, 24472, 24472, 24473, 24473, 24473, 24474, 24474, 24475, 24475,
-    24476, 24476, 24476, 24477, 24477, 24478, 24478, 24479, 24479, 24479, 24480,
-    24480, 24481, 24481, 24481, 24482, 24482, 24483, 24483, 24484, 24484, 24484,
-    24485, 24485, 24486, 24486, 24486, 24487, 24487, 24488, 24488, 24488, 24489,
-    24489, 24490, 24490, 24490, 24491, 24491, 24491, 24492, 24492, 24493, 24493,
-    24493, 24494, 24494, 24495, 24495, 24495, 24496, 24496, 24496, 24497, 24497,
-    24498, 24498, 24498, 24499, 24499, 24499, 24500, 24500, 24501, 24501, 24501,
-    24502, 24502, 24502, 24503, 24503, 24503, 24504, 24504, 24505, 24505, 24505,
-    24506, 24506, 24506, 24507, 24507, 24507, 24508, 24508, 24508, 24509, 24509,
-    24509, 24510, 24510, 24510, 24511, 24511, 24511, 24512, 24512, 24513, 24513,
-    24513, 24514, 24514, 24514, 24515, 24515, 24515, 24515, 24516, 24516, 24516,
-    24517, 24517, 24517, 24518, 24518, 24518, 24519, 24519, 24519, 24520, 24520,
-    24520, 24521, 24521, 24521, 24522, 24522, 24522, 24523, 24523, 24523, 24523,
-    24524, 24524, 24524, 24525, 24525, 24525, 24526, 24526, 24526, 24526, 24527,
-    24527, 24527, 24528, 24528, 24528, 24528, 24529, 24529, 24529, 24530, 24530,
-    24530, 24531, 24531, 24531, 24531, 24532, 24532, 24532, 24532, 24533, 24533,
-    24533, 24534, 24534, 24534, 24534, 24535, 24535, 24535, 24535, 24536, 24536,
-    24536, 24537, 24537, 24537, 24537, 24538, 24538, 24538, 24538, 24539, 24539,
-    24539, 24539, 24540, 24540, 24540, 24540, 24541, 24541, 24541, 24541, 24542,
-    24542, 24542, 24542, 24543, 24543, 24543, 24543, 24544, 24544, 24544, 24544,
-    24545, 24545, 24545, 24545, 24545, 24546, 24546, 24546, 24546, 24547, 24547,
-    24547, 24547, 24548, 24548, 24548, 24548, 24548, 24549, 24549, 24549, 24549,
-    24550, 24550, 24550, 24550, 24550, 24551, 24551, 24551, 24551, 24551, 24552,
-    24552, 24552, 24552, 24552, 24553, 24553, 24553, 24553, 24553, 24554, 24554,
-    24554, 24554, 24554, 24555, 24555, 24555, 24555, 24555, 24556, 24556, 24556,
-    24556, 24556, 24556, 24557, 24557, 24557, 24557, 24557, 24558, 24558, 24558,
-    24558, 24558, 24558, 24559, 24559, 24559, 24559, 24559, 24559, 24560, 24560,
-    24560, 24560, 24560, 24560, 24561, 24561, 24561, 24561, 24561, 24561, 24562,
-    24562, 24562, 24562, 24562, 24562, 24563, 24563, 24563, 24563, 24563, 24563,
-    24563, 24564, 24564, 24564, 24564, 24564, 24564, 24564, 24565, 24565, 24565,
-    24565, 24565, 24565, 24565, 24566, 24566, 24566, 24566, 24566, 24566, 24566,
-    24566, 24567, 24567, 24567, 24567, 24567, 24567, 24567, 24567, 24568, 24568,
-    24568, 24568, 24568, 24568, 24568, 24568, 24568, 24569, 24569, 24569, 24569,
-    24569, 24569, 24569, 24569, 24569, 24570, 24570, 24570, 24570, 24570, 24570,
-    24570, 24570, 24570, 24570, 24570, 24571, 24571, 24571, 24571, 24571, 24571,
-    24571, 24571, 24571, 24571, 24571, 24572, 24572, 24572, 24572, 24572, 24572,
-    24572, 24572, 24572, 24572, 24572, 24572, 24572, 24573, 24573, 24573, 24573,
-    24573, 24573, 24573, 24573, 24573, 24573, 24573, 24573, 24573, 24573, 24573,
-    24573, 24574, 24574, 24574, 24574, 24574, 24574, 24574, 24574, 24574, 24574,
-    24574, 24574, 24574, 24574, 24574, 24574, 24574, 24574, 24574, 24574, 24574,
-    24574, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,
-    24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,
-    24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,
-    24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,
+#define TRANSFER_DOUBLESINE_BITS 9
+#define TRANSFER_DOUBLESINE_SHIFT 4
+int16_t transfer_doublesine_raw[] = {
+    0,     75,    151,   226,   302,   377,   452,   528,   603,   678,   754,
+    829,   905,   980,   1055,  1131,  1206,  1281,  1356,  1432,  1507,  1582,
+    1657,  1733,  1808,  1883,  1958,  2033,  2108,  2184,  2259,  2334,  2409,
+    2484,  2559,  2634,  2709,  2784,  2859,  2933,  3008,  3083,  3158,  3233,
+    3307,  3382,  3457,  3531,  3606,  3681,  3755,  3830,  3904,  3978,  4053,
+    4127,  4201,  4276,  4350,  4424,  4498,  4572,  4646,  4720,  4794,  4868,
+    4942,  5016,  5090,  5164,  5237,  5311,  5384,  5458,  5531,  5605,  5678,
+    5752,  5825,  5898,  5971,  6044,  6117,  6190,  6263,  6336,  6409,  6482,
+    6555,  6627,  6700,  6772,  6845,  6917,  6989,  7062,  7134,  7206,  7278,
+    7350,  7422,  7494,  7565,  7637,  7709,  7780,  7852,  7923,  7995,  8066,
+    8137,  8208,  8279,  8350,  8421,  8492,  8562,  8633,  8704,  8774,  8845,
+    8915,  8985,  9055,  9125,  9195,  9265,  9335,  9405,  9474,  9544,  9613,
+    9682,  9752,  9821,  9890,  9959,  10028, 10097, 10165, 10234, 10302, 10371,
+    10439, 10507, 10575, 10643, 10711, 10779, 10847, 10914, 10982, 11049, 11117,
+    11184, 11251, 11318, 11385, 11451, 11518, 11585, 11651, 11717, 11784, 11850,
+    11916, 11982, 12047, 12113, 12179, 12244, 12309, 12375, 12440, 12505, 12569,
+    12634, 12699, 12763, 12828, 12892, 12956, 13020, 13084, 13148, 13211, 13275,
+    13338, 13401, 13465, 13528, 13591, 13653, 13716, 13778, 13841, 13903, 13965,
+    14027, 14089, 14151, 14212, 14274, 14335, 14396, 14457, 14518, 14579, 14639,
+    14700, 14760, 14821, 14881, 14941, 15000, 15060, 15119, 15179, 15238, 15297,
+    15356, 15415, 15474, 15532, 15590, 15649, 15707, 15765, 15822, 15880, 15937,
+    15995, 16052, 16109, 16166, 16222, 16279, 16335, 16392, 16448, 16504, 16560,
+    16615, 16671, 16726, 16781, 16836, 16891, 16946, 17000, 17055, 17109, 17163,
+    17217, 17270, 17324, 17377, 17431, 17484, 17537, 17589, 17642, 17694, 17746,
+    17799, 17850, 17902, 17954, 18005, 18056, 18107, 18158, 18209, 18260, 18310,
+    18360, 18410, 18460, 18510, 18559, 18609, 18658, 18707, 18756, 18804, 18853,
+    18901, 18949, 18997, 19045, 19092, 19140, 19187, 19234, 19281, 19327, 19374,
+    19420, 19466, 19512, 19558, 19603, 19649, 19694, 19739, 19784, 19828, 19873,
+    19917, 19961, 20005, 20049, 20092, 20136, 20179, 20222, 20264, 20307, 20349,
+    20392, 20434, 20475, 20517, 20558, 20600, 20641, 20681, 20722, 20762, 20803,
+    20843, 20883, 20922, 20962, 21001, 21040, 21079, 21118, 21156, 21194, 21232,
+    21270, 21308, 21345, 21383, 21420, 21457, 21493, 21530, 21566, 21602, 21638,
+    21673, 21709, 21744, 21779, 21814, 21849, 21883, 21917, 21951, 21985, 22019,
+    22052, 22085, 22118, 22151, 22183, 22216, 22248, 22280, 22312, 22343, 22374,
+    22405, 22436, 22467, 22497, 22528, 22558, 22587, 22617, 22646, 22676, 22705,
+    22733, 22762, 22790, 22818, 22846, 22874, 22901, 22929, 22956, 22982, 23009,
+    23035, 23062, 23087, 23113, 23139, 23164, 23189, 23214, 23239, 23263, 23287,
+    23311, 23335, 23358, 23382, 23405, 23428, 23450, 23473, 23495, 23517, 23539,
+    23560, 23582, 23603, 23624, 23644, 23665, 23685, 23705, 23725, 23744, 23764,
+    23783, 23802, 23820, 23839, 23857, 23875, 23893, 23910, 23928, 23945, 23961,
+    23978, 23995, 24011, 24027, 24042, 24058, 24073, 24088, 24103, 24118, 24132,
+    24146, 24160, 24174, 24187, 24200, 24213, 24226, 24239, 24251, 24263, 24275,
+    24287, 24298, 24309, 24320, 24331, 24341, 24352, 24362, 24372, 24381, 24390,
+    24400, 24408, 24417, 24426, 24434, 24442, 24449, 24457, 24464, 24471, 24478,
+    24485, 24491, 24497, 24503, 24509, 24514, 24519, 24524, 24529, 24534, 24538,
+    24542, 24546, 24549, 24553, 24556, 24559, 24561, 24564, 24566, 24568, 24570,
+    24571, 24572, 24573, 24574, 24575, 24575, 24575,
 };
 
 int16_t transfer_doublesine(int32_t v) {
   v = (v + 32768);
-  if (v < 8192) {
-    return transfer_doublesine_raw[v];
-  } else if (v < 16384) {
-    return transfer_doublesine_raw[8191 - (v - 8192)];
-  } else if (v < 24576) {
-    return -1 * transfer_doublesine_raw[(v - 16384)];
-  } else if (v < 32768) {
-    return -1 * transfer_doublesine_raw[8191 - (v - 24576)];
-  } else if (v < 40960) {
-    return transfer_doublesine_raw[v - 32768];
-  } else if (v < 49152) {
-    return transfer_doublesine_raw[8191 - (v - 40960)];
-  } else if (v < 57344) {
-    return -1 * transfer_doublesine_raw[(v - 49152)];
-  } else if (v < 65536) {
-    return -1 * transfer_doublesine_raw[8191 - (v - 57344)];
+  // position within the quarter wave, mirrored on the falling quarters
+  int32_t p = v & 8191;
+  if (v & 8192) {
+    p = 8191 - p;
+  }
+  int32_t i = p >> TRANSFER_DOUBLESINE_SHIFT;
+  int32_t f = p & ((1 << TRANSFER_DOUBLESINE_SHIFT) - 1);
+  int32_t a = transfer_doublesine_raw[i];
+  a = a + (((transfer_doublesine_raw[i + 1] - a) * f) >>
+           TRANSFER_DOUBLESINE_SHIFT);
+  if (v & 16384) {
+    return -a;
   }
-  return 0;
+  return a;
 }
+#endif
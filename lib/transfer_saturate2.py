@@ -1,47 +1,50 @@
 import math
 
+# quarter sine wave sampled at 2^table_bits + 1 points. the table is small
+# enough to live in SRAM (it is not const, so it is copied out of flash at
+# boot) and transfer_doublesine interpolates between the points
+table_bits = 9
+quarter = 8192
+step = quarter >> table_bits
+
 print(
-    """
-const int16_t transfer_doublesine_raw[] = {
+    f"""#ifndef LIB_TRANSFER_SATURATE2
+#define LIB_TRANSFER_SATURATE2 1
+
+#define TRANSFER_DOUBLESINE_BITS {table_bits}
+#define TRANSFER_DOUBLESINE_SHIFT {int(math.log2(step))}
+int16_t transfer_doublesine_raw[] = {{
 """
 )
 points = []
-for i, v in enumerate(range(0, int(32768 / 4))):
-    x = float(v) / 32767
-    e = ""
-    if i % 8 == 0:
-        e = "\n"
+for i in range(int(math.pow(2, table_bits)) + 1):
+    x = float(i * step) / 32768
     x = round(0.75 * 32767 * math.sin(2 * math.pi * x))
     points.append(x)
-    print("{},".format(x), end=e)
-    if i % 8 == 0:
-        print("\t", end="")
+    print("{},".format(x))
 
-print("\n};")
+print("};")
 
 print(
     """
 int16_t transfer_doublesine(int32_t v) {
-    v = (v + 32768) % 8192;
-    if (v < 8192) {
-        return transfer_doublesine_raw[v];
-    } else if (v < 16384) {
-        return transfer_doublesine_raw[8191 - (v-8192)];
-    } else if (v < 24576) {
-        return -1* transfer_doublesine_raw[(v-16384)];
-    } else if (v < 32768) {
-        return -1* transfer_doublesine_raw[8191 - (v-24576)];
-    } else if (v < 40960) {
-        return transfer_doublesine_raw[v - 32768];    
-    } else if (v < 49152) {
-        return transfer_doublesine_raw[8191 - (v-40960)];
-    } else if (v < 57344) {
-        return -1* transfer_doublesine_raw[(v-49152)];
-    } else if (v < 65536) {
-        return -1* transfer_doublesine_raw[8191 - (v-57344)];
-    }
-    return 0;
-}"""
+  v = (v + 32768);
+  // position within the quarter wave, mirrored on the falling quarters
+  int32_t p = v & 8191;
+  if (v & 8192) {
+    p = 8191 - p;
+  }
+  int32_t i = p >> TRANSFER_DOUBLESINE_SHIFT;
+  int32_t f = p & ((1 << TRANSFER_DOUBLESINE_SHIFT) - 1);
+  int32_t a = transfer_doublesine_raw[i];
+  a = a + (((transfer_doublesine_raw[i + 1] - a) * f) >>
+           TRANSFER_DOUBLESINE_SHIFT);
+  if (v & 16384) {
+    return -a;
+  }
+  return a;
+}
+#endif"""
 )
 
 # plot points
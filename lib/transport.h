@@ -0,0 +1,99 @@
+// Copyright 2023 Zack Scholl.
+//
+// Author: Zack Scholl (zack.scholl@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+
+#ifndef LIB_TRANSPORT_H_
+#define LIB_TRANSPORT_H_
+
+#include "ramfunc.h"
+
+// Transport is the beat clock, advanced by the audio core by the number of
+// samples it renders, so beats stay locked to the audio output instead of a
+// hardware timer. it ticks 96 times per half beat (the same rate as the old
+// 30000000 / bpm / 96 us timer).
+//
+// progress towards the next tick is kept as an exact fraction acc / period
+// with step = bpm * 96 added per sample and period = 30 * sample rate, so
+// there is no rounding drift, and changing the tempo only changes step,
+// which keeps the phase of the current tick.
+//
+// Transport_process calls tick with the sample offset in the block at which
+// each tick falls.
+
+#define TRANSPORT_TICKS 96
+
+typedef struct Transport {
+  uint32_t period;
+  uint32_t step;
+  uint32_t acc;
+  uint16_t bpm;
+  uint32_t ticks;
+  uint64_t sample;
+  void (*tick)(uint16_t offset);
+} Transport;
+
+Transport *Transport_malloc(uint32_t sample_rate,
+                            void (*tick)(uint16_t offset)) {
+  Transport *self = (Transport *)malloc(sizeof(Transport));
+  self->period = 30 * sample_rate;
+  self->step = 0;
+  self->acc = 0;
+  self->bpm = 0;
+  self->ticks = 0;
+  self->sample = 0;
+  self->tick = tick;
+  return self;
+}
+
+void Transport_free(Transport *self) { free(self); }
+
+void Transport_setTempo(Transport *self, uint16_t bpm) {
+  self->bpm = bpm;
+  self->step = bpm * TRANSPORT_TICKS;
+}
+
+// advances the clock by num_samples, ticking on the first sample at or after
+// each tick time. acc is the progress at the start of sample pos.
+void RAM_FUNC(Transport_process)(Transport *self, uint16_t num_samples) {
+  uint32_t pos = 0;
+  while (self->step > 0) {
+    // samples until acc reaches period
+    uint32_t need = 0;
+    if (self->acc < self->period) {
+      need = (self->period - self->acc + self->step - 1) / self->step;
+    }
+    if (pos + need >= num_samples) {
+      self->acc += (num_samples - pos) * self->step;
+      break;
+    }
+    pos += need;
+    self->acc = self->acc + need * self->step - self->period;
+    self->ticks++;
+    if (self->tick != NULL) {
+      self->tick(pos);
+    }
+  }
+  self->sample += num_samples;
+}
+
+#endif
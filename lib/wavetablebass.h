@@ -1,62 +1,298 @@
 #ifndef LIB_WAVETABLEBASS_H
 #define LIB_WAVETABLEBASS_H 1
-#include "wavetablesyn.h"
-#define WAVETABLEBASS_MAX 3
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// crossfade3.h uses fixedpoint.h without including it
+#include "fixedpoint.h"
+//
+#include "crossfade3.h"
+#include "ramfunc.h"
+
+// WaveBass plays a note as three sine partials (the root, an octave and a
+// twelfth) that come in one after the other. it renders a whole block at a
+// time: every voice reads one sine table with a phase accumulator and
+// interpolation, which holds no harmonics to alias at any pitch, and its gain ramps linearly across the block to where the
+// attack or release curve is at the end of it. the voices live in the
+// struct, a new note takes the next voice of each partial and fades out the
+// one before, so nothing is allocated once it is made.
+//
+// WaveBass_note_on and WaveBass_release run on the audio core, core0 sends
+// them as COMMAND_BASS_NOTE and COMMAND_BASS_RELEASE, which keep their order.
+
+#define WAVEBASS_PARTIALS 3
+// a partial fades out its last note while the next one starts
+#define WAVEBASS_VOICES 3
+// notes from wave 0 (midi 24) up, like the old per-note tables
+#define WAVEBASS_NOTES 36
+#define WAVEBASS_TABLE_BITS 10
+#define WAVEBASS_TABLE_SIZE (1 << WAVEBASS_TABLE_BITS)
+#define WAVEBASS_NONE 0xFFFF
+#ifndef SAMPLES_PER_BUFFER
+#define SAMPLES_PER_BUFFER 441
+#endif
+
+#define WAVEVOICE_OFF 0
+#define WAVEVOICE_ATTACK 1
+#define WAVEVOICE_HOLD 2
+#define WAVEVOICE_RELEASE 3
+
+// one cycle of a sine at the level of the old tables, with the first point
+// repeated at the end for the interpolation
+int32_t wavebass_sine[WAVEBASS_TABLE_SIZE + 1];
+// phase increments of the notes (a cycle is 2^32)
+uint32_t wavebass_step[WAVEBASS_NOTES];
+bool wavebass_tables_ready = false;
+
+// when each partial starts after the note (samples), which note above the
+// root, how much quieter (bits) and the samples per point of its attack and
+// release curves
+const uint16_t wavebass_partial_offset[WAVEBASS_PARTIALS] = {1, 500, 1000};
+const uint8_t wavetablebass_harmonics[WAVEBASS_PARTIALS] = {0, 12, 19};
+const uint8_t wavebass_partial_quiet[WAVEBASS_PARTIALS] = {0, 1, 2};
+const uint8_t wavebass_partial_attack[WAVEBASS_PARTIALS] = {5, 2, 1};
+const uint8_t wavebass_partial_decay[WAVEBASS_PARTIALS] = {100, 50, 25};
+
+typedef struct WaveVoice {
+  uint32_t phase;
+  uint32_t step;
+  uint8_t quiet;
+  uint8_t stage;
+  // position on the attack or release curve (q16 table points) and how far
+  // it moves a sample
+  uint32_t fade_pos;
+  uint32_t fade_inc;
+  uint32_t release_inc;
+  // the gain (q16) at the end of the last block, and where the release
+  // started from
+  int32_t gain;
+  int32_t release_from;
+  // sample in the block where it starts or fades out fast
+  uint16_t start_at;
+  uint16_t stop_at;
+} WaveVoice;
 
-const uint8_t wavetablebass_harmonics[3] = {0, 12, 19};
 typedef struct WaveBass {
-  WaveSyn *osc[WAVETABLEBASS_MAX];
+  WaveVoice voice[WAVEBASS_PARTIALS][WAVEBASS_VOICES];
+  uint8_t current[WAVEBASS_PARTIALS];
   uint8_t note;
+  // samples since the note, while its partials come in
   uint16_t change_count;
+  // a note not rendered yet, and a release waiting for it to start
+  bool note_new;
+  bool release_next;
+  int32_t mix[SAMPLES_PER_BUFFER];
 } WaveBass;
 
+static void WaveBass_tables() {
+  if (wavebass_tables_ready) {
+    return;
+  }
+  for (uint16_t i = 0; i <= WAVEBASS_TABLE_SIZE; i++) {
+    wavebass_sine[i] = (int32_t)roundf(
+        1073741823.0f *
+        sinf(2 * 3.14159265f * (i % WAVEBASS_TABLE_SIZE) / WAVEBASS_TABLE_SIZE));
+  }
+  for (uint8_t i = 0; i < WAVEBASS_NOTES; i++) {
+    double freq = 440.0 * pow(2, (i + 24 - 69.0) / 12.0);
+    wavebass_step[i] = (uint32_t)round(freq * 4294967296.0 / 44100.0);
+  }
+  wavebass_tables_ready = true;
+}
+
 WaveBass *WaveBass_malloc() {
+  WaveBass_tables();
   WaveBass *self = malloc(sizeof(WaveBass));
-  for (uint8_t i = 0; i < WAVETABLEBASS_MAX; i++) {
-    self->osc[i] = WaveSyn_malloc();
+  for (uint8_t p = 0; p < WAVEBASS_PARTIALS; p++) {
+    for (uint8_t v = 0; v < WAVEBASS_VOICES; v++) {
+      WaveVoice *voice = &self->voice[p][v];
+      voice->stage = WAVEVOICE_OFF;
+      voice->gain = 0;
+      voice->start_at = WAVEBASS_NONE;
+      voice->stop_at = WAVEBASS_NONE;
+    }
+    self->current[p] = 0;
   }
   self->note = 0;
   self->change_count = 5000;
+  self->note_new = false;
+  self->release_next = false;
   return self;
 }
 
-void WaveBass_free(WaveBass *self) {
-  for (uint8_t i = 0; i < WAVETABLEBASS_MAX; i++) {
-    WaveSyn_free(self->osc[i]);
+void WaveBass_free(WaveBass *self) { free(self); }
+
+// the curve point (q16) at pos, the last point once past the end
+static inline int32_t WaveBass_curve(const int32_t *curve, uint32_t pos) {
+  uint32_t i = pos >> 16;
+  if (i >= CROSSFADE3_LIMIT - 1) {
+    return curve[CROSSFADE3_LIMIT - 1];
+  }
+  int32_t frac = (pos & 0xFFFF) >> 1;
+  return curve[i] + (((curve[i + 1] - curve[i]) * frac) >> 15);
+}
+
+// starts partial p at sample offset in the next block, fading out the
+// voice it had there
+static void WaveBass_start(WaveBass *self, uint8_t p, uint16_t offset) {
+  uint8_t wave = self->note + wavetablebass_harmonics[p];
+  for (uint8_t v = 0; v < WAVEBASS_VOICES; v++) {
+    WaveVoice *voice = &self->voice[p][v];
+    if (voice->stage != WAVEVOICE_OFF && voice->stop_at == WAVEBASS_NONE) {
+      voice->stop_at = offset;
+    }
+  }
+  // the next free voice, or the oldest one if all are still fading
+  uint8_t next = (self->current[p] + 1) % WAVEBASS_VOICES;
+  for (uint8_t v = 0; v < WAVEBASS_VOICES; v++) {
+    uint8_t i = (self->current[p] + 1 + v) % WAVEBASS_VOICES;
+    if (self->voice[p][i].stage == WAVEVOICE_OFF) {
+      next = i;
+      break;
+    }
+  }
+  if (wave >= WAVEBASS_NOTES) {
+    return;
+  }
+  self->current[p] = next;
+  WaveVoice *voice = &self->voice[p][next];
+  voice->phase = 0;
+  voice->step = wavebass_step[wave];
+  voice->quiet = wavebass_partial_quiet[p];
+  voice->stage = WAVEVOICE_OFF;
+  voice->fade_pos = 0;
+  voice->fade_inc = 65536 / wavebass_partial_attack[p];
+  voice->release_inc = 65536 / wavebass_partial_decay[p];
+  voice->gain = 0;
+  voice->start_at = offset;
+  voice->stop_at = WAVEBASS_NONE;
+}
+
+// moves the envelope on by n samples and returns the gain (q16) there
+static int32_t WaveVoice_envelope(WaveVoice *self, uint16_t n) {
+  if (self->stage == WAVEVOICE_HOLD) {
+    return self->gain;
+  }
+  self->fade_pos += self->fade_inc * n;
+  if (self->stage == WAVEVOICE_ATTACK) {
+    if ((self->fade_pos >> 16) >= CROSSFADE3_LIMIT - 1) {
+      self->stage = WAVEVOICE_HOLD;
+      return Q16_16_1;
+    }
+    return WaveBass_curve(crossfade3_cos_in, self->fade_pos);
+  }
+  if ((self->fade_pos >> 16) >= CROSSFADE3_LIMIT - 1) {
+    self->stage = WAVEVOICE_OFF;
+    return 0;
   }
-  free(self);
+  return q16_16_multiply(self->release_from,
+                         WaveBass_curve(crossfade3_exp_out, self->fade_pos));
+}
+
+// fades out from where the voice is, over its release or one point a sample
+static void WaveVoice_release(WaveVoice *self, bool fast) {
+  if (self->stage == WAVEVOICE_OFF || self->stage == WAVEVOICE_RELEASE) {
+    return;
+  }
+  self->stage = WAVEVOICE_RELEASE;
+  self->release_from = self->gain;
+  self->fade_pos = 0;
+  self->fade_inc = fast ? 65536 : self->release_inc;
+}
+
+// adds samples from to to of the voice into mix, the gain ramping to where
+// the envelope is at the end
+static void RAM_FUNC(WaveVoice_render)(WaveVoice *self, int32_t *mix,
+                                       uint16_t from, uint16_t to) {
+  if (self->stage == WAVEVOICE_OFF || from >= to) {
+    return;
+  }
+  uint16_t n = to - from;
+  int32_t gain = self->gain;
+  int32_t gain_end = WaveVoice_envelope(self, n);
+  // the three partials share the output, a third each
+  int32_t g = gain / 3;
+  int32_t g_step = (gain_end / 3 - g) / n;
+  uint32_t phase = self->phase;
+  const uint8_t shift = 16 + self->quiet;
+  for (uint16_t i = from; i < to; i++) {
+    uint32_t j = phase >> (32 - WAVEBASS_TABLE_BITS);
+    int32_t frac = (phase >> (24 - WAVEBASS_TABLE_BITS)) & 0xFF;
+    int32_t s = wavebass_sine[j] +
+                (((wavebass_sine[j + 1] - wavebass_sine[j]) * frac) >> 8);
+    mix[i] += (s >> shift) * g;
+    g += g_step;
+    phase += self->step;
+  }
+  self->phase = phase;
+  self->gain = gain_end;
 }
 
 void WaveBass_note_on(WaveBass *self, uint8_t note) {
-  self->change_count = 0;
   self->note = note;
+  self->change_count = 0;
+  self->note_new = true;
+  self->release_next = false;
 }
 
+// a release right after a note waits until the note has rendered a block,
+// so a short tap still sounds
 void WaveBass_release(WaveBass *self) {
-  for (uint8_t i = 0; i < WAVETABLEBASS_MAX; i++) {
-    WaveSyn_release(self->osc[i]);
+  if (self->note_new) {
+    self->release_next = true;
+    return;
+  }
+  // partials still to come stay out
+  self->change_count = 2000;
+  for (uint8_t p = 0; p < WAVEBASS_PARTIALS; p++) {
+    WaveVoice_release(&self->voice[p][self->current[p]], false);
   }
 }
 
-int32_t WaveBass_next(WaveBass *self) {
-  int64_t val = 0;
-  for (uint8_t i = 0; i < WAVETABLEBASS_MAX; i++) {
-    val += WaveSyn_next(self->osc[i]);
+// renders n samples of the bass and adds them to both channels of samples
+void RAM_FUNC(WaveBass_render)(WaveBass *self, int32_t *samples, uint16_t n) {
+  // partials that come in during this block
+  for (uint8_t p = 0; p < WAVEBASS_PARTIALS; p++) {
+    if (self->change_count <= wavebass_partial_offset[p] &&
+        wavebass_partial_offset[p] < self->change_count + n) {
+      WaveBass_start(self, p, wavebass_partial_offset[p] - self->change_count);
+    }
   }
   if (self->change_count < 2000) {
-    if (self->change_count == 1) {
-      WaveSyn_new(self->osc[0], self->note + wavetablebass_harmonics[0], 0, 5,
-                  100);
-    } else if (self->change_count == 500) {
-      WaveSyn_new(self->osc[1], self->note + wavetablebass_harmonics[1], 1, 2,
-                  50);
-    } else if (self->change_count == 1000) {
-      WaveSyn_new(self->osc[2], self->note + wavetablebass_harmonics[2], 2, 1,
-                  25);
+    self->change_count += n;
+  }
+
+  memset(self->mix, 0, n * sizeof(int32_t));
+  for (uint8_t p = 0; p < WAVEBASS_PARTIALS; p++) {
+    for (uint8_t v = 0; v < WAVEBASS_VOICES; v++) {
+      WaveVoice *voice = &self->voice[p][v];
+      uint16_t from = 0;
+      if (voice->start_at != WAVEBASS_NONE) {
+        from = voice->start_at;
+        voice->start_at = WAVEBASS_NONE;
+        voice->stage = WAVEVOICE_ATTACK;
+      }
+      if (voice->stop_at != WAVEBASS_NONE) {
+        WaveVoice_render(voice, self->mix, from, voice->stop_at);
+        from = voice->stop_at > from ? voice->stop_at : from;
+        voice->stop_at = WAVEBASS_NONE;
+        WaveVoice_release(voice, true);
+      }
+      WaveVoice_render(voice, self->mix, from, n);
     }
-    self->change_count++;
   }
-  return val / WAVETABLEBASS_MAX;
+  for (uint16_t i = 0; i < n; i++) {
+    samples[i * 2 + 0] += self->mix[i];
+    samples[i * 2 + 1] += self->mix[i];
+  }
+  self->note_new = false;
+  if (self->release_next) {
+    self->release_next = false;
+    WaveBass_release(self);
+  }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -1,5 +1,6 @@
 #ifndef LIB_WAVETABLESYN_H
 #define LIB_WAVETABLESYN_H 1
+#include "ramfunc.h"
 #include "wavetableosc.h"
 
 #define WAVETABLESYN_MAX 3
@@ -49,7 +50,7 @@ void WaveSyn_new(WaveSyn *self, uint8_t wave, uint8_t quiet, uint8_t attack,
   }
 }
 
-int32_t WaveSyn_next(WaveSyn *self) {
+int32_t RAM_FUNC(WaveSyn_next)(WaveSyn *self) {
   int64_t val = 0;
   for (uint8_t i = 0; i < WAVETABLESYN_MAX; i++) {
     if (self->active[i]) {
@@ -63,6 +63,7 @@ void clear_debouncers() {
 void clock_handling_up(int time_diff) {
   sf->bpm_tempo = 60000000 / (time_diff * 2);
   clock_in_ready = true;
+  clock_in_idle = false;
 }
 
 void clock_handling_down(int time_diff) {
@@ -116,16 +117,41 @@ void input_handling() {
   while (1) {
     // TODO: check timing of this?
 
-    if (MessageSync_hasMessage(messagesync)) {
-      MessageSync_print(messagesync);
-      MessageSync_clear(messagesync);
+    LogRing_print(logring);
+
+#ifdef INCLUDE_CLOCK_GOVERNOR
+    // nothing is mid-transfer here, wait out a clock change the audio core
+    // asked for
+    ClockGovernor_park(clockgovernor);
+#endif
+
+    // pick up the fx the audio core toggled, then rebuild the fx curve if
+    // the fx settings changed
+    audio_fx_sync();
+    ShaperChain_update(shaperchain, sf->fx_active, sf->fx_param);
+
+#ifdef INCLUDE_PROFILER
+#ifdef PRINT_PROFILER
+    // dump the profiler every ~10 seconds
+    if (time_us_32() - profiler_last_request > 10000000) {
+      profiler_last_request = time_us_32();
+      Profiler_request(profiler, false);
+    }
+#endif
+    Profiler_poll(profiler);
+#endif
+#ifdef INCLUDE_FLIGHTRECORDER
+    // write out the blocks around an overrun, only while stopped so playback is not interrupted
+    if (flightrecorder->frozen && playback_stopped) {
+      FlightRecorder_write(flightrecorder, &sync_using_sdcard);
     }
+#endif
 
 #ifdef PRINT_SDCARD_TIMING
     // random stuff
     if (random_integer_in_range(1, 10000) < 10) {
       // printf("random retrig\n");
-      key_do_jump(random_integer_in_range(0, 15));
+      key_send_jump(random_integer_in_range(0, 15), -1);
     } else if (random_integer_in_range(1, 10000) < 5) {
       // printf("random retrigger\n");
       go_retrigger_2key(1, 1);
@@ -151,10 +177,8 @@ void input_handling() {
     if (debounce_beat_repeat > 0) {
       debounce_beat_repeat--;
       if (debounce_beat_repeat == 10) {
-        BeatRepeat_repeat(beatrepeat,
-                          sf->fx_param[FX_BEATREPEAT][0] * 19000 / 255 + 100);
-      } else if (debounce_beat_repeat == 100) {
-        BeatRepeat_repeat(beatrepeat, 20);
+        CommandQueue_send(commandqueue, COMMAND_BEATREPEAT,
+                          sf->fx_param[FX_BEATREPEAT][0], 0, 0);
       }
     }
 
@@ -180,12 +204,6 @@ void input_handling() {
         } else if (key_on_buttons[FX_TIGHTEN + 4]) {
           printf("updating gate\n");
           Gate_set_amount(audio_gate, sf->fx_param[FX_TIGHTEN][0]);
-        } else if (key_on_buttons[FX_TREMELO + 4]) {
-          lfo_tremelo_step =
-              Q16_16_2PI / (12 + (255 - sf->fx_param[single_key - 4][0]) * 2);
-        } else if (key_on_buttons[FX_PAN + 4]) {
-          lfo_pan_step =
-              Q16_16_2PI / (12 + (255 - sf->fx_param[single_key - 4][0]) * 2);
         }
       } else {
         if (button_is_pressed(KEY_A)) {
@@ -204,6 +222,11 @@ void input_handling() {
             pitch_val_index = PITCH_VAL_MAX - 1;
           }
         } else if (button_is_pressed(KEY_D)) {
+          // reverb decay
+          sf->fx_param[FX_REVERB][0] = adc * 255 / 4096;
+          clear_debouncers();
+          DebounceUint8_set(debouncer_uint8[DEBOUNCE_UINT8_LED_BAR],
+                            sf->fx_param[FX_REVERB][0], 100);
         }
       }
     }
@@ -230,22 +253,22 @@ void input_handling() {
       } else {
         if (button_is_pressed(KEY_A)) {
         } else if (button_is_pressed(KEY_B)) {
-          for (uint8_t channel = 0; channel < 2; channel++) {
-            if (adc < 3500) {
-              global_filter_index = adc * (resonantfilter_fc_max) / 3500;
-              ResonantFilter_setFilterType(resFilter[channel], 0);
-              ResonantFilter_setFc(resFilter[channel], global_filter_index);
-            } else {
-              global_filter_index = resonantfilter_fc_max;
-              ResonantFilter_setFilterType(resFilter[channel], 0);
-              ResonantFilter_setFc(resFilter[channel], resonantfilter_fc_max);
-            }
+          // the audio core glides the filters to it
+          if (adc < 3500) {
+            global_filter_index = adc * (resonantfilter_fc_max) / 3500;
+          } else {
+            global_filter_index = resonantfilter_fc_max;
           }
           clear_debouncers();
           DebounceUint8_set(debouncer_uint8[DEBOUNCE_UINT8_LED_SPIRAL1],
                             adc * 255 / 4096, 200);
         } else if (button_is_pressed(KEY_C)) {
         } else if (button_is_pressed(KEY_D)) {
+          // reverb mix
+          sf->fx_param[FX_REVERB][1] = adc * 255 / 4096;
+          clear_debouncers();
+          DebounceUint8_set(debouncer_uint8[DEBOUNCE_UINT8_LED_BAR],
+                            sf->fx_param[FX_REVERB][1], 100);
         }
       }
     }
@@ -255,8 +278,10 @@ void input_handling() {
     // clock input handler
     ClockInput_update(clockinput);
     if (clock_in_do) {
-      if (ClockInput_time_since(clockinput) > 1000000) {
-        beat_current = 0;
+      // once per idle spell, the loop would fill the queue otherwise
+      if (!clock_in_idle && ClockInput_time_since(clockinput) > 1000000) {
+        clock_in_idle = true;
+        CommandQueue_send(commandqueue, COMMAND_BEAT, 0, 0, 0);
       }
     }
 #endif
@@ -290,11 +315,16 @@ void input_handling() {
           const uint8_t quantizations[10] = {1,  6,  12,  24,  48,
                                              64, 96, 144, 192, 192};
           printf("quantization: %d\n", quantizations[adc * 9 / 4096]);
-          Sequencer_quantize(sf->sequencers[mode_buttons16][0],
-                             quantizations[adc * 9 / 4096]);
+          CommandQueue_send(commandqueue, COMMAND_SEQUENCER, mode_buttons16,
+                            SEQUENCER_QUANTIZE, quantizations[adc * 9 / 4096]);
           DebounceUint8_set(debouncer_uint8[DEBOUNCE_UINT8_LED_WALL],
                             adc * 255 / 4096, 200);
         } else if (button_is_pressed(KEY_D)) {
+          // reverb tone
+          sf->fx_param[FX_REVERB][2] = adc * 255 / 4096;
+          clear_debouncers();
+          DebounceUint8_set(debouncer_uint8[DEBOUNCE_UINT8_LED_BAR],
+                            sf->fx_param[FX_REVERB][2], 100);
         }
       }
     }
@@ -28,18 +28,10 @@ static uint8_t dub_step_numerator[] = {1, 1, 1, 1, 1, 1, 1, 1};
 static uint8_t dub_step_denominator[] = {2, 3, 4, 8, 8, 12, 12, 16};
 static uint8_t dub_step_steps[] = {8, 12, 16, 32, 16, 16};
 
-// timer
-bool repeating_timer_callback(struct repeating_timer *t) {
+// beat clock, runs on the audio core at every transport tick
+void bpm_timer_tick() {
   if (!fil_is_open) {
-    return true;
-  }
-  if (bpm_last != sf->bpm_tempo) {
-    printf("updating bpm timer: %d-> %d\n", bpm_last, sf->bpm_tempo);
-    bpm_last = sf->bpm_tempo;
-
-    cancel_repeating_timer(&timer);
-    add_repeating_timer_us(-(round(30000000 / sf->bpm_tempo / 96)),
-                           repeating_timer_callback, NULL, &timer);
+    return;
   }
   if (do_restart_playback) {
     do_restart_playback = false;
@@ -60,7 +52,7 @@ bool repeating_timer_callback(struct repeating_timer *t) {
     playback_stopped = true;
   }
   if (playback_stopped) {
-    return true;
+    return;
   }
 
   bpm_timer_counter++;
@@ -92,6 +84,7 @@ bool repeating_timer_callback(struct repeating_timer *t) {
           retrig_ready = false;
           retrig_vol = 1.0;
           retrig_pitch = PITCH_VAL_MID;
+          retrig_send();
         }
         if (retrig_vol < 1.0) {
           retrig_vol += retrig_vol_step;
@@ -144,21 +137,18 @@ bool repeating_timer_callback(struct repeating_timer *t) {
                      .snd[sel_variation]
                      ->play_mode != PLAY_NORMAL) {
     Sequencer_step(sf->sequencers[0][0], bpm_timer_counter);
-  } else if (((banks[sel_bank_cur]
-                       ->sample[sel_sample_cur]
-                       .snd[sel_variation]
-                       ->splice_trigger > 0 &&
-               !clock_in_do) ||
-              (clock_in_ready && clock_in_do))
-             // TODO if splice_trigger is 0, but we are sequencing, then need to
-             // continue here!
-
-             // do not iterate the beat if we are in a timestretched variation,
-             // let it roll
-             && sel_variation == 0) {
+  } else if ((banks[sel_bank_cur]
+                      ->sample[sel_sample_cur]
+                      .snd[sel_variation]
+                      ->splice_trigger > 0 &&
+              !clock_in_do) ||
+             (clock_in_ready && clock_in_do)) {
+    // TODO if splice_trigger is 0, but we are sequencing, then need to
+    // continue here!
     retrig_vol = 1.0;
     retrig_pitch = PITCH_VAL_MID;
     retrig_pitch_change = 0;
+    retrig_send();
     if (sequencerhandler[0].playing) {
       Sequencer_step(sf->sequencers[0][0], bpm_timer_counter);
     } else if ((clock_in_do && clock_in_ready) ||
@@ -181,6 +171,7 @@ bool repeating_timer_callback(struct repeating_timer *t) {
         }
         beat_total++;
         clock_out_ready = true;
+        clock_out_offset = transport_tick_offset;
         // printf("beat_current: %d\n", beat_current);
         if (key_jump_debounce == 0) {
           do_update_phase_from_beat_current();
@@ -193,17 +184,15 @@ bool repeating_timer_callback(struct repeating_timer *t) {
       }
     }
   }
-  // update lfos
-  lfo_pan_val += lfo_pan_step;
-  if (lfo_pan_val > Q16_16_2PI) {
-    lfo_pan_val -= Q16_16_2PI;
-  }
-  lfo_tremelo_val += lfo_tremelo_step;
-  if (lfo_tremelo_val > Q16_16_2PI) {
-    lfo_tremelo_val -= Q16_16_2PI;
-  }
+}
 
-  return true;
+// called by the transport with the sample offset of the tick in the block
+// being rendered, anything the tick sends to the audio core applies there
+void transport_tick(uint16_t offset) {
+  CommandQueue_direct(commandqueue, offset);
+  transport_tick_offset = offset;
+  bpm_timer_tick();
+  CommandQueue_endDirect(commandqueue);
 }
 
 #ifdef INCLUDE_ZEPTOCORE
@@ -239,6 +228,7 @@ int main() {
 #else
   set_sys_clock_khz(125000, true);
 #endif
+  clock_peri_pin();
   sleep_ms(100);
 
   // DCDC PSM control
@@ -263,30 +253,57 @@ int main() {
   adc_gpio_init(28);
 #endif
 
-  // init timers
-  // Negative delay so means we will call repeating_timer_callback, and call
-  // it again 500ms later regardless of how long the callback took to execute
-  // add_repeating_timer_ms(-1000, repeating_timer_callback, NULL, &timer);
-  // cancel_repeating_timer(&timer);
-  add_repeating_timer_us(-(round(30000000 / sf->bpm_tempo / 96)),
-                         repeating_timer_callback, NULL, &timer);
-
   // initialize random library
   random_initialize();
 
-  // initialize message sync
-  messagesync = MessageSync_malloc();
+  // initialize the log ring
+  logring = LogRing_malloc();
+
+  // initialize the core0 -> audio core command queue
+  commandqueue = CommandQueue_malloc(audio_command_apply);
+
+  // initialize the beat clock, advanced by the audio core
+  transport = Transport_malloc(SAMPLE_RATE, transport_tick);
+
+  // initialize the quality governor, a step comes back after 2 s under 80%
+  governor = Governor_malloc(80, BLOCKS_PER_SECOND * 2);
+
+#ifdef INCLUDE_CLOCK_GOVERNOR
+  // initialize the clock governor, aiming to keep the callback under 60% of
+  // a block and only slowing down after 1 s of silence
+  clockgovernor = ClockGovernor_malloc(US_PER_BLOCK, 60, BLOCKS_PER_SECOND,
+                                       clock_get_hz(clk_sys) / 1000);
+#endif
+
+#ifdef INCLUDE_PROFILER
+  profiler = Profiler_malloc();
+#endif
+#ifdef INCLUDE_FLIGHTRECORDER
+  flightrecorder = FlightRecorder_malloc();
+#endif
+
+  // effect buffers are taken from the pool when the effect is switched on
+  fxpool = FxPool_malloc(FXPOOL_SIZE);
 
   // intialize beat repeater
-  beatrepeat = BeatRepeat_malloc();
+  beatrepeat = BeatRepeat_malloc(fxpool);
 
   // initialize delay
-  delay = Delay_malloc();
+  delay = Delay_malloc(fxpool);
   Delay_setActive(delay, false);
   Delay_setDuration(delay, 8018);
 
-  // initialize saturation
-  saturation = Saturation_malloc();
+  // initialize reverb
+  reverb = Reverb_malloc(fxpool);
+
+  // initialize time stretch
+  timestretch = TimeStretch_malloc(fxpool);
+  modulation = Modulation_malloc(time_us_32());
+
+  FxPool_report(fxpool);
+
+  // initialize the saturate/shaper/fuzz/bitcrush chain
+  shaperchain = ShaperChain_malloc();
 
   // initialize debouncers
   for (uint8_t i = 0; i < DEBOUNCE_UINT8_NUM; i++) {
@@ -318,6 +335,8 @@ int main() {
 #ifdef INCLUDE_FILTER
   resFilter[0] = ResonantFilter_create(0);
   resFilter[1] = ResonantFilter_create(0);
+  Smooth_init(&filter_cutoff, (int32_t)resonantfilter_fc_max << 16,
+              FILTER_GLIDE_SHIFT);
 #endif
 #ifdef INCLUDE_RGBLED
   ws2812 = WS2812_new(23, pio0, 2);
@@ -365,6 +384,11 @@ int main() {
 #endif
   // audio_mute = true;
 
+#ifdef CORE_HOST
+  // the host simulator drives the audio callback itself, see host/
+  return 0;
+#endif
+
   // blocking
   input_handling();
 }